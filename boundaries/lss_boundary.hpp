@@ -13,13 +13,16 @@
 #if !defined(_LSS_BOUNDARY_HPP_)
 #define _LSS_BOUNDARY_HPP_
 
+#include "../common/lss_enumerations.hpp"
 #include "../common/lss_macros.hpp"
 #include "../common/lss_utility.hpp"
 #include <functional>
+#include <vector>
 
 namespace lss_boundary
 {
 
+using lss_enumerations::boundary_enum;
 using lss_utility::sptr_t;
 
 /**
@@ -32,6 +35,7 @@ using lss_utility::sptr_t;
 class boundary_1d
 {
   protected:
+    boundary_enum kind_;
     double linear_val_, const_val_;
     std::function<double(double)> linear_fun_{nullptr};
     std::function<double(double)> const_fun_{nullptr};
@@ -40,12 +44,18 @@ class boundary_1d
     explicit boundary_1d() = delete;
 
   public:
-    explicit boundary_1d(double linear, double constant);
+    explicit boundary_1d(boundary_enum kind, double linear, double constant);
 
-    explicit boundary_1d(const std::function<double(double)> &linear, const std::function<double(double)> &constant);
+    explicit boundary_1d(boundary_enum kind, const std::function<double(double)> &linear,
+                         const std::function<double(double)> &constant);
 
     virtual ~boundary_1d();
 
+    inline boundary_enum kind() const
+    {
+        return kind_;
+    }
+
     bool const &is_time_dependent() const;
 
     LSS_API virtual double value(double time) const = 0;
@@ -55,6 +65,8 @@ class boundary_1d
 
 using boundary_1d_ptr = sptr_t<boundary_1d>;
 using boundary_1d_pair = std::pair<boundary_1d_ptr, boundary_1d_ptr>;
+// one boundary pair per system solved in batch:
+using boundary_1d_pairs = std::vector<boundary_1d_pair>;
 
 /**
 
@@ -66,17 +78,23 @@ using boundary_1d_pair = std::pair<boundary_1d_ptr, boundary_1d_ptr>;
 class boundary_2d
 {
   protected:
+    boundary_enum kind_;
     std::function<double(double, double)> linear_;
     std::function<double(double, double)> const_;
 
     explicit boundary_2d() = delete;
 
   public:
-    explicit boundary_2d(const std::function<double(double, double)> &linear,
+    explicit boundary_2d(boundary_enum kind, const std::function<double(double, double)> &linear,
                          const std::function<double(double, double)> &constant);
 
     virtual ~boundary_2d();
 
+    inline boundary_enum kind() const
+    {
+        return kind_;
+    }
+
     LSS_API virtual double value(double time, double space_arg) const = 0;
 };
 
@@ -93,23 +111,42 @@ using boundary_2d_pair = std::pair<boundary_2d_ptr, boundary_2d_ptr>;
 class boundary_3d
 {
   protected:
+    boundary_enum kind_;
     std::function<double(double, double, double)> linear_;
     std::function<double(double, double, double)> const_;
 
     explicit boundary_3d() = delete;
 
   public:
-    explicit boundary_3d(const std::function<double(double, double, double)> &linear,
+    explicit boundary_3d(boundary_enum kind, const std::function<double(double, double, double)> &linear,
                          const std::function<double(double, double, double)> &constant);
 
     virtual ~boundary_3d();
 
+    inline boundary_enum kind() const
+    {
+        return kind_;
+    }
+
     LSS_API virtual double value(double time, double space_1_arg, double space_2_arg) const = 0;
 };
 
 using boundary_3d_ptr = sptr_t<boundary_3d>;
 using boundary_3d_pair = std::pair<boundary_3d_ptr, boundary_3d_ptr>;
 
+/**
+    @brief  Resolves boundary to its concrete type through its kind tag
+    @param  boundary - pointer to boundary
+    @retval non-owning pointer to concrete boundary or nullptr when boundary is of another kind
+**/
+template <typename concrete_boundary_t, typename boundary_t>
+inline concrete_boundary_t const *boundary_cast(sptr_t<boundary_t> const &boundary)
+{
+    return ((boundary != nullptr) && (boundary->kind() == concrete_boundary_t::tag))
+               ? static_cast<concrete_boundary_t const *>(boundary.get())
+               : nullptr;
+}
+
 } // namespace lss_boundary
 
 #endif ///_LSS_BOUNDARY_HPP_
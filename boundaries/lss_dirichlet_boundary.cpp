@@ -1,12 +1,15 @@
 #include "lss_dirichlet_boundary.hpp"
 
+#include <cmath>
+
 namespace lss_boundary
 {
-dirichlet_boundary_1d::dirichlet_boundary_1d(const std::function<double(double)> &value) : boundary_1d(nullptr, value)
+dirichlet_boundary_1d::dirichlet_boundary_1d(const std::function<double(double)> &value)
+    : boundary_1d(boundary_enum::Dirichlet, nullptr, value)
 {
 }
 
-dirichlet_boundary_1d::dirichlet_boundary_1d(double value) : boundary_1d(double{}, value)
+dirichlet_boundary_1d::dirichlet_boundary_1d(double value) : boundary_1d(boundary_enum::Dirichlet, double{}, value)
 {
 }
 
@@ -22,17 +25,33 @@ double dirichlet_boundary_1d::value() const
 }
 
 dirichlet_boundary_2d::dirichlet_boundary_2d(const std::function<double(double, double)> &value)
-    : boundary_2d(nullptr, value)
+    : boundary_2d(boundary_enum::Dirichlet, nullptr, value), slice_(nullptr, 0), slice_step_{}
+{
+}
+
+dirichlet_boundary_2d::dirichlet_boundary_2d(strided_span<const double> const &slice, double step)
+    : boundary_2d(boundary_enum::Dirichlet, nullptr, nullptr), slice_{slice}, slice_step_{step}
 {
+    LSS_ASSERT(slice.data() != nullptr, "dirichlet_boundary_2d: Slice must not be empty.");
+    LSS_ASSERT(step > 0.0, "dirichlet_boundary_2d: Step must be positive.");
 }
 
 double dirichlet_boundary_2d::value(double time, double space_arg) const
 {
+    if (slice_.data() != nullptr)
+    {
+        // space argument sits on the grid so rounding recovers its index exactly:
+        const double position = space_arg / slice_step_;
+        const std::size_t idx = static_cast<std::size_t>(position + 0.5);
+        LSS_ASSERT((std::abs(position - static_cast<double>(idx)) < 1.0e-9) && (idx < slice_.size()),
+                   "dirichlet_boundary_2d: Space argument must lie on the grid of the slice.");
+        return slice_[idx];
+    }
     return this->const_(time, space_arg);
 }
 
 dirichlet_boundary_3d::dirichlet_boundary_3d(const std::function<double(double, double, double)> &value)
-    : boundary_3d(nullptr, value)
+    : boundary_3d(boundary_enum::Dirichlet, nullptr, value)
 {
 }
 
@@ -17,11 +17,13 @@
 
 #include "../common/lss_macros.hpp"
 #include "../common/lss_utility.hpp"
+#include "../containers/lss_strided_span.hpp"
 #include "lss_boundary.hpp"
 
 namespace lss_boundary
 {
 
+using lss_containers::strided_span;
 using lss_utility::sptr_t;
 
 /**
@@ -37,6 +39,8 @@ class dirichlet_boundary_1d final : public boundary_1d
     dirichlet_boundary_1d() = delete;
 
   public:
+    static constexpr boundary_enum tag = boundary_enum::Dirichlet;
+
     explicit dirichlet_boundary_1d(const std::function<double(double)> &value);
 
     explicit dirichlet_boundary_1d(double value);
@@ -57,12 +61,26 @@ using dirichlet_boundary_1d_ptr = sptr_t<dirichlet_boundary_1d>;
 **/
 class dirichlet_boundary_2d final : public boundary_2d
 {
+  private:
+    // values read in place when the boundary is a slice of a live buffer:
+    strided_span<const double> slice_;
+    double slice_step_;
+
   protected:
     dirichlet_boundary_2d() = delete;
 
   public:
+    static constexpr boundary_enum tag = boundary_enum::Dirichlet;
+
     explicit dirichlet_boundary_2d(const std::function<double(double, double)> &value);
 
+    /**
+        @brief  Dirichlet boundary referencing a row or column slice of a live buffer
+        @param  slice - view of boundary values, one per grid point, must outlive the boundary
+        @param  step - grid step along the slice
+    **/
+    explicit dirichlet_boundary_2d(strided_span<const double> const &slice, double step);
+
     LSS_API double value(double time, double space_arg) const override;
 };
 
@@ -81,6 +99,8 @@ class dirichlet_boundary_3d final : public boundary_3d
     dirichlet_boundary_3d() = delete;
 
   public:
+    static constexpr boundary_enum tag = boundary_enum::Dirichlet;
+
     explicit dirichlet_boundary_3d(const std::function<double(double, double, double)> &value);
 
     LSS_API double value(double time, double space_1_arg, double space_2_arg) const override;
@@ -2,11 +2,12 @@
 
 namespace lss_boundary
 {
-neumann_boundary_1d::neumann_boundary_1d(const std::function<double(double)> &value) : boundary_1d(nullptr, value)
+neumann_boundary_1d::neumann_boundary_1d(const std::function<double(double)> &value)
+    : boundary_1d(boundary_enum::Neumann, nullptr, value)
 {
 }
 
-neumann_boundary_1d::neumann_boundary_1d(double value) : boundary_1d(double{}, value)
+neumann_boundary_1d::neumann_boundary_1d(double value) : boundary_1d(boundary_enum::Neumann, double{}, value)
 {
 }
 
@@ -22,7 +23,7 @@ double neumann_boundary_1d::value() const
 }
 
 neumann_boundary_2d::neumann_boundary_2d(const std::function<double(double, double)> &value)
-    : boundary_2d(nullptr, value)
+    : boundary_2d(boundary_enum::Neumann, nullptr, value)
 {
 }
 
@@ -32,7 +33,7 @@ double neumann_boundary_2d::value(double time, double space_arg) const
 }
 
 neumann_boundary_3d::neumann_boundary_3d(const std::function<double(double, double, double)> &value)
-    : boundary_3d(nullptr, value)
+    : boundary_3d(boundary_enum::Neumann, nullptr, value)
 {
 }
 
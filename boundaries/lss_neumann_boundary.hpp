@@ -34,6 +34,8 @@ class neumann_boundary_1d final : public boundary_1d
     neumann_boundary_1d() = delete;
 
   public:
+    static constexpr boundary_enum tag = boundary_enum::Neumann;
+
     explicit neumann_boundary_1d(double value);
 
     explicit neumann_boundary_1d(const std::function<double(double)> &value);
@@ -57,6 +59,8 @@ class neumann_boundary_2d final : public boundary_2d
     neumann_boundary_2d() = delete;
 
   public:
+    static constexpr boundary_enum tag = boundary_enum::Neumann;
+
     explicit neumann_boundary_2d(const std::function<double(double, double)> &value);
 
     LSS_API double value(double time, double space_arg) const override;
@@ -77,6 +81,8 @@ class neumann_boundary_3d final : public boundary_3d
     neumann_boundary_3d() = delete;
 
   public:
+    static constexpr boundary_enum tag = boundary_enum::Neumann;
+
     explicit neumann_boundary_3d(const std::function<double(double, double, double)> &value);
 
     LSS_API double value(double time, double space_1_arg, double space_2_arg) const override;
@@ -3,13 +3,14 @@
 namespace lss_boundary
 {
 
-robin_boundary_1d::robin_boundary_1d(double linear_value, double value) : boundary_1d(linear_value, value)
+robin_boundary_1d::robin_boundary_1d(double linear_value, double value)
+    : boundary_1d(boundary_enum::Robin, linear_value, value)
 {
 }
 
 robin_boundary_1d::robin_boundary_1d(const std::function<double(double)> &linear_value,
                                      const std::function<double(double)> &value)
-    : boundary_1d(linear_value, value)
+    : boundary_1d(boundary_enum::Robin, linear_value, value)
 {
 }
 
@@ -35,7 +36,7 @@ double robin_boundary_1d::value(double time) const
 
 robin_boundary_2d::robin_boundary_2d(const std::function<double(double, double)> &linear_value,
                                      const std::function<double(double, double)> &value)
-    : boundary_2d(linear_value, value)
+    : boundary_2d(boundary_enum::Robin, linear_value, value)
 {
 }
 
@@ -50,7 +51,7 @@ double robin_boundary_2d::value(double time, double space_arg) const
 
 robin_boundary_3d::robin_boundary_3d(const std::function<double(double, double, double)> &linear_value,
                                      const std::function<double(double, double, double)> &value)
-    : boundary_3d(linear_value, value)
+    : boundary_3d(boundary_enum::Robin, linear_value, value)
 {
 }
 
@@ -34,6 +34,8 @@ class robin_boundary_1d final : public boundary_1d
     robin_boundary_1d() = delete;
 
   public:
+    static constexpr boundary_enum tag = boundary_enum::Robin;
+
     explicit robin_boundary_1d(double linear_value, double value);
 
     explicit robin_boundary_1d(const std::function<double(double)> &linear_value,
@@ -60,6 +62,8 @@ class robin_boundary_2d final : public boundary_2d
     robin_boundary_2d() = delete;
 
   public:
+    static constexpr boundary_enum tag = boundary_enum::Robin;
+
     explicit robin_boundary_2d(const std::function<double(double, double)> &linear_value,
                                const std::function<double(double, double)> &value);
 
@@ -82,6 +86,8 @@ class robin_boundary_3d final : public boundary_3d
     robin_boundary_3d() = delete;
 
   public:
+    static constexpr boundary_enum tag = boundary_enum::Robin;
+
     explicit robin_boundary_3d(const std::function<double(double, double, double)> &linear_value,
                                const std::function<double(double, double, double)> &value);
 
@@ -57,13 +57,28 @@ enum class splitting_method_enum
 /**
     @enum  lss_enumerations::tridiagonal_method_enum
     @brief Tridiagonal solvers
+    @details KarawiaSolver replaces the three-point scheme by the fourth-order
+             five-point one and solves the pentadiagonal system (Dirichlet only)
 **/
 enum class tridiagonal_method_enum
 {
     CUDASolver,
     DoubleSweepSolver,
     SORSolver,
+    SpikeSolver,
     ThomasLUSolver,
+    KarawiaSolver,
+};
+
+/**
+    @enum  lss_enumerations::sor_sweep_enum
+    @brief Ordering of SOR sweep on host
+**/
+enum class sor_sweep_enum
+{
+    Natural,
+    RedBlack,
+    ChebyshevRedBlack,
 };
 
 /**
@@ -137,6 +152,31 @@ enum class explicit_pde_schemes_enum
     ADESaulyev
 };
 
+/**
+    @enum  lss_enumerations::boundary_enum
+    @brief Kind of boundary condition
+**/
+enum class boundary_enum
+{
+    Dirichlet,
+    Neumann,
+    Robin
+};
+
+/**
+    @enum  lss_enumerations::solver_phase_enum
+    @brief Phases of a solve timed by solver statistics, Total holds all the others
+**/
+enum class solver_phase_enum
+{
+    Total,
+    Coefficients,
+    RightHandSide,
+    LinearSolve,
+    BoundarySolve,
+    Copy
+};
+
 } // namespace lss_enumerations
 
 #endif ///_LSS_ENUMERATIONS_HPP_
@@ -0,0 +1,45 @@
+#include "lss_execution_policy.hpp"
+
+namespace lss_utility
+{
+
+execution_policy::execution_policy(std::size_t number_of_threads, std::vector<std::size_t> const &cpu_affinity)
+    : cpu_affinity_{cpu_affinity}
+{
+    LSS_VERIFY(number_of_threads > 0, "number_of_threads must be positive");
+    thread_pool_ = std::make_shared<lss_utility::thread_pool>(number_of_threads, cpu_affinity_);
+}
+
+execution_policy::~execution_policy()
+{
+}
+
+std::size_t execution_policy::number_of_threads() const
+{
+    return thread_pool_->size();
+}
+
+std::vector<std::size_t> const &execution_policy::cpu_affinity() const
+{
+    return cpu_affinity_;
+}
+
+bool execution_policy::is_serial() const
+{
+    return (thread_pool_->size() == 1);
+}
+
+thread_pool_ptr const &execution_policy::thread_pool() const
+{
+    return thread_pool_;
+}
+
+thread_pool_ptr make_thread_pool(execution_policy_ptr const &policy, std::size_t number_of_threads)
+{
+    if (policy)
+        return policy->thread_pool();
+    LSS_VERIFY(number_of_threads > 0, "number_of_threads must be positive");
+    return std::make_shared<lss_utility::thread_pool>(number_of_threads);
+}
+
+} // namespace lss_utility
@@ -0,0 +1,79 @@
+/**
+
+    @file      lss_execution_policy.hpp
+    @brief     Execution context shared by parallel kernels
+    @details   ~
+    @author    Michal Sara
+    @date      18.10.2026
+    @copyright  Michal Sara, 2021. All right reserved.
+
+**/
+#pragma once
+#if !defined(_LSS_EXECUTION_POLICY_HPP_)
+#define _LSS_EXECUTION_POLICY_HPP_
+
+#include <vector>
+
+#include "lss_macros.hpp"
+#include "lss_thread_pool.hpp"
+#include "lss_utility.hpp"
+
+namespace lss_utility
+{
+
+/**
+
+    @class   execution_policy
+    @brief   Owns the thread pool used by all parallel kernels of a solver
+    @details One policy may be handed to any number of solvers, they all
+             sweep on its single pool, so that running many solvers in one
+             process never runs more threads than the policy holds. A policy
+             with one thread is the serial fallback.
+
+**/
+class execution_policy
+{
+  private:
+    thread_pool_ptr thread_pool_;
+    std::vector<std::size_t> cpu_affinity_;
+
+    explicit execution_policy() = delete;
+
+  public:
+    /**
+        @brief execution_policy object constructor
+        @param number_of_threads - total number of workers including the calling thread
+        @param cpu_affinity - CPUs the spawned workers are pinned to in turn, empty leaves them to the OS
+    **/
+    LSS_API explicit execution_policy(std::size_t number_of_threads,
+                                      std::vector<std::size_t> const &cpu_affinity = std::vector<std::size_t>{});
+
+    ~execution_policy();
+
+    execution_policy(execution_policy const &) = delete;
+    execution_policy(execution_policy &&) = delete;
+    execution_policy &operator=(execution_policy const &) = delete;
+    execution_policy &operator=(execution_policy &&) = delete;
+
+    LSS_API std::size_t number_of_threads() const;
+
+    LSS_API std::vector<std::size_t> const &cpu_affinity() const;
+
+    LSS_API bool is_serial() const;
+
+    LSS_API thread_pool_ptr const &thread_pool() const;
+};
+
+using execution_policy_ptr = sptr_t<execution_policy>;
+
+/**
+    @brief  Pool of the policy, or a private pool when no policy is given
+    @param  policy - shared execution policy, may be null
+    @param  number_of_threads - size of the private pool
+    @retval thread pool the kernels sweep on
+**/
+LSS_API thread_pool_ptr make_thread_pool(execution_policy_ptr const &policy, std::size_t number_of_threads);
+
+} // namespace lss_utility
+
+#endif ///_LSS_EXECUTION_POLICY_HPP_
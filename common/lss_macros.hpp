@@ -72,4 +72,21 @@
         LSS_ASSERT(variable, message);                                                                                 \
     }
 
+// solver statistics (see lss_solver_stats.hpp) are recorded only with LSS_SOLVER_STATS defined:
+#if defined(LSS_SOLVER_STATS)
+#define LSS_STATS_CONCAT_IMPL(a, b) a##b
+#define LSS_STATS_CONCAT(a, b) LSS_STATS_CONCAT_IMPL(a, b)
+#define LSS_STATS_PHASE(stats, phase) lss_utility::phase_timer LSS_STATS_CONCAT(phase_timer_, __LINE__)(stats, phase)
+#define LSS_STATS_ADD(stats, counter, value)                                                                           \
+    {                                                                                                                  \
+        if (stats)                                                                                                     \
+        {                                                                                                              \
+            (stats)->counter(value);                                                                                   \
+        }                                                                                                              \
+    }
+#else
+#define LSS_STATS_PHASE(stats, phase)
+#define LSS_STATS_ADD(stats, counter, value)
+#endif
+
 #endif ///_LSS_MACROS_HPP_
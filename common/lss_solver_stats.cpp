@@ -0,0 +1,104 @@
+#include "lss_solver_stats.hpp"
+
+namespace lss_utility
+{
+
+solver_stats::solver_stats()
+{
+    reset();
+}
+
+solver_stats::~solver_stats()
+{
+}
+
+bool solver_stats::is_enabled()
+{
+#if defined(LSS_SOLVER_STATS)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void solver_stats::reset()
+{
+    for (auto &nanoseconds : nanoseconds_)
+    {
+        nanoseconds.store(0, std::memory_order_relaxed);
+    }
+    solves_.store(0, std::memory_order_relaxed);
+    sor_iterations_.store(0, std::memory_order_relaxed);
+    factorizations_.store(0, std::memory_order_relaxed);
+    bytes_allocated_.store(0, std::memory_order_relaxed);
+}
+
+void solver_stats::add_time(solver_phase_enum phase, std::chrono::nanoseconds elapsed)
+{
+    nanoseconds_[static_cast<std::size_t>(phase)].fetch_add(static_cast<std::uint64_t>(elapsed.count()),
+                                                            std::memory_order_relaxed);
+}
+
+void solver_stats::add_solves(std::size_t count)
+{
+    solves_.fetch_add(count, std::memory_order_relaxed);
+}
+
+void solver_stats::add_sor_iterations(std::size_t count)
+{
+    sor_iterations_.fetch_add(count, std::memory_order_relaxed);
+}
+
+void solver_stats::add_factorizations(std::size_t count)
+{
+    factorizations_.fetch_add(count, std::memory_order_relaxed);
+}
+
+void solver_stats::add_bytes_allocated(std::size_t bytes)
+{
+    bytes_allocated_.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+double solver_stats::seconds(solver_phase_enum phase) const
+{
+    return 1.0e-9 * static_cast<double>(nanoseconds_[static_cast<std::size_t>(phase)].load(std::memory_order_relaxed));
+}
+
+std::size_t solver_stats::number_of_solves() const
+{
+    return static_cast<std::size_t>(solves_.load(std::memory_order_relaxed));
+}
+
+std::size_t solver_stats::sor_iterations() const
+{
+    return static_cast<std::size_t>(sor_iterations_.load(std::memory_order_relaxed));
+}
+
+std::size_t solver_stats::factorizations() const
+{
+    return static_cast<std::size_t>(factorizations_.load(std::memory_order_relaxed));
+}
+
+std::size_t solver_stats::bytes_allocated() const
+{
+    return static_cast<std::size_t>(bytes_allocated_.load(std::memory_order_relaxed));
+}
+
+phase_timer::phase_timer(solver_stats_ptr const &stats, solver_phase_enum phase) : stats_{stats.get()}, phase_{phase}
+{
+    if (stats_ != nullptr)
+    {
+        start_ = std::chrono::steady_clock::now();
+    }
+}
+
+phase_timer::~phase_timer()
+{
+    if (stats_ != nullptr)
+    {
+        stats_->add_time(phase_, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now() - start_));
+    }
+}
+
+} // namespace lss_utility
@@ -0,0 +1,130 @@
+/**
+
+    @file      lss_solver_stats.hpp
+    @brief     Per-phase timing and counters of solves
+    @details   Instrumentation is compiled in only with LSS_SOLVER_STATS defined,
+               otherwise all statistics stay zero
+    @author    Michal Sara
+    @date      18.10.2026
+    @copyright  Michal Sara, 2021. All right reserved.
+
+**/
+#pragma once
+#if !defined(_LSS_SOLVER_STATS_HPP_)
+#define _LSS_SOLVER_STATS_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "lss_enumerations.hpp"
+#include "lss_macros.hpp"
+#include "lss_utility.hpp"
+
+namespace lss_utility
+{
+
+using lss_enumerations::solver_phase_enum;
+
+/**
+
+    @class   solver_stats
+    @brief   Cumulative wall time per phase and counters of all solves of a solver
+    @details Phases run by pool workers add up the time of every worker, so
+             they may exceed the Total phase. Workers record concurrently,
+             hence all counters are atomic.
+
+**/
+class solver_stats
+{
+  private:
+    static constexpr std::size_t number_of_phases_ = static_cast<std::size_t>(solver_phase_enum::Copy) + 1;
+    std::array<std::atomic<std::uint64_t>, number_of_phases_> nanoseconds_;
+    std::atomic<std::uint64_t> solves_;
+    std::atomic<std::uint64_t> sor_iterations_;
+    std::atomic<std::uint64_t> factorizations_;
+    std::atomic<std::uint64_t> bytes_allocated_;
+
+  public:
+    LSS_API explicit solver_stats();
+
+    ~solver_stats();
+
+    solver_stats(solver_stats const &) = delete;
+    solver_stats(solver_stats &&) = delete;
+    solver_stats &operator=(solver_stats const &) = delete;
+    solver_stats &operator=(solver_stats &&) = delete;
+
+    /**
+        @brief  True if the library was built with LSS_SOLVER_STATS
+    **/
+    LSS_API static bool is_enabled();
+
+    LSS_API void reset();
+
+    void add_time(solver_phase_enum phase, std::chrono::nanoseconds elapsed);
+
+    void add_solves(std::size_t count);
+
+    void add_sor_iterations(std::size_t count);
+
+    void add_factorizations(std::size_t count);
+
+    void add_bytes_allocated(std::size_t bytes);
+
+    /**
+        @brief  Cumulative wall time of the phase
+        @param  phase - solve phase
+        @retval time in seconds
+    **/
+    LSS_API double seconds(solver_phase_enum phase) const;
+
+    /**
+        @brief  Number of solved linear systems, each system of a batch counts
+    **/
+    LSS_API std::size_t number_of_solves() const;
+
+    LSS_API std::size_t sor_iterations() const;
+
+    /**
+        @brief  Number of computed matrix factorizations, each system of a batch counts
+    **/
+    LSS_API std::size_t factorizations() const;
+
+    /**
+        @brief  Bytes of working containers allocated by the solves
+    **/
+    LSS_API std::size_t bytes_allocated() const;
+};
+
+using solver_stats_ptr = sptr_t<solver_stats>;
+
+/**
+    phase_timer object
+
+    Adds the wall time of its scope to the phase, does nothing without statistics.
+ */
+class phase_timer
+{
+  private:
+    solver_stats *stats_;
+    solver_phase_enum phase_;
+    std::chrono::steady_clock::time_point start_;
+
+    explicit phase_timer() = delete;
+
+  public:
+    explicit phase_timer(solver_stats_ptr const &stats, solver_phase_enum phase);
+
+    ~phase_timer();
+
+    phase_timer(phase_timer const &) = delete;
+    phase_timer(phase_timer &&) = delete;
+    phase_timer &operator=(phase_timer const &) = delete;
+    phase_timer &operator=(phase_timer &&) = delete;
+};
+
+} // namespace lss_utility
+
+#endif ///_LSS_SOLVER_STATS_HPP_
@@ -0,0 +1,187 @@
+#include "lss_thread_pool.hpp"
+
+#if defined(_WIN32)
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace lss_utility
+{
+
+namespace
+{
+
+// pool whose job the current thread is running, if any:
+thread_local thread_pool const *running_pool = nullptr;
+
+#if defined(_WIN32)
+const std::size_t max_cpu_index = 8 * sizeof(DWORD_PTR);
+#elif defined(__linux__)
+const std::size_t max_cpu_index = CPU_SETSIZE;
+#else
+const std::size_t max_cpu_index = std::size_t(-1);
+#endif
+
+// affinity is a hint, a failure leaves the worker to the OS scheduler:
+void pin(std::thread &worker, std::size_t cpu)
+{
+#if defined(_WIN32)
+    SetThreadAffinityMask(worker.native_handle(), DWORD_PTR(1) << cpu);
+#elif defined(__linux__)
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu, &cpu_set);
+    pthread_setaffinity_np(worker.native_handle(), sizeof(cpu_set_t), &cpu_set);
+#endif
+}
+
+} // namespace
+
+thread_pool::thread_pool(std::size_t number_of_threads)
+    : thread_pool(number_of_threads, std::vector<std::size_t>{})
+{
+}
+
+thread_pool::thread_pool(std::size_t number_of_threads, std::vector<std::size_t> const &cpu_affinity)
+    : size_{number_of_threads}, generation_{0}, active_{0}, pending_{0}, stop_{false}
+{
+    LSS_ASSERT(number_of_threads > 0, "thread_pool: number of threads must be positive");
+    for (auto const &cpu : cpu_affinity)
+    {
+        LSS_ASSERT(cpu < max_cpu_index, "thread_pool: cpu index is out of affinity mask range");
+    }
+    workers_.reserve(size_ - 1);
+    for (std::size_t t = 1; t < size_; ++t)
+    {
+        workers_.emplace_back(&thread_pool::worker_loop, this, t);
+        if (!cpu_affinity.empty())
+            pin(workers_.back(), cpu_affinity[(t - 1) % cpu_affinity.size()]);
+    }
+}
+
+thread_pool::~thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    start_cv_.notify_all();
+    for (auto &worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+void thread_pool::worker_loop(std::size_t worker_idx)
+{
+    std::size_t seen_generation{0};
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        start_cv_.wait(lock, [&] { return stop_ || (generation_ != seen_generation); });
+        if (stop_)
+            return;
+        seen_generation = generation_;
+        if (worker_idx >= active_)
+            continue;
+
+        lock.unlock();
+        try
+        {
+            run_task(worker_idx);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> error_lock(mutex_);
+            if (!error_)
+                error_ = std::current_exception();
+        }
+        lock.lock();
+        if (--pending_ == 0)
+            done_cv_.notify_one();
+    }
+}
+
+void thread_pool::run_task(std::size_t worker_idx)
+{
+    thread_pool const *outer_pool = running_pool;
+    running_pool = this;
+    try
+    {
+        task_(worker_idx);
+    }
+    catch (...)
+    {
+        running_pool = outer_pool;
+        throw;
+    }
+    running_pool = outer_pool;
+}
+
+std::size_t thread_pool::size() const
+{
+    return size_;
+}
+
+void thread_pool::parallel_for(std::size_t first, std::size_t last,
+                               std::function<void(std::size_t, std::size_t)> const &fun)
+{
+    if (last <= first)
+        return;
+    const std::size_t n = last - first;
+    const std::size_t workers = (n < size_) ? n : size_;
+    if ((workers == 1) || (running_pool == this))
+    {
+        for (std::size_t idx = first; idx < last; ++idx)
+        {
+            fun(0, idx);
+        }
+        return;
+    }
+    // worker w takes the contiguous chunk [first + n*w/workers, first + n*(w+1)/workers):
+    auto chunk = [&](std::size_t worker_idx) {
+        const std::size_t begin = first + (n * worker_idx) / workers;
+        const std::size_t end = first + (n * (worker_idx + 1)) / workers;
+        for (std::size_t idx = begin; idx < end; ++idx)
+        {
+            fun(worker_idx, idx);
+        }
+    };
+    // one job at a time, other submitting threads wait here:
+    std::lock_guard<std::mutex> job_lock(job_mutex_);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = chunk;
+        error_ = nullptr;
+        active_ = workers;
+        pending_ = workers - 1;
+        ++generation_;
+    }
+    start_cv_.notify_all();
+
+    std::exception_ptr error;
+    try
+    {
+        run_task(0);
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [&] { return pending_ == 0; });
+    task_ = nullptr;
+    if (!error)
+        error = error_;
+    lock.unlock();
+    if (error)
+        std::rethrow_exception(error);
+}
+
+} // namespace lss_utility
@@ -0,0 +1,103 @@
+/**
+
+    @file      lss_thread_pool.hpp
+    @brief     Fixed-size thread pool for line sweeps
+    @details   ~
+    @author    Michal Sara
+    @date      18.10.2026
+    @copyright  Michal Sara, 2021. All right reserved.
+
+**/
+#pragma once
+#if !defined(_LSS_THREAD_POOL_HPP_)
+#define _LSS_THREAD_POOL_HPP_
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "lss_macros.hpp"
+#include "lss_utility.hpp"
+
+namespace lss_utility
+{
+
+/**
+
+    @class   thread_pool
+    @brief   Fixed-size pool of worker threads
+    @details The calling thread takes part in the work as worker 0, so a pool
+             of size 1 does not spawn any thread and runs everything inline.
+             Indices are split into contiguous chunks, one per worker, so the
+             index-to-worker assignment is fixed for a given pool size.
+             Jobs submitted from several threads run one after another and a
+             job submitted from inside a running job of the same pool runs
+             inline on the submitting worker, so a pool shared by many
+             solvers never runs more threads than its size.
+
+**/
+class thread_pool
+{
+  private:
+    std::size_t size_;
+    std::vector<std::thread> workers_;
+    std::mutex job_mutex_;
+    std::mutex mutex_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    std::function<void(std::size_t)> task_;
+    std::exception_ptr error_;
+    std::size_t generation_;
+    std::size_t active_;
+    std::size_t pending_;
+    bool stop_;
+
+    explicit thread_pool() = delete;
+
+    void worker_loop(std::size_t worker_idx);
+
+    void run_task(std::size_t worker_idx);
+
+  public:
+    /**
+        @brief thread_pool object constructor
+        @param number_of_threads - total number of workers including the calling thread
+    **/
+    explicit thread_pool(std::size_t number_of_threads);
+
+    /**
+        @brief thread_pool object constructor
+        @param number_of_threads - total number of workers including the calling thread
+        @param cpu_affinity - worker t > 0 is pinned to cpu_affinity[(t - 1) % size], the calling thread is not
+               pinned, empty leaves all workers to the OS scheduler
+    **/
+    explicit thread_pool(std::size_t number_of_threads, std::vector<std::size_t> const &cpu_affinity);
+
+    ~thread_pool();
+
+    thread_pool(thread_pool const &) = delete;
+    thread_pool(thread_pool &&) = delete;
+    thread_pool &operator=(thread_pool const &) = delete;
+    thread_pool &operator=(thread_pool &&) = delete;
+
+    LSS_API std::size_t size() const;
+
+    /**
+        @brief  Calls fun(worker_idx, idx) for every idx in [first, last) and blocks until all calls returned,
+                calls nested in a running job of this pool go serially with worker_idx 0
+        @param  first - first index
+        @param  last - one past last index
+        @param  fun - callable receiving worker index (in [0, size())) and index
+    **/
+    LSS_API void parallel_for(std::size_t first, std::size_t last,
+                              std::function<void(std::size_t, std::size_t)> const &fun);
+};
+
+using thread_pool_ptr = sptr_t<thread_pool>;
+
+} // namespace lss_utility
+
+#endif ///_LSS_THREAD_POOL_HPP_
@@ -0,0 +1,78 @@
+/**
+
+    @file      lss_aligned_allocator.hpp
+    @brief     Allocator returning cache-line aligned storage
+    @details   ~
+    @author    Michal Sara
+    @date      18.10.2026
+    @copyright  Michal Sara, 2021. All right reserved.
+
+**/
+#pragma once
+#if !defined(_LSS_ALIGNED_ALLOCATOR_HPP_)
+#define _LSS_ALIGNED_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace lss_containers
+{
+
+/**
+
+    @class   aligned_allocator
+    @brief   Standard allocator with over-aligned storage
+    @details Alignment must be a power of two not smaller than alignof(T).
+
+**/
+template <typename T, std::size_t Alignment = 64> class aligned_allocator
+{
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+    static_assert(Alignment >= alignof(T), "Alignment must not be smaller than alignof(T)");
+
+  public:
+    using value_type = T;
+
+    template <typename U> struct rebind
+    {
+        using other = aligned_allocator<U, Alignment>;
+    };
+
+    aligned_allocator() noexcept
+    {
+    }
+
+    template <typename U> aligned_allocator(aligned_allocator<U, Alignment> const &) noexcept
+    {
+    }
+
+    T *allocate(std::size_t n)
+    {
+        return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+    }
+
+    void deallocate(T *ptr, std::size_t) noexcept
+    {
+        ::operator delete(ptr, std::align_val_t{Alignment});
+    }
+};
+
+template <typename T, typename U, std::size_t Alignment>
+bool operator==(aligned_allocator<T, Alignment> const &, aligned_allocator<U, Alignment> const &) noexcept
+{
+    return true;
+}
+
+template <typename T, typename U, std::size_t Alignment>
+bool operator!=(aligned_allocator<T, Alignment> const &, aligned_allocator<U, Alignment> const &) noexcept
+{
+    return false;
+}
+
+// contiguous 64-byte aligned storage used by the 2D and 3D containers:
+using aligned_container_t = std::vector<double, aligned_allocator<double, 64>>;
+
+} // namespace lss_containers
+
+#endif ///_LSS_ALIGNED_ALLOCATOR_HPP_
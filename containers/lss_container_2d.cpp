@@ -6,25 +6,40 @@
 namespace lss_containers
 {
 
+void transpose(double const *src, std::size_t rows, std::size_t columns, double *dest)
+{
+    // 32 x 32 tile of doubles is 8KB, source and destination tiles fit into L1 together:
+    const std::size_t tile = 32;
+    for (std::size_t rb = 0; rb < rows; rb += tile)
+    {
+        const std::size_t r_end = std::min(rb + tile, rows);
+        for (std::size_t cb = 0; cb < columns; cb += tile)
+        {
+            const std::size_t c_end = std::min(cb + tile, columns);
+            // writes run along the destination rows, reads stay within the cached source tile:
+            for (std::size_t c = cb; c < c_end; ++c)
+            {
+                for (std::size_t r = rb; r < r_end; ++r)
+                {
+                    dest[c * rows + r] = src[r * columns + c];
+                }
+            }
+        }
+    }
+}
+
 container_2d<by_enum::Row>::container_2d()
 {
 }
 
-container_2d<by_enum::Row>::container_2d(std::size_t rows, std::size_t columns) : rows_{rows}, columns_{columns}
+container_2d<by_enum::Row>::container_2d(std::size_t rows, std::size_t columns)
+    : rows_{rows}, columns_{columns}, data_(rows * columns)
 {
-    for (std::size_t r = 0; r < rows; ++r)
-    {
-        data_.emplace_back(std::vector<double>(static_cast<std::size_t>(columns)));
-    }
 }
 
 container_2d<by_enum::Row>::container_2d(std::size_t rows, std::size_t columns, double value)
-    : rows_{rows}, columns_{columns}
+    : rows_{rows}, columns_{columns}, data_(rows * columns, value)
 {
-    for (std::size_t r = 0; r < rows; ++r)
-    {
-        data_.emplace_back(std::vector<double>(static_cast<std::size_t>(columns), value));
-    }
 }
 
 container_2d<by_enum::Row>::~container_2d()
@@ -42,16 +57,10 @@ container_2d<by_enum::Row>::container_2d(container_2d &&other) noexcept
 }
 
 container_2d<by_enum::Row>::container_2d(container_2d<by_enum::Column> const &copy)
-    : rows_{copy.rows()}, columns_{copy.columns()}
+    : rows_{copy.rows()}, columns_{copy.columns()}, data_(copy.rows() * copy.columns())
 {
-    for (std::size_t r = 0; r < rows_; ++r)
-    {
-        data_.emplace_back(std::vector<double>(static_cast<std::size_t>(columns_)));
-        for (std::size_t c = 0; c < columns_; ++c)
-        {
-            data_[r][c] = copy(r, c);
-        }
-    }
+    // column-wise storage is the row-wise storage of the transposed matrix:
+    transpose(copy.raw_data(), columns_, rows_, data_.data());
 }
 
 container_2d<by_enum::Row> &container_2d<by_enum::Row>::operator=(container_2d const &copy)
@@ -78,33 +87,19 @@ container_2d<by_enum::Row> &container_2d<by_enum::Row>::operator=(container_2d &
 
 container_2d<by_enum::Row> &container_2d<by_enum::Row>::operator=(container_2d<by_enum::Column> const &copy)
 {
-    data_.clear();
     rows_ = copy.rows();
     columns_ = copy.columns();
-    for (std::size_t r = 0; r < rows_; ++r)
-    {
-        data_.emplace_back(std::vector<double>(static_cast<std::size_t>(columns_)));
-        for (std::size_t c = 0; c < columns_; ++c)
-        {
-            data_[r][c] = copy(r, c);
-        }
-    }
+    // reuses the storage when dimensions are unchanged:
+    data_.resize(rows_ * columns_);
+    // column-wise storage is the row-wise storage of the transposed matrix:
+    transpose(copy.raw_data(), columns_, rows_, data_.data());
     return *this;
 }
 
 void container_2d<by_enum::Row>::from_data(std::vector<double> const &data)
 {
-    auto const total_size = rows_ * columns_;
-    std::size_t tid{};
-    LSS_ASSERT(total_size == data.size(), "Data are not of the correct size");
-    for (std::size_t r = 0; r < rows_; ++r)
-    {
-        for (std::size_t c = 0; c < columns_; ++c)
-        {
-            tid = c + r * columns_;
-            data_[r][c] = data[tid];
-        }
-    }
+    LSS_ASSERT(rows_ * columns_ == data.size(), "Data are not of the correct size");
+    std::copy(data.begin(), data.end(), data_.begin());
 }
 
 std::size_t container_2d<by_enum::Row>::rows() const
@@ -120,22 +115,11 @@ std::size_t container_2d<by_enum::Row>::total_size() const
     return rows_ * columns_;
 }
 
-double container_2d<by_enum::Row>::operator()(std::size_t row_idx, std::size_t col_idx) const
-{
-    LSS_ASSERT(row_idx < rows_, "Outside of row range");
-    LSS_ASSERT(col_idx < columns_, "Outside of column range");
-    return data_[row_idx][col_idx];
-}
-
 std::vector<double> container_2d<by_enum::Row>::operator()(std::size_t row_idx) const
 {
     LSS_ASSERT(row_idx < rows_, "Outside of row range");
-    return data_[row_idx];
-}
-
-double container_2d<by_enum::Row>::at(std::size_t row_idx, std::size_t col_idx) const
-{
-    return operator()(row_idx, col_idx);
+    auto const first = data_.begin() + row_idx * columns_;
+    return std::vector<double>(first, first + columns_);
 }
 
 std::vector<double> container_2d<by_enum::Row>::at(std::size_t row_idx) const
@@ -147,27 +131,18 @@ void container_2d<by_enum::Row>::operator()(std::size_t row_idx, std::vector<dou
 {
     LSS_ASSERT(row_idx < rows_, "Outside of row range");
     LSS_ASSERT(cont.size() == columns_, "Outside of column range");
-    data_[row_idx] = std::move(cont);
+    std::copy(cont.begin(), cont.end(), data_.begin() + row_idx * columns_);
 }
 
-void container_2d<by_enum::Row>::operator()(std::size_t row_idx, std::size_t col_idx, double value)
+std::vector<double> const container_2d<by_enum::Row>::data() const
 {
-    LSS_ASSERT(row_idx < rows_, "Outside of row range");
-    LSS_ASSERT(col_idx < columns_, "Outside of column range");
-    data_[row_idx][col_idx] = value;
+    return std::vector<double>(data_.begin(), data_.end());
 }
 
-std::vector<double> const container_2d<by_enum::Row>::data() const
+void container_2d<by_enum::Row>::data(container_t &cont) const
 {
-    std::vector<double> d(rows_ * columns_);
-    auto itr = d.begin();
-    for (std::size_t r = 0; r < rows_; ++r)
-    {
-        auto row = at(r);
-        std::copy(row.begin(), row.end(), itr);
-        std::advance(itr, columns_);
-    }
-    return d;
+    LSS_ASSERT(cont.size() == data_.size(), "Data are not of the correct size");
+    std::copy(data_.begin(), data_.end(), cont.begin());
 }
 
 /// COLUMN-WISE
@@ -176,21 +151,14 @@ container_2d<by_enum::Column>::container_2d()
 {
 }
 
-container_2d<by_enum::Column>::container_2d(std::size_t rows, std::size_t columns) : rows_{rows}, columns_{columns}
+container_2d<by_enum::Column>::container_2d(std::size_t rows, std::size_t columns)
+    : rows_{rows}, columns_{columns}, data_(rows * columns)
 {
-    for (std::size_t c = 0; c < columns; ++c)
-    {
-        data_.emplace_back(std::vector<double>(static_cast<std::size_t>(rows)));
-    }
 }
 
 container_2d<by_enum::Column>::container_2d(std::size_t rows, std::size_t columns, double value)
-    : rows_{rows}, columns_{columns}
+    : rows_{rows}, columns_{columns}, data_(rows * columns, value)
 {
-    for (std::size_t c = 0; c < columns; ++c)
-    {
-        data_.emplace_back(std::vector<double>(static_cast<std::size_t>(rows), value));
-    }
 }
 
 container_2d<by_enum::Column>::~container_2d()
@@ -208,16 +176,9 @@ container_2d<by_enum::Column>::container_2d(container_2d &&other) noexcept
 }
 
 container_2d<by_enum::Column>::container_2d(container_2d<by_enum::Row> const &copy)
-    : rows_{copy.rows()}, columns_{copy.columns()}
+    : rows_{copy.rows()}, columns_{copy.columns()}, data_(copy.rows() * copy.columns())
 {
-    for (std::size_t c = 0; c < columns_; ++c)
-    {
-        data_.emplace_back(std::vector<double>(static_cast<std::size_t>(rows_)));
-        for (std::size_t r = 0; r < rows_; ++r)
-        {
-            data_[c][r] = copy(r, c);
-        }
-    }
+    transpose(copy.raw_data(), rows_, columns_, data_.data());
 }
 
 container_2d<by_enum::Column> &container_2d<by_enum::Column>::operator=(container_2d const &copy)
@@ -244,18 +205,11 @@ container_2d<by_enum::Column> &container_2d<by_enum::Column>::operator=(containe
 
 container_2d<by_enum::Column> &container_2d<by_enum::Column>::operator=(container_2d<by_enum::Row> const &copy)
 {
-    data_.clear();
     rows_ = copy.rows();
     columns_ = copy.columns();
-
-    for (std::size_t c = 0; c < columns_; ++c)
-    {
-        data_.emplace_back(std::vector<double>(static_cast<std::size_t>(rows_)));
-        for (std::size_t r = 0; r < rows_; ++r)
-        {
-            data_[c][r] = copy(r, c);
-        }
-    }
+    // reuses the storage when dimensions are unchanged:
+    data_.resize(rows_ * columns_);
+    transpose(copy.raw_data(), rows_, columns_, data_.data());
     return *this;
 }
 
@@ -274,35 +228,15 @@ std::size_t container_2d<by_enum::Column>::total_size() const
 
 void container_2d<by_enum::Column>::from_data(std::vector<double> const &data)
 {
-    auto const total_size = rows_ * columns_;
-    std::size_t tid{};
-    LSS_ASSERT(total_size == data.size(), "Data are not of the correct size");
-    for (std::size_t c = 0; c < columns_; ++c)
-    {
-        for (std::size_t r = 0; r < rows_; ++r)
-        {
-            tid = r + c * rows_;
-            data_[c][r] = data[tid];
-        }
-    }
-}
-
-double container_2d<by_enum::Column>::operator()(std::size_t row_idx, std::size_t col_idx) const
-{
-    LSS_ASSERT(row_idx < rows_, "Outside of row range");
-    LSS_ASSERT(col_idx < columns_, "Outside of column range");
-    return data_[col_idx][row_idx];
+    LSS_ASSERT(rows_ * columns_ == data.size(), "Data are not of the correct size");
+    std::copy(data.begin(), data.end(), data_.begin());
 }
 
 std::vector<double> container_2d<by_enum::Column>::operator()(std::size_t col_idx) const
 {
     LSS_ASSERT(col_idx < columns_, "Outside of column range");
-    return data_[col_idx];
-}
-
-double container_2d<by_enum::Column>::at(std::size_t row_idx, std::size_t col_idx) const
-{
-    return operator()(row_idx, col_idx);
+    auto const first = data_.begin() + col_idx * rows_;
+    return std::vector<double>(first, first + rows_);
 }
 
 std::vector<double> container_2d<by_enum::Column>::at(std::size_t col_idx) const
@@ -314,27 +248,18 @@ void container_2d<by_enum::Column>::operator()(std::size_t col_idx, std::vector<
 {
     LSS_ASSERT(col_idx < columns_, "Outside of column range");
     LSS_ASSERT(cont.size() == rows_, "Outside of row range");
-    data_[col_idx] = std::move(cont);
+    std::copy(cont.begin(), cont.end(), data_.begin() + col_idx * rows_);
 }
 
-void container_2d<by_enum::Column>::operator()(std::size_t row_idx, std::size_t col_idx, double value)
+std::vector<double> const container_2d<by_enum::Column>::data() const
 {
-    LSS_ASSERT(row_idx < rows_, "Outside of row range");
-    LSS_ASSERT(col_idx < columns_, "Outside of column range");
-    data_[col_idx][row_idx] = value;
+    return std::vector<double>(data_.begin(), data_.end());
 }
 
-std::vector<double> const container_2d<by_enum::Column>::data() const
+void container_2d<by_enum::Column>::data(container_t &cont) const
 {
-    std::vector<double> d(rows_ * columns_);
-    auto itr = d.begin();
-    for (std::size_t c = 0; c < columns_; ++c)
-    {
-        auto col = at(c);
-        std::copy(col.begin(), col.end(), itr);
-        std::advance(itr, rows_);
-    }
-    return d;
+    LSS_ASSERT(cont.size() == data_.size(), "Data are not of the correct size");
+    std::copy(data_.begin(), data_.end(), cont.begin());
 }
 
 } // namespace lss_containers
@@ -15,6 +15,9 @@
 #include "../common/lss_enumerations.hpp"
 #include "../common/lss_macros.hpp"
 #include "../common/lss_utility.hpp"
+#include "lss_aligned_allocator.hpp"
+#include "lss_strided_span.hpp"
+#include <algorithm>
 #include <typeinfo>
 #include <vector>
 
@@ -41,7 +44,8 @@ template <> class container_2d<by_enum::Row>
   private:
     std::size_t rows_;
     std::size_t columns_;
-    std::vector<std::vector<double>> data_;
+    // row-wise in single allocation:
+    aligned_container_t data_;
 
     explicit container_2d();
 
@@ -71,7 +75,12 @@ template <> class container_2d<by_enum::Row>
         @param  col_idx
         @retval value from container_2d at potision (row_idx,col_idx)
     **/
-    LSS_API double operator()(std::size_t row_idx, std::size_t col_idx) const;
+    inline double operator()(std::size_t row_idx, std::size_t col_idx) const
+    {
+        LSS_ASSERT(row_idx < rows_, "Outside of row range");
+        LSS_ASSERT(col_idx < columns_, "Outside of column range");
+        return data_[row_idx * columns_ + col_idx];
+    }
 
     /**
         @brief
@@ -86,7 +95,10 @@ template <> class container_2d<by_enum::Row>
         @param  col_idx
         @retval value from container_2d at potision (row_idx,col_idx)
     **/
-    LSS_API double at(std::size_t row_idx, std::size_t col_idx) const;
+    inline double at(std::size_t row_idx, std::size_t col_idx) const
+    {
+        return operator()(row_idx, col_idx);
+    }
 
     /**
         @brief
@@ -108,13 +120,72 @@ template <> class container_2d<by_enum::Row>
         @param col_idx
         @param value
     **/
-    LSS_API void operator()(std::size_t row_idx, std::size_t col_idx, double value);
+    inline void operator()(std::size_t row_idx, std::size_t col_idx, double value)
+    {
+        LSS_ASSERT(row_idx < rows_, "Outside of row range");
+        LSS_ASSERT(col_idx < columns_, "Outside of column range");
+        data_[row_idx * columns_ + col_idx] = value;
+    }
 
     /**
         @brief
         @retval data as flat vector row-wise
     **/
     LSS_API container_t const data() const;
+
+    /**
+        @brief  copy data as flat vector row-wise into cont of total_size() elements
+        @param  cont
+    **/
+    LSS_API void data(container_t &cont) const;
+
+    /**
+        @brief
+        @param  row_idx
+        @retval non-owning view of row at position (row_idx)
+    **/
+    inline strided_span<double> row(std::size_t row_idx)
+    {
+        LSS_ASSERT(row_idx < rows_, "Outside of row range");
+        return strided_span<double>(data_.data() + row_idx * columns_, columns_, 1);
+    }
+
+    inline strided_span<const double> row(std::size_t row_idx) const
+    {
+        LSS_ASSERT(row_idx < rows_, "Outside of row range");
+        return strided_span<const double>(data_.data() + row_idx * columns_, columns_, 1);
+    }
+
+    /**
+        @brief
+        @param  col_idx
+        @retval non-owning view of column at position (col_idx)
+    **/
+    inline strided_span<double> column(std::size_t col_idx)
+    {
+        LSS_ASSERT(col_idx < columns_, "Outside of column range");
+        return strided_span<double>(data_.data() + col_idx, rows_, columns_);
+    }
+
+    inline strided_span<const double> column(std::size_t col_idx) const
+    {
+        LSS_ASSERT(col_idx < columns_, "Outside of column range");
+        return strided_span<const double>(data_.data() + col_idx, rows_, columns_);
+    }
+
+    /**
+        @brief
+        @retval pointer to contiguous row-wise storage of total_size() elements
+    **/
+    inline double *raw_data()
+    {
+        return data_.data();
+    }
+
+    inline double const *raw_data() const
+    {
+        return data_.data();
+    }
 };
 
 /**
@@ -129,7 +200,8 @@ template <> class container_2d<by_enum::Column>
   private:
     std::size_t rows_;
     std::size_t columns_;
-    std::vector<std::vector<double>> data_;
+    // column-wise in single allocation:
+    aligned_container_t data_;
 
     explicit container_2d();
 
@@ -159,7 +231,12 @@ template <> class container_2d<by_enum::Column>
         @param  col_idx
         @retval   value from container_2d at potision (row_idx,col_idx)
     **/
-    LSS_API double operator()(std::size_t row_idx, std::size_t col_idx) const;
+    inline double operator()(std::size_t row_idx, std::size_t col_idx) const
+    {
+        LSS_ASSERT(row_idx < rows_, "Outside of row range");
+        LSS_ASSERT(col_idx < columns_, "Outside of column range");
+        return data_[col_idx * rows_ + row_idx];
+    }
 
     /**
         @brief
@@ -174,7 +251,10 @@ template <> class container_2d<by_enum::Column>
         @param  col_idx
         @retval  value from container_2d at potision (row_idx,col_idx)
     **/
-    LSS_API double at(std::size_t row_idx, std::size_t col_idx) const;
+    inline double at(std::size_t row_idx, std::size_t col_idx) const
+    {
+        return operator()(row_idx, col_idx);
+    }
 
     /**
         @brief
@@ -196,15 +276,83 @@ template <> class container_2d<by_enum::Column>
         @param col_idx
         @param value
     **/
-    LSS_API void operator()(std::size_t row_idx, std::size_t col_idx, double value);
+    inline void operator()(std::size_t row_idx, std::size_t col_idx, double value)
+    {
+        LSS_ASSERT(row_idx < rows_, "Outside of row range");
+        LSS_ASSERT(col_idx < columns_, "Outside of column range");
+        data_[col_idx * rows_ + row_idx] = value;
+    }
 
     /**
         @brief
         @retval  data as flat vector column-wise
     **/
     LSS_API container_t const data() const;
+
+    /**
+        @brief  copy data as flat vector column-wise into cont of total_size() elements
+        @param  cont
+    **/
+    LSS_API void data(container_t &cont) const;
+
+    /**
+        @brief
+        @param  row_idx
+        @retval non-owning view of row at position (row_idx)
+    **/
+    inline strided_span<double> row(std::size_t row_idx)
+    {
+        LSS_ASSERT(row_idx < rows_, "Outside of row range");
+        return strided_span<double>(data_.data() + row_idx, columns_, rows_);
+    }
+
+    inline strided_span<const double> row(std::size_t row_idx) const
+    {
+        LSS_ASSERT(row_idx < rows_, "Outside of row range");
+        return strided_span<const double>(data_.data() + row_idx, columns_, rows_);
+    }
+
+    /**
+        @brief
+        @param  col_idx
+        @retval non-owning view of column at position (col_idx)
+    **/
+    inline strided_span<double> column(std::size_t col_idx)
+    {
+        LSS_ASSERT(col_idx < columns_, "Outside of column range");
+        return strided_span<double>(data_.data() + col_idx * rows_, rows_, 1);
+    }
+
+    inline strided_span<const double> column(std::size_t col_idx) const
+    {
+        LSS_ASSERT(col_idx < columns_, "Outside of column range");
+        return strided_span<const double>(data_.data() + col_idx * rows_, rows_, 1);
+    }
+
+    /**
+        @brief
+        @retval pointer to contiguous column-wise storage of total_size() elements
+    **/
+    inline double *raw_data()
+    {
+        return data_.data();
+    }
+
+    inline double const *raw_data() const
+    {
+        return data_.data();
+    }
 };
 
+/**
+    @brief  Transposes matrix tile by tile, so that both source and destination tiles stay in cache
+    @param  src - rows x columns values stored row-wise
+    @param  rows - number of rows of src
+    @param  columns - number of columns of src
+    @param  dest - columns x rows values stored row-wise
+**/
+LSS_API void transpose(double const *src, std::size_t rows, std::size_t columns, double *dest);
+
 /**
     @brief  copy container from one to another
     @tparam by
@@ -215,16 +363,8 @@ template <by_enum by> void copy(container_2d<by> &dest, container_2d<by> const &
 {
     LSS_ASSERT(dest.columns() == src.columns(), "dest and src must have same dimensions");
     LSS_ASSERT(dest.rows() == src.rows(), "dest and src must have same dimensions");
-    std::size_t size;
-    if (by == by_enum::Row)
-        size = dest.rows();
-    else
-        size = dest.columns();
-
-    for (std::size_t t = 0; t < size; ++t)
-    {
-        dest(t, src.at(t));
-    }
+    // both share the same layout:
+    std::copy(src.raw_data(), src.raw_data() + src.total_size(), dest.raw_data());
 }
 
 using rmatrix_2d = container_2d<by_enum::Row>;
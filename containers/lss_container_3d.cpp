@@ -46,21 +46,13 @@ container_3d<by_enum::RowPlane>::container_3d() : container_3d_base()
 }
 
 container_3d<by_enum::RowPlane>::container_3d(std::size_t rows, std::size_t columns, std::size_t layers)
-    : container_3d_base(rows, columns, layers)
+    : container_3d_base(rows, columns, layers), data_(rows * columns * layers)
 {
-    for (std::size_t i = 0; i < rows_; ++i)
-    {
-        data_.emplace_back(container_2d<by_enum::Column>(columns_, layers_));
-    }
 }
 
 container_3d<by_enum::RowPlane>::container_3d(std::size_t rows, std::size_t columns, std::size_t layers, double value)
-    : container_3d_base(rows, columns, layers)
+    : container_3d_base(rows, columns, layers), data_(rows * columns * layers, value)
 {
-    for (std::size_t i = 0; i < rows_; ++i)
-    {
-        data_.emplace_back(container_2d<by_enum::Column>(columns_, layers_, value));
-    }
 }
 
 container_3d<by_enum::RowPlane>::~container_3d()
@@ -73,39 +65,36 @@ container_3d<by_enum::RowPlane>::container_3d(container_3d const &copy)
 }
 
 container_3d<by_enum::RowPlane>::container_3d(container_3d &&other) noexcept
-    : container_3d_base(std::move(other.rows_), std::move(other.columns_), std::move(other.layers_)), data_{std::move(
-                                                                                                          other.data_)}
+    : container_3d_base(std::move(other.rows_), std::move(other.columns_), std::move(other.layers_)),
+      data_{std::move(other.data_)}
 {
 }
 
 container_3d<by_enum::RowPlane>::container_3d(container_3d<by_enum::ColumnPlane> const &copy)
-    : container_3d_base(copy.rows(), copy.columns(), copy.layers())
+    : container_3d_base(copy.rows(), copy.columns(), copy.layers()), data_(copy.total_size())
 {
-
     for (std::size_t r = 0; r < rows_; ++r)
     {
-        data_.emplace_back(container_2d<by_enum::Column>(columns_, layers_));
         for (std::size_t c = 0; c < columns_; ++c)
         {
             for (std::size_t l = 0; l < layers_; ++l)
             {
-                data_[r](c, l, copy(r, c, l));
+                data_[index(r, c, l)] = copy(r, c, l);
             }
         }
     }
 }
 
 container_3d<by_enum::RowPlane>::container_3d(container_3d<by_enum::LayerPlane> const &copy)
-    : container_3d_base(copy.rows(), copy.columns(), copy.layers())
+    : container_3d_base(copy.rows(), copy.columns(), copy.layers()), data_(copy.total_size())
 {
     for (std::size_t r = 0; r < rows_; ++r)
     {
-        data_.emplace_back(container_2d<by_enum::Column>(columns_, layers_));
         for (std::size_t c = 0; c < columns_; ++c)
         {
             for (std::size_t l = 0; l < layers_; ++l)
             {
-                data_[r](c, l, copy(r, c, l));
+                data_[index(r, c, l)] = copy(r, c, l);
             }
         }
     }
@@ -138,19 +127,18 @@ container_3d<by_enum::RowPlane> &container_3d<by_enum::RowPlane>::operator=(cont
 container_3d<by_enum::RowPlane> &container_3d<by_enum::RowPlane>::operator=(
     container_3d<by_enum::ColumnPlane> const &copy)
 {
-    data_.clear();
     rows_ = copy.rows();
     columns_ = copy.columns();
     layers_ = copy.layers();
-
+    // reuses the storage when dimensions are unchanged:
+    data_.resize(rows_ * columns_ * layers_);
     for (std::size_t r = 0; r < rows_; ++r)
     {
-        data_.emplace_back(container_2d<by_enum::Column>(columns_, layers_));
         for (std::size_t c = 0; c < columns_; ++c)
         {
             for (std::size_t l = 0; l < layers_; ++l)
             {
-                data_[r](c, l, copy(r, c, l));
+                data_[index(r, c, l)] = copy(r, c, l);
             }
         }
     }
@@ -160,19 +148,18 @@ container_3d<by_enum::RowPlane> &container_3d<by_enum::RowPlane>::operator=(
 container_3d<by_enum::RowPlane> &container_3d<by_enum::RowPlane>::operator=(
     container_3d<by_enum::LayerPlane> const &copy)
 {
-    data_.clear();
     rows_ = copy.rows();
     columns_ = copy.columns();
     layers_ = copy.layers();
-
+    // reuses the storage when dimensions are unchanged:
+    data_.resize(rows_ * columns_ * layers_);
     for (std::size_t r = 0; r < rows_; ++r)
     {
-        data_.emplace_back(container_2d<by_enum::Column>(columns_, layers_));
         for (std::size_t c = 0; c < columns_; ++c)
         {
             for (std::size_t l = 0; l < layers_; ++l)
             {
-                data_[r](c, l, copy(r, c, l));
+                data_[index(r, c, l)] = copy(r, c, l);
             }
         }
     }
@@ -181,39 +168,17 @@ container_3d<by_enum::RowPlane> &container_3d<by_enum::RowPlane>::operator=(
 
 void container_3d<by_enum::RowPlane>::from_data(std::vector<double> const &data)
 {
-    auto const total_size = rows_ * columns_ * layers_;
-    std::size_t tid{};
-    LSS_ASSERT(total_size == data.size(), "Data are not of the correct size");
-    for (std::size_t l = 0; l < layers_; ++l)
-    {
-        for (std::size_t r = 0; r < rows_; ++r)
-        {
-            for (std::size_t c = 0; c < columns_; ++c)
-            {
-                tid = c + l * columns_ + r * layers_ * columns_;
-                data_[r](c, l, data[tid]);
-            }
-        }
-    }
-}
-
-double container_3d<by_enum::RowPlane>::operator()(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const
-{
-    LSS_ASSERT(row_idx < rows_, "Outside of row range");
-    LSS_ASSERT(col_idx < columns_, "Outside of column range");
-    LSS_ASSERT(lay_idx < layers_, "Outside of layer range");
-    return data_[row_idx](col_idx, lay_idx);
+    LSS_ASSERT(rows_ * columns_ * layers_ == data.size(), "Data are not of the correct size");
+    std::copy(data.begin(), data.end(), data_.begin());
 }
 
 container_2d<by_enum::Column> container_3d<by_enum::RowPlane>::operator()(std::size_t row_idx) const
 {
     LSS_ASSERT(row_idx < rows_, "Outside of row range");
-    return data_[row_idx];
-}
-
-double container_3d<by_enum::RowPlane>::at(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const
-{
-    return operator()(row_idx, col_idx, lay_idx);
+    container_2d<by_enum::Column> plane_cont(columns_, layers_);
+    auto const first = data_.begin() + row_idx * columns_ * layers_;
+    std::copy(first, first + columns_ * layers_, plane_cont.raw_data());
+    return plane_cont;
 }
 
 container_2d<by_enum::Column> container_3d<by_enum::RowPlane>::at(std::size_t row_idx) const
@@ -226,30 +191,18 @@ void container_3d<by_enum::RowPlane>::operator()(std::size_t row_idx, container_
     LSS_ASSERT(row_idx < rows_, "Outside of row range");
     LSS_ASSERT(cont.rows() == columns_, "Outside of layer range");
     LSS_ASSERT(cont.columns() == layers_, "Outside of column range");
-    data_[row_idx] = std::move(cont);
+    std::copy(cont.raw_data(), cont.raw_data() + columns_ * layers_, data_.begin() + row_idx * columns_ * layers_);
 }
 
-void container_3d<by_enum::RowPlane>::operator()(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx,
-                                                 double value)
+std::vector<double> const container_3d<by_enum::RowPlane>::data() const
 {
-    LSS_ASSERT(row_idx < rows_, "Outside of row range");
-    LSS_ASSERT(col_idx < columns_, "Outside of column range");
-    LSS_ASSERT(lay_idx < layers_, "Outside of layer range");
-    data_[row_idx](col_idx, lay_idx, value);
+    return std::vector<double>(data_.begin(), data_.end());
 }
 
-std::vector<double> const container_3d<by_enum::RowPlane>::data() const
+void container_3d<by_enum::RowPlane>::data(container_t &cont) const
 {
-    std::vector<double> d(rows_ * columns_ * layers_);
-    auto itr = d.begin();
-    for (std::size_t r = 0; r < rows_; ++r)
-    {
-        auto row_plane = at(r);
-        auto row = row_plane.data();
-        std::copy(row.begin(), row.end(), itr);
-        std::advance(itr, row.size());
-    }
-    return d;
+    LSS_ASSERT(cont.size() == data_.size(), "Data are not of the correct size");
+    std::copy(data_.begin(), data_.end(), cont.begin());
 }
 
 /// COLUMN-WISE
@@ -259,22 +212,14 @@ container_3d<by_enum::ColumnPlane>::container_3d() : container_3d_base()
 }
 
 container_3d<by_enum::ColumnPlane>::container_3d(std::size_t rows, std::size_t columns, std::size_t layers)
-    : container_3d_base(rows, columns, layers)
+    : container_3d_base(rows, columns, layers), data_(rows * columns * layers)
 {
-    for (std::size_t c = 0; c < columns_; ++c)
-    {
-        data_.emplace_back(container_2d<by_enum::Column>(rows_, layers_));
-    }
 }
 
 container_3d<by_enum::ColumnPlane>::container_3d(std::size_t rows, std::size_t columns, std::size_t layers,
                                                  double value)
-    : container_3d_base(rows, columns, layers)
+    : container_3d_base(rows, columns, layers), data_(rows * columns * layers, value)
 {
-    for (std::size_t c = 0; c < columns_; ++c)
-    {
-        data_.emplace_back(container_2d<by_enum::Column>(rows_, layers_, value));
-    }
 }
 
 container_3d<by_enum::ColumnPlane>::~container_3d()
@@ -287,39 +232,36 @@ container_3d<by_enum::ColumnPlane>::container_3d(container_3d const &copy)
 }
 
 container_3d<by_enum::ColumnPlane>::container_3d(container_3d &&other) noexcept
-    : container_3d_base(std::move(other.rows_), std::move(other.columns_), std::move(other.layers_)), data_{std::move(
-                                                                                                          other.data_)}
+    : container_3d_base(std::move(other.rows_), std::move(other.columns_), std::move(other.layers_)),
+      data_{std::move(other.data_)}
 {
 }
 
 container_3d<by_enum::ColumnPlane>::container_3d(container_3d<by_enum::RowPlane> const &copy)
-    : container_3d_base(copy.rows(), copy.columns(), copy.layers())
+    : container_3d_base(copy.rows(), copy.columns(), copy.layers()), data_(copy.total_size())
 {
-
-    for (std::size_t c = 0; c < columns_; ++c)
+    for (std::size_t r = 0; r < rows_; ++r)
     {
-        data_.emplace_back(container_2d<by_enum::Column>(rows_, layers_));
-        for (std::size_t r = 0; r < rows_; ++r)
+        for (std::size_t c = 0; c < columns_; ++c)
         {
             for (std::size_t l = 0; l < layers_; ++l)
             {
-                data_[c](r, l, copy(r, c, l));
+                data_[index(r, c, l)] = copy(r, c, l);
             }
         }
     }
 }
 
 container_3d<by_enum::ColumnPlane>::container_3d(container_3d<by_enum::LayerPlane> const &copy)
-    : container_3d_base(copy.rows(), copy.columns(), copy.layers())
+    : container_3d_base(copy.rows(), copy.columns(), copy.layers()), data_(copy.total_size())
 {
-    for (std::size_t c = 0; c < columns_; ++c)
+    for (std::size_t r = 0; r < rows_; ++r)
     {
-        data_.emplace_back(container_2d<by_enum::Column>(rows_, layers_));
-        for (std::size_t r = 0; r < rows_; ++r)
+        for (std::size_t c = 0; c < columns_; ++c)
         {
             for (std::size_t l = 0; l < layers_; ++l)
             {
-                data_[c](r, l, copy(r, c, l));
+                data_[index(r, c, l)] = copy(r, c, l);
             }
         }
     }
@@ -352,19 +294,18 @@ container_3d<by_enum::ColumnPlane> &container_3d<by_enum::ColumnPlane>::operator
 container_3d<by_enum::ColumnPlane> &container_3d<by_enum::ColumnPlane>::operator=(
     container_3d<by_enum::RowPlane> const &copy)
 {
-    data_.clear();
     rows_ = copy.rows();
     columns_ = copy.columns();
     layers_ = copy.layers();
-
-    for (std::size_t c = 0; c < columns_; ++c)
+    // reuses the storage when dimensions are unchanged:
+    data_.resize(rows_ * columns_ * layers_);
+    for (std::size_t r = 0; r < rows_; ++r)
     {
-        data_.emplace_back(container_2d<by_enum::Column>(rows_, layers_));
-        for (std::size_t r = 0; r < rows_; ++r)
+        for (std::size_t c = 0; c < columns_; ++c)
         {
             for (std::size_t l = 0; l < layers_; ++l)
             {
-                data_[c](r, l, copy(r, c, l));
+                data_[index(r, c, l)] = copy(r, c, l);
             }
         }
     }
@@ -374,19 +315,18 @@ container_3d<by_enum::ColumnPlane> &container_3d<by_enum::ColumnPlane>::operator
 container_3d<by_enum::ColumnPlane> &container_3d<by_enum::ColumnPlane>::operator=(
     container_3d<by_enum::LayerPlane> const &copy)
 {
-    data_.clear();
     rows_ = copy.rows();
     columns_ = copy.columns();
     layers_ = copy.layers();
-
-    for (std::size_t c = 0; c < columns_; ++c)
+    // reuses the storage when dimensions are unchanged:
+    data_.resize(rows_ * columns_ * layers_);
+    for (std::size_t r = 0; r < rows_; ++r)
     {
-        data_.emplace_back(container_2d<by_enum::Column>(rows_, layers_));
-        for (std::size_t r = 0; r < rows_; ++r)
+        for (std::size_t c = 0; c < columns_; ++c)
         {
             for (std::size_t l = 0; l < layers_; ++l)
             {
-                data_[c](r, l, copy(r, c, l));
+                data_[index(r, c, l)] = copy(r, c, l);
             }
         }
     }
@@ -395,40 +335,17 @@ container_3d<by_enum::ColumnPlane> &container_3d<by_enum::ColumnPlane>::operator
 
 void container_3d<by_enum::ColumnPlane>::from_data(std::vector<double> const &data)
 {
-    auto const total_size = rows_ * columns_ * layers_;
-    std::size_t tid{};
-    LSS_ASSERT(total_size == data.size(), "Data are not of the correct size");
-    for (std::size_t l = 0; l < layers_; ++l)
-    {
-        for (std::size_t c = 0; c < columns_; ++c)
-        {
-            for (std::size_t r = 0; r < rows_; ++r)
-            {
-                tid = r + l * rows_ + c * rows_ * layers_;
-                data_[c](r, l, data[tid]);
-            }
-        }
-    }
-}
-
-double container_3d<by_enum::ColumnPlane>::operator()(std::size_t row_idx, std::size_t col_idx,
-                                                      std::size_t lay_idx) const
-{
-    LSS_ASSERT(row_idx < rows_, "Outside of row range");
-    LSS_ASSERT(col_idx < columns_, "Outside of column range");
-    LSS_ASSERT(lay_idx < layers_, "Outside of layer range");
-    return data_[col_idx](row_idx, lay_idx);
+    LSS_ASSERT(rows_ * columns_ * layers_ == data.size(), "Data are not of the correct size");
+    std::copy(data.begin(), data.end(), data_.begin());
 }
 
 container_2d<by_enum::Column> container_3d<by_enum::ColumnPlane>::operator()(std::size_t col_idx) const
 {
     LSS_ASSERT(col_idx < columns_, "Outside of column range");
-    return data_[col_idx];
-}
-
-double container_3d<by_enum::ColumnPlane>::at(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const
-{
-    return operator()(row_idx, col_idx, lay_idx);
+    container_2d<by_enum::Column> plane_cont(rows_, layers_);
+    auto const first = data_.begin() + col_idx * rows_ * layers_;
+    std::copy(first, first + rows_ * layers_, plane_cont.raw_data());
+    return plane_cont;
 }
 
 container_2d<by_enum::Column> container_3d<by_enum::ColumnPlane>::at(std::size_t col_idx) const
@@ -441,32 +358,18 @@ void container_3d<by_enum::ColumnPlane>::operator()(std::size_t col_idx, contain
     LSS_ASSERT(col_idx < columns_, "Outside of column range");
     LSS_ASSERT(cont.rows() == rows_, "Outside of row range");
     LSS_ASSERT(cont.columns() == layers_, "Outside of layer range");
-    data_[col_idx] = std::move(cont);
+    std::copy(cont.raw_data(), cont.raw_data() + rows_ * layers_, data_.begin() + col_idx * rows_ * layers_);
 }
 
-void container_3d<by_enum::ColumnPlane>::operator()(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx,
-                                                    double value)
+std::vector<double> const container_3d<by_enum::ColumnPlane>::data() const
 {
-    LSS_ASSERT(row_idx < rows_, "Outside of row range");
-    LSS_ASSERT(col_idx < columns_, "Outside of column range");
-    LSS_ASSERT(lay_idx < layers_, "Outside of layer range");
-    data_[col_idx](row_idx, lay_idx, value);
+    return std::vector<double>(data_.begin(), data_.end());
 }
 
-std::vector<double> const container_3d<by_enum::ColumnPlane>::data() const
+void container_3d<by_enum::ColumnPlane>::data(container_t &cont) const
 {
-    std::vector<double> d(rows_ * columns_ * layers_);
-    auto itr = d.begin();
-
-    for (std::size_t c = 0; c < columns_; ++c)
-    {
-        auto col_plane = at(c);
-        auto col = col_plane.data();
-        std::copy(col.begin(), col.end(), itr);
-        std::advance(itr, col.size());
-    }
-
-    return d;
+    LSS_ASSERT(cont.size() == data_.size(), "Data are not of the correct size");
+    std::copy(data_.begin(), data_.end(), cont.begin());
 }
 
 /// LAYER-WISE
@@ -476,21 +379,13 @@ container_3d<by_enum::LayerPlane>::container_3d()
 }
 
 container_3d<by_enum::LayerPlane>::container_3d(std::size_t rows, std::size_t columns, std::size_t layers)
-    : container_3d_base(rows, columns, layers)
+    : container_3d_base(rows, columns, layers), data_(rows * columns * layers)
 {
-    for (std::size_t l = 0; l < layers_; ++l)
-    {
-        data_.emplace_back(container_2d<by_enum::Row>(rows_, columns_));
-    }
 }
 
 container_3d<by_enum::LayerPlane>::container_3d(std::size_t rows, std::size_t columns, std::size_t layers, double value)
-    : container_3d_base(rows, columns, layers)
+    : container_3d_base(rows, columns, layers), data_(rows * columns * layers, value)
 {
-    for (std::size_t l = 0; l < layers_; ++l)
-    {
-        data_.emplace_back(container_2d<by_enum::Row>(rows_, columns_, value));
-    }
 }
 
 container_3d<by_enum::LayerPlane>::~container_3d()
@@ -503,38 +398,36 @@ container_3d<by_enum::LayerPlane>::container_3d(container_3d const &copy)
 }
 
 container_3d<by_enum::LayerPlane>::container_3d(container_3d &&other) noexcept
-    : container_3d_base(std::move(other.rows_), std::move(other.columns_), std::move(other.layers_)), data_{std::move(
-                                                                                                          other.data_)}
+    : container_3d_base(std::move(other.rows_), std::move(other.columns_), std::move(other.layers_)),
+      data_{std::move(other.data_)}
 {
 }
 
 container_3d<by_enum::LayerPlane>::container_3d(container_3d<by_enum::RowPlane> const &copy)
-    : container_3d_base(copy.rows(), copy.columns(), copy.layers())
+    : container_3d_base(copy.rows(), copy.columns(), copy.layers()), data_(copy.total_size())
 {
-    for (std::size_t l = 0; l < layers_; ++l)
+    for (std::size_t r = 0; r < rows_; ++r)
     {
-        data_.emplace_back(container_2d<by_enum::Row>(rows_, columns_));
-        for (std::size_t r = 0; r < rows_; ++r)
+        for (std::size_t c = 0; c < columns_; ++c)
         {
-            for (std::size_t c = 0; c < columns_; ++c)
+            for (std::size_t l = 0; l < layers_; ++l)
             {
-                data_[l](r, c, copy(r, c, l));
+                data_[index(r, c, l)] = copy(r, c, l);
             }
         }
     }
 }
 
 container_3d<by_enum::LayerPlane>::container_3d(container_3d<by_enum::ColumnPlane> const &copy)
-    : container_3d_base(copy.rows(), copy.columns(), copy.layers())
+    : container_3d_base(copy.rows(), copy.columns(), copy.layers()), data_(copy.total_size())
 {
-    for (std::size_t l = 0; l < layers_; ++l)
+    for (std::size_t r = 0; r < rows_; ++r)
     {
-        data_.emplace_back(container_2d<by_enum::Row>(rows_, columns_));
-        for (std::size_t r = 0; r < rows_; ++r)
+        for (std::size_t c = 0; c < columns_; ++c)
         {
-            for (std::size_t c = 0; c < columns_; ++c)
+            for (std::size_t l = 0; l < layers_; ++l)
             {
-                data_[l](r, c, copy(r, c, l));
+                data_[index(r, c, l)] = copy(r, c, l);
             }
         }
     }
@@ -567,19 +460,18 @@ container_3d<by_enum::LayerPlane> &container_3d<by_enum::LayerPlane>::operator=(
 container_3d<by_enum::LayerPlane> &container_3d<by_enum::LayerPlane>::operator=(
     container_3d<by_enum::RowPlane> const &copy)
 {
-    data_.clear();
     rows_ = copy.rows();
     columns_ = copy.columns();
     layers_ = copy.layers();
-
-    for (std::size_t l = 0; l < layers_; ++l)
+    // reuses the storage when dimensions are unchanged:
+    data_.resize(rows_ * columns_ * layers_);
+    for (std::size_t r = 0; r < rows_; ++r)
     {
-        data_.emplace_back(container_2d<by_enum::Row>(rows_, columns_));
-        for (std::size_t r = 0; r < rows_; ++r)
+        for (std::size_t c = 0; c < columns_; ++c)
         {
-            for (std::size_t c = 0; c < columns_; ++c)
+            for (std::size_t l = 0; l < layers_; ++l)
             {
-                data_[l](r, c, copy(r, c, l));
+                data_[index(r, c, l)] = copy(r, c, l);
             }
         }
     }
@@ -589,19 +481,18 @@ container_3d<by_enum::LayerPlane> &container_3d<by_enum::LayerPlane>::operator=(
 container_3d<by_enum::LayerPlane> &container_3d<by_enum::LayerPlane>::operator=(
     container_3d<by_enum::ColumnPlane> const &copy)
 {
-    data_.clear();
     rows_ = copy.rows();
     columns_ = copy.columns();
     layers_ = copy.layers();
-
-    for (std::size_t l = 0; l < layers_; ++l)
+    // reuses the storage when dimensions are unchanged:
+    data_.resize(rows_ * columns_ * layers_);
+    for (std::size_t r = 0; r < rows_; ++r)
     {
-        data_.emplace_back(container_2d<by_enum::Row>(rows_, columns_));
-        for (std::size_t r = 0; r < rows_; ++r)
+        for (std::size_t c = 0; c < columns_; ++c)
         {
-            for (std::size_t c = 0; c < columns_; ++c)
+            for (std::size_t l = 0; l < layers_; ++l)
             {
-                data_[l](r, c, copy(r, c, l));
+                data_[index(r, c, l)] = copy(r, c, l);
             }
         }
     }
@@ -610,40 +501,17 @@ container_3d<by_enum::LayerPlane> &container_3d<by_enum::LayerPlane>::operator=(
 
 void container_3d<by_enum::LayerPlane>::from_data(std::vector<double> const &data)
 {
-    auto const total_size = rows_ * columns_ * layers_;
-    std::size_t tid{};
-    LSS_ASSERT(total_size == data.size(), "Data are not of the correct size");
-    for (std::size_t l = 0; l < layers_; ++l)
-    {
-        for (std::size_t c = 0; c < columns_; ++c)
-        {
-            for (std::size_t r = 0; r < rows_; ++r)
-            {
-                tid = c + r * columns_ + l * rows_ * columns_;
-                data_[l](r, c, data[tid]);
-            }
-        }
-    }
-}
-
-double container_3d<by_enum::LayerPlane>::operator()(std::size_t row_idx, std::size_t col_idx,
-                                                     std::size_t lay_idx) const
-{
-    LSS_ASSERT(row_idx < rows_, "Outside of row range");
-    LSS_ASSERT(col_idx < columns_, "Outside of column range");
-    LSS_ASSERT(lay_idx < layers_, "Outside of layer range");
-    return data_[lay_idx](row_idx, col_idx);
+    LSS_ASSERT(rows_ * columns_ * layers_ == data.size(), "Data are not of the correct size");
+    std::copy(data.begin(), data.end(), data_.begin());
 }
 
 container_2d<by_enum::Row> container_3d<by_enum::LayerPlane>::operator()(std::size_t lay_idx) const
 {
     LSS_ASSERT(lay_idx < layers_, "Outside of layer range");
-    return data_[lay_idx];
-}
-
-double container_3d<by_enum::LayerPlane>::at(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const
-{
-    return operator()(row_idx, col_idx, lay_idx);
+    container_2d<by_enum::Row> plane_cont(rows_, columns_);
+    auto const first = data_.begin() + lay_idx * rows_ * columns_;
+    std::copy(first, first + rows_ * columns_, plane_cont.raw_data());
+    return plane_cont;
 }
 
 container_2d<by_enum::Row> container_3d<by_enum::LayerPlane>::at(std::size_t lay_idx) const
@@ -656,32 +524,18 @@ void container_3d<by_enum::LayerPlane>::operator()(std::size_t lay_idx, containe
     LSS_ASSERT(lay_idx < layers_, "Outside of layer range");
     LSS_ASSERT(cont.rows() == rows_, "Outside of row range");
     LSS_ASSERT(cont.columns() == columns_, "Outside of column range");
-    data_[lay_idx] = std::move(cont);
+    std::copy(cont.raw_data(), cont.raw_data() + rows_ * columns_, data_.begin() + lay_idx * rows_ * columns_);
 }
 
-void container_3d<by_enum::LayerPlane>::operator()(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx,
-                                                   double value)
+std::vector<double> const container_3d<by_enum::LayerPlane>::data() const
 {
-    LSS_ASSERT(row_idx < rows_, "Outside of row range");
-    LSS_ASSERT(col_idx < columns_, "Outside of column range");
-    LSS_ASSERT(lay_idx < layers_, "Outside of layer range");
-    data_[lay_idx](row_idx, col_idx, value);
+    return std::vector<double>(data_.begin(), data_.end());
 }
 
-std::vector<double> const container_3d<by_enum::LayerPlane>::data() const
+void container_3d<by_enum::LayerPlane>::data(container_t &cont) const
 {
-    std::vector<double> d(rows_ * columns_ * layers_);
-    auto itr = d.begin();
-
-    for (std::size_t l = 0; l < layers_; ++l)
-    {
-        auto lay_plane = at(l);
-        auto lay = lay_plane.data();
-        std::copy(lay.begin(), lay.end(), itr);
-        std::advance(itr, lay.size());
-    }
-
-    return d;
+    LSS_ASSERT(cont.size() == data_.size(), "Data are not of the correct size");
+    std::copy(data_.begin(), data_.end(), cont.begin());
 }
 
 } // namespace lss_containers
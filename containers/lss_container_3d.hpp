@@ -17,7 +17,9 @@
 #include "../common/lss_enumerations.hpp"
 #include "../common/lss_macros.hpp"
 #include "../common/lss_utility.hpp"
+#include "lss_aligned_allocator.hpp"
 #include "lss_container_2d.hpp"
+#include "lss_strided_span.hpp"
 #include <typeinfo>
 #include <vector>
 
@@ -64,7 +66,13 @@ template <by_enum by> class container_3d
 template <> class container_3d<by_enum::RowPlane> : public container_3d_base
 {
   private:
-    std::vector<container_2d<by_enum::Column>> data_;
+    // row-plane-wise in single allocation:
+    aligned_container_t data_;
+
+    inline std::size_t index(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const
+    {
+        return (row_idx * columns_ * layers_ + lay_idx * columns_ + col_idx);
+    }
 
     explicit container_3d();
 
@@ -93,7 +101,13 @@ template <> class container_3d<by_enum::RowPlane> : public container_3d_base
         @param  lay_idx
         @retval value from container_3d at potision (row_idx,col_idx,lay_idx)
     **/
-    LSS_API double operator()(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const;
+    inline double operator()(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const
+    {
+        LSS_ASSERT(row_idx < rows_, "Outside of row range");
+        LSS_ASSERT(col_idx < columns_, "Outside of column range");
+        LSS_ASSERT(lay_idx < layers_, "Outside of layer range");
+        return data_[index(row_idx, col_idx, lay_idx)];
+    }
 
     /**
         @brief
@@ -109,7 +123,10 @@ template <> class container_3d<by_enum::RowPlane> : public container_3d_base
         @param  lay_idx
         @retval value from container_3d at potision (row_idx,col_idx,lay_idx)
     **/
-    LSS_API double at(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const;
+    inline double at(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const
+    {
+        return operator()(row_idx, col_idx, lay_idx);
+    }
 
     /**
         @brief
@@ -132,13 +149,104 @@ template <> class container_3d<by_enum::RowPlane> : public container_3d_base
         @param lay_idx
         @param value
     **/
-    LSS_API void operator()(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx, double value);
+    inline void operator()(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx, double value)
+    {
+        LSS_ASSERT(row_idx < rows_, "Outside of row range");
+        LSS_ASSERT(col_idx < columns_, "Outside of column range");
+        LSS_ASSERT(lay_idx < layers_, "Outside of layer range");
+        data_[index(row_idx, col_idx, lay_idx)] = value;
+    }
 
     /**
         @brief
         @retval data as flat vector row-wise
     **/
     LSS_API container_t const data() const override;
+
+    /**
+        @brief  copy data as flat vector into cont of total_size() elements
+        @param  cont
+    **/
+    LSS_API void data(container_t &cont) const;
+
+    /**
+        @brief
+        @param  row_idx
+        @retval non-owning contiguous view of row plane (row_idx) stored column-wise
+    **/
+    inline strided_span<double> plane(std::size_t row_idx)
+    {
+        LSS_ASSERT(row_idx < rows_, "Outside of row range");
+        return strided_span<double>(data_.data() + row_idx * columns_ * layers_, columns_ * layers_);
+    }
+
+    inline strided_span<const double> plane(std::size_t row_idx) const
+    {
+        LSS_ASSERT(row_idx < rows_, "Outside of row range");
+        return strided_span<const double>(data_.data() + row_idx * columns_ * layers_, columns_ * layers_);
+    }
+
+    /**
+        @brief
+        @param  col_idx
+        @param  lay_idx
+        @retval non-owning view of values along rows at position (col_idx,lay_idx)
+    **/
+    inline strided_span<double> row_line(std::size_t col_idx, std::size_t lay_idx)
+    {
+        return strided_span<double>(data_.data() + index(0, col_idx, lay_idx), rows_, columns_ * layers_);
+    }
+
+    inline strided_span<const double> row_line(std::size_t col_idx, std::size_t lay_idx) const
+    {
+        return strided_span<const double>(data_.data() + index(0, col_idx, lay_idx), rows_, columns_ * layers_);
+    }
+
+    /**
+        @brief
+        @param  row_idx
+        @param  lay_idx
+        @retval non-owning view of values along columns at position (row_idx,lay_idx)
+    **/
+    inline strided_span<double> column_line(std::size_t row_idx, std::size_t lay_idx)
+    {
+        return strided_span<double>(data_.data() + index(row_idx, 0, lay_idx), columns_, 1);
+    }
+
+    inline strided_span<const double> column_line(std::size_t row_idx, std::size_t lay_idx) const
+    {
+        return strided_span<const double>(data_.data() + index(row_idx, 0, lay_idx), columns_, 1);
+    }
+
+    /**
+        @brief
+        @param  row_idx
+        @param  col_idx
+        @retval non-owning view of values along layers at position (row_idx,col_idx)
+    **/
+    inline strided_span<double> layer_line(std::size_t row_idx, std::size_t col_idx)
+    {
+        return strided_span<double>(data_.data() + index(row_idx, col_idx, 0), layers_, columns_);
+    }
+
+    inline strided_span<const double> layer_line(std::size_t row_idx, std::size_t col_idx) const
+    {
+        return strided_span<const double>(data_.data() + index(row_idx, col_idx, 0), layers_, columns_);
+    }
+
+    /**
+        @brief
+        @retval pointer to contiguous storage of total_size() elements
+    **/
+    inline double *raw_data()
+    {
+        return data_.data();
+    }
+
+    inline double const *raw_data() const
+    {
+        return data_.data();
+    }
 };
 
 /**
@@ -151,7 +259,13 @@ template <> class container_3d<by_enum::RowPlane> : public container_3d_base
 template <> class container_3d<by_enum::ColumnPlane> : public container_3d_base
 {
   private:
-    std::vector<container_2d<by_enum::Column>> data_;
+    // column-plane-wise in single allocation:
+    aligned_container_t data_;
+
+    inline std::size_t index(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const
+    {
+        return (col_idx * rows_ * layers_ + lay_idx * rows_ + row_idx);
+    }
 
     explicit container_3d();
 
@@ -180,7 +294,13 @@ template <> class container_3d<by_enum::ColumnPlane> : public container_3d_base
         @param  lay_idx
         @retval value from container_3d at potision (row_idx,col_idx,lay_idx)
     **/
-    LSS_API double operator()(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const;
+    inline double operator()(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const
+    {
+        LSS_ASSERT(row_idx < rows_, "Outside of row range");
+        LSS_ASSERT(col_idx < columns_, "Outside of column range");
+        LSS_ASSERT(lay_idx < layers_, "Outside of layer range");
+        return data_[index(row_idx, col_idx, lay_idx)];
+    }
 
     /**
         @brief
@@ -196,7 +316,10 @@ template <> class container_3d<by_enum::ColumnPlane> : public container_3d_base
         @param  lay_idx
         @retval value from container_3d at potision (row_idx,col_idx,lay_idx)
     **/
-    LSS_API double at(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const;
+    inline double at(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const
+    {
+        return operator()(row_idx, col_idx, lay_idx);
+    }
 
     /**
         @brief
@@ -219,13 +342,104 @@ template <> class container_3d<by_enum::ColumnPlane> : public container_3d_base
         @param lay_idx
         @param value
     **/
-    LSS_API void operator()(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx, double value);
+    inline void operator()(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx, double value)
+    {
+        LSS_ASSERT(row_idx < rows_, "Outside of row range");
+        LSS_ASSERT(col_idx < columns_, "Outside of column range");
+        LSS_ASSERT(lay_idx < layers_, "Outside of layer range");
+        data_[index(row_idx, col_idx, lay_idx)] = value;
+    }
 
     /**
         @brief
         @retval data as flat vector row-wise
     **/
     LSS_API container_t const data() const override;
+
+    /**
+        @brief  copy data as flat vector into cont of total_size() elements
+        @param  cont
+    **/
+    LSS_API void data(container_t &cont) const;
+
+    /**
+        @brief
+        @param  col_idx
+        @retval non-owning contiguous view of column plane (col_idx) stored column-wise
+    **/
+    inline strided_span<double> plane(std::size_t col_idx)
+    {
+        LSS_ASSERT(col_idx < columns_, "Outside of column range");
+        return strided_span<double>(data_.data() + col_idx * rows_ * layers_, rows_ * layers_);
+    }
+
+    inline strided_span<const double> plane(std::size_t col_idx) const
+    {
+        LSS_ASSERT(col_idx < columns_, "Outside of column range");
+        return strided_span<const double>(data_.data() + col_idx * rows_ * layers_, rows_ * layers_);
+    }
+
+    /**
+        @brief
+        @param  col_idx
+        @param  lay_idx
+        @retval non-owning view of values along rows at position (col_idx,lay_idx)
+    **/
+    inline strided_span<double> row_line(std::size_t col_idx, std::size_t lay_idx)
+    {
+        return strided_span<double>(data_.data() + index(0, col_idx, lay_idx), rows_, 1);
+    }
+
+    inline strided_span<const double> row_line(std::size_t col_idx, std::size_t lay_idx) const
+    {
+        return strided_span<const double>(data_.data() + index(0, col_idx, lay_idx), rows_, 1);
+    }
+
+    /**
+        @brief
+        @param  row_idx
+        @param  lay_idx
+        @retval non-owning view of values along columns at position (row_idx,lay_idx)
+    **/
+    inline strided_span<double> column_line(std::size_t row_idx, std::size_t lay_idx)
+    {
+        return strided_span<double>(data_.data() + index(row_idx, 0, lay_idx), columns_, rows_ * layers_);
+    }
+
+    inline strided_span<const double> column_line(std::size_t row_idx, std::size_t lay_idx) const
+    {
+        return strided_span<const double>(data_.data() + index(row_idx, 0, lay_idx), columns_, rows_ * layers_);
+    }
+
+    /**
+        @brief
+        @param  row_idx
+        @param  col_idx
+        @retval non-owning view of values along layers at position (row_idx,col_idx)
+    **/
+    inline strided_span<double> layer_line(std::size_t row_idx, std::size_t col_idx)
+    {
+        return strided_span<double>(data_.data() + index(row_idx, col_idx, 0), layers_, rows_);
+    }
+
+    inline strided_span<const double> layer_line(std::size_t row_idx, std::size_t col_idx) const
+    {
+        return strided_span<const double>(data_.data() + index(row_idx, col_idx, 0), layers_, rows_);
+    }
+
+    /**
+        @brief
+        @retval pointer to contiguous storage of total_size() elements
+    **/
+    inline double *raw_data()
+    {
+        return data_.data();
+    }
+
+    inline double const *raw_data() const
+    {
+        return data_.data();
+    }
 };
 
 /**
@@ -238,7 +452,13 @@ template <> class container_3d<by_enum::ColumnPlane> : public container_3d_base
 template <> class container_3d<by_enum::LayerPlane> : public container_3d_base
 {
   private:
-    std::vector<container_2d<by_enum::Row>> data_;
+    // layer-plane-wise in single allocation:
+    aligned_container_t data_;
+
+    inline std::size_t index(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const
+    {
+        return (lay_idx * rows_ * columns_ + row_idx * columns_ + col_idx);
+    }
 
     explicit container_3d();
 
@@ -267,7 +487,13 @@ template <> class container_3d<by_enum::LayerPlane> : public container_3d_base
         @param  lay_idx
         @retval value from container_3d at potision (row_idx,col_idx,lay_idx)
     **/
-    LSS_API double operator()(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const;
+    inline double operator()(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const
+    {
+        LSS_ASSERT(row_idx < rows_, "Outside of row range");
+        LSS_ASSERT(col_idx < columns_, "Outside of column range");
+        LSS_ASSERT(lay_idx < layers_, "Outside of layer range");
+        return data_[index(row_idx, col_idx, lay_idx)];
+    }
 
     /**
         @brief
@@ -283,7 +509,10 @@ template <> class container_3d<by_enum::LayerPlane> : public container_3d_base
         @param  lay_idx
         @retval value from container_3d at potision (row_idx,col_idx,lay_idx)
     **/
-    LSS_API double at(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const;
+    inline double at(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx) const
+    {
+        return operator()(row_idx, col_idx, lay_idx);
+    }
 
     /**
         @brief
@@ -306,13 +535,104 @@ template <> class container_3d<by_enum::LayerPlane> : public container_3d_base
         @param lay_idx
         @param value
     **/
-    LSS_API void operator()(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx, double value);
+    inline void operator()(std::size_t row_idx, std::size_t col_idx, std::size_t lay_idx, double value)
+    {
+        LSS_ASSERT(row_idx < rows_, "Outside of row range");
+        LSS_ASSERT(col_idx < columns_, "Outside of column range");
+        LSS_ASSERT(lay_idx < layers_, "Outside of layer range");
+        data_[index(row_idx, col_idx, lay_idx)] = value;
+    }
 
     /**
         @brief
         @retval data as flat vector row-wise
     **/
     LSS_API container_t const data() const override;
+
+    /**
+        @brief  copy data as flat vector into cont of total_size() elements
+        @param  cont
+    **/
+    LSS_API void data(container_t &cont) const;
+
+    /**
+        @brief
+        @param  lay_idx
+        @retval non-owning contiguous view of layer plane (lay_idx) stored row-wise
+    **/
+    inline strided_span<double> plane(std::size_t lay_idx)
+    {
+        LSS_ASSERT(lay_idx < layers_, "Outside of layer range");
+        return strided_span<double>(data_.data() + lay_idx * rows_ * columns_, rows_ * columns_);
+    }
+
+    inline strided_span<const double> plane(std::size_t lay_idx) const
+    {
+        LSS_ASSERT(lay_idx < layers_, "Outside of layer range");
+        return strided_span<const double>(data_.data() + lay_idx * rows_ * columns_, rows_ * columns_);
+    }
+
+    /**
+        @brief
+        @param  col_idx
+        @param  lay_idx
+        @retval non-owning view of values along rows at position (col_idx,lay_idx)
+    **/
+    inline strided_span<double> row_line(std::size_t col_idx, std::size_t lay_idx)
+    {
+        return strided_span<double>(data_.data() + index(0, col_idx, lay_idx), rows_, columns_);
+    }
+
+    inline strided_span<const double> row_line(std::size_t col_idx, std::size_t lay_idx) const
+    {
+        return strided_span<const double>(data_.data() + index(0, col_idx, lay_idx), rows_, columns_);
+    }
+
+    /**
+        @brief
+        @param  row_idx
+        @param  lay_idx
+        @retval non-owning view of values along columns at position (row_idx,lay_idx)
+    **/
+    inline strided_span<double> column_line(std::size_t row_idx, std::size_t lay_idx)
+    {
+        return strided_span<double>(data_.data() + index(row_idx, 0, lay_idx), columns_, 1);
+    }
+
+    inline strided_span<const double> column_line(std::size_t row_idx, std::size_t lay_idx) const
+    {
+        return strided_span<const double>(data_.data() + index(row_idx, 0, lay_idx), columns_, 1);
+    }
+
+    /**
+        @brief
+        @param  row_idx
+        @param  col_idx
+        @retval non-owning view of values along layers at position (row_idx,col_idx)
+    **/
+    inline strided_span<double> layer_line(std::size_t row_idx, std::size_t col_idx)
+    {
+        return strided_span<double>(data_.data() + index(row_idx, col_idx, 0), layers_, rows_ * columns_);
+    }
+
+    inline strided_span<const double> layer_line(std::size_t row_idx, std::size_t col_idx) const
+    {
+        return strided_span<const double>(data_.data() + index(row_idx, col_idx, 0), layers_, rows_ * columns_);
+    }
+
+    /**
+        @brief
+        @retval pointer to contiguous storage of total_size() elements
+    **/
+    inline double *raw_data()
+    {
+        return data_.data();
+    }
+
+    inline double const *raw_data() const
+    {
+        return data_.data();
+    }
 };
 
 using rmatrix_3d = container_3d<by_enum::RowPlane>;
@@ -0,0 +1,106 @@
+/**
+
+    @file      lss_strided_span.hpp
+    @brief     Non-owning strided view into contiguous storage
+    @details   ~
+    @author    Michal Sara
+    @date      18.10.2026
+    @copyright  Michal Sara, 2021. All right reserved.
+
+**/
+#pragma once
+#if !defined(_LSS_STRIDED_SPAN_HPP_)
+#define _LSS_STRIDED_SPAN_HPP_
+
+#include <cstddef>
+#include <type_traits>
+
+#include "../common/lss_macros.hpp"
+
+namespace lss_containers
+{
+
+/**
+
+    @class   strided_span
+    @brief   Non-owning view of size elements placed stride apart
+    @details The view is only valid while the owning container is alive and
+             is not resized. Use strided_span<const double> for read-only
+             access.
+
+**/
+template <typename T> class strided_span
+{
+  private:
+    T *data_;
+    std::size_t size_;
+    std::size_t stride_;
+
+  public:
+    explicit strided_span(T *data, std::size_t size, std::size_t stride = 1)
+        : data_{data}, size_{size}, stride_{stride}
+    {
+    }
+
+    // allows passing mutable view where read-only one is expected:
+    template <typename U, typename = std::enable_if_t<std::is_same<T, const U>::value>>
+    strided_span(strided_span<U> const &other) : data_{other.data()}, size_{other.size()}, stride_{other.stride()}
+    {
+    }
+
+    inline std::size_t size() const
+    {
+        return size_;
+    }
+
+    inline std::size_t stride() const
+    {
+        return stride_;
+    }
+
+    inline bool is_contiguous() const
+    {
+        return (stride_ == 1);
+    }
+
+    inline T *data() const
+    {
+        return data_;
+    }
+
+    inline T &operator[](std::size_t idx) const
+    {
+        return data_[idx * stride_];
+    }
+
+    /**
+        @brief copy the viewed elements into container of the same size
+        @param cont
+    **/
+    template <typename Container> void copy_to(Container &cont) const
+    {
+        LSS_ASSERT(cont.size() == size_, "Container must have the size of the view");
+        for (std::size_t t = 0; t < size_; ++t)
+        {
+            cont[t] = data_[t * stride_];
+        }
+    }
+
+    /**
+        @brief copy elements of container of the same size into the view
+        @param cont
+    **/
+    template <typename Container> void copy_from(Container const &cont) const
+    {
+        static_assert(!std::is_const<T>::value, "Cannot write through read-only view");
+        LSS_ASSERT(cont.size() == size_, "Container must have the size of the view");
+        for (std::size_t t = 0; t < size_; ++t)
+        {
+            data_[t * stride_] = cont[t];
+        }
+    }
+};
+
+} // namespace lss_containers
+
+#endif ///_LSS_STRIDED_SPAN_HPP_
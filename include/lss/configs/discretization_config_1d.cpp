@@ -33,8 +33,16 @@ discretization_config_1d_builder &discretization_config_1d_builder::number_of_ti
     return *this;
 }
 
+discretization_config_1d_builder &discretization_config_1d_builder::time_grid(time_grid_config_ptr const &time_grid)
+{
+    time_grid_ = time_grid;
+    return *this;
+}
+
 discretization_config_1d_ptr discretization_config_1d_builder::build()
 {
+    if (time_grid_ != nullptr)
+        return std::make_shared<discretization_config_1d>(space_range_, number_of_space_points_, time_grid_);
     return std::make_shared<discretization_config_1d>(space_range_, number_of_space_points_, time_range_,
                                                       number_of_time_points_);
 }
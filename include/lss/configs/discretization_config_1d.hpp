@@ -11,6 +11,8 @@ namespace lss
 {
 using discretization_config_1d = lss_pde_solvers::pde_discretization_config_1d;
 using discretization_config_1d_ptr = lss_pde_solvers::pde_discretization_config_1d_ptr;
+using time_grid_config = lss_pde_solvers::time_grid_config;
+using time_grid_config_ptr = lss_pde_solvers::time_grid_config_ptr;
 
 struct discretization_config_1d_builder
 {
@@ -19,6 +21,7 @@ struct discretization_config_1d_builder
     std::size_t number_of_space_points_;
     lss_utility::range_ptr time_range_;
     std::size_t number_of_time_points_;
+    time_grid_config_ptr time_grid_;
 
   public:
     LSS_API explicit discretization_config_1d_builder();
@@ -31,6 +34,11 @@ struct discretization_config_1d_builder
 
     LSS_API discretization_config_1d_builder &number_of_time_points(std::size_t const &number_of_time_points);
 
+    /**
+        @brief  Non-uniform time grid, replaces time_range and number_of_time_points
+    **/
+    LSS_API discretization_config_1d_builder &time_grid(time_grid_config_ptr const &time_grid);
+
     LSS_API discretization_config_1d_ptr build();
 };
 
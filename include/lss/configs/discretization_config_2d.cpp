@@ -46,8 +46,17 @@ discretization_config_2d_builder &discretization_config_2d_builder::number_of_ti
     return *this;
 }
 
+discretization_config_2d_builder &discretization_config_2d_builder::time_grid(time_grid_config_ptr const &time_grid)
+{
+    time_grid_ = time_grid;
+    return *this;
+}
+
 discretization_config_2d_ptr discretization_config_2d_builder::build()
 {
+    if (time_grid_ != nullptr)
+        return std::make_shared<discretization_config_2d>(space_range_1_, space_range_2_, number_of_space_points_1_,
+                                                          number_of_space_points_2_, time_grid_);
     return std::make_shared<discretization_config_2d>(space_range_1_, space_range_2_, number_of_space_points_1_,
                                                       number_of_space_points_2_, time_range_, number_of_time_points_);
 }
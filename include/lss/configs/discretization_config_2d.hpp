@@ -11,6 +11,8 @@ namespace lss
 {
 using discretization_config_2d = lss_pde_solvers::pde_discretization_config_2d;
 using discretization_config_2d_ptr = lss_pde_solvers::pde_discretization_config_2d_ptr;
+using time_grid_config = lss_pde_solvers::time_grid_config;
+using time_grid_config_ptr = lss_pde_solvers::time_grid_config_ptr;
 
 struct discretization_config_2d_builder
 {
@@ -21,6 +23,7 @@ struct discretization_config_2d_builder
     std::size_t number_of_space_points_2_;
     lss_utility::range_ptr time_range_;
     std::size_t number_of_time_points_;
+    time_grid_config_ptr time_grid_;
 
   public:
     LSS_API explicit discretization_config_2d_builder();
@@ -37,6 +40,11 @@ struct discretization_config_2d_builder
 
     LSS_API discretization_config_2d_builder &number_of_time_points(std::size_t const &number_of_time_points);
 
+    /**
+        @brief  Non-uniform time grid, replaces time_range and number_of_time_points
+    **/
+    LSS_API discretization_config_2d_builder &time_grid(time_grid_config_ptr const &time_grid);
+
     LSS_API discretization_config_2d_ptr build();
 };
 
@@ -47,10 +47,18 @@ implicit_heat_solver_1d_builder &implicit_heat_solver_1d_builder::solver_config_
     return *this;
 }
 
+implicit_heat_solver_1d_builder &implicit_heat_solver_1d_builder::execution_policy(
+    const execution_policy_ptr &execution_policy)
+{
+    execution_policy_ = execution_policy;
+    return *this;
+}
+
 implicit_heat_solver_1d_ptr implicit_heat_solver_1d_builder::build()
 {
     return std::make_shared<implicit_heat_solver_1d>(heat_data_config_, discretization_config_, boundary_pair_,
-                                                     grid_cfg_, solver_config_, solver_config_details_);
+                                                     grid_cfg_, solver_config_, solver_config_details_,
+                                                     execution_policy_);
 }
 
 } // namespace lss
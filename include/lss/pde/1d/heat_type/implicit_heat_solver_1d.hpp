@@ -10,6 +10,7 @@
 #include "../../../../../pde_solvers/1d/heat_type/lss_heat_equation.hpp"
 #include "../../../configs/discretization_config_1d.hpp"
 #include "../../../configs/grid_config_1d.hpp"
+#include "../../../utilities/execution_policy.hpp"
 #include "../../configs/heat_data_config_1d.hpp"
 #include "../../configs/heat_implicit_solver_config.hpp"
 
@@ -31,6 +32,7 @@ class implicit_heat_solver_1d_builder
     grid_config_1d_ptr grid_cfg_;
     heat_implicit_solver_config_ptr solver_config_;
     std::map<std::string, double> solver_config_details_;
+    execution_policy_ptr execution_policy_;
 
   public:
     LSS_API explicit implicit_heat_solver_1d_builder();
@@ -49,6 +51,8 @@ class implicit_heat_solver_1d_builder
     LSS_API implicit_heat_solver_1d_builder &solver_config_details(
         const std::map<std::string, double> &solver_config_details);
 
+    LSS_API implicit_heat_solver_1d_builder &execution_policy(const execution_policy_ptr &execution_policy);
+
     LSS_API implicit_heat_solver_1d_ptr build();
 };
 
@@ -48,11 +48,18 @@ explicit_heston_solver_2d_builder &explicit_heston_solver_2d_builder::solver_con
     return *this;
 }
 
+explicit_heston_solver_2d_builder &explicit_heston_solver_2d_builder::execution_policy(
+    const execution_policy_ptr &execution_policy)
+{
+    execution_policy_ = execution_policy;
+    return *this;
+}
+
 explicit_heston_solver_2d_ptr explicit_heston_solver_2d_builder::build()
 {
     return std::make_shared<explicit_heston_solver_2d>(heat_data_config_, discretization_config_,
                                                        vertical_upper_boundary_, horizontal_boundary_pair_, grid_cfg_,
-                                                       solver_config_);
+                                                       solver_config_, execution_policy_);
 }
 
 } // namespace lss
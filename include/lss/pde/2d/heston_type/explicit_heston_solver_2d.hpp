@@ -9,6 +9,7 @@
 #include "../../../../../pde_solvers/2d/heat_type/lss_heston_equation.hpp"
 #include "../../../configs/discretization_config_2d.hpp"
 #include "../../../configs/grid_config_2d.hpp"
+#include "../../../utilities/execution_policy.hpp"
 #include "../../configs/heat_data_config_2d.hpp"
 #include "../../configs/heat_explicit_solver_config.hpp"
 
@@ -30,6 +31,7 @@ class explicit_heston_solver_2d_builder
     boundary_2d_ptr vertical_upper_boundary_;
     grid_config_2d_ptr grid_cfg_;
     heat_explicit_solver_config_ptr solver_config_;
+    execution_policy_ptr execution_policy_;
 
   public:
     LSS_API explicit explicit_heston_solver_2d_builder();
@@ -47,6 +49,8 @@ class explicit_heston_solver_2d_builder
 
     LSS_API explicit_heston_solver_2d_builder &solver_config(const heat_explicit_solver_config_ptr &solver_config);
 
+    LSS_API explicit_heston_solver_2d_builder &execution_policy(const execution_policy_ptr &execution_policy);
+
     LSS_API explicit_heston_solver_2d_ptr build();
 };
 
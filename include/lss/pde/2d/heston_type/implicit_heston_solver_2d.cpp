@@ -61,11 +61,19 @@ implicit_heston_solver_2d_builder &implicit_heston_solver_2d_builder::solver_con
     return *this;
 }
 
+implicit_heston_solver_2d_builder &implicit_heston_solver_2d_builder::execution_policy(
+    const execution_policy_ptr &execution_policy)
+{
+    execution_policy_ = execution_policy;
+    return *this;
+}
+
 implicit_heston_solver_2d_ptr implicit_heston_solver_2d_builder::build()
 {
     return std::make_shared<implicit_heston_solver_2d>(heat_data_config_, discretization_config_,
                                                        vertical_upper_boundary_, horizontal_boundary_pair_, splitting_,
-                                                       grid_cfg_, solver_config_, solver_config_details_);
+                                                       grid_cfg_, solver_config_, solver_config_details_,
+                                                       execution_policy_);
 }
 
 } // namespace lss
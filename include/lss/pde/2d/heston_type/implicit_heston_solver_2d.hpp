@@ -10,6 +10,7 @@
 #include "../../../../../pde_solvers/2d/heat_type/lss_heston_equation.hpp"
 #include "../../../configs/discretization_config_2d.hpp"
 #include "../../../configs/grid_config_2d.hpp"
+#include "../../../utilities/execution_policy.hpp"
 #include "../../configs/heat_data_config_2d.hpp"
 #include "../../configs/heat_implicit_solver_config.hpp"
 #include "../../configs/splitting_config.hpp"
@@ -34,6 +35,7 @@ class implicit_heston_solver_2d_builder
     splitting_config_ptr splitting_;
     heat_implicit_solver_config_ptr solver_config_;
     std::map<std::string, double> solver_config_details_;
+    execution_policy_ptr execution_policy_;
 
   public:
     LSS_API explicit implicit_heston_solver_2d_builder();
@@ -56,6 +58,8 @@ class implicit_heston_solver_2d_builder
     LSS_API implicit_heston_solver_2d_builder &solver_config_details(
         const std::map<std::string, double> &solver_config_details);
 
+    LSS_API implicit_heston_solver_2d_builder &execution_policy(const execution_policy_ptr &execution_policy);
+
     LSS_API implicit_heston_solver_2d_ptr build();
 };
 
@@ -2,6 +2,7 @@
 #define _HEAT_COEFFICIENT_DATA_CONFIG_1D_HPP_
 
 #include <functional>
+#include <vector>
 
 #include "../../../../common/lss_enumerations.hpp"
 #include "../../../../common/lss_macros.hpp"
@@ -21,6 +22,10 @@ struct heat_coefficient_data_config_1d_builder
     std::function<double(double, double)> a_coefficient_;
     std::function<double(double, double)> b_coefficient_;
     std::function<double(double, double)> c_coefficient_;
+    // separable coefficients, null space factor means the coefficient is given as a whole:
+    std::vector<std::function<double(double)>> time_factors_;
+    std::vector<std::function<double(double)>> space_factors_;
+    bool is_time_homogeneous_;
 
   public:
     LSS_API explicit heat_coefficient_data_config_1d_builder();
@@ -34,6 +39,22 @@ struct heat_coefficient_data_config_1d_builder
     LSS_API heat_coefficient_data_config_1d_builder &c_coefficient(
         std::function<double(double, double)> const &c_coefficient);
 
+    /**
+        @brief  Sets separable a coefficient (other coefficients alike), a(t,x) = time_factor(t) * space_factor(x)
+        @param  time_factor - time factor (nullptr means constant in time)
+        @param  space_factor - space factor
+    **/
+    LSS_API heat_coefficient_data_config_1d_builder &a_coefficient(
+        std::function<double(double)> const &time_factor, std::function<double(double)> const &space_factor);
+
+    LSS_API heat_coefficient_data_config_1d_builder &b_coefficient(
+        std::function<double(double)> const &time_factor, std::function<double(double)> const &space_factor);
+
+    LSS_API heat_coefficient_data_config_1d_builder &c_coefficient(
+        std::function<double(double)> const &time_factor, std::function<double(double)> const &space_factor);
+
+    LSS_API heat_coefficient_data_config_1d_builder &is_time_homogeneous(bool is_time_homogeneous);
+
     LSS_API heat_coefficient_data_config_1d_ptr build();
 };
 
@@ -1,9 +1,12 @@
 #include "heat_coefficient_data_config_2d.hpp"
 
+#include <algorithm>
+
 namespace lss
 {
 
 heat_coefficient_data_config_2d_builder::heat_coefficient_data_config_2d_builder()
+    : time_factors_(6), space_factors_(6), is_time_homogeneous_{false}
 {
 }
 
@@ -11,6 +14,17 @@ heat_coefficient_data_config_2d_builder &heat_coefficient_data_config_2d_builder
     std::function<double(double, double, double)> const &a_coefficient)
 {
     a_coefficient_ = a_coefficient;
+    time_factors_[0] = nullptr;
+    space_factors_[0] = nullptr;
+    return *this;
+}
+
+heat_coefficient_data_config_2d_builder &heat_coefficient_data_config_2d_builder::a_coefficient(
+    std::function<double(double)> const &time_factor, std::function<double(double, double)> const &space_factor)
+{
+    a_coefficient_ = nullptr;
+    time_factors_[0] = time_factor;
+    space_factors_[0] = space_factor;
     return *this;
 }
 
@@ -18,6 +32,17 @@ heat_coefficient_data_config_2d_builder &heat_coefficient_data_config_2d_builder
     std::function<double(double, double, double)> const &b_coefficient)
 {
     b_coefficient_ = b_coefficient;
+    time_factors_[1] = nullptr;
+    space_factors_[1] = nullptr;
+    return *this;
+}
+
+heat_coefficient_data_config_2d_builder &heat_coefficient_data_config_2d_builder::b_coefficient(
+    std::function<double(double)> const &time_factor, std::function<double(double, double)> const &space_factor)
+{
+    b_coefficient_ = nullptr;
+    time_factors_[1] = time_factor;
+    space_factors_[1] = space_factor;
     return *this;
 }
 
@@ -25,6 +50,17 @@ heat_coefficient_data_config_2d_builder &heat_coefficient_data_config_2d_builder
     std::function<double(double, double, double)> const &c_coefficient)
 {
     c_coefficient_ = c_coefficient;
+    time_factors_[2] = nullptr;
+    space_factors_[2] = nullptr;
+    return *this;
+}
+
+heat_coefficient_data_config_2d_builder &heat_coefficient_data_config_2d_builder::c_coefficient(
+    std::function<double(double)> const &time_factor, std::function<double(double, double)> const &space_factor)
+{
+    c_coefficient_ = nullptr;
+    time_factors_[2] = time_factor;
+    space_factors_[2] = space_factor;
     return *this;
 }
 
@@ -32,6 +68,17 @@ heat_coefficient_data_config_2d_builder &heat_coefficient_data_config_2d_builder
     std::function<double(double, double, double)> const &d_coefficient)
 {
     d_coefficient_ = d_coefficient;
+    time_factors_[3] = nullptr;
+    space_factors_[3] = nullptr;
+    return *this;
+}
+
+heat_coefficient_data_config_2d_builder &heat_coefficient_data_config_2d_builder::d_coefficient(
+    std::function<double(double)> const &time_factor, std::function<double(double, double)> const &space_factor)
+{
+    d_coefficient_ = nullptr;
+    time_factors_[3] = time_factor;
+    space_factors_[3] = space_factor;
     return *this;
 }
 
@@ -39,6 +86,17 @@ heat_coefficient_data_config_2d_builder &heat_coefficient_data_config_2d_builder
     std::function<double(double, double, double)> const &e_coefficient)
 {
     e_coefficient_ = e_coefficient;
+    time_factors_[4] = nullptr;
+    space_factors_[4] = nullptr;
+    return *this;
+}
+
+heat_coefficient_data_config_2d_builder &heat_coefficient_data_config_2d_builder::e_coefficient(
+    std::function<double(double)> const &time_factor, std::function<double(double, double)> const &space_factor)
+{
+    e_coefficient_ = nullptr;
+    time_factors_[4] = time_factor;
+    space_factors_[4] = space_factor;
     return *this;
 }
 
@@ -46,13 +104,51 @@ heat_coefficient_data_config_2d_builder &heat_coefficient_data_config_2d_builder
     std::function<double(double, double, double)> const &f_coefficient)
 {
     f_coefficient_ = f_coefficient;
+    time_factors_[5] = nullptr;
+    space_factors_[5] = nullptr;
+    return *this;
+}
+
+heat_coefficient_data_config_2d_builder &heat_coefficient_data_config_2d_builder::f_coefficient(
+    std::function<double(double)> const &time_factor, std::function<double(double, double)> const &space_factor)
+{
+    f_coefficient_ = nullptr;
+    time_factors_[5] = time_factor;
+    space_factors_[5] = space_factor;
+    return *this;
+}
+
+heat_coefficient_data_config_2d_builder &heat_coefficient_data_config_2d_builder::is_time_homogeneous(
+    bool is_time_homogeneous)
+{
+    is_time_homogeneous_ = is_time_homogeneous;
     return *this;
 }
 
 heat_coefficient_data_config_2d_ptr heat_coefficient_data_config_2d_builder::build()
 {
-    return std::make_shared<heat_coefficient_data_config_2d>(a_coefficient_, b_coefficient_, c_coefficient_,
-                                                             d_coefficient_, e_coefficient_, f_coefficient_);
+    auto const is_separable =
+        std::all_of(space_factors_.begin(), space_factors_.end(),
+                    [](std::function<double(double, double)> const &factor) { return bool(factor); });
+    if (is_separable)
+        return std::make_shared<heat_coefficient_data_config_2d>(time_factors_, space_factors_);
+    // mixed declaration, separable coefficients are composed:
+    std::vector<std::function<double(double, double, double)>> coefficients{
+        a_coefficient_, b_coefficient_, c_coefficient_, d_coefficient_, e_coefficient_, f_coefficient_};
+    for (std::size_t i = 0; i < coefficients.size(); ++i)
+    {
+        auto const time_factor = time_factors_[i];
+        auto const space_factor = space_factors_[i];
+        if (!space_factor)
+            continue;
+        if (time_factor)
+            coefficients[i] = [=](double t, double x, double y) { return time_factor(t) * space_factor(x, y); };
+        else
+            coefficients[i] = [=](double t, double x, double y) { return space_factor(x, y); };
+    }
+    return std::make_shared<heat_coefficient_data_config_2d>(coefficients[0], coefficients[1], coefficients[2],
+                                                             coefficients[3], coefficients[4], coefficients[5],
+                                                             is_time_homogeneous_);
 }
 
 } // namespace lss
@@ -2,6 +2,7 @@
 #define _HEAT_COEFFICIENT_DATA_CONFIG_2D_HPP_
 
 #include <functional>
+#include <vector>
 
 #include "../../../../common/lss_enumerations.hpp"
 #include "../../../../common/lss_macros.hpp"
@@ -23,6 +24,10 @@ struct heat_coefficient_data_config_2d_builder
     std::function<double(double, double, double)> d_coefficient_;
     std::function<double(double, double, double)> e_coefficient_;
     std::function<double(double, double, double)> f_coefficient_;
+    // separable coefficients, null space factor means the coefficient is given as a whole:
+    std::vector<std::function<double(double)>> time_factors_;
+    std::vector<std::function<double(double, double)>> space_factors_;
+    bool is_time_homogeneous_;
 
   public:
     LSS_API explicit heat_coefficient_data_config_2d_builder();
@@ -45,6 +50,31 @@ struct heat_coefficient_data_config_2d_builder
     LSS_API heat_coefficient_data_config_2d_builder &f_coefficient(
         std::function<double(double, double, double)> const &f_coefficient);
 
+    /**
+        @brief  Sets separable a coefficient (other coefficients alike), a(t,x,y) = time_factor(t) * space_factor(x,y)
+        @param  time_factor - time factor (nullptr means constant in time)
+        @param  space_factor - space factor
+    **/
+    LSS_API heat_coefficient_data_config_2d_builder &a_coefficient(
+        std::function<double(double)> const &time_factor, std::function<double(double, double)> const &space_factor);
+
+    LSS_API heat_coefficient_data_config_2d_builder &b_coefficient(
+        std::function<double(double)> const &time_factor, std::function<double(double, double)> const &space_factor);
+
+    LSS_API heat_coefficient_data_config_2d_builder &c_coefficient(
+        std::function<double(double)> const &time_factor, std::function<double(double, double)> const &space_factor);
+
+    LSS_API heat_coefficient_data_config_2d_builder &d_coefficient(
+        std::function<double(double)> const &time_factor, std::function<double(double, double)> const &space_factor);
+
+    LSS_API heat_coefficient_data_config_2d_builder &e_coefficient(
+        std::function<double(double)> const &time_factor, std::function<double(double, double)> const &space_factor);
+
+    LSS_API heat_coefficient_data_config_2d_builder &f_coefficient(
+        std::function<double(double)> const &time_factor, std::function<double(double, double)> const &space_factor);
+
+    LSS_API heat_coefficient_data_config_2d_builder &is_time_homogeneous(bool is_time_homogeneous);
+
     LSS_API heat_coefficient_data_config_2d_ptr build();
 };
 
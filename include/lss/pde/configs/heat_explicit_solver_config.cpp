@@ -3,7 +3,7 @@
 namespace lss
 {
 
-heat_explicit_solver_config_builder::heat_explicit_solver_config_builder()
+heat_explicit_solver_config_builder::heat_explicit_solver_config_builder() : number_of_threads_{1}
 {
 }
 
@@ -26,8 +26,15 @@ heat_explicit_solver_config_builder &heat_explicit_solver_config_builder::explic
     return *this;
 }
 
+heat_explicit_solver_config_builder &heat_explicit_solver_config_builder::number_of_threads(std::size_t value)
+{
+    number_of_threads_ = value;
+    return *this;
+}
+
 heat_explicit_solver_config_ptr heat_explicit_solver_config_builder::build()
 {
-    return std::make_shared<heat_explicit_solver_config>(memory_space_, traverse_direction_, explicit_pde_scheme_);
+    return std::make_shared<heat_explicit_solver_config>(memory_space_, traverse_direction_, explicit_pde_scheme_,
+                                                         number_of_threads_);
 }
 } // namespace lss
@@ -20,6 +20,7 @@ struct heat_explicit_solver_config_builder
     memory_space memory_space_;
     traverse_direction traverse_direction_;
     explicit_pde_schemes explicit_pde_scheme_;
+    std::size_t number_of_threads_;
 
   public:
     LSS_API explicit heat_explicit_solver_config_builder();
@@ -30,6 +31,8 @@ struct heat_explicit_solver_config_builder
 
     LSS_API heat_explicit_solver_config_builder &explicit_pde_scheme(explicit_pde_schemes explicit_pde_scheme);
 
+    LSS_API heat_explicit_solver_config_builder &number_of_threads(std::size_t value);
+
     LSS_API heat_explicit_solver_config_ptr build();
 };
 
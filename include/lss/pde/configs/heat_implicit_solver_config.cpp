@@ -3,7 +3,7 @@
 namespace lss
 {
 
-heat_implicit_solver_config_builder::heat_implicit_solver_config_builder()
+heat_implicit_solver_config_builder::heat_implicit_solver_config_builder() : number_of_threads_{1}, rannacher_steps_{0}
 {
 }
 
@@ -39,9 +39,29 @@ heat_implicit_solver_config_builder &heat_implicit_solver_config_builder::implic
     return *this;
 }
 
+heat_implicit_solver_config_builder &heat_implicit_solver_config_builder::number_of_threads(std::size_t value)
+{
+    number_of_threads_ = value;
+    return *this;
+}
+
+heat_implicit_solver_config_builder &heat_implicit_solver_config_builder::rannacher_steps(std::size_t value)
+{
+    rannacher_steps_ = value;
+    return *this;
+}
+
+heat_implicit_solver_config_builder &heat_implicit_solver_config_builder::adaptive_time_stepping(
+    adaptive_time_stepping_config_ptr const &adaptive_time_stepping)
+{
+    adaptive_time_stepping_ = adaptive_time_stepping;
+    return *this;
+}
+
 heat_implicit_solver_config_ptr heat_implicit_solver_config_builder::build()
 {
     return std::make_shared<heat_implicit_solver_config>(memory_space_, traverse_direction_, tridiagonal_method_,
-                                                         tridiagonal_factorization_, implicit_pde_scheme_ptr_);
+                                                         tridiagonal_factorization_, implicit_pde_scheme_ptr_,
+                                                         number_of_threads_, rannacher_steps_, adaptive_time_stepping_);
 }
 } // namespace lss
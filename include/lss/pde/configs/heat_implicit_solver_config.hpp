@@ -14,6 +14,8 @@ using tridiagonal_method = lss_enumerations::tridiagonal_method_enum;
 using factorization = lss_enumerations::factorization_enum;
 using heat_implicit_solver_config_ptr = lss_pde_solvers::heat_implicit_solver_config_ptr;
 using heat_implicit_solver_config = lss_pde_solvers::heat_implicit_solver_config;
+using adaptive_time_stepping_config = lss_pde_solvers::adaptive_time_stepping_config;
+using adaptive_time_stepping_config_ptr = lss_pde_solvers::adaptive_time_stepping_config_ptr;
 using implicit_pde_scheme_ptr = lss_pde_solvers::implicit_pde_scheme_ptr;
 
 struct heat_implicit_solver_config_builder
@@ -24,6 +26,9 @@ struct heat_implicit_solver_config_builder
     tridiagonal_method tridiagonal_method_;
     factorization tridiagonal_factorization_;
     implicit_pde_scheme_ptr implicit_pde_scheme_ptr_;
+    std::size_t number_of_threads_;
+    std::size_t rannacher_steps_;
+    adaptive_time_stepping_config_ptr adaptive_time_stepping_;
 
   public:
     LSS_API explicit heat_implicit_solver_config_builder();
@@ -38,6 +43,13 @@ struct heat_implicit_solver_config_builder
 
     LSS_API heat_implicit_solver_config_builder &implicit_pde_scheme(implicit_pde_scheme_ptr implicit_pde_scheme);
 
+    LSS_API heat_implicit_solver_config_builder &number_of_threads(std::size_t value);
+
+    LSS_API heat_implicit_solver_config_builder &rannacher_steps(std::size_t value);
+
+    LSS_API heat_implicit_solver_config_builder &adaptive_time_stepping(
+        adaptive_time_stepping_config_ptr const &adaptive_time_stepping);
+
     LSS_API heat_implicit_solver_config_ptr build();
 };
 
@@ -3,7 +3,7 @@
 namespace lss
 {
 
-splitting_config_builder::splitting_config_builder()
+splitting_config_builder::splitting_config_builder() : number_of_threads_{1}, rannacher_steps_{0}
 {
 }
 
@@ -19,9 +19,22 @@ splitting_config_builder &splitting_config_builder::weighting_value(double value
     return *this;
 }
 
+splitting_config_builder &splitting_config_builder::number_of_threads(std::size_t value)
+{
+    number_of_threads_ = value;
+    return *this;
+}
+
+splitting_config_builder &splitting_config_builder::rannacher_steps(std::size_t value)
+{
+    rannacher_steps_ = value;
+    return *this;
+}
+
 splitting_config_ptr splitting_config_builder::build()
 {
-    return std::make_shared<splitting_config>(splitting_method_, weighting_value_);
+    return std::make_shared<splitting_config>(splitting_method_, weighting_value_, number_of_threads_,
+                                              rannacher_steps_);
 }
 
 } // namespace lss
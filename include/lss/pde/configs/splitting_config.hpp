@@ -17,6 +17,8 @@ struct splitting_config_builder
   private:
     splitting_method splitting_method_;
     double weighting_value_;
+    std::size_t number_of_threads_;
+    std::size_t rannacher_steps_;
 
   public:
     LSS_API explicit splitting_config_builder();
@@ -25,6 +27,10 @@ struct splitting_config_builder
 
     LSS_API splitting_config_builder &weighting_value(double value);
 
+    LSS_API splitting_config_builder &number_of_threads(std::size_t value);
+
+    LSS_API splitting_config_builder &rannacher_steps(std::size_t value);
+
     LSS_API splitting_config_ptr build();
 };
 
@@ -1,9 +1,12 @@
 #include "wave_coefficient_data_config_1d.hpp"
 
+#include <algorithm>
+
 namespace lss
 {
 
 wave_coefficient_data_config_1d_builder::wave_coefficient_data_config_1d_builder()
+    : time_factors_(4), space_factors_(4), is_time_homogeneous_{false}
 {
 }
 
@@ -11,6 +14,17 @@ wave_coefficient_data_config_1d_builder &wave_coefficient_data_config_1d_builder
     std::function<double(double, double)> const &a_coefficient)
 {
     a_coefficient_ = a_coefficient;
+    time_factors_[0] = nullptr;
+    space_factors_[0] = nullptr;
+    return *this;
+}
+
+wave_coefficient_data_config_1d_builder &wave_coefficient_data_config_1d_builder::a_coefficient(
+    std::function<double(double)> const &time_factor, std::function<double(double)> const &space_factor)
+{
+    a_coefficient_ = nullptr;
+    time_factors_[0] = time_factor;
+    space_factors_[0] = space_factor;
     return *this;
 }
 
@@ -18,6 +32,17 @@ wave_coefficient_data_config_1d_builder &wave_coefficient_data_config_1d_builder
     std::function<double(double, double)> const &b_coefficient)
 {
     b_coefficient_ = b_coefficient;
+    time_factors_[1] = nullptr;
+    space_factors_[1] = nullptr;
+    return *this;
+}
+
+wave_coefficient_data_config_1d_builder &wave_coefficient_data_config_1d_builder::b_coefficient(
+    std::function<double(double)> const &time_factor, std::function<double(double)> const &space_factor)
+{
+    b_coefficient_ = nullptr;
+    time_factors_[1] = time_factor;
+    space_factors_[1] = space_factor;
     return *this;
 }
 
@@ -25,6 +50,17 @@ wave_coefficient_data_config_1d_builder &wave_coefficient_data_config_1d_builder
     std::function<double(double, double)> const &c_coefficient)
 {
     c_coefficient_ = c_coefficient;
+    time_factors_[2] = nullptr;
+    space_factors_[2] = nullptr;
+    return *this;
+}
+
+wave_coefficient_data_config_1d_builder &wave_coefficient_data_config_1d_builder::c_coefficient(
+    std::function<double(double)> const &time_factor, std::function<double(double)> const &space_factor)
+{
+    c_coefficient_ = nullptr;
+    time_factors_[2] = time_factor;
+    space_factors_[2] = space_factor;
     return *this;
 }
 
@@ -32,13 +68,49 @@ wave_coefficient_data_config_1d_builder &wave_coefficient_data_config_1d_builder
     std::function<double(double, double)> const &d_coefficient)
 {
     d_coefficient_ = d_coefficient;
+    time_factors_[3] = nullptr;
+    space_factors_[3] = nullptr;
+    return *this;
+}
+
+wave_coefficient_data_config_1d_builder &wave_coefficient_data_config_1d_builder::d_coefficient(
+    std::function<double(double)> const &time_factor, std::function<double(double)> const &space_factor)
+{
+    d_coefficient_ = nullptr;
+    time_factors_[3] = time_factor;
+    space_factors_[3] = space_factor;
+    return *this;
+}
+
+wave_coefficient_data_config_1d_builder &wave_coefficient_data_config_1d_builder::is_time_homogeneous(
+    bool is_time_homogeneous)
+{
+    is_time_homogeneous_ = is_time_homogeneous;
     return *this;
 }
 
 wave_coefficient_data_config_1d_ptr wave_coefficient_data_config_1d_builder::build()
 {
-    return std::make_shared<wave_coefficient_data_config_1d>(a_coefficient_, b_coefficient_, c_coefficient_,
-                                                             d_coefficient_);
+    auto const is_separable = std::all_of(space_factors_.begin(), space_factors_.end(),
+                                          [](std::function<double(double)> const &factor) { return bool(factor); });
+    if (is_separable)
+        return std::make_shared<wave_coefficient_data_config_1d>(time_factors_, space_factors_);
+    // mixed declaration, separable coefficients are composed:
+    std::vector<std::function<double(double, double)>> coefficients{
+        a_coefficient_, b_coefficient_, c_coefficient_, d_coefficient_};
+    for (std::size_t i = 0; i < coefficients.size(); ++i)
+    {
+        auto const time_factor = time_factors_[i];
+        auto const space_factor = space_factors_[i];
+        if (!space_factor)
+            continue;
+        if (time_factor)
+            coefficients[i] = [=](double t, double x) { return time_factor(t) * space_factor(x); };
+        else
+            coefficients[i] = [=](double t, double x) { return space_factor(x); };
+    }
+    return std::make_shared<wave_coefficient_data_config_1d>(coefficients[0], coefficients[1], coefficients[2],
+                                                             coefficients[3], is_time_homogeneous_);
 }
 
 } // namespace lss
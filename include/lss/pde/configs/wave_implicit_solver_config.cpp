@@ -32,9 +32,16 @@ wave_implicit_solver_config_builder &wave_implicit_solver_config_builder::tridia
     return *this;
 }
 
+wave_implicit_solver_config_builder &wave_implicit_solver_config_builder::adaptive_time_stepping(
+    adaptive_time_stepping_config_ptr const &adaptive_time_stepping)
+{
+    adaptive_time_stepping_ = adaptive_time_stepping;
+    return *this;
+}
+
 wave_implicit_solver_config_ptr wave_implicit_solver_config_builder::build()
 {
     return std::make_shared<wave_implicit_solver_config>(memory_space_, traverse_direction_, tridiagonal_method_,
-                                                         tridiagonal_factorization_);
+                                                         tridiagonal_factorization_, adaptive_time_stepping_);
 }
 } // namespace lss
@@ -14,6 +14,8 @@ using tridiagonal_method = lss_enumerations::tridiagonal_method_enum;
 using factorization = lss_enumerations::factorization_enum;
 using wave_implicit_solver_config_ptr = lss_pde_solvers::wave_implicit_solver_config_ptr;
 using wave_implicit_solver_config = lss_pde_solvers::wave_implicit_solver_config;
+using adaptive_time_stepping_config = lss_pde_solvers::adaptive_time_stepping_config;
+using adaptive_time_stepping_config_ptr = lss_pde_solvers::adaptive_time_stepping_config_ptr;
 
 struct wave_implicit_solver_config_builder
 {
@@ -22,6 +24,7 @@ struct wave_implicit_solver_config_builder
     traverse_direction traverse_direction_;
     tridiagonal_method tridiagonal_method_;
     factorization tridiagonal_factorization_;
+    adaptive_time_stepping_config_ptr adaptive_time_stepping_;
 
   public:
     LSS_API explicit wave_implicit_solver_config_builder();
@@ -34,6 +37,9 @@ struct wave_implicit_solver_config_builder
 
     LSS_API wave_implicit_solver_config_builder &tridiagonal_factorization(factorization tridiagonal_factorization);
 
+    LSS_API wave_implicit_solver_config_builder &adaptive_time_stepping(
+        adaptive_time_stepping_config_ptr const &adaptive_time_stepping);
+
     LSS_API wave_implicit_solver_config_ptr build();
 };
 
@@ -0,0 +1,27 @@
+#include "execution_policy.hpp"
+
+namespace lss
+{
+
+execution_policy_builder::execution_policy_builder() : number_of_threads_{std::size_t(1)}
+{
+}
+
+execution_policy_builder &execution_policy_builder::number_of_threads(std::size_t value)
+{
+    number_of_threads_ = value;
+    return *this;
+}
+
+execution_policy_builder &execution_policy_builder::cpu_affinity(std::vector<std::size_t> const &value)
+{
+    cpu_affinity_ = value;
+    return *this;
+}
+
+lss_utility::execution_policy_ptr execution_policy_builder::build()
+{
+    return std::make_shared<lss_utility::execution_policy>(number_of_threads_, cpu_affinity_);
+}
+
+} // namespace lss
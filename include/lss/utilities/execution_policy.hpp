@@ -0,0 +1,33 @@
+#if !defined(_EXECUTION_POLICY_HPP_)
+#define _EXECUTION_POLICY_HPP_
+
+#include <vector>
+
+#include "../../../common/lss_execution_policy.hpp"
+#include "../../../common/lss_macros.hpp"
+
+namespace lss
+{
+
+using execution_policy_ptr = lss_utility::execution_policy_ptr;
+using execution_policy = lss_utility::execution_policy;
+
+struct execution_policy_builder
+{
+  private:
+    std::size_t number_of_threads_;
+    std::vector<std::size_t> cpu_affinity_;
+
+  public:
+    LSS_API explicit execution_policy_builder();
+
+    LSS_API execution_policy_builder &number_of_threads(std::size_t value);
+
+    LSS_API execution_policy_builder &cpu_affinity(std::vector<std::size_t> const &value);
+
+    LSS_API execution_policy_ptr build();
+};
+
+} // namespace lss
+
+#endif ///_EXECUTION_POLICY_HPP_
@@ -1,7 +1,10 @@
 ﻿#include<iostream>
 #include<string>
 
+#include"unit_tests/sparse_solvers/lss_core_banded_solver_t.hpp"
 #include"unit_tests/sparse_solvers/lss_core_cuda_solver_t.hpp"
+#include"unit_tests/sparse_solvers/lss_sor_solver_t.hpp"
+#include"unit_tests/sparse_solvers/lss_tridiagonal_solver_t.hpp"
 #include"unit_tests/ode_solvers/second_degree/lss_odes_2_degree_t.hpp"
 #include"unit_tests/pde_solvers/1d/lss_advection_equation_t.hpp"
 #include"unit_tests/pde_solvers/1d/lss_black_scholes_equation_t.hpp"
@@ -23,6 +26,7 @@ int main()
      // basic_ccontainer_3d_test();
      // slice_ccontainer_3d_test();  
      // basic_lcontainer_3d_test();
+     // view_rcontainer_3d_test();
 
      // ======================================================
      // =============== lss_odes_2_degree_t ==================
@@ -32,6 +36,7 @@ int main()
      // test_impl_simple_ode_dirichlet_robin_bc_cuda_solver_device();
      // test_impl_simple_ode_neumann_robin_bc_cuda_solver_device();
      // test_impl_simple_ode1_neumann_robin_bc_cuda_solver_device();
+     // test_impl_simple_ode_dirichlet_bc_karawia_solver_host();
 
     // ======================================================
     // ============= lss_core_cuda_solver_t =================
@@ -43,6 +48,22 @@ int main()
     // test_robin_bc_bvp_on_host();
     // test_robin_bc_bvp_on_device();
 
+    // ======================================================
+    // ============ lss_core_banded_solver_t ================
+    // ======================================================
+    // test_impl_core_banded_solver();
+
+    // ======================================================
+    // ================= lss_sor_solver_t ===================
+    // ======================================================
+    // test_impl_sor_solver_sweeps();
+
+    // ======================================================
+    // ============= lss_tridiagonal_solver_t ===============
+    // ======================================================
+    // test_impl_tridiagonal_batch();
+    // test_impl_thomas_lu_solver_factorization_reuse();
+
     // ======================================================
 
     // ======================================================
@@ -77,6 +98,7 @@ int main()
     // test_impl_black_scholes_equation_dirichlet_bc_sor_solver_host();
     // test_impl_black_scholes_equation_dirichlet_bc_double_sweep_solver();
     // test_impl_black_scholes_equation_dirichlet_bc_thomas_lu_solver();
+    // test_impl_black_scholes_equation_dirichlet_bc_batch();
     // test_impl_fwd_black_scholes_equation_dirichlet_bc_cuda_solver_device_qr();
     // test_impl_black_scholes_equation_dirichlet_bc_thomas_lu_solver_stepping();
     // test_expl_black_scholes_equation_dirichlet_bc_ade();
@@ -92,6 +114,8 @@ int main()
     // test_impl_pure_heat_equation_dirichlet_bc_cuda_solver_host_qr();
     // test_impl_pure_heat_equation_dirichlet_bc_double_sweep_solver();
     // test_impl_pure_heat_equation_dirichlet_bc_thomas_lu_solver();
+    // test_impl_pure_heat_equation_dirichlet_bc_spike_solver();
+    // test_impl_pure_heat_equation_dirichlet_bc_karawia_solver();
     // test_impl_pure_heat_equation_neumann_bc_cuda_solver_device_qr();
     // test_impl_pure_heat_equation_neumann_bc_thomas_lu_solver();
     // test_impl_pure_heat_equation_neumann_bc_double_sweep_solver();
@@ -125,6 +149,10 @@ int main()
     // ======================================================
     // test_impl_heston_equation_cuda_qr_solver();
     // test_impl_heston_equation_thomas_lu_solver();
+    // test_impl_heston_equation_time_slices();
+    // test_bench_heston_equation_adi_sweeps();
+    // test_expl_heston_equation_host_euler_threads();
+    // test_impl_heston_equation_sor_solver_threads();
     //
     // ======================================================
 
@@ -140,6 +168,10 @@ int main()
     // ======================================================
     // test_impl_hhw_equation_cuda_qr_solver();
     // test_impl_hhw_equation_tlu_dss_solver();  
+    // test_impl_hhw_equation_tlu_splitting_methods();
+    // test_impl_hhw_equation_tlu_douglas_rachford_pinned();
+    // test_impl_hhw_equation_tlu_douglas_rachford_threads();
+    // test_impl_hhw_equation_sor_solver_threads();
     // 
     // ======================================================
 
@@ -38,6 +38,8 @@ void ode_implicit_solver_config::initialize()
                    "No support for Double Sweep Solver on Device");
         LSS_VERIFY(!(tridiagonal_method_ == tridiagonal_method_enum::ThomasLUSolver),
                    "No support for Tomas LU Solver on Device");
+        LSS_VERIFY(!(tridiagonal_method_ == tridiagonal_method_enum::KarawiaSolver),
+                   "No support for Karawia Solver on Device");
     }
 
     if (tridiagonal_method_ == tridiagonal_method_enum::DoubleSweepSolver)
@@ -63,6 +65,16 @@ void ode_implicit_solver_config::initialize()
                    "Solver");
     }
 
+    if (tridiagonal_method_ == tridiagonal_method_enum::KarawiaSolver)
+    {
+        LSS_VERIFY(!(tridiagonal_factorization_ == factorization_enum::CholeskyMethod),
+                   "No support for Cholesky Method factorization for Karawia Solver");
+        LSS_VERIFY(!(tridiagonal_factorization_ == factorization_enum::LUMethod),
+                   "No support for LU Method factorization for Karawia Solver");
+        LSS_VERIFY(!(tridiagonal_factorization_ == factorization_enum::QRMethod),
+                   "No support for QR Method factorization for Karawia Solver");
+    }
+
     if (tridiagonal_method_ == tridiagonal_method_enum::SORSolver)
     {
         LSS_VERIFY(!(tridiagonal_factorization_ == factorization_enum::CholeskyMethod),
@@ -4,6 +4,7 @@
 
 #include "../../common/lss_macros.hpp"
 #include "../../discretization/lss_discretization.hpp"
+#include "../../sparse_solvers/pentadiagonal/karawia_solver/lss_karawia_solver.hpp"
 #include "../../sparse_solvers/tridiagonal/cuda_solver/lss_cuda_solver.hpp"
 #include "../../sparse_solvers/tridiagonal/double_sweep_solver/lss_double_sweep_solver.hpp"
 #include "../../sparse_solvers/tridiagonal/sor_solver/lss_sor_solver.hpp"
@@ -117,6 +118,14 @@ void ode_equation::solve(container_t &solution)
         {
             solver = std::make_shared<lss_thomas_lu_solver::thomas_lu_solver>(space_size);
         }
+        else if (ode_solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::KarawiaSolver)
+        {
+            auto const &pentadiagonal_solver = std::make_shared<lss_karawia_solver::karawia_solver>(space_size);
+            ode_equation_implicit_kernel kernel(pentadiagonal_solver, boundary_pair, ode_data_trans_cfg_,
+                                                ode_discretization_cfg_, ode_solver_cfg_, grid_cfg);
+            kernel(solution, is_ode_nonhom_set, ode_nonhom, omega_value);
+            return;
+        }
         else
         {
             throw std::exception("Not supported on Host");
@@ -20,6 +20,7 @@ namespace lss_ode_solvers
 
 using lss_boundary::boundary_1d_pair;
 using lss_grids::grid_config_1d_ptr;
+using lss_karawia_solver::karawia_solver_ptr;
 using lss_tridiagonal_solver::tridiagonal_solver_ptr;
 using lss_utility::container_t;
 
@@ -35,6 +36,7 @@ class ode_equation_implicit_kernel
 
   private:
     tridiagonal_solver_ptr solver_;
+    karawia_solver_ptr pentadiagonal_solver_;
     boundary_1d_pair boundary_pair_;
     ode_data_transform_ptr ode_data_cfg_;
     ode_discretization_config_ptr discretization_cfg_;
@@ -48,6 +50,15 @@ class ode_equation_implicit_kernel
                                  ode_implicit_solver_config_ptr const &solver_config,
                                  grid_config_1d_ptr const &grid_config);
 
+    /**
+        @brief  Kernel of the fourth-order five-point scheme (Dirichlet boundaries only)
+    **/
+    ode_equation_implicit_kernel(karawia_solver_ptr solver, boundary_1d_pair const &boundary_pair,
+                                 ode_data_transform_ptr const &ode_data_config,
+                                 ode_discretization_config_ptr const &discretization_config,
+                                 ode_implicit_solver_config_ptr const &solver_config,
+                                 grid_config_1d_ptr const &grid_config);
+
     void operator()(container_t &solution, bool is_ode_nonhom_set, std::function<double(double)> const &ode_nonhom,
                     double omega_value);
 };
@@ -11,12 +11,25 @@ ode_implicit_solver_method::ode_implicit_solver_method(tridiagonal_solver_ptr co
     initialize();
 }
 
+ode_implicit_solver_method::ode_implicit_solver_method(karawia_solver_ptr const &solver_ptr,
+                                                       ode_implicit_coefficients_ptr const &coefficients,
+                                                       grid_config_1d_ptr const &grid_config)
+    : pentau_ptr_{solver_ptr}, coefficients_{coefficients}, grid_cfg_{grid_config}
+{
+    initialize();
+}
+
 void ode_implicit_solver_method::initialize()
 {
     low_.resize(coefficients_->space_size_);
     diag_.resize(coefficients_->space_size_);
     high_.resize(coefficients_->space_size_);
     rhs_.resize(coefficients_->space_size_);
+    if (pentau_ptr_)
+    {
+        lowest_.resize(coefficients_->space_size_);
+        uppest_.resize(coefficients_->space_size_);
+    }
 }
 
 void ode_implicit_solver_method::split(container_t &low, container_t &diag, container_t &high)
@@ -31,28 +44,67 @@ void ode_implicit_solver_method::split(container_t &low, container_t &diag, cont
     }
 }
 
-ode_implicit_solver_method ::~ode_implicit_solver_method()
+void ode_implicit_solver_method::split(container_t &lowest, container_t &low, container_t &diag, container_t &high,
+                                       container_t &uppest)
 {
+    const std::size_t N = low.size() - 1;
+    const double c_24 = 1.0 / 24.0;
+    const double c_43 = 4.0 / 3.0;
+    double x{}, a{}, b{}, c{};
+    for (std::size_t t = 0; t <= N; ++t)
+    {
+        x = grid_1d::value(grid_cfg_, t);
+        a = coefficients_->A_(x);
+        b = coefficients_->B_(x);
+        c = coefficients_->C_(x);
+        if ((t < 2) || (t + 2 > N))
+        {
+            // nodes next to the boundary keep the three-point stencil:
+            lowest[t] = uppest[t] = 0.0;
+            low[t] = a;
+            diag[t] = c;
+            high[t] = b;
+            continue;
+        }
+        lowest[t] = c_24 * (b - 3.0 * a);
+        low[t] = c_43 * a;
+        diag[t] = c - 0.25 * (a + b);
+        high[t] = c_43 * b;
+        uppest[t] = c_24 * (a - 3.0 * b);
+    }
 }
 
-void ode_implicit_solver_method::solve(boundary_1d_pair const &boundary_pair, container_t &solution)
+void ode_implicit_solver_method::solve_system(boundary_1d_pair const &boundary_pair, container_t &solution)
 {
-    // get the right-hand side of the scheme:
+    if (pentau_ptr_)
+    {
+        split(lowest_, low_, diag_, high_, uppest_);
+        pentau_ptr_->set_diagonals(lowest_, low_, diag_, high_, uppest_);
+        pentau_ptr_->set_rhs(rhs_);
+        pentau_ptr_->solve(boundary_pair, solution, double{});
+        return;
+    }
     split(low_, diag_, high_);
     solveru_ptr_->set_diagonals(low_, diag_, high_);
     solveru_ptr_->set_rhs(rhs_);
     solveru_ptr_->solve(boundary_pair, solution);
 }
 
+ode_implicit_solver_method ::~ode_implicit_solver_method()
+{
+}
+
+void ode_implicit_solver_method::solve(boundary_1d_pair const &boundary_pair, container_t &solution)
+{
+    solve_system(boundary_pair, solution);
+}
+
 void ode_implicit_solver_method::solve(boundary_1d_pair const &boundary_pair,
                                        std::function<double(double)> const &source, container_t &solution)
 {
     // get the right-hand side of the scheme:
-    split(low_, diag_, high_);
     d_1d::of_function(grid_cfg_, source, rhs_);
-    solveru_ptr_->set_diagonals(low_, diag_, high_);
-    solveru_ptr_->set_rhs(rhs_);
-    solveru_ptr_->solve(boundary_pair, solution);
+    solve_system(boundary_pair, solution);
 }
 
 } // namespace lss_ode_solvers
@@ -21,6 +21,7 @@
 #include "../../../discretization/lss_grid.hpp"
 #include "../../../discretization/lss_grid_config.hpp"
 #include "../../../ode_solvers/second_degree/implicit_coefficients/lss_ode_implicit_coefficients.hpp"
+#include "../../../sparse_solvers/pentadiagonal/karawia_solver/lss_karawia_solver.hpp"
 #include "../../../sparse_solvers/tridiagonal/lss_tridiagonal_solver.hpp"
 
 namespace lss_ode_solvers
@@ -28,6 +29,7 @@ namespace lss_ode_solvers
 
 using lss_boundary::boundary_1d_pair;
 using lss_boundary::boundary_1d_ptr;
+using lss_karawia_solver::karawia_solver_ptr;
 using lss_tridiagonal_solver::tridiagonal_solver_ptr;
 using lss_utility::container_t;
 
@@ -41,11 +43,13 @@ class ode_implicit_solver_method
   private:
     // solvers:
     tridiagonal_solver_ptr solveru_ptr_;
+    karawia_solver_ptr pentau_ptr_;
     // scheme coefficients:
     ode_implicit_coefficients_ptr coefficients_;
     grid_config_1d_ptr grid_cfg_;
     // container:
     container_t low_, diag_, high_, rhs_;
+    container_t lowest_, uppest_;
 
     explicit ode_implicit_solver_method() = delete;
 
@@ -53,11 +57,25 @@ class ode_implicit_solver_method
 
     void split(container_t &low, container_t &diag, container_t &high);
 
+    void split(container_t &lowest, container_t &low, container_t &diag, container_t &high, container_t &uppest);
+
+    void solve_system(boundary_1d_pair const &boundary_pair, container_t &solution);
+
   public:
     explicit ode_implicit_solver_method(tridiagonal_solver_ptr const &solver_ptr,
                                         ode_implicit_coefficients_ptr const &coefficients,
                                         grid_config_1d_ptr const &grid_config);
 
+    /**
+        @brief  Solver method of the fourth-order five-point scheme (Dirichlet boundaries only)
+        @param  solver_ptr - pentadiagonal solver
+        @param  coefficients - scheme coefficients
+        @param  grid_config - grid
+    **/
+    explicit ode_implicit_solver_method(karawia_solver_ptr const &solver_ptr,
+                                        ode_implicit_coefficients_ptr const &coefficients,
+                                        grid_config_1d_ptr const &grid_config);
+
     ~ode_implicit_solver_method();
 
     ode_implicit_solver_method(ode_implicit_solver_method const &) = delete;
@@ -20,6 +20,17 @@ void heat_euler_coefficients::initialize_coefficients(heat_coefficients_ptr cons
     D_ = [=](double t, double x) { return d(t, x); };
     k_ = coefficients->k_;
     space_size_ = coefficients->space_size_;
+    is_time_homogeneous_ = coefficients->is_time_homogeneous_;
+    if (is_time_homogeneous_)
+    {
+        A_table_ = coefficients->A_table_;
+        B_table_.resize(space_size_);
+        D_table_ = coefficients->D_table_;
+        for (std::size_t t = 0; t < space_size_; ++t)
+        {
+            B_table_[t] = (one - two * coefficients->B_table_[t]);
+        }
+    }
 }
 
 heat_euler_coefficients::heat_euler_coefficients(heat_coefficients_ptr const &coefficients)
@@ -23,6 +23,11 @@ struct heat_euler_coefficients
     std::function<double(double, double)> A_;
     std::function<double(double, double)> B_;
     std::function<double(double, double)> D_;
+    // tabulated coefficients (filled only for time-homogeneous data):
+    bool is_time_homogeneous_;
+    container_t A_table_;
+    container_t B_table_;
+    container_t D_table_;
 
   private:
     void initialize_coefficients(heat_coefficients_ptr const &coefficients);
@@ -31,6 +36,21 @@ struct heat_euler_coefficients
     heat_euler_coefficients() = delete;
 
     explicit heat_euler_coefficients(heat_coefficients_ptr const &coefficients);
+
+    inline double A(double time, double x, std::size_t idx) const
+    {
+        return (is_time_homogeneous_ ? A_table_[idx] : A_(time, x));
+    }
+
+    inline double B(double time, double x, std::size_t idx) const
+    {
+        return (is_time_homogeneous_ ? B_table_[idx] : B_(time, x));
+    }
+
+    inline double D(double time, double x, std::size_t idx) const
+    {
+        return (is_time_homogeneous_ ? D_table_[idx] : D_(time, x));
+    }
 };
 
 using heat_euler_coefficients_ptr = sptr_t<heat_euler_coefficients>;
@@ -86,7 +86,7 @@ void heat_euler_cuda_scheme::operator()(container_t &solution, bool is_heat_sour
 void heat_euler_cuda_scheme::operator()(container_t &solution, bool is_heat_sourse_set,
                                 std::function<double(double, double)> const &heat_source,
                                 traverse_direction_enum traverse_dir,
-                                container_2d<by_enum::Row> &solutions) {
+                                time_slice_observer_1d const &observer) {
   auto const &timer = discretization_cfg_->time_range();
   const double k = discretization_cfg_->time_step();
   // last time index:
@@ -99,12 +99,12 @@ void heat_euler_cuda_scheme::operator()(container_t &solution, bool is_heat_sour
     explicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_,
                                           timer,
                             last_time_idx, k, traverse_dir, heat_source,
-                            solution, solutions);
+                            solution, observer);
   } else {
     explicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_,
                                           timer,
                             last_time_idx, k, traverse_dir, solution,
-                            solutions);
+                            observer);
   }
 }
 
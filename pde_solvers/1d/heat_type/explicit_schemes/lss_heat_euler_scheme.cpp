@@ -45,6 +45,9 @@ bool heat_euler_scheme::is_stable(heat_coefficients_ptr const &coefficients)
             if (((gamma * std::abs(b(t, x))) * (gamma * std::abs(b(t, x)))) > (two * lambda * a(t, x)))
                 return false;
         }
+        // time-homogeneous coefficients need only one time slice:
+        if (coefficients->is_time_homogeneous_)
+            break;
         t += k;
     }
     return true;
@@ -91,7 +94,7 @@ void heat_euler_scheme::operator()(container_t &solution, bool is_heat_sourse_se
 
 void heat_euler_scheme::operator()(container_t &solution, bool is_heat_sourse_set,
                                    std::function<double(double, double)> const &heat_source,
-                                   traverse_direction_enum traverse_dir, container_2d<by_enum::Row> &solutions)
+                                   traverse_direction_enum traverse_dir, time_slice_observer_1d const &observer)
 {
     auto const &timer = discretization_cfg_->time_range();
     const double k = discretization_cfg_->time_step();
@@ -102,12 +105,12 @@ void heat_euler_scheme::operator()(container_t &solution, bool is_heat_sourse_se
     if (is_heat_sourse_set)
     {
         explicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, timer, last_time_idx, k, traverse_dir,
-                                              heat_source, solution, solutions);
+                                              heat_source, solution, observer);
     }
     else
     {
         explicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, timer, last_time_idx, k, traverse_dir,
-                                              solution, solutions);
+                                              solution, observer);
     }
 }
 
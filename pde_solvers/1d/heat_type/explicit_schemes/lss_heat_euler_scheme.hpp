@@ -46,7 +46,7 @@ class heat_euler_scheme
 
     void operator()(container_t &solution, bool is_heat_sourse_set,
                     std::function<double(double, double)> const &heat_source, traverse_direction_enum traverse_dir,
-                    container_2d<by_enum::Row> &solutions);
+                    time_slice_observer_1d const &observer);
 };
 
 } // namespace one_dimensional
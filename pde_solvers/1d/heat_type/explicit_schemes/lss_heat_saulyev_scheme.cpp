@@ -11,6 +11,7 @@ namespace lss_pde_solvers
 namespace one_dimensional
 {
 
+using lss_boundary::boundary_cast;
 using lss_boundary::dirichlet_boundary_1d;
 using lss_boundary::neumann_boundary_1d;
 using lss_boundary::robin_boundary_1d;
@@ -18,20 +19,20 @@ using lss_boundary::robin_boundary_1d;
 void heat_saulyev_scheme::initialize(heat_coefficients_ptr const &coefficients)
 {
     auto const &first = boundary_pair_.first;
-    if (std::dynamic_pointer_cast<neumann_boundary_1d>(first))
+    if (boundary_cast<neumann_boundary_1d>(first))
     {
         throw std::exception("Neumann boundary type is not supported for this scheme");
     }
-    if (std::dynamic_pointer_cast<robin_boundary_1d>(first))
+    if (boundary_cast<robin_boundary_1d>(first))
     {
         throw std::exception("Robin boundary type is not supported for this scheme");
     }
     auto const &second = boundary_pair_.second;
-    if (std::dynamic_pointer_cast<neumann_boundary_1d>(second))
+    if (boundary_cast<neumann_boundary_1d>(second))
     {
         throw std::exception("Neumann boundary type is not supported for this scheme");
     }
-    if (std::dynamic_pointer_cast<robin_boundary_1d>(second))
+    if (boundary_cast<robin_boundary_1d>(second))
     {
         throw std::exception("Robin boundary type is not supported for this scheme");
     }
@@ -74,7 +75,7 @@ void heat_saulyev_scheme::operator()(container_t &solution, bool is_heat_sourse_
 
 void heat_saulyev_scheme::operator()(container_t &solution, bool is_heat_sourse_set,
                                      std::function<double(double, double)> const &heat_source,
-                                     traverse_direction_enum traverse_dir, container_2d<by_enum::Row> &solutions)
+                                     traverse_direction_enum traverse_dir, time_slice_observer_1d const &observer)
 {
     auto const &timer = discretization_cfg_->time_range();
     const double k = discretization_cfg_->time_step();
@@ -85,12 +86,12 @@ void heat_saulyev_scheme::operator()(container_t &solution, bool is_heat_sourse_
     if (is_heat_sourse_set)
     {
         explicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, timer, last_time_idx, k, traverse_dir,
-                                              heat_source, solution, solutions);
+                                              heat_source, solution, observer);
     }
     else
     {
         explicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, timer, last_time_idx, k, traverse_dir,
-                                              solution, solutions);
+                                              solution, observer);
     }
 }
 
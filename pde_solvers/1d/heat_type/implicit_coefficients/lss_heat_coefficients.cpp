@@ -6,14 +6,20 @@ namespace lss_pde_solvers
 namespace one_dimensional
 {
 
-void heat_coefficients::initialize(pde_discretization_config_1d_ptr const &discretization_config)
+void heat_coefficients::initialize(pde_discretization_config_1d_ptr const &discretization_config,
+                                   double step_fraction)
 {
     // get space range:
     range_ = discretization_config->space_range();
     // get time step:
-    k_ = discretization_config->time_step();
+    k_ = step_fraction * discretization_config->time_step();
     // size of spaces discretization:
     space_size_ = discretization_config->number_of_space_points();
+    initialize_scheme_coefficients();
+}
+
+void heat_coefficients::initialize_scheme_coefficients()
+{
     const double one = 1.0;
     const double two = 2.0;
     const double half = 0.5;
@@ -34,14 +40,83 @@ void heat_coefficients::initialize_coefficients(heat_data_transform_1d_ptr const
     A_ = [=](double t, double x) { return (lambda_ * a(t, x) - gamma_ * b(t, x)); };
     B_ = [=](double t, double x) { return (lambda_ * a(t, x) - delta_ * c(t, x)); };
     D_ = [=](double t, double x) { return (lambda_ * a(t, x) + gamma_ * b(t, x)); };
+    is_time_homogeneous_ = heat_data_config->is_time_homogeneous();
+    is_separable_ = heat_data_config->is_separable();
+}
+
+void heat_coefficients::initialize_tables(double time)
+{
+    A_table_.resize(space_size_);
+    B_table_.resize(space_size_);
+    D_table_.resize(space_size_);
+    const double h = 1.0 / (space_size_ - 1);
+    double x{};
+    for (std::size_t t = 0; t < space_size_; ++t)
+    {
+        x = h * t;
+        A_table_[t] = A_(time, x);
+        B_table_[t] = B_(time, x);
+        D_table_[t] = D_(time, x);
+    }
+}
+
+void heat_coefficients::initialize_separable(heat_data_transform_1d_ptr const &heat_data_config)
+{
+    auto const &parts = heat_data_config->separable_parts();
+    separable_ = separable_coefficients(heat_data_config->time_factors(), 3);
+    container_t a(space_size_), b(space_size_), c(space_size_);
+    const double h = 1.0 / (space_size_ - 1);
+    double x{};
+    for (std::size_t p = 0; p < parts.size(); ++p)
+    {
+        // parts are time-homogeneous:
+        for (std::size_t t = 0; t < space_size_; ++t)
+        {
+            x = h * t;
+            a[t] = parts[p]->a_coefficient()(0.0, x);
+            b[t] = parts[p]->b_coefficient()(0.0, x);
+            c[t] = parts[p]->c_coefficient()(0.0, x);
+        }
+        separable_.add_part(0, p, a);
+        separable_.add_part(1, p, b);
+        separable_.add_part(2, p, c);
+    }
 }
 
 heat_coefficients::heat_coefficients(heat_data_transform_1d_ptr const &heat_data_config,
-                                     pde_discretization_config_1d_ptr const &discretization_config, double const &theta)
+                                     pde_discretization_config_1d_ptr const &discretization_config, double const &theta,
+                                     double const &step_fraction)
     : theta_{theta}
 {
-    initialize(discretization_config);
+    initialize(discretization_config, step_fraction);
     initialize_coefficients(heat_data_config);
+    if (is_time_homogeneous_)
+    {
+        table_time_ = discretization_config->time_range()->lower();
+        initialize_tables(table_time_);
+    }
+    else if (is_separable_)
+    {
+        initialize_separable(heat_data_config);
+    }
+}
+
+void heat_coefficients::set_time_step(double time_step)
+{
+    k_ = time_step;
+    initialize_scheme_coefficients();
+    if (is_time_homogeneous_)
+    {
+        initialize_tables(table_time_);
+    }
+}
+
+void heat_coefficients::prepare_time_factors(double time)
+{
+    if (is_separable_ && !is_time_homogeneous_)
+    {
+        separable_.prepare(time);
+    }
 }
 
 } // namespace one_dimensional
@@ -5,6 +5,7 @@
 
 #include "../../../../common/lss_utility.hpp"
 #include "../../../lss_pde_discretization_config.hpp"
+#include "../../../lss_separable_coefficients.hpp"
 #include "../../../transformation/lss_heat_data_transform.hpp"
 
 namespace lss_pde_solvers
@@ -12,6 +13,7 @@ namespace lss_pde_solvers
 
 namespace one_dimensional
 {
+using lss_utility::container_t;
 using lss_utility::range;
 using lss_utility::sptr_t;
 
@@ -28,17 +30,79 @@ struct heat_coefficients
     std::function<double(double, double)> A_;
     std::function<double(double, double)> B_;
     std::function<double(double, double)> D_;
+    // tabulated coefficients (filled only for time-homogeneous data):
+    bool is_time_homogeneous_;
+    container_t A_table_;
+    container_t B_table_;
+    container_t D_table_;
+    double table_time_;
+    // tabulated spatial parts of a, b, c (filled only for separable data):
+    bool is_separable_;
+    separable_coefficients separable_;
 
   private:
-    void initialize(pde_discretization_config_1d_ptr const &discretization_config);
+    void initialize(pde_discretization_config_1d_ptr const &discretization_config, double step_fraction);
+
+    void initialize_scheme_coefficients();
 
     void initialize_coefficients(heat_data_transform_1d_ptr const &heat_data_config);
 
+    void initialize_tables(double time);
+
+    void initialize_separable(heat_data_transform_1d_ptr const &heat_data_config);
+
   public:
     heat_coefficients() = delete;
 
+    /**
+        @brief heat_coefficients object constructor
+        @param heat_data_config - heat data
+        @param discretization_config - discretization
+        @param theta - implicit weight of the scheme
+        @param step_fraction - fraction of the time step the coefficients advance by (0.5 for Rannacher half-steps)
+    **/
     explicit heat_coefficients(heat_data_transform_1d_ptr const &heat_data_config,
-                               pde_discretization_config_1d_ptr const &discretization_config, double const &theta);
+                               pde_discretization_config_1d_ptr const &discretization_config, double const &theta,
+                               double const &step_fraction = 1.0);
+
+    /**
+        @brief  Resets the time step the coefficients advance by (used by non-uniform time grids)
+        @param  time_step - new time step
+    **/
+    void set_time_step(double time_step);
+
+    /**
+        @brief  Evaluates time factors of separable data once for given time
+        @param  time - time the coefficients are read at next
+    **/
+    void prepare_time_factors(double time);
+
+    inline double A(double time, double x, std::size_t idx) const
+    {
+        if (is_time_homogeneous_)
+            return A_table_[idx];
+        if (is_separable_)
+            return (lambda_ * separable_.value(0, time, idx) - gamma_ * separable_.value(1, time, idx));
+        return A_(time, x);
+    }
+
+    inline double B(double time, double x, std::size_t idx) const
+    {
+        if (is_time_homogeneous_)
+            return B_table_[idx];
+        if (is_separable_)
+            return (lambda_ * separable_.value(0, time, idx) - delta_ * separable_.value(2, time, idx));
+        return B_(time, x);
+    }
+
+    inline double D(double time, double x, std::size_t idx) const
+    {
+        if (is_time_homogeneous_)
+            return D_table_[idx];
+        if (is_separable_)
+            return (lambda_ * separable_.value(0, time, idx) + gamma_ * separable_.value(1, time, idx));
+        return D_(time, x);
+    }
 };
 
 using heat_coefficients_ptr = sptr_t<heat_coefficients>;
@@ -10,6 +10,10 @@ namespace lss_pde_solvers
 namespace one_dimensional
 {
 
+using lss_enumerations::solver_phase_enum;
+using lss_utility::make_thread_pool;
+using lss_utility::solver_stats;
+
 namespace implicit_solvers
 {
 
@@ -22,6 +26,8 @@ void heat_equation::initialize(heat_data_config_1d_ptr const &heat_data_cfg,
     LSS_VERIFY(std::get<1>(boundary_pair), "boundary_pair.second must not be null");
     LSS_VERIFY(solver_cfg_, "solver_config must not be null");
     LSS_VERIFY(grid_config_hints, "grid_config_hints must not be null");
+    LSS_ASSERT((solver_cfg_->adaptive_time_stepping() == nullptr) || (discretization_cfg_->time_grid() == nullptr),
+               "Adaptive time stepping cannot be combined with time grid");
     if (!solver_config_details_.empty())
     {
         auto const &it = solver_config_details_.find("sor_omega");
@@ -41,19 +47,29 @@ heat_equation::heat_equation(heat_data_config_1d_ptr const &heat_data_config,
                              pde_discretization_config_1d_ptr const &discretization_config,
                              boundary_1d_pair const &boundary_pair, grid_config_hints_1d_ptr const &grid_config_hints,
                              heat_implicit_solver_config_ptr const &solver_config,
-                             std::map<std::string, double> const &solver_config_details)
+                             std::map<std::string, double> const &solver_config_details,
+                             execution_policy_ptr const &execution_policy)
     : discretization_cfg_{discretization_config}, solver_cfg_{solver_config}, solver_config_details_{
                                                                                   solver_config_details}
 {
     initialize(heat_data_config, grid_config_hints, boundary_pair);
+    // SPIKE blocks run on the shared pool, or on a private one sized by the solver config:
+    thread_pool_ = make_thread_pool(execution_policy, solver_cfg_->number_of_threads());
+    stats_ = std::make_shared<solver_stats>();
 }
 
 heat_equation::~heat_equation()
 {
 }
 
+solver_stats_ptr const &heat_equation::stats() const
+{
+    return stats_;
+}
+
 void heat_equation::solve(container_t &solution)
 {
+    LSS_STATS_PHASE(stats_, solver_phase_enum::Total);
     LSS_ASSERT(solution.size() > 0, "The input solution container must be initialized");
     // size of space discretization:
     const std::size_t space_size = discretization_cfg_->number_of_space_points();
@@ -76,7 +92,8 @@ void heat_equation::solve(container_t &solution)
         {
             typedef heat_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::CUDASolver>
                 dev_cu_solver;
-            dev_cu_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
+            dev_cu_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg,
+                                 stats_);
             solver(prev_sol, is_heat_source_set, heat_source);
             std::copy(prev_sol.begin(), prev_sol.end(), solution.begin());
         }
@@ -87,7 +104,8 @@ void heat_equation::solve(container_t &solution)
             LSS_ASSERT(!solver_config_details_.empty(), "solver_config_details map must not be empty");
             double omega_value = solver_config_details_["sor_omega"];
 
-            dev_sor_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
+            dev_sor_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg,
+                                  stats_);
             solver(prev_sol, is_heat_source_set, heat_source, omega_value);
             std::copy(prev_sol.begin(), prev_sol.end(), solution.begin());
         }
@@ -103,7 +121,8 @@ void heat_equation::solve(container_t &solution)
             typedef heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::CUDASolver>
                 host_cu_solver;
 
-            host_cu_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
+            host_cu_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg,
+                                  stats_);
             solver(prev_sol, is_heat_source_set, heat_source);
             std::copy(prev_sol.begin(), prev_sol.end(), solution.begin());
         }
@@ -115,7 +134,8 @@ void heat_equation::solve(container_t &solution)
             LSS_ASSERT(!solver_config_details_.empty(), "solver_config_details map must not be empty");
             double omega_value = solver_config_details_["sor_omega"];
 
-            host_sor_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
+            host_sor_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg,
+                                   stats_);
             solver(prev_sol, is_heat_source_set, heat_source, omega_value);
             std::copy(prev_sol.begin(), prev_sol.end(), solution.begin());
         }
@@ -124,7 +144,8 @@ void heat_equation::solve(container_t &solution)
             typedef heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::DoubleSweepSolver>
                 host_dss_solver;
 
-            host_dss_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
+            host_dss_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg,
+                                   stats_);
             solver(prev_sol, is_heat_source_set, heat_source);
             std::copy(prev_sol.begin(), prev_sol.end(), solution.begin());
         }
@@ -133,7 +154,28 @@ void heat_equation::solve(container_t &solution)
             typedef heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::ThomasLUSolver>
                 host_lus_solver;
 
-            host_lus_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
+            host_lus_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg,
+                                   stats_);
+            solver(prev_sol, is_heat_source_set, heat_source);
+            std::copy(prev_sol.begin(), prev_sol.end(), solution.begin());
+        }
+        else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::SpikeSolver)
+        {
+            typedef heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::SpikeSolver>
+                host_spk_solver;
+
+            host_spk_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg,
+                                   thread_pool_, stats_);
+            solver(prev_sol, is_heat_source_set, heat_source);
+            std::copy(prev_sol.begin(), prev_sol.end(), solution.begin());
+        }
+        else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::KarawiaSolver)
+        {
+            typedef heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::KarawiaSolver>
+                host_kar_solver;
+
+            host_kar_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg,
+                                   stats_);
             solver(prev_sol, is_heat_source_set, heat_source);
             std::copy(prev_sol.begin(), prev_sol.end(), solution.begin());
         }
@@ -159,13 +201,27 @@ void heat_equation::solve(container_2d<by_enum::Row> &solutions)
     // This is the proper size of the container:
     LSS_ASSERT((solutions.rows() == time_size) && (solutions.columns() == space_size),
                "The input solution 2D container must have the correct size");
+    // every time slice is stored as a row:
+    auto const observer = std::make_shared<time_slice_observer_1d>(
+        [&](std::size_t time_idx, double time, container_t const &slice) { solutions.row(time_idx).copy_from(slice); });
+    container_t solution(space_size, double{});
+    solve(solution, observer);
+}
+
+void heat_equation::solve(container_t &solution, time_slice_observer_1d_ptr const &observer)
+{
+    LSS_STATS_PHASE(stats_, solver_phase_enum::Total);
+    LSS_VERIFY(observer, "observer must not be null");
+    LSS_ASSERT(solver_cfg_->adaptive_time_stepping() == nullptr,
+               "Adaptive time stepping supports only the final solution");
+    // size of space discretization:
+    const std::size_t space_size = discretization_cfg_->number_of_space_points();
+    LSS_ASSERT(solution.size() == space_size, "The input solution container must have the correct size");
     // grid:
     auto const &grid_cfg = std::make_shared<grid_config_1d>(discretization_cfg_);
     auto const &boundary_pair = boundary_->boundary_pair();
-    // create container to carry previous solution:
-    container_t prev_sol(space_size, double{});
     // discretize initial condition
-    d_1d::of_function(grid_cfg, heat_data_trans_cfg_->initial_condition(), prev_sol);
+    d_1d::of_function(grid_cfg, heat_data_trans_cfg_->initial_condition(), solution);
     // get heat_source:
     const bool is_heat_source_set = heat_data_trans_cfg_->is_heat_source_set();
     // get heat_source:
@@ -178,8 +234,9 @@ void heat_equation::solve(container_2d<by_enum::Row> &solutions)
             typedef heat_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::CUDASolver>
                 dev_cu_solver;
 
-            dev_cu_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol, is_heat_source_set, heat_source, solutions);
+            dev_cu_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg,
+                                 stats_);
+            solver(solution, is_heat_source_set, heat_source, *observer);
         }
         else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::SORSolver)
         {
@@ -188,8 +245,9 @@ void heat_equation::solve(container_2d<by_enum::Row> &solutions)
             LSS_ASSERT(!solver_config_details_.empty(), "solver_config_details map must not be empty");
             double omega_value = solver_config_details_["sor_omega"];
 
-            dev_sor_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol, is_heat_source_set, heat_source, omega_value, solutions);
+            dev_sor_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg,
+                                  stats_);
+            solver(solution, is_heat_source_set, heat_source, omega_value, *observer);
         }
         else
         {
@@ -203,8 +261,9 @@ void heat_equation::solve(container_2d<by_enum::Row> &solutions)
             typedef heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::CUDASolver>
                 host_cu_solver;
 
-            host_cu_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol, is_heat_source_set, heat_source, solutions);
+            host_cu_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg,
+                                  stats_);
+            solver(solution, is_heat_source_set, heat_source, *observer);
         }
         else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::SORSolver)
         {
@@ -213,22 +272,41 @@ void heat_equation::solve(container_2d<by_enum::Row> &solutions)
 
             LSS_ASSERT(!solver_config_details_.empty(), "solver_config_details map must not be empty");
             double omega_value = solver_config_details_["sor_omega"];
-            host_sor_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol, is_heat_source_set, heat_source, omega_value, solutions);
+            host_sor_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg,
+                                   stats_);
+            solver(solution, is_heat_source_set, heat_source, omega_value, *observer);
         }
         else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::DoubleSweepSolver)
         {
             typedef heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::DoubleSweepSolver>
                 host_dss_solver;
-            host_dss_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol, is_heat_source_set, heat_source, solutions);
+            host_dss_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg,
+                                   stats_);
+            solver(solution, is_heat_source_set, heat_source, *observer);
         }
         else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::ThomasLUSolver)
         {
             typedef heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::ThomasLUSolver>
                 host_lus_solver;
-            host_lus_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol, is_heat_source_set, heat_source, solutions);
+            host_lus_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg,
+                                   stats_);
+            solver(solution, is_heat_source_set, heat_source, *observer);
+        }
+        else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::SpikeSolver)
+        {
+            typedef heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::SpikeSolver>
+                host_spk_solver;
+            host_spk_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg,
+                                   thread_pool_, stats_);
+            solver(solution, is_heat_source_set, heat_source, *observer);
+        }
+        else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::KarawiaSolver)
+        {
+            typedef heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::KarawiaSolver>
+                host_kar_solver;
+            host_kar_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg,
+                                   stats_);
+            solver(solution, is_heat_source_set, heat_source, *observer);
         }
         else
         {
@@ -241,6 +319,107 @@ void heat_equation::solve(container_2d<by_enum::Row> &solutions)
     }
 }
 
+void heat_equation_batch::initialize(heat_data_config_1d_ptr const &heat_data_cfg,
+                                     grid_config_hints_1d_ptr const &grid_config_hints,
+                                     std::vector<std::function<double(double)>> const &initial_conditions,
+                                     boundary_1d_pairs const &boundary_pairs)
+{
+    LSS_VERIFY(heat_data_cfg, "heat_data_config must not be null");
+    LSS_VERIFY(discretization_cfg_, "discretization_config must not be null");
+    LSS_VERIFY(solver_cfg_, "solver_config must not be null");
+    LSS_VERIFY(grid_config_hints, "grid_config_hints must not be null");
+    LSS_ASSERT(initial_conditions.size() == boundary_pairs.size(),
+               "Each equation must have its initial condition and boundary pair");
+    LSS_ASSERT(solver_cfg_->adaptive_time_stepping() == nullptr, "Adaptive time stepping is not supported in batch");
+    if (!solver_config_details_.empty())
+    {
+        auto const &it = solver_config_details_.find("sor_omega");
+        LSS_ASSERT(it != solver_config_details_.end(), "sor_omega is not defined");
+    }
+
+    // make necessary transformations:
+    // create grid_transform_config:
+    grid_trans_cfg_ = std::make_shared<grid_transform_config_1d>(discretization_cfg_, grid_config_hints);
+    // transform original heat data:
+    heat_data_trans_cfg_ = std::make_shared<heat_data_transform_1d>(heat_data_cfg, grid_trans_cfg_);
+    // transform original initial conditions and boundaries:
+    initial_conditions_.reserve(initial_conditions.size());
+    boundary_pairs_.reserve(boundary_pairs.size());
+    auto const grid_trans_cfg = grid_trans_cfg_;
+    for (std::size_t i = 0; i < boundary_pairs.size(); ++i)
+    {
+        LSS_VERIFY(initial_conditions[i], "initial_condition must not be null");
+        LSS_VERIFY(std::get<0>(boundary_pairs[i]), "boundary_pair.first must not be null");
+        LSS_VERIFY(std::get<1>(boundary_pairs[i]), "boundary_pair.second must not be null");
+        LSS_ASSERT((boundary_pairs[i].first->kind() == boundary_pairs[0].first->kind()) &&
+                       (boundary_pairs[i].second->kind() == boundary_pairs[0].second->kind()),
+                   "All equations must share boundary types");
+        auto const init = initial_conditions[i];
+        initial_conditions_.emplace_back([=](double zeta) {
+            auto const x = grid_1d::transformed_value(grid_trans_cfg, zeta);
+            return init(x);
+        });
+        boundary_pairs_.emplace_back(boundary_transform_1d(boundary_pairs[i], grid_trans_cfg_).boundary_pair());
+    }
+}
+
+heat_equation_batch::heat_equation_batch(heat_data_config_1d_ptr const &heat_data_config,
+                                         pde_discretization_config_1d_ptr const &discretization_config,
+                                         std::vector<std::function<double(double)>> const &initial_conditions,
+                                         boundary_1d_pairs const &boundary_pairs,
+                                         grid_config_hints_1d_ptr const &grid_config_hints,
+                                         heat_implicit_solver_config_ptr const &solver_config,
+                                         std::map<std::string, double> const &solver_config_details,
+                                         execution_policy_ptr const &execution_policy)
+    : discretization_cfg_{discretization_config}, solver_cfg_{solver_config}, solver_config_details_{
+                                                                                  solver_config_details}
+{
+    initialize(heat_data_config, grid_config_hints, initial_conditions, boundary_pairs);
+    thread_pool_ = make_thread_pool(execution_policy, solver_cfg_->number_of_threads());
+    stats_ = std::make_shared<solver_stats>();
+}
+
+heat_equation_batch::~heat_equation_batch()
+{
+}
+
+solver_stats_ptr const &heat_equation_batch::stats() const
+{
+    return stats_;
+}
+
+void heat_equation_batch::solve(container_2d<by_enum::Row> &solutions)
+{
+    LSS_STATS_PHASE(stats_, solver_phase_enum::Total);
+    // size of space discretization:
+    const std::size_t space_size = discretization_cfg_->number_of_space_points();
+    // This is the proper size of the container:
+    LSS_ASSERT((solutions.rows() == boundary_pairs_.size()) && (solutions.columns() == space_size),
+               "The input solution 2D container must have the correct size");
+    auto const &grid_cfg = std::make_shared<grid_config_1d>(discretization_cfg_);
+    // discretize initial conditions:
+    container_t prev_sol(space_size, double{});
+    for (std::size_t i = 0; i < initial_conditions_.size(); ++i)
+    {
+        d_1d::of_function(grid_cfg, initial_conditions_[i], prev_sol);
+        solutions.row(i).copy_from(prev_sol);
+    }
+    // get heat_source:
+    const bool is_heat_source_set = heat_data_trans_cfg_->is_heat_source_set();
+    // get heat_source:
+    auto const &heat_source = heat_data_trans_cfg_->heat_source();
+    double omega_value{};
+    if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::SORSolver)
+    {
+        LSS_ASSERT(!solver_config_details_.empty(), "solver_config_details map must not be empty");
+        omega_value = solver_config_details_["sor_omega"];
+    }
+
+    heat_equation_implicit_batch_kernel solver(boundary_pairs_, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_,
+                                               grid_cfg, thread_pool_, stats_);
+    solver(solutions, is_heat_source_set, heat_source, omega_value);
+}
+
 } // namespace implicit_solvers
 
 namespace explicit_solvers
@@ -255,6 +434,8 @@ void heat_equation::initialize(heat_data_config_1d_ptr const &heat_data_cfg,
     LSS_VERIFY(std::get<1>(boundary_pair), "boundary_pair.second must not be null");
     LSS_VERIFY(grid_config_hints, "grid_config_hints must not be null");
     LSS_VERIFY(solver_cfg_, "solver_config must not be null");
+    LSS_ASSERT(discretization_cfg_->time_grid() == nullptr,
+               "Non-uniform time grid is supported by implicit solvers only");
 
     // make necessary transformations:
     // create grid_transform_config:
@@ -328,13 +509,24 @@ void heat_equation::solve(container_2d<by_enum::Row> &solutions)
     // This is the proper size of the container:
     LSS_ASSERT((solutions.rows() == time_size) && (solutions.columns() == space_size),
                "The input solution 2D container must have the correct size");
+    // every time slice is stored as a row:
+    auto const observer = std::make_shared<time_slice_observer_1d>(
+        [&](std::size_t time_idx, double time, container_t const &slice) { solutions.row(time_idx).copy_from(slice); });
+    container_t solution(space_size, double{});
+    solve(solution, observer);
+}
+
+void heat_equation::solve(container_t &solution, time_slice_observer_1d_ptr const &observer)
+{
+    LSS_VERIFY(observer, "observer must not be null");
+    // size of space discretization:
+    const std::size_t space_size = discretization_cfg_->number_of_space_points();
+    LSS_ASSERT(solution.size() == space_size, "The input solution container must have the correct size");
     // grid:
     auto const &grid_cfg = std::make_shared<grid_config_1d>(discretization_cfg_);
     auto const &boundary_pair = boundary_->boundary_pair();
-    // create container to carry previous solution:
-    container_t prev_sol(space_size, double{});
     // discretize initial condition
-    d_1d::of_function(grid_cfg, heat_data_trans_cfg_->initial_condition(), prev_sol);
+    d_1d::of_function(grid_cfg, heat_data_trans_cfg_->initial_condition(), solution);
     // get heat_source:
     const bool is_heat_source_set = heat_data_trans_cfg_->is_heat_source_set();
     // get heat_source:
@@ -344,13 +536,13 @@ void heat_equation::solve(container_2d<by_enum::Row> &solutions)
     {
         typedef heat_equation_explicit_kernel<memory_space_enum::Device> device_solver;
         device_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
-        solver(prev_sol, is_heat_source_set, heat_source, solutions);
+        solver(solution, is_heat_source_set, heat_source, *observer);
     }
     else if (solver_cfg_->memory_space() == memory_space_enum::Host)
     {
         typedef heat_equation_explicit_kernel<memory_space_enum::Host> host_solver;
         host_solver solver(boundary_pair, heat_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
-        solver(prev_sol, is_heat_source_set, heat_source, solutions);
+        solver(solution, is_heat_source_set, heat_source, *observer);
     }
     else
     {
@@ -3,10 +3,14 @@
 
 #include <functional>
 #include <map>
+#include <vector>
 
 #include "../../../boundaries/lss_boundary.hpp"
 #include "../../../common/lss_enumerations.hpp"
+#include "../../../common/lss_execution_policy.hpp"
 #include "../../../common/lss_macros.hpp"
+#include "../../../common/lss_solver_stats.hpp"
+#include "../../../common/lss_thread_pool.hpp"
 #include "../../../containers/lss_container_2d.hpp"
 #include "../../../discretization/lss_discretization.hpp"
 #include "../../../discretization/lss_grid.hpp"
@@ -17,6 +21,7 @@
 #include "../../lss_heat_data_config.hpp"
 #include "../../lss_heat_solver_config.hpp"
 #include "../../lss_pde_discretization_config.hpp"
+#include "../../lss_time_slice_observer.hpp"
 #include "../../transformation/lss_heat_data_transform.hpp"
 
 namespace lss_pde_solvers
@@ -25,6 +30,7 @@ namespace lss_pde_solvers
 namespace one_dimensional
 {
 using lss_boundary::boundary_1d_pair;
+using lss_boundary::boundary_1d_pairs;
 using lss_boundary::boundary_1d_ptr;
 using lss_containers::container_2d;
 using lss_enumerations::grid_enum;
@@ -35,6 +41,9 @@ using lss_grids::grid_transform_config_1d_ptr;
 using lss_transformation::boundary_transform_1d;
 using lss_transformation::boundary_transform_1d_ptr;
 using lss_utility::container_t;
+using lss_utility::execution_policy_ptr;
+using lss_utility::solver_stats_ptr;
+using lss_utility::thread_pool_ptr;
 
 using d_1d = discretization_1d<std::vector, std::allocator<double>>;
 
@@ -70,6 +79,8 @@ class heat_equation
     grid_transform_config_1d_ptr grid_trans_cfg_; // this may be removed as it is not used later
     heat_implicit_solver_config_ptr solver_cfg_;
     std::map<std::string, double> solver_config_details_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
     explicit heat_equation() = delete;
 
@@ -82,7 +93,8 @@ class heat_equation
         boundary_1d_pair const &boundary_pair, grid_config_hints_1d_ptr const &grid_config_hints,
         heat_implicit_solver_config_ptr const &solver_config =
             default_heat_solver_configs::host_fwd_dssolver_euler_solver_config_ptr,
-        std::map<std::string, double> const &solver_config_details = std::map<std::string, double>());
+        std::map<std::string, double> const &solver_config_details = std::map<std::string, double>(),
+        execution_policy_ptr const &execution_policy = nullptr);
 
     ~heat_equation();
 
@@ -104,6 +116,98 @@ class heat_equation
      * \param solutions - 2D container for all the solutions in time
      */
     LSS_API void solve(container_2d<by_enum::Row> &solutions);
+
+    /**
+     * Get the final solution of the PDE and stream the solutions in time
+     *
+     * \param solution - container for solution
+     * \param observer - receives the solutions in time that pass its decimation
+     */
+    LSS_API void solve(container_t &solution, time_slice_observer_1d_ptr const &observer);
+
+    /**
+     * Get statistics accumulated over all solves, they are recorded only when
+     * built with LSS_SOLVER_STATS and may be cleared with reset()
+     */
+    LSS_API solver_stats_ptr const &stats() const;
+};
+
+/*!
+============================================================================
+Represents batch of general variable coefficient 1D heat equations
+
+u_t = a(t,x)*u_xx + b(t,x)*u_x + c(t,x)*u + F(t,x),
+x_1 < x < x_2
+t_1 < t < t_2
+
+sharing discretization and coefficients, where i-th equation has its own
+initial (or terminal) condition f_i(x) and its own boundary pair. Boundary
+types must be the same for all equations.
+
+// ============================================================================
+*/
+class heat_equation_batch
+{
+
+  private:
+    heat_data_transform_1d_ptr heat_data_trans_cfg_;
+    pde_discretization_config_1d_ptr discretization_cfg_;
+    std::vector<std::function<double(double)>> initial_conditions_;
+    boundary_1d_pairs boundary_pairs_;
+    grid_transform_config_1d_ptr grid_trans_cfg_;
+    heat_implicit_solver_config_ptr solver_cfg_;
+    std::map<std::string, double> solver_config_details_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
+
+    explicit heat_equation_batch() = delete;
+
+    void initialize(heat_data_config_1d_ptr const &heat_data_cfg, grid_config_hints_1d_ptr const &grid_config_hints,
+                    std::vector<std::function<double(double)>> const &initial_conditions,
+                    boundary_1d_pairs const &boundary_pairs);
+
+  public:
+    /**
+        @brief  heat_equation_batch object constructor
+        @param  heat_data_config - coefficients and heat source shared by all equations, its initial condition is
+                not used
+        @param  discretization_config - discretization shared by all equations
+        @param  initial_conditions - initial condition of each equation
+        @param  boundary_pairs - boundary pair of each equation
+        @param  grid_config_hints - grid hints shared by all equations
+        @param  solver_config - solver configuration
+        @param  solver_config_details - solver configuration details
+        @param  execution_policy - workers the equations are split among, shared with other solvers (null means
+                a private pool sized by solver_config)
+    **/
+    explicit heat_equation_batch(
+        heat_data_config_1d_ptr const &heat_data_config, pde_discretization_config_1d_ptr const &discretization_config,
+        std::vector<std::function<double(double)>> const &initial_conditions, boundary_1d_pairs const &boundary_pairs,
+        grid_config_hints_1d_ptr const &grid_config_hints,
+        heat_implicit_solver_config_ptr const &solver_config =
+            default_heat_solver_configs::host_fwd_tlusolver_euler_solver_config_ptr,
+        std::map<std::string, double> const &solver_config_details = std::map<std::string, double>(),
+        execution_policy_ptr const &execution_policy = nullptr);
+
+    ~heat_equation_batch();
+
+    heat_equation_batch(heat_equation_batch const &) = delete;
+    heat_equation_batch(heat_equation_batch &&) = delete;
+    heat_equation_batch &operator=(heat_equation_batch const &) = delete;
+    heat_equation_batch &operator=(heat_equation_batch &&) = delete;
+
+    /**
+     * Get the final solutions of all PDEs
+     *
+     * \param solutions - 2D container with one row per equation
+     */
+    LSS_API void solve(container_2d<by_enum::Row> &solutions);
+
+    /**
+     * Get statistics accumulated over all solves of all equations, they are
+     * recorded only when built with LSS_SOLVER_STATS and may be cleared with reset()
+     */
+    LSS_API solver_stats_ptr const &stats() const;
 };
 
 } // namespace implicit_solvers
@@ -152,6 +256,14 @@ class heat_equation
      * \param solutions - 2D container for all the solutions in time
      */
     LSS_API void solve(container_2d<by_enum::Row> &solutions);
+
+    /**
+     * Get the final solution of the PDE and stream the solutions in time
+     *
+     * \param solution - container for solution
+     * \param observer - receives the solutions in time that pass its decimation
+     */
+    LSS_API void solve(container_t &solution, time_slice_observer_1d_ptr const &observer);
 };
 
 } // namespace explicit_solvers
@@ -49,7 +49,7 @@ void heat_equation_explicit_kernel<memory_space_enum::Device>::operator()(
 
 void heat_equation_explicit_kernel<memory_space_enum::Device>::operator()(
     container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source,
-    container_2d<by_enum::Row> &solutions)
+    time_slice_observer_1d const &observer)
 {
     // save traverse_direction
     const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
@@ -59,7 +59,7 @@ void heat_equation_explicit_kernel<memory_space_enum::Device>::operator()(
     if (solver_cfg_->explicit_pde_scheme() == explicit_pde_schemes_enum::Euler)
     {
         heat_euler_cuda_scheme euler_scheme(heat_coeff_holder, boundary_pair_, discretization_cfg_, grid_cfg_);
-        euler_scheme(solution, is_heat_sourse_set, heat_source, traverse_dir, solutions);
+        euler_scheme(solution, is_heat_sourse_set, heat_source, traverse_dir, observer);
     }
     else if (solver_cfg_->explicit_pde_scheme() == explicit_pde_schemes_enum::ADEBarakatClark)
     {
@@ -115,7 +115,7 @@ void heat_equation_explicit_kernel<memory_space_enum::Host>::operator()(
 
 void heat_equation_explicit_kernel<memory_space_enum::Host>::operator()(
     container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source,
-    container_2d<by_enum::Row> &solutions)
+    time_slice_observer_1d const &observer)
 {
     // save traverse_direction
     const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
@@ -125,17 +125,17 @@ void heat_equation_explicit_kernel<memory_space_enum::Host>::operator()(
     if (solver_cfg_->explicit_pde_scheme() == explicit_pde_schemes_enum::Euler)
     {
         heat_euler_scheme euler_scheme(heat_coeff_holder, boundary_pair_, discretization_cfg_, grid_cfg_);
-        euler_scheme(solution, is_heat_sourse_set, heat_source, traverse_dir, solutions);
+        euler_scheme(solution, is_heat_sourse_set, heat_source, traverse_dir, observer);
     }
     else if (solver_cfg_->explicit_pde_scheme() == explicit_pde_schemes_enum::ADEBarakatClark)
     {
         heat_barakat_clark_scheme bc_scheme(heat_coeff_holder, boundary_pair_, discretization_cfg_, grid_cfg_);
-        bc_scheme(solution, is_heat_sourse_set, heat_source, traverse_dir, solutions);
+        bc_scheme(solution, is_heat_sourse_set, heat_source, traverse_dir, observer);
     }
     else if (solver_cfg_->explicit_pde_scheme() == explicit_pde_schemes_enum::ADESaulyev)
     {
         heat_saulyev_scheme s_scheme(heat_coeff_holder, boundary_pair_, discretization_cfg_, grid_cfg_);
-        s_scheme(solution, is_heat_sourse_set, heat_source, traverse_dir, solutions);
+        s_scheme(solution, is_heat_sourse_set, heat_source, traverse_dir, observer);
     }
     else
     {
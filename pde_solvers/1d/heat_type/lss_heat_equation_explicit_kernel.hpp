@@ -11,6 +11,7 @@
 #include "../../../discretization/lss_grid_config.hpp"
 #include "../../lss_heat_solver_config.hpp"
 #include "../../lss_pde_discretization_config.hpp"
+#include "../../lss_time_slice_observer.hpp"
 #include "../../transformation/lss_heat_data_transform.hpp"
 
 namespace lss_pde_solvers
@@ -56,7 +57,7 @@ template <> class heat_equation_explicit_kernel<memory_space_enum::Device>
                     std::function<double(double, double)> const &heat_source);
 
     void operator()(container_t &solution, bool is_heat_sourse_set,
-                    std::function<double(double, double)> const &heat_source, container_2d<by_enum::Row> &solutions);
+                    std::function<double(double, double)> const &heat_source, time_slice_observer_1d const &observer);
 };
 
 // ===================================================================
@@ -83,7 +84,7 @@ template <> class heat_equation_explicit_kernel<memory_space_enum::Host>
                     std::function<double(double, double)> const &heat_source);
 
     void operator()(container_t &solution, bool is_heat_sourse_set,
-                    std::function<double(double, double)> const &heat_source, container_2d<by_enum::Row> &solutions);
+                    std::function<double(double, double)> const &heat_source, time_slice_observer_1d const &observer);
 };
 
 } // namespace one_dimensional
@@ -5,10 +5,12 @@
 #include "../../../common/lss_utility.hpp"
 #include "../../../containers/lss_container_2d.hpp"
 #include "../../../discretization/lss_grid_config.hpp"
+#include "../../../sparse_solvers/pentadiagonal/karawia_solver/lss_karawia_solver.hpp"
 #include "../../../sparse_solvers/tridiagonal/cuda_solver/lss_cuda_solver.hpp"
 #include "../../../sparse_solvers/tridiagonal/double_sweep_solver/lss_double_sweep_solver.hpp"
 #include "../../../sparse_solvers/tridiagonal/sor_solver/lss_sor_solver.hpp"
 #include "../../../sparse_solvers/tridiagonal/sor_solver_cuda/lss_sor_solver_cuda.hpp"
+#include "../../../sparse_solvers/tridiagonal/spike_solver/lss_spike_solver.hpp"
 #include "../../../sparse_solvers/tridiagonal/thomas_lu_solver/lss_thomas_lu_solver.hpp"
 #include "solver_method/lss_heat_implicit_solver_method.hpp"
 #include "time_loop/lss_implicit_time_loop.hpp"
@@ -18,98 +20,194 @@ namespace lss_pde_solvers
 namespace one_dimensional
 {
 
+using lss_boundary::boundary_enum;
 using lss_cuda_solver::cuda_solver;
+using lss_karawia_solver::karawia_solver;
+using lss_tridiagonal_solver::tridiagonal_batch;
+using lss_tridiagonal_solver::tridiagonal_solver_ptr;
 using lss_double_sweep_solver::double_sweep_solver;
 using lss_sor_solver::sor_solver;
 using lss_sor_solver_cuda::sor_solver_cuda;
+using lss_spike_solver::spike_solver;
 using lss_thomas_lu_solver::thomas_lu_solver;
+using lss_utility::solver_stats_ptr;
 
-heat_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::CUDASolver>::
-    heat_equation_implicit_kernel(boundary_1d_pair const &boundary_pair,
-                                  heat_data_transform_1d_ptr const &heat_data_config,
-                                  pde_discretization_config_1d_ptr const &discretization_config,
-                                  heat_implicit_solver_config_ptr const &solver_config,
-                                  grid_config_1d_ptr const &grid_config)
-    : boundary_pair_{boundary_pair}, heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+heat_implicit_kernel_loop::heat_implicit_kernel_loop(heat_implicit_solver_method_ptr const &solver_method,
+                                                     heat_implicit_solver_method_ptr const &startup_method,
+                                                     pde_discretization_config_1d_ptr const &discretization_config,
+                                                     heat_implicit_solver_config_ptr const &solver_config)
+    : solver_method_{solver_method}, startup_method_{startup_method}, discretization_cfg_{discretization_config},
+      solver_cfg_{solver_config}
 {
 }
 
-void heat_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::CUDASolver>::operator()(
-    container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source)
+heat_implicit_kernel_loop::heat_implicit_kernel_loop(tridiagonal_solver_ptr const &solver_ptr,
+                                                     heat_data_transform_1d_ptr const &heat_data_config,
+                                                     pde_discretization_config_1d_ptr const &discretization_config,
+                                                     heat_implicit_solver_config_ptr const &solver_config,
+                                                     grid_config_1d_ptr const &grid_config, bool is_heat_sourse_set,
+                                                     solver_stats_ptr const &stats,
+                                                     heat_coefficients_ptr const &coefficients)
+    : heat_implicit_kernel_loop(
+          std::make_shared<heat_implicit_solver_method>(
+              solver_ptr,
+              coefficients ? coefficients
+                           : std::make_shared<heat_coefficients>(heat_data_config, discretization_config,
+                                                                 solver_config->implicit_pde_scheme_value()),
+              grid_config, is_heat_sourse_set, stats),
+          heat_implicit_solver_method::rannacher_startup(solver_ptr, heat_data_config, discretization_config,
+                                                         grid_config, is_heat_sourse_set,
+                                                         solver_config->rannacher_steps(), stats),
+          discretization_config, solver_config)
+{
+}
+
+heat_implicit_kernel_loop::heat_implicit_kernel_loop(karawia_solver_ptr const &solver_ptr,
+                                                     heat_data_transform_1d_ptr const &heat_data_config,
+                                                     pde_discretization_config_1d_ptr const &discretization_config,
+                                                     heat_implicit_solver_config_ptr const &solver_config,
+                                                     grid_config_1d_ptr const &grid_config, bool is_heat_sourse_set,
+                                                     solver_stats_ptr const &stats)
+    : heat_implicit_kernel_loop(
+          std::make_shared<heat_implicit_solver_method>(
+              solver_ptr,
+              std::make_shared<heat_coefficients>(heat_data_config, discretization_config,
+                                                  solver_config->implicit_pde_scheme_value()),
+              grid_config, is_heat_sourse_set, stats),
+          heat_implicit_solver_method::rannacher_startup(solver_ptr, heat_data_config, discretization_config,
+                                                         grid_config, is_heat_sourse_set,
+                                                         solver_config->rannacher_steps(), stats),
+          discretization_config, solver_config)
+{
+}
+
+void heat_implicit_kernel_loop::run(boundary_1d_pair const &boundary_pair, bool is_heat_sourse_set,
+                                    std::function<double(double, double)> const &heat_source,
+                                    container_t &solution) const
 {
     // get time range:
     auto const &time = discretization_cfg_->time_range();
     // time step:
     const double k = discretization_cfg_->time_step();
-    // size of space discretization:
-    const std::size_t space_size = discretization_cfg_->number_of_space_points();
     // last time index:
     const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
     // save traverse_direction
     const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-    // create a heat coefficient holder:
-    auto const heat_coeff_holder = std::make_shared<heat_coefficients>(heat_data_cfg_, discretization_cfg_,
-                                                                       solver_cfg_->implicit_pde_scheme_value());
-    // create and set up the solver:
-    auto const &solver = std::make_shared<cuda_solver<memory_space_enum::Device>>(space_size);
-    solver->set_factorization(solver_cfg_->tridiagonal_factorization());
-    auto const &solver_method_ptr =
-        std::make_shared<heat_implicit_solver_method>(solver, heat_coeff_holder, grid_cfg_, is_heat_sourse_set);
+    const std::size_t startup_steps = solver_cfg_->rannacher_steps();
+    if (is_heat_sourse_set)
+    {
+        implicit_time_loop::run(solver_method_, boundary_pair, time, last_time_idx, k, traverse_dir, heat_source,
+                                solution, startup_method_, startup_steps, discretization_cfg_->time_grid(),
+                                solver_cfg_->adaptive_time_stepping());
+    }
+    else
+    {
+        implicit_time_loop::run(solver_method_, boundary_pair, time, last_time_idx, k, traverse_dir, solution,
+                                startup_method_, startup_steps, discretization_cfg_->time_grid(),
+                                solver_cfg_->adaptive_time_stepping());
+    }
+}
 
+void heat_implicit_kernel_loop::run(boundary_1d_pair const &boundary_pair, bool is_heat_sourse_set,
+                                    std::function<double(double, double)> const &heat_source, container_t &solution,
+                                    time_slice_observer_1d const &observer) const
+{
+    // get time range:
+    auto const &time = discretization_cfg_->time_range();
+    // time step:
+    const double k = discretization_cfg_->time_step();
+    // last time index:
+    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
+    // save traverse_direction
+    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
+    const std::size_t startup_steps = solver_cfg_->rannacher_steps();
     if (is_heat_sourse_set)
     {
-        implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir, heat_source,
-                                solution);
+        implicit_time_loop::run_with_stepping(solver_method_, boundary_pair, time, last_time_idx, k, traverse_dir,
+                                              heat_source, solution, observer, startup_method_, startup_steps,
+                                              discretization_cfg_->time_grid());
     }
     else
     {
-        implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir, solution);
+        implicit_time_loop::run_with_stepping(solver_method_, boundary_pair, time, last_time_idx, k, traverse_dir,
+                                              solution, observer, startup_method_, startup_steps,
+                                              discretization_cfg_->time_grid());
     }
 }
 
-void heat_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::CUDASolver>::operator()(
-    container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source,
-    container_2d<by_enum::Row> &solutions)
+void heat_implicit_kernel_loop::run(boundary_1d_pairs const &boundary_pairs, bool is_heat_sourse_set,
+                                    std::function<double(double, double)> const &heat_source,
+                                    tridiagonal_batch &batch) const
 {
     // get time range:
     auto const &time = discretization_cfg_->time_range();
     // time step:
     const double k = discretization_cfg_->time_step();
-    // size of space discretization:
-    const std::size_t space_size = discretization_cfg_->number_of_space_points();
     // last time index:
     const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
     // save traverse_direction
     const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-    // create a heat coefficient holder:
-    auto const heat_coeff_holder = std::make_shared<heat_coefficients>(heat_data_cfg_, discretization_cfg_,
-                                                                       solver_cfg_->implicit_pde_scheme_value());
-    // create and set up the solver:
-    auto const &solver = std::make_shared<cuda_solver<memory_space_enum::Device>>(space_size);
-    solver->set_factorization(solver_cfg_->tridiagonal_factorization());
-    auto const &solver_method_ptr =
-        std::make_shared<heat_implicit_solver_method>(solver, heat_coeff_holder, grid_cfg_, is_heat_sourse_set);
+    const std::size_t startup_steps = solver_cfg_->rannacher_steps();
     if (is_heat_sourse_set)
     {
-        implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                              heat_source, solution, solutions);
+        implicit_time_loop::run(solver_method_, boundary_pairs, time, last_time_idx, k, traverse_dir, heat_source,
+                                batch, startup_method_, startup_steps, discretization_cfg_->time_grid());
     }
     else
     {
-        implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                              solution, solutions);
+        implicit_time_loop::run(solver_method_, boundary_pairs, time, last_time_idx, k, traverse_dir, batch,
+                                startup_method_, startup_steps, discretization_cfg_->time_grid());
     }
 }
 
+heat_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::CUDASolver>::
+    heat_equation_implicit_kernel(boundary_1d_pair const &boundary_pair,
+                                  heat_data_transform_1d_ptr const &heat_data_config,
+                                  pde_discretization_config_1d_ptr const &discretization_config,
+                                  heat_implicit_solver_config_ptr const &solver_config,
+                                  grid_config_1d_ptr const &grid_config, solver_stats_ptr const &stats)
+    : boundary_pair_{boundary_pair}, heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config},
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, stats_{stats}
+{
+}
+
+void heat_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::CUDASolver>::operator()(
+    container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source)
+{
+    // size of space discretization:
+    const std::size_t space_size = discretization_cfg_->number_of_space_points();
+    // create and set up the solver:
+    auto const &solver = std::make_shared<cuda_solver<memory_space_enum::Device>>(space_size);
+    solver->set_factorization(solver_cfg_->tridiagonal_factorization());
+    // main solver method and Rannacher start-up share the solver:
+    const heat_implicit_kernel_loop kernel_loop(solver, heat_data_cfg_, discretization_cfg_, solver_cfg_, grid_cfg_,
+                                                is_heat_sourse_set, stats_);
+    kernel_loop.run(boundary_pair_, is_heat_sourse_set, heat_source, solution);
+}
+
+void heat_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::CUDASolver>::operator()(
+    container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source,
+    time_slice_observer_1d const &observer)
+{
+    // size of space discretization:
+    const std::size_t space_size = discretization_cfg_->number_of_space_points();
+    // create and set up the solver:
+    auto const &solver = std::make_shared<cuda_solver<memory_space_enum::Device>>(space_size);
+    solver->set_factorization(solver_cfg_->tridiagonal_factorization());
+    // main solver method and Rannacher start-up share the solver:
+    const heat_implicit_kernel_loop kernel_loop(solver, heat_data_cfg_, discretization_cfg_, solver_cfg_, grid_cfg_,
+                                                is_heat_sourse_set, stats_);
+    kernel_loop.run(boundary_pair_, is_heat_sourse_set, heat_source, solution, observer);
+}
+
 heat_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::SORSolver>::
     heat_equation_implicit_kernel(boundary_1d_pair const &boundary_pair,
                                   heat_data_transform_1d_ptr const &heat_data_config,
                                   pde_discretization_config_1d_ptr const &discretization_config,
                                   heat_implicit_solver_config_ptr const &solver_config,
-                                  grid_config_1d_ptr const &grid_config)
+                                  grid_config_1d_ptr const &grid_config, solver_stats_ptr const &stats)
     : boundary_pair_{boundary_pair}, heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, stats_{stats}
 {
 }
 
@@ -117,67 +215,30 @@ void heat_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method
     container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source,
     double omega_value)
 {
-    // get time range:
-    auto const &time = discretization_cfg_->time_range();
-    // time step:
-    const double k = discretization_cfg_->time_step();
     // size of space discretization:
     const std::size_t space_size = discretization_cfg_->number_of_space_points();
-    // last time index:
-    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
-    // save traverse_direction
-    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-    // create a heat coefficient holder:
-    auto const heat_coeff_holder = std::make_shared<heat_coefficients>(heat_data_cfg_, discretization_cfg_,
-                                                                       solver_cfg_->implicit_pde_scheme_value());
     // create and set up the solver:
     auto const &solver = std::make_shared<sor_solver_cuda>(space_size);
     solver->set_omega(omega_value);
-    auto const &solver_method_ptr =
-        std::make_shared<heat_implicit_solver_method>(solver, heat_coeff_holder, grid_cfg_, is_heat_sourse_set);
-    if (is_heat_sourse_set)
-    {
-        implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir, heat_source,
-                                solution);
-    }
-    else
-    {
-        implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir, solution);
-    }
+    // main solver method and Rannacher start-up share the solver:
+    const heat_implicit_kernel_loop kernel_loop(solver, heat_data_cfg_, discretization_cfg_, solver_cfg_, grid_cfg_,
+                                                is_heat_sourse_set, stats_);
+    kernel_loop.run(boundary_pair_, is_heat_sourse_set, heat_source, solution);
 }
 
 void heat_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::SORSolver>::operator()(
     container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source,
-    double omega_value, container_2d<by_enum::Row> &solutions)
+    double omega_value, time_slice_observer_1d const &observer)
 {
-    // get time range:
-    auto const &time = discretization_cfg_->time_range();
-    // time step:
-    const double k = discretization_cfg_->time_step();
     // size of space discretization:
     const std::size_t space_size = discretization_cfg_->number_of_space_points();
-    // last time index:
-    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
-    // save traverse_direction
-    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-    // create a heat coefficient holder:
-    auto const heat_coeff_holder = std::make_shared<heat_coefficients>(heat_data_cfg_, discretization_cfg_,
-                                                                       solver_cfg_->implicit_pde_scheme_value());
     // create and set up the solver:
     auto const &solver = std::make_shared<sor_solver_cuda>(space_size);
     solver->set_omega(omega_value);
-    auto const &solver_method_ptr =
-        std::make_shared<heat_implicit_solver_method>(solver, heat_coeff_holder, grid_cfg_, is_heat_sourse_set);
-    if (is_heat_sourse_set)
-    {
-        implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                              heat_source, solution, solutions);
-    }
-    else
-    {
-        implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                              solution, solutions);
-    }
+    // main solver method and Rannacher start-up share the solver:
+    const heat_implicit_kernel_loop kernel_loop(solver, heat_data_cfg_, discretization_cfg_, solver_cfg_, grid_cfg_,
+                                                is_heat_sourse_set, stats_);
+    kernel_loop.run(boundary_pair_, is_heat_sourse_set, heat_source, solution, observer);
 }
 
 heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::CUDASolver>::
@@ -185,76 +246,39 @@ heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::
                                   heat_data_transform_1d_ptr const &heat_data_config,
                                   pde_discretization_config_1d_ptr const &discretization_config,
                                   heat_implicit_solver_config_ptr const &solver_config,
-                                  grid_config_1d_ptr const &grid_config)
+                                  grid_config_1d_ptr const &grid_config, solver_stats_ptr const &stats)
     : boundary_pair_{boundary_pair}, heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, stats_{stats}
 {
 }
 
 void heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::CUDASolver>::operator()(
     container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source)
 {
-    // get time range:
-    auto const &time = discretization_cfg_->time_range();
-    // time step:
-    const double k = discretization_cfg_->time_step();
     // size of space discretization:
     const std::size_t space_size = discretization_cfg_->number_of_space_points();
-    // last time index:
-    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
-    // save traverse_direction
-    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-    // create a heat coefficient holder:
-    auto const heat_coeff_holder = std::make_shared<heat_coefficients>(heat_data_cfg_, discretization_cfg_,
-                                                                       solver_cfg_->implicit_pde_scheme_value());
     // create and set up the solver:
     auto const &solver = std::make_shared<cuda_solver<memory_space_enum::Host>>(space_size);
     solver->set_factorization(solver_cfg_->tridiagonal_factorization());
-    auto const &solver_method_ptr =
-        std::make_shared<heat_implicit_solver_method>(solver, heat_coeff_holder, grid_cfg_, is_heat_sourse_set);
-    if (is_heat_sourse_set)
-    {
-        implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir, heat_source,
-                                solution);
-    }
-    else
-    {
-        implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir, solution);
-    }
+    // main solver method and Rannacher start-up share the solver:
+    const heat_implicit_kernel_loop kernel_loop(solver, heat_data_cfg_, discretization_cfg_, solver_cfg_, grid_cfg_,
+                                                is_heat_sourse_set, stats_);
+    kernel_loop.run(boundary_pair_, is_heat_sourse_set, heat_source, solution);
 }
 
 void heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::CUDASolver>::operator()(
     container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source,
-    container_2d<by_enum::Row> &solutions)
+    time_slice_observer_1d const &observer)
 {
-    // get time range:
-    auto const &time = discretization_cfg_->time_range();
-    // time step:
-    const double k = discretization_cfg_->time_step();
     // size of space discretization:
     const std::size_t space_size = discretization_cfg_->number_of_space_points();
-    // last time index:
-    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
-    // save traverse_direction
-    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-    // create a heat coefficient holder:
-    auto const heat_coeff_holder = std::make_shared<heat_coefficients>(heat_data_cfg_, discretization_cfg_,
-                                                                       solver_cfg_->implicit_pde_scheme_value());
     // create and set up the solver:
     auto const &solver = std::make_shared<cuda_solver<memory_space_enum::Host>>(space_size);
     solver->set_factorization(solver_cfg_->tridiagonal_factorization());
-    auto const &solver_method_ptr =
-        std::make_shared<heat_implicit_solver_method>(solver, heat_coeff_holder, grid_cfg_, is_heat_sourse_set);
-    if (is_heat_sourse_set)
-    {
-        implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                              heat_source, solution, solutions);
-    }
-    else
-    {
-        implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                              solution, solutions);
-    }
+    // main solver method and Rannacher start-up share the solver:
+    const heat_implicit_kernel_loop kernel_loop(solver, heat_data_cfg_, discretization_cfg_, solver_cfg_, grid_cfg_,
+                                                is_heat_sourse_set, stats_);
+    kernel_loop.run(boundary_pair_, is_heat_sourse_set, heat_source, solution, observer);
 }
 
 heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::SORSolver>::
@@ -262,9 +286,9 @@ heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::
                                   heat_data_transform_1d_ptr const &heat_data_config,
                                   pde_discretization_config_1d_ptr const &discretization_config,
                                   heat_implicit_solver_config_ptr const &solver_config,
-                                  grid_config_1d_ptr const &grid_config)
+                                  grid_config_1d_ptr const &grid_config, solver_stats_ptr const &stats)
     : boundary_pair_{boundary_pair}, heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, stats_{stats}
 {
 }
 
@@ -272,68 +296,30 @@ void heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_e
     container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source,
     double omega_value)
 {
-    // get time range:
-    auto const &time = discretization_cfg_->time_range();
-    // time step:
-    const double k = discretization_cfg_->time_step();
     // size of space discretization:
     const std::size_t space_size = discretization_cfg_->number_of_space_points();
-    // last time index:
-    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
-    // save traverse_direction
-    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-
-    // create a heat coefficient holder:
-    auto const heat_coeff_holder = std::make_shared<heat_coefficients>(heat_data_cfg_, discretization_cfg_,
-                                                                       solver_cfg_->implicit_pde_scheme_value());
     // create and set up the solver:
     auto const &solver = std::make_shared<sor_solver>(space_size);
     solver->set_omega(omega_value);
-    auto const &solver_method_ptr =
-        std::make_shared<heat_implicit_solver_method>(solver, heat_coeff_holder, grid_cfg_, is_heat_sourse_set);
-    if (is_heat_sourse_set)
-    {
-        implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir, heat_source,
-                                solution);
-    }
-    else
-    {
-        implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir, solution);
-    }
+    // main solver method and Rannacher start-up share the solver:
+    const heat_implicit_kernel_loop kernel_loop(solver, heat_data_cfg_, discretization_cfg_, solver_cfg_, grid_cfg_,
+                                                is_heat_sourse_set, stats_);
+    kernel_loop.run(boundary_pair_, is_heat_sourse_set, heat_source, solution);
 }
 
 void heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::SORSolver>::operator()(
     container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source,
-    double omega_value, container_2d<by_enum::Row> &solutions)
+    double omega_value, time_slice_observer_1d const &observer)
 {
-    // get time range:
-    auto const &time = discretization_cfg_->time_range();
-    // time step:
-    const double k = discretization_cfg_->time_step();
     // size of space discretization:
     const std::size_t space_size = discretization_cfg_->number_of_space_points();
-    // last time index:
-    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
-    // save traverse_direction
-    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-    // create a heat coefficient holder:
-    auto const heat_coeff_holder = std::make_shared<heat_coefficients>(heat_data_cfg_, discretization_cfg_,
-                                                                       solver_cfg_->implicit_pde_scheme_value());
     // create and set up the solver:
     auto const &solver = std::make_shared<sor_solver>(space_size);
     solver->set_omega(omega_value);
-    auto const &solver_method_ptr =
-        std::make_shared<heat_implicit_solver_method>(solver, heat_coeff_holder, grid_cfg_, is_heat_sourse_set);
-    if (is_heat_sourse_set)
-    {
-        implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                              heat_source, solution, solutions);
-    }
-    else
-    {
-        implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                              solution, solutions);
-    }
+    // main solver method and Rannacher start-up share the solver:
+    const heat_implicit_kernel_loop kernel_loop(solver, heat_data_cfg_, discretization_cfg_, solver_cfg_, grid_cfg_,
+                                                is_heat_sourse_set, stats_);
+    kernel_loop.run(boundary_pair_, is_heat_sourse_set, heat_source, solution, observer);
 }
 
 heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::DoubleSweepSolver>::
@@ -341,76 +327,37 @@ heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::
                                   heat_data_transform_1d_ptr const &heat_data_config,
                                   pde_discretization_config_1d_ptr const &discretization_config,
                                   heat_implicit_solver_config_ptr const &solver_config,
-                                  grid_config_1d_ptr const &grid_config)
+                                  grid_config_1d_ptr const &grid_config, solver_stats_ptr const &stats)
     : boundary_pair_{boundary_pair}, heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, stats_{stats}
 {
 }
 
 void heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::DoubleSweepSolver>::operator()(
     container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source)
 {
-    // get time range:
-    auto const &time = discretization_cfg_->time_range();
-    // time step:
-    const double k = discretization_cfg_->time_step();
     // size of space discretization:
     const std::size_t space_size = discretization_cfg_->number_of_space_points();
-    // last time index:
-    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
-    // save traverse_direction
-    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-    // create a heat coefficient holder:
-    auto const heat_coeff_holder = std::make_shared<heat_coefficients>(heat_data_cfg_, discretization_cfg_,
-                                                                       solver_cfg_->implicit_pde_scheme_value());
     // create and set up the solver:
     auto const &solver = std::make_shared<double_sweep_solver>(space_size);
-    auto const &solver_method_ptr =
-        std::make_shared<heat_implicit_solver_method>(solver, heat_coeff_holder, grid_cfg_, is_heat_sourse_set);
-
-    if (is_heat_sourse_set)
-    {
-        implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir, heat_source,
-                                solution);
-    }
-    else
-    {
-        implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir, solution);
-    }
+    // main solver method and Rannacher start-up share the solver:
+    const heat_implicit_kernel_loop kernel_loop(solver, heat_data_cfg_, discretization_cfg_, solver_cfg_, grid_cfg_,
+                                                is_heat_sourse_set, stats_);
+    kernel_loop.run(boundary_pair_, is_heat_sourse_set, heat_source, solution);
 }
 
 void heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::DoubleSweepSolver>::operator()(
     container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source,
-    container_2d<by_enum::Row> &solutions)
+    time_slice_observer_1d const &observer)
 {
-    // get time range:
-    auto const &time = discretization_cfg_->time_range();
-    // time step:
-    const double k = discretization_cfg_->time_step();
     // size of space discretization:
     const std::size_t space_size = discretization_cfg_->number_of_space_points();
-    // last time index:
-    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
-    // save traverse_direction
-    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-    // create a heat coefficient holder:
-    auto const heat_coeff_holder = std::make_shared<heat_coefficients>(heat_data_cfg_, discretization_cfg_,
-                                                                       solver_cfg_->implicit_pde_scheme_value());
     // create and set up the solver:
     auto const &solver = std::make_shared<double_sweep_solver>(space_size);
-    auto const &solver_method_ptr =
-        std::make_shared<heat_implicit_solver_method>(solver, heat_coeff_holder, grid_cfg_, is_heat_sourse_set);
-
-    if (is_heat_sourse_set)
-    {
-        implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                              heat_source, solution, solutions);
-    }
-    else
-    {
-        implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                              solution, solutions);
-    }
+    // main solver method and Rannacher start-up share the solver:
+    const heat_implicit_kernel_loop kernel_loop(solver, heat_data_cfg_, discretization_cfg_, solver_cfg_, grid_cfg_,
+                                                is_heat_sourse_set, stats_);
+    kernel_loop.run(boundary_pair_, is_heat_sourse_set, heat_source, solution, observer);
 }
 
 heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::ThomasLUSolver>::
@@ -418,76 +365,217 @@ heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::
                                   heat_data_transform_1d_ptr const &heat_data_config,
                                   pde_discretization_config_1d_ptr const &discretization_config,
                                   heat_implicit_solver_config_ptr const &solver_config,
-                                  grid_config_1d_ptr const &grid_config)
+                                  grid_config_1d_ptr const &grid_config, solver_stats_ptr const &stats)
     : boundary_pair_{boundary_pair}, heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, stats_{stats}
 {
 }
 
 void heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::ThomasLUSolver>::operator()(
     container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source)
 {
-    // get time range:
-    auto const &time = discretization_cfg_->time_range();
-    // time step:
-    const double k = discretization_cfg_->time_step();
     // size of space discretization:
     const std::size_t space_size = discretization_cfg_->number_of_space_points();
-    // last time index:
-    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
-    // save traverse_direction
-    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-    // create a heat coefficient holder:
-    auto const heat_coeff_holder = std::make_shared<heat_coefficients>(heat_data_cfg_, discretization_cfg_,
-                                                                       solver_cfg_->implicit_pde_scheme_value());
     // create and set up the solver:
     auto const &solver = std::make_shared<thomas_lu_solver>(space_size);
-    auto const &solver_method_ptr =
-        std::make_shared<heat_implicit_solver_method>(solver, heat_coeff_holder, grid_cfg_, is_heat_sourse_set);
-
-    if (is_heat_sourse_set)
-    {
-        implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir, heat_source,
-                                solution);
-    }
-    else
-    {
-        implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir, solution);
-    }
+    // main solver method and Rannacher start-up share the solver:
+    const heat_implicit_kernel_loop kernel_loop(solver, heat_data_cfg_, discretization_cfg_, solver_cfg_, grid_cfg_,
+                                                is_heat_sourse_set, stats_);
+    kernel_loop.run(boundary_pair_, is_heat_sourse_set, heat_source, solution);
 }
 
 void heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::ThomasLUSolver>::operator()(
     container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source,
-    container_2d<by_enum::Row> &solutions)
+    time_slice_observer_1d const &observer)
 {
-    // get time range:
-    auto const &time = discretization_cfg_->time_range();
-    // time step:
-    const double k = discretization_cfg_->time_step();
     // size of space discretization:
     const std::size_t space_size = discretization_cfg_->number_of_space_points();
-    // last time index:
-    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
-    // save traverse_direction
-    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-    // create a heat coefficient holder:
-    auto const heat_coeff_holder = std::make_shared<heat_coefficients>(heat_data_cfg_, discretization_cfg_,
-                                                                       solver_cfg_->implicit_pde_scheme_value());
     // create and set up the solver:
     auto const &solver = std::make_shared<thomas_lu_solver>(space_size);
-    auto const &solver_method_ptr =
-        std::make_shared<heat_implicit_solver_method>(solver, heat_coeff_holder, grid_cfg_, is_heat_sourse_set);
+    // main solver method and Rannacher start-up share the solver:
+    const heat_implicit_kernel_loop kernel_loop(solver, heat_data_cfg_, discretization_cfg_, solver_cfg_, grid_cfg_,
+                                                is_heat_sourse_set, stats_);
+    kernel_loop.run(boundary_pair_, is_heat_sourse_set, heat_source, solution, observer);
+}
 
-    if (is_heat_sourse_set)
+heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::SpikeSolver>::
+    heat_equation_implicit_kernel(boundary_1d_pair const &boundary_pair,
+                                  heat_data_transform_1d_ptr const &heat_data_config,
+                                  pde_discretization_config_1d_ptr const &discretization_config,
+                                  heat_implicit_solver_config_ptr const &solver_config,
+                                  grid_config_1d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                  solver_stats_ptr const &stats)
+    : boundary_pair_{boundary_pair}, heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config},
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, thread_pool_{thread_pool}, stats_{stats}
+{
+}
+
+void heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::SpikeSolver>::operator()(
+    container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source)
+{
+    // size of space discretization:
+    const std::size_t space_size = discretization_cfg_->number_of_space_points();
+    // create and set up the solver:
+    auto const &solver = std::make_shared<spike_solver>(space_size, thread_pool_);
+    // main solver method and Rannacher start-up share the solver:
+    const heat_implicit_kernel_loop kernel_loop(solver, heat_data_cfg_, discretization_cfg_, solver_cfg_, grid_cfg_,
+                                                is_heat_sourse_set, stats_);
+    kernel_loop.run(boundary_pair_, is_heat_sourse_set, heat_source, solution);
+}
+
+void heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::SpikeSolver>::operator()(
+    container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source,
+    time_slice_observer_1d const &observer)
+{
+    // size of space discretization:
+    const std::size_t space_size = discretization_cfg_->number_of_space_points();
+    // create and set up the solver:
+    auto const &solver = std::make_shared<spike_solver>(space_size, thread_pool_);
+    // main solver method and Rannacher start-up share the solver:
+    const heat_implicit_kernel_loop kernel_loop(solver, heat_data_cfg_, discretization_cfg_, solver_cfg_, grid_cfg_,
+                                                is_heat_sourse_set, stats_);
+    kernel_loop.run(boundary_pair_, is_heat_sourse_set, heat_source, solution, observer);
+}
+
+heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::KarawiaSolver>::
+    heat_equation_implicit_kernel(boundary_1d_pair const &boundary_pair,
+                                  heat_data_transform_1d_ptr const &heat_data_config,
+                                  pde_discretization_config_1d_ptr const &discretization_config,
+                                  heat_implicit_solver_config_ptr const &solver_config,
+                                  grid_config_1d_ptr const &grid_config, solver_stats_ptr const &stats)
+    : boundary_pair_{boundary_pair}, heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config},
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, stats_{stats}
+{
+    LSS_VERIFY((boundary_pair_.first->kind() == boundary_enum::Dirichlet) &&
+                   (boundary_pair_.second->kind() == boundary_enum::Dirichlet),
+               "Karawia Solver supports Dirichlet boundaries only");
+}
+
+void heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::KarawiaSolver>::operator()(
+    container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source)
+{
+    // size of space discretization:
+    const std::size_t space_size = discretization_cfg_->number_of_space_points();
+    // create and set up the solver:
+    auto const &solver = std::make_shared<karawia_solver>(space_size);
+    // main solver method and Rannacher start-up share the solver:
+    const heat_implicit_kernel_loop kernel_loop(solver, heat_data_cfg_, discretization_cfg_, solver_cfg_, grid_cfg_,
+                                                is_heat_sourse_set, stats_);
+    kernel_loop.run(boundary_pair_, is_heat_sourse_set, heat_source, solution);
+}
+
+void heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::KarawiaSolver>::operator()(
+    container_t &solution, bool is_heat_sourse_set, std::function<double(double, double)> const &heat_source,
+    time_slice_observer_1d const &observer)
+{
+    // size of space discretization:
+    const std::size_t space_size = discretization_cfg_->number_of_space_points();
+    // create and set up the solver:
+    auto const &solver = std::make_shared<karawia_solver>(space_size);
+    // main solver method and Rannacher start-up share the solver:
+    const heat_implicit_kernel_loop kernel_loop(solver, heat_data_cfg_, discretization_cfg_, solver_cfg_, grid_cfg_,
+                                                is_heat_sourse_set, stats_);
+    kernel_loop.run(boundary_pair_, is_heat_sourse_set, heat_source, solution, observer);
+}
+
+heat_equation_implicit_batch_kernel::heat_equation_implicit_batch_kernel(
+    boundary_1d_pairs const &boundary_pairs, heat_data_transform_1d_ptr const &heat_data_config,
+    pde_discretization_config_1d_ptr const &discretization_config, heat_implicit_solver_config_ptr const &solver_config,
+    grid_config_1d_ptr const &grid_config, thread_pool_ptr const &thread_pool, solver_stats_ptr const &stats)
+    : boundary_pairs_{boundary_pairs}, heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config},
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, thread_pool_{thread_pool}, stats_{stats}
+{
+}
+
+tridiagonal_solver_ptr heat_equation_implicit_batch_kernel::create_solver(std::size_t space_size,
+                                                                          double omega_value) const
+{
+    if (solver_cfg_->memory_space() == memory_space_enum::Device)
     {
-        implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                              heat_source, solution, solutions);
+        if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::CUDASolver)
+        {
+            auto const &solver = std::make_shared<cuda_solver<memory_space_enum::Device>>(space_size);
+            solver->set_factorization(solver_cfg_->tridiagonal_factorization());
+            return solver;
+        }
+        else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::SORSolver)
+        {
+            auto const &solver = std::make_shared<sor_solver_cuda>(space_size);
+            solver->set_omega(omega_value);
+            return solver;
+        }
+        throw std::exception("Not supported on Device");
     }
-    else
+    else if (solver_cfg_->memory_space() == memory_space_enum::Host)
     {
-        implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                              solution, solutions);
+        if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::CUDASolver)
+        {
+            auto const &solver = std::make_shared<cuda_solver<memory_space_enum::Host>>(space_size);
+            solver->set_factorization(solver_cfg_->tridiagonal_factorization());
+            return solver;
+        }
+        else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::SORSolver)
+        {
+            auto const &solver = std::make_shared<sor_solver>(space_size);
+            solver->set_omega(omega_value);
+            return solver;
+        }
+        else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::DoubleSweepSolver)
+        {
+            return std::make_shared<double_sweep_solver>(space_size);
+        }
+        else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::ThomasLUSolver)
+        {
+            return std::make_shared<thomas_lu_solver>(space_size);
+        }
+        else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::SpikeSolver)
+        {
+            // problems are already spread over the workers, so each system is solved serially:
+            return std::make_shared<spike_solver>(space_size);
+        }
+        throw std::exception("Not supported on Host");
     }
+    throw std::exception("Unreachable");
+}
+
+void heat_equation_implicit_batch_kernel::operator()(container_2d<by_enum::Row> &solutions, bool is_heat_sourse_set,
+                                                     std::function<double(double, double)> const &heat_source,
+                                                     double omega_value)
+{
+    // size of space discretization:
+    const std::size_t space_size = discretization_cfg_->number_of_space_points();
+    // one heat coefficient holder is shared by all problems:
+    auto const heat_coeff_holder = std::make_shared<heat_coefficients>(heat_data_cfg_, discretization_cfg_,
+                                                                       solver_cfg_->implicit_pde_scheme_value());
+    const std::size_t problems = solutions.rows();
+    const std::size_t workers = thread_pool_->size();
+    thread_pool_->parallel_for(0, workers, [&](std::size_t worker_idx, std::size_t w) {
+        // worker w takes the contiguous chunk [problems*w/workers, problems*(w+1)/workers):
+        const std::size_t begin = (problems * w) / workers;
+        const std::size_t end = (problems * (w + 1)) / workers;
+        if (begin == end)
+            return;
+        const boundary_1d_pairs boundary_pairs(boundary_pairs_.begin() + begin, boundary_pairs_.begin() + end);
+        tridiagonal_batch batch(space_size, end - begin);
+        for (std::size_t s = 0; s < batch.systems_count(); ++s)
+        {
+            batch.solution(s).copy_from(solutions.row(begin + s));
+        }
+        // each worker owns its solver and solver methods:
+        auto const &solver = create_solver(space_size, omega_value);
+        // non-uniform time grid resets the time step and separable data prepares its time factors on every step,
+        // so the coefficients cannot be shared (null lets the kernel loop build its own):
+        auto const &coeff_holder = (discretization_cfg_->time_grid() == nullptr && !heat_data_cfg_->is_separable())
+                                       ? heat_coeff_holder
+                                       : nullptr;
+        const heat_implicit_kernel_loop kernel_loop(solver, heat_data_cfg_, discretization_cfg_, solver_cfg_, grid_cfg_,
+                                                    is_heat_sourse_set, stats_, coeff_holder);
+        kernel_loop.run(boundary_pairs, is_heat_sourse_set, heat_source, batch);
+        for (std::size_t s = 0; s < batch.systems_count(); ++s)
+        {
+            solutions.row(begin + s).copy_from(batch.solution(s));
+        }
+    });
 }
 
 } // namespace one_dimensional
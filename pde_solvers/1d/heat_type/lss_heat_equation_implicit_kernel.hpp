@@ -5,13 +5,18 @@
 
 #include "../../../boundaries/lss_boundary.hpp"
 #include "../../../common/lss_enumerations.hpp"
+#include "../../../common/lss_solver_stats.hpp"
+#include "../../../common/lss_thread_pool.hpp"
 #include "../../../common/lss_utility.hpp"
 #include "../../../containers/lss_container_2d.hpp"
 #include "../../../discretization/lss_grid_config.hpp"
 #include "../../lss_heat_solver_config.hpp"
 #include "../../lss_pde_discretization_config.hpp"
+#include "../../lss_time_slice_observer.hpp"
+#include "../../../sparse_solvers/tridiagonal/lss_tridiagonal_solver.hpp"
 #include "../../transformation/lss_heat_data_transform.hpp"
 #include "implicit_coefficients/lss_heat_coefficients.hpp"
+#include "solver_method/lss_heat_implicit_solver_method.hpp"
 
 namespace lss_pde_solvers
 {
@@ -19,6 +24,7 @@ namespace one_dimensional
 {
 
 using lss_boundary::boundary_1d_pair;
+using lss_boundary::boundary_1d_pairs;
 using lss_containers::container_2d;
 using lss_enumerations::by_enum;
 using lss_enumerations::dimension_enum;
@@ -28,6 +34,66 @@ using lss_enumerations::traverse_direction_enum;
 using lss_enumerations::tridiagonal_method_enum;
 using lss_grids::grid_config_1d_ptr;
 using lss_utility::container_t;
+using lss_utility::solver_stats_ptr;
+using lss_utility::thread_pool_ptr;
+
+/**
+    heat_implicit_kernel_loop object
+
+    Main solver method and optional Rannacher start-up method sharing one solver,
+    runs them in the implicit time loop with the time arguments of the configuration.
+ */
+class heat_implicit_kernel_loop
+{
+
+  private:
+    heat_implicit_solver_method_ptr solver_method_;
+    heat_implicit_solver_method_ptr startup_method_;
+    pde_discretization_config_1d_ptr discretization_cfg_;
+    heat_implicit_solver_config_ptr solver_cfg_;
+
+    explicit heat_implicit_kernel_loop(heat_implicit_solver_method_ptr const &solver_method,
+                                       heat_implicit_solver_method_ptr const &startup_method,
+                                       pde_discretization_config_1d_ptr const &discretization_config,
+                                       heat_implicit_solver_config_ptr const &solver_config);
+
+  public:
+    /**
+        @brief heat_implicit_kernel_loop object constructor
+        @param solver_ptr - solver shared by the main and start-up method
+        @param heat_data_config - heat data configuration
+        @param discretization_config - discretization configuration
+        @param solver_config - solver configuration with Rannacher steps and time stepping
+        @param grid_config - grid configuration
+        @param is_heat_sourse_set - true when heat source is present
+        @param stats - statistics shared by both methods
+        @param coefficients - heat coefficients of the main method (null means built from heat data)
+    **/
+    explicit heat_implicit_kernel_loop(lss_tridiagonal_solver::tridiagonal_solver_ptr const &solver_ptr,
+                                       heat_data_transform_1d_ptr const &heat_data_config,
+                                       pde_discretization_config_1d_ptr const &discretization_config,
+                                       heat_implicit_solver_config_ptr const &solver_config,
+                                       grid_config_1d_ptr const &grid_config, bool is_heat_sourse_set,
+                                       solver_stats_ptr const &stats,
+                                       heat_coefficients_ptr const &coefficients = nullptr);
+
+    explicit heat_implicit_kernel_loop(karawia_solver_ptr const &solver_ptr,
+                                       heat_data_transform_1d_ptr const &heat_data_config,
+                                       pde_discretization_config_1d_ptr const &discretization_config,
+                                       heat_implicit_solver_config_ptr const &solver_config,
+                                       grid_config_1d_ptr const &grid_config, bool is_heat_sourse_set,
+                                       solver_stats_ptr const &stats);
+
+    void run(boundary_1d_pair const &boundary_pair, bool is_heat_sourse_set,
+             std::function<double(double, double)> const &heat_source, container_t &solution) const;
+
+    void run(boundary_1d_pair const &boundary_pair, bool is_heat_sourse_set,
+             std::function<double(double, double)> const &heat_source, container_t &solution,
+             time_slice_observer_1d const &observer) const;
+
+    void run(boundary_1d_pairs const &boundary_pairs, bool is_heat_sourse_set,
+             std::function<double(double, double)> const &heat_source, tridiagonal_batch &batch) const;
+};
 
 template <memory_space_enum memory_enum, tridiagonal_method_enum tridiagonal_method> class heat_equation_implicit_kernel
 {
@@ -45,19 +111,20 @@ template <> class heat_equation_implicit_kernel<memory_space_enum::Device, tridi
     pde_discretization_config_1d_ptr discretization_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_1d_ptr grid_cfg_;
+    solver_stats_ptr stats_;
 
   public:
     heat_equation_implicit_kernel(boundary_1d_pair const &boundary_pair,
                                   heat_data_transform_1d_ptr const &heat_data_config,
                                   pde_discretization_config_1d_ptr const &discretization_config,
                                   heat_implicit_solver_config_ptr const &solver_config,
-                                  grid_config_1d_ptr const &grid_config);
+                                  grid_config_1d_ptr const &grid_config, solver_stats_ptr const &stats);
 
     void operator()(container_t &solution, bool is_heat_sourse_set,
                     std::function<double(double, double)> const &heat_source);
 
     void operator()(container_t &solution, bool is_heat_sourse_set,
-                    std::function<double(double, double)> const &heat_source, container_2d<by_enum::Row> &solutions);
+                    std::function<double(double, double)> const &heat_source, time_slice_observer_1d const &observer);
 };
 
 template <> class heat_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::SORSolver>
@@ -69,20 +136,21 @@ template <> class heat_equation_implicit_kernel<memory_space_enum::Device, tridi
     pde_discretization_config_1d_ptr discretization_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_1d_ptr grid_cfg_;
+    solver_stats_ptr stats_;
 
   public:
     heat_equation_implicit_kernel(boundary_1d_pair const &boundary_pair,
                                   heat_data_transform_1d_ptr const &heat_data_config,
                                   pde_discretization_config_1d_ptr const &discretization_config,
                                   heat_implicit_solver_config_ptr const &solver_config,
-                                  grid_config_1d_ptr const &grid_config);
+                                  grid_config_1d_ptr const &grid_config, solver_stats_ptr const &stats);
 
     void operator()(container_t &solution, bool is_heat_sourse_set,
                     std::function<double(double, double)> const &heat_source, double omega_value);
 
     void operator()(container_t &solution, bool is_heat_sourse_set,
                     std::function<double(double, double)> const &heat_source, double omega_value,
-                    container_2d<by_enum::Row> &solutions);
+                    time_slice_observer_1d const &observer);
 };
 
 // ===================================================================
@@ -97,19 +165,20 @@ template <> class heat_equation_implicit_kernel<memory_space_enum::Host, tridiag
     pde_discretization_config_1d_ptr discretization_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_1d_ptr grid_cfg_;
+    solver_stats_ptr stats_;
 
   public:
     heat_equation_implicit_kernel(boundary_1d_pair const &boundary_pair,
                                   heat_data_transform_1d_ptr const &heat_data_config,
                                   pde_discretization_config_1d_ptr const &discretization_config,
                                   heat_implicit_solver_config_ptr const &solver_config,
-                                  grid_config_1d_ptr const &grid_config);
+                                  grid_config_1d_ptr const &grid_config, solver_stats_ptr const &stats);
 
     void operator()(container_t &solution, bool is_heat_sourse_set,
                     std::function<double(double, double)> const &heat_source);
 
     void operator()(container_t &solution, bool is_heat_sourse_set,
-                    std::function<double(double, double)> const &heat_source, container_2d<by_enum::Row> &solutions);
+                    std::function<double(double, double)> const &heat_source, time_slice_observer_1d const &observer);
 };
 
 template <> class heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::SORSolver>
@@ -120,20 +189,21 @@ template <> class heat_equation_implicit_kernel<memory_space_enum::Host, tridiag
     pde_discretization_config_1d_ptr discretization_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_1d_ptr grid_cfg_;
+    solver_stats_ptr stats_;
 
   public:
     heat_equation_implicit_kernel(boundary_1d_pair const &boundary_pair,
                                   heat_data_transform_1d_ptr const &heat_data_config,
                                   pde_discretization_config_1d_ptr const &discretization_config,
                                   heat_implicit_solver_config_ptr const &solver_config,
-                                  grid_config_1d_ptr const &grid_config);
+                                  grid_config_1d_ptr const &grid_config, solver_stats_ptr const &stats);
 
     void operator()(container_t &solution, bool is_heat_sourse_set,
                     std::function<double(double, double)> const &heat_source, double omega_value);
 
     void operator()(container_t &solution, bool is_heat_sourse_set,
                     std::function<double(double, double)> const &heat_source, double omega_value,
-                    container_2d<by_enum::Row> &solutions);
+                    time_slice_observer_1d const &observer);
 };
 
 template <> class heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::DoubleSweepSolver>
@@ -145,19 +215,20 @@ template <> class heat_equation_implicit_kernel<memory_space_enum::Host, tridiag
     pde_discretization_config_1d_ptr discretization_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_1d_ptr grid_cfg_;
+    solver_stats_ptr stats_;
 
   public:
     heat_equation_implicit_kernel(boundary_1d_pair const &boundary_pair,
                                   heat_data_transform_1d_ptr const &heat_data_config,
                                   pde_discretization_config_1d_ptr const &discretization_config,
                                   heat_implicit_solver_config_ptr const &solver_config,
-                                  grid_config_1d_ptr const &grid_config);
+                                  grid_config_1d_ptr const &grid_config, solver_stats_ptr const &stats);
 
     void operator()(container_t &solution, bool is_heat_sourse_set,
                     std::function<double(double, double)> const &heat_source);
 
     void operator()(container_t &solution, bool is_heat_sourse_set,
-                    std::function<double(double, double)> const &heat_source, container_2d<by_enum::Row> &solutions);
+                    std::function<double(double, double)> const &heat_source, time_slice_observer_1d const &observer);
 };
 
 template <> class heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::ThomasLUSolver>
@@ -169,20 +240,122 @@ template <> class heat_equation_implicit_kernel<memory_space_enum::Host, tridiag
     pde_discretization_config_1d_ptr discretization_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_1d_ptr grid_cfg_;
+    solver_stats_ptr stats_;
+
+  public:
+    heat_equation_implicit_kernel(boundary_1d_pair const &boundary_pair,
+                                  heat_data_transform_1d_ptr const &heat_data_config,
+                                  pde_discretization_config_1d_ptr const &discretization_config,
+                                  heat_implicit_solver_config_ptr const &solver_config,
+                                  grid_config_1d_ptr const &grid_config, solver_stats_ptr const &stats);
+
+    void operator()(container_t &solution, bool is_heat_sourse_set,
+                    std::function<double(double, double)> const &heat_source);
+
+    void operator()(container_t &solution, bool is_heat_sourse_set,
+                    std::function<double(double, double)> const &heat_source, time_slice_observer_1d const &observer);
+};
+
+template <> class heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::SpikeSolver>
+{
+
+  private:
+    boundary_1d_pair boundary_pair_;
+    heat_data_transform_1d_ptr heat_data_cfg_;
+    pde_discretization_config_1d_ptr discretization_cfg_;
+    heat_implicit_solver_config_ptr solver_cfg_;
+    grid_config_1d_ptr grid_cfg_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
   public:
     heat_equation_implicit_kernel(boundary_1d_pair const &boundary_pair,
                                   heat_data_transform_1d_ptr const &heat_data_config,
                                   pde_discretization_config_1d_ptr const &discretization_config,
                                   heat_implicit_solver_config_ptr const &solver_config,
-                                  grid_config_1d_ptr const &grid_config);
+                                  grid_config_1d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                  solver_stats_ptr const &stats);
 
     void operator()(container_t &solution, bool is_heat_sourse_set,
                     std::function<double(double, double)> const &heat_source);
 
     void operator()(container_t &solution, bool is_heat_sourse_set,
-                    std::function<double(double, double)> const &heat_source, container_2d<by_enum::Row> &solutions);
+                    std::function<double(double, double)> const &heat_source, time_slice_observer_1d const &observer);
 };
+
+/**
+    Fourth-order five-point scheme, the pentadiagonal system is factored once
+    while its diagonals stay the same (Dirichlet boundaries only)
+ */
+template <> class heat_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::KarawiaSolver>
+{
+
+  private:
+    boundary_1d_pair boundary_pair_;
+    heat_data_transform_1d_ptr heat_data_cfg_;
+    pde_discretization_config_1d_ptr discretization_cfg_;
+    heat_implicit_solver_config_ptr solver_cfg_;
+    grid_config_1d_ptr grid_cfg_;
+    solver_stats_ptr stats_;
+
+  public:
+    heat_equation_implicit_kernel(boundary_1d_pair const &boundary_pair,
+                                  heat_data_transform_1d_ptr const &heat_data_config,
+                                  pde_discretization_config_1d_ptr const &discretization_config,
+                                  heat_implicit_solver_config_ptr const &solver_config,
+                                  grid_config_1d_ptr const &grid_config, solver_stats_ptr const &stats);
+
+    void operator()(container_t &solution, bool is_heat_sourse_set,
+                    std::function<double(double, double)> const &heat_source);
+
+    void operator()(container_t &solution, bool is_heat_sourse_set,
+                    std::function<double(double, double)> const &heat_source, time_slice_observer_1d const &observer);
+};
+
+// ===================================================================
+// =============================== BATCH =============================
+// ===================================================================
+
+/**
+    heat_equation_implicit_batch_kernel object
+
+    Advances many problems sharing grid and coefficients. Problems are split into
+    contiguous chunks, one per worker, and each chunk is advanced as one batch
+    with the problems interleaved, so the operator is assembled once per row.
+ */
+class heat_equation_implicit_batch_kernel
+{
+
+  private:
+    boundary_1d_pairs boundary_pairs_;
+    heat_data_transform_1d_ptr heat_data_cfg_;
+    pde_discretization_config_1d_ptr discretization_cfg_;
+    heat_implicit_solver_config_ptr solver_cfg_;
+    grid_config_1d_ptr grid_cfg_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
+
+    lss_tridiagonal_solver::tridiagonal_solver_ptr create_solver(std::size_t space_size, double omega_value) const;
+
+  public:
+    heat_equation_implicit_batch_kernel(boundary_1d_pairs const &boundary_pairs,
+                                        heat_data_transform_1d_ptr const &heat_data_config,
+                                        pde_discretization_config_1d_ptr const &discretization_config,
+                                        heat_implicit_solver_config_ptr const &solver_config,
+                                        grid_config_1d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                        solver_stats_ptr const &stats);
+
+    /**
+        @brief  Advances all problems through the time range
+        @param  solutions - one row per problem, initial solutions on entry and final solutions on exit
+        @param  is_heat_sourse_set - true when heat source is present
+        @param  heat_source - heat source shared by all problems
+        @param  omega_value - relaxation parameter used by SOR solvers
+    **/
+    void operator()(container_2d<by_enum::Row> &solutions, bool is_heat_sourse_set,
+                    std::function<double(double, double)> const &heat_source, double omega_value);
+};
+
 } // namespace one_dimensional
 
 } // namespace lss_pde_solvers
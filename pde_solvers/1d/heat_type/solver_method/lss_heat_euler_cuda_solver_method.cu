@@ -10,6 +10,7 @@ namespace lss_pde_solvers
 namespace one_dimensional
 {
 
+using lss_boundary::boundary_cast;
 using lss_boundary::dirichlet_boundary_1d;
 using lss_boundary::neumann_boundary_1d;
 using lss_boundary::robin_boundary_1d;
@@ -90,16 +91,16 @@ void explicit_cuda_scheme::rhs(heat_euler_coefficients_ptr const &cfs, heat_eule
     double x{};
     // for lower boundaries first:
     x = grid_1d::value(grid_config, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(first_bnd))
     {
         solution[0] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] = beta * a(time, x) + b(time, x) * input[0] + (a(time, x) + d(time, x)) * input[1];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -109,16 +110,16 @@ void explicit_cuda_scheme::rhs(heat_euler_coefficients_ptr const &cfs, heat_eule
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_config, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(second_bnd))
     {
         solution[N] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] = (a(time, x) + d(time, x)) * input[N - 1] + b(time, x) * input[N] - delta * d(time, x);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
@@ -148,13 +149,13 @@ void explicit_cuda_scheme::rhs_source(heat_euler_coefficients_ptr const &cfs, he
 
     // for lower boundaries first:
     x = grid_1d::value(grid_config, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] =
             beta * a(time, x) + b(time, x) * input[0] + (a(time, x) + d(time, x)) * input[1] + k * inhom_input[0];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -164,13 +165,13 @@ void explicit_cuda_scheme::rhs_source(heat_euler_coefficients_ptr const &cfs, he
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_config, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] =
             (a(time, x) + d(time, x)) * input[N - 1] + b(time, x) * input[N] - delta * d(time, x) + k * inhom_input[N];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
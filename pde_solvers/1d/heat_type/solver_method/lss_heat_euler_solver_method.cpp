@@ -10,6 +10,7 @@ namespace lss_pde_solvers
 namespace one_dimensional
 {
 
+using lss_boundary::boundary_cast;
 using lss_boundary::dirichlet_boundary_1d;
 using lss_boundary::neumann_boundary_1d;
 using lss_boundary::robin_boundary_1d;
@@ -28,16 +29,16 @@ void explicit_heat_scheme::rhs(heat_euler_coefficients_ptr const &cfs, grid_conf
     double x{};
     // for lower boundaries first:
     x = grid_1d::value(grid_config, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(first_bnd))
     {
         solution[0] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] = beta * a(time, x) + b(time, x) * input[0] + (a(time, x) + d(time, x)) * input[1];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -47,16 +48,16 @@ void explicit_heat_scheme::rhs(heat_euler_coefficients_ptr const &cfs, grid_conf
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_config, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(second_bnd))
     {
         solution[N] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] = (a(time, x) + d(time, x)) * input[N - 1] + b(time, x) * input[N] - delta * d(time, x);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
@@ -67,7 +68,8 @@ void explicit_heat_scheme::rhs(heat_euler_coefficients_ptr const &cfs, grid_conf
     for (std::size_t t = 1; t < N; ++t)
     {
         x = grid_1d::value(grid_config, t);
-        solution[t] = (d(time, x) * input[t + 1]) + (b(time, x) * input[t]) + (a(time, x) * input[t - 1]);
+        solution[t] = (cfs->D(time, x, t) * input[t + 1]) + (cfs->B(time, x, t) * input[t]) +
+                      (cfs->A(time, x, t) * input[t - 1]);
     }
 }
 
@@ -87,13 +89,13 @@ void explicit_heat_scheme::rhs_source(heat_euler_coefficients_ptr const &cfs, gr
 
     // for lower boundaries first:
     x = grid_1d::value(grid_config, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] =
             beta * a(time, x) + b(time, x) * input[0] + (a(time, x) + d(time, x)) * input[1] + k * inhom_input[0];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -103,13 +105,13 @@ void explicit_heat_scheme::rhs_source(heat_euler_coefficients_ptr const &cfs, gr
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_config, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] =
             (a(time, x) + d(time, x)) * input[N - 1] + b(time, x) * input[N] - delta * d(time, x) + k * inhom_input[N];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
@@ -120,8 +122,8 @@ void explicit_heat_scheme::rhs_source(heat_euler_coefficients_ptr const &cfs, gr
     for (std::size_t t = 1; t < N; ++t)
     {
         x = grid_1d::value(grid_config, t);
-        solution[t] =
-            (d(time, x) * input[t + 1]) + (b(time, x) * input[t]) + (a(time, x) * input[t - 1]) + (k * inhom_input[t]);
+        solution[t] = (cfs->D(time, x, t) * input[t + 1]) + (cfs->B(time, x, t) * input[t]) +
+                      (cfs->A(time, x, t) * input[t - 1]) + (k * inhom_input[t]);
     }
 }
 
@@ -1,5 +1,7 @@
 #include "lss_heat_implicit_solver_method.hpp"
 
+#include <algorithm>
+
 #include "../../../../boundaries/lss_dirichlet_boundary.hpp"
 #include "../../../../boundaries/lss_neumann_boundary.hpp"
 #include "../../../../boundaries/lss_robin_boundary.hpp"
@@ -11,9 +13,12 @@ namespace lss_pde_solvers
 namespace one_dimensional
 {
 
+using lss_boundary::boundary_cast;
+using lss_boundary::boundary_enum;
 using lss_boundary::dirichlet_boundary_1d;
 using lss_boundary::neumann_boundary_1d;
 using lss_boundary::robin_boundary_1d;
+using lss_enumerations::solver_phase_enum;
 using lss_grids::grid_1d;
 
 void implicit_heat_scheme::rhs(heat_coefficients_ptr const &cfs, grid_config_1d_ptr const &grid_cfg,
@@ -32,13 +37,13 @@ void implicit_heat_scheme::rhs(heat_coefficients_ptr const &cfs, grid_config_1d_
     double x{};
     // for lower boundaries first:
     x = grid_1d::value(grid_cfg, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] = (one - theta) * beta * A(time, x) + (one - two * (one - theta) * B(time, x)) * input[0] +
                       (one - theta) * (A(time, x) + D(time, x)) * input[1];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -49,13 +54,13 @@ void implicit_heat_scheme::rhs(heat_coefficients_ptr const &cfs, grid_config_1d_
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_cfg, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] = (one - theta) * (A(time, x) + D(time, x)) * input[N - 1] +
                       (one - two * (one - theta) * B(time, x)) * input[N] - (one - theta) * delta * D(time, x);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
@@ -67,9 +72,9 @@ void implicit_heat_scheme::rhs(heat_coefficients_ptr const &cfs, grid_config_1d_
     for (std::size_t t = 1; t < N; ++t)
     {
         x = grid_1d::value(grid_cfg, t);
-        solution[t] = (D(time, x) * (one - theta) * input[t + 1]) +
-                      ((one - two * B(time, x) * (one - theta)) * input[t]) +
-                      (A(time, x) * (one - theta) * input[t - 1]);
+        solution[t] = (cfs->D(time, x, t) * (one - theta) * input[t + 1]) +
+                      ((one - two * cfs->B(time, x, t) * (one - theta)) * input[t]) +
+                      (cfs->A(time, x, t) * (one - theta) * input[t - 1]);
     }
 }
 
@@ -92,14 +97,14 @@ void implicit_heat_scheme::rhs_source(heat_coefficients_ptr const &cfs, grid_con
 
     // for lower boundaries first:
     x = grid_1d::value(grid_cfg, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] = (one - theta) * beta * A(time, x) + (one - two * (one - theta) * B(time, x)) * input[0] +
                       (one - theta) * (A(time, x) + D(time, x)) * input[1] + theta * k * inhom_input_next[0] +
                       (one - theta) * k * inhom_input[0];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -111,14 +116,14 @@ void implicit_heat_scheme::rhs_source(heat_coefficients_ptr const &cfs, grid_con
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_cfg, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] = (one - theta) * (A(time, x) + D(time, x)) * input[N - 1] +
                       (one - two * (one - theta) * B(time, x)) * input[N] - (one - theta) * delta * D(time, x) +
                       theta * k * inhom_input_next[N] + (one - theta) * k * inhom_input[N];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
@@ -130,13 +135,174 @@ void implicit_heat_scheme::rhs_source(heat_coefficients_ptr const &cfs, grid_con
     for (std::size_t t = 1; t < N; ++t)
     {
         x = grid_1d::value(grid_cfg, t);
-        solution[t] = (D(time, x) * (one - theta) * input[t + 1]) +
-                      ((one - two * B(time, x) * (one - theta)) * input[t]) +
-                      (A(time, x) * (one - theta) * input[t - 1]) +
+        solution[t] = (cfs->D(time, x, t) * (one - theta) * input[t + 1]) +
+                      ((one - two * cfs->B(time, x, t) * (one - theta)) * input[t]) +
+                      (cfs->A(time, x, t) * (one - theta) * input[t - 1]) +
                       k * (theta * inhom_input_next[t] + (one - theta) * inhom_input[t]);
     }
 }
 
+void implicit_heat_scheme::rhs_batch(heat_coefficients_ptr const &cfs, grid_config_1d_ptr const &grid_cfg,
+                                     boundary_1d_pairs const &boundary_pairs, double const &time,
+                                     tridiagonal_batch &batch)
+{
+    auto const two = 2.0;
+    auto const one = 1.0;
+    auto const &A = cfs->A_;
+    auto const &B = cfs->B_;
+    auto const &D = cfs->D_;
+    auto const theta = cfs->theta_;
+    auto const h = grid_1d::step(grid_cfg);
+    const std::size_t M = batch.systems_count();
+    const std::size_t N = batch.system_size() - 1;
+    double const *input = batch.raw_solution();
+    double *solution = batch.raw_rhs();
+    // boundary rows depend on boundary of each system:
+    const double x_0 = grid_1d::value(grid_cfg, 0);
+    const double x_N = grid_1d::value(grid_cfg, N);
+    for (std::size_t s = 0; s < M; ++s)
+    {
+        auto const &first_bnd = boundary_pairs[s].first;
+        auto const &second_bnd = boundary_pairs[s].second;
+        if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
+        {
+            const double beta = two * h * ptr->value(time);
+            solution[s] = (one - theta) * beta * A(time, x_0) +
+                          (one - two * (one - theta) * B(time, x_0)) * input[s] +
+                          (one - theta) * (A(time, x_0) + D(time, x_0)) * input[M + s];
+        }
+        else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
+        {
+            const double beta = two * h * ptr->value(time);
+            const double alpha = two * h * ptr->linear_value(time);
+            solution[s] = (one - theta) * beta * A(time, x_0) +
+                          (one - (one - theta) * (two * B(time, x_0) - alpha * A(time, x_0))) * input[s] +
+                          (one - theta) * (A(time, x_0) + D(time, x_0)) * input[M + s];
+        }
+        if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
+        {
+            const double delta = two * h * ptr->value(time);
+            solution[N * M + s] = (one - theta) * (A(time, x_N) + D(time, x_N)) * input[(N - 1) * M + s] +
+                                  (one - two * (one - theta) * B(time, x_N)) * input[N * M + s] -
+                                  (one - theta) * delta * D(time, x_N);
+        }
+        else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
+        {
+            const double delta = two * h * ptr->value(time);
+            const double gamma = two * h * ptr->linear_value(time);
+            solution[N * M + s] = (one - theta) * (A(time, x_N) + D(time, x_N)) * input[(N - 1) * M + s] +
+                                  (one - (one - theta) * (two * B(time, x_N) + gamma * D(time, x_N))) *
+                                      input[N * M + s] -
+                                  (one - theta) * delta * D(time, x_N);
+        }
+    }
+
+    // coefficients of interior rows are shared by all systems, systems are the innermost index:
+    double x{}, a{}, b{}, d{};
+    for (std::size_t t = 1; t < N; ++t)
+    {
+        x = grid_1d::value(grid_cfg, t);
+        a = cfs->A(time, x, t) * (one - theta);
+        b = (one - two * cfs->B(time, x, t) * (one - theta));
+        d = cfs->D(time, x, t) * (one - theta);
+        const std::size_t row = t * M;
+        for (std::size_t s = 0; s < M; ++s)
+        {
+            solution[row + s] = (d * input[row + M + s]) + (b * input[row + s]) + (a * input[row - M + s]);
+        }
+    }
+}
+
+void implicit_heat_scheme::rhs_source_batch(heat_coefficients_ptr const &cfs, grid_config_1d_ptr const &grid_cfg,
+                                            container_t const &inhom_input, container_t const &inhom_input_next,
+                                            boundary_1d_pairs const &boundary_pairs, double const &time,
+                                            tridiagonal_batch &batch)
+{
+    auto const one = 1.0;
+    auto const k = cfs->k_;
+    auto const theta = cfs->theta_;
+    const std::size_t M = batch.systems_count();
+    const std::size_t N = batch.system_size() - 1;
+    double *solution = batch.raw_rhs();
+
+    rhs_batch(cfs, grid_cfg, boundary_pairs, time, batch);
+    // heat source is shared by all systems, Dirichlet rows are not part of the systems:
+    for (std::size_t s = 0; s < M; ++s)
+    {
+        if (boundary_pairs[s].first->kind() != boundary_enum::Dirichlet)
+        {
+            solution[s] += theta * k * inhom_input_next[0];
+            solution[s] += (one - theta) * k * inhom_input[0];
+        }
+        if (boundary_pairs[s].second->kind() != boundary_enum::Dirichlet)
+        {
+            solution[N * M + s] += theta * k * inhom_input_next[N];
+            solution[N * M + s] += (one - theta) * k * inhom_input[N];
+        }
+    }
+    double src{};
+    for (std::size_t t = 1; t < N; ++t)
+    {
+        src = k * (theta * inhom_input_next[t] + (one - theta) * inhom_input[t]);
+        const std::size_t row = t * M;
+        for (std::size_t s = 0; s < M; ++s)
+        {
+            solution[row + s] += src;
+        }
+    }
+}
+
+std::array<double, 5> implicit_heat_scheme::wide_stencil(heat_coefficients_ptr const &cfs, double const &time,
+                                                         double x, std::size_t idx, std::size_t N)
+{
+    auto const two = 2.0;
+    const double a = cfs->A(time, x, idx);
+    const double b = cfs->B(time, x, idx);
+    const double d = cfs->D(time, x, idx);
+    if ((idx < 2) || (idx + 2 > N))
+        return {0.0, a, -two * b, d, 0.0};
+    // A, B, D hold lambda*a -+ gamma*b and lambda*a - delta*c, the fourth-order differences follow from them:
+    const double c_24 = 1.0 / 24.0;
+    const double c_43 = 4.0 / 3.0;
+    return {c_24 * (d - 3.0 * a), c_43 * a, -0.25 * (a + d) - two * b, c_43 * d, c_24 * (a - 3.0 * d)};
+}
+
+void implicit_heat_scheme::rhs_wide(heat_coefficients_ptr const &cfs, grid_config_1d_ptr const &grid_cfg,
+                                    container_t const &input, double const &time, container_t &solution)
+{
+    auto const one = 1.0;
+    auto const theta = cfs->theta_;
+    const std::size_t N = solution.size() - 1;
+    double x{}, sum{};
+    for (std::size_t t = 1; t < N; ++t)
+    {
+        x = grid_1d::value(grid_cfg, t);
+        auto const w = wide_stencil(cfs, time, x, t, N);
+        sum = w[1] * input[t - 1] + w[2] * input[t] + w[3] * input[t + 1];
+        if (t >= 2)
+            sum += w[0] * input[t - 2];
+        if (t + 2 <= N)
+            sum += w[4] * input[t + 2];
+        solution[t] = input[t] + (one - theta) * sum;
+    }
+}
+
+void implicit_heat_scheme::rhs_source_wide(heat_coefficients_ptr const &cfs, grid_config_1d_ptr const &grid_cfg,
+                                           container_t const &input, container_t const &inhom_input,
+                                           container_t const &inhom_input_next, double const &time,
+                                           container_t &solution)
+{
+    auto const one = 1.0;
+    auto const k = cfs->k_;
+    auto const theta = cfs->theta_;
+    const std::size_t N = solution.size() - 1;
+    rhs_wide(cfs, grid_cfg, input, time, solution);
+    for (std::size_t t = 1; t < N; ++t)
+    {
+        solution[t] += k * (theta * inhom_input_next[t] + (one - theta) * inhom_input[t]);
+    }
+}
+
 void heat_implicit_solver_method::initialize(bool is_heat_sourse_set)
 {
     // prepare containers:
@@ -144,11 +310,18 @@ void heat_implicit_solver_method::initialize(bool is_heat_sourse_set)
     diag_.resize(coefficients_->space_size_);
     high_.resize(coefficients_->space_size_);
     rhs_.resize(coefficients_->space_size_);
+    if (pentau_ptr_)
+    {
+        lowest_.resize(coefficients_->space_size_);
+        uppest_.resize(coefficients_->space_size_);
+    }
     if (is_heat_sourse_set)
     {
         source_.resize(coefficients_->space_size_);
         source_next_.resize(coefficients_->space_size_);
     }
+    LSS_STATS_ADD(stats_, add_bytes_allocated,
+                  ((pentau_ptr_ ? 6 : 4) + (is_heat_sourse_set ? 2 : 0)) * coefficients_->space_size_ * sizeof(double));
 }
 
 void heat_implicit_solver_method::split(double const &time, container_t &low, container_t &diag, container_t &high)
@@ -157,17 +330,107 @@ void heat_implicit_solver_method::split(double const &time, container_t &low, co
     for (std::size_t t = 0; t < low.size(); ++t)
     {
         x = grid_1d::value(grid_cfg_, t);
-        low[t] = (-coefficients_->theta_ * coefficients_->A_(time, x));
-        diag[t] = (cone_ + ctwo_ * coefficients_->theta_ * coefficients_->B_(time, x));
-        high[t] = (-coefficients_->theta_ * coefficients_->D_(time, x));
+        low[t] = (-coefficients_->theta_ * coefficients_->A(time, x, t));
+        diag[t] = (cone_ + ctwo_ * coefficients_->theta_ * coefficients_->B(time, x, t));
+        high[t] = (-coefficients_->theta_ * coefficients_->D(time, x, t));
+    }
+}
+
+void heat_implicit_solver_method::split(double const &time, container_t &lowest, container_t &low,
+                                        container_t &diag, container_t &high, container_t &uppest)
+{
+    const std::size_t N = low.size() - 1;
+    // Dirichlet rows are not part of the system:
+    lowest[0] = low[0] = high[0] = uppest[0] = 0.0;
+    lowest[N] = low[N] = high[N] = uppest[N] = 0.0;
+    diag[0] = diag[N] = cone_;
+    double x{};
+    for (std::size_t t = 1; t < N; ++t)
+    {
+        x = grid_1d::value(grid_cfg_, t);
+        auto const w = implicit_heat_scheme::wide_stencil(coefficients_, time, x, t, N);
+        lowest[t] = -coefficients_->theta_ * w[0];
+        low[t] = -coefficients_->theta_ * w[1];
+        diag[t] = cone_ - coefficients_->theta_ * w[2];
+        high[t] = -coefficients_->theta_ * w[3];
+        uppest[t] = -coefficients_->theta_ * w[4];
+    }
+}
+
+void heat_implicit_solver_method::prepare_time_factors(double const &time)
+{
+    LSS_STATS_PHASE(stats_, solver_phase_enum::Coefficients);
+    coefficients_->prepare_time_factors(time);
+}
+
+void heat_implicit_solver_method::load_diagonals(double const &time)
+{
+    // time-homogeneous matrix is the same on every step, keeping it lets the solver reuse its factorization:
+    if (coefficients_->is_time_homogeneous_ && are_diagonals_set_)
+        return;
+    LSS_STATS_PHASE(stats_, solver_phase_enum::Coefficients);
+    if (pentau_ptr_)
+    {
+        split(time, lowest_, low_, diag_, high_, uppest_);
+        pentau_ptr_->set_diagonals(lowest_, low_, diag_, high_, uppest_);
+    }
+    else
+    {
+        split(time, low_, diag_, high_);
+        solveru_ptr_->set_diagonals(low_, diag_, high_);
+    }
+    are_diagonals_set_ = true;
+}
+
+void heat_implicit_solver_method::load_diagonals(double const &time, tridiagonal_batch &batch)
+{
+    // time-homogeneous matrix stays in the batch from the last step, the solver then reuses its factorization:
+    if (coefficients_->is_time_homogeneous_ && are_diagonals_set_)
+    {
+        batch.set_diagonals_kept(true);
+        return;
+    }
+    split(time, batch);
+    are_diagonals_set_ = true;
+}
+
+void heat_implicit_solver_method::split(double const &time, tridiagonal_batch &batch)
+{
+    LSS_STATS_PHASE(stats_, solver_phase_enum::Coefficients);
+    const std::size_t M = batch.systems_count();
+    double *low = batch.raw_low();
+    double *diag = batch.raw_diag();
+    double *high = batch.raw_high();
+    // all systems share the operator, each row is broadcast across the systems:
+    double x{};
+    for (std::size_t t = 0; t < batch.system_size(); ++t)
+    {
+        x = grid_1d::value(grid_cfg_, t);
+        const std::size_t row = t * M;
+        std::fill(low + row, low + row + M, (-coefficients_->theta_ * coefficients_->A(time, x, t)));
+        std::fill(diag + row, diag + row + M, (cone_ + ctwo_ * coefficients_->theta_ * coefficients_->B(time, x, t)));
+        std::fill(high + row, high + row + M, (-coefficients_->theta_ * coefficients_->D(time, x, t)));
     }
 }
 
 heat_implicit_solver_method::heat_implicit_solver_method(
     lss_tridiagonal_solver::tridiagonal_solver_ptr const &solver_ptr, heat_coefficients_ptr const &coefficients,
-    grid_config_1d_ptr const &grid_config, bool is_heat_sourse_set)
-    : solveru_ptr_{solver_ptr}, coefficients_{coefficients}, grid_cfg_{grid_config}
+    grid_config_1d_ptr const &grid_config, bool is_heat_sourse_set, solver_stats_ptr const &stats)
+    : solveru_ptr_{solver_ptr}, coefficients_{coefficients}, grid_cfg_{grid_config}, are_diagonals_set_{false},
+      stats_{stats}
 {
+    solveru_ptr_->set_stats(stats_);
+    initialize(is_heat_sourse_set);
+}
+
+heat_implicit_solver_method::heat_implicit_solver_method(karawia_solver_ptr const &solver_ptr,
+                                                         heat_coefficients_ptr const &coefficients,
+                                                         grid_config_1d_ptr const &grid_config, bool is_heat_sourse_set,
+                                                         solver_stats_ptr const &stats)
+    : pentau_ptr_{solver_ptr}, coefficients_{coefficients}, grid_cfg_{grid_config}, are_diagonals_set_{false},
+      stats_{stats}
+{
+    pentau_ptr_->set_stats(stats_);
     initialize(is_heat_sourse_set);
 }
 
@@ -178,9 +441,23 @@ heat_implicit_solver_method::~heat_implicit_solver_method()
 void heat_implicit_solver_method::solve(container_t &prev_solution, boundary_1d_pair const &boundary_pair,
                                         double const &time, container_t &solution)
 {
-    implicit_heat_scheme::rhs(coefficients_, grid_cfg_, prev_solution, boundary_pair, time, rhs_);
-    split(time, low_, diag_, high_);
-    solveru_ptr_->set_diagonals(low_, diag_, high_);
+    prepare_time_factors(time);
+    if (pentau_ptr_)
+    {
+        {
+            LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+            implicit_heat_scheme::rhs_wide(coefficients_, grid_cfg_, prev_solution, time, rhs_);
+        }
+        load_diagonals(time);
+        pentau_ptr_->set_rhs(rhs_);
+        pentau_ptr_->solve(boundary_pair, solution, time);
+        return;
+    }
+    {
+        LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+        implicit_heat_scheme::rhs(coefficients_, grid_cfg_, prev_solution, boundary_pair, time, rhs_);
+    }
+    load_diagonals(time);
     solveru_ptr_->set_rhs(rhs_);
     solveru_ptr_->solve(boundary_pair, solution, time);
 }
@@ -189,16 +466,102 @@ void heat_implicit_solver_method::solve(container_t &prev_solution, boundary_1d_
                                         double const &time, double const &next_time,
                                         std::function<double(double, double)> const &heat_source, container_t &solution)
 {
-    split(time, low_, diag_, high_);
-    d_1d::of_function(grid_cfg_, time, heat_source, source_);
-    d_1d::of_function(grid_cfg_, next_time, heat_source, source_next_);
-    implicit_heat_scheme::rhs_source(coefficients_, grid_cfg_, prev_solution, source_, source_next_, boundary_pair,
-                                     time, rhs_);
-    solveru_ptr_->set_diagonals(low_, diag_, high_);
+    prepare_time_factors(time);
+    load_diagonals(time);
+    {
+        LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+        d_1d::of_function(grid_cfg_, time, heat_source, source_);
+        d_1d::of_function(grid_cfg_, next_time, heat_source, source_next_);
+        if (pentau_ptr_)
+        {
+            implicit_heat_scheme::rhs_source_wide(coefficients_, grid_cfg_, prev_solution, source_, source_next_,
+                                                  time, rhs_);
+        }
+        else
+        {
+            implicit_heat_scheme::rhs_source(coefficients_, grid_cfg_, prev_solution, source_, source_next_,
+                                             boundary_pair, time, rhs_);
+        }
+    }
+    if (pentau_ptr_)
+    {
+        pentau_ptr_->set_rhs(rhs_);
+        pentau_ptr_->solve(boundary_pair, solution, time);
+        return;
+    }
     solveru_ptr_->set_rhs(rhs_);
     solveru_ptr_->solve(boundary_pair, solution, time);
 }
 
+void heat_implicit_solver_method::solve(tridiagonal_batch &batch, boundary_1d_pairs const &boundary_pairs,
+                                        double const &time)
+{
+    prepare_time_factors(time);
+    {
+        LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+        implicit_heat_scheme::rhs_batch(coefficients_, grid_cfg_, boundary_pairs, time, batch);
+    }
+    load_diagonals(time, batch);
+    solveru_ptr_->solve(boundary_pairs, batch, time);
+}
+
+void heat_implicit_solver_method::solve(tridiagonal_batch &batch, boundary_1d_pairs const &boundary_pairs,
+                                        double const &time, double const &next_time,
+                                        std::function<double(double, double)> const &heat_source)
+{
+    prepare_time_factors(time);
+    {
+        LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+        d_1d::of_function(grid_cfg_, time, heat_source, source_);
+        d_1d::of_function(grid_cfg_, next_time, heat_source, source_next_);
+        implicit_heat_scheme::rhs_source_batch(coefficients_, grid_cfg_, source_, source_next_, boundary_pairs, time,
+                                               batch);
+    }
+    load_diagonals(time, batch);
+    solveru_ptr_->solve(boundary_pairs, batch, time);
+}
+
+void heat_implicit_solver_method::set_time_step(double time_step)
+{
+    if (time_step == coefficients_->k_)
+        return;
+    coefficients_->set_time_step(time_step);
+    are_diagonals_set_ = false;
+}
+
+std::size_t heat_implicit_solver_method::time_order() const
+{
+    return (coefficients_->theta_ == 0.5) ? std::size_t(2) : std::size_t(1);
+}
+
+sptr_t<heat_implicit_solver_method> heat_implicit_solver_method::rannacher_startup(
+    lss_tridiagonal_solver::tridiagonal_solver_ptr const &solver_ptr,
+    heat_data_transform_1d_ptr const &heat_data_config, pde_discretization_config_1d_ptr const &discretization_config,
+    grid_config_1d_ptr const &grid_config, bool is_heat_sourse_set, std::size_t startup_steps,
+    solver_stats_ptr const &stats)
+{
+    if (startup_steps == 0)
+        return nullptr;
+    // implicit Euler (theta = 1) over half of the time step damps the high frequencies of non-smooth data:
+    auto const startup_coeff_holder =
+        std::make_shared<heat_coefficients>(heat_data_config, discretization_config, 1.0, 0.5);
+    return std::make_shared<heat_implicit_solver_method>(solver_ptr, startup_coeff_holder, grid_config,
+                                                         is_heat_sourse_set, stats);
+}
+
+sptr_t<heat_implicit_solver_method> heat_implicit_solver_method::rannacher_startup(
+    karawia_solver_ptr const &solver_ptr, heat_data_transform_1d_ptr const &heat_data_config,
+    pde_discretization_config_1d_ptr const &discretization_config, grid_config_1d_ptr const &grid_config,
+    bool is_heat_sourse_set, std::size_t startup_steps, solver_stats_ptr const &stats)
+{
+    if (startup_steps == 0)
+        return nullptr;
+    auto const startup_coeff_holder =
+        std::make_shared<heat_coefficients>(heat_data_config, discretization_config, 1.0, 0.5);
+    return std::make_shared<heat_implicit_solver_method>(solver_ptr, startup_coeff_holder, grid_config,
+                                                         is_heat_sourse_set, stats);
+}
+
 } // namespace one_dimensional
 
 } // namespace lss_pde_solvers
@@ -1,10 +1,15 @@
 #if !defined(_LSS_HEAT_IMPLICIT_SOLVER_METHOD_HPP_)
 #define _LSS_HEAT_IMPLICIT_SOLVER_METHOD_HPP_
 
+#include <array>
+
 #include "../../../../boundaries/lss_boundary.hpp"
+#include "../../../../common/lss_solver_stats.hpp"
 #include "../../../../common/lss_utility.hpp"
 #include "../../../../discretization/lss_discretization.hpp"
 #include "../../../../discretization/lss_grid_config.hpp"
+#include "../../../../sparse_solvers/pentadiagonal/karawia_solver/lss_karawia_solver.hpp"
+#include "../../../../sparse_solvers/tridiagonal/lss_tridiagonal_batch.hpp"
 #include "../../../../sparse_solvers/tridiagonal/lss_tridiagonal_solver.hpp"
 #include "../implicit_coefficients/lss_heat_coefficients.hpp"
 
@@ -15,8 +20,12 @@ namespace one_dimensional
 {
 
 using lss_boundary::boundary_1d_pair;
+using lss_boundary::boundary_1d_pairs;
 using lss_grids::grid_config_1d_ptr;
+using lss_karawia_solver::karawia_solver_ptr;
+using lss_tridiagonal_solver::tridiagonal_batch;
 using lss_utility::container_t;
+using lss_utility::solver_stats_ptr;
 using lss_utility::sptr_t;
 
 using d_1d = discretization_1d<std::vector, std::allocator<double>>;
@@ -32,6 +41,45 @@ class implicit_heat_scheme
                            container_t const &input, container_t const &inhom_input,
                            container_t const &inhom_input_next, boundary_1d_pair const &boundary_pair,
                            double const &time, container_t &solution);
+
+    /**
+        @brief  Right-hand sides of all systems of the batch, previous solutions are read from the batch solutions
+        @param  cfs - scheme coefficients shared by all systems
+        @param  grid_cfg - grid shared by all systems
+        @param  boundary_pairs - boundary pair of each system
+        @param  time - time
+        @param  batch - batch whose right-hand sides are filled
+    **/
+    static void rhs_batch(heat_coefficients_ptr const &cfs, grid_config_1d_ptr const &grid_cfg,
+                          boundary_1d_pairs const &boundary_pairs, double const &time, tridiagonal_batch &batch);
+
+    /**
+        @brief  Fourth-order five-point stencil of the operator at node idx, nodes next to the boundary
+                keep the three-point stencil
+        @param  cfs - scheme coefficients
+        @param  time - time
+        @param  x - space value at node idx
+        @param  idx - node index, 0 < idx < N
+        @param  N - index of the last node
+        @retval weights of nodes idx-2,...,idx+2
+    **/
+    static std::array<double, 5> wide_stencil(heat_coefficients_ptr const &cfs, double const &time, double x,
+                                              std::size_t idx, std::size_t N);
+
+    /**
+        @brief  Right-hand side of the five-point scheme, Dirichlet rows are not part of the system
+    **/
+    static void rhs_wide(heat_coefficients_ptr const &cfs, grid_config_1d_ptr const &grid_cfg,
+                         container_t const &input, double const &time, container_t &solution);
+
+    static void rhs_source_wide(heat_coefficients_ptr const &cfs, grid_config_1d_ptr const &grid_cfg,
+                                container_t const &input, container_t const &inhom_input,
+                                container_t const &inhom_input_next, double const &time, container_t &solution);
+
+    static void rhs_source_batch(heat_coefficients_ptr const &cfs, grid_config_1d_ptr const &grid_cfg,
+                                 container_t const &inhom_input, container_t const &inhom_input_next,
+                                 boundary_1d_pairs const &boundary_pairs, double const &time,
+                                 tridiagonal_batch &batch);
 };
 
 /**
@@ -45,13 +93,17 @@ class heat_implicit_solver_method
     const double ctwo_ = 2.0;
     // solvers:
     lss_tridiagonal_solver::tridiagonal_solver_ptr solveru_ptr_;
+    karawia_solver_ptr pentau_ptr_;
     // scheme coefficients:
     heat_coefficients_ptr coefficients_;
     grid_config_1d_ptr grid_cfg_;
     // prepare containers:
     container_t low_, diag_, high_;
+    container_t lowest_, uppest_;
     container_t source_, source_next_;
     container_t rhs_;
+    bool are_diagonals_set_;
+    solver_stats_ptr stats_;
 
     explicit heat_implicit_solver_method() = delete;
 
@@ -59,10 +111,35 @@ class heat_implicit_solver_method
 
     void split(double const &time, container_t &low, container_t &diag, container_t &high);
 
+    void split(double const &time, container_t &lowest, container_t &low, container_t &diag, container_t &high,
+               container_t &uppest);
+
+    void prepare_time_factors(double const &time);
+
+    void load_diagonals(double const &time);
+
+    void load_diagonals(double const &time, tridiagonal_batch &batch);
+
+    void split(double const &time, tridiagonal_batch &batch);
+
   public:
     explicit heat_implicit_solver_method(lss_tridiagonal_solver::tridiagonal_solver_ptr const &solver_ptr,
                                          heat_coefficients_ptr const &coefficients,
-                                         grid_config_1d_ptr const &grid_config, bool is_heat_sourse_set);
+                                         grid_config_1d_ptr const &grid_config, bool is_heat_sourse_set,
+                                         solver_stats_ptr const &stats);
+
+    /**
+        @brief  Solver method of the fourth-order five-point scheme
+        @param  solver_ptr - pentadiagonal solver, it keeps its factorization while the diagonals stay the same
+        @param  coefficients - scheme coefficients
+        @param  grid_config - grid
+        @param  is_heat_sourse_set - true if heat source is set
+        @param  stats - statistics the method and its solver record into (null records nothing)
+    **/
+    explicit heat_implicit_solver_method(karawia_solver_ptr const &solver_ptr,
+                                         heat_coefficients_ptr const &coefficients,
+                                         grid_config_1d_ptr const &grid_config, bool is_heat_sourse_set,
+                                         solver_stats_ptr const &stats);
 
     ~heat_implicit_solver_method();
 
@@ -77,6 +154,50 @@ class heat_implicit_solver_method
     void solve(container_t &prev_solution, boundary_1d_pair const &boundary_pair, double const &time,
                double const &next_time, std::function<double(double, double)> const &heat_source,
                container_t &solution);
+
+    /**
+        @brief  Advances all systems of the batch by one time step in place
+        @param  batch - holds previous solutions on entry and next solutions on exit
+        @param  boundary_pairs - boundary pair of each system
+        @param  time - time
+    **/
+    void solve(tridiagonal_batch &batch, boundary_1d_pairs const &boundary_pairs, double const &time);
+
+    void solve(tridiagonal_batch &batch, boundary_1d_pairs const &boundary_pairs, double const &time,
+               double const &next_time, std::function<double(double, double)> const &heat_source);
+
+    /**
+        @brief  Sets the time step of the next solve (non-uniform time grids)
+        @param  time_step - time step
+    **/
+    void set_time_step(double time_step);
+
+    /**
+        @brief  Order of accuracy of the scheme in time (2 for Crank-Nicolson, 1 otherwise)
+    **/
+    std::size_t time_order() const;
+
+    /**
+        @brief  Solver method of Rannacher start-up taking fully implicit half-steps
+        @param  solver_ptr - solver shared with the main solver method, start-up steps all come first
+        @param  heat_data_config - heat data
+        @param  discretization_config - discretization
+        @param  grid_config - grid
+        @param  is_heat_sourse_set - true if heat source is set
+        @param  startup_steps - number of start-up steps
+        @param  stats - statistics shared with the main solver method
+        @retval solver method or null if no start-up steps are requested
+    **/
+    static sptr_t<heat_implicit_solver_method> rannacher_startup(
+        lss_tridiagonal_solver::tridiagonal_solver_ptr const &solver_ptr,
+        heat_data_transform_1d_ptr const &heat_data_config,
+        pde_discretization_config_1d_ptr const &discretization_config, grid_config_1d_ptr const &grid_config,
+        bool is_heat_sourse_set, std::size_t startup_steps, solver_stats_ptr const &stats);
+
+    static sptr_t<heat_implicit_solver_method> rannacher_startup(
+        karawia_solver_ptr const &solver_ptr, heat_data_transform_1d_ptr const &heat_data_config,
+        pde_discretization_config_1d_ptr const &discretization_config, grid_config_1d_ptr const &grid_config,
+        bool is_heat_sourse_set, std::size_t startup_steps, solver_stats_ptr const &stats);
 };
 
 using heat_implicit_solver_method_ptr = sptr_t<heat_implicit_solver_method>;
@@ -103,7 +103,7 @@ void explicit_time_loop::run_with_stepping(explicit_solver_method_ptr const &sol
                                            boundary_1d_pair const &boundary_pair, range_ptr const &time_range,
                                            std::size_t const &last_time_idx, double const time_step,
                                            traverse_direction_enum const &traverse_dir, container_t &solution,
-                                           container_2d_t &solutions)
+                                           time_slice_observer_1d const &observer)
 {
     const std::size_t sol_size = solution.size();
     // ranges and steps:
@@ -117,22 +117,22 @@ void explicit_time_loop::run_with_stepping(explicit_solver_method_ptr const &sol
     std::size_t time_idx{};
     if (traverse_dir == traverse_direction_enum::Forward)
     {
-        // store the initial solution:
-        solutions(0, solution);
+        // observe the initial solution:
+        observer(0, start_time, solution);
         time_idx = 1;
         while (time_idx <= last_time_idx)
         {
             solver_ptr->solve(solution, boundary_pair, time_idx, time, next_solution);
             solution = next_solution;
-            solutions(time_idx, solution);
+            observer(time_idx, time, solution);
             time += k;
             time_idx++;
         }
     }
     else if (traverse_dir == traverse_direction_enum::Backward)
     {
-        // store the initial solution:
-        solutions(last_time_idx, solution);
+        // observe the initial solution:
+        observer(last_time_idx, end_time, solution);
         time = end_time - k;
         time_idx = last_time_idx;
         do
@@ -140,7 +140,7 @@ void explicit_time_loop::run_with_stepping(explicit_solver_method_ptr const &sol
             time_idx--;
             solver_ptr->solve(solution, boundary_pair, time_idx, time, next_solution);
             solution = next_solution;
-            solutions(time_idx, solution);
+            observer(time_idx, time, solution);
             time -= k;
         } while (time_idx > 0);
     }
@@ -155,7 +155,7 @@ void explicit_time_loop::run_with_stepping(explicit_solver_method_ptr const &sol
                                            std::size_t const &last_time_idx, double const time_step,
                                            traverse_direction_enum const &traverse_dir,
                                            std::function<double(double, double)> const &heat_source,
-                                           container_t &solution, container_2d_t &solutions)
+                                           container_t &solution, time_slice_observer_1d const &observer)
 {
     const std::size_t sol_size = solution.size();
     // ranges and steps:
@@ -170,14 +170,14 @@ void explicit_time_loop::run_with_stepping(explicit_solver_method_ptr const &sol
     std::size_t time_idx{};
     if (traverse_dir == traverse_direction_enum::Forward)
     {
-        // store the initial solution:
-        solutions(0, solution);
+        // observe the initial solution:
+        observer(0, start_time, solution);
         time_idx = 1;
         while (time_idx <= last_time_idx)
         {
             solver_ptr->solve(solution, boundary_pair, time_idx, time, next_time, heat_source, next_solution);
             solution = next_solution;
-            solutions(time_idx, solution);
+            observer(time_idx, time, solution);
             time += k;
             next_time += k;
             time_idx++;
@@ -185,8 +185,8 @@ void explicit_time_loop::run_with_stepping(explicit_solver_method_ptr const &sol
     }
     else if (traverse_dir == traverse_direction_enum::Backward)
     {
-        // store the initial solution:
-        solutions(last_time_idx, solution);
+        // observe the initial solution:
+        observer(last_time_idx, end_time, solution);
         time = end_time - k;
         next_time = time - k;
         time_idx = last_time_idx;
@@ -195,7 +195,7 @@ void explicit_time_loop::run_with_stepping(explicit_solver_method_ptr const &sol
             time_idx--;
             solver_ptr->solve(solution, boundary_pair, time_idx, time, next_time, heat_source, next_solution);
             solution = next_solution;
-            solutions(time_idx, solution);
+            observer(time_idx, time, solution);
             time -= k;
             time -= k;
         } while (time_idx > 0);
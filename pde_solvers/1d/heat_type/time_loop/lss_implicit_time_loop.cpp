@@ -1,5 +1,7 @@
 #include "lss_implicit_time_loop.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <thrust/host_vector.h>
 
 namespace lss_pde_solvers
@@ -8,21 +10,170 @@ namespace lss_pde_solvers
 namespace one_dimensional
 {
 
+template <typename step_fn_t>
+void implicit_time_loop::traverse_time_grid(implicit_solver_method_ptr const &solver_ptr,
+                                            implicit_solver_method_ptr const &startup_solver_ptr,
+                                            std::size_t const &startup_steps, container_t const &time_points,
+                                            traverse_direction_enum const &traverse_dir, step_fn_t &&step_fn)
+{
+    const std::size_t last_time_idx = time_points.size() - 1;
+    double time{}, k{}, half_k{};
+    if (traverse_dir == traverse_direction_enum::Forward)
+    {
+        for (std::size_t time_idx = 1; time_idx <= last_time_idx; ++time_idx)
+        {
+            time = time_points[time_idx];
+            k = time - time_points[time_idx - 1];
+            if (time_idx <= startup_steps)
+            {
+                // Rannacher start-up, each leading step is taken as two fully implicit half-steps:
+                half_k = 0.5 * k;
+                startup_solver_ptr->set_time_step(half_k);
+                step_fn(startup_solver_ptr, time - half_k, time, time_idx, false);
+                step_fn(startup_solver_ptr, time, time + half_k, time_idx, true);
+                continue;
+            }
+            solver_ptr->set_time_step(k);
+            step_fn(solver_ptr, time, time + k, time_idx, true);
+        }
+        return;
+    }
+    for (std::size_t time_idx = last_time_idx; time_idx > 0; --time_idx)
+    {
+        time = time_points[time_idx - 1];
+        k = time_points[time_idx] - time;
+        if (last_time_idx - time_idx < startup_steps)
+        {
+            // Rannacher start-up, each leading step is taken as two fully implicit half-steps:
+            half_k = 0.5 * k;
+            startup_solver_ptr->set_time_step(half_k);
+            step_fn(startup_solver_ptr, time + half_k, time, time_idx - 1, false);
+            step_fn(startup_solver_ptr, time, time - half_k, time_idx - 1, true);
+            continue;
+        }
+        solver_ptr->set_time_step(k);
+        step_fn(solver_ptr, time, time - k, time_idx - 1, true);
+    }
+}
+
+template <typename step_fn_t>
+void implicit_time_loop::adapt_time_steps(implicit_solver_method_ptr const &solver_ptr,
+                                          implicit_solver_method_ptr const &startup_solver_ptr,
+                                          std::size_t const &startup_steps, range_ptr const &time_range,
+                                          double const time_step, traverse_direction_enum const &traverse_dir,
+                                          adaptive_time_stepping_config_ptr const &adaptive_time_stepping,
+                                          container_t &solution, step_fn_t &&step_fn)
+{
+    const double one = 1.0;
+    const double half = 0.5;
+    // bounds of the step change between two consecutive steps:
+    const double min_factor = 0.2;
+    const double max_factor = 5.0;
+    const double start_time = time_range->lower();
+    const double end_time = time_range->upper();
+    const double tolerance = adaptive_time_stepping->tolerance();
+    const double min_k = adaptive_time_stepping->min_time_step();
+    const double max_k = adaptive_time_stepping->max_time_step();
+    const double safety = adaptive_time_stepping->safety_factor();
+    const bool is_forward = (traverse_dir == traverse_direction_enum::Forward);
+    const double sign = is_forward ? one : -one;
+    // containers for the whole step and for the two half-steps:
+    container_t whole_solution(solution.size(), double{});
+    container_t half_solution(solution.size(), double{});
+    container_t next_solution(solution.size(), double{});
+
+    double time = is_forward ? start_time : end_time;
+    double remaining = end_time - start_time;
+    double k = std::min(std::max(time_step, min_k), max_k);
+    double next_time{}, half_time{}, error{}, factor{}, order{};
+    bool is_last{false};
+    std::size_t accepted_steps{};
+    while (remaining > 0.0)
+    {
+        is_last = (k >= remaining);
+        if (is_last)
+            k = remaining;
+        // Rannacher start-up, leading steps are taken by fully implicit solver method:
+        auto const &method_ptr = (accepted_steps < startup_steps) ? startup_solver_ptr : solver_ptr;
+        order = static_cast<double>(method_ptr->time_order());
+        next_time = is_last ? (is_forward ? end_time : start_time) : (time + sign * k);
+        half_time = time + sign * half * k;
+
+        method_ptr->set_time_step(k);
+        step_fn(method_ptr, solution, next_time, next_time + sign * k, whole_solution);
+        method_ptr->set_time_step(half * k);
+        step_fn(method_ptr, solution, half_time, half_time + sign * half * k, half_solution);
+        step_fn(method_ptr, half_solution, next_time, next_time + sign * half * k, next_solution);
+
+        // Richardson estimate of the error of the two half-steps:
+        error = double{};
+        for (std::size_t t = 0; t < solution.size(); ++t)
+            error = std::max(error, std::abs(next_solution[t] - whole_solution[t]));
+        error /= (std::pow(2.0, order) - one);
+
+        if ((error <= tolerance) || (k <= min_k))
+        {
+            solution = next_solution;
+            time = next_time;
+            remaining = is_last ? 0.0 : (is_forward ? (end_time - time) : (time - start_time));
+            accepted_steps++;
+        }
+        factor = (error > 0.0) ? safety * std::pow(tolerance / error, one / (order + one)) : max_factor;
+        factor = std::min(std::max(factor, min_factor), max_factor);
+        k = std::min(std::max(k * factor, min_k), max_k);
+    }
+}
+
 void implicit_time_loop::run(implicit_solver_method_ptr const &solver_ptr, boundary_1d_pair const &boundary_pair,
                              range_ptr const &time_range, std::size_t const &last_time_idx, double const time_step,
-                             traverse_direction_enum const &traverse_dir, container_t &solution)
+                             traverse_direction_enum const &traverse_dir, container_t &solution,
+                             implicit_solver_method_ptr const &startup_solver_ptr, std::size_t const &startup_steps,
+                             time_grid_config_ptr const &time_grid,
+                             adaptive_time_stepping_config_ptr const &adaptive_time_stepping)
 {
     const double start_time = time_range->lower();
     const double end_time = time_range->upper();
     const double k = time_step;
+    const double half_k = 0.5 * time_step;
     // container for next solution:
     container_t next_solution(solution.size(), double{});
 
+    if (time_grid != nullptr)
+    {
+        traverse_time_grid(solver_ptr, startup_solver_ptr, startup_steps, time_grid->time_points(), traverse_dir,
+                           [&](implicit_solver_method_ptr const &method_ptr, double time, double next_time,
+                               std::size_t time_idx, bool is_step_done) {
+                               method_ptr->solve(solution, boundary_pair, time, next_solution);
+                               solution = next_solution;
+                           });
+        return;
+    }
+    if (adaptive_time_stepping != nullptr)
+    {
+        adapt_time_steps(solver_ptr, startup_solver_ptr, startup_steps, time_range, time_step, traverse_dir,
+                         adaptive_time_stepping, solution,
+                         [&](implicit_solver_method_ptr const &method_ptr, container_t &prev_solution, double time,
+                             double next_time, container_t &step_solution) {
+                             method_ptr->solve(prev_solution, boundary_pair, time, step_solution);
+                         });
+        return;
+    }
+
     double time{start_time + k};
     std::size_t time_idx{};
     if (traverse_dir == traverse_direction_enum::Forward)
     {
         time_idx = 1;
+        // Rannacher start-up, each leading step is taken as two fully implicit half-steps:
+        while ((time_idx <= startup_steps) && (time_idx <= last_time_idx))
+        {
+            startup_solver_ptr->solve(solution, boundary_pair, time - half_k, next_solution);
+            solution = next_solution;
+            startup_solver_ptr->solve(solution, boundary_pair, time, next_solution);
+            solution = next_solution;
+            time += k;
+            time_idx++;
+        }
         while (time_idx <= last_time_idx)
         {
             solver_ptr->solve(solution, boundary_pair, time, next_solution);
@@ -35,33 +186,81 @@ void implicit_time_loop::run(implicit_solver_method_ptr const &solver_ptr, bound
     {
         time = end_time - k;
         time_idx = last_time_idx;
-        do
+        // Rannacher start-up, each leading step is taken as two fully implicit half-steps:
+        while ((last_time_idx - time_idx < startup_steps) && (time_idx > 0))
+        {
+            time_idx--;
+            startup_solver_ptr->solve(solution, boundary_pair, time + half_k, next_solution);
+            solution = next_solution;
+            startup_solver_ptr->solve(solution, boundary_pair, time, next_solution);
+            solution = next_solution;
+            time -= k;
+        }
+        while (time_idx > 0)
         {
             time_idx--;
             solver_ptr->solve(solution, boundary_pair, time, next_solution);
             solution = next_solution;
             time -= k;
-        } while (time_idx > 0);
+        }
     }
 }
 
 void implicit_time_loop::run(implicit_solver_method_ptr const &solver_ptr, boundary_1d_pair const &boundary_pair,
                              range_ptr const &time_range, std::size_t const &last_time_idx, double const time_step,
                              traverse_direction_enum const &traverse_dir,
-                             std::function<double(double, double)> const &heat_source, container_t &solution)
+                             std::function<double(double, double)> const &heat_source, container_t &solution,
+                             implicit_solver_method_ptr const &startup_solver_ptr, std::size_t const &startup_steps,
+                             time_grid_config_ptr const &time_grid,
+                             adaptive_time_stepping_config_ptr const &adaptive_time_stepping)
 {
     const double start_time = time_range->lower();
     const double end_time = time_range->upper();
     const double k = time_step;
+    const double half_k = 0.5 * time_step;
     // container for next solution:
     container_t next_solution(solution.size(), double{});
 
+    if (time_grid != nullptr)
+    {
+        traverse_time_grid(solver_ptr, startup_solver_ptr, startup_steps, time_grid->time_points(), traverse_dir,
+                           [&](implicit_solver_method_ptr const &method_ptr, double time, double next_time,
+                               std::size_t time_idx, bool is_step_done) {
+                               method_ptr->solve(solution, boundary_pair, time, next_time, heat_source,
+                                                 next_solution);
+                               solution = next_solution;
+                           });
+        return;
+    }
+    if (adaptive_time_stepping != nullptr)
+    {
+        adapt_time_steps(solver_ptr, startup_solver_ptr, startup_steps, time_range, time_step, traverse_dir,
+                         adaptive_time_stepping, solution,
+                         [&](implicit_solver_method_ptr const &method_ptr, container_t &prev_solution, double time,
+                             double next_time, container_t &step_solution) {
+                             method_ptr->solve(prev_solution, boundary_pair, time, next_time, heat_source,
+                                               step_solution);
+                         });
+        return;
+    }
+
     double time{start_time + k};
     double next_time{time + k};
     std::size_t time_idx{};
     if (traverse_dir == traverse_direction_enum::Forward)
     {
         time_idx = 1;
+        // Rannacher start-up, each leading step is taken as two fully implicit half-steps:
+        while ((time_idx <= startup_steps) && (time_idx <= last_time_idx))
+        {
+            startup_solver_ptr->solve(solution, boundary_pair, time - half_k, time, heat_source, next_solution);
+            solution = next_solution;
+            startup_solver_ptr->solve(solution, boundary_pair, time, time + half_k, heat_source, next_solution);
+            solution = next_solution;
+            time += k;
+            next_time += k;
+            time_idx++;
+        }
         while (time_idx <= last_time_idx)
         {
             solver_ptr->solve(solution, boundary_pair, time, next_time, heat_source, next_solution);
@@ -76,14 +275,25 @@ void implicit_time_loop::run(implicit_solver_method_ptr const &solver_ptr, bound
         time = end_time - k;
         next_time = time - k;
         time_idx = last_time_idx;
-        do
+        // Rannacher start-up, each leading step is taken as two fully implicit half-steps:
+        while ((last_time_idx - time_idx < startup_steps) && (time_idx > 0))
+        {
+            time_idx--;
+            startup_solver_ptr->solve(solution, boundary_pair, time + half_k, time, heat_source, next_solution);
+            solution = next_solution;
+            startup_solver_ptr->solve(solution, boundary_pair, time, time - half_k, heat_source, next_solution);
+            solution = next_solution;
+            time -= k;
+            next_time -= k;
+        }
+        while (time_idx > 0)
         {
             time_idx--;
             solver_ptr->solve(solution, boundary_pair, time, next_time, heat_source, next_solution);
             solution = next_solution;
             time -= k;
             next_time -= k;
-        } while (time_idx > 0);
+        }
     }
 }
 
@@ -91,25 +301,57 @@ void implicit_time_loop::run_with_stepping(implicit_solver_method_ptr const &sol
                                            boundary_1d_pair const &boundary_pair, range_ptr const &time_range,
                                            std::size_t const &last_time_idx, double const time_step,
                                            traverse_direction_enum const &traverse_dir, container_t &solution,
-                                           container_2d<by_enum::Row> &solutions)
+                                           time_slice_observer_1d const &observer,
+                                           implicit_solver_method_ptr const &startup_solver_ptr,
+                                           std::size_t const &startup_steps, time_grid_config_ptr const &time_grid)
 {
     const double start_time = time_range->lower();
     const double end_time = time_range->upper();
     const double k = time_step;
+    const double half_k = 0.5 * time_step;
     // container for next solution:
     container_t next_solution(solution.size(), double{});
 
+    if (time_grid != nullptr)
+    {
+        // observe the initial solution:
+        if (traverse_dir == traverse_direction_enum::Forward)
+            observer(0, start_time, solution);
+        else
+            observer(last_time_idx, end_time, solution);
+        traverse_time_grid(solver_ptr, startup_solver_ptr, startup_steps, time_grid->time_points(), traverse_dir,
+                           [&](implicit_solver_method_ptr const &method_ptr, double time, double next_time,
+                               std::size_t time_idx, bool is_step_done) {
+                               method_ptr->solve(solution, boundary_pair, time, next_solution);
+                               if (is_step_done)
+                                   observer(time_idx, time, next_solution);
+                               solution = next_solution;
+                           });
+        return;
+    }
+
     double time{start_time + k};
     std::size_t time_idx{};
     if (traverse_dir == traverse_direction_enum::Forward)
     {
-        // store the initial solution:
-        solutions(0, solution);
+        // observe the initial solution:
+        observer(0, start_time, solution);
         time_idx = 1;
+        // Rannacher start-up, each leading step is taken as two fully implicit half-steps:
+        while ((time_idx <= startup_steps) && (time_idx <= last_time_idx))
+        {
+            startup_solver_ptr->solve(solution, boundary_pair, time - half_k, next_solution);
+            solution = next_solution;
+            startup_solver_ptr->solve(solution, boundary_pair, time, next_solution);
+            observer(time_idx, time, next_solution);
+            solution = next_solution;
+            time += k;
+            time_idx++;
+        }
         while (time_idx <= last_time_idx)
         {
             solver_ptr->solve(solution, boundary_pair, time, next_solution);
-            solutions(time_idx, next_solution);
+            observer(time_idx, time, next_solution);
             solution = next_solution;
             time += k;
             time_idx++;
@@ -117,18 +359,29 @@ void implicit_time_loop::run_with_stepping(implicit_solver_method_ptr const &sol
     }
     else
     {
-        // store the initial solution:
-        solutions(last_time_idx, solution);
+        // observe the initial solution:
+        observer(last_time_idx, end_time, solution);
         time = end_time - k;
         time_idx = last_time_idx;
-        do
+        // Rannacher start-up, each leading step is taken as two fully implicit half-steps:
+        while ((last_time_idx - time_idx < startup_steps) && (time_idx > 0))
+        {
+            time_idx--;
+            startup_solver_ptr->solve(solution, boundary_pair, time + half_k, next_solution);
+            solution = next_solution;
+            startup_solver_ptr->solve(solution, boundary_pair, time, next_solution);
+            observer(time_idx, time, next_solution);
+            solution = next_solution;
+            time -= k;
+        }
+        while (time_idx > 0)
         {
             time_idx--;
             solver_ptr->solve(solution, boundary_pair, time, next_solution);
-            solutions(time_idx, next_solution);
+            observer(time_idx, time, next_solution);
             solution = next_solution;
             time -= k;
-        } while (time_idx > 0);
+        }
     }
 }
 
@@ -137,26 +390,60 @@ void implicit_time_loop::run_with_stepping(implicit_solver_method_ptr const &sol
                                            std::size_t const &last_time_idx, double const time_step,
                                            traverse_direction_enum const &traverse_dir,
                                            std::function<double(double, double)> const &heat_source,
-                                           container_t &solution, container_2d<by_enum::Row> &solutions)
+                                           container_t &solution, time_slice_observer_1d const &observer,
+                                           implicit_solver_method_ptr const &startup_solver_ptr,
+                                           std::size_t const &startup_steps, time_grid_config_ptr const &time_grid)
 {
     const double start_time = time_range->lower();
     const double end_time = time_range->upper();
     const double k = time_step;
+    const double half_k = 0.5 * time_step;
     // container for next solution:
     container_t next_solution(solution.size(), double{});
 
+    if (time_grid != nullptr)
+    {
+        // observe the initial solution:
+        if (traverse_dir == traverse_direction_enum::Forward)
+            observer(0, start_time, solution);
+        else
+            observer(last_time_idx, end_time, solution);
+        traverse_time_grid(solver_ptr, startup_solver_ptr, startup_steps, time_grid->time_points(), traverse_dir,
+                           [&](implicit_solver_method_ptr const &method_ptr, double time, double next_time,
+                               std::size_t time_idx, bool is_step_done) {
+                               method_ptr->solve(solution, boundary_pair, time, next_time, heat_source,
+                                                 next_solution);
+                               if (is_step_done)
+                                   observer(time_idx, time, next_solution);
+                               solution = next_solution;
+                           });
+        return;
+    }
+
     double time{start_time + k};
     double next_time{time + k};
     std::size_t time_idx{};
     if (traverse_dir == traverse_direction_enum::Forward)
     {
-        // store the initial solution:
-        solutions(0, solution);
+        // observe the initial solution:
+        observer(0, start_time, solution);
         time_idx = 1;
+        // Rannacher start-up, each leading step is taken as two fully implicit half-steps:
+        while ((time_idx <= startup_steps) && (time_idx <= last_time_idx))
+        {
+            startup_solver_ptr->solve(solution, boundary_pair, time - half_k, time, heat_source, next_solution);
+            solution = next_solution;
+            startup_solver_ptr->solve(solution, boundary_pair, time, time + half_k, heat_source, next_solution);
+            observer(time_idx, time, next_solution);
+            solution = next_solution;
+            time += k;
+            next_time += k;
+            time_idx++;
+        }
         while (time_idx <= last_time_idx)
         {
             solver_ptr->solve(solution, boundary_pair, time, next_time, heat_source, next_solution);
-            solutions(time_idx, next_solution);
+            observer(time_idx, time, next_solution);
             solution = next_solution;
             time += k;
             next_time += k;
@@ -165,20 +452,164 @@ void implicit_time_loop::run_with_stepping(implicit_solver_method_ptr const &sol
     }
     else
     {
-        // store the initial solution:
-        solutions(last_time_idx, solution);
+        // observe the initial solution:
+        observer(last_time_idx, end_time, solution);
         time = end_time - k;
         next_time = time - k;
         time_idx = last_time_idx;
-        do
+        // Rannacher start-up, each leading step is taken as two fully implicit half-steps:
+        while ((last_time_idx - time_idx < startup_steps) && (time_idx > 0))
+        {
+            time_idx--;
+            startup_solver_ptr->solve(solution, boundary_pair, time + half_k, time, heat_source, next_solution);
+            solution = next_solution;
+            startup_solver_ptr->solve(solution, boundary_pair, time, time - half_k, heat_source, next_solution);
+            observer(time_idx, time, next_solution);
+            solution = next_solution;
+            time -= k;
+            next_time -= k;
+        }
+        while (time_idx > 0)
         {
             time_idx--;
             solver_ptr->solve(solution, boundary_pair, time, next_time, heat_source, next_solution);
-            solutions(time_idx, next_solution);
+            observer(time_idx, time, next_solution);
             solution = next_solution;
             time -= k;
             next_time -= k;
-        } while (time_idx > 0);
+        }
+    }
+}
+
+void implicit_time_loop::run(implicit_solver_method_ptr const &solver_ptr, boundary_1d_pairs const &boundary_pairs,
+                             range_ptr const &time_range, std::size_t const &last_time_idx, double const time_step,
+                             traverse_direction_enum const &traverse_dir, tridiagonal_batch &batch,
+                             implicit_solver_method_ptr const &startup_solver_ptr, std::size_t const &startup_steps,
+                             time_grid_config_ptr const &time_grid)
+{
+    const double start_time = time_range->lower();
+    const double end_time = time_range->upper();
+    const double k = time_step;
+    const double half_k = 0.5 * time_step;
+
+    if (time_grid != nullptr)
+    {
+        traverse_time_grid(solver_ptr, startup_solver_ptr, startup_steps, time_grid->time_points(), traverse_dir,
+                           [&](implicit_solver_method_ptr const &method_ptr, double time, double next_time,
+                               std::size_t time_idx, bool is_step_done) {
+                               method_ptr->solve(batch, boundary_pairs, time);
+                           });
+        return;
+    }
+
+    // batch is advanced in place so no container for next solution is needed:
+    double time{start_time + k};
+    std::size_t time_idx{};
+    if (traverse_dir == traverse_direction_enum::Forward)
+    {
+        time_idx = 1;
+        // Rannacher start-up, each leading step is taken as two fully implicit half-steps:
+        while ((time_idx <= startup_steps) && (time_idx <= last_time_idx))
+        {
+            startup_solver_ptr->solve(batch, boundary_pairs, time - half_k);
+            startup_solver_ptr->solve(batch, boundary_pairs, time);
+            time += k;
+            time_idx++;
+        }
+        while (time_idx <= last_time_idx)
+        {
+            solver_ptr->solve(batch, boundary_pairs, time);
+            time += k;
+            time_idx++;
+        }
+    }
+    else
+    {
+        time = end_time - k;
+        time_idx = last_time_idx;
+        // Rannacher start-up, each leading step is taken as two fully implicit half-steps:
+        while ((last_time_idx - time_idx < startup_steps) && (time_idx > 0))
+        {
+            time_idx--;
+            startup_solver_ptr->solve(batch, boundary_pairs, time + half_k);
+            startup_solver_ptr->solve(batch, boundary_pairs, time);
+            time -= k;
+        }
+        while (time_idx > 0)
+        {
+            time_idx--;
+            solver_ptr->solve(batch, boundary_pairs, time);
+            time -= k;
+        }
+    }
+}
+
+void implicit_time_loop::run(implicit_solver_method_ptr const &solver_ptr, boundary_1d_pairs const &boundary_pairs,
+                             range_ptr const &time_range, std::size_t const &last_time_idx, double const time_step,
+                             traverse_direction_enum const &traverse_dir,
+                             std::function<double(double, double)> const &heat_source, tridiagonal_batch &batch,
+                             implicit_solver_method_ptr const &startup_solver_ptr, std::size_t const &startup_steps,
+                             time_grid_config_ptr const &time_grid)
+{
+    const double start_time = time_range->lower();
+    const double end_time = time_range->upper();
+    const double k = time_step;
+    const double half_k = 0.5 * time_step;
+
+    if (time_grid != nullptr)
+    {
+        traverse_time_grid(solver_ptr, startup_solver_ptr, startup_steps, time_grid->time_points(), traverse_dir,
+                           [&](implicit_solver_method_ptr const &method_ptr, double time, double next_time,
+                               std::size_t time_idx, bool is_step_done) {
+                               method_ptr->solve(batch, boundary_pairs, time, next_time, heat_source);
+                           });
+        return;
+    }
+
+    double time{start_time + k};
+    double next_time{time + k};
+    std::size_t time_idx{};
+    if (traverse_dir == traverse_direction_enum::Forward)
+    {
+        time_idx = 1;
+        // Rannacher start-up, each leading step is taken as two fully implicit half-steps:
+        while ((time_idx <= startup_steps) && (time_idx <= last_time_idx))
+        {
+            startup_solver_ptr->solve(batch, boundary_pairs, time - half_k, time, heat_source);
+            startup_solver_ptr->solve(batch, boundary_pairs, time, time + half_k, heat_source);
+            time += k;
+            next_time += k;
+            time_idx++;
+        }
+        while (time_idx <= last_time_idx)
+        {
+            solver_ptr->solve(batch, boundary_pairs, time, next_time, heat_source);
+            time += k;
+            next_time += k;
+            time_idx++;
+        }
+    }
+    else
+    {
+        time = end_time - k;
+        next_time = time - k;
+        time_idx = last_time_idx;
+        // Rannacher start-up, each leading step is taken as two fully implicit half-steps:
+        while ((last_time_idx - time_idx < startup_steps) && (time_idx > 0))
+        {
+            time_idx--;
+            startup_solver_ptr->solve(batch, boundary_pairs, time + half_k, time, heat_source);
+            startup_solver_ptr->solve(batch, boundary_pairs, time, time - half_k, heat_source);
+            time -= k;
+            next_time -= k;
+        }
+        while (time_idx > 0)
+        {
+            time_idx--;
+            solver_ptr->solve(batch, boundary_pairs, time, next_time, heat_source);
+            time -= k;
+            next_time -= k;
+        }
     }
 }
 
@@ -7,6 +7,8 @@
 #include "../../../../common/lss_utility.hpp"
 #include "../../../../containers/lss_container_2d.hpp"
 #include "../../../../discretization/lss_discretization.hpp"
+#include "../../../lss_adaptive_time_stepping_config.hpp"
+#include "../../../lss_time_slice_observer.hpp"
 #include "../solver_method/lss_heat_implicit_solver_method.hpp"
 
 namespace lss_pde_solvers
@@ -16,10 +18,12 @@ namespace one_dimensional
 {
 
 using lss_boundary::boundary_1d_pair;
+using lss_boundary::boundary_1d_pairs;
 using lss_containers::container_2d;
 using lss_enumerations::traverse_direction_enum;
 using lss_utility::container_t;
 using lss_utility::range_ptr;
+using lss_tridiagonal_solver::tridiagonal_batch;
 using lss_utility::sptr_t;
 
 using container_2d_t = container_2d<by_enum::Row>;
@@ -31,26 +35,121 @@ class implicit_time_loop
 {
     using implicit_solver_method_ptr = sptr_t<heat_implicit_solver_method>;
 
+    /**
+        @brief  Steps through the points of non-uniform time grid, the time step of the solver methods is reset
+                before every step and step_fn(solver method, time, next time, time index, is step done) performs
+                each solve
+    **/
+    template <typename step_fn_t>
+    static void traverse_time_grid(implicit_solver_method_ptr const &solver_ptr,
+                                   implicit_solver_method_ptr const &startup_solver_ptr,
+                                   std::size_t const &startup_steps, container_t const &time_points,
+                                   traverse_direction_enum const &traverse_dir, step_fn_t &&step_fn);
+
+    /**
+        @brief  Steps through the time range with local error control, every step is taken once as a whole and
+                once as two half-steps, the half-steps are kept when their estimated error meets the tolerance
+                and the next time step follows from the estimate. step_fn(solver method, previous solution,
+                time, next time, solution) performs each solve
+    **/
+    template <typename step_fn_t>
+    static void adapt_time_steps(implicit_solver_method_ptr const &solver_ptr,
+                                 implicit_solver_method_ptr const &startup_solver_ptr, std::size_t const &startup_steps,
+                                 range_ptr const &time_range, double const time_step,
+                                 traverse_direction_enum const &traverse_dir,
+                                 adaptive_time_stepping_config_ptr const &adaptive_time_stepping,
+                                 container_t &solution, step_fn_t &&step_fn);
+
   public:
+    /**
+        @brief  Runs the time loop
+        @param  solver_ptr - solver method
+        @param  boundary_pair - boundary pair
+        @param  time_range - time range
+        @param  last_time_idx - last time index
+        @param  time_step - time step
+        @param  traverse_dir - traverse direction
+        @param  solution - holds initial solution on entry and final solution on exit
+        @param  startup_solver_ptr - fully implicit solver method advancing by half of the time step
+        @param  startup_steps - number of leading time steps taken as two half-steps of startup_solver_ptr
+        @param  time_grid - non-uniform time grid, replaces time_range and time_step when set
+        @param  adaptive_time_stepping - local error control, time_step is then only the initial time step
+    **/
     static void run(implicit_solver_method_ptr const &solver_ptr, boundary_1d_pair const &boundary_pair,
                     range_ptr const &time_range, std::size_t const &last_time_idx, double const time_step,
-                    traverse_direction_enum const &traverse_dir, container_t &solution);
+                    traverse_direction_enum const &traverse_dir, container_t &solution,
+                    implicit_solver_method_ptr const &startup_solver_ptr = nullptr,
+                    std::size_t const &startup_steps = std::size_t(0),
+                    time_grid_config_ptr const &time_grid = nullptr,
+                    adaptive_time_stepping_config_ptr const &adaptive_time_stepping = nullptr);
 
     static void run(implicit_solver_method_ptr const &solver_ptr, boundary_1d_pair const &boundary_pair,
                     range_ptr const &time_range, std::size_t const &last_time_idx, double const time_step,
                     traverse_direction_enum const &traverse_dir,
-                    std::function<double(double, double)> const &heat_source, container_t &solution);
+                    std::function<double(double, double)> const &heat_source, container_t &solution,
+                    implicit_solver_method_ptr const &startup_solver_ptr = nullptr,
+                    std::size_t const &startup_steps = std::size_t(0),
+                    time_grid_config_ptr const &time_grid = nullptr,
+                    adaptive_time_stepping_config_ptr const &adaptive_time_stepping = nullptr);
 
+    /**
+        @brief  Runs the time loop and hands every time slice, including the initial one, to the observer
+        @param  solver_ptr - solver method
+        @param  boundary_pair - boundary pair
+        @param  time_range - time range
+        @param  last_time_idx - last time index
+        @param  time_step - time step
+        @param  traverse_dir - traverse direction
+        @param  solution - holds initial solution on entry and final solution on exit
+        @param  observer - receives time slices that pass its decimation
+        @param  startup_solver_ptr - fully implicit solver method advancing by half of the time step
+        @param  startup_steps - number of leading time steps taken as two half-steps of startup_solver_ptr
+        @param  time_grid - non-uniform time grid, replaces time_range and time_step when set
+    **/
     static void run_with_stepping(implicit_solver_method_ptr const &solver_ptr, boundary_1d_pair const &boundary_pair,
                                   range_ptr const &time_range, std::size_t const &last_time_idx, double const time_step,
                                   traverse_direction_enum const &traverse_dir, container_t &solution,
-                                  container_2d<by_enum::Row> &solutions);
+                                  time_slice_observer_1d const &observer,
+                                  implicit_solver_method_ptr const &startup_solver_ptr = nullptr,
+                                  std::size_t const &startup_steps = std::size_t(0),
+                                  time_grid_config_ptr const &time_grid = nullptr);
 
     static void run_with_stepping(implicit_solver_method_ptr const &solver_ptr, boundary_1d_pair const &boundary_pair,
                                   range_ptr const &time_range, std::size_t const &last_time_idx, double const time_step,
                                   traverse_direction_enum const &traverse_dir,
                                   std::function<double(double, double)> const &heat_source, container_t &solution,
-                                  container_2d<by_enum::Row> &solutions);
+                                  time_slice_observer_1d const &observer,
+                                  implicit_solver_method_ptr const &startup_solver_ptr = nullptr,
+                                  std::size_t const &startup_steps = std::size_t(0),
+                                  time_grid_config_ptr const &time_grid = nullptr);
+
+    /**
+        @brief  Advances all systems of the batch through the time range
+        @param  solver_ptr - solver method shared by all systems
+        @param  boundary_pairs - boundary pair of each system
+        @param  time_range - time range
+        @param  last_time_idx - last time index
+        @param  time_step - time step
+        @param  traverse_dir - traverse direction
+        @param  batch - holds initial solutions on entry and final solutions on exit
+        @param  startup_solver_ptr - fully implicit solver method advancing by half of the time step
+        @param  startup_steps - number of leading time steps taken as two half-steps of startup_solver_ptr
+        @param  time_grid - non-uniform time grid, replaces time_range and time_step when set
+    **/
+    static void run(implicit_solver_method_ptr const &solver_ptr, boundary_1d_pairs const &boundary_pairs,
+                    range_ptr const &time_range, std::size_t const &last_time_idx, double const time_step,
+                    traverse_direction_enum const &traverse_dir, tridiagonal_batch &batch,
+                    implicit_solver_method_ptr const &startup_solver_ptr = nullptr,
+                    std::size_t const &startup_steps = std::size_t(0),
+                    time_grid_config_ptr const &time_grid = nullptr);
+
+    static void run(implicit_solver_method_ptr const &solver_ptr, boundary_1d_pairs const &boundary_pairs,
+                    range_ptr const &time_range, std::size_t const &last_time_idx, double const time_step,
+                    traverse_direction_enum const &traverse_dir,
+                    std::function<double(double, double)> const &heat_source, tridiagonal_batch &batch,
+                    implicit_solver_method_ptr const &startup_solver_ptr = nullptr,
+                    std::size_t const &startup_steps = std::size_t(0),
+                    time_grid_config_ptr const &time_grid = nullptr);
 };
 
 } // namespace one_dimensional
@@ -41,6 +41,25 @@ void wave_explicit_coefficients::initialize_coefficients(wave_data_transform_1d_
     b_ = b;
     C_ = [=](double t, double x) { return ((two * (lambda_ - (delta_ * b(t, x) - half * d(t, x)))) / E_(t, x)); };
     D_ = [=](double t, double x) { return ((lambda_ - a(t, x) * gamma_) / E_(t, x)); };
+    is_time_homogeneous_ = wave_data_config->is_time_homogeneous();
+}
+
+void wave_explicit_coefficients::initialize_tables(double time)
+{
+    A_table_.resize(space_size_);
+    B_table_.resize(space_size_);
+    C_table_.resize(space_size_);
+    D_table_.resize(space_size_);
+    const double h = 1.0 / (space_size_ - 1);
+    double x{};
+    for (std::size_t t = 0; t < space_size_; ++t)
+    {
+        x = h * t;
+        A_table_[t] = A_(time, x);
+        B_table_[t] = B_(time, x);
+        C_table_[t] = C_(time, x);
+        D_table_[t] = D_(time, x);
+    }
 }
 
 wave_explicit_coefficients::wave_explicit_coefficients(wave_data_transform_1d_ptr const &wave_data_config,
@@ -48,6 +67,10 @@ wave_explicit_coefficients::wave_explicit_coefficients(wave_data_transform_1d_pt
 {
     initialize(discretization_config);
     initialize_coefficients(wave_data_config);
+    if (is_time_homogeneous_)
+    {
+        initialize_tables(discretization_config->time_range()->lower());
+    }
 }
 
 std::function<double(double, double)> wave_explicit_coefficients::modified_wave_source(
@@ -12,6 +12,7 @@ namespace lss_pde_solvers
 
 namespace one_dimensional
 {
+using lss_utility::container_t;
 using lss_utility::range_ptr;
 using lss_utility::sptr_t;
 
@@ -29,18 +30,46 @@ struct wave_explicit_coefficients
     std::function<double(double, double)> C_;
     std::function<double(double, double)> D_;
     std::function<double(double, double)> E_;
+    // tabulated coefficients (filled only for time-homogeneous data):
+    bool is_time_homogeneous_;
+    container_t A_table_;
+    container_t B_table_;
+    container_t C_table_;
+    container_t D_table_;
 
   private:
     void initialize(pde_discretization_config_1d_ptr const &discretization_config);
 
     void initialize_coefficients(wave_data_transform_1d_ptr const &wave_data_config);
 
+    void initialize_tables(double time);
+
   public:
     wave_explicit_coefficients() = delete;
 
     explicit wave_explicit_coefficients(wave_data_transform_1d_ptr const &wave_data_config,
                                         pde_discretization_config_1d_ptr const &discretization_config);
 
+    inline double A(double time, double x, std::size_t idx) const
+    {
+        return (is_time_homogeneous_ ? A_table_[idx] : A_(time, x));
+    }
+
+    inline double B(double time, double x, std::size_t idx) const
+    {
+        return (is_time_homogeneous_ ? B_table_[idx] : B_(time, x));
+    }
+
+    inline double C(double time, double x, std::size_t idx) const
+    {
+        return (is_time_homogeneous_ ? C_table_[idx] : C_(time, x));
+    }
+
+    inline double D(double time, double x, std::size_t idx) const
+    {
+        return (is_time_homogeneous_ ? D_table_[idx] : D_(time, x));
+    }
+
     std::function<double(double, double)> modified_wave_source(
         std::function<double(double, double)> const &wave_source) const;
 };
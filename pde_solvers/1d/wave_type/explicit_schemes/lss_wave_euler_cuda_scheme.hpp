@@ -62,7 +62,7 @@ class wave_euler_cuda_scheme
 
     void operator()(container_t &prev_solution_0, container_t &prev_solution_1, container_t &next_solution,
                     bool is_wave_sourse_set, std::function<double(double, double)> const &wave_source,
-                    traverse_direction_enum traverse_dir, container_2d<by_enum::Row> &solutions);
+                    traverse_direction_enum traverse_dir, time_slice_observer_1d const &observer);
 };
 
 } // namespace one_dimensional
@@ -74,7 +74,7 @@ void wave_euler_scheme::operator()(container_t &prev_solution_0, container_t &pr
 void wave_euler_scheme::operator()(container_t &prev_solution_0, container_t &prev_solution_1,
                                    container_t &next_solution, bool is_wave_sourse_set,
                                    std::function<double(double, double)> const &wave_source,
-                                   traverse_direction_enum traverse_dir, container_2d<by_enum::Row> &solutions)
+                                   traverse_direction_enum traverse_dir, time_slice_observer_1d const &observer)
 {
     auto const &timer = discretization_cfg_->time_range();
     const double k = discretization_cfg_->time_step();
@@ -86,13 +86,13 @@ void wave_euler_scheme::operator()(container_t &prev_solution_0, container_t &pr
     {
         wave_explicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, timer, last_time_idx, k,
                                                    traverse_dir, prev_solution_0, prev_solution_1, wave_source,
-                                                   next_solution, solutions);
+                                                   next_solution, observer);
     }
     else
     {
         wave_explicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, timer, last_time_idx, k,
                                                    traverse_dir, prev_solution_0, prev_solution_1, next_solution,
-                                                   solutions);
+                                                   observer);
     }
 }
 
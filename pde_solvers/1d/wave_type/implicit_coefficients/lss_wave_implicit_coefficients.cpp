@@ -14,6 +14,11 @@ void wave_implicit_coefficients::initialize(pde_discretization_config_1d_ptr con
     k_ = discretization_config->time_step();
     // size of spaces discretization:
     space_size_ = discretization_config->number_of_space_points();
+    initialize_scheme_coefficients();
+}
+
+void wave_implicit_coefficients::initialize_scheme_coefficients()
+{
     const double one = 1.0;
     const double two = 2.0;
     const double h = one / (space_size_ - 1);
@@ -40,6 +45,53 @@ void wave_implicit_coefficients::initialize_coefficients(wave_data_transform_1d_
     C_ = [=](double t, double x) { return half * (delta_ * b(t, x) - half * d(t, x)); };
     D_ = [=](double t, double x) { return (lambda_ - gamma_ * a(t, x)); };
     E_ = [=](double t, double x) { return (lambda_ + gamma_ * a(t, x)); };
+    is_time_homogeneous_ = wave_data_config->is_time_homogeneous();
+    is_separable_ = wave_data_config->is_separable();
+}
+
+void wave_implicit_coefficients::initialize_tables(double time)
+{
+    A_table_.resize(space_size_);
+    B_table_.resize(space_size_);
+    C_table_.resize(space_size_);
+    D_table_.resize(space_size_);
+    E_table_.resize(space_size_);
+    const double h = 1.0 / (space_size_ - 1);
+    double x{};
+    for (std::size_t t = 0; t < space_size_; ++t)
+    {
+        x = h * t;
+        A_table_[t] = A_(time, x);
+        B_table_[t] = B_(time, x);
+        C_table_[t] = C_(time, x);
+        D_table_[t] = D_(time, x);
+        E_table_[t] = E_(time, x);
+    }
+}
+
+void wave_implicit_coefficients::initialize_separable(wave_data_transform_1d_ptr const &wave_data_config)
+{
+    auto const &parts = wave_data_config->separable_parts();
+    separable_ = separable_coefficients(wave_data_config->time_factors(), 4);
+    container_t a(space_size_), b(space_size_), c(space_size_), d(space_size_);
+    const double h = 1.0 / (space_size_ - 1);
+    double x{};
+    for (std::size_t p = 0; p < parts.size(); ++p)
+    {
+        // parts are time-homogeneous:
+        for (std::size_t t = 0; t < space_size_; ++t)
+        {
+            x = h * t;
+            a[t] = parts[p]->a_coefficient()(0.0, x);
+            b[t] = parts[p]->b_coefficient()(0.0, x);
+            c[t] = parts[p]->c_coefficient()(0.0, x);
+            d[t] = parts[p]->d_coefficient()(0.0, x);
+        }
+        separable_.add_part(0, p, a);
+        separable_.add_part(1, p, b);
+        separable_.add_part(2, p, c);
+        separable_.add_part(3, p, d);
+    }
 }
 
 wave_implicit_coefficients::wave_implicit_coefficients(wave_data_transform_1d_ptr const &wave_data_config,
@@ -47,6 +99,33 @@ wave_implicit_coefficients::wave_implicit_coefficients(wave_data_transform_1d_pt
 {
     initialize(discretization_config);
     initialize_coefficients(wave_data_config);
+    if (is_time_homogeneous_)
+    {
+        table_time_ = discretization_config->time_range()->lower();
+        initialize_tables(table_time_);
+    }
+    else if (is_separable_)
+    {
+        initialize_separable(wave_data_config);
+    }
+}
+
+void wave_implicit_coefficients::set_time_step(double time_step)
+{
+    k_ = time_step;
+    initialize_scheme_coefficients();
+    if (is_time_homogeneous_)
+    {
+        initialize_tables(table_time_);
+    }
+}
+
+void wave_implicit_coefficients::prepare_time_factors(double time)
+{
+    if (is_separable_ && !is_time_homogeneous_)
+    {
+        separable_.prepare(time);
+    }
 }
 
 } // namespace one_dimensional
@@ -6,6 +6,7 @@
 #include "../../../../common/lss_macros.hpp"
 #include "../../../../discretization/lss_discretization.hpp"
 #include "../../../lss_pde_discretization_config.hpp"
+#include "../../../lss_separable_coefficients.hpp"
 #include "../../../transformation/lss_wave_data_transform.hpp"
 
 namespace lss_pde_solvers
@@ -13,6 +14,7 @@ namespace lss_pde_solvers
 
 namespace one_dimensional
 {
+using lss_utility::container_t;
 using lss_utility::range_ptr;
 using lss_utility::sptr_t;
 
@@ -29,17 +31,91 @@ struct wave_implicit_coefficients
     std::function<double(double, double)> C_;
     std::function<double(double, double)> D_;
     std::function<double(double, double)> E_;
+    // tabulated coefficients (filled only for time-homogeneous data):
+    bool is_time_homogeneous_;
+    double table_time_;
+    container_t A_table_;
+    container_t B_table_;
+    container_t C_table_;
+    container_t D_table_;
+    container_t E_table_;
+    // tabulated spatial parts of a, b, c, d (filled only for separable data):
+    bool is_separable_;
+    separable_coefficients separable_;
 
   private:
     void initialize(pde_discretization_config_1d_ptr const &discretization_config);
 
+    void initialize_scheme_coefficients();
+
     void initialize_coefficients(wave_data_transform_1d_ptr const &wave_data_config);
 
+    void initialize_tables(double time);
+
+    void initialize_separable(wave_data_transform_1d_ptr const &wave_data_config);
+
   public:
     wave_implicit_coefficients() = delete;
 
     explicit wave_implicit_coefficients(wave_data_transform_1d_ptr const &wave_data_config,
                                         pde_discretization_config_1d_ptr const &discretization_config);
+
+    /**
+        @brief  Resets the time step the coefficients advance by (used by adaptive time stepping)
+        @param  time_step - new time step
+    **/
+    void set_time_step(double time_step);
+
+    /**
+        @brief  Evaluates time factors of separable data once for given time
+        @param  time - time the coefficients are read at next
+    **/
+    void prepare_time_factors(double time);
+
+    inline double A(double time, double x, std::size_t idx) const
+    {
+        if (is_time_homogeneous_)
+            return A_table_[idx];
+        if (is_separable_)
+            return 0.25 * (delta_ * separable_.value(1, time, idx) - rho_ * separable_.value(2, time, idx));
+        return A_(time, x);
+    }
+
+    inline double B(double time, double x, std::size_t idx) const
+    {
+        if (is_time_homogeneous_)
+            return B_table_[idx];
+        if (is_separable_)
+            return 0.25 * (delta_ * separable_.value(1, time, idx) + rho_ * separable_.value(2, time, idx));
+        return B_(time, x);
+    }
+
+    inline double C(double time, double x, std::size_t idx) const
+    {
+        if (is_time_homogeneous_)
+            return C_table_[idx];
+        if (is_separable_)
+            return 0.5 * (delta_ * separable_.value(1, time, idx) - 0.5 * separable_.value(3, time, idx));
+        return C_(time, x);
+    }
+
+    inline double D(double time, double x, std::size_t idx) const
+    {
+        if (is_time_homogeneous_)
+            return D_table_[idx];
+        if (is_separable_)
+            return (lambda_ - gamma_ * separable_.value(0, time, idx));
+        return D_(time, x);
+    }
+
+    inline double E(double time, double x, std::size_t idx) const
+    {
+        if (is_time_homogeneous_)
+            return E_table_[idx];
+        if (is_separable_)
+            return (lambda_ + gamma_ * separable_.value(0, time, idx));
+        return E_(time, x);
+    }
 };
 
 using wave_implicit_coefficients_ptr = sptr_t<wave_implicit_coefficients>;
@@ -28,6 +28,7 @@ void wave_equation::initialize(wave_data_config_1d_ptr const &wave_data_cfg,
 {
     LSS_VERIFY(wave_data_cfg, "wave_data_config must not be null");
     LSS_VERIFY(discretization_cfg_, "discretization_config must not be null");
+    LSS_ASSERT(discretization_cfg_->time_grid() == nullptr, "Non-uniform time grid is not supported by wave solvers");
     LSS_VERIFY(std::get<0>(boundary_pair), "boundary_pair.first must not be null");
     LSS_VERIFY(std::get<1>(boundary_pair), "boundary_pair.second must not be null");
     LSS_VERIFY(solver_cfg_, "solver_config must not be null");
@@ -171,6 +172,21 @@ void wave_equation::solve(container_2d<by_enum::Row> &solutions)
     // This is the proper size of the container:
     LSS_ASSERT((solutions.rows() == time_size) && (solutions.columns() == space_size),
                "The input solution 2D container must have the correct size");
+    // every time slice is stored as a row:
+    auto const observer = std::make_shared<time_slice_observer_1d>(
+        [&](std::size_t time_idx, double time, container_t const &slice) { solutions.row(time_idx).copy_from(slice); });
+    container_t solution(space_size, double{});
+    solve(solution, observer);
+}
+
+void wave_equation::solve(container_t &solution, time_slice_observer_1d_ptr const &observer)
+{
+    LSS_VERIFY(observer, "observer must not be null");
+    LSS_ASSERT(solver_cfg_->adaptive_time_stepping() == nullptr,
+               "Adaptive time stepping supports only the final solution");
+    // size of space discretization:
+    const std::size_t space_size = discretization_cfg_->number_of_space_points();
+    LSS_ASSERT(solution.size() == space_size, "The input solution container must have the correct size");
     // grid:
     auto const &grid_cfg = std::make_shared<grid_config_1d>(discretization_cfg_);
     auto const &boundary_pair = boundary_->boundary_pair();
@@ -197,7 +213,8 @@ void wave_equation::solve(container_2d<by_enum::Row> &solutions)
                 dev_cu_solver;
 
             dev_cu_solver solver(boundary_pair, wave_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol_0, prev_sol_1, next_sol, is_wave_source_set, wave_source, solutions);
+            solver(prev_sol_0, prev_sol_1, next_sol, is_wave_source_set, wave_source, *observer);
+            std::copy(prev_sol_1.begin(), prev_sol_1.end(), solution.begin());
         }
         else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::SORSolver)
         {
@@ -206,7 +223,8 @@ void wave_equation::solve(container_2d<by_enum::Row> &solutions)
             LSS_ASSERT(!solver_config_details_.empty(), "solver_config_details map must not be empty");
             double omega_value = solver_config_details_["sor_omega"];
             dev_sor_solver solver(boundary_pair, wave_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol_0, prev_sol_1, next_sol, is_wave_source_set, wave_source, omega_value, solutions);
+            solver(prev_sol_0, prev_sol_1, next_sol, is_wave_source_set, wave_source, omega_value, *observer);
+            std::copy(prev_sol_1.begin(), prev_sol_1.end(), solution.begin());
         }
         else
         {
@@ -220,7 +238,8 @@ void wave_equation::solve(container_2d<by_enum::Row> &solutions)
             typedef wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::CUDASolver>
                 host_cu_solver;
             host_cu_solver solver(boundary_pair, wave_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol_0, prev_sol_1, next_sol, is_wave_source_set, wave_source, solutions);
+            solver(prev_sol_0, prev_sol_1, next_sol, is_wave_source_set, wave_source, *observer);
+            std::copy(prev_sol_1.begin(), prev_sol_1.end(), solution.begin());
         }
         else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::SORSolver)
         {
@@ -230,21 +249,24 @@ void wave_equation::solve(container_2d<by_enum::Row> &solutions)
             LSS_ASSERT(!solver_config_details_.empty(), "solver_config_details map must not be empty");
             double omega_value = solver_config_details_["sor_omega"];
             host_sor_solver solver(boundary_pair, wave_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol_0, prev_sol_1, next_sol, is_wave_source_set, wave_source, omega_value, solutions);
+            solver(prev_sol_0, prev_sol_1, next_sol, is_wave_source_set, wave_source, omega_value, *observer);
+            std::copy(prev_sol_1.begin(), prev_sol_1.end(), solution.begin());
         }
         else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::DoubleSweepSolver)
         {
             typedef wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::DoubleSweepSolver>
                 host_dss_solver;
             host_dss_solver solver(boundary_pair, wave_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol_0, prev_sol_1, next_sol, is_wave_source_set, wave_source, solutions);
+            solver(prev_sol_0, prev_sol_1, next_sol, is_wave_source_set, wave_source, *observer);
+            std::copy(prev_sol_1.begin(), prev_sol_1.end(), solution.begin());
         }
         else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::ThomasLUSolver)
         {
             typedef wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::ThomasLUSolver>
                 host_lus_solver;
             host_lus_solver solver(boundary_pair, wave_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol_0, prev_sol_1, next_sol, is_wave_source_set, wave_source, solutions);
+            solver(prev_sol_0, prev_sol_1, next_sol, is_wave_source_set, wave_source, *observer);
+            std::copy(prev_sol_1.begin(), prev_sol_1.end(), solution.begin());
         }
         else
         {
@@ -267,6 +289,7 @@ void wave_equation::initialize(wave_data_config_1d_ptr const &wave_data_cfg,
 {
     LSS_VERIFY(wave_data_cfg, "wave_data_config must not be null");
     LSS_VERIFY(discretization_cfg_, "discretization_config must not be null");
+    LSS_ASSERT(discretization_cfg_->time_grid() == nullptr, "Non-uniform time grid is not supported by wave solvers");
     LSS_VERIFY(std::get<0>(boundary_pair), "boundary_pair.first must not be null");
     LSS_VERIFY(std::get<1>(boundary_pair), "boundary_pair.second must not be null");
     LSS_VERIFY(solver_cfg_, "solver_config must not be null");
@@ -349,6 +372,19 @@ void wave_equation::solve(container_2d<by_enum::Row> &solutions)
     // This is the proper size of the container:
     LSS_ASSERT((solutions.rows() == time_size) && (solutions.columns() == space_size),
                "The input solution 2D container must have the correct size");
+    // every time slice is stored as a row:
+    auto const observer = std::make_shared<time_slice_observer_1d>(
+        [&](std::size_t time_idx, double time, container_t const &slice) { solutions.row(time_idx).copy_from(slice); });
+    container_t solution(space_size, double{});
+    solve(solution, observer);
+}
+
+void wave_equation::solve(container_t &solution, time_slice_observer_1d_ptr const &observer)
+{
+    LSS_VERIFY(observer, "observer must not be null");
+    // size of space discretization:
+    const std::size_t space_size = discretization_cfg_->number_of_space_points();
+    LSS_ASSERT(solution.size() == space_size, "The input solution container must have the correct size");
     // grid:
     auto const &grid_cfg = std::make_shared<grid_config_1d>(discretization_cfg_);
     auto const &boundary_pair = boundary_->boundary_pair();
@@ -371,18 +407,19 @@ void wave_equation::solve(container_2d<by_enum::Row> &solutions)
     {
         typedef wave_equation_explicit_kernel<memory_space_enum::Device> device_solver;
         device_solver solver(boundary_pair, wave_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
-        solver(prev_sol_0, prev_sol_1, next_sol, is_wave_source_set, wave_source, solutions);
+        solver(prev_sol_0, prev_sol_1, next_sol, is_wave_source_set, wave_source, *observer);
     }
     else if (solver_cfg_->memory_space() == memory_space_enum::Host)
     {
         typedef wave_equation_explicit_kernel<memory_space_enum::Host> host_solver;
         host_solver solver(boundary_pair, wave_data_trans_cfg_, discretization_cfg_, solver_cfg_, grid_cfg);
-        solver(prev_sol_0, prev_sol_1, next_sol, is_wave_source_set, wave_source, solutions);
+        solver(prev_sol_0, prev_sol_1, next_sol, is_wave_source_set, wave_source, *observer);
     }
     else
     {
         throw std::exception("Unreachable");
     }
+    std::copy(next_sol.begin(), next_sol.end(), solution.begin());
 }
 
 } // namespace explicit_solvers
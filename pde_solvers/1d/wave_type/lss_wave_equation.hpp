@@ -10,6 +10,7 @@
 #include "../../../discretization/lss_discretization.hpp"
 #include "../../../transformation/lss_boundary_transform.hpp"
 #include "../../lss_pde_discretization_config.hpp"
+#include "../../lss_time_slice_observer.hpp"
 #include "../../lss_wave_data_config.hpp"
 #include "../../lss_wave_solver_config.hpp"
 #include "../../transformation/lss_wave_data_transform.hpp"
@@ -101,6 +102,14 @@ class wave_equation
      * \param solutions - 2D container for all the solutions in time
      */
     LSS_API void solve(container_2d<by_enum::Row> &solutions);
+
+    /**
+     * Get the final solution of the PDE and stream the solutions in time
+     *
+     * \param solution - container for solution
+     * \param observer - receives the solutions in time that pass its decimation
+     */
+    LSS_API void solve(container_t &solution, time_slice_observer_1d_ptr const &observer);
 };
 
 } // namespace implicit_solvers
@@ -149,6 +158,14 @@ class wave_equation
      * \param solutions - 2D container for all the solutions in time
      */
     LSS_API void solve(container_2d<by_enum::Row> &solutions);
+
+    /**
+     * Get the final solution of the PDE and stream the solutions in time
+     *
+     * \param solution - container for solution
+     * \param observer - receives the solutions in time that pass its decimation
+     */
+    LSS_API void solve(container_t &solution, time_slice_observer_1d_ptr const &observer);
 };
 
 } // namespace explicit_solvers
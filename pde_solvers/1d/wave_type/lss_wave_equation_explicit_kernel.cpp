@@ -34,7 +34,7 @@ void wave_equation_explicit_kernel<memory_space_enum::Device>::operator()(
 
 void wave_equation_explicit_kernel<memory_space_enum::Device>::operator()(
     container_t &prev_solution_0, container_t &prev_solution_1, container_t &next_solution, bool is_wave_sourse_set,
-    std::function<double(double, double)> const &wave_source, container_2d<by_enum::Row> &solutions)
+    std::function<double(double, double)> const &wave_source, time_slice_observer_1d const &observer)
 {
     // save traverse_direction
     const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
@@ -48,7 +48,7 @@ void wave_equation_explicit_kernel<memory_space_enum::Device>::operator()(
     // Here we have only Euler discretization available:
     wave_euler_cuda_scheme euler_scheme(wave_coeff_holder, boundary_pair_, discretization_cfg_, grid_cfg_);
     euler_scheme(prev_solution_0, prev_solution_1, next_solution, is_wave_sourse_set, mod_wave_source, traverse_dir,
-                 solutions);
+                 observer);
 }
 
 wave_equation_explicit_kernel<memory_space_enum::Host>::wave_equation_explicit_kernel(
@@ -80,7 +80,7 @@ void wave_equation_explicit_kernel<memory_space_enum::Host>::operator()(
 
 void wave_equation_explicit_kernel<memory_space_enum::Host>::operator()(
     container_t &prev_solution_0, container_t &prev_solution_1, container_t &next_solution, bool is_wave_sourse_set,
-    std::function<double(double, double)> const &wave_source, container_2d<by_enum::Row> &solutions)
+    std::function<double(double, double)> const &wave_source, time_slice_observer_1d const &observer)
 {
     // save traverse_direction
     const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
@@ -92,7 +92,7 @@ void wave_equation_explicit_kernel<memory_space_enum::Host>::operator()(
     // Here make a dicision which explicit scheme to launch:
     wave_euler_scheme euler_scheme(wave_coeff_holder, boundary_pair_, discretization_cfg_, grid_cfg_);
     euler_scheme(prev_solution_0, prev_solution_1, next_solution, is_wave_sourse_set, mod_wave_source, traverse_dir,
-                 solutions);
+                 observer);
 }
 
 } // namespace one_dimensional
@@ -61,7 +61,7 @@ template <> class wave_equation_explicit_kernel<memory_space_enum::Device>
 
     void operator()(container_t &prev_solution_0, container_t &prev_solution_1, container_t &next_solution,
                     bool is_wave_sourse_set, std::function<double(double, double)> const &wave_source,
-                    container_2d<by_enum::Row> &solutions);
+                    time_slice_observer_1d const &observer);
 };
 
 // ===================================================================
@@ -90,7 +90,7 @@ template <> class wave_equation_explicit_kernel<memory_space_enum::Host>
 
     void operator()(container_t &prev_solution_0, container_t &prev_solution_1, container_t &next_solution,
                     bool is_wave_sourse_set, std::function<double(double, double)> const &wave_source,
-                    container_2d<by_enum::Row> &solutions);
+                    time_slice_observer_1d const &observer);
 };
 
 } // namespace one_dimensional
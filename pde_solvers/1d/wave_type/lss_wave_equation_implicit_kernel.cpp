@@ -54,18 +54,20 @@ void wave_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method
     if (is_wave_sourse_set)
     {
         wave_implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                     prev_solution_0, prev_solution_1, wave_source, next_solution);
+                                     prev_solution_0, prev_solution_1, wave_source, next_solution,
+                                     solver_cfg_->adaptive_time_stepping());
     }
     else
     {
         wave_implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                     prev_solution_0, prev_solution_1, next_solution);
+                                     prev_solution_0, prev_solution_1, next_solution,
+                                     solver_cfg_->adaptive_time_stepping());
     }
 }
 
 void wave_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::CUDASolver>::operator()(
     container_t &prev_solution_0, container_t &prev_solution_1, container_t &next_solution, bool is_wave_sourse_set,
-    std::function<double(double, double)> const &wave_source, container_2d<by_enum::Row> &solutions)
+    std::function<double(double, double)> const &wave_source, time_slice_observer_1d const &observer)
 {
     // get time range:
     auto const &time = discretization_cfg_->time_range();
@@ -88,13 +90,13 @@ void wave_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method
     {
         wave_implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k,
                                                    traverse_dir, prev_solution_0, prev_solution_1, wave_source,
-                                                   next_solution, solutions);
+                                                   next_solution, observer);
     }
     else
     {
         wave_implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k,
                                                    traverse_dir, prev_solution_0, prev_solution_1, next_solution,
-                                                   solutions);
+                                                   observer);
     }
 }
 
@@ -133,18 +135,21 @@ void wave_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method
     if (is_wave_sourse_set)
     {
         wave_implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                     prev_solution_0, prev_solution_1, wave_source, next_solution);
+                                     prev_solution_0, prev_solution_1, wave_source, next_solution,
+                                     solver_cfg_->adaptive_time_stepping());
     }
     else
     {
         wave_implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                     prev_solution_0, prev_solution_1, next_solution);
+                                     prev_solution_0, prev_solution_1, next_solution,
+                                     solver_cfg_->adaptive_time_stepping());
     }
 }
 
 void wave_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::SORSolver>::operator()(
     container_t &prev_solution_0, container_t &prev_solution_1, container_t &next_solution, bool is_wave_sourse_set,
-    std::function<double(double, double)> const &wave_source, double omega_value, container_2d<by_enum::Row> &solutions)
+    std::function<double(double, double)> const &wave_source, double omega_value,
+    time_slice_observer_1d const &observer)
 {
     // get time range:
     auto const &time = discretization_cfg_->time_range();
@@ -167,13 +172,13 @@ void wave_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method
     {
         wave_implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k,
                                                    traverse_dir, prev_solution_0, prev_solution_1, wave_source,
-                                                   next_solution, solutions);
+                                                   next_solution, observer);
     }
     else
     {
         wave_implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k,
                                                    traverse_dir, prev_solution_0, prev_solution_1, next_solution,
-                                                   solutions);
+                                                   observer);
     }
 }
 
@@ -212,18 +217,20 @@ void wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_e
     if (is_wave_sourse_set)
     {
         wave_implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                     prev_solution_0, prev_solution_1, wave_source, next_solution);
+                                     prev_solution_0, prev_solution_1, wave_source, next_solution,
+                                     solver_cfg_->adaptive_time_stepping());
     }
     else
     {
         wave_implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                     prev_solution_0, prev_solution_1, next_solution);
+                                     prev_solution_0, prev_solution_1, next_solution,
+                                     solver_cfg_->adaptive_time_stepping());
     }
 }
 
 void wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::CUDASolver>::operator()(
     container_t &prev_solution_0, container_t &prev_solution_1, container_t &next_solution, bool is_wave_sourse_set,
-    std::function<double(double, double)> const &wave_source, container_2d<by_enum::Row> &solutions)
+    std::function<double(double, double)> const &wave_source, time_slice_observer_1d const &observer)
 {
     // get time range:
     auto const &time = discretization_cfg_->time_range();
@@ -246,13 +253,13 @@ void wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_e
     {
         wave_implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k,
                                                    traverse_dir, prev_solution_0, prev_solution_1, wave_source,
-                                                   next_solution, solutions);
+                                                   next_solution, observer);
     }
     else
     {
         wave_implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k,
                                                    traverse_dir, prev_solution_0, prev_solution_1, next_solution,
-                                                   solutions);
+                                                   observer);
     }
 }
 
@@ -291,18 +298,21 @@ void wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_e
     if (is_wave_sourse_set)
     {
         wave_implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                     prev_solution_0, prev_solution_1, wave_source, next_solution);
+                                     prev_solution_0, prev_solution_1, wave_source, next_solution,
+                                     solver_cfg_->adaptive_time_stepping());
     }
     else
     {
         wave_implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                     prev_solution_0, prev_solution_1, next_solution);
+                                     prev_solution_0, prev_solution_1, next_solution,
+                                     solver_cfg_->adaptive_time_stepping());
     }
 }
 
 void wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::SORSolver>::operator()(
     container_t &prev_solution_0, container_t &prev_solution_1, container_t &next_solution, bool is_wave_sourse_set,
-    std::function<double(double, double)> const &wave_source, double omega_value, container_2d<by_enum::Row> &solutions)
+    std::function<double(double, double)> const &wave_source, double omega_value,
+    time_slice_observer_1d const &observer)
 {
     // get time range:
     auto const &time = discretization_cfg_->time_range();
@@ -325,13 +335,13 @@ void wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_e
     {
         wave_implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k,
                                                    traverse_dir, prev_solution_0, prev_solution_1, wave_source,
-                                                   next_solution, solutions);
+                                                   next_solution, observer);
     }
     else
     {
         wave_implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k,
                                                    traverse_dir, prev_solution_0, prev_solution_1, next_solution,
-                                                   solutions);
+                                                   observer);
     }
 }
 
@@ -369,18 +379,20 @@ void wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_e
     if (is_wave_sourse_set)
     {
         wave_implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                     prev_solution_0, prev_solution_1, wave_source, next_solution);
+                                     prev_solution_0, prev_solution_1, wave_source, next_solution,
+                                     solver_cfg_->adaptive_time_stepping());
     }
     else
     {
         wave_implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                     prev_solution_0, prev_solution_1, next_solution);
+                                     prev_solution_0, prev_solution_1, next_solution,
+                                     solver_cfg_->adaptive_time_stepping());
     }
 }
 
 void wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::DoubleSweepSolver>::operator()(
     container_t &prev_solution_0, container_t &prev_solution_1, container_t &next_solution, bool is_wave_sourse_set,
-    std::function<double(double, double)> const &wave_source, container_2d<by_enum::Row> &solutions)
+    std::function<double(double, double)> const &wave_source, time_slice_observer_1d const &observer)
 {
     // get time range:
     auto const &time = discretization_cfg_->time_range();
@@ -402,13 +414,13 @@ void wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_e
     {
         wave_implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k,
                                                    traverse_dir, prev_solution_0, prev_solution_1, wave_source,
-                                                   next_solution, solutions);
+                                                   next_solution, observer);
     }
     else
     {
         wave_implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k,
                                                    traverse_dir, prev_solution_0, prev_solution_1, next_solution,
-                                                   solutions);
+                                                   observer);
     }
 }
 
@@ -446,18 +458,20 @@ void wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_e
     if (is_wave_sourse_set)
     {
         wave_implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                     prev_solution_0, prev_solution_1, wave_source, next_solution);
+                                     prev_solution_0, prev_solution_1, wave_source, next_solution,
+                                     solver_cfg_->adaptive_time_stepping());
     }
     else
     {
         wave_implicit_time_loop::run(solver_method_ptr, boundary_pair_, time, last_time_idx, k, traverse_dir,
-                                     prev_solution_0, prev_solution_1, next_solution);
+                                     prev_solution_0, prev_solution_1, next_solution,
+                                     solver_cfg_->adaptive_time_stepping());
     }
 }
 
 void wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::ThomasLUSolver>::operator()(
     container_t &prev_solution_0, container_t &prev_solution_1, container_t &next_solution, bool is_wave_sourse_set,
-    std::function<double(double, double)> const &wave_source, container_2d<by_enum::Row> &solutions)
+    std::function<double(double, double)> const &wave_source, time_slice_observer_1d const &observer)
 {
     // get time range:
     auto const &time = discretization_cfg_->time_range();
@@ -479,13 +493,13 @@ void wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_e
     {
         wave_implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k,
                                                    traverse_dir, prev_solution_0, prev_solution_1, wave_source,
-                                                   next_solution, solutions);
+                                                   next_solution, observer);
     }
     else
     {
         wave_implicit_time_loop::run_with_stepping(solver_method_ptr, boundary_pair_, time, last_time_idx, k,
                                                    traverse_dir, prev_solution_0, prev_solution_1, next_solution,
-                                                   solutions);
+                                                   observer);
     }
 }
 
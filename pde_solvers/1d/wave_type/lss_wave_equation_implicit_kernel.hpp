@@ -9,6 +9,7 @@
 #include "../../../containers/lss_container_2d.hpp"
 #include "../../../discretization/lss_discretization.hpp"
 #include "../../lss_pde_discretization_config.hpp"
+#include "../../lss_time_slice_observer.hpp"
 #include "../../lss_wave_solver_config.hpp"
 #include "../../transformation/lss_wave_data_transform.hpp"
 #include "implicit_coefficients/lss_wave_implicit_coefficients.hpp"
@@ -58,7 +59,7 @@ template <> class wave_equation_implicit_kernel<memory_space_enum::Device, tridi
 
     void operator()(container_t &prev_solution_0, container_t &prev_solution_1, container_t &next_solution,
                     bool is_wave_sourse_set, std::function<double(double, double)> const &wave_source,
-                    container_2d<by_enum::Row> &solutions);
+                    time_slice_observer_1d const &observer);
 };
 
 template <> class wave_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::SORSolver>
@@ -84,7 +85,7 @@ template <> class wave_equation_implicit_kernel<memory_space_enum::Device, tridi
 
     void operator()(container_t &prev_solution_0, container_t &prev_solution_1, container_t &next_solution,
                     bool is_wave_sourse_set, std::function<double(double, double)> const &wave_source,
-                    double omega_value, container_2d<by_enum::Row> &solutions);
+                    double omega_value, time_slice_observer_1d const &observer);
 };
 
 // ===================================================================
@@ -112,7 +113,7 @@ template <> class wave_equation_implicit_kernel<memory_space_enum::Host, tridiag
 
     void operator()(container_t &prev_solution_0, container_t &prev_solution_1, container_t &next_solution,
                     bool is_wave_sourse_set, std::function<double(double, double)> const &wave_source,
-                    container_2d<by_enum::Row> &solutions);
+                    time_slice_observer_1d const &observer);
 };
 
 template <> class wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::SORSolver>
@@ -138,7 +139,7 @@ template <> class wave_equation_implicit_kernel<memory_space_enum::Host, tridiag
 
     void operator()(container_t &prev_solution_0, container_t &prev_solution_1, container_t &next_solution,
                     bool is_wave_sourse_set, std::function<double(double, double)> const &wave_source,
-                    double omega_value, container_2d<by_enum::Row> &solutions);
+                    double omega_value, time_slice_observer_1d const &observer);
 };
 
 template <> class wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::DoubleSweepSolver>
@@ -163,7 +164,7 @@ template <> class wave_equation_implicit_kernel<memory_space_enum::Host, tridiag
 
     void operator()(container_t &prev_solution_0, container_t &prev_solution_1, container_t &next_solution,
                     bool is_wave_sourse_set, std::function<double(double, double)> const &wave_source,
-                    container_2d<by_enum::Row> &solutions);
+                    time_slice_observer_1d const &observer);
 };
 
 template <> class wave_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::ThomasLUSolver>
@@ -188,7 +189,7 @@ template <> class wave_equation_implicit_kernel<memory_space_enum::Host, tridiag
 
     void operator()(container_t &prev_solution_0, container_t &prev_solution_1, container_t &next_solution,
                     bool is_wave_sourse_set, std::function<double(double, double)> const &wave_source,
-                    container_2d<by_enum::Row> &solutions);
+                    time_slice_observer_1d const &observer);
 };
 } // namespace one_dimensional
 
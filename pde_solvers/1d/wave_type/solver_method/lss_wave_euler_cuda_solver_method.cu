@@ -10,6 +10,7 @@ namespace lss_pde_solvers
 namespace one_dimensional
 {
 
+using lss_boundary::boundary_cast;
 using lss_boundary::dirichlet_boundary_1d;
 using lss_boundary::neumann_boundary_1d;
 using lss_boundary::robin_boundary_1d;
@@ -100,17 +101,17 @@ void explicit_wave_cuda_scheme::rhs(wave_explicit_coefficients_ptr const &cfs, w
     double x{};
     // for lower boundaries first:
     x = grid_1d::value(grid_config, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(first_bnd))
     {
         solution[0] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] = beta * a(time, x) + c(time, x) * input_1[0] + (a(time, x) + b(time, x)) * input_1[1] -
                       d(time, x) * input_0[0];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -120,17 +121,17 @@ void explicit_wave_cuda_scheme::rhs(wave_explicit_coefficients_ptr const &cfs, w
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_config, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(second_bnd))
     {
         solution[N] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] = (a(time, x) + b(time, x)) * input_1[N - 1] + c(time, x) * input_1[N] - delta * b(time, x) -
                       d(time, x) * input_0[N];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
@@ -163,17 +164,17 @@ void explicit_wave_cuda_scheme::rhs_source(wave_explicit_coefficients_ptr const
     double x{};
     // for lower boundaries first:
     x = grid_1d::value(grid_config, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(first_bnd))
     {
         solution[0] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] = beta * a(time, x) + c(time, x) * input_1[0] + (a(time, x) + b(time, x)) * input_1[1] -
                       d(time, x) * input_0[0] + inhom_input[0];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -183,17 +184,17 @@ void explicit_wave_cuda_scheme::rhs_source(wave_explicit_coefficients_ptr const
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_config, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(second_bnd))
     {
         solution[N] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] = (a(time, x) + b(time, x)) * input_1[N - 1] + c(time, x) * input_1[N] - delta * b(time, x) -
                       d(time, x) * input_0[N] + inhom_input[N];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
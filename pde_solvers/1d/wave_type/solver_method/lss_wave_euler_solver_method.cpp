@@ -10,6 +10,7 @@ namespace lss_pde_solvers
 namespace one_dimensional
 {
 
+using lss_boundary::boundary_cast;
 using lss_boundary::dirichlet_boundary_1d;
 using lss_boundary::neumann_boundary_1d;
 using lss_boundary::robin_boundary_1d;
@@ -29,17 +30,17 @@ void explicit_wave_scheme::rhs(wave_explicit_coefficients_ptr const &cfs, grid_c
     double x{};
     // for lower boundaries first:
     x = grid_1d::value(grid_config, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(first_bnd))
     {
         solution[0] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] = beta * a(time, x) + c(time, x) * input_1[0] + (a(time, x) + b(time, x)) * input_1[1] -
                       d(time, x) * input_0[0];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -49,17 +50,17 @@ void explicit_wave_scheme::rhs(wave_explicit_coefficients_ptr const &cfs, grid_c
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_config, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(second_bnd))
     {
         solution[N] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] = (a(time, x) + b(time, x)) * input_1[N - 1] + c(time, x) * input_1[N] - delta * b(time, x) -
                       d(time, x) * input_0[N];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
@@ -70,8 +71,8 @@ void explicit_wave_scheme::rhs(wave_explicit_coefficients_ptr const &cfs, grid_c
     for (std::size_t t = 1; t < N; ++t)
     {
         x = grid_1d::value(grid_config, t);
-        solution[t] = (a(time, x) * input_1[t - 1]) + (c(time, x) * input_1[t]) + (b(time, x) * input_1[t + 1]) -
-                      (d(time, x) * input_0[t]);
+        solution[t] = (cfs->A(time, x, t) * input_1[t - 1]) + (cfs->C(time, x, t) * input_1[t]) +
+                      (cfs->B(time, x, t) * input_1[t + 1]) - (cfs->D(time, x, t) * input_0[t]);
     }
 }
 
@@ -91,17 +92,17 @@ void explicit_wave_scheme::rhs_source(wave_explicit_coefficients_ptr const &cfs,
     double x{};
     // for lower boundaries first:
     x = grid_1d::value(grid_config, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(first_bnd))
     {
         solution[0] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] = beta * a(time, x) + c(time, x) * input_1[0] + (a(time, x) + b(time, x)) * input_1[1] -
                       d(time, x) * input_0[0] + inhom_input[0];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -111,17 +112,17 @@ void explicit_wave_scheme::rhs_source(wave_explicit_coefficients_ptr const &cfs,
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_config, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(second_bnd))
     {
         solution[N] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] = (a(time, x) + b(time, x)) * input_1[N - 1] + c(time, x) * input_1[N] - delta * b(time, x) -
                       d(time, x) * input_0[N] + inhom_input[N];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
@@ -132,8 +133,8 @@ void explicit_wave_scheme::rhs_source(wave_explicit_coefficients_ptr const &cfs,
     for (std::size_t t = 1; t < N; ++t)
     {
         x = grid_1d::value(grid_config, t);
-        solution[t] = (a(time, x) * input_1[t - 1]) + (c(time, x) * input_1[t]) + (b(time, x) * input_1[t + 1]) -
-                      (d(time, x) * input_0[t]) + inhom_input[t];
+        solution[t] = (cfs->A(time, x, t) * input_1[t - 1]) + (cfs->C(time, x, t) * input_1[t]) +
+                      (cfs->B(time, x, t) * input_1[t + 1]) - (cfs->D(time, x, t) * input_0[t]) + inhom_input[t];
     }
 }
 
@@ -161,17 +162,17 @@ void explicit_wave_scheme::rhs_initial(wave_explicit_coefficients_ptr const &cfs
     double x{};
     // for lower boundaries first:
     x = grid_1d::value(grid_config, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(first_bnd))
     {
         solution[0] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] = beta * A(time, x) + (C(time, x) * input_0[0]) + ((A(time, x) + B(time, x)) * input_0[1]) +
                       (D(time, x) * input_1[0]);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -181,17 +182,17 @@ void explicit_wave_scheme::rhs_initial(wave_explicit_coefficients_ptr const &cfs
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_config, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(second_bnd))
     {
         solution[N] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] = (A(time, x) + B(time, x)) * input_0[N - 1] + C(time, x) * input_0[N] - delta * B(time, x) +
                       (D(time, x) * input_1[N]);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
@@ -232,17 +233,17 @@ void explicit_wave_scheme::rhs_initial_source(wave_explicit_coefficients_ptr con
     double x{};
     // for lower boundaries first:
     x = grid_1d::value(grid_config, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(first_bnd))
     {
         solution[0] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] = beta * A(time, x) + C(time, x) * input_0[0] + (A(time, x) + B(time, x)) * input_0[1] +
                       ((one_gamma * d(time, x)) / defl(time, x)) * input_1[0] + (inhom_input[0] / defl(time, x));
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -253,17 +254,17 @@ void explicit_wave_scheme::rhs_initial_source(wave_explicit_coefficients_ptr con
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_config, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(second_bnd))
     {
         solution[N] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] = (A(time, x) + B(time, x)) * input_0[N - 1] + C(time, x) * input_0[N] - delta * B(time, x) +
                       ((one_gamma * d(time, x)) / defl(time, x)) * input_1[N] + (inhom_input[N] / defl(time, x));
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
@@ -304,17 +305,17 @@ void explicit_wave_scheme::rhs_terminal(wave_explicit_coefficients_ptr const &cf
     double x{};
     // for lower boundaries first:
     x = grid_1d::value(grid_config, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(first_bnd))
     {
         solution[0] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] = beta * A(time, x) + C(time, x) * input_0[0] + (A(time, x) + B(time, x)) * input_0[1] -
                       ((one_gamma * d(time, x)) / defl(time, x)) * input_1[0];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -324,17 +325,17 @@ void explicit_wave_scheme::rhs_terminal(wave_explicit_coefficients_ptr const &cf
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_config, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(second_bnd))
     {
         solution[N] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] = (A(time, x) + B(time, x)) * input_0[N - 1] + C(time, x) * input_0[N] - delta * B(time, x) -
                       ((one_gamma * d(time, x)) / defl(time, x)) * input_1[N];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
@@ -375,17 +376,17 @@ void explicit_wave_scheme::rhs_terminal_source(wave_explicit_coefficients_ptr co
     double x{};
     // for lower boundaries first:
     x = grid_1d::value(grid_config, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(first_bnd))
     {
         solution[0] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] = beta * A(time, x) + C(time, x) * input_0[0] + (A(time, x) + B(time, x)) * input_0[1] -
                       ((one_gamma * d(time, x)) / defl(time, x)) * input_1[0] + (inhom_input[0] / defl(time, x));
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -396,17 +397,17 @@ void explicit_wave_scheme::rhs_terminal_source(wave_explicit_coefficients_ptr co
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_config, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_1d>(second_bnd))
     {
         solution[N] = ptr->value(time);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] = (A(time, x) + B(time, x)) * input_0[N - 1] + C(time, x) * input_0[N] - delta * B(time, x) -
                       ((one_gamma * d(time, x)) / defl(time, x)) * input_1[N] + (inhom_input[N] / defl(time, x));
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
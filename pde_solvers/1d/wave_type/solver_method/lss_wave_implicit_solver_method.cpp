@@ -11,6 +11,7 @@ namespace lss_pde_solvers
 namespace one_dimensional
 {
 
+using lss_boundary::boundary_cast;
 using lss_boundary::dirichlet_boundary_1d;
 using lss_boundary::neumann_boundary_1d;
 using lss_boundary::robin_boundary_1d;
@@ -35,7 +36,7 @@ void implicit_wave_scheme::rhs(wave_implicit_coefficients_ptr const &cfs, grid_c
     double x{};
     // for lower boundaries first:
     x = grid_1d::value(grid_cfg, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta_curr = two * h * ptr->value(time);
         const double beta_prev = two * h * ptr->value(time - k);
@@ -43,7 +44,7 @@ void implicit_wave_scheme::rhs(wave_implicit_coefficients_ptr const &cfs, grid_c
                       (A(time, x) + B(time, x)) * input_0[1] - (D(time, x) + C(time, x)) * input_0[0] +
                       (two * beta_curr + beta_prev) * A(time, x);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta_curr = two * h * ptr->value(time);
         const double beta_prev = two * h * ptr->value(time - k);
@@ -58,7 +59,7 @@ void implicit_wave_scheme::rhs(wave_implicit_coefficients_ptr const &cfs, grid_c
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_cfg, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta_curr = two * h * ptr->value(time);
         const double delta_prev = two * h * ptr->value(time - k);
@@ -66,7 +67,7 @@ void implicit_wave_scheme::rhs(wave_implicit_coefficients_ptr const &cfs, grid_c
                       (A(time, x) + B(time, x)) * input_0[N - 1] - (D(time, x) + C(time, x)) * input_0[N] -
                       (two * delta_curr + delta_prev) * B(time, x);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta_curr = two * h * ptr->value(time);
         const double delta_prev = two * h * ptr->value(time - k);
@@ -82,9 +83,9 @@ void implicit_wave_scheme::rhs(wave_implicit_coefficients_ptr const &cfs, grid_c
     for (std::size_t t = 1; t < N; ++t)
     {
         x = grid_1d::value(grid_cfg, t);
-        solution[t] = (B(time, x) * input_0[t + 1]) - ((D(time, x) + C(time, x)) * input_0[t]) +
-                      (A(time, x) * input_0[t - 1]) + (two * B(time, x) * input_1[t + 1]) +
-                      (two * (lambda - C(time, x)) * input_1[t]) + (two * A(time, x) * input_1[t - 1]);
+        solution[t] = (cfs->B(time, x, t) * input_0[t + 1]) - ((cfs->D(time, x, t) + cfs->C(time, x, t)) * input_0[t]) +
+                      (cfs->A(time, x, t) * input_0[t - 1]) + (two * cfs->B(time, x, t) * input_1[t + 1]) +
+                      (two * (lambda - cfs->C(time, x, t)) * input_1[t]) + (two * cfs->A(time, x, t) * input_1[t - 1]);
     }
 }
 
@@ -108,7 +109,7 @@ void implicit_wave_scheme::rhs_source(wave_implicit_coefficients_ptr const &cfs,
 
     // for lower boundaries first:
     x = grid_1d::value(grid_cfg, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta_curr = two * h * ptr->value(time);
         const double beta_prev = two * h * ptr->value(time - k);
@@ -116,7 +117,7 @@ void implicit_wave_scheme::rhs_source(wave_implicit_coefficients_ptr const &cfs,
                       (A(time, x) + B(time, x)) * input_0[1] - (D(time, x) + C(time, x)) * input_0[0] +
                       (two * beta_curr + beta_prev) * A(time, x) + inhom_input[0];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta_curr = two * h * ptr->value(time);
         const double beta_prev = two * h * ptr->value(time - k);
@@ -132,7 +133,7 @@ void implicit_wave_scheme::rhs_source(wave_implicit_coefficients_ptr const &cfs,
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_cfg, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta_curr = two * h * ptr->value(time);
         const double delta_prev = two * h * ptr->value(time - k);
@@ -140,7 +141,7 @@ void implicit_wave_scheme::rhs_source(wave_implicit_coefficients_ptr const &cfs,
                       (A(time, x) + B(time, x)) * input_0[N - 1] - (D(time, x) + C(time, x)) * input_0[N] -
                       (two * delta_curr + delta_prev) * B(time, x) + inhom_input[N];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta_curr = two * h * ptr->value(time);
         const double delta_prev = two * h * ptr->value(time - k);
@@ -155,9 +156,10 @@ void implicit_wave_scheme::rhs_source(wave_implicit_coefficients_ptr const &cfs,
     for (std::size_t t = 1; t < N; ++t)
     {
         x = grid_1d::value(grid_cfg, t);
-        solution[t] = (B(time, x) * input_0[t + 1]) - ((D(time, x) + C(time, x)) * input_0[t]) +
-                      (A(time, x) * input_0[t - 1]) + (two * B(time, x) * input_1[t + 1]) +
-                      (two * (lambda - C(time, x)) * input_1[t]) + (two * A(time, x) * input_1[t - 1]) + inhom_input[t];
+        solution[t] = (cfs->B(time, x, t) * input_0[t + 1]) - ((cfs->D(time, x, t) + cfs->C(time, x, t)) * input_0[t]) +
+                      (cfs->A(time, x, t) * input_0[t - 1]) + (two * cfs->B(time, x, t) * input_1[t + 1]) +
+                      (two * (lambda - cfs->C(time, x, t)) * input_1[t]) + (two * cfs->A(time, x, t) * input_1[t - 1]) +
+                      inhom_input[t];
     }
 }
 
@@ -180,14 +182,14 @@ void implicit_wave_scheme::rhs_initial(wave_implicit_coefficients_ptr const &cfs
     double x{};
     // for lower boundaries first:
     x = grid_1d::value(grid_cfg, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] = (two * (A(time, x) + B(time, x)) * input_0[1]) + (two * (lambda - C(time, x)) * input_0[0]) +
                       (two * beta * A(time, x)) +
                       (one_gamma * (D(time, x) + C(time, x) - A(time, x) - B(time, x)) * input_1[0]);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -198,14 +200,14 @@ void implicit_wave_scheme::rhs_initial(wave_implicit_coefficients_ptr const &cfs
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_cfg, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] = (two * (A(time, x) + B(time, x)) * input_0[N - 1]) + (two * (lambda - C(time, x)) * input_0[N]) -
                       (two * delta * B(time, x)) +
                       (one_gamma * (D(time, x) + C(time, x) - A(time, x) - B(time, x)) * input_1[N]);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
@@ -217,9 +219,10 @@ void implicit_wave_scheme::rhs_initial(wave_implicit_coefficients_ptr const &cfs
     for (std::size_t t = 1; t < N; ++t)
     {
         x = grid_1d::value(grid_cfg, t);
-        solution[t] = (two * B(time, x) * input_0[t + 1]) + (two * (lambda - C(time, x)) * input_0[t]) +
-                      (two * A(time, x) * input_0[t - 1]) - (one_gamma * B(time, x) * input_1[t + 1]) +
-                      (one_gamma * (D(time, x) + C(time, x)) * input_1[t]) - (one_gamma * A(time, x) * input_1[t - 1]);
+        solution[t] = (two * cfs->B(time, x, t) * input_0[t + 1]) + (two * (lambda - cfs->C(time, x, t)) * input_0[t]) +
+                      (two * cfs->A(time, x, t) * input_0[t - 1]) - (one_gamma * cfs->B(time, x, t) * input_1[t + 1]) +
+                      (one_gamma * (cfs->D(time, x, t) + cfs->C(time, x, t)) * input_1[t]) -
+                      (one_gamma * cfs->A(time, x, t) * input_1[t - 1]);
     }
 }
 
@@ -244,14 +247,14 @@ void implicit_wave_scheme::rhs_initial_source(wave_implicit_coefficients_ptr con
     double x{};
     // for lower boundaries first:
     x = grid_1d::value(grid_cfg, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] = (two * (A(time, x) + B(time, x)) * input_0[1]) + (two * (lambda - C(time, x)) * input_0[0]) +
                       (two * beta * A(time, x)) +
                       (one_gamma * (D(time, x) + C(time, x) - A(time, x) - B(time, x)) * input_1[0]) + inhom_input[0];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -262,14 +265,14 @@ void implicit_wave_scheme::rhs_initial_source(wave_implicit_coefficients_ptr con
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_cfg, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] = (two * (A(time, x) + B(time, x)) * input_0[N - 1]) + (two * (lambda - C(time, x)) * input_0[N]) -
                       (two * delta * B(time, x)) +
                       (one_gamma * (D(time, x) + C(time, x) - A(time, x) - B(time, x)) * input_1[N]) + inhom_input[N];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
@@ -281,10 +284,10 @@ void implicit_wave_scheme::rhs_initial_source(wave_implicit_coefficients_ptr con
     for (std::size_t t = 1; t < N; ++t)
     {
         x = grid_1d::value(grid_cfg, t);
-        solution[t] = (two * B(time, x) * input_0[t + 1]) + (two * (lambda - C(time, x)) * input_0[t]) +
-                      (two * A(time, x) * input_0[t - 1]) - (one_gamma * B(time, x) * input_1[t + 1]) +
-                      (one_gamma * (D(time, x) + C(time, x)) * input_1[t]) - (one_gamma * A(time, x) * input_1[t - 1]) +
-                      inhom_input[t];
+        solution[t] = (two * cfs->B(time, x, t) * input_0[t + 1]) + (two * (lambda - cfs->C(time, x, t)) * input_0[t]) +
+                      (two * cfs->A(time, x, t) * input_0[t - 1]) - (one_gamma * cfs->B(time, x, t) * input_1[t + 1]) +
+                      (one_gamma * (cfs->D(time, x, t) + cfs->C(time, x, t)) * input_1[t]) -
+                      (one_gamma * cfs->A(time, x, t) * input_1[t - 1]) + inhom_input[t];
     }
 }
 
@@ -308,14 +311,14 @@ void implicit_wave_scheme::rhs_terminal(wave_implicit_coefficients_ptr const &cf
     double x{};
     // for lower boundaries first:
     x = grid_1d::value(grid_cfg, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] = (two * (A(time, x) + B(time, x)) * input_0[1]) + (two * (lambda - C(time, x)) * input_0[0]) +
                       (two * beta * A(time, x)) +
                       (one_gamma * (A(time, x) + B(time, x) - C(time, x) - D(time, x)) * input_1[0]);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -326,14 +329,14 @@ void implicit_wave_scheme::rhs_terminal(wave_implicit_coefficients_ptr const &cf
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_cfg, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] = (two * (A(time, x) + B(time, x)) * input_0[N - 1]) + (two * (lambda - C(time, x)) * input_0[N]) -
                       (two * delta * B(time, x)) +
                       (one_gamma * (A(time, x) + B(time, x) - C(time, x) - D(time, x)) * input_1[N]);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
@@ -345,9 +348,10 @@ void implicit_wave_scheme::rhs_terminal(wave_implicit_coefficients_ptr const &cf
     for (std::size_t t = 1; t < N; ++t)
     {
         x = grid_1d::value(grid_cfg, t);
-        solution[t] = (two * B(time, x) * input_0[t + 1]) + (two * (lambda - C(time, x)) * input_0[t]) +
-                      (two * A(time, x) * input_0[t - 1]) + (one_gamma * B(time, x) * input_1[t + 1]) -
-                      (one_gamma * (D(time, x) + C(time, x)) * input_1[t]) + (one_gamma * A(time, x) * input_1[t - 1]);
+        solution[t] = (two * cfs->B(time, x, t) * input_0[t + 1]) + (two * (lambda - cfs->C(time, x, t)) * input_0[t]) +
+                      (two * cfs->A(time, x, t) * input_0[t - 1]) + (one_gamma * cfs->B(time, x, t) * input_1[t + 1]) -
+                      (one_gamma * (cfs->D(time, x, t) + cfs->C(time, x, t)) * input_1[t]) +
+                      (one_gamma * cfs->A(time, x, t) * input_1[t - 1]);
     }
 }
 
@@ -372,14 +376,14 @@ void implicit_wave_scheme::rhs_terminal_source(wave_implicit_coefficients_ptr co
     double x{};
     // for lower boundaries first:
     x = grid_1d::value(grid_cfg, 0);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         solution[0] = (two * (A(time, x) + B(time, x)) * input_0[1]) + (two * (lambda - C(time, x)) * input_0[0]) +
                       (two * beta * A(time, x)) +
                       (one_gamma * (A(time, x) + B(time, x) - C(time, x) - D(time, x)) * input_1[0]) + inhom_input[0];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const double beta = two * h * ptr->value(time);
         const double alpha = two * h * ptr->linear_value(time);
@@ -390,14 +394,14 @@ void implicit_wave_scheme::rhs_terminal_source(wave_implicit_coefficients_ptr co
     // for upper boundaries second:
     const std::size_t N = solution.size() - 1;
     x = grid_1d::value(grid_cfg, N);
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         solution[N] = (two * (A(time, x) + B(time, x)) * input_0[N - 1]) + (two * (lambda - C(time, x)) * input_0[N]) -
                       (two * delta * B(time, x)) +
                       (one_gamma * (A(time, x) + B(time, x) - C(time, x) - D(time, x)) * input_1[N]) + inhom_input[N];
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const double delta = two * h * ptr->value(time);
         const double gamma = two * h * ptr->linear_value(time);
@@ -409,10 +413,10 @@ void implicit_wave_scheme::rhs_terminal_source(wave_implicit_coefficients_ptr co
     for (std::size_t t = 1; t < N; ++t)
     {
         x = grid_1d::value(grid_cfg, t);
-        solution[t] = (two * B(time, x) * input_0[t + 1]) + (two * (lambda - C(time, x)) * input_0[t]) +
-                      (two * A(time, x) * input_0[t - 1]) + (one_gamma * B(time, x) * input_1[t + 1]) -
-                      (one_gamma * (D(time, x) + C(time, x)) * input_1[t]) + (one_gamma * A(time, x) * input_1[t - 1]) +
-                      inhom_input[t];
+        solution[t] = (two * cfs->B(time, x, t) * input_0[t + 1]) + (two * (lambda - cfs->C(time, x, t)) * input_0[t]) +
+                      (two * cfs->A(time, x, t) * input_0[t - 1]) + (one_gamma * cfs->B(time, x, t) * input_1[t + 1]) -
+                      (one_gamma * (cfs->D(time, x, t) + cfs->C(time, x, t)) * input_1[t]) +
+                      (one_gamma * cfs->A(time, x, t) * input_1[t - 1]) + inhom_input[t];
     }
 }
 
@@ -434,9 +438,10 @@ void wave_implicit_solver_method::split_0(double time, container_t &low_0, conta
     for (std::size_t t = 0; t < low_0.size(); ++t)
     {
         x = grid_1d::value(grid_cfg_, t);
-        low_0[t] = ctwo_ * (-cone_ * coefficients_->A_(time, x));
-        diag_0[t] = (coefficients_->E_(time, x) + ctwo_ * coefficients_->C_(time, x) + coefficients_->D_(time, x));
-        high_0[t] = ctwo_ * (-cone_ * coefficients_->B_(time, x));
+        low_0[t] = ctwo_ * (-cone_ * coefficients_->A(time, x, t));
+        diag_0[t] =
+            (coefficients_->E(time, x, t) + ctwo_ * coefficients_->C(time, x, t) + coefficients_->D(time, x, t));
+        high_0[t] = ctwo_ * (-cone_ * coefficients_->B(time, x, t));
     }
 }
 
@@ -446,16 +451,33 @@ void wave_implicit_solver_method::split_1(double time, container_t &low_1, conta
     for (std::size_t t = 0; t < low_1.size(); ++t)
     {
         x = grid_1d::value(grid_cfg_, t);
-        low_1[t] = -cone_ * coefficients_->A_(time, x);
-        diag_1[t] = (coefficients_->E_(time, x) + coefficients_->C_(time, x));
-        high_1[t] = -cone_ * coefficients_->B_(time, x);
+        low_1[t] = -cone_ * coefficients_->A(time, x, t);
+        diag_1[t] = (coefficients_->E(time, x, t) + coefficients_->C(time, x, t));
+        high_1[t] = -cone_ * coefficients_->B(time, x, t);
     }
 }
 
+void wave_implicit_solver_method::load_diagonals_0(double time)
+{
+    split_0(time, low_, diag_, high_);
+    solveru_ptr_->set_diagonals(low_, diag_, high_);
+    are_diagonals_1_set_ = false;
+}
+
+void wave_implicit_solver_method::load_diagonals_1(double time)
+{
+    // time-homogeneous matrix is the same on every step, keeping it lets the solver reuse its factorization:
+    if (coefficients_->is_time_homogeneous_ && are_diagonals_1_set_)
+        return;
+    split_1(time, low_, diag_, high_);
+    solveru_ptr_->set_diagonals(low_, diag_, high_);
+    are_diagonals_1_set_ = true;
+}
+
 wave_implicit_solver_method ::wave_implicit_solver_method(
     lss_tridiagonal_solver::tridiagonal_solver_ptr const &solver_ptr,
     wave_implicit_coefficients_ptr const &coefficients, grid_config_1d_ptr const &grid_config, bool is_wave_source_set)
-    : solveru_ptr_{solver_ptr}, coefficients_{coefficients}, grid_cfg_{grid_config}
+    : solveru_ptr_{solver_ptr}, coefficients_{coefficients}, grid_cfg_{grid_config}, are_diagonals_1_set_{false}
 {
     initialize(is_wave_source_set);
 }
@@ -468,10 +490,10 @@ void wave_implicit_solver_method::solve_initial(container_t &prev_solution_0, co
                                                 boundary_1d_pair const &boundary_pair, double const &time,
                                                 double const &next_time, container_t &solution)
 {
+    coefficients_->prepare_time_factors(time);
     implicit_wave_scheme::rhs_initial(coefficients_, grid_cfg_, prev_solution_0, prev_solution_1, boundary_pair, time,
                                       rhs_);
-    split_0(time, low_, diag_, high_);
-    solveru_ptr_->set_diagonals(low_, diag_, high_);
+    load_diagonals_0(time);
     solveru_ptr_->set_rhs(rhs_);
     solveru_ptr_->solve(boundary_pair, solution, next_time);
 }
@@ -482,11 +504,11 @@ void wave_implicit_solver_method::solve_initial(container_t &prev_solution_0, co
                                                 std::function<double(double, double)> const &wave_source,
                                                 container_t &solution)
 {
+    coefficients_->prepare_time_factors(time);
     d_1d::of_function(grid_cfg_, time, wave_source, source_);
     implicit_wave_scheme::rhs_initial_source(coefficients_, grid_cfg_, prev_solution_0, prev_solution_1, source_,
                                              boundary_pair, time, rhs_);
-    split_0(time, low_, diag_, high_);
-    solveru_ptr_->set_diagonals(low_, diag_, high_);
+    load_diagonals_0(time);
     solveru_ptr_->set_rhs(rhs_);
     solveru_ptr_->solve(boundary_pair, solution, next_time);
 }
@@ -495,10 +517,10 @@ void wave_implicit_solver_method::solve_terminal(container_t &prev_solution_0, c
                                                  boundary_1d_pair const &boundary_pair, double const &time,
                                                  double const &next_time, container_t &solution)
 {
+    coefficients_->prepare_time_factors(time);
     implicit_wave_scheme::rhs_terminal(coefficients_, grid_cfg_, prev_solution_0, prev_solution_1, boundary_pair, time,
                                        rhs_);
-    split_0(time, low_, diag_, high_);
-    solveru_ptr_->set_diagonals(low_, diag_, high_);
+    load_diagonals_0(time);
     solveru_ptr_->set_rhs(rhs_);
     solveru_ptr_->solve(boundary_pair, solution, next_time);
 }
@@ -509,11 +531,11 @@ void wave_implicit_solver_method::solve_terminal(container_t &prev_solution_0, c
                                                  std::function<double(double, double)> const &wave_source,
                                                  container_t &solution)
 {
+    coefficients_->prepare_time_factors(time);
     d_1d::of_function(grid_cfg_, time, wave_source, source_);
     implicit_wave_scheme::rhs_terminal_source(coefficients_, grid_cfg_, prev_solution_0, prev_solution_1, source_,
                                               boundary_pair, time, rhs_);
-    split_0(time, low_, diag_, high_);
-    solveru_ptr_->set_diagonals(low_, diag_, high_);
+    load_diagonals_0(time);
     solveru_ptr_->set_rhs(rhs_);
     solveru_ptr_->solve(boundary_pair, solution, next_time);
 }
@@ -522,9 +544,9 @@ void wave_implicit_solver_method::solve(container_t &prev_solution_0, container_
                                         boundary_1d_pair const &boundary_pair, double const &time,
                                         double const &next_time, container_t &solution)
 {
-    split_1(time, low_, diag_, high_);
+    coefficients_->prepare_time_factors(time);
+    load_diagonals_1(time);
     implicit_wave_scheme::rhs(coefficients_, grid_cfg_, prev_solution_0, prev_solution_1, boundary_pair, time, rhs_);
-    solveru_ptr_->set_diagonals(low_, diag_, high_);
     solveru_ptr_->set_rhs(rhs_);
     solveru_ptr_->solve(boundary_pair, solution, next_time);
 }
@@ -534,15 +556,23 @@ void wave_implicit_solver_method::solve(container_t &prev_solution_0, container_
                                         double const &next_time,
                                         std::function<double(double, double)> const &wave_source, container_t &solution)
 {
-    split_1(time, low_, diag_, high_);
+    coefficients_->prepare_time_factors(time);
+    load_diagonals_1(time);
     d_1d::of_function(grid_cfg_, time, wave_source, source_);
     implicit_wave_scheme::rhs_source(coefficients_, grid_cfg_, prev_solution_0, prev_solution_1, source_, boundary_pair,
                                      time, rhs_);
-    solveru_ptr_->set_diagonals(low_, diag_, high_);
     solveru_ptr_->set_rhs(rhs_);
     solveru_ptr_->solve(boundary_pair, solution, next_time);
 }
 
+void wave_implicit_solver_method::set_time_step(double time_step)
+{
+    if (time_step == coefficients_->k_)
+        return;
+    coefficients_->set_time_step(time_step);
+    are_diagonals_1_set_ = false;
+}
+
 } // namespace one_dimensional
 
 } // namespace lss_pde_solvers
@@ -74,6 +74,7 @@ class wave_implicit_solver_method
     // container:
     container_t low_, diag_, high_;
     container_t rhs_, source_;
+    bool are_diagonals_1_set_;
 
     explicit wave_implicit_solver_method() = delete;
 
@@ -83,6 +84,10 @@ class wave_implicit_solver_method
 
     void split_1(double time, container_t &low_1, container_t &diag_1, container_t &high_1);
 
+    void load_diagonals_0(double time);
+
+    void load_diagonals_1(double time);
+
   public:
     explicit wave_implicit_solver_method(lss_tridiagonal_solver::tridiagonal_solver_ptr const &solver_ptr,
                                          wave_implicit_coefficients_ptr const &coefficients,
@@ -117,6 +122,12 @@ class wave_implicit_solver_method
     void solve(container_t &prev_solution_0, container_t &prev_solution_1, boundary_1d_pair const &boundary_pair,
                double const &time, double const &next_time, std::function<double(double, double)> const &wave_source,
                container_t &solution);
+
+    /**
+        @brief  Sets the time step of the next solve (adaptive time stepping)
+        @param  time_step - time step
+    **/
+    void set_time_step(double time_step);
 };
 
 using wave_implicit_solver_method_ptr = sptr_t<wave_implicit_solver_method>;
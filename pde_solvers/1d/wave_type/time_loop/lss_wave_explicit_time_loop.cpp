@@ -142,7 +142,7 @@ void wave_explicit_time_loop::run_with_stepping(wave_explicit_solver_method_ptr
                                                 std::size_t const &last_time_idx, double const time_step,
                                                 traverse_direction_enum const &traverse_dir,
                                                 container_t &prev_solution_0, container_t &prev_solution_1,
-                                                container_t &next_solution, container_2d_t &solutions)
+                                                container_t &next_solution, time_slice_observer_1d const &observer)
 {
     const double start_time = time_range->lower();
     const double end_time = time_range->upper();
@@ -153,13 +153,13 @@ void wave_explicit_time_loop::run_with_stepping(wave_explicit_solver_method_ptr
 
     if (traverse_dir == traverse_direction_enum::Forward)
     {
-        // store the initial solution:
-        solutions(0, prev_solution_0);
+        // observe the initial solution:
+        observer(0, start_time, prev_solution_0);
         // solve for initial time step:
         solver_ptr->solve_initial(prev_solution_0, prev_solution_1, boundary_pair, time, next_time, next_solution);
         prev_solution_1 = next_solution;
         time_idx = 1;
-        solutions(time_idx, next_solution);
+        observer(time_idx, next_time, next_solution);
 
         // solve for rest of time steps:
         time += k;
@@ -170,7 +170,7 @@ void wave_explicit_time_loop::run_with_stepping(wave_explicit_solver_method_ptr
             solver_ptr->solve(prev_solution_0, prev_solution_1, boundary_pair, time, next_time, next_solution);
             prev_solution_0 = prev_solution_1;
             prev_solution_1 = next_solution;
-            solutions(time_idx, next_solution);
+            observer(time_idx, next_time, next_solution);
             time += k;
             next_time += k;
             time_idx++;
@@ -179,15 +179,15 @@ void wave_explicit_time_loop::run_with_stepping(wave_explicit_solver_method_ptr
     else if (traverse_dir == traverse_direction_enum::Backward)
     {
         time_idx = last_time_idx;
-        // store the terminal solution:
-        solutions(last_time_idx, prev_solution_0);
+        // observe the terminal solution:
+        observer(last_time_idx, end_time, prev_solution_0);
         time = end_time;
         next_time = time - k;
         // solve for terminal time step:
         solver_ptr->solve_terminal(prev_solution_0, prev_solution_1, boundary_pair, time, next_time, next_solution);
         prev_solution_1 = next_solution;
         time_idx--;
-        solutions(time_idx, next_solution);
+        observer(time_idx, next_time, next_solution);
 
         // solve for rest of time steps:
         time -= k;
@@ -198,7 +198,7 @@ void wave_explicit_time_loop::run_with_stepping(wave_explicit_solver_method_ptr
             solver_ptr->solve(prev_solution_0, prev_solution_1, boundary_pair, time, next_time, next_solution);
             prev_solution_0 = prev_solution_1;
             prev_solution_1 = next_solution;
-            solutions(time_idx, next_solution);
+            observer(time_idx, next_time, next_solution);
             time -= k;
             next_time -= k;
         } while (time_idx > 0);
@@ -215,7 +215,7 @@ void wave_explicit_time_loop::run_with_stepping(wave_explicit_solver_method_ptr
                                                 traverse_direction_enum const &traverse_dir,
                                                 container_t &prev_solution_0, container_t &prev_solution_1,
                                                 std::function<double(double, double)> const &wave_source,
-                                                container_t &next_solution, container_2d_t &solutions)
+                                                container_t &next_solution, time_slice_observer_1d const &observer)
 {
     const double start_time = time_range->lower();
     const double end_time = time_range->upper();
@@ -226,14 +226,14 @@ void wave_explicit_time_loop::run_with_stepping(wave_explicit_solver_method_ptr
 
     if (traverse_dir == traverse_direction_enum::Forward)
     {
-        // store the initial solution:
-        solutions(0, prev_solution_0);
+        // observe the initial solution:
+        observer(0, start_time, prev_solution_0);
         // solve for initial time step:
         solver_ptr->solve_initial(prev_solution_0, prev_solution_1, boundary_pair, time, next_time, wave_source,
                                   next_solution);
         prev_solution_1 = next_solution;
         time_idx = 1;
-        solutions(time_idx, next_solution);
+        observer(time_idx, next_time, next_solution);
 
         // solve for rest of time steps:
         time += k;
@@ -245,7 +245,7 @@ void wave_explicit_time_loop::run_with_stepping(wave_explicit_solver_method_ptr
                               next_solution);
             prev_solution_0 = prev_solution_1;
             prev_solution_1 = next_solution;
-            solutions(time_idx, next_solution);
+            observer(time_idx, next_time, next_solution);
             time += k;
             next_time += k;
             time_idx++;
@@ -254,8 +254,8 @@ void wave_explicit_time_loop::run_with_stepping(wave_explicit_solver_method_ptr
     else if (traverse_dir == traverse_direction_enum::Backward)
     {
         time_idx = last_time_idx;
-        // store the terminal solution:
-        solutions(last_time_idx, prev_solution_0);
+        // observe the terminal solution:
+        observer(last_time_idx, end_time, prev_solution_0);
         time = end_time;
         next_time = time - k;
         // solve for terminal time step:
@@ -263,7 +263,7 @@ void wave_explicit_time_loop::run_with_stepping(wave_explicit_solver_method_ptr
                                    next_solution);
         prev_solution_1 = next_solution;
         time_idx--;
-        solutions(time_idx, next_solution);
+        observer(time_idx, next_time, next_solution);
 
         // solve for rest of time steps:
         time -= k;
@@ -275,7 +275,7 @@ void wave_explicit_time_loop::run_with_stepping(wave_explicit_solver_method_ptr
                               next_solution);
             prev_solution_0 = prev_solution_1;
             prev_solution_1 = next_solution;
-            solutions(time_idx, next_solution);
+            observer(time_idx, next_time, next_solution);
             time -= k;
             next_time -= k;
         } while (time_idx > 0);
@@ -7,6 +7,7 @@
 #include "../../../../common/lss_utility.hpp"
 #include "../../../../containers/lss_container_2d.hpp"
 #include "../../../../discretization/lss_discretization.hpp"
+#include "../../../lss_time_slice_observer.hpp"
 #include "../solver_method/lss_wave_explicit_solver_method.hpp"
 
 namespace lss_pde_solvers
@@ -47,7 +48,8 @@ class wave_explicit_time_loop
                                   boundary_1d_pair const &boundary_pair, range_ptr const &time_range,
                                   std::size_t const &last_time_idx, double const time_step,
                                   traverse_direction_enum const &traverse_dir, container_t &prev_solution_0,
-                                  container_t &prev_solution_1, container_t &next_solution, container_2d_t &solutions);
+                                  container_t &prev_solution_1, container_t &next_solution,
+                                  time_slice_observer_1d const &observer);
 
     static void run_with_stepping(wave_explicit_solver_method_ptr const &solver_ptr,
                                   boundary_1d_pair const &boundary_pair, range_ptr const &time_range,
@@ -55,7 +57,7 @@ class wave_explicit_time_loop
                                   traverse_direction_enum const &traverse_dir, container_t &prev_solution_0,
                                   container_t &prev_solution_1,
                                   std::function<double(double, double)> const &wave_source, container_t &next_solution,
-                                  container_2d_t &solutions);
+                                  time_slice_observer_1d const &observer);
 };
 
 } // namespace one_dimensional
@@ -1,17 +1,195 @@
 #include "lss_wave_implicit_time_loop.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 namespace lss_pde_solvers
 {
 
 namespace one_dimensional
 {
 
+template <typename restart_fn_t, typename step_fn_t>
+void wave_implicit_time_loop::adapt_time_steps(wave_implicit_solver_method_ptr const &solver_ptr,
+                                               range_ptr const &time_range, double const time_step,
+                                               traverse_direction_enum const &traverse_dir,
+                                               adaptive_time_stepping_config_ptr const &adaptive_time_stepping,
+                                               container_t &prev_solution_0, container_t &prev_solution_1,
+                                               container_t &next_solution, restart_fn_t &&restart_fn,
+                                               step_fn_t &&step_fn)
+{
+    const double one = 1.0;
+    const double two = 2.0;
+    const double half = 0.5;
+    const double sixth = 1.0 / 6.0;
+    // the scheme is second order in time:
+    const double order = 2.0;
+    // bounds of the step change between two consecutive steps:
+    const double min_factor = 0.2;
+    const double max_factor = 5.0;
+    // accepted steps keep the time step, and so the three-level history, unless it may grow by this factor:
+    const double keep_factor = 2.0;
+    // relative difference of time steps treated as round-off:
+    const double round_off = 1.0e-8;
+    const double start_time = time_range->lower();
+    const double end_time = time_range->upper();
+    const double tolerance = adaptive_time_stepping->tolerance();
+    const double min_k = adaptive_time_stepping->min_time_step();
+    const double max_k = adaptive_time_stepping->max_time_step();
+    const double safety = adaptive_time_stepping->safety_factor();
+    const bool is_forward = (traverse_dir == traverse_direction_enum::Forward);
+    const double sign = is_forward ? one : -one;
+    const std::size_t space_size = prev_solution_0.size();
+    // solution with its time derivatives and the kept solutions behind it, half time step apart:
+    container_t solution(prev_solution_0);
+    container_t derivative(prev_solution_1);
+    container_t third_derivative(space_size, double{});
+    container_t half_solution_0(space_size, double{});
+    container_t solution_0(space_size, double{});
+    container_t half_solution_00(space_size, double{});
+    container_t solution_00(space_size, double{});
+    // time derivative the restarted history starts from:
+    container_t restart_derivative(space_size, double{});
+    // containers for the whole step and for the two half-steps:
+    container_t whole_solution(space_size, double{});
+    container_t half_solution(space_size, double{});
+    container_t half_next_solution(space_size, double{});
+
+    double time = is_forward ? start_time : end_time;
+    double remaining = end_time - start_time;
+    // time steps split the remaining range evenly, so the last step needs no cut that would restart the history:
+    auto const fit_time_step = [&](double step) {
+        step = std::min(std::max(step, min_k), max_k);
+        return (remaining / std::max(one, std::ceil(remaining / step - round_off)));
+    };
+    // the two-level start takes u(t - k) = u(t + k) - 2k(u'(t) + k^2 u'''(t) / 6), so the restarted history
+    // is as accurate as the three-level step:
+    auto const restart = [&](double step, double step_time, container_t &step_solution) {
+        for (std::size_t t = 0; t < space_size; ++t)
+            restart_derivative[t] = derivative[t] + sixth * step * step * third_derivative[t];
+        solver_ptr->set_time_step(step);
+        restart_fn(solution, restart_derivative, time, step_time, step_solution);
+    };
+    double k = fit_time_step(time_step);
+    // time step of the history behind solution, zero until the first step is kept:
+    double history_k{};
+    // number of steps kept with history_k:
+    std::size_t history_steps{};
+    // the time derivatives belong to solution, on entry they are the initial ones:
+    bool is_derivative_set{true};
+    double next_time{}, half_time{}, error{}, factor{}, h{};
+    double a_1{}, a_2{}, d_2{}, d_3{};
+    bool is_last{false};
+    while (remaining > 0.0)
+    {
+        is_last = (k >= remaining * (one - round_off));
+        next_time = is_last ? (is_forward ? end_time : start_time) : (time + sign * k);
+        half_time = time + sign * half * k;
+
+        if (k == history_k)
+        {
+            // unchanged time step, both the whole step and the half-steps continue their three-level history:
+            solver_ptr->set_time_step(k);
+            step_fn(solution_0, solution, time, next_time, whole_solution);
+            solver_ptr->set_time_step(half * k);
+            step_fn(half_solution_0, solution, time, half_time, half_solution);
+        }
+        else
+        {
+            // changed time step restarts the history from the time derivatives at the kept solution:
+            if (!is_derivative_set)
+            {
+                h = sign * half * history_k;
+                if (history_steps > 1)
+                {
+                    // one-sided differences over the two kept steps:
+                    for (std::size_t t = 0; t < space_size; ++t)
+                    {
+                        derivative[t] = (25.0 * solution[t] - 48.0 * half_solution_0[t] + 36.0 * solution_0[t] -
+                                         16.0 * half_solution_00[t] + 3.0 * solution_00[t]) /
+                                        (12.0 * h);
+                        third_derivative[t] = (5.0 * solution[t] - 18.0 * half_solution_0[t] +
+                                               24.0 * solution_0[t] - 14.0 * half_solution_00[t] +
+                                               3.0 * solution_00[t]) /
+                                              (two * h * h * h);
+                    }
+                }
+                else
+                {
+                    // cubic through the kept step and the time derivative at its restart:
+                    for (std::size_t t = 0; t < space_size; ++t)
+                    {
+                        a_1 = half_solution_0[t] - solution[t];
+                        a_2 = solution_0[t] - solution[t];
+                        d_3 = half * (h * derivative[t] - two * a_1 + 1.5 * a_2);
+                        d_2 = half * a_2 - a_1 + 3.0 * d_3;
+                        derivative[t] = (d_2 - d_3 - a_1) / h;
+                        third_derivative[t] = 6.0 * d_3 / (h * h * h);
+                    }
+                }
+                is_derivative_set = true;
+            }
+            restart(k, next_time, whole_solution);
+            restart(half * k, half_time, half_solution);
+        }
+        step_fn(solution, half_solution, half_time, next_time, half_next_solution);
+
+        // Richardson estimate of the error of the two half-steps:
+        error = double{};
+        for (std::size_t t = 0; t < space_size; ++t)
+            error = std::max(error, std::abs(half_next_solution[t] - whole_solution[t]));
+        error /= (std::pow(two, order) - one);
+
+        factor = (error > 0.0) ? safety * std::pow(tolerance / error, one / (order + one)) : max_factor;
+        factor = std::min(std::max(factor, min_factor), max_factor);
+        if ((error <= tolerance) || (k <= min_k))
+        {
+            solution_00.swap(solution_0);
+            half_solution_00.swap(half_solution_0);
+            solution_0.swap(solution);
+            half_solution_0.swap(half_solution);
+            solution.swap(half_next_solution);
+            history_steps = (k == history_k) ? (history_steps + 1) : std::size_t(1);
+            history_k = k;
+            is_derivative_set = false;
+            time = next_time;
+            remaining = is_last ? 0.0 : (is_forward ? (end_time - time) : (time - start_time));
+            // the step grows only once two kept steps give the accurate restart:
+            if ((factor < keep_factor) || (history_steps < 2))
+                continue;
+        }
+        k = fit_time_step(k * factor);
+    }
+    prev_solution_0 = solution_0;
+    prev_solution_1 = solution;
+    next_solution = solution;
+}
+
 void wave_implicit_time_loop::run(wave_implicit_solver_method_ptr const &solver_ptr,
                                   boundary_1d_pair const &boundary_pair, range_ptr const &time_range,
                                   std::size_t const &last_time_idx, double const time_step,
                                   traverse_direction_enum const &traverse_dir, container_t &prev_solution_0,
-                                  container_t &prev_solution_1, container_t &next_solution)
+                                  container_t &prev_solution_1, container_t &next_solution,
+                                  adaptive_time_stepping_config_ptr const &adaptive_time_stepping)
 {
+    if (adaptive_time_stepping != nullptr)
+    {
+        adapt_time_steps(
+            solver_ptr, time_range, time_step, traverse_dir, adaptive_time_stepping, prev_solution_0,
+            prev_solution_1, next_solution,
+            [&](container_t &solution, container_t &derivative, double time, double next_time,
+                container_t &step_solution) {
+                if (traverse_dir == traverse_direction_enum::Forward)
+                    solver_ptr->solve_initial(solution, derivative, boundary_pair, time, next_time, step_solution);
+                else
+                    solver_ptr->solve_terminal(solution, derivative, boundary_pair, time, next_time, step_solution);
+            },
+            [&](container_t &solution_0, container_t &solution_1, double time, double next_time,
+                container_t &step_solution) {
+                solver_ptr->solve(solution_0, solution_1, boundary_pair, time, next_time, step_solution);
+            });
+        return;
+    }
 
     const double start_time = time_range->lower();
     const double end_time = time_range->upper();
@@ -71,8 +249,31 @@ void wave_implicit_time_loop::run(wave_implicit_solver_method_ptr const &solver_
                                   std::size_t const &last_time_idx, double const time_step,
                                   traverse_direction_enum const &traverse_dir, container_t &prev_solution_0,
                                   container_t &prev_solution_1,
-                                  std::function<double(double, double)> const &wave_source, container_t &next_solution)
+                                  std::function<double(double, double)> const &wave_source, container_t &next_solution,
+                                  adaptive_time_stepping_config_ptr const &adaptive_time_stepping)
 {
+    if (adaptive_time_stepping != nullptr)
+    {
+        adapt_time_steps(
+            solver_ptr, time_range, time_step, traverse_dir, adaptive_time_stepping, prev_solution_0,
+            prev_solution_1, next_solution,
+            [&](container_t &solution, container_t &derivative, double time, double next_time,
+                container_t &step_solution) {
+                if (traverse_dir == traverse_direction_enum::Forward)
+                    solver_ptr->solve_initial(solution, derivative, boundary_pair, time, next_time, wave_source,
+                                              step_solution);
+                else
+                    solver_ptr->solve_terminal(solution, derivative, boundary_pair, time, next_time, wave_source,
+                                               step_solution);
+            },
+            [&](container_t &solution_0, container_t &solution_1, double time, double next_time,
+                container_t &step_solution) {
+                solver_ptr->solve(solution_0, solution_1, boundary_pair, time, next_time, wave_source,
+                                  step_solution);
+            });
+        return;
+    }
+
     const double start_time = time_range->lower();
     const double end_time = time_range->upper();
     const double k = time_step;
@@ -135,7 +336,7 @@ void wave_implicit_time_loop::run_with_stepping(wave_implicit_solver_method_ptr
                                                 std::size_t const &last_time_idx, double const time_step,
                                                 traverse_direction_enum const &traverse_dir,
                                                 container_t &prev_solution_0, container_t &prev_solution_1,
-                                                container_t &next_solution, container_2d<by_enum::Row> &solutions)
+                                                container_t &next_solution, time_slice_observer_1d const &observer)
 {
     const double start_time = time_range->lower();
     const double end_time = time_range->upper();
@@ -145,13 +346,13 @@ void wave_implicit_time_loop::run_with_stepping(wave_implicit_solver_method_ptr
     std::size_t time_idx{};
     if (traverse_dir == traverse_direction_enum::Forward)
     {
-        // store the initial solution:
-        solutions(0, prev_solution_0);
+        // observe the initial solution:
+        observer(0, start_time, prev_solution_0);
         // solve for initial time step:
         solver_ptr->solve_initial(prev_solution_0, prev_solution_1, boundary_pair, time, next_time, next_solution);
         prev_solution_1 = next_solution;
         time_idx = 1;
-        solutions(time_idx, next_solution);
+        observer(time_idx, next_time, next_solution);
 
         // solve for rest of time steps:
         time += k;
@@ -162,7 +363,7 @@ void wave_implicit_time_loop::run_with_stepping(wave_implicit_solver_method_ptr
             solver_ptr->solve(prev_solution_0, prev_solution_1, boundary_pair, time, next_time, next_solution);
             prev_solution_0 = prev_solution_1;
             prev_solution_1 = next_solution;
-            solutions(time_idx, next_solution);
+            observer(time_idx, next_time, next_solution);
             time += k;
             next_time += k;
             time_idx++;
@@ -171,15 +372,15 @@ void wave_implicit_time_loop::run_with_stepping(wave_implicit_solver_method_ptr
     else
     {
         time_idx = last_time_idx;
-        // store the terminal solution:
-        solutions(last_time_idx, prev_solution_0);
+        // observe the terminal solution:
+        observer(last_time_idx, end_time, prev_solution_0);
         time = end_time;
         next_time = time - k;
         // solve for initial time step:
         solver_ptr->solve_terminal(prev_solution_0, prev_solution_1, boundary_pair, time, next_time, next_solution);
         prev_solution_1 = next_solution;
         time_idx--;
-        solutions(time_idx, next_solution);
+        observer(time_idx, next_time, next_solution);
 
         // solve for rest of time steps:
         time -= k;
@@ -190,7 +391,7 @@ void wave_implicit_time_loop::run_with_stepping(wave_implicit_solver_method_ptr
             solver_ptr->solve(prev_solution_0, prev_solution_1, boundary_pair, time, next_time, next_solution);
             prev_solution_0 = prev_solution_1;
             prev_solution_1 = next_solution;
-            solutions(time_idx, next_solution);
+            observer(time_idx, next_time, next_solution);
             time -= k;
             next_time -= k;
         } while (time_idx > 0);
@@ -203,7 +404,7 @@ void wave_implicit_time_loop::run_with_stepping(wave_implicit_solver_method_ptr
                                                 traverse_direction_enum const &traverse_dir,
                                                 container_t &prev_solution_0, container_t &prev_solution_1,
                                                 std::function<double(double, double)> const &wave_source,
-                                                container_t &next_solution, container_2d<by_enum::Row> &solutions)
+                                                container_t &next_solution, time_slice_observer_1d const &observer)
 {
     const double start_time = time_range->lower();
     const double end_time = time_range->upper();
@@ -214,14 +415,14 @@ void wave_implicit_time_loop::run_with_stepping(wave_implicit_solver_method_ptr
 
     if (traverse_dir == traverse_direction_enum::Forward)
     {
-        // store the initial solution:
-        solutions(0, prev_solution_0);
+        // observe the initial solution:
+        observer(0, start_time, prev_solution_0);
         // solve for initial time step:
         solver_ptr->solve_initial(prev_solution_0, prev_solution_1, boundary_pair, time, next_time, wave_source,
                                   next_solution);
         prev_solution_1 = next_solution;
         time_idx = 1;
-        solutions(time_idx, next_solution);
+        observer(time_idx, next_time, next_solution);
 
         // solve for rest of time steps:
         time += k;
@@ -233,7 +434,7 @@ void wave_implicit_time_loop::run_with_stepping(wave_implicit_solver_method_ptr
                               next_solution);
             prev_solution_0 = prev_solution_1;
             prev_solution_1 = next_solution;
-            solutions(time_idx, next_solution);
+            observer(time_idx, next_time, next_solution);
             time += k;
             next_time += k;
             time_idx++;
@@ -242,8 +443,8 @@ void wave_implicit_time_loop::run_with_stepping(wave_implicit_solver_method_ptr
     else
     {
         time_idx = last_time_idx;
-        // store the terminal solution:
-        solutions(last_time_idx, prev_solution_0);
+        // observe the terminal solution:
+        observer(last_time_idx, end_time, prev_solution_0);
         time = end_time;
         next_time = time - k;
         // solve for initial time step:
@@ -251,7 +452,7 @@ void wave_implicit_time_loop::run_with_stepping(wave_implicit_solver_method_ptr
                                    next_solution);
         prev_solution_1 = next_solution;
         time_idx--;
-        solutions(time_idx, next_solution);
+        observer(time_idx, next_time, next_solution);
 
         // solve for rest of time steps:
         time -= k;
@@ -263,7 +464,7 @@ void wave_implicit_time_loop::run_with_stepping(wave_implicit_solver_method_ptr
                               next_solution);
             prev_solution_0 = prev_solution_1;
             prev_solution_1 = next_solution;
-            solutions(time_idx, next_solution);
+            observer(time_idx, next_time, next_solution);
             time -= k;
             next_time -= k;
         } while (time_idx > 0);
@@ -7,6 +7,8 @@
 #include "../../../../common/lss_utility.hpp"
 #include "../../../../containers/lss_container_2d.hpp"
 #include "../../../../discretization/lss_discretization.hpp"
+#include "../../../lss_adaptive_time_stepping_config.hpp"
+#include "../../../lss_time_slice_observer.hpp"
 #include "../solver_method/lss_wave_implicit_solver_method.hpp"
 
 namespace lss_pde_solvers
@@ -29,25 +31,54 @@ using container_2d_t = container_2d<by_enum::Row>;
  */
 class wave_implicit_time_loop
 {
+    /**
+        @brief  Steps through the time range with local error control, every step is taken once as a whole
+                and once as two half-steps, the half-steps are kept when their estimated error meets the
+                tolerance and the next time step follows from the estimate. While the time step stays unchanged
+                both continue their three-level history, a changed time step restarts it from the solution and
+                its time derivative. restart_fn(solution, time derivative, time, next time, next solution) and
+                step_fn(solution 0, solution 1, time, next time, next solution) perform each solve
+    **/
+    template <typename restart_fn_t, typename step_fn_t>
+    static void adapt_time_steps(wave_implicit_solver_method_ptr const &solver_ptr, range_ptr const &time_range,
+                                 double const time_step, traverse_direction_enum const &traverse_dir,
+                                 adaptive_time_stepping_config_ptr const &adaptive_time_stepping,
+                                 container_t &prev_solution_0, container_t &prev_solution_1,
+                                 container_t &next_solution, restart_fn_t &&restart_fn, step_fn_t &&step_fn);
 
   public:
+    /**
+        @brief  Runs the time loop
+        @param  solver_ptr - solver method
+        @param  boundary_pair - boundary pair
+        @param  time_range - time range
+        @param  last_time_idx - last time index
+        @param  time_step - time step
+        @param  traverse_dir - traverse direction
+        @param  prev_solution_0 - holds initial (terminal) solution on entry
+        @param  prev_solution_1 - holds its time derivative on entry and final solution on exit
+        @param  next_solution - holds final solution on exit
+        @param  adaptive_time_stepping - local error control, time_step is then only the initial time step
+    **/
     static void run(wave_implicit_solver_method_ptr const &solver_ptr, boundary_1d_pair const &boundary_pair,
                     range_ptr const &time_range, std::size_t const &last_time_idx, double const time_step,
                     traverse_direction_enum const &traverse_dir, container_t &prev_solution_0,
-                    container_t &prev_solution_1, container_t &next_solution);
+                    container_t &prev_solution_1, container_t &next_solution,
+                    adaptive_time_stepping_config_ptr const &adaptive_time_stepping = nullptr);
 
     static void run(wave_implicit_solver_method_ptr const &solver_ptr, boundary_1d_pair const &boundary_pair,
                     range_ptr const &time_range, std::size_t const &last_time_idx, double const time_step,
                     traverse_direction_enum const &traverse_dir, container_t &prev_solution_0,
                     container_t &prev_solution_1, std::function<double(double, double)> const &wave_source,
-                    container_t &next_solution);
+                    container_t &next_solution,
+                    adaptive_time_stepping_config_ptr const &adaptive_time_stepping = nullptr);
 
     static void run_with_stepping(wave_implicit_solver_method_ptr const &solver_ptr,
                                   boundary_1d_pair const &boundary_pair, range_ptr const &time_range,
                                   std::size_t const &last_time_idx, double const time_step,
                                   traverse_direction_enum const &traverse_dir, container_t &prev_solution_0,
                                   container_t &prev_solution_1, container_t &next_solution,
-                                  container_2d<by_enum::Row> &solutions);
+                                  time_slice_observer_1d const &observer);
 
     static void run_with_stepping(wave_implicit_solver_method_ptr const &solver_ptr,
                                   boundary_1d_pair const &boundary_pair, range_ptr const &time_range,
@@ -55,7 +86,7 @@ class wave_implicit_time_loop
                                   traverse_direction_enum const &traverse_dir, container_t &prev_solution_0,
                                   container_t &prev_solution_1,
                                   std::function<double(double, double)> const &wave_source, container_t &next_solution,
-                                  container_2d<by_enum::Row> &solutions);
+                                  time_slice_observer_1d const &observer);
 };
 
 } // namespace one_dimensional
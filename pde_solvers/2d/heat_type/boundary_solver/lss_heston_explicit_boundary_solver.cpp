@@ -9,8 +9,10 @@
 namespace lss_pde_solvers
 {
 
+using lss_boundary::boundary_cast;
 using lss_boundary::dirichlet_boundary_2d;
 using lss_boundary::neumann_boundary_2d;
+using lss_enumerations::solver_phase_enum;
 using d_1d = discretization_1d<std::vector, std::allocator<double>>;
 using lss_grids::grid_2d;
 
@@ -38,13 +40,13 @@ void explicit_heston_boundary_scheme::rhs(heston_implicit_coefficients_ptr const
     auto const &second_bnd = horizontal_boundary_pair.second;
 
     double x{}, h_1{};
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(first_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_2d>(first_bnd))
     {
         solution[0] = ptr->value(time, y);
     }
 
     const std::size_t N = solution.size() - 1;
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_2d>(second_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_2d>(second_bnd))
     {
         x = grid_2d::value_1(grid_cfg, N);
         h_1 = grid_2d::step_1(grid_cfg);
@@ -53,7 +55,7 @@ void explicit_heston_boundary_scheme::rhs(heston_implicit_coefficients_ptr const
                       (four * ni * E(time, x, y) * input(N, y_index + 1)) -
                       (ni * E(time, x, y) * input(N, y_index + 2)) - (delta * delta_ * D(time, x, y));
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<dirichlet_boundary_2d>(second_bnd))
     {
         solution[N] = ptr->value(time, y);
     }
@@ -90,13 +92,13 @@ void explicit_heston_boundary_scheme::rhs_source(heston_implicit_coefficients_pt
     auto const &second_bnd = horizontal_boundary_pair.second;
 
     double x{}, h_1{};
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(first_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_2d>(first_bnd))
     {
         solution[0] = ptr->value(time, y);
     }
 
     const std::size_t N = solution.size() - 1;
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_2d>(second_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_2d>(second_bnd))
     {
         x = grid_2d::value_1(grid_cfg, N);
         h_1 = grid_2d::step_1(grid_cfg);
@@ -106,7 +108,7 @@ void explicit_heston_boundary_scheme::rhs_source(heston_implicit_coefficients_pt
                       (ni * E(time, x, y) * input(N, y_index + 2)) - (delta * delta_ * D(time, x, y)) +
                       (rho * inhom_input(N, y_index));
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(second_bnd))
+    else if (auto const &ptr = boundary_cast<dirichlet_boundary_2d>(second_bnd))
     {
         solution[N] = ptr->value(time, y);
     }
@@ -122,8 +124,9 @@ void explicit_heston_boundary_scheme::rhs_source(heston_implicit_coefficients_pt
 }
 
 heston_explicit_boundary_solver::heston_explicit_boundary_solver(heston_implicit_coefficients_ptr const &coefficients,
-                                                                 grid_config_2d_ptr const &grid_config)
-    : coefficients_{coefficients}, grid_cfg_{grid_config}
+                                                                 grid_config_2d_ptr const &grid_config,
+                                                                 solver_stats_ptr const &stats)
+    : coefficients_{coefficients}, grid_cfg_{grid_config}, stats_{stats}
 {
 }
 
@@ -136,20 +139,22 @@ void heston_explicit_boundary_solver::solve(container_2d<by_enum::Row> const &pr
                                             boundary_2d_ptr const &vertical_upper_boundary_ptr, double const &time,
                                             container_2d<by_enum::Row> &solution)
 {
-    container_2d<by_enum::Column> csolution(solution);
+    LSS_STATS_PHASE(stats_, solver_phase_enum::BoundarySolve);
     // 1D container for intermediate solution:
     container_t solution_v(coefficients_->space_size_x_, double{});
+    LSS_STATS_ADD(stats_, add_bytes_allocated, solution_v.size() * sizeof(double));
     // get the right-hand side of the scheme:
     auto const y = grid_2d::value_2(grid_cfg_, 0);
     explicit_heston_boundary_scheme::rhs(coefficients_, grid_cfg_, 0, y, horizonatal_boundary_pair, prev_solution, time,
                                          solution_v);
-    csolution(0, solution_v);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(vertical_upper_boundary_ptr))
+    // boundary columns are written in place through strided views:
+    solution.column(0).copy_from(solution_v);
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_2d>(vertical_upper_boundary_ptr))
     {
         auto const &upper_bnd = [=](double t, double s) { return ptr->value(t, s); };
         d_1d::of_function(grid_cfg_->grid_1(), time, upper_bnd, solution_v);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_2d>(vertical_upper_boundary_ptr))
+    else if (auto const &ptr = boundary_cast<neumann_boundary_2d>(vertical_upper_boundary_ptr))
     {
         auto const &grid_1 = grid_cfg_->grid_1();
         auto const &grid_2 = grid_cfg_->grid_2();
@@ -163,16 +168,17 @@ void heston_explicit_boundary_solver::solve(container_2d<by_enum::Row> const &pr
         d_1d::of_function(grid_cfg_->grid_1(), time, upper_bnd, solution_v);
     }
 
-    csolution(coefficients_->space_size_y_ - 1, solution_v);
-    solution = csolution;
+    solution.column(coefficients_->space_size_y_ - 1).copy_from(solution_v);
 }
 
 void heston_explicit_boundary_solver::solve(container_2d<by_enum::Row> const &prev_solution,
                                             boundary_2d_pair const &horizonatal_boundary_pair, double const &time,
                                             container_2d<by_enum::Row> &solution)
 {
+    LSS_STATS_PHASE(stats_, solver_phase_enum::BoundarySolve);
     // 1D container for intermediate solution:
     container_t solution_v(coefficients_->space_size_y_, double{});
+    LSS_STATS_ADD(stats_, add_bytes_allocated, solution_v.size() * sizeof(double));
     // some constants:
     auto const &start_y = coefficients_->rangey_->lower();
     // prepare grid_1:
@@ -180,12 +186,12 @@ void heston_explicit_boundary_solver::solve(container_2d<by_enum::Row> const &pr
     // prepare grid_2:
     auto const &grid_2 = grid_cfg_->grid_2();
     // populating lower horizontal:
-    auto const &lower_bnd_ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(horizonatal_boundary_pair.first);
+    auto const &lower_bnd_ptr = boundary_cast<dirichlet_boundary_2d>(horizonatal_boundary_pair.first);
     auto const &lower_bnd = [=](double t, double v) { return lower_bnd_ptr->value(t, v); };
     d_1d::of_function(grid_2, time, lower_bnd, solution_v);
     solution(0, solution_v);
     // populating upper horizontal:
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_2d>(horizonatal_boundary_pair.second))
+    if (auto const &ptr = boundary_cast<neumann_boundary_2d>(horizonatal_boundary_pair.second))
     {
         auto const lri = solution.rows() - 1;
         auto const &upper_bnd = [=](double t, double v) {
@@ -196,7 +202,7 @@ void heston_explicit_boundary_solver::solve(container_2d<by_enum::Row> const &pr
         };
         d_1d::of_function(grid_2, time, upper_bnd, solution_v);
     }
-    else if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(horizonatal_boundary_pair.second))
+    else if (auto const &ptr = boundary_cast<dirichlet_boundary_2d>(horizonatal_boundary_pair.second))
     {
         auto const &upper_bnd = [=](double t, double v) { return ptr->value(t, v); };
         d_1d::of_function(grid_2, time, upper_bnd, solution_v);
@@ -205,6 +211,11 @@ void heston_explicit_boundary_solver::solve(container_2d<by_enum::Row> const &pr
     solution(N_x - 1, solution_v);
 }
 
+void heston_explicit_boundary_solver::set_time_step(double time_step)
+{
+    coefficients_->set_time_step(time_step);
+}
+
 } // namespace two_dimensional
 
 } // namespace lss_pde_solvers
@@ -5,6 +5,7 @@
 
 #include "../../../../boundaries/lss_boundary.hpp"
 #include "../../../../common/lss_enumerations.hpp"
+#include "../../../../common/lss_solver_stats.hpp"
 #include "../../../../common/lss_utility.hpp"
 #include "../../../../containers/lss_container_2d.hpp"
 #include "../../../../discretization/lss_grid_config.hpp"
@@ -21,6 +22,7 @@ using lss_containers::container_2d;
 using lss_enumerations::by_enum;
 using lss_grids::grid_config_2d_ptr;
 using lss_utility::container_t;
+using lss_utility::solver_stats_ptr;
 
 /**
     explicit_heston_boundary_scheme object
@@ -48,12 +50,20 @@ class heston_explicit_boundary_solver
   private:
     heston_implicit_coefficients_ptr coefficients_;
     grid_config_2d_ptr grid_cfg_;
+    solver_stats_ptr stats_;
 
     explicit heston_explicit_boundary_solver() = delete;
 
   public:
+    /**
+        @brief  heston_explicit_boundary_solver object constructor
+        @param  coefficients - scheme coefficients
+        @param  grid_config - grid
+        @param  stats - statistics the boundary solves are recorded into (null records nothing)
+    **/
     explicit heston_explicit_boundary_solver(heston_implicit_coefficients_ptr const &coefficients,
-                                             grid_config_2d_ptr const &grid_config);
+                                             grid_config_2d_ptr const &grid_config,
+                                             solver_stats_ptr const &stats = nullptr);
 
     ~heston_explicit_boundary_solver();
 
@@ -68,6 +78,12 @@ class heston_explicit_boundary_solver
 
     void solve(container_2d<by_enum::Row> const &prev_solution, boundary_2d_pair const &horizonatal_boundary_pair,
                double const &time, container_2d<by_enum::Row> &solution);
+
+    /**
+        @brief  Sets the time step of the next solve (non-uniform time grids)
+        @param  time_step - time step
+    **/
+    void set_time_step(double time_step);
 };
 
 using heston_explicit_boundary_solver_ptr = sptr_t<heston_explicit_boundary_solver>;
@@ -12,6 +12,7 @@ void heston_euler_coefficients::initialize_coefficients(heston_implicit_coeffici
     // size of spaces discretization:
     space_size_x_ = coefficients->space_size_x_;
     space_size_y_ = coefficients->space_size_y_;
+    is_time_homogeneous_ = coefficients->is_time_homogeneous_;
     // calculate scheme coefficients:
     rho_ = coefficients->rho_;
     // save coefficients locally:
@@ -20,6 +20,7 @@ struct heston_euler_coefficients
     // scheme constant coefficients:
     double rho_, k_;
     std::size_t space_size_x_, space_size_y_;
+    bool is_time_homogeneous_;
     // functional coefficients:
     std::function<double(double, double, double)> M_;
     std::function<double(double, double, double)> M_tilde_;
@@ -18,16 +18,17 @@ void heston_euler_scheme::initialize(heston_implicit_coefficients_ptr const &coe
 {
     LSS_ASSERT(is_stable(coefficients) == true, "The chosen scheme is not stable");
     euler_coeffs_ = std::make_shared<heston_euler_coefficients>(coefficients);
-    heston_boundary_ = std::make_shared<heston_explicit_boundary_solver>(coefficients, grid_cfg_);
+    heston_boundary_ = std::make_shared<heston_explicit_boundary_solver>(coefficients, grid_cfg_, stats_);
 }
 
 heston_euler_scheme::heston_euler_scheme(heston_implicit_coefficients_ptr const &coefficients,
                                          boundary_2d_ptr const &vertical_upper_boundary_ptr,
                                          boundary_2d_pair const &horizontal_boundary_pair,
                                          pde_discretization_config_2d_ptr const &discretization_config,
-                                         grid_config_2d_ptr const &grid_config)
+                                         grid_config_2d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                         solver_stats_ptr const &stats)
     : boundary_ver_{vertical_upper_boundary_ptr}, boundary_pair_hor_{horizontal_boundary_pair},
-      discretization_cfg_{discretization_config}, grid_cfg_{grid_config}
+      discretization_cfg_{discretization_config}, grid_cfg_{grid_config}, thread_pool_{thread_pool}, stats_{stats}
 {
     initialize(coefficients);
 }
@@ -46,7 +47,7 @@ void heston_euler_scheme::operator()(container_2d<by_enum::Row> &prev_solution,
     // last time index:
     const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
     auto const &solver_method_ptr =
-        std::make_shared<heston_euler_solver_method>(euler_coeffs_, grid_cfg_, is_heat_sourse_set);
+        std::make_shared<heston_euler_solver_method>(euler_coeffs_, grid_cfg_, is_heat_sourse_set, thread_pool_);
     if (is_heat_sourse_set)
     {
         // TODO: to be implemented!!!
@@ -56,7 +57,8 @@ void heston_euler_scheme::operator()(container_2d<by_enum::Row> &prev_solution,
     else
     {
         heston_explicit_time_loop::run(solver_method_ptr, heston_boundary_, boundary_pair_hor_, boundary_ver_,
-                                       grid_cfg_, timer, last_time_idx, k, traverse_dir, prev_solution, next_solution);
+                                       grid_cfg_, timer, last_time_idx, k, traverse_dir, prev_solution, next_solution,
+                                       stats_);
     }
 }
 
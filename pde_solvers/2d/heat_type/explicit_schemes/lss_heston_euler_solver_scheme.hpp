@@ -33,6 +33,8 @@ class heston_euler_scheme
     boundary_2d_pair boundary_pair_hor_;
     pde_discretization_config_2d_ptr discretization_cfg_;
     grid_config_2d_ptr grid_cfg_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
     bool is_stable(heston_implicit_coefficients_ptr const &coefficients);
 
@@ -45,7 +47,8 @@ class heston_euler_scheme
                         boundary_2d_ptr const &vertical_upper_boundary_ptr,
                         boundary_2d_pair const &horizontal_boundary_pair,
                         pde_discretization_config_2d_ptr const &discretization_config,
-                        grid_config_2d_ptr const &grid_config);
+                        grid_config_2d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                        solver_stats_ptr const &stats);
 
     ~heston_euler_scheme();
 
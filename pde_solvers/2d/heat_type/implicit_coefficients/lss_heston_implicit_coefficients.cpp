@@ -6,7 +6,8 @@ namespace two_dimensional
 {
 
 void heston_implicit_coefficients::initialize(pde_discretization_config_2d_ptr const &discretization_config,
-                                              splitting_method_config_ptr const &splitting_config)
+                                              splitting_method_config_ptr const &splitting_config,
+                                              double step_fraction)
 {
     // get space ranges:
     const auto &spaces = discretization_config->space_range();
@@ -15,11 +16,18 @@ void heston_implicit_coefficients::initialize(pde_discretization_config_2d_ptr c
     // across Y:
     rangey_ = std::get<1>(spaces);
     // time step:
-    const double k = discretization_config->time_step();
+    k_ = step_fraction * discretization_config->time_step();
     // size of spaces discretization:
     const auto &space_sizes = discretization_config->number_of_space_points();
     space_size_x_ = std::get<0>(space_sizes);
     space_size_y_ = std::get<1>(space_sizes);
+    initialize_scheme_coefficients();
+    if (splitting_config != nullptr)
+        zeta_ = splitting_config->weighting_value();
+}
+
+void heston_implicit_coefficients::initialize_scheme_coefficients()
+{
     // calculate scheme coefficients:
     const double one = 1.0;
     const double half = 0.5;
@@ -27,15 +35,12 @@ void heston_implicit_coefficients::initialize(pde_discretization_config_2d_ptr c
     auto const &h_1 = one / (space_size_x_ - 1);
     auto const &h_2 = one / (space_size_y_ - 1);
 
-    k_ = k;
     alpha_ = k_ / (h_1 * h_1);
     beta_ = k_ / (h_2 * h_2);
     gamma_ = quarter * k_ / (h_1 * h_2);
     delta_ = half * k_ / h_1;
     ni_ = half * k_ / h_2;
-    rho_ = k;
-    if (splitting_config != nullptr)
-        zeta_ = splitting_config->weighting_value();
+    rho_ = k_;
 }
 
 void heston_implicit_coefficients::initialize_coefficients(heat_data_transform_2d_ptr const &heat_data_config)
@@ -61,15 +66,112 @@ void heston_implicit_coefficients::initialize_coefficients(heat_data_transform_2
     D_ = [=](double t, double x, double y) { return d(t, x, y); };
     E_ = [=](double t, double x, double y) { return e(t, x, y); };
     F_ = [=](double t, double x, double y) { return f(t, x, y); };
+    is_time_homogeneous_ = heat_data_config->is_time_homogeneous();
+    is_separable_ = heat_data_config->is_separable();
+}
+
+void heston_implicit_coefficients::initialize_tables(double time)
+{
+    const std::size_t size = space_size_x_ * space_size_y_;
+    M_table_.resize(size);
+    M_tilde_table_.resize(size);
+    P_table_.resize(size);
+    P_tilde_table_.resize(size);
+    Z_table_.resize(size);
+    W_table_.resize(size);
+    C_table_.resize(size);
+    const double h_1 = 1.0 / (space_size_x_ - 1);
+    const double h_2 = 1.0 / (space_size_y_ - 1);
+    double x{}, y{};
+    std::size_t idx{};
+    for (std::size_t r = 0; r < space_size_x_; ++r)
+    {
+        x = h_1 * r;
+        for (std::size_t c = 0; c < space_size_y_; ++c)
+        {
+            y = h_2 * c;
+            idx = r * space_size_y_ + c;
+            M_table_[idx] = M_(time, x, y);
+            M_tilde_table_[idx] = M_tilde_(time, x, y);
+            P_table_[idx] = P_(time, x, y);
+            P_tilde_table_[idx] = P_tilde_(time, x, y);
+            Z_table_[idx] = Z_(time, x, y);
+            W_table_[idx] = W_(time, x, y);
+            C_table_[idx] = C_(time, x, y);
+        }
+    }
+}
+
+void heston_implicit_coefficients::initialize_separable(heat_data_transform_2d_ptr const &heat_data_config)
+{
+    auto const &parts = heat_data_config->separable_parts();
+    separable_ = separable_coefficients(heat_data_config->time_factors(), 6);
+    const std::size_t size = space_size_x_ * space_size_y_;
+    std::vector<container_t> tables(6, container_t(size));
+    const double h_1 = 1.0 / (space_size_x_ - 1);
+    const double h_2 = 1.0 / (space_size_y_ - 1);
+    double x{}, y{};
+    std::size_t idx{};
+    for (std::size_t p = 0; p < parts.size(); ++p)
+    {
+        // parts are time-homogeneous:
+        for (std::size_t r = 0; r < space_size_x_; ++r)
+        {
+            x = h_1 * r;
+            for (std::size_t c = 0; c < space_size_y_; ++c)
+            {
+                y = h_2 * c;
+                idx = r * space_size_y_ + c;
+                tables[0][idx] = parts[p]->a_coefficient()(0.0, x, y);
+                tables[1][idx] = parts[p]->b_coefficient()(0.0, x, y);
+                tables[2][idx] = parts[p]->c_coefficient()(0.0, x, y);
+                tables[3][idx] = parts[p]->d_coefficient()(0.0, x, y);
+                tables[4][idx] = parts[p]->e_coefficient()(0.0, x, y);
+                tables[5][idx] = parts[p]->f_coefficient()(0.0, x, y);
+            }
+        }
+        for (std::size_t i = 0; i < tables.size(); ++i)
+            separable_.add_part(i, p, tables[i]);
+    }
 }
 
 heston_implicit_coefficients::heston_implicit_coefficients(
     heat_data_transform_2d_ptr const &heat_data_config, pde_discretization_config_2d_ptr const &discretization_config,
-    splitting_method_config_ptr const splitting_config, double const &theta)
+    splitting_method_config_ptr const splitting_config, double const &theta, double const &step_fraction)
     : theta_{theta}
 {
-    initialize(discretization_config, splitting_config);
+    initialize(discretization_config, splitting_config, step_fraction);
     initialize_coefficients(heat_data_config);
+    if (is_time_homogeneous_)
+    {
+        table_time_ = discretization_config->time_range()->lower();
+        initialize_tables(table_time_);
+    }
+    else if (is_separable_)
+    {
+        initialize_separable(heat_data_config);
+    }
+}
+
+void heston_implicit_coefficients::set_time_step(double time_step)
+{
+    // splitting method and boundary solver share the coefficients:
+    if (time_step == k_)
+        return;
+    k_ = time_step;
+    initialize_scheme_coefficients();
+    if (is_time_homogeneous_)
+    {
+        initialize_tables(table_time_);
+    }
+}
+
+void heston_implicit_coefficients::prepare_time_factors(double time)
+{
+    if (is_separable_ && !is_time_homogeneous_)
+    {
+        separable_.prepare(time);
+    }
 }
 
 } // namespace two_dimensional
@@ -4,6 +4,7 @@
 #include "../../../../common/lss_utility.hpp"
 #include "../../../../discretization/lss_discretization.hpp"
 #include "../../../lss_pde_discretization_config.hpp"
+#include "../../../lss_separable_coefficients.hpp"
 #include "../../../lss_splitting_method_config.hpp"
 #include "../../../transformation/lss_heat_data_transform.hpp"
 
@@ -12,6 +13,7 @@ namespace lss_pde_solvers
 namespace two_dimensional
 {
 
+using lss_utility::container_t;
 using lss_utility::range_ptr;
 using lss_utility::sptr_t;
 
@@ -38,19 +40,129 @@ struct heston_implicit_coefficients
     std::function<double(double, double, double)> D_;
     std::function<double(double, double, double)> E_;
     std::function<double(double, double, double)> F_;
+    // tabulated coefficients stored row-wise (filled only for time-homogeneous data):
+    bool is_time_homogeneous_;
+    container_t M_table_;
+    container_t M_tilde_table_;
+    container_t P_table_;
+    container_t P_tilde_table_;
+    container_t Z_table_;
+    container_t W_table_;
+    container_t C_table_;
+    double table_time_;
+    // tabulated spatial parts of a, b, c, d, e, f stored row-wise (filled only for separable data):
+    bool is_separable_;
+    separable_coefficients separable_;
 
   private:
     void initialize(pde_discretization_config_2d_ptr const &discretization_config,
-                    splitting_method_config_ptr const &splitting_config);
+                    splitting_method_config_ptr const &splitting_config, double step_fraction);
+
+    void initialize_scheme_coefficients();
 
     void initialize_coefficients(heat_data_transform_2d_ptr const &heat_data_config);
 
+    void initialize_tables(double time);
+
+    void initialize_separable(heat_data_transform_2d_ptr const &heat_data_config);
+
   public:
     heston_implicit_coefficients() = delete;
 
+    /**
+        @brief heston_implicit_coefficients object constructor
+        @param heat_data_config - heat data
+        @param discretization_config - discretization
+        @param splitting_config - splitting method
+        @param theta - implicit weight of the scheme
+        @param step_fraction - fraction of the time step the coefficients advance by (0.5 for Rannacher half-steps)
+    **/
     heston_implicit_coefficients(heat_data_transform_2d_ptr const &heat_data_config,
                                  pde_discretization_config_2d_ptr const &discretization_config,
-                                 splitting_method_config_ptr const splitting_config, double const &theta);
+                                 splitting_method_config_ptr const splitting_config, double const &theta,
+                                 double const &step_fraction = 1.0);
+
+    /**
+        @brief  Resets the time step the coefficients advance by (used by non-uniform time grids)
+        @param  time_step - new time step
+    **/
+    void set_time_step(double time_step);
+
+    /**
+        @brief  Evaluates time factors of separable data once for given time
+        @param  time - time the coefficients are read at next (called before the sweeps)
+    **/
+    void prepare_time_factors(double time);
+
+    inline double M(double time, double x, double y, std::size_t x_idx, std::size_t y_idx) const
+    {
+        const std::size_t idx = x_idx * space_size_y_ + y_idx;
+        if (is_time_homogeneous_)
+            return M_table_[idx];
+        if (is_separable_)
+            return (alpha_ * separable_.value(0, time, idx) - delta_ * separable_.value(3, time, idx));
+        return M_(time, x, y);
+    }
+
+    inline double M_tilde(double time, double x, double y, std::size_t x_idx, std::size_t y_idx) const
+    {
+        const std::size_t idx = x_idx * space_size_y_ + y_idx;
+        if (is_time_homogeneous_)
+            return M_tilde_table_[idx];
+        if (is_separable_)
+            return (beta_ * separable_.value(1, time, idx) - ni_ * separable_.value(4, time, idx));
+        return M_tilde_(time, x, y);
+    }
+
+    inline double P(double time, double x, double y, std::size_t x_idx, std::size_t y_idx) const
+    {
+        const std::size_t idx = x_idx * space_size_y_ + y_idx;
+        if (is_time_homogeneous_)
+            return P_table_[idx];
+        if (is_separable_)
+            return (alpha_ * separable_.value(0, time, idx) + delta_ * separable_.value(3, time, idx));
+        return P_(time, x, y);
+    }
+
+    inline double P_tilde(double time, double x, double y, std::size_t x_idx, std::size_t y_idx) const
+    {
+        const std::size_t idx = x_idx * space_size_y_ + y_idx;
+        if (is_time_homogeneous_)
+            return P_tilde_table_[idx];
+        if (is_separable_)
+            return (beta_ * separable_.value(1, time, idx) + ni_ * separable_.value(4, time, idx));
+        return P_tilde_(time, x, y);
+    }
+
+    inline double Z(double time, double x, double y, std::size_t x_idx, std::size_t y_idx) const
+    {
+        const std::size_t idx = x_idx * space_size_y_ + y_idx;
+        if (is_time_homogeneous_)
+            return Z_table_[idx];
+        if (is_separable_)
+            return (2.0 * alpha_ * separable_.value(0, time, idx) - 0.5 * rho_ * separable_.value(5, time, idx));
+        return Z_(time, x, y);
+    }
+
+    inline double W(double time, double x, double y, std::size_t x_idx, std::size_t y_idx) const
+    {
+        const std::size_t idx = x_idx * space_size_y_ + y_idx;
+        if (is_time_homogeneous_)
+            return W_table_[idx];
+        if (is_separable_)
+            return (2.0 * beta_ * separable_.value(1, time, idx) - 0.5 * rho_ * separable_.value(5, time, idx));
+        return W_(time, x, y);
+    }
+
+    inline double C(double time, double x, double y, std::size_t x_idx, std::size_t y_idx) const
+    {
+        const std::size_t idx = x_idx * space_size_y_ + y_idx;
+        if (is_time_homogeneous_)
+            return C_table_[idx];
+        if (is_separable_)
+            return (separable_.value(2, time, idx));
+        return C_(time, x, y);
+    }
 };
 
 using heston_implicit_coefficients_ptr = sptr_t<heston_implicit_coefficients>;
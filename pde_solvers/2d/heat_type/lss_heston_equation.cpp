@@ -13,8 +13,12 @@ namespace lss_pde_solvers
 
 using lss_boundary::dirichlet_boundary_2d;
 using lss_boundary::neumann_boundary_2d;
+using lss_containers::transpose;
+using lss_enumerations::solver_phase_enum;
 using lss_grids::grid_config_2d;
 using lss_grids::grid_transform_config_2d;
+using lss_utility::make_thread_pool;
+using lss_utility::solver_stats;
 
 namespace two_dimensional
 {
@@ -80,19 +84,34 @@ heston_equation::heston_equation(
     heat_data_config_2d_ptr const &heat_data_config, pde_discretization_config_2d_ptr const &discretization_config,
     boundary_2d_ptr const &vertical_upper_boundary_ptr, boundary_2d_pair const &horizontal_boundary_pair,
     splitting_method_config_ptr const &splitting_method_config, grid_config_hints_2d_ptr const &grid_config_hints,
-    heat_implicit_solver_config_ptr const &solver_config, std::map<std::string, double> const &solver_config_details)
+    heat_implicit_solver_config_ptr const &solver_config, std::map<std::string, double> const &solver_config_details,
+    execution_policy_ptr const &execution_policy)
     : discretization_cfg_{discretization_config}, splitting_method_cfg_{splitting_method_config},
       solver_cfg_{solver_config}, solver_config_details_{solver_config_details}
 {
     initialize(heat_data_config, grid_config_hints, vertical_upper_boundary_ptr, horizontal_boundary_pair);
+    // line sweeps of every solve run on the shared pool, or on a private one sized by the splitting config:
+    thread_pool_ = make_thread_pool(execution_policy, splitting_method_cfg_->number_of_threads());
+    stats_ = std::make_shared<solver_stats>();
 }
 
 heston_equation ::~heston_equation()
 {
 }
 
+solver_stats_ptr const &heston_equation::stats() const
+{
+    return stats_;
+}
+
 void heston_equation::solve(container_2d<by_enum::Row> &solution)
 {
+    solve(solution, nullptr);
+}
+
+void heston_equation::solve(container_2d<by_enum::Row> &solution, time_slice_observer_2d_ptr const &observer)
+{
+    LSS_STATS_PHASE(stats_, solver_phase_enum::Total);
     LSS_ASSERT((solution.rows()) > 0 && (solution.columns() > 0), "The input solution container must be initialized");
 
     // get space ranges:
@@ -131,8 +150,8 @@ void heston_equation::solve(container_2d<by_enum::Row> &solution)
                 dev_cu_solver;
 
             dev_cu_solver solver(ver_boundary_ptr, hor_boundary_pair_ptr, heat_data_trans_cfg_, discretization_cfg_,
-                                 splitting_method_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol, next_sol, is_heat_source_set, heat_source);
+                                 splitting_method_cfg_, solver_cfg_, grid_cfg, thread_pool_, stats_);
+            solver(prev_sol, next_sol, is_heat_source_set, heat_source, observer);
             solution = prev_sol;
         }
         else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::SORSolver)
@@ -143,8 +162,8 @@ void heston_equation::solve(container_2d<by_enum::Row> &solution)
             LSS_ASSERT(!solver_config_details_.empty(), "solver_config_details map must not be empty");
             double omega_value = solver_config_details_["sor_omega"];
             dev_sor_solver solver(ver_boundary_ptr, hor_boundary_pair_ptr, heat_data_trans_cfg_, discretization_cfg_,
-                                  splitting_method_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol, next_sol, is_heat_source_set, heat_source, omega_value);
+                                  splitting_method_cfg_, solver_cfg_, grid_cfg, thread_pool_, stats_);
+            solver(prev_sol, next_sol, is_heat_source_set, heat_source, omega_value, observer);
             solution = prev_sol;
         }
         else
@@ -160,8 +179,8 @@ void heston_equation::solve(container_2d<by_enum::Row> &solution)
                 host_cu_solver;
 
             host_cu_solver solver(ver_boundary_ptr, hor_boundary_pair_ptr, heat_data_trans_cfg_, discretization_cfg_,
-                                  splitting_method_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol, next_sol, is_heat_source_set, heat_source);
+                                  splitting_method_cfg_, solver_cfg_, grid_cfg, thread_pool_, stats_);
+            solver(prev_sol, next_sol, is_heat_source_set, heat_source, observer);
             solution = next_sol;
         }
         else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::SORSolver)
@@ -172,8 +191,8 @@ void heston_equation::solve(container_2d<by_enum::Row> &solution)
             LSS_ASSERT(!solver_config_details_.empty(), "solver_config_details map must not be empty");
             double omega_value = solver_config_details_["sor_omega"];
             host_sor_solver solver(ver_boundary_ptr, hor_boundary_pair_ptr, heat_data_trans_cfg_, discretization_cfg_,
-                                   splitting_method_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol, next_sol, is_heat_source_set, heat_source, omega_value);
+                                   splitting_method_cfg_, solver_cfg_, grid_cfg, thread_pool_, stats_);
+            solver(prev_sol, next_sol, is_heat_source_set, heat_source, omega_value, observer);
             solution = next_sol;
         }
         else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::DoubleSweepSolver)
@@ -181,8 +200,8 @@ void heston_equation::solve(container_2d<by_enum::Row> &solution)
             typedef heston_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::DoubleSweepSolver>
                 host_dss_solver;
             host_dss_solver solver(ver_boundary_ptr, hor_boundary_pair_ptr, heat_data_trans_cfg_, discretization_cfg_,
-                                   splitting_method_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol, next_sol, is_heat_source_set, heat_source);
+                                   splitting_method_cfg_, solver_cfg_, grid_cfg, thread_pool_, stats_);
+            solver(prev_sol, next_sol, is_heat_source_set, heat_source, observer);
             solution = next_sol;
         }
         else if (solver_cfg_->tridiagonal_method() == tridiagonal_method_enum::ThomasLUSolver)
@@ -190,8 +209,8 @@ void heston_equation::solve(container_2d<by_enum::Row> &solution)
             typedef heston_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::ThomasLUSolver>
                 host_lus_solver;
             host_lus_solver solver(ver_boundary_ptr, hor_boundary_pair_ptr, heat_data_trans_cfg_, discretization_cfg_,
-                                   splitting_method_cfg_, solver_cfg_, grid_cfg);
-            solver(prev_sol, next_sol, is_heat_source_set, heat_source);
+                                   splitting_method_cfg_, solver_cfg_, grid_cfg, thread_pool_, stats_);
+            solver(prev_sol, next_sol, is_heat_source_set, heat_source, observer);
             solution = next_sol;
         }
         else
@@ -205,9 +224,25 @@ void heston_equation::solve(container_2d<by_enum::Row> &solution)
     }
 }
 
-void heston_equation::solve(container_3d<by_enum::Row> &solutions)
+void heston_equation::solve(container_3d<by_enum::RowPlane> &solutions)
 {
-    throw std::exception("Not implemented.");
+    // size of time discretization:
+    const std::size_t time_size = discretization_cfg_->number_of_time_points();
+    // size of spaces discretization:
+    const auto &space_sizes = discretization_cfg_->number_of_space_points();
+    const std::size_t space_size_x = std::get<0>(space_sizes);
+    const std::size_t space_size_y = std::get<1>(space_sizes);
+    // This is the proper size of the container:
+    LSS_ASSERT((solutions.rows() == time_size) && (solutions.columns() == space_size_x) &&
+                   (solutions.layers() == space_size_y),
+               "The input solution 3D container must have the correct size");
+    // every time slice is stored as a row plane, which keeps the slice transposed (x runs fastest):
+    auto const observer = std::make_shared<time_slice_observer_2d>(
+        [&](std::size_t time_idx, double time, container_2d<by_enum::Row> const &slice) {
+            transpose(slice.raw_data(), space_size_x, space_size_y, solutions.plane(time_idx).data());
+        });
+    container_2d<by_enum::Row> solution(space_size_x, space_size_y, double{});
+    solve(solution, observer);
 }
 
 } // namespace implicit_solvers
@@ -223,6 +258,8 @@ void heston_equation::initialize(heat_data_config_2d_ptr const &heat_data_cfg,
     // verify and check:
     LSS_VERIFY(heat_data_cfg, "heat_data_config must not be null");
     LSS_VERIFY(discretization_cfg_, "discretization_config must not be null");
+    LSS_ASSERT(discretization_cfg_->time_grid() == nullptr,
+               "Non-uniform time grid is supported by implicit solvers only");
 
     if (auto ver_ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(vertical_upper_boundary_ptr))
     {
@@ -256,18 +293,27 @@ heston_equation::heston_equation(heat_data_config_2d_ptr const &heat_data_config
                                  boundary_2d_ptr const &vertical_upper_boundary_ptr,
                                  boundary_2d_pair const &horizontal_boundary_pair,
                                  grid_config_hints_2d_ptr const &grid_config_hints,
-                                 heat_explicit_solver_config_ptr const &solver_config)
+                                 heat_explicit_solver_config_ptr const &solver_config,
+                                 execution_policy_ptr const &execution_policy)
     : discretization_cfg_{discretization_config}, solver_cfg_{solver_config}
 {
     initialize(heat_data_config, grid_config_hints, vertical_upper_boundary_ptr, horizontal_boundary_pair);
+    thread_pool_ = make_thread_pool(execution_policy, solver_cfg_->number_of_threads());
+    stats_ = std::make_shared<solver_stats>();
 }
 
 heston_equation::~heston_equation()
 {
 }
 
+solver_stats_ptr const &heston_equation::stats() const
+{
+    return stats_;
+}
+
 void heston_equation::solve(container_2d<by_enum::Row> &solution)
 {
+    LSS_STATS_PHASE(stats_, solver_phase_enum::Total);
     LSS_ASSERT((solution.rows()) > 0 && (solution.columns() > 0), "The input solution container must be initialized");
 
     // get space ranges:
@@ -310,7 +356,7 @@ void heston_equation::solve(container_2d<by_enum::Row> &solution)
     {
         typedef heston_equation_explicit_kernel<memory_space_enum::Host> host_solver;
         host_solver solver(ver_boundary_ptr, hor_boundary_pair_ptr, heat_data_trans_cfg_, discretization_cfg_,
-                           solver_cfg_, grid_cfg);
+                           solver_cfg_, grid_cfg, thread_pool_, stats_);
         solver(prev_sol, next_sol, is_heat_source_set, heat_source);
         solution = next_sol;
     }
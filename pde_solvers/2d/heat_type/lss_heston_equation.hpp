@@ -6,7 +6,9 @@
 
 #include "../../../boundaries/lss_boundary.hpp"
 #include "../../../common/lss_enumerations.hpp"
+#include "../../../common/lss_execution_policy.hpp"
 #include "../../../common/lss_macros.hpp"
+#include "../../../common/lss_solver_stats.hpp"
 #include "../../../containers/lss_container_2d.hpp"
 #include "../../../containers/lss_container_3d.hpp"
 #include "../../../discretization/lss_discretization.hpp"
@@ -16,6 +18,7 @@
 #include "../../lss_heat_solver_config.hpp"
 #include "../../lss_pde_discretization_config.hpp"
 #include "../../lss_splitting_method_config.hpp"
+#include "../../lss_time_slice_observer.hpp"
 #include "../../transformation/lss_heat_data_transform.hpp"
 #include "transformation/lss_heston_boundary_transform.hpp"
 
@@ -32,6 +35,9 @@ using lss_enumerations::by_enum;
 using lss_enumerations::grid_enum;
 using lss_grids::grid_config_hints_2d_ptr;
 using lss_grids::grid_transform_config_2d_ptr;
+using lss_utility::execution_policy_ptr;
+using lss_utility::solver_stats_ptr;
+using lss_utility::thread_pool_ptr;
 
 using d_2d = discretization_2d<std::vector, std::allocator<double>>;
 
@@ -84,6 +90,8 @@ class heston_equation
     grid_transform_config_2d_ptr grid_trans_cfg_; // this may be removed as it is not used later
     heat_implicit_solver_config_ptr solver_cfg_;
     std::map<std::string, double> solver_config_details_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
     explicit heston_equation() = delete;
 
@@ -98,7 +106,8 @@ class heston_equation
         splitting_method_config_ptr const &splitting_method_config, grid_config_hints_2d_ptr const &grid_config_hints,
         heat_implicit_solver_config_ptr const &solver_config =
             default_heat_solver_configs::host_fwd_dssolver_euler_solver_config_ptr,
-        std::map<std::string, double> const &solver_config_details = std::map<std::string, double>());
+        std::map<std::string, double> const &solver_config_details = std::map<std::string, double>(),
+        execution_policy_ptr const &execution_policy = nullptr);
 
     ~heston_equation();
 
@@ -114,12 +123,26 @@ class heston_equation
      */
     LSS_API void solve(container_2d<by_enum::Row> &solution);
 
+    /**
+     * Get the final solution of the PDE and stream the solutions in time
+     *
+     * \param solution -  2D container for solution
+     * \param observer - receives the solutions in time that pass its decimation
+     */
+    LSS_API void solve(container_2d<by_enum::Row> &solution, time_slice_observer_2d_ptr const &observer);
+
     /**
      * Get all solutions in time (surface) of the PDE
      *
-     * \param solutions - 3D container for all the solutions in time
+     * \param solutions - 3D container for all the solutions in time, row plane per time index
      */
-    void solve(container_3d<by_enum::Row> &solutions);
+    LSS_API void solve(container_3d<by_enum::RowPlane> &solutions);
+
+    /**
+     * Get statistics accumulated over all solves, they are recorded only when
+     * built with LSS_SOLVER_STATS and may be cleared with reset()
+     */
+    LSS_API solver_stats_ptr const &stats() const;
 };
 
 } // namespace implicit_solvers
@@ -170,6 +193,8 @@ class heston_equation
     heston_boundary_transform_ptr heston_boundary_;
     grid_transform_config_2d_ptr grid_trans_cfg_; // this may be removed as it is not used later
     heat_explicit_solver_config_ptr solver_cfg_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
     explicit heston_equation() = delete;
 
@@ -184,7 +209,8 @@ class heston_equation
                              boundary_2d_pair const &horizontal_boundary_pair,
                              grid_config_hints_2d_ptr const &grid_config_hints,
                              heat_explicit_solver_config_ptr const &solver_config =
-                                 default_heat_solver_configs::dev_expl_fwd_euler_solver_config_ptr);
+                                 default_heat_solver_configs::dev_expl_fwd_euler_solver_config_ptr,
+                             execution_policy_ptr const &execution_policy = nullptr);
 
     ~heston_equation();
 
@@ -206,6 +232,12 @@ class heston_equation
      * \param solutions - 3D container for all the solutions in time
      */
     void solve(container_3d<by_enum::Row> &solutions);
+
+    /**
+     * Get statistics accumulated over all solves, they are recorded only when
+     * built with LSS_SOLVER_STATS and may be cleared with reset()
+     */
+    LSS_API solver_stats_ptr const &stats() const;
 };
 
 } // namespace explicit_solvers
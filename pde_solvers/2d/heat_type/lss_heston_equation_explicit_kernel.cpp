@@ -55,10 +55,11 @@ void heston_equation_explicit_kernel<memory_space_enum::Device>::operator()(
 heston_equation_explicit_kernel<memory_space_enum::Host>::heston_equation_explicit_kernel(
     boundary_2d_ptr const &vertical_upper_boundary_ptr, boundary_2d_pair const &horizontal_boundary_pair,
     heat_data_transform_2d_ptr const &heat_data_config, pde_discretization_config_2d_ptr const &discretization_config,
-    heat_explicit_solver_config_ptr const &solver_config, grid_config_2d_ptr const &grid_config)
+    heat_explicit_solver_config_ptr const &solver_config, grid_config_2d_ptr const &grid_config,
+    thread_pool_ptr const &thread_pool, solver_stats_ptr const &stats)
     : boundary_ver_{vertical_upper_boundary_ptr}, boundary_pair_hor_{horizontal_boundary_pair},
       heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, thread_pool_{thread_pool}, stats_{stats}
 {
 }
 
@@ -75,7 +76,7 @@ void heston_equation_explicit_kernel<memory_space_enum::Host>::operator()(
     if (solver_cfg_->explicit_pde_scheme() == explicit_pde_schemes_enum::Euler)
     {
         heston_euler_scheme euler_scheme(heston_coeff_holder, boundary_ver_, boundary_pair_hor_, discretization_cfg_,
-                                         grid_cfg_);
+                                         grid_cfg_, thread_pool_, stats_);
         euler_scheme(prev_solution, next_solution, is_heat_sourse_set, heat_source, traverse_dir);
     }
     else if (solver_cfg_->explicit_pde_scheme() == explicit_pde_schemes_enum::ADEBarakatClark)
@@ -5,6 +5,8 @@
 
 #include "../../../boundaries/lss_boundary.hpp"
 #include "../../../common/lss_enumerations.hpp"
+#include "../../../common/lss_solver_stats.hpp"
+#include "../../../common/lss_thread_pool.hpp"
 #include "../../../common/lss_utility.hpp"
 #include "../../../containers/lss_container_2d.hpp"
 #include "../../../containers/lss_container_3d.hpp"
@@ -29,7 +31,9 @@ using lss_enumerations::memory_space_enum;
 using lss_grids::grid_config_2d_ptr;
 using lss_utility::NaN;
 using lss_utility::range;
+using lss_utility::solver_stats_ptr;
 using lss_utility::sptr_t;
+using lss_utility::thread_pool_ptr;
 
 template <memory_space_enum memory_enum> class heston_equation_explicit_kernel
 {
@@ -80,6 +84,8 @@ template <> class heston_equation_explicit_kernel<memory_space_enum::Host>
     pde_discretization_config_2d_ptr discretization_cfg_;
     heat_explicit_solver_config_ptr solver_cfg_;
     grid_config_2d_ptr grid_cfg_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
   public:
     heston_equation_explicit_kernel(boundary_2d_ptr const &vertical_upper_boundary_ptr,
@@ -87,7 +93,8 @@ template <> class heston_equation_explicit_kernel<memory_space_enum::Host>
                                     heat_data_transform_2d_ptr const &heat_data_config,
                                     pde_discretization_config_2d_ptr const &discretization_config,
                                     heat_explicit_solver_config_ptr const &solver_config,
-                                    grid_config_2d_ptr const &grid_config);
+                                    grid_config_2d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                    solver_stats_ptr const &stats);
 
     void operator()(container_2d<by_enum::Row> &prev_solution, container_2d<by_enum::Row> &next_solution,
                     bool is_heat_sourse_set, std::function<double(double, double, double)> const &heat_source);
@@ -27,6 +27,78 @@ using lss_thomas_lu_solver::thomas_lu_solver;
 namespace two_dimensional
 {
 
+heston_implicit_kernel_loop::heston_implicit_kernel_loop(
+    tridiagonal_solver_ptrs const &solvers_y, tridiagonal_solver_ptrs const &solvers_u,
+    heat_data_transform_2d_ptr const &heat_data_config, pde_discretization_config_2d_ptr const &discretization_config,
+    splitting_method_config_ptr const &splitting_config, heat_implicit_solver_config_ptr const &solver_config,
+    grid_config_2d_ptr const &grid_config, bool is_heat_sourse_set, thread_pool_ptr const &thread_pool,
+    solver_stats_ptr const &stats)
+    : discretization_cfg_{discretization_config}, splitting_cfg_{splitting_config}, solver_cfg_{solver_config},
+      grid_cfg_{grid_config}, stats_{stats}
+{
+    // create a Heston coefficient holder:
+    auto const heston_coeff_holder = std::make_shared<heston_implicit_coefficients>(
+        heat_data_config, discretization_config, splitting_config, solver_config->implicit_pde_scheme_value());
+    // splitting method:
+    if (splitting_config->splitting_method() == splitting_method_enum::DouglasRachford)
+    {
+        splitting_ptr_ = std::make_shared<heat_douglas_rachford_method>(
+            solvers_y, solvers_u, heston_coeff_holder, grid_config, is_heat_sourse_set, thread_pool, stats);
+    }
+    else if (splitting_config->splitting_method() == splitting_method_enum::CraigSneyd)
+    {
+        splitting_ptr_ = std::make_shared<heat_craig_sneyd_method>(solvers_y, solvers_u, heston_coeff_holder,
+                                                                   grid_config, is_heat_sourse_set, thread_pool, stats);
+    }
+    else if (splitting_config->splitting_method() == splitting_method_enum::ModifiedCraigSneyd)
+    {
+        splitting_ptr_ = std::make_shared<heat_modified_craig_sneyd_method>(
+            solvers_y, solvers_u, heston_coeff_holder, grid_config, is_heat_sourse_set, thread_pool, stats);
+    }
+    else if (splitting_config->splitting_method() == splitting_method_enum::HundsdorferVerwer)
+    {
+        splitting_ptr_ = std::make_shared<heat_hundsdorfer_verwer_method>(
+            solvers_y, solvers_u, heston_coeff_holder, grid_config, is_heat_sourse_set, thread_pool, stats);
+    }
+    else
+    {
+        throw std::exception("Unreachable");
+    }
+    // create and set up lower volatility boundary solver:
+    boundary_solver_ = std::make_shared<heston_explicit_boundary_solver>(heston_coeff_holder, grid_config, stats);
+    // Rannacher start-up takes Douglas half-steps with theta = 1 and shares the line solvers:
+    if (splitting_config->rannacher_steps() > 0)
+    {
+        auto const startup_coeff_holder = std::make_shared<heston_implicit_coefficients>(
+            heat_data_config, discretization_config, splitting_config, 1.0, 0.5);
+        startup_splitting_ptr_ = std::make_shared<heat_douglas_rachford_method>(
+            solvers_y, solvers_u, startup_coeff_holder, grid_config, is_heat_sourse_set, thread_pool, stats);
+        startup_boundary_solver_ =
+            std::make_shared<heston_explicit_boundary_solver>(startup_coeff_holder, grid_config, stats);
+    }
+}
+
+void heston_implicit_kernel_loop::run(boundary_2d_ptr const &vertical_upper_boundary_ptr,
+                                      boundary_2d_pair const &horizontal_boundary_pair,
+                                      container_2d<by_enum::Row> &prev_solution,
+                                      container_2d<by_enum::Row> &next_solution,
+                                      time_slice_observer_2d_ptr const &observer) const
+{
+    // get time range:
+    auto const &time = discretization_cfg_->time_range();
+    // time step:
+    const double k = discretization_cfg_->time_step();
+    // last time index:
+    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
+    // save traverse_direction
+    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
+    heston_implicit_time_loop::run(splitting_ptr_, boundary_solver_, horizontal_boundary_pair,
+                                   vertical_upper_boundary_ptr, grid_cfg_, time, last_time_idx, k, traverse_dir,
+                                   prev_solution, next_solution, observer, startup_splitting_ptr_,
+                                   startup_boundary_solver_, splitting_cfg_->rannacher_steps(),
+                                   discretization_cfg_->time_grid(), stats_);
+}
+
 heston_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::CUDASolver>::
     heston_equation_implicit_kernel(boundary_2d_ptr const &vertical_upper_boundary_ptr,
                                     boundary_2d_pair const &horizontal_boundary_pair,
@@ -34,65 +106,39 @@ heston_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_en
                                     pde_discretization_config_2d_ptr const &discretization_config,
                                     splitting_method_config_ptr const &splitting_config,
                                     heat_implicit_solver_config_ptr const &solver_config,
-                                    grid_config_2d_ptr const &grid_config)
+                                    grid_config_2d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                    solver_stats_ptr const &stats)
     : boundary_ver_{vertical_upper_boundary_ptr}, boundary_pair_hor_{horizontal_boundary_pair},
       heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config}, splitting_cfg_{splitting_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, thread_pool_{thread_pool}, stats_{stats}
 {
 }
 
 void heston_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::CUDASolver>::operator()(
     container_2d<by_enum::Row> &prev_solution, container_2d<by_enum::Row> &next_solution, bool is_heat_sourse_set,
-    std::function<double(double, double, double)> const &heat_source)
+    std::function<double(double, double, double)> const &heat_source, time_slice_observer_2d_ptr const &observer)
 {
-    // get time range:
-    auto const &time = discretization_cfg_->time_range();
-    // time step:
-    const double k = discretization_cfg_->time_step();
     // size of spaces discretization:
     const auto &space_sizes = discretization_cfg_->number_of_space_points();
     const std::size_t space_size_x = std::get<0>(space_sizes);
     const std::size_t space_size_y = std::get<1>(space_sizes);
-    // last time index:
-    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
-    // save traverse_direction
-    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-    // create a Heston coefficient holder:
-    auto const heston_coeff_holder = std::make_shared<heston_implicit_coefficients>(
-        heat_data_cfg_, discretization_cfg_, splitting_cfg_, solver_cfg_->implicit_pde_scheme_value());
-    heat_splitting_method_ptr splitting_ptr;
-    auto solver_y = std::make_shared<cuda_solver<memory_space_enum::Device>>(space_size_x);
-    solver_y->set_factorization(solver_cfg_->tridiagonal_factorization());
-    auto solver_u = std::make_shared<cuda_solver<memory_space_enum::Device>>(space_size_y);
-    solver_u->set_factorization(solver_cfg_->tridiagonal_factorization());
-    // splitting method:
-    if (splitting_cfg_->splitting_method() == splitting_method_enum::DouglasRachford)
-    {
-        // create and set up the main solvers:
-        splitting_ptr = std::make_shared<heat_douglas_rachford_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                       grid_cfg_, is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::CraigSneyd)
-    {
-        splitting_ptr = std::make_shared<heat_craig_sneyd_method>(solver_y, solver_u, heston_coeff_holder, grid_cfg_,
-                                                                  is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::ModifiedCraigSneyd)
-    {
-        splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                           grid_cfg_, is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::HundsdorferVerwer)
-    {
-        splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                         grid_cfg_, is_heat_sourse_set);
-    }
-    else
-    {
-        throw std::exception("Unreachable");
-    }
-    // create and set up lower volatility boundary solver:
-    auto boundary_solver = std::make_shared<heston_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_);
+    // one pair of solvers per worker sweeping the lines:
+    const std::size_t number_of_threads = thread_pool_->size();
+    tridiagonal_solver_ptrs solvers_y;
+    tridiagonal_solver_ptrs solvers_u;
+    for (std::size_t t = 0; t < number_of_threads; ++t)
+    {
+        auto solver_y = std::make_shared<cuda_solver<memory_space_enum::Device>>(space_size_x);
+        solver_y->set_factorization(solver_cfg_->tridiagonal_factorization());
+        solvers_y.emplace_back(solver_y);
+        auto solver_u = std::make_shared<cuda_solver<memory_space_enum::Device>>(space_size_y);
+        solver_u->set_factorization(solver_cfg_->tridiagonal_factorization());
+        solvers_u.emplace_back(solver_u);
+    }
+    // splitting method and Rannacher start-up share the line solvers:
+    const heston_implicit_kernel_loop kernel_loop(solvers_y, solvers_u, heat_data_cfg_, discretization_cfg_,
+                                                  splitting_cfg_, solver_cfg_, grid_cfg_, is_heat_sourse_set,
+                                                  thread_pool_, stats_);
 
     if (is_heat_sourse_set)
     {
@@ -109,8 +155,7 @@ void heston_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_meth
     }
     else
     {
-        heston_implicit_time_loop::run(splitting_ptr, boundary_solver, boundary_pair_hor_, boundary_ver_, grid_cfg_,
-                                       time, last_time_idx, k, traverse_dir, prev_solution, next_solution);
+        kernel_loop.run(boundary_ver_, boundary_pair_hor_, prev_solution, next_solution, observer);
     }
 }
 
@@ -121,66 +166,40 @@ heston_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_en
                                     pde_discretization_config_2d_ptr const &discretization_config,
                                     splitting_method_config_ptr const &splitting_config,
                                     heat_implicit_solver_config_ptr const &solver_config,
-                                    grid_config_2d_ptr const &grid_config)
+                                    grid_config_2d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                    solver_stats_ptr const &stats)
     : boundary_ver_{vertical_upper_boundary_ptr}, boundary_pair_hor_{horizontal_boundary_pair},
       heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config}, splitting_cfg_{splitting_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, thread_pool_{thread_pool}, stats_{stats}
 {
 }
 
 void heston_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::SORSolver>::operator()(
     container_2d<by_enum::Row> &prev_solution, container_2d<by_enum::Row> &next_solution, bool is_heat_sourse_set,
-    std::function<double(double, double, double)> const &heat_source, double omega_value)
+    std::function<double(double, double, double)> const &heat_source, double omega_value,
+    time_slice_observer_2d_ptr const &observer)
 {
-    // get time range:
-    auto const &time = discretization_cfg_->time_range();
-    // time step:
-    const double k = discretization_cfg_->time_step();
     // size of spaces discretization:
     const auto &space_sizes = discretization_cfg_->number_of_space_points();
     const std::size_t space_size_x = std::get<0>(space_sizes);
     const std::size_t space_size_y = std::get<1>(space_sizes);
-    // last time index:
-    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
-    // save traverse_direction
-    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-
-    // create a Heston coefficient holder:
-    auto const heston_coeff_holder = std::make_shared<heston_implicit_coefficients>(
-        heat_data_cfg_, discretization_cfg_, splitting_cfg_, solver_cfg_->implicit_pde_scheme_value());
-    heat_splitting_method_ptr splitting_ptr;
-    auto solver_y = std::make_shared<sor_solver_cuda>(space_size_x);
-    solver_y->set_omega(omega_value);
-    auto solver_u = std::make_shared<sor_solver_cuda>(space_size_y);
-    solver_u->set_omega(omega_value);
-    // splitting method:
-    if (splitting_cfg_->splitting_method() == splitting_method_enum::DouglasRachford)
-    {
-        // create and set up the main solvers:
-        splitting_ptr = std::make_shared<heat_douglas_rachford_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                       grid_cfg_, is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::CraigSneyd)
-    {
-        splitting_ptr = std::make_shared<heat_craig_sneyd_method>(solver_y, solver_u, heston_coeff_holder, grid_cfg_,
-                                                                  is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::ModifiedCraigSneyd)
-    {
-        splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                           grid_cfg_, is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::HundsdorferVerwer)
-    {
-        splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                         grid_cfg_, is_heat_sourse_set);
-    }
-    else
-    {
-        throw std::exception("Unreachable");
-    }
-    // create and set up lower volatility boundary solver:
-    auto boundary_solver = std::make_shared<heston_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_);
+    // one pair of solvers per worker sweeping the lines:
+    const std::size_t number_of_threads = thread_pool_->size();
+    tridiagonal_solver_ptrs solvers_y;
+    tridiagonal_solver_ptrs solvers_u;
+    for (std::size_t t = 0; t < number_of_threads; ++t)
+    {
+        auto solver_y = std::make_shared<sor_solver_cuda>(space_size_x);
+        solver_y->set_omega(omega_value);
+        solvers_y.emplace_back(solver_y);
+        auto solver_u = std::make_shared<sor_solver_cuda>(space_size_y);
+        solver_u->set_omega(omega_value);
+        solvers_u.emplace_back(solver_u);
+    }
+    // splitting method and Rannacher start-up share the line solvers:
+    const heston_implicit_kernel_loop kernel_loop(solvers_y, solvers_u, heat_data_cfg_, discretization_cfg_,
+                                                  splitting_cfg_, solver_cfg_, grid_cfg_, is_heat_sourse_set,
+                                                  thread_pool_, stats_);
 
     if (is_heat_sourse_set)
     {
@@ -197,8 +216,7 @@ void heston_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_meth
     }
     else
     {
-        heston_implicit_time_loop::run(splitting_ptr, boundary_solver, boundary_pair_hor_, boundary_ver_, grid_cfg_,
-                                       time, last_time_idx, k, traverse_dir, prev_solution, next_solution);
+        kernel_loop.run(boundary_ver_, boundary_pair_hor_, prev_solution, next_solution, observer);
     }
 }
 
@@ -209,65 +227,39 @@ heston_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum
                                     pde_discretization_config_2d_ptr const &discretization_config,
                                     splitting_method_config_ptr const &splitting_config,
                                     heat_implicit_solver_config_ptr const &solver_config,
-                                    grid_config_2d_ptr const &grid_config)
+                                    grid_config_2d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                    solver_stats_ptr const &stats)
     : boundary_ver_{vertical_upper_boundary_ptr}, boundary_pair_hor_{horizontal_boundary_pair},
       heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config}, splitting_cfg_{splitting_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, thread_pool_{thread_pool}, stats_{stats}
 {
 }
 
 void heston_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::CUDASolver>::operator()(
     container_2d<by_enum::Row> &prev_solution, container_2d<by_enum::Row> &next_solution, bool is_heat_sourse_set,
-    std::function<double(double, double, double)> const &heat_source)
+    std::function<double(double, double, double)> const &heat_source, time_slice_observer_2d_ptr const &observer)
 {
-    // get time range:
-    auto const &time = discretization_cfg_->time_range();
-    // time step:
-    const double k = discretization_cfg_->time_step();
     // size of spaces discretization:
     const auto &space_sizes = discretization_cfg_->number_of_space_points();
     const std::size_t space_size_x = std::get<0>(space_sizes);
     const std::size_t space_size_y = std::get<1>(space_sizes);
-    // last time index:
-    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
-    // save traverse_direction
-    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-    // create a Heston coefficient holder:
-    auto const heston_coeff_holder = std::make_shared<heston_implicit_coefficients>(
-        heat_data_cfg_, discretization_cfg_, splitting_cfg_, solver_cfg_->implicit_pde_scheme_value());
-    heat_splitting_method_ptr splitting_ptr;
-    auto solver_y = std::make_shared<cuda_solver<memory_space_enum::Host>>(space_size_x);
-    solver_y->set_factorization(solver_cfg_->tridiagonal_factorization());
-    auto solver_u = std::make_shared<cuda_solver<memory_space_enum::Host>>(space_size_y);
-    solver_u->set_factorization(solver_cfg_->tridiagonal_factorization());
-    // splitting method:
-    if (splitting_cfg_->splitting_method() == splitting_method_enum::DouglasRachford)
-    {
-        // create and set up the main solvers:
-        splitting_ptr = std::make_shared<heat_douglas_rachford_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                       grid_cfg_, is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::CraigSneyd)
-    {
-        splitting_ptr = std::make_shared<heat_craig_sneyd_method>(solver_y, solver_u, heston_coeff_holder, grid_cfg_,
-                                                                  is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::ModifiedCraigSneyd)
-    {
-        splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                           grid_cfg_, is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::HundsdorferVerwer)
-    {
-        splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                         grid_cfg_, is_heat_sourse_set);
-    }
-    else
-    {
-        throw std::exception("Unreachable");
-    }
-    // create and set up lower volatility boundary solver:
-    auto boundary_solver = std::make_shared<heston_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_);
+    // one pair of solvers per worker sweeping the lines:
+    const std::size_t number_of_threads = thread_pool_->size();
+    tridiagonal_solver_ptrs solvers_y;
+    tridiagonal_solver_ptrs solvers_u;
+    for (std::size_t t = 0; t < number_of_threads; ++t)
+    {
+        auto solver_y = std::make_shared<cuda_solver<memory_space_enum::Host>>(space_size_x);
+        solver_y->set_factorization(solver_cfg_->tridiagonal_factorization());
+        solvers_y.emplace_back(solver_y);
+        auto solver_u = std::make_shared<cuda_solver<memory_space_enum::Host>>(space_size_y);
+        solver_u->set_factorization(solver_cfg_->tridiagonal_factorization());
+        solvers_u.emplace_back(solver_u);
+    }
+    // splitting method and Rannacher start-up share the line solvers:
+    const heston_implicit_kernel_loop kernel_loop(solvers_y, solvers_u, heat_data_cfg_, discretization_cfg_,
+                                                  splitting_cfg_, solver_cfg_, grid_cfg_, is_heat_sourse_set,
+                                                  thread_pool_, stats_);
 
     if (is_heat_sourse_set)
     {
@@ -284,8 +276,7 @@ void heston_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method
     }
     else
     {
-        heston_implicit_time_loop::run(splitting_ptr, boundary_solver, boundary_pair_hor_, boundary_ver_, grid_cfg_,
-                                       time, last_time_idx, k, traverse_dir, prev_solution, next_solution);
+        kernel_loop.run(boundary_ver_, boundary_pair_hor_, prev_solution, next_solution, observer);
     }
 }
 
@@ -296,65 +287,40 @@ heston_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum
                                     pde_discretization_config_2d_ptr const &discretization_config,
                                     splitting_method_config_ptr const &splitting_config,
                                     heat_implicit_solver_config_ptr const &solver_config,
-                                    grid_config_2d_ptr const &grid_config)
+                                    grid_config_2d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                    solver_stats_ptr const &stats)
     : boundary_ver_{vertical_upper_boundary_ptr}, boundary_pair_hor_{horizontal_boundary_pair},
       heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config}, splitting_cfg_{splitting_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, thread_pool_{thread_pool}, stats_{stats}
 {
 }
 
 void heston_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::SORSolver>::operator()(
     container_2d<by_enum::Row> &prev_solution, container_2d<by_enum::Row> &next_solution, bool is_heat_sourse_set,
-    std::function<double(double, double, double)> const &heat_source, double omega_value)
+    std::function<double(double, double, double)> const &heat_source, double omega_value,
+    time_slice_observer_2d_ptr const &observer)
 {
-    // get time range:
-    auto const &time = discretization_cfg_->time_range();
-    // time step:
-    const double k = discretization_cfg_->time_step();
     // size of spaces discretization:
     const auto &space_sizes = discretization_cfg_->number_of_space_points();
     const std::size_t space_size_x = std::get<0>(space_sizes);
     const std::size_t space_size_y = std::get<1>(space_sizes);
-    // last time index:
-    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
-    // save traverse_direction
-    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-    // create a Heston coefficient holder:
-    auto const heston_coeff_holder = std::make_shared<heston_implicit_coefficients>(
-        heat_data_cfg_, discretization_cfg_, splitting_cfg_, solver_cfg_->implicit_pde_scheme_value());
-    heat_splitting_method_ptr splitting_ptr;
-    auto solver_y = std::make_shared<sor_solver>(space_size_x);
-    solver_y->set_omega(omega_value);
-    auto solver_u = std::make_shared<sor_solver>(space_size_y);
-    solver_u->set_omega(omega_value);
-    // splitting method:
-    if (splitting_cfg_->splitting_method() == splitting_method_enum::DouglasRachford)
-    {
-        // create and set up the main solvers:
-        splitting_ptr = std::make_shared<heat_douglas_rachford_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                       grid_cfg_, is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::CraigSneyd)
-    {
-        splitting_ptr = std::make_shared<heat_craig_sneyd_method>(solver_y, solver_u, heston_coeff_holder, grid_cfg_,
-                                                                  is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::ModifiedCraigSneyd)
-    {
-        splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                           grid_cfg_, is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::HundsdorferVerwer)
-    {
-        splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                         grid_cfg_, is_heat_sourse_set);
-    }
-    else
-    {
-        throw std::exception("Unreachable");
-    }
-    // create and set up lower volatility boundary solver:
-    auto boundary_solver = std::make_shared<heston_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_);
+    // one pair of solvers per worker sweeping the lines:
+    const std::size_t number_of_threads = thread_pool_->size();
+    tridiagonal_solver_ptrs solvers_y;
+    tridiagonal_solver_ptrs solvers_u;
+    for (std::size_t t = 0; t < number_of_threads; ++t)
+    {
+        auto solver_y = std::make_shared<sor_solver>(space_size_x);
+        solver_y->set_omega(omega_value);
+        solvers_y.emplace_back(solver_y);
+        auto solver_u = std::make_shared<sor_solver>(space_size_y);
+        solver_u->set_omega(omega_value);
+        solvers_u.emplace_back(solver_u);
+    }
+    // splitting method and Rannacher start-up share the line solvers:
+    const heston_implicit_kernel_loop kernel_loop(solvers_y, solvers_u, heat_data_cfg_, discretization_cfg_,
+                                                  splitting_cfg_, solver_cfg_, grid_cfg_, is_heat_sourse_set,
+                                                  thread_pool_, stats_);
 
     if (is_heat_sourse_set)
     {
@@ -371,8 +337,7 @@ void heston_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method
     }
     else
     {
-        heston_implicit_time_loop::run(splitting_ptr, boundary_solver, boundary_pair_hor_, boundary_ver_, grid_cfg_,
-                                       time, last_time_idx, k, traverse_dir, prev_solution, next_solution);
+        kernel_loop.run(boundary_ver_, boundary_pair_hor_, prev_solution, next_solution, observer);
     }
 }
 
@@ -383,63 +348,37 @@ heston_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum
                                     pde_discretization_config_2d_ptr const &discretization_config,
                                     splitting_method_config_ptr const &splitting_config,
                                     heat_implicit_solver_config_ptr const &solver_config,
-                                    grid_config_2d_ptr const &grid_config)
+                                    grid_config_2d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                    solver_stats_ptr const &stats)
     : boundary_ver_{vertical_upper_boundary_ptr}, boundary_pair_hor_{horizontal_boundary_pair},
       heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config}, splitting_cfg_{splitting_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, thread_pool_{thread_pool}, stats_{stats}
 {
 }
 
 void heston_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::DoubleSweepSolver>::operator()(
     container_2d<by_enum::Row> &prev_solution, container_2d<by_enum::Row> &next_solution, bool is_heat_sourse_set,
-    std::function<double(double, double, double)> const &heat_source)
+    std::function<double(double, double, double)> const &heat_source, time_slice_observer_2d_ptr const &observer)
 {
-    // get time range:
-    auto const &time = discretization_cfg_->time_range();
-    // time step:
-    const double k = discretization_cfg_->time_step();
     // size of spaces discretization:
     const auto &space_sizes = discretization_cfg_->number_of_space_points();
     const std::size_t space_size_x = std::get<0>(space_sizes);
     const std::size_t space_size_y = std::get<1>(space_sizes);
-    // last time index:
-    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
-    // save traverse_direction
-    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-    // create a Heston coefficient holder:
-    auto const heston_coeff_holder = std::make_shared<heston_implicit_coefficients>(
-        heat_data_cfg_, discretization_cfg_, splitting_cfg_, solver_cfg_->implicit_pde_scheme_value());
-    heat_splitting_method_ptr splitting_ptr;
-    // create and set up the main solvers:
-    auto solver_y = std::make_shared<double_sweep_solver>(space_size_x);
-    auto solver_u = std::make_shared<double_sweep_solver>(space_size_y);
-    // splitting method:
-    if (splitting_cfg_->splitting_method() == splitting_method_enum::DouglasRachford)
-    {
-        splitting_ptr = std::make_shared<heat_douglas_rachford_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                       grid_cfg_, is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::CraigSneyd)
-    {
-        splitting_ptr = std::make_shared<heat_craig_sneyd_method>(solver_y, solver_u, heston_coeff_holder, grid_cfg_,
-                                                                  is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::ModifiedCraigSneyd)
-    {
-        splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                           grid_cfg_, is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::HundsdorferVerwer)
-    {
-        splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                         grid_cfg_, is_heat_sourse_set);
-    }
-    else
-    {
-        throw std::exception("Unreachable");
-    }
-    // create and set up lower volatility boundary solver:
-    auto boundary_solver = std::make_shared<heston_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_);
+    // one pair of solvers per worker sweeping the lines:
+    const std::size_t number_of_threads = thread_pool_->size();
+    tridiagonal_solver_ptrs solvers_y;
+    tridiagonal_solver_ptrs solvers_u;
+    for (std::size_t t = 0; t < number_of_threads; ++t)
+    {
+        auto solver_y = std::make_shared<double_sweep_solver>(space_size_x);
+        solvers_y.emplace_back(solver_y);
+        auto solver_u = std::make_shared<double_sweep_solver>(space_size_y);
+        solvers_u.emplace_back(solver_u);
+    }
+    // splitting method and Rannacher start-up share the line solvers:
+    const heston_implicit_kernel_loop kernel_loop(solvers_y, solvers_u, heat_data_cfg_, discretization_cfg_,
+                                                  splitting_cfg_, solver_cfg_, grid_cfg_, is_heat_sourse_set,
+                                                  thread_pool_, stats_);
 
     if (is_heat_sourse_set)
     {
@@ -456,8 +395,7 @@ void heston_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method
     }
     else
     {
-        heston_implicit_time_loop::run(splitting_ptr, boundary_solver, boundary_pair_hor_, boundary_ver_, grid_cfg_,
-                                       time, last_time_idx, k, traverse_dir, prev_solution, next_solution);
+        kernel_loop.run(boundary_ver_, boundary_pair_hor_, prev_solution, next_solution, observer);
     }
 }
 
@@ -468,63 +406,37 @@ heston_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum
                                     pde_discretization_config_2d_ptr const &discretization_config,
                                     splitting_method_config_ptr const &splitting_config,
                                     heat_implicit_solver_config_ptr const &solver_config,
-                                    grid_config_2d_ptr const &grid_config)
+                                    grid_config_2d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                    solver_stats_ptr const &stats)
     : boundary_ver_{vertical_upper_boundary_ptr}, boundary_pair_hor_{horizontal_boundary_pair},
       heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config}, splitting_cfg_{splitting_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, thread_pool_{thread_pool}, stats_{stats}
 {
 }
 
 void heston_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::ThomasLUSolver>::operator()(
     container_2d<by_enum::Row> &prev_solution, container_2d<by_enum::Row> &next_solution, bool is_heat_sourse_set,
-    std::function<double(double, double, double)> const &heat_source)
+    std::function<double(double, double, double)> const &heat_source, time_slice_observer_2d_ptr const &observer)
 {
-    // get time range:
-    auto const &time = discretization_cfg_->time_range();
-    // time step:
-    const double k = discretization_cfg_->time_step();
     // size of spaces discretization:
     const auto &space_sizes = discretization_cfg_->number_of_space_points();
     const std::size_t space_size_x = std::get<0>(space_sizes);
     const std::size_t space_size_y = std::get<1>(space_sizes);
-    // last time index:
-    const std::size_t last_time_idx = discretization_cfg_->number_of_time_points() - 1;
-    // save traverse_direction
-    const traverse_direction_enum traverse_dir = solver_cfg_->traverse_direction();
-    // create a Heston coefficient holder:
-    auto const heston_coeff_holder = std::make_shared<heston_implicit_coefficients>(
-        heat_data_cfg_, discretization_cfg_, splitting_cfg_, solver_cfg_->implicit_pde_scheme_value());
-    heat_splitting_method_ptr splitting_ptr;
-    // create and set up the main solvers:
-    auto solver_y = std::make_shared<thomas_lu_solver>(space_size_x);
-    auto solver_u = std::make_shared<thomas_lu_solver>(space_size_y);
-    // splitting method:
-    if (splitting_cfg_->splitting_method() == splitting_method_enum::DouglasRachford)
-    {
-        splitting_ptr = std::make_shared<heat_douglas_rachford_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                       grid_cfg_, is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::CraigSneyd)
-    {
-        splitting_ptr = std::make_shared<heat_craig_sneyd_method>(solver_y, solver_u, heston_coeff_holder, grid_cfg_,
-                                                                  is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::ModifiedCraigSneyd)
-    {
-        splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                           grid_cfg_, is_heat_sourse_set);
-    }
-    else if (splitting_cfg_->splitting_method() == splitting_method_enum::HundsdorferVerwer)
-    {
-        splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method>(solver_y, solver_u, heston_coeff_holder,
-                                                                         grid_cfg_, is_heat_sourse_set);
-    }
-    else
-    {
-        throw std::exception("Unreachable");
-    }
-    // create and set up lower volatility boundary solver:
-    auto boundary_solver = std::make_shared<heston_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_);
+    // one pair of solvers per worker sweeping the lines:
+    const std::size_t number_of_threads = thread_pool_->size();
+    tridiagonal_solver_ptrs solvers_y;
+    tridiagonal_solver_ptrs solvers_u;
+    for (std::size_t t = 0; t < number_of_threads; ++t)
+    {
+        auto solver_y = std::make_shared<thomas_lu_solver>(space_size_x);
+        solvers_y.emplace_back(solver_y);
+        auto solver_u = std::make_shared<thomas_lu_solver>(space_size_y);
+        solvers_u.emplace_back(solver_u);
+    }
+    // splitting method and Rannacher start-up share the line solvers:
+    const heston_implicit_kernel_loop kernel_loop(solvers_y, solvers_u, heat_data_cfg_, discretization_cfg_,
+                                                  splitting_cfg_, solver_cfg_, grid_cfg_, is_heat_sourse_set,
+                                                  thread_pool_, stats_);
 
     if (is_heat_sourse_set)
     {
@@ -541,8 +453,7 @@ void heston_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method
     }
     else
     {
-        heston_implicit_time_loop::run(splitting_ptr, boundary_solver, boundary_pair_hor_, boundary_ver_, grid_cfg_,
-                                       time, last_time_idx, k, traverse_dir, prev_solution, next_solution);
+        kernel_loop.run(boundary_ver_, boundary_pair_hor_, prev_solution, next_solution, observer);
     }
 }
 
@@ -5,6 +5,8 @@
 
 #include "../../../boundaries/lss_boundary.hpp"
 #include "../../../common/lss_enumerations.hpp"
+#include "../../../common/lss_solver_stats.hpp"
+#include "../../../common/lss_thread_pool.hpp"
 #include "../../../common/lss_utility.hpp"
 #include "../../../containers/lss_container_2d.hpp"
 #include "../../../containers/lss_container_3d.hpp"
@@ -14,7 +16,10 @@
 #include "../../lss_heat_solver_config.hpp"
 #include "../../lss_pde_discretization_config.hpp"
 #include "../../lss_splitting_method_config.hpp"
+#include "../../lss_time_slice_observer.hpp"
 #include "../../transformation/lss_heat_data_transform.hpp"
+#include "boundary_solver/lss_heston_explicit_boundary_solver.hpp"
+#include "splitting_method/lss_heat_splitting_method.hpp"
 
 namespace lss_pde_solvers
 {
@@ -28,7 +33,58 @@ using lss_enumerations::by_enum;
 using lss_enumerations::memory_space_enum;
 using lss_enumerations::tridiagonal_method_enum;
 using lss_grids::grid_config_2d_ptr;
+using lss_utility::solver_stats_ptr;
 using lss_utility::sptr_t;
+using lss_utility::thread_pool_ptr;
+
+/**
+    heston_implicit_kernel_loop object
+
+    Splitting method of the configuration and optional Rannacher start-up of Douglas
+    half-steps with theta = 1, both sweeping with the same line solvers, runs them in
+    the Heston time loop with the time arguments of the configuration.
+ */
+class heston_implicit_kernel_loop
+{
+
+  private:
+    heat_splitting_method_ptr splitting_ptr_;
+    heston_explicit_boundary_solver_ptr boundary_solver_;
+    heat_splitting_method_ptr startup_splitting_ptr_;
+    heston_explicit_boundary_solver_ptr startup_boundary_solver_;
+    pde_discretization_config_2d_ptr discretization_cfg_;
+    splitting_method_config_ptr splitting_cfg_;
+    heat_implicit_solver_config_ptr solver_cfg_;
+    grid_config_2d_ptr grid_cfg_;
+    solver_stats_ptr stats_;
+
+  public:
+    /**
+        @brief heston_implicit_kernel_loop object constructor
+        @param solvers_y - line solvers of the first direction, one per worker
+        @param solvers_u - line solvers of the second direction, one per worker
+        @param heat_data_config - heat data configuration
+        @param discretization_config - discretization configuration
+        @param splitting_config - splitting method configuration with Rannacher steps
+        @param solver_config - solver configuration
+        @param grid_config - grid configuration
+        @param is_heat_sourse_set - true when heat source is present
+        @param thread_pool - pool sweeping the lines
+        @param stats - statistics shared by both methods
+    **/
+    explicit heston_implicit_kernel_loop(tridiagonal_solver_ptrs const &solvers_y,
+                                         tridiagonal_solver_ptrs const &solvers_u,
+                                         heat_data_transform_2d_ptr const &heat_data_config,
+                                         pde_discretization_config_2d_ptr const &discretization_config,
+                                         splitting_method_config_ptr const &splitting_config,
+                                         heat_implicit_solver_config_ptr const &solver_config,
+                                         grid_config_2d_ptr const &grid_config, bool is_heat_sourse_set,
+                                         thread_pool_ptr const &thread_pool, solver_stats_ptr const &stats);
+
+    void run(boundary_2d_ptr const &vertical_upper_boundary_ptr, boundary_2d_pair const &horizontal_boundary_pair,
+             container_2d<by_enum::Row> &prev_solution, container_2d<by_enum::Row> &next_solution,
+             time_slice_observer_2d_ptr const &observer) const;
+};
 
 template <memory_space_enum memory_enum, tridiagonal_method_enum tridiagonal_method>
 class heston_equation_implicit_kernel
@@ -49,6 +105,8 @@ template <> class heston_equation_implicit_kernel<memory_space_enum::Device, tri
     splitting_method_config_ptr splitting_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_2d_ptr grid_cfg_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
   public:
     heston_equation_implicit_kernel(boundary_2d_ptr const &vertical_upper_boundary_ptr,
@@ -57,16 +115,12 @@ template <> class heston_equation_implicit_kernel<memory_space_enum::Device, tri
                                     pde_discretization_config_2d_ptr const &discretization_config,
                                     splitting_method_config_ptr const &splitting_config,
                                     heat_implicit_solver_config_ptr const &solver_config,
-                                    grid_config_2d_ptr const &grid_config);
+                                    grid_config_2d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                    solver_stats_ptr const &stats);
 
     void operator()(container_2d<by_enum::Row> &prev_solution, container_2d<by_enum::Row> &next_solution,
-                    bool is_heat_sourse_set, std::function<double(double, double, double)> const &heat_source);
-
-    // TODO: may be implemented
-    // void operator()(rcontainer_2d_t &prev_solution, rcontainer_2d_t &next_solution, bool is_heat_sourse_set,
-    //                std::function<fp_type(fp_type, fp_type, fp_type)> const &heat_source, rcontainer_3d_t &solutions)
-    //{
-    //}
+                    bool is_heat_sourse_set, std::function<double(double, double, double)> const &heat_source,
+                    time_slice_observer_2d_ptr const &observer = nullptr);
 };
 
 template <> class heston_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum::SORSolver>
@@ -80,6 +134,8 @@ template <> class heston_equation_implicit_kernel<memory_space_enum::Device, tri
     splitting_method_config_ptr splitting_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_2d_ptr grid_cfg_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
   public:
     heston_equation_implicit_kernel(boundary_2d_ptr const &vertical_upper_boundary_ptr,
@@ -88,18 +144,12 @@ template <> class heston_equation_implicit_kernel<memory_space_enum::Device, tri
                                     pde_discretization_config_2d_ptr const &discretization_config,
                                     splitting_method_config_ptr const &splitting_config,
                                     heat_implicit_solver_config_ptr const &solver_config,
-                                    grid_config_2d_ptr const &grid_config);
+                                    grid_config_2d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                    solver_stats_ptr const &stats);
 
     void operator()(container_2d<by_enum::Row> &prev_solution, container_2d<by_enum::Row> &next_solution,
                     bool is_heat_sourse_set, std::function<double(double, double, double)> const &heat_source,
-                    double omega_value);
-
-    // TODO: may be implemented
-    // void operator()(rcontainer_2d_t &prev_solution, rcontainer_2d_t &next_solution, bool is_heat_sourse_set,
-    //                 std::function<fp_type(fp_type, fp_type, fp_type)> const &heat_source, fp_type omega_value,
-    //                 rcontainer_3d_t &solutions)
-    //{
-    // }
+                    double omega_value, time_slice_observer_2d_ptr const &observer = nullptr);
 };
 
 // ===================================================================
@@ -116,6 +166,8 @@ template <> class heston_equation_implicit_kernel<memory_space_enum::Host, tridi
     splitting_method_config_ptr splitting_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_2d_ptr grid_cfg_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
   public:
     heston_equation_implicit_kernel(boundary_2d_ptr const &vertical_upper_boundary_ptr,
@@ -124,16 +176,12 @@ template <> class heston_equation_implicit_kernel<memory_space_enum::Host, tridi
                                     pde_discretization_config_2d_ptr const &discretization_config,
                                     splitting_method_config_ptr const &splitting_config,
                                     heat_implicit_solver_config_ptr const &solver_config,
-                                    grid_config_2d_ptr const &grid_config);
+                                    grid_config_2d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                    solver_stats_ptr const &stats);
 
     void operator()(container_2d<by_enum::Row> &prev_solution, container_2d<by_enum::Row> &next_solution,
-                    bool is_heat_sourse_set, std::function<double(double, double, double)> const &heat_source);
-
-    // TODO: may be implemented
-    // void operator()(rcontainer_2d_t &prev_solution, rcontainer_2d_t &next_solution, bool is_heat_sourse_set,
-    //                 std::function<fp_type(fp_type, fp_type)> const &heat_source, rcontainer_3d_t &solutions)
-    //{
-    // }
+                    bool is_heat_sourse_set, std::function<double(double, double, double)> const &heat_source,
+                    time_slice_observer_2d_ptr const &observer = nullptr);
 };
 
 template <> class heston_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::SORSolver>
@@ -146,6 +194,8 @@ template <> class heston_equation_implicit_kernel<memory_space_enum::Host, tridi
     splitting_method_config_ptr splitting_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_2d_ptr grid_cfg_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
   public:
     heston_equation_implicit_kernel(boundary_2d_ptr const &vertical_upper_boundary_ptr,
@@ -154,18 +204,12 @@ template <> class heston_equation_implicit_kernel<memory_space_enum::Host, tridi
                                     pde_discretization_config_2d_ptr const &discretization_config,
                                     splitting_method_config_ptr const &splitting_config,
                                     heat_implicit_solver_config_ptr const &solver_config,
-                                    grid_config_2d_ptr const &grid_config);
+                                    grid_config_2d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                    solver_stats_ptr const &stats);
 
     void operator()(container_2d<by_enum::Row> &prev_solution, container_2d<by_enum::Row> &next_solution,
                     bool is_heat_sourse_set, std::function<double(double, double, double)> const &heat_source,
-                    double omega_value);
-
-    // TODO: may be implemented
-    // void operator()(rcontainer_2d_t &prev_solution, rcontainer_2d_t &next_solution, bool is_heat_sourse_set,
-    //                 std::function<fp_type(fp_type, fp_type, fp_type)> const &heat_source, fp_type omega_value,
-    //                 rcontainer_3d_t &solutions)
-    //{
-    // }
+                    double omega_value, time_slice_observer_2d_ptr const &observer = nullptr);
 };
 
 template <> class heston_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::DoubleSweepSolver>
@@ -179,6 +223,8 @@ template <> class heston_equation_implicit_kernel<memory_space_enum::Host, tridi
     splitting_method_config_ptr splitting_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_2d_ptr grid_cfg_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
   public:
     heston_equation_implicit_kernel(boundary_2d_ptr const &vertical_upper_boundary_ptr,
@@ -187,16 +233,12 @@ template <> class heston_equation_implicit_kernel<memory_space_enum::Host, tridi
                                     pde_discretization_config_2d_ptr const &discretization_config,
                                     splitting_method_config_ptr const &splitting_config,
                                     heat_implicit_solver_config_ptr const &solver_config,
-                                    grid_config_2d_ptr const &grid_config);
+                                    grid_config_2d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                    solver_stats_ptr const &stats);
 
     void operator()(container_2d<by_enum::Row> &prev_solution, container_2d<by_enum::Row> &next_solution,
-                    bool is_heat_sourse_set, std::function<double(double, double, double)> const &heat_source);
-
-    // TODO: may be implemented
-    // void operator()(rcontainer_2d_t &prev_solution, rcontainer_2d_t &next_solution, bool is_heat_sourse_set,
-    //                 std::function<fp_type(fp_type, fp_type, fp_type)> const &heat_source, rcontainer_3d_t &solutions)
-    //{
-    // }
+                    bool is_heat_sourse_set, std::function<double(double, double, double)> const &heat_source,
+                    time_slice_observer_2d_ptr const &observer = nullptr);
 };
 
 template <> class heston_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::ThomasLUSolver>
@@ -210,6 +252,8 @@ template <> class heston_equation_implicit_kernel<memory_space_enum::Host, tridi
     splitting_method_config_ptr splitting_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_2d_ptr grid_cfg_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
   public:
     heston_equation_implicit_kernel(boundary_2d_ptr const &vertical_upper_boundary_ptr,
@@ -218,16 +262,12 @@ template <> class heston_equation_implicit_kernel<memory_space_enum::Host, tridi
                                     pde_discretization_config_2d_ptr const &discretization_config,
                                     splitting_method_config_ptr const &splitting_config,
                                     heat_implicit_solver_config_ptr const &solver_config,
-                                    grid_config_2d_ptr const &grid_config);
+                                    grid_config_2d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                    solver_stats_ptr const &stats);
 
     void operator()(container_2d<by_enum::Row> &prev_solution, container_2d<by_enum::Row> &next_solution,
-                    bool is_heat_sourse_set, std::function<double(double, double, double)> const &heat_source);
-
-    // TODO: may be implemented
-    // void operator()(rcontainer_2d_t &prev_solution, rcontainer_2d_t &next_solution, bool is_heat_sourse_set,
-    //                 std::function<fp_type(fp_type, fp_type, fp_type)> const &heat_source, rcontainer_3d_t &solutions)
-    //{
-    // }
+                    bool is_heat_sourse_set, std::function<double(double, double, double)> const &heat_source,
+                    time_slice_observer_2d_ptr const &observer = nullptr);
 };
 } // namespace two_dimensional
 
@@ -146,12 +146,10 @@ void explicit_heston_cuda_scheme::rhs(heston_euler_coefficients_ptr const &cfs,
                                       container_2d<by_enum::Row> &solution)
 {
     // light-weight object with cuda kernel computing the solution:
-    thrust::device_vector<double> d_input(input.data());
-    thrust::device_vector<double> d_solution(solution.data());
+    thrust::device_vector<double> d_input(input.raw_data(), input.raw_data() + input.total_size());
+    thrust::device_vector<double> d_solution(solution.raw_data(), solution.raw_data() + solution.total_size());
     kernel->launch(time, d_input, d_solution);
-    container_t tmp_solution(solution.data().size());
-    thrust::copy(d_solution.begin(), d_solution.end(), tmp_solution.begin());
-    solution.from_data(tmp_solution);
+    thrust::copy(d_solution.begin(), d_solution.end(), solution.raw_data());
 }
 
 void explicit_heston_cuda_scheme::rhs_source(heston_euler_coefficients_ptr const &cfs,
@@ -162,13 +160,12 @@ void explicit_heston_cuda_scheme::rhs_source(heston_euler_coefficients_ptr const
                                              container_2d<by_enum::Row> &solution)
 {
     // light-weight object with cuda kernel computing the solution:
-    thrust::device_vector<double> d_input(input.data());
-    thrust::device_vector<double> d_inhom_input(inhom_input.data());
-    thrust::device_vector<double> d_solution(solution.data());
+    thrust::device_vector<double> d_input(input.raw_data(), input.raw_data() + input.total_size());
+    thrust::device_vector<double> d_inhom_input(inhom_input.raw_data(),
+                                                inhom_input.raw_data() + inhom_input.total_size());
+    thrust::device_vector<double> d_solution(solution.raw_data(), solution.raw_data() + solution.total_size());
     kernel->launch(time, d_input, d_inhom_input, d_solution);
-    container_t tmp_solution(solution.data().size());
-    thrust::copy(d_solution.begin(), d_solution.end(), tmp_solution.begin());
-    solution.from_data(tmp_solution);
+    thrust::copy(d_solution.begin(), d_solution.end(), solution.raw_data());
 }
 
 void heston_euler_cuda_solver_method::initialize(bool is_heat_source_set)
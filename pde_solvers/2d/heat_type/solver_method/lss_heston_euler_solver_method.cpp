@@ -12,74 +12,115 @@ using d_2d = discretization_2d<std::vector, std::allocator<double>>;
 namespace two_dimensional
 {
 
-void explicit_heston_scheme::rhs(heston_euler_coefficients_ptr const &cfs, grid_config_2d_ptr const &grid_config,
-                                 container_2d<by_enum::Row> const &input, double const &time,
-                                 container_2d<by_enum::Row> &solution)
+explicit_heston_scheme::explicit_heston_scheme(heston_euler_coefficients_ptr const &cfs,
+                                               grid_config_2d_ptr const &grid_config,
+                                               thread_pool_ptr const &thread_pool)
+    : cfs_{cfs}, grid_cfg_{grid_config}, thread_pool_{thread_pool}, is_weights_set_{false}
+{
+    const std::size_t size = cfs_->space_size_x_ * cfs_->space_size_y_;
+    m_.resize(size);
+    m_tilde_.resize(size);
+    p_.resize(size);
+    p_tilde_.resize(size);
+    c_.resize(size);
+    centre_.resize(size);
+}
+
+explicit_heston_scheme::~explicit_heston_scheme()
+{
+}
+
+void explicit_heston_scheme::update_weights(double time)
 {
+    if (is_weights_set_ && cfs_->is_time_homogeneous_)
+        return;
+
     auto const one = 1.0;
-    auto const &M = cfs->M_;
-    auto const &M_tilde = cfs->M_tilde_;
-    auto const &P = cfs->P_;
-    auto const &P_tilde = cfs->P_tilde_;
-    auto const &Z = cfs->Z_;
-    auto const &W = cfs->W_;
-    auto const &C = cfs->C_;
-    auto const rows = input.rows() - 1;
-    auto const cols = input.columns() - 1;
-
-    double x{}, y{}, val{};
-    for (std::size_t r = 1; r < rows; ++r)
-    {
-        x = grid_2d::value_1(grid_config, r);
-        for (std::size_t c = 1; c < cols; ++c)
+    auto const &M = cfs_->M_;
+    auto const &M_tilde = cfs_->M_tilde_;
+    auto const &P = cfs_->P_;
+    auto const &P_tilde = cfs_->P_tilde_;
+    auto const &Z = cfs_->Z_;
+    auto const &W = cfs_->W_;
+    auto const &C = cfs_->C_;
+    auto const cols = cfs_->space_size_y_;
+
+    thread_pool_->parallel_for(1, cfs_->space_size_x_ - 1, [&](std::size_t worker_idx, std::size_t r) {
+        const double x = grid_2d::value_1(grid_cfg_, r);
+        double y{};
+        std::size_t idx{};
+        for (std::size_t c = 1; c < cols - 1; ++c)
         {
-            y = grid_2d::value_2(grid_config, c);
-            val = C(time, x, y) * input(r - 1, c - 1) + M(time, x, y) * input(r - 1, c) -
-                  C(time, x, y) * input(r - 1, c + 1) + M_tilde(time, x, y) * input(r, c - 1) +
-                  (one - Z(time, x, y) - W(time, x, y)) * input(r, c) + P_tilde(time, x, y) * input(r, c + 1) -
-                  C(time, x, y) * input(r + 1, c - 1) + P(time, x, y) * input(r + 1, c) +
-                  C(time, x, y) * input(r + 1, c + 1);
-            solution(r, c, val);
+            y = grid_2d::value_2(grid_cfg_, c);
+            idx = r * cols + c;
+            m_[idx] = M(time, x, y);
+            m_tilde_[idx] = M_tilde(time, x, y);
+            p_[idx] = P(time, x, y);
+            p_tilde_[idx] = P_tilde(time, x, y);
+            c_[idx] = C(time, x, y);
+            centre_[idx] = one - Z(time, x, y) - W(time, x, y);
         }
-    }
+    });
+    is_weights_set_ = true;
 }
 
-void explicit_heston_scheme::rhs_source(heston_euler_coefficients_ptr const &cfs, grid_config_2d_ptr const &grid_config,
-                                        container_2d<by_enum::Row> const &input, double const &time,
-                                        container_2d<by_enum::Row> const &inhom_input,
-                                        container_2d<by_enum::Row> &solution)
+void explicit_heston_scheme::sweep(container_2d<by_enum::Row> const &input,
+                                   container_2d<by_enum::Row> const *inhom_input,
+                                   container_2d<by_enum::Row> &solution) const
 {
-    auto const one = 1.0;
-    auto const &M = cfs->M_;
-    auto const &M_tilde = cfs->M_tilde_;
-    auto const &P = cfs->P_;
-    auto const &P_tilde = cfs->P_tilde_;
-    auto const &Z = cfs->Z_;
-    auto const &W = cfs->W_;
-    auto const &C = cfs->C_;
-    auto const rho = cfs->rho_;
-    auto const rows = input.rows() - 1; // without boundary
-    auto const cols = input.columns() - 1;
-
-    double x{}, y{}, val{};
-    for (std::size_t r = 1; r < rows; ++r)
-    {
-        x = grid_2d::value_1(grid_config, r);
-        for (std::size_t c = 1; c < cols; ++c)
+    auto const rho = cfs_->rho_;
+    auto const cols = input.columns();
+    double const *in = input.raw_data();
+    double const *inhom = (inhom_input != nullptr) ? inhom_input->raw_data() : nullptr;
+    double *out = solution.raw_data();
+
+    thread_pool_->parallel_for(1, input.rows() - 1, [&](std::size_t worker_idx, std::size_t r) {
+        // rows above, at and below r, all weights and outputs are contiguous in c:
+        double const *up = in + (r - 1) * cols;
+        double const *mid = in + r * cols;
+        double const *down = in + (r + 1) * cols;
+        double const *m = m_.data() + r * cols;
+        double const *m_tilde = m_tilde_.data() + r * cols;
+        double const *p = p_.data() + r * cols;
+        double const *p_tilde = p_tilde_.data() + r * cols;
+        double const *cc = c_.data() + r * cols;
+        double const *centre = centre_.data() + r * cols;
+        double *sol = out + r * cols;
+        for (std::size_t c = 1; c < cols - 1; ++c)
         {
-            y = grid_2d::value_2(grid_config, c);
-            val = C(time, x, y) * input(r - 1, c - 1) + M(time, x, y) * input(r - 1, c) -
-                  C(time, x, y) * input(r - 1, c + 1) + M_tilde(time, x, y) * input(r, c - 1) +
-                  (one - Z(time, x, y) - W(time, x, y)) * input(r, c) + P_tilde(time, x, y) * input(r, c + 1) -
-                  C(time, x, y) * input(r + 1, c - 1) + P(time, x, y) * input(r + 1, c) +
-                  C(time, x, y) * input(r + 1, c + 1) + rho * inhom_input(r, c);
-            solution(r, c, val);
+            sol[c] = cc[c] * up[c - 1] + m[c] * up[c] - cc[c] * up[c + 1] + m_tilde[c] * mid[c - 1] +
+                     centre[c] * mid[c] + p_tilde[c] * mid[c + 1] - cc[c] * down[c - 1] + p[c] * down[c] +
+                     cc[c] * down[c + 1];
         }
-    }
+        if (inhom != nullptr)
+        {
+            double const *src = inhom + r * cols;
+            for (std::size_t c = 1; c < cols - 1; ++c)
+            {
+                sol[c] += rho * src[c];
+            }
+        }
+    });
+}
+
+void explicit_heston_scheme::rhs(container_2d<by_enum::Row> const &input, double const &time,
+                                 container_2d<by_enum::Row> &solution)
+{
+    update_weights(time);
+    sweep(input, nullptr, solution);
+}
+
+void explicit_heston_scheme::rhs_source(container_2d<by_enum::Row> const &input, double const &time,
+                                        container_2d<by_enum::Row> const &inhom_input,
+                                        container_2d<by_enum::Row> &solution)
+{
+    update_weights(time);
+    sweep(input, &inhom_input, solution);
 }
 
-void heston_euler_solver_method::initialize(bool is_heat_source_set)
+void heston_euler_solver_method::initialize(bool is_heat_source_set, thread_pool_ptr const &thread_pool)
 {
+    scheme_ = std::make_shared<explicit_heston_scheme>(coefficients_, grid_cfg_, thread_pool);
     if (is_heat_source_set)
     {
         source_ =
@@ -88,10 +129,12 @@ void heston_euler_solver_method::initialize(bool is_heat_source_set)
 }
 
 heston_euler_solver_method::heston_euler_solver_method(heston_euler_coefficients_ptr const &coefficients,
-                                                       grid_config_2d_ptr const &grid_config, bool is_heat_source_set)
+                                                       grid_config_2d_ptr const &grid_config, bool is_heat_source_set,
+                                                       thread_pool_ptr const &thread_pool)
     : coefficients_{coefficients}, heston_explicit_solver_method(grid_config)
 {
-    initialize(is_heat_source_set);
+    LSS_VERIFY(thread_pool, "thread_pool must not be null");
+    initialize(is_heat_source_set, thread_pool);
 }
 
 heston_euler_solver_method::~heston_euler_solver_method()
@@ -101,7 +144,7 @@ heston_euler_solver_method::~heston_euler_solver_method()
 void heston_euler_solver_method::solve(container_2d<by_enum::Row> &prev_solution, double const &time,
                                        container_2d<by_enum::Row> &solution)
 {
-    explicit_heston_scheme::rhs(coefficients_, grid_cfg_, prev_solution, time, solution);
+    scheme_->rhs(prev_solution, time, solution);
 }
 
 void heston_euler_solver_method::solve(container_2d<by_enum::Row> &prev_solution, double const &time,
@@ -109,7 +152,7 @@ void heston_euler_solver_method::solve(container_2d<by_enum::Row> &prev_solution
                                        container_2d<by_enum::Row> &solution)
 {
     d_2d::of_function(grid_cfg_, time, heat_source, *source_);
-    explicit_heston_scheme::rhs_source(coefficients_, grid_cfg_, prev_solution, time, *source_, solution);
+    scheme_->rhs_source(prev_solution, time, *source_, solution);
 }
 
 } // namespace two_dimensional
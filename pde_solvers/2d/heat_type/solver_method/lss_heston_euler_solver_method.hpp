@@ -2,6 +2,8 @@
 #define _LSS_HESTON_EULER_SOLVER_METHOD_HPP_
 
 #include "../../../../common/lss_enumerations.hpp"
+#include "../../../../common/lss_thread_pool.hpp"
+#include "../../../../containers/lss_aligned_allocator.hpp"
 #include "../../../../containers/lss_container_2d.hpp"
 #include "../../../../discretization/lss_grid_config.hpp"
 #include "../../../lss_pde_discretization_config.hpp"
@@ -11,22 +13,48 @@
 namespace lss_pde_solvers
 {
 
+using lss_containers::aligned_container_t;
 using lss_containers::container_2d;
 using lss_grids::grid_config_2d_ptr;
+using lss_utility::thread_pool_ptr;
 
 namespace two_dimensional
 {
 
+/**
+    explicit_heston_scheme object
+
+    Keeps the weights of the 9-point Euler stencil in row-major arrays over the
+    whole grid and sweeps the inner rows on a thread pool. Weights of
+    time-homogeneous data are evaluated only once.
+ */
 class explicit_heston_scheme
 {
+  private:
+    heston_euler_coefficients_ptr cfs_;
+    grid_config_2d_ptr grid_cfg_;
+    thread_pool_ptr thread_pool_;
+    // stencil weights, C is shared by all four corners:
+    aligned_container_t m_, m_tilde_, p_, p_tilde_, c_, centre_;
+    bool is_weights_set_;
+
+    explicit explicit_heston_scheme() = delete;
+
+    void update_weights(double time);
+
+    void sweep(container_2d<by_enum::Row> const &input, container_2d<by_enum::Row> const *inhom_input,
+               container_2d<by_enum::Row> &solution) const;
 
   public:
-    static void rhs(heston_euler_coefficients_ptr const &cfs, grid_config_2d_ptr const &grid_config,
-                    container_2d<by_enum::Row> const &input, double const &time, container_2d<by_enum::Row> &solution);
+    explicit explicit_heston_scheme(heston_euler_coefficients_ptr const &cfs, grid_config_2d_ptr const &grid_config,
+                                    thread_pool_ptr const &thread_pool);
+
+    ~explicit_heston_scheme();
+
+    void rhs(container_2d<by_enum::Row> const &input, double const &time, container_2d<by_enum::Row> &solution);
 
-    static void rhs_source(heston_euler_coefficients_ptr const &cfs, grid_config_2d_ptr const &grid_config,
-                           container_2d<by_enum::Row> const &input, double const &time,
-                           container_2d<by_enum::Row> const &inhom_input, container_2d<by_enum::Row> &solution);
+    void rhs_source(container_2d<by_enum::Row> const &input, double const &time,
+                    container_2d<by_enum::Row> const &inhom_input, container_2d<by_enum::Row> &solution);
 };
 
 /**
@@ -40,14 +68,16 @@ class heston_euler_solver_method : public heston_explicit_solver_method
     // scheme coefficients:
     heston_euler_coefficients_ptr coefficients_;
     sptr_t<container_2d<by_enum::Row>> source_;
+    sptr_t<explicit_heston_scheme> scheme_;
 
     explicit heston_euler_solver_method() = delete;
 
-    void initialize(bool is_heat_source_set);
+    void initialize(bool is_heat_source_set, thread_pool_ptr const &thread_pool);
 
   public:
     explicit heston_euler_solver_method(heston_euler_coefficients_ptr const &coefficients,
-                                        grid_config_2d_ptr const &grid_config, bool is_heat_source_set);
+                                        grid_config_2d_ptr const &grid_config, bool is_heat_source_set,
+                                        thread_pool_ptr const &thread_pool);
 
     ~heston_euler_solver_method();
 
@@ -15,16 +15,9 @@ namespace two_dimensional
 void implicit_heston_scheme_cs::rhs_intermed_1(heston_implicit_coefficients_ptr const &cfs,
                                                grid_config_2d_ptr const &grid_cfg, std::size_t const &y_index,
                                                double const &y, container_2d<by_enum::Row> const &input,
-                                               double const &time, container_t &solution)
+                                               double const &time, strided_span<double> const &solution)
 {
     auto const one = 1.0;
-    auto const &M = cfs->M_;
-    auto const &M_tilde = cfs->M_tilde_;
-    auto const &P = cfs->P_;
-    auto const &P_tilde = cfs->P_tilde_;
-    auto const &Z = cfs->Z_;
-    auto const &W = cfs->W_;
-    auto const &C = cfs->C_;
 
     auto const gamma = cfs->gamma_;
     auto const theta = cfs->theta_;
@@ -34,14 +27,18 @@ void implicit_heston_scheme_cs::rhs_intermed_1(heston_implicit_coefficients_ptr
     for (std::size_t t = 1; t < N; ++t)
     {
         x = grid_2d::value_1(grid_cfg, t);
-        solution[t] =
-            (gamma * C(time, x, y) * input(t - 1, y_index - 1)) +
-            ((one - theta) * M(time, x, y) * input(t - 1, y_index)) -
-            (gamma * C(time, x, y) * input(t - 1, y_index + 1)) + (M_tilde(time, x, y) * input(t, y_index - 1)) +
-            ((one - W(time, x, y) - (one - theta) * Z(time, x, y)) * input(t, y_index)) +
-            (P_tilde(time, x, y) * input(t, y_index + 1)) - (gamma * C(time, x, y) * input(t + 1, y_index - 1)) +
-            ((one - theta) * P(time, x, y) * input(t + 1, y_index)) +
-            (gamma * C(time, x, y) * input(t + 1, y_index + 1));
+        const double m_xy = cfs->M(time, x, y, t, y_index);
+        const double m_tilde_xy = cfs->M_tilde(time, x, y, t, y_index);
+        const double p_xy = cfs->P(time, x, y, t, y_index);
+        const double p_tilde_xy = cfs->P_tilde(time, x, y, t, y_index);
+        const double z_xy = cfs->Z(time, x, y, t, y_index);
+        const double w_xy = cfs->W(time, x, y, t, y_index);
+        const double c_xy = cfs->C(time, x, y, t, y_index);
+        solution[t] = (gamma * c_xy * input(t - 1, y_index - 1)) + ((one - theta) * m_xy * input(t - 1, y_index)) -
+                      (gamma * c_xy * input(t - 1, y_index + 1)) + (m_tilde_xy * input(t, y_index - 1)) +
+                      ((one - w_xy - (one - theta) * z_xy) * input(t, y_index)) + (p_tilde_xy * input(t, y_index + 1)) -
+                      (gamma * c_xy * input(t + 1, y_index - 1)) + ((one - theta) * p_xy * input(t + 1, y_index)) +
+                      (gamma * c_xy * input(t + 1, y_index + 1));
     }
 }
 
@@ -50,16 +47,9 @@ void implicit_heston_scheme_cs::rhs_intermed_1_source(heston_implicit_coefficien
                                                       double const &y, container_2d<by_enum::Row> const &input,
                                                       container_2d<by_enum::Row> const &inhom_input,
                                                       container_2d<by_enum::Row> const &inhom_input_next,
-                                                      double const &time, container_t &solution)
+                                                      double const &time, strided_span<double> const &solution)
 {
     auto const one = 1.0;
-    auto const &M = cfs->M_;
-    auto const &M_tilde = cfs->M_tilde_;
-    auto const &P = cfs->P_;
-    auto const &P_tilde = cfs->P_tilde_;
-    auto const &Z = cfs->Z_;
-    auto const &W = cfs->W_;
-    auto const &C = cfs->C_;
 
     auto const gamma = cfs->gamma_;
     auto const theta = cfs->theta_;
@@ -70,15 +60,19 @@ void implicit_heston_scheme_cs::rhs_intermed_1_source(heston_implicit_coefficien
     for (std::size_t t = 1; t < N; ++t)
     {
         x = grid_2d::value_1(grid_cfg, t);
-        solution[t] =
-            (gamma * C(time, x, y) * input(t - 1, y_index - 1)) +
-            ((one - theta) * M(time, x, y) * input(t - 1, y_index)) -
-            (gamma * C(time, x, y) * input(t - 1, y_index + 1)) + (M_tilde(time, x, y) * input(t, y_index - 1)) +
-            ((one - W(time, x, y) - (one - theta) * Z(time, x, y)) * input(t, y_index)) +
-            (P_tilde(time, x, y) * input(t, y_index + 1)) - (gamma * C(time, x, y) * input(t + 1, y_index - 1)) +
-            ((one - theta) * P(time, x, y) * input(t + 1, y_index)) +
-            (gamma * C(time, x, y) * input(t + 1, y_index + 1)) + (theta * rho * inhom_input_next(t, y_index)) +
-            ((one - theta) * rho * inhom_input(t, y_index));
+        const double m_xy = cfs->M(time, x, y, t, y_index);
+        const double m_tilde_xy = cfs->M_tilde(time, x, y, t, y_index);
+        const double p_xy = cfs->P(time, x, y, t, y_index);
+        const double p_tilde_xy = cfs->P_tilde(time, x, y, t, y_index);
+        const double z_xy = cfs->Z(time, x, y, t, y_index);
+        const double w_xy = cfs->W(time, x, y, t, y_index);
+        const double c_xy = cfs->C(time, x, y, t, y_index);
+        solution[t] = (gamma * c_xy * input(t - 1, y_index - 1)) + ((one - theta) * m_xy * input(t - 1, y_index)) -
+                      (gamma * c_xy * input(t - 1, y_index + 1)) + (m_tilde_xy * input(t, y_index - 1)) +
+                      ((one - w_xy - (one - theta) * z_xy) * input(t, y_index)) + (p_tilde_xy * input(t, y_index + 1)) -
+                      (gamma * c_xy * input(t + 1, y_index - 1)) + ((one - theta) * p_xy * input(t + 1, y_index)) +
+                      (gamma * c_xy * input(t + 1, y_index + 1)) + (theta * rho * inhom_input_next(t, y_index)) +
+                      ((one - theta) * rho * inhom_input(t, y_index));
     }
 }
 
@@ -86,12 +80,8 @@ void implicit_heston_scheme_cs::rhs_intermed_2(heston_implicit_coefficients_ptr
                                                grid_config_2d_ptr const &grid_cfg, std::size_t const &x_index,
                                                double const &x, container_2d<by_enum::Row> const &input,
                                                container_2d<by_enum::Row> const &inhom_input, double const &time,
-                                               container_t &solution)
+                                               strided_span<double> const &solution)
 {
-    auto const &M_tilde = cfs->M_tilde_;
-    auto const &P_tilde = cfs->P_tilde_;
-    auto const &W = cfs->W_;
-
     auto const theta = cfs->theta_;
 
     const std::size_t N = solution.size() - 1;
@@ -99,9 +89,11 @@ void implicit_heston_scheme_cs::rhs_intermed_2(heston_implicit_coefficients_ptr
     for (std::size_t t = 1; t < N; ++t)
     {
         y = grid_2d::value_2(grid_cfg, t);
-        solution[t] = (-theta * M_tilde(time, x, y) * input(x_index, t - 1)) +
-                      (theta * W(time, x, y) * input(x_index, t)) -
-                      (theta * P_tilde(time, x, y) * input(x_index, t + 1)) + inhom_input(x_index, t);
+        const double m_tilde_xy = cfs->M_tilde(time, x, y, x_index, t);
+        const double p_tilde_xy = cfs->P_tilde(time, x, y, x_index, t);
+        const double w_xy = cfs->W(time, x, y, x_index, t);
+        solution[t] = (-theta * m_tilde_xy * input(x_index, t - 1)) + (theta * w_xy * input(x_index, t)) -
+                      (theta * p_tilde_xy * input(x_index, t + 1)) + inhom_input(x_index, t);
     }
 }
 
@@ -110,13 +102,8 @@ void implicit_heston_scheme_cs::rhs_intermed_3(heston_implicit_coefficients_ptr
                                                double const &y, container_2d<by_enum::Row> const &input,
                                                container_2d<by_enum::Row> const &inhom_input,
                                                container_2d<by_enum::Row> const &inhom_input_next, double const &time,
-                                               container_t &solution)
+                                               strided_span<double> const &solution)
 {
-    auto const &M = cfs->M_;
-    auto const &P = cfs->P_;
-    auto const &Z = cfs->Z_;
-    auto const &C = cfs->C_;
-
     auto const gamma = cfs->gamma_;
     auto const theta = cfs->theta_;
     auto const zeta = cfs->zeta_;
@@ -126,9 +113,13 @@ void implicit_heston_scheme_cs::rhs_intermed_3(heston_implicit_coefficients_ptr
     for (std::size_t t = 1; t < N; ++t)
     {
         x = grid_2d::value_1(grid_cfg, t);
-        solution[t] = (-theta * M(time, x, y) * input(t - 1, y_index)) + (theta * Z(time, x, y) * input(t, y_index)) -
-                      (theta * P(time, x, y) * input(t + 1, y_index)) + (inhom_input(t, y_index)) +
-                      (zeta * gamma * C(time, x, y) *
+        const double m_xy = cfs->M(time, x, y, t, y_index);
+        const double p_xy = cfs->P(time, x, y, t, y_index);
+        const double z_xy = cfs->Z(time, x, y, t, y_index);
+        const double c_xy = cfs->C(time, x, y, t, y_index);
+        solution[t] = (-theta * m_xy * input(t - 1, y_index)) + (theta * z_xy * input(t, y_index)) -
+                      (theta * p_xy * input(t + 1, y_index)) + (inhom_input(t, y_index)) +
+                      (zeta * gamma * c_xy *
                        ((inhom_input_next(t + 1, y_index + 1) - input(t + 1, y_index + 1)) -
                         (inhom_input_next(t + 1, y_index - 1) - input(t + 1, y_index - 1)) -
                         (inhom_input_next(t - 1, y_index + 1) - input(t - 1, y_index + 1)) +
@@ -140,12 +131,8 @@ void implicit_heston_scheme_cs::rhs_final(heston_implicit_coefficients_ptr const
                                           grid_config_2d_ptr const &grid_cfg, std::size_t const &x_index,
                                           double const &x, container_2d<by_enum::Row> const &input,
                                           container_2d<by_enum::Row> const &inhom_input, double const &time,
-                                          container_t &solution)
+                                          strided_span<double> const &solution)
 {
-    auto const &M_tilde = cfs->M_tilde_;
-    auto const &P_tilde = cfs->P_tilde_;
-    auto const &W = cfs->W_;
-
     auto const theta = cfs->theta_;
 
     const std::size_t N = solution.size() - 1;
@@ -153,9 +140,11 @@ void implicit_heston_scheme_cs::rhs_final(heston_implicit_coefficients_ptr const
     for (std::size_t t = 1; t < N; ++t)
     {
         y = grid_2d::value_2(grid_cfg, t);
-        solution[t] = (-theta * M_tilde(time, x, y) * input(x_index, t - 1)) +
-                      (theta * W(time, x, y) * input(x_index, t)) -
-                      (theta * P_tilde(time, x, y) * input(x_index, t + 1)) + inhom_input(x_index, t);
+        const double m_tilde_xy = cfs->M_tilde(time, x, y, x_index, t);
+        const double p_tilde_xy = cfs->P_tilde(time, x, y, x_index, t);
+        const double w_xy = cfs->W(time, x, y, x_index, t);
+        solution[t] = (-theta * m_tilde_xy * input(x_index, t - 1)) + (theta * w_xy * input(x_index, t)) -
+                      (theta * p_tilde_xy * input(x_index, t + 1)) + inhom_input(x_index, t);
     }
 }
 
@@ -163,38 +152,55 @@ void heat_craig_sneyd_method::initialize(bool is_heat_source_set)
 {
 }
 
-void heat_craig_sneyd_method::split_0(double const &y, double const &time, container_t &low, container_t &diag,
-                                      container_t &high)
+void heat_craig_sneyd_method::split_0(std::size_t const &y_index, double const &y, double const &time,
+                                      strided_span<double> const &low, strided_span<double> const &diag,
+                                      strided_span<double> const &high)
 {
+    LSS_STATS_PHASE(stats_, solver_phase_enum::Coefficients);
     double x{};
     for (std::size_t t = 0; t < low.size(); ++t)
     {
         x = grid_2d::value_1(grid_cfg_, t);
-        low[t] = (-coefficients_->theta_ * coefficients_->M_(time, x, y));
-        diag[t] = (cone_ + coefficients_->theta_ * coefficients_->Z_(time, x, y));
-        high[t] = (-coefficients_->theta_ * coefficients_->P_(time, x, y));
+        low[t] = (-coefficients_->theta_ * coefficients_->M(time, x, y, t, y_index));
+        diag[t] = (cone_ + coefficients_->theta_ * coefficients_->Z(time, x, y, t, y_index));
+        high[t] = (-coefficients_->theta_ * coefficients_->P(time, x, y, t, y_index));
     }
 }
 
-void heat_craig_sneyd_method::split_1(double const &x, double const &time, container_t &low, container_t &diag,
-                                      container_t &high)
+void heat_craig_sneyd_method::split_1(std::size_t const &x_index, double const &x, double const &time,
+                                      strided_span<double> const &low, strided_span<double> const &diag,
+                                      strided_span<double> const &high)
 {
+    LSS_STATS_PHASE(stats_, solver_phase_enum::Coefficients);
     double y{};
     for (std::size_t t = 0; t < low.size(); ++t)
     {
         y = grid_2d::value_2(grid_cfg_, t);
-        low[t] = (-coefficients_->theta_ * coefficients_->M_tilde_(time, x, y));
-        diag[t] = (cone_ + coefficients_->theta_ * coefficients_->W_(time, x, y));
-        high[t] = (-coefficients_->theta_ * coefficients_->P_tilde_(time, x, y));
+        low[t] = (-coefficients_->theta_ * coefficients_->M_tilde(time, x, y, x_index, t));
+        diag[t] = (cone_ + coefficients_->theta_ * coefficients_->W(time, x, y, x_index, t));
+        high[t] = (-coefficients_->theta_ * coefficients_->P_tilde(time, x, y, x_index, t));
     }
 }
 
-heat_craig_sneyd_method::heat_craig_sneyd_method(lss_tridiagonal_solver::tridiagonal_solver_ptr const &solvery_ptr,
-                                                 lss_tridiagonal_solver::tridiagonal_solver_ptr const &solveru_ptr,
+heat_craig_sneyd_method::heat_craig_sneyd_method(tridiagonal_solver_ptrs const &solvery_ptrs,
+                                                 tridiagonal_solver_ptrs const &solveru_ptrs,
                                                  heston_implicit_coefficients_ptr const &coefficients,
-                                                 grid_config_2d_ptr const grid_config, bool is_heat_source_set)
-    : solvery_ptr_{solvery_ptr}, solveru_ptr_{solveru_ptr}, coefficients_{coefficients}, grid_cfg_{grid_config}
+                                                 grid_config_2d_ptr const grid_config, bool is_heat_source_set,
+                                                 thread_pool_ptr const &thread_pool, solver_stats_ptr const &stats)
+    : heat_splitting_method(stats), coefficients_{coefficients}, grid_cfg_{grid_config},
+      workspace_y_{heat_splitting_workspace::create(solvery_ptrs, coefficients->space_size_x_, stats)},
+      workspace_u_{heat_splitting_workspace::create(solveru_ptrs, coefficients->space_size_y_, stats)},
+      thread_pool_{thread_pool},
+      inter_solution_1_(coefficients->space_size_x_, coefficients->space_size_y_, double{}),
+      inter_solution_1_r_(coefficients->space_size_x_, coefficients->space_size_y_, double{}),
+      inter_solution_2_(coefficients->space_size_x_, coefficients->space_size_y_, double{}),
+      inter_solution_3_(coefficients->space_size_x_, coefficients->space_size_y_, double{}),
+      inter_solution_3_r_(coefficients->space_size_x_, coefficients->space_size_y_, double{})
 {
+    LSS_ASSERT(solvery_ptrs.size() == solveru_ptrs.size(), "Both sweeps must have the same number of solvers");
+    LSS_ASSERT(solvery_ptrs.size() > 0, "At least one solver per sweep is required");
+    LSS_STATS_ADD(stats_, add_bytes_allocated,
+                  5 * coefficients->space_size_x_ * coefficients->space_size_y_ * sizeof(double));
     initialize(is_heat_source_set);
 }
 
@@ -207,90 +213,65 @@ void heat_craig_sneyd_method::solve(container_2d<by_enum::Row> const &prev_solut
                                     boundary_2d_pair const &vertical_boundary_pair, double const &time,
                                     container_2d<by_enum::Row> &solution)
 {
-    // 2D container for intermediate solution Y_1:
-    container_2d<by_enum::Column> inter_solution_1(coefficients_->space_size_x_, coefficients_->space_size_y_,
-                                                   double{});
-    // 1D container for vector solution:
-    container_t solution_v(coefficients_->space_size_x_, double{});
-    // containers for second split solver:
-    low_.resize(coefficients_->space_size_x_);
-    diag_.resize(coefficients_->space_size_x_);
-    high_.resize(coefficients_->space_size_x_);
-    rhs_.resize(coefficients_->space_size_x_);
-    double y{};
-    for (std::size_t j = 1; j < coefficients_->space_size_y_ - 1; ++j)
-    {
-        y = grid_2d::value_2(grid_cfg_, j);
-        split_0(y, time, low_, diag_, high_);
-        implicit_heston_scheme_cs::rhs_intermed_1(coefficients_, grid_cfg_, j, y, prev_solution, time, rhs_);
-        solvery_ptr_->set_diagonals(low_, diag_, high_);
-        solvery_ptr_->set_rhs(rhs_);
-        solvery_ptr_->solve(horizontal_boundary_pair, solution_v, time, y);
-        inter_solution_1(j, solution_v);
-    }
+    // time factors of separable data are evaluated once, before the workers read the coefficients:
+    coefficients_->prepare_time_factors(time);
+    // line matrices of time-homogeneous data change only with the time step, so their factors may be reused:
+    const double const_step = coefficients_->is_time_homogeneous_ ? coefficients_->k_ : double{};
+    // lines are independent, each worker solves its chunk of lines as one batch:
+    sweep(thread_pool_, workspace_y_, 1, coefficients_->space_size_y_ - 1, horizontal_boundary_pair, time, const_step,
+          [&](std::size_t j, heat_splitting_line const &line) {
+              const double y = grid_2d::value_2(grid_cfg_, j);
+              split_0(j, y, time, line.low_, line.diag_, line.high_);
+              LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+              implicit_heston_scheme_cs::rhs_intermed_1(coefficients_, grid_cfg_, j, y, prev_solution, time, line.rhs_);
+              return y;
+          },
+          [&](std::size_t j, strided_span<const double> const &line_solution) {
+              inter_solution_1_.column(j).copy_from(line_solution);
+          });
 
-    // 2D container for intermediate solution Y_2:
-    container_2d<by_enum::Row> inter_solution_2(coefficients_->space_size_x_, coefficients_->space_size_y_, double{});
-    // 1D container for intermediate solution Y_2:
-    solution_v.resize(coefficients_->space_size_y_);
-    // containers for second split solver:
-    low_.resize(coefficients_->space_size_y_);
-    diag_.resize(coefficients_->space_size_y_);
-    high_.resize(coefficients_->space_size_y_);
-    rhs_.resize(coefficients_->space_size_y_);
-    double x{};
-    for (std::size_t i = 1; i < coefficients_->space_size_x_ - 1; ++i)
-    {
-        x = grid_2d::value_1(grid_cfg_, i);
-        split_1(x, time, low_, diag_, high_);
-        implicit_heston_scheme_cs::rhs_intermed_2(coefficients_, grid_cfg_, i, x, prev_solution, inter_solution_1, time,
-                                                  rhs_);
-        solveru_ptr_->set_diagonals(low_, diag_, high_);
-        solveru_ptr_->set_rhs(rhs_);
-        solveru_ptr_->solve(vertical_boundary_pair, solution_v, time, x);
-        inter_solution_2(i, solution_v);
-    }
+    // row-wise copy of Y_1 read by all workers:
+    copy_solution(inter_solution_1_r_, inter_solution_1_);
+    sweep(thread_pool_, workspace_u_, 1, coefficients_->space_size_x_ - 1, vertical_boundary_pair, time, const_step,
+          [&](std::size_t i, heat_splitting_line const &line) {
+              const double x = grid_2d::value_1(grid_cfg_, i);
+              split_1(i, x, time, line.low_, line.diag_, line.high_);
+              LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+              implicit_heston_scheme_cs::rhs_intermed_2(coefficients_, grid_cfg_, i, x, prev_solution,
+                                                        inter_solution_1_r_, time, line.rhs_);
+              return x;
+          },
+          [&](std::size_t i, strided_span<const double> const &line_solution) {
+              inter_solution_2_.row(i).copy_from(line_solution);
+          });
 
-    // 2D container for intermediate solution Y_3:
-    container_2d<by_enum::Column> inter_solution_3(coefficients_->space_size_x_, coefficients_->space_size_y_,
-                                                   double{});
-    // 1D container for intermediate solution Y_3:
-    solution_v.resize(coefficients_->space_size_x_);
-    // containers for second split solver:
-    low_.resize(coefficients_->space_size_x_);
-    diag_.resize(coefficients_->space_size_x_);
-    high_.resize(coefficients_->space_size_x_);
-    rhs_.resize(coefficients_->space_size_x_);
-    for (std::size_t j = 1; j < coefficients_->space_size_y_ - 1; ++j)
-    {
-        y = grid_2d::value_2(grid_cfg_, j);
-        split_0(y, time, low_, diag_, high_);
-        implicit_heston_scheme_cs::rhs_intermed_3(coefficients_, grid_cfg_, j, y, prev_solution, inter_solution_1,
-                                                  inter_solution_2, time, rhs_);
-        solvery_ptr_->set_diagonals(low_, diag_, high_);
-        solvery_ptr_->set_rhs(rhs_);
-        solvery_ptr_->solve(horizontal_boundary_pair, solution_v, time, y);
-        inter_solution_3(j, solution_v);
-    }
+    sweep(thread_pool_, workspace_y_, 1, coefficients_->space_size_y_ - 1, horizontal_boundary_pair, time, const_step,
+          [&](std::size_t j, heat_splitting_line const &line) {
+              const double y = grid_2d::value_2(grid_cfg_, j);
+              split_0(j, y, time, line.low_, line.diag_, line.high_);
+              LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+              implicit_heston_scheme_cs::rhs_intermed_3(coefficients_, grid_cfg_, j, y, prev_solution,
+                                                        inter_solution_1_r_, inter_solution_2_, time, line.rhs_);
+              return y;
+          },
+          [&](std::size_t j, strided_span<const double> const &line_solution) {
+              inter_solution_3_.column(j).copy_from(line_solution);
+          });
 
-    // 1D container for final solution:
-    solution_v.resize(coefficients_->space_size_y_);
-    // containers for second split solver:
-    low_.resize(coefficients_->space_size_y_);
-    diag_.resize(coefficients_->space_size_y_);
-    high_.resize(coefficients_->space_size_y_);
-    rhs_.resize(coefficients_->space_size_y_);
-    for (std::size_t i = 1; i < coefficients_->space_size_x_ - 1; ++i)
-    {
-        x = grid_2d::value_1(grid_cfg_, i);
-        split_1(x, time, low_, diag_, high_);
-        implicit_heston_scheme_cs::rhs_final(coefficients_, grid_cfg_, i, x, prev_solution, inter_solution_3, time,
-                                             rhs_);
-        solveru_ptr_->set_diagonals(low_, diag_, high_);
-        solveru_ptr_->set_rhs(rhs_);
-        solveru_ptr_->solve(vertical_boundary_pair, solution_v, time, x);
-        solution(i, solution_v);
-    }
+    // row-wise copy of Y_3 read by all workers:
+    copy_solution(inter_solution_3_r_, inter_solution_3_);
+    sweep(thread_pool_, workspace_u_, 1, coefficients_->space_size_x_ - 1, vertical_boundary_pair, time, const_step,
+          [&](std::size_t i, heat_splitting_line const &line) {
+              const double x = grid_2d::value_1(grid_cfg_, i);
+              split_1(i, x, time, line.low_, line.diag_, line.high_);
+              LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+              implicit_heston_scheme_cs::rhs_final(coefficients_, grid_cfg_, i, x, prev_solution, inter_solution_3_r_,
+                                                   time, line.rhs_);
+              return x;
+          },
+          [&](std::size_t i, strided_span<const double> const &line_solution) {
+              solution.row(i).copy_from(line_solution);
+          });
 }
 
 void heat_craig_sneyd_method::solve(container_2d<by_enum::Row> const &prev_solution,
@@ -301,6 +282,11 @@ void heat_craig_sneyd_method::solve(container_2d<by_enum::Row> const &prev_solut
 {
 }
 
+void heat_craig_sneyd_method::set_time_step(double time_step)
+{
+    coefficients_->set_time_step(time_step);
+}
+
 } // namespace two_dimensional
 
 } // namespace lss_pde_solvers
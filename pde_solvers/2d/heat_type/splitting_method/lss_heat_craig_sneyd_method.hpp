@@ -5,6 +5,7 @@
 
 #include "../../../../boundaries/lss_boundary.hpp"
 #include "../../../../common/lss_enumerations.hpp"
+#include "../../../../common/lss_thread_pool.hpp"
 #include "../../../../containers/lss_container_2d.hpp"
 #include "../../../../discretization/lss_discretization.hpp"
 #include "../../../../discretization/lss_grid_config.hpp"
@@ -23,6 +24,7 @@ using lss_containers::container_2d;
 using lss_enumerations::by_enum;
 using lss_grids::grid_config_2d_ptr;
 using lss_utility::container_t;
+using lss_utility::thread_pool_ptr;
 
 class implicit_heston_scheme_cs
 {
@@ -30,29 +32,30 @@ class implicit_heston_scheme_cs
   public:
     static void rhs_intermed_1(heston_implicit_coefficients_ptr const &cfs, grid_config_2d_ptr const &grid_cfg,
                                std::size_t const &y_index, double const &y, container_2d<by_enum::Row> const &input,
-                               double const &time, container_t &solution);
+                               double const &time, strided_span<double> const &solution);
 
     static void rhs_intermed_1_source(heston_implicit_coefficients_ptr const &cfs, grid_config_2d_ptr const &grid_cfg,
                                       std::size_t const &y_index, double const &y,
                                       container_2d<by_enum::Row> const &input,
                                       container_2d<by_enum::Row> const &inhom_input,
                                       container_2d<by_enum::Row> const &inhom_input_next, double const &time,
-                                      container_t &solution);
+                                      strided_span<double> const &solution);
 
     static void rhs_intermed_2(heston_implicit_coefficients_ptr const &cfs, grid_config_2d_ptr const &grid_cfg,
                                std::size_t const &x_index, double const &x, container_2d<by_enum::Row> const &input,
                                container_2d<by_enum::Row> const &inhom_input, double const &time,
-                               container_t &solution);
+                               strided_span<double> const &solution);
 
     static void rhs_intermed_3(heston_implicit_coefficients_ptr const &cfs, grid_config_2d_ptr const &grid_cfg,
                                std::size_t const &y_index, double const &y, container_2d<by_enum::Row> const &input,
                                container_2d<by_enum::Row> const &inhom_input,
                                container_2d<by_enum::Row> const &inhom_input_next, double const &time,
-                               container_t &solution);
+                               strided_span<double> const &solution);
 
     static void rhs_final(heston_implicit_coefficients_ptr const &cfs, grid_config_2d_ptr const &grid_cfg,
                           std::size_t const &x_index, double const &x, container_2d<by_enum::Row> const &input,
-                          container_2d<by_enum::Row> const &inhom_input, double const &time, container_t &solution);
+                          container_2d<by_enum::Row> const &inhom_input, double const &time,
+                          strided_span<double> const &solution);
 };
 
 /**
@@ -64,28 +67,37 @@ class heat_craig_sneyd_method : public heat_splitting_method
   private:
     // constants:
     const double cone_ = 1.0;
-    // solvers:
-    lss_tridiagonal_solver::tridiagonal_solver_ptr solvery_ptr_;
-    lss_tridiagonal_solver::tridiagonal_solver_ptr solveru_ptr_;
     // scheme coefficients:
     heston_implicit_coefficients_ptr coefficients_;
     grid_config_2d_ptr grid_cfg_;
-    // containers:
-    container_t low_, diag_, high_, rhs_;
+    // per-worker solvers and containers:
+    heat_splitting_workspaces workspace_y_;
+    heat_splitting_workspaces workspace_u_;
+    // workers sweeping the lines:
+    thread_pool_ptr thread_pool_;
+    // intermediate solutions reused across time steps:
+    container_2d<by_enum::Column> inter_solution_1_;
+    container_2d<by_enum::Row> inter_solution_1_r_;
+    container_2d<by_enum::Row> inter_solution_2_;
+    container_2d<by_enum::Column> inter_solution_3_;
+    container_2d<by_enum::Row> inter_solution_3_r_;
 
     explicit heat_craig_sneyd_method() = delete;
 
     void initialize(bool is_heat_source_set);
 
-    void split_0(double const &y, double const &time, container_t &low, container_t &diag, container_t &high);
+    void split_0(std::size_t const &y_index, double const &y, double const &time, strided_span<double> const &low,
+                 strided_span<double> const &diag, strided_span<double> const &high);
 
-    void split_1(double const &x, double const &time, container_t &low, container_t &diag, container_t &high);
+    void split_1(std::size_t const &x_index, double const &x, double const &time, strided_span<double> const &low,
+                 strided_span<double> const &diag, strided_span<double> const &high);
 
   public:
-    explicit heat_craig_sneyd_method(lss_tridiagonal_solver::tridiagonal_solver_ptr const &solvery_ptr,
-                                     lss_tridiagonal_solver::tridiagonal_solver_ptr const &solveru_ptr,
+    explicit heat_craig_sneyd_method(tridiagonal_solver_ptrs const &solvery_ptrs,
+                                     tridiagonal_solver_ptrs const &solveru_ptrs,
                                      heston_implicit_coefficients_ptr const &coefficients,
-                                     grid_config_2d_ptr const grid_config, bool is_heat_source_set);
+                                     grid_config_2d_ptr const grid_config, bool is_heat_source_set,
+                                     thread_pool_ptr const &thread_pool, solver_stats_ptr const &stats);
 
     ~heat_craig_sneyd_method();
 
@@ -101,6 +113,8 @@ class heat_craig_sneyd_method : public heat_splitting_method
     void solve(container_2d<by_enum::Row> const &prev_solution, boundary_2d_pair const &horizontal_boundary_pair,
                boundary_2d_pair const &vertical_boundary_pair, double const &time,
                std::function<double(double, double)> const &heat_source, container_2d<by_enum::Row> &solution) override;
+
+    void set_time_step(double time_step) override;
 };
 
 } // namespace two_dimensional
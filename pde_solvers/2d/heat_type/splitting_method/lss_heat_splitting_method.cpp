@@ -6,7 +6,26 @@ namespace lss_pde_solvers
 namespace two_dimensional
 {
 
-heat_splitting_method::heat_splitting_method()
+heat_splitting_workspace::heat_splitting_workspace(lss_tridiagonal_solver::tridiagonal_solver_ptr const &solver_ptr,
+                                                   std::size_t size)
+    : solver_ptr_{solver_ptr}, batch_(size, 0), const_step_{}
+{
+}
+
+std::vector<heat_splitting_workspace> heat_splitting_workspace::create(tridiagonal_solver_ptrs const &solver_ptrs,
+                                                                       std::size_t size, solver_stats_ptr const &stats)
+{
+    std::vector<heat_splitting_workspace> workspaces;
+    workspaces.reserve(solver_ptrs.size());
+    for (auto const &solver_ptr : solver_ptrs)
+    {
+        solver_ptr->set_stats(stats);
+        workspaces.emplace_back(solver_ptr, size);
+    }
+    return workspaces;
+}
+
+heat_splitting_method::heat_splitting_method(solver_stats_ptr const &stats) : stats_{stats}
 {
 }
 
@@ -14,6 +33,45 @@ heat_splitting_method::~heat_splitting_method()
 {
 }
 
+void heat_splitting_method::sweep(thread_pool_ptr const &pool, heat_splitting_workspaces &workspaces,
+                                  std::size_t first, std::size_t last, boundary_2d_pair const &boundary, double time,
+                                  double const_step, line_assembler const &assemble,
+                                  line_collector const &collect) const
+{
+    const std::size_t n = last - first;
+    const std::size_t workers = workspaces.size();
+    pool->parallel_for(0, workers, [&](std::size_t worker_idx, std::size_t w) {
+        auto &ws = workspaces[w];
+        // worker w takes the contiguous chunk [first + n*w/workers, first + n*(w+1)/workers):
+        const std::size_t begin = first + (n * w) / workers;
+        const std::size_t end = first + (n * (w + 1)) / workers;
+        const std::size_t count = end - begin;
+        // chunk sizes do not change between time steps so the batch is sized only once:
+        if (ws.batch_.systems_count() != count)
+        {
+            ws.batch_.resize(count);
+            ws.space_args_.resize(count);
+            // diagonals, right-hand sides and solutions of the batch:
+            LSS_STATS_ADD(stats_, add_bytes_allocated, 5 * count * ws.batch_.system_size() * sizeof(double));
+        }
+        for (std::size_t s = 0; s < count; ++s)
+        {
+            const heat_splitting_line line{ws.batch_.low(s), ws.batch_.diag(s), ws.batch_.high(s),
+                                           ws.batch_.rhs(s)};
+            ws.space_args_[s] = assemble(begin + s, line);
+        }
+        // reassembled matrices equal those of the last sweep when they do not depend on time:
+        ws.batch_.set_diagonals_kept((const_step != double{}) && (ws.const_step_ == const_step));
+        ws.const_step_ = const_step;
+        ws.solver_ptr_->solve(boundary, ws.batch_, time, ws.space_args_);
+        LSS_STATS_PHASE(stats_, solver_phase_enum::Copy);
+        for (std::size_t s = 0; s < count; ++s)
+        {
+            collect(begin + s, ws.batch_.solution(s));
+        }
+    });
+}
+
 } // namespace two_dimensional
 
 } // namespace lss_pde_solvers
@@ -2,12 +2,18 @@
 #define _LSS_HEAT_SPLITTING_METHOD_HPP_
 
 #include <functional>
+#include <vector>
 
 #include "../../../../boundaries/lss_boundary.hpp"
 #include "../../../../common/lss_enumerations.hpp"
 #include "../../../../common/lss_macros.hpp"
+#include "../../../../common/lss_solver_stats.hpp"
+#include "../../../../common/lss_thread_pool.hpp"
 #include "../../../../common/lss_utility.hpp"
 #include "../../../../containers/lss_container_2d.hpp"
+#include "../../../../containers/lss_strided_span.hpp"
+#include "../../../../sparse_solvers/tridiagonal/lss_tridiagonal_batch.hpp"
+#include "../../../../sparse_solvers/tridiagonal/lss_tridiagonal_solver.hpp"
 
 namespace lss_pde_solvers
 {
@@ -17,16 +23,102 @@ namespace two_dimensional
 using lss_boundary::boundary_2d_pair;
 using lss_boundary::boundary_2d_ptr;
 using lss_containers::container_2d;
+using lss_containers::strided_span;
 using lss_enumerations::by_enum;
+using lss_enumerations::solver_phase_enum;
+using lss_utility::container_t;
+using lss_utility::solver_stats_ptr;
 using lss_utility::sptr_t;
+using lss_utility::thread_pool_ptr;
+
+using tridiagonal_solver_ptrs = std::vector<lss_tridiagonal_solver::tridiagonal_solver_ptr>;
+
+/**
+    heat_splitting_workspace structure
+
+    Solver and batch of line systems owned by a single sweep worker.
+ */
+struct heat_splitting_workspace
+{
+    lss_tridiagonal_solver::tridiagonal_solver_ptr solver_ptr_;
+    lss_tridiagonal_solver::tridiagonal_batch batch_;
+    container_t space_args_;
+    // time step of the time-homogeneous line matrices held in the batch (zero means none):
+    double const_step_;
+
+    explicit heat_splitting_workspace(lss_tridiagonal_solver::tridiagonal_solver_ptr const &solver_ptr,
+                                      std::size_t size);
+
+    /**
+        @brief  Creates one workspace per solver
+        @param  solver_ptrs - one solver per worker
+        @param  size - size of the line systems
+        @param  stats - statistics the solvers record into
+        @retval vector of workspaces
+    **/
+    static std::vector<heat_splitting_workspace> create(tridiagonal_solver_ptrs const &solver_ptrs, std::size_t size,
+                                                        solver_stats_ptr const &stats);
+};
+
+using heat_splitting_workspaces = std::vector<heat_splitting_workspace>;
+
+/**
+    heat_splitting_line structure
+
+    Views of a single line system inside the worker's batch.
+ */
+struct heat_splitting_line
+{
+    strided_span<double> low_, diag_, high_, rhs_;
+};
+
+// fills the line system with given index and returns its space argument:
+using line_assembler = std::function<double(std::size_t, heat_splitting_line const &)>;
+// receives solution of the line with given index:
+using line_collector = std::function<void(std::size_t, strided_span<const double> const &)>;
 
 /**
     heat_splitting_method object
  */
 class heat_splitting_method
 {
+  protected:
+    solver_stats_ptr stats_;
+
+    /**
+        @brief  Solves lines [first, last) of one sweep direction, each worker submits its chunk of lines as one batch
+        @param  pool - workers sweeping the lines
+        @param  workspaces - one workspace per worker
+        @param  first - first line index
+        @param  last - one past last line index
+        @param  boundary - boundary pair shared by all lines
+        @param  time - time at which the boundary is evaluated
+        @param  const_step - time step of time-homogeneous line matrices, zero when they change in time
+        @param  assemble - fills the line system and returns its space argument
+        @param  collect - receives solution of the line
+    **/
+    void sweep(thread_pool_ptr const &pool, heat_splitting_workspaces &workspaces, std::size_t first, std::size_t last,
+               boundary_2d_pair const &boundary, double time, double const_step, line_assembler const &assemble,
+               line_collector const &collect) const;
+
+    /**
+        @brief  Copies intermediate solution into the other storage order
+        @param  to - destination
+        @param  from - source
+    **/
+    template <typename to_container, typename from_container>
+    void copy_solution(to_container &to, from_container const &from) const
+    {
+        LSS_STATS_PHASE(stats_, solver_phase_enum::Copy);
+        to = from;
+    }
+
   public:
-    explicit heat_splitting_method();
+    /**
+        @brief  heat_splitting_method object constructor
+        @param  stats - statistics the splitting method records into (null records nothing)
+    **/
+    explicit heat_splitting_method(solver_stats_ptr const &stats);
 
     ~heat_splitting_method();
 
@@ -38,6 +130,12 @@ class heat_splitting_method
                        boundary_2d_pair const &horizontal_boundary_pair, boundary_2d_pair const &vertical_boundary_pair,
                        double const &time, std::function<double(double, double)> const &heat_source,
                        container_2d<by_enum::Row> &solution) = 0;
+
+    /**
+        @brief  Sets the time step of the next solve (non-uniform time grids)
+        @param  time_step - time step
+    **/
+    virtual void set_time_step(double time_step) = 0;
 };
 
 using heat_splitting_method_ptr = sptr_t<heat_splitting_method>;
@@ -31,13 +31,17 @@ class heston_explicit_time_loop
 {
 
   public:
+    /**
+        @brief  Runs the time loop
+        @param  stats - statistics the loop records into, explicit updates are recorded as RightHandSide
+    **/
     static void run(heston_explicit_solver_method_ptr const &solver_ptr,
                     heston_explicit_boundary_solver_ptr const &boundary_solver_ptr,
                     boundary_2d_pair const &horizontal_boundary_pair,
                     boundary_2d_ptr const &vertical_upper_boundary_ptr, grid_config_2d_ptr const &grid_config,
                     range_ptr const &time_range, std::size_t const &last_time_idx, double const time_step,
                     traverse_direction_enum const &traverse_dir, container_2d<by_enum::Row> &prev_solution,
-                    container_2d<by_enum::Row> &next_solution);
+                    container_2d<by_enum::Row> &next_solution, solver_stats_ptr const &stats = nullptr);
 };
 } // namespace two_dimensional
 } // namespace lss_pde_solvers
@@ -6,6 +6,7 @@ namespace lss_pde_solvers
 {
 
 using lss_boundary::dirichlet_boundary_2d;
+using lss_enumerations::solver_phase_enum;
 
 namespace two_dimensional
 {
@@ -14,16 +15,9 @@ boundary_2d_pair heston_implicit_boundaries::get_vertical(grid_config_1d_ptr con
                                                           container_2d<by_enum::Row> const &next_solution)
 {
     auto const lci = next_solution.columns() - 1;
-    auto lower = [=](double t, double x) -> double {
-        const std::size_t i = grid_config_x->index_of(x);
-        return next_solution(i, 0);
-    };
-    auto upper = [=](double t, double x) -> double {
-        const std::size_t i = grid_config_x->index_of(x);
-        return next_solution(i, lci);
-    };
-    auto vertical_low = std::make_shared<dirichlet_boundary_2d>(lower);
-    auto vertical_high = std::make_shared<dirichlet_boundary_2d>(upper);
+    const double step = grid_config_x->step();
+    auto vertical_low = std::make_shared<dirichlet_boundary_2d>(next_solution.column(0), step);
+    auto vertical_high = std::make_shared<dirichlet_boundary_2d>(next_solution.column(lci), step);
     return std::make_pair(vertical_low, vertical_high);
 }
 
@@ -31,16 +25,9 @@ boundary_2d_pair heston_implicit_boundaries::get_intermed_horizontal(grid_config
                                                                      container_2d<by_enum::Row> const &next_solution)
 {
     const std::size_t lri = next_solution.rows() - 1;
-    auto lower = [=](double t, double y) -> double {
-        const std::size_t j = grid_config_y->index_of(y);
-        return next_solution(0, j);
-    };
-    auto upper = [=](double t, double y) -> double {
-        const std::size_t j = grid_config_y->index_of(y);
-        return next_solution(lri, j);
-    };
-    auto horizontal_low = std::make_shared<dirichlet_boundary_2d>(lower);
-    auto horizontal_high = std::make_shared<dirichlet_boundary_2d>(upper);
+    const double step = grid_config_y->step();
+    auto horizontal_low = std::make_shared<dirichlet_boundary_2d>(next_solution.row(0), step);
+    auto horizontal_high = std::make_shared<dirichlet_boundary_2d>(next_solution.row(lri), step);
     return std::make_pair(horizontal_low, horizontal_high);
 }
 
@@ -49,55 +36,146 @@ void heston_implicit_time_loop::run(
     boundary_2d_pair const &horizontal_boundary_pair, boundary_2d_ptr const &vertical_upper_boundary_ptr,
     grid_config_2d_ptr const &grid_config, range_ptr const &time_range, std::size_t const &last_time_idx,
     double const time_step, traverse_direction_enum const &traverse_dir, container_2d<by_enum::Row> &prev_solution,
-    container_2d<by_enum::Row> &next_solution)
+    container_2d<by_enum::Row> &next_solution, time_slice_observer_2d_ptr const &observer,
+    heat_splitting_method_ptr const &startup_solver_ptr,
+    heston_explicit_boundary_solver_ptr const &startup_boundary_solver_ptr, std::size_t const &startup_steps,
+    time_grid_config_ptr const &time_grid, solver_stats_ptr const &stats)
 {
 
     const double start_time = time_range->lower();
     const double end_time = time_range->upper();
     const double k = time_step;
-    boundary_2d_pair ver_boundary_pair;
-    boundary_2d_pair hor_inter_boundary_pair;
+    double half_k = 0.5 * time_step;
+    // non-uniform time grid overrides the uniform time points and steps:
+    const container_t time_points = (time_grid != nullptr) ? time_grid->time_points() : container_t();
+    // both pairs view the solution buffers, which keep their storage across time steps:
+    const boundary_2d_pair ver_boundary_pair =
+        heston_implicit_boundaries::get_vertical(grid_config->grid_1(), next_solution);
+    const boundary_2d_pair hor_inter_boundary_pair =
+        heston_implicit_boundaries::get_intermed_horizontal(grid_config->grid_2(), prev_solution);
 
     double time{};
     std::size_t time_idx{};
 
     if (traverse_dir == traverse_direction_enum::Forward)
     {
+        if (observer != nullptr)
+        {
+            (*observer)(0, start_time, prev_solution);
+        }
         time = start_time + k;
         time_idx = 1;
+        // Rannacher start-up, each leading step is taken as two fully implicit half-steps:
+        while ((time_idx <= startup_steps) && (time_idx <= last_time_idx))
+        {
+            if (time_grid != nullptr)
+            {
+                time = time_points[time_idx];
+                half_k = 0.5 * (time - time_points[time_idx - 1]);
+                startup_solver_ptr->set_time_step(half_k);
+                startup_boundary_solver_ptr->set_time_step(half_k);
+            }
+            for (double const half_time : {time - half_k, time})
+            {
+                startup_boundary_solver_ptr->solve(prev_solution, horizontal_boundary_pair,
+                                                   vertical_upper_boundary_ptr, half_time, next_solution);
+                startup_solver_ptr->solve(prev_solution, hor_inter_boundary_pair, ver_boundary_pair, half_time,
+                                          next_solution);
+                startup_boundary_solver_ptr->solve(prev_solution, horizontal_boundary_pair, half_time, next_solution);
+                LSS_STATS_PHASE(stats, solver_phase_enum::Copy);
+                prev_solution = next_solution;
+            }
+            if (observer != nullptr)
+            {
+                (*observer)(time_idx, time, next_solution);
+            }
+            time += k;
+            time_idx++;
+        }
         while (time_idx <= last_time_idx)
         {
+            if (time_grid != nullptr)
+            {
+                time = time_points[time_idx];
+                solver_ptr->set_time_step(time - time_points[time_idx - 1]);
+                boundary_solver_ptr->set_time_step(time - time_points[time_idx - 1]);
+            }
             boundary_solver_ptr->solve(prev_solution, horizontal_boundary_pair, vertical_upper_boundary_ptr, time,
                                        next_solution);
-            ver_boundary_pair = heston_implicit_boundaries::get_vertical(grid_config->grid_1(), next_solution);
-            hor_inter_boundary_pair =
-                heston_implicit_boundaries::get_intermed_horizontal(grid_config->grid_2(), prev_solution);
             solver_ptr->solve(prev_solution, hor_inter_boundary_pair, ver_boundary_pair, time, next_solution);
             boundary_solver_ptr->solve(prev_solution, horizontal_boundary_pair, time, next_solution);
+            if (observer != nullptr)
+            {
+                (*observer)(time_idx, time, next_solution);
+            }
 
-            prev_solution = next_solution;
+            {
+                LSS_STATS_PHASE(stats, solver_phase_enum::Copy);
+                prev_solution = next_solution;
+            }
             time += k;
             time_idx++;
         }
     }
     else
     {
+        if (observer != nullptr)
+        {
+            (*observer)(last_time_idx, end_time, prev_solution);
+        }
         time = end_time - k;
         time_idx = last_time_idx;
-        do
+        // Rannacher start-up, each leading step is taken as two fully implicit half-steps:
+        while ((last_time_idx - time_idx < startup_steps) && (time_idx > 0))
+        {
+            time_idx--;
+            if (time_grid != nullptr)
+            {
+                time = time_points[time_idx];
+                half_k = 0.5 * (time_points[time_idx + 1] - time);
+                startup_solver_ptr->set_time_step(half_k);
+                startup_boundary_solver_ptr->set_time_step(half_k);
+            }
+            for (double const half_time : {time + half_k, time})
+            {
+                startup_boundary_solver_ptr->solve(prev_solution, horizontal_boundary_pair,
+                                                   vertical_upper_boundary_ptr, half_time, next_solution);
+                startup_solver_ptr->solve(prev_solution, hor_inter_boundary_pair, ver_boundary_pair, half_time,
+                                          next_solution);
+                startup_boundary_solver_ptr->solve(prev_solution, horizontal_boundary_pair, half_time, next_solution);
+                LSS_STATS_PHASE(stats, solver_phase_enum::Copy);
+                prev_solution = next_solution;
+            }
+            if (observer != nullptr)
+            {
+                (*observer)(time_idx, time, next_solution);
+            }
+            time -= k;
+        }
+        while (time_idx > 0)
         {
             time_idx--;
+            if (time_grid != nullptr)
+            {
+                time = time_points[time_idx];
+                solver_ptr->set_time_step(time_points[time_idx + 1] - time);
+                boundary_solver_ptr->set_time_step(time_points[time_idx + 1] - time);
+            }
             boundary_solver_ptr->solve(prev_solution, horizontal_boundary_pair, vertical_upper_boundary_ptr, time,
                                        next_solution);
-            ver_boundary_pair = heston_implicit_boundaries::get_vertical(grid_config->grid_1(), next_solution);
-            hor_inter_boundary_pair =
-                heston_implicit_boundaries::get_intermed_horizontal(grid_config->grid_2(), prev_solution);
             solver_ptr->solve(prev_solution, hor_inter_boundary_pair, ver_boundary_pair, time, next_solution);
             boundary_solver_ptr->solve(prev_solution, horizontal_boundary_pair, time, next_solution);
+            if (observer != nullptr)
+            {
+                (*observer)(time_idx, time, next_solution);
+            }
 
-            prev_solution = next_solution;
+            {
+                LSS_STATS_PHASE(stats, solver_phase_enum::Copy);
+                prev_solution = next_solution;
+            }
             time -= k;
-        } while (time_idx > 0);
+        }
     }
 }
 
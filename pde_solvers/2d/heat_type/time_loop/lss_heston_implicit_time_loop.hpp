@@ -6,6 +6,7 @@
 #include "../../../../common/lss_utility.hpp"
 #include "../../../../containers/lss_container_2d.hpp"
 #include "../../../../discretization/lss_grid_config.hpp"
+#include "../../../lss_time_slice_observer.hpp"
 #include "../boundary_solver/lss_heston_explicit_boundary_solver.hpp"
 #include "../explicit_coefficients/lss_heston_euler_coefficients.hpp"
 #include "../splitting_method/lss_heat_splitting_method.hpp"
@@ -26,14 +27,29 @@ using lss_utility::range_ptr;
 
 /**
     heston_implicit_boundaries object
+
+    Boundaries reference edge slices of the live solution buffers, so they are
+    created once and read the current values on every time step.
  */
 class heston_implicit_boundaries
 {
 
   public:
+    /**
+        @brief  Vertical boundaries viewing the first and the last column of the solution
+        @param  grid_config_x - grid along the columns
+        @param  next_solution - solution buffer, must outlive the boundaries and keep its storage
+        @retval pair of boundaries
+    **/
     static boundary_2d_pair get_vertical(grid_config_1d_ptr const &grid_config_x,
                                          container_2d<by_enum::Row> const &next_solution);
 
+    /**
+        @brief  Intermediate horizontal boundaries viewing the first and the last row of the solution
+        @param  grid_config_y - grid along the rows
+        @param  next_solution - solution buffer, must outlive the boundaries and keep its storage
+        @retval pair of boundaries
+    **/
     static boundary_2d_pair get_intermed_horizontal(grid_config_1d_ptr const &grid_config_y,
                                                     container_2d<by_enum::Row> const &next_solution);
 };
@@ -45,13 +61,25 @@ class heston_implicit_time_loop
 {
 
   public:
+    /**
+        @brief  Runs the time loop, observer (may be null) receives the initial and every computed time slice
+        @param  startup_solver_ptr - fully implicit splitting method advancing by half of the time step
+        @param  startup_boundary_solver_ptr - boundary solver advancing by half of the time step
+        @param  startup_steps - number of leading time steps taken as two half-steps of the start-up solvers
+        @param  time_grid - non-uniform time grid, replaces time_range and time_step when set
+        @param  stats - statistics the copies between time slices are recorded into
+    **/
     static void run(heat_splitting_method_ptr const &solver_ptr,
                     heston_explicit_boundary_solver_ptr const &boundary_solver_ptr,
                     boundary_2d_pair const &horizontal_boundary_pair,
                     boundary_2d_ptr const &vertical_upper_boundary_ptr, grid_config_2d_ptr const &grid_config,
                     range_ptr const &time_range, std::size_t const &last_time_idx, double const time_step,
                     traverse_direction_enum const &traverse_dir, container_2d<by_enum::Row> &prev_solution,
-                    container_2d<by_enum::Row> &next_solution);
+                    container_2d<by_enum::Row> &next_solution, time_slice_observer_2d_ptr const &observer = nullptr,
+                    heat_splitting_method_ptr const &startup_solver_ptr = nullptr,
+                    heston_explicit_boundary_solver_ptr const &startup_boundary_solver_ptr = nullptr,
+                    std::size_t const &startup_steps = std::size_t(0),
+                    time_grid_config_ptr const &time_grid = nullptr, solver_stats_ptr const &stats = nullptr);
 };
 } // namespace two_dimensional
 } // namespace lss_pde_solvers
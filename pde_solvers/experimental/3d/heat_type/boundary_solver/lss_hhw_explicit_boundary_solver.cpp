@@ -12,10 +12,12 @@
 namespace lss_pde_solvers
 {
 
+using lss_boundary::boundary_cast;
 using lss_boundary::dirichlet_boundary_2d;
 using lss_boundary::dirichlet_boundary_3d;
 using lss_boundary::neumann_boundary_2d;
 using lss_boundary::neumann_boundary_3d;
+using lss_enumerations::solver_phase_enum;
 using d_2d = discretization_2d<std::vector, std::allocator<double>>;
 using lss_grids::grid_2d;
 
@@ -56,7 +58,7 @@ void explicit_hhw_boundary_scheme::rhs(hhw_implicit_coefficients_ptr const &cfg,
     double x{}, z{}, h_1{}, h_3{};
     h_1 = grid_3d::step_1(grid_cfg);
     h_3 = grid_3d::step_3(grid_cfg);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(first_x_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_3d>(first_x_bnd))
     {
         auto fun = [&](double z) { return ptr->value(time, y, z); };
         container_t lower(L + 1, double{0.0});
@@ -68,7 +70,7 @@ void explicit_hhw_boundary_scheme::rhs(hhw_implicit_coefficients_ptr const &cfg,
         solution(0, lower);
     }
 
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(second_x_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_3d>(second_x_bnd))
     {
         x = grid_3d::value_1(grid_cfg, N);
         auto fun = [&](double z) { return two * h_1 * ptr->value(time, y, z); };
@@ -85,7 +87,7 @@ void explicit_hhw_boundary_scheme::rhs(hhw_implicit_coefficients_ptr const &cfg,
                        (gamma_2 * H(time, x, y, z) * input(N, y_index + 2, k));
         }
 
-        if (auto const &ptr_z = std::dynamic_pointer_cast<neumann_boundary_3d>(first_z_bnd))
+        if (auto const &ptr_z = boundary_cast<neumann_boundary_3d>(first_z_bnd))
         {
             z = grid_3d::value_3(grid_cfg, 0);
             auto const beta_z = two * h_3 * ptr_z->value(time, y, z);
@@ -99,7 +101,7 @@ void explicit_hhw_boundary_scheme::rhs(hhw_implicit_coefficients_ptr const &cfg,
                        (gamma_2 * H(time, x, y, z) * input(N, y_index + 2, 0));
         }
 
-        if (auto const &ptr_z = std::dynamic_pointer_cast<neumann_boundary_3d>(second_z_bnd))
+        if (auto const &ptr_z = boundary_cast<neumann_boundary_3d>(second_z_bnd))
         {
             z = grid_3d::value_3(grid_cfg, L);
             auto const beta_z = two * h_3 * ptr_z->value(time, y, z);
@@ -116,7 +118,7 @@ void explicit_hhw_boundary_scheme::rhs(hhw_implicit_coefficients_ptr const &cfg,
     }
 
     double val{};
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(first_z_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_3d>(first_z_bnd))
     {
         z = grid_3d::value_3(grid_cfg, 0);
         auto fun = [&](double x) { return two * h_3 * ptr->value(time, x, y); };
@@ -135,7 +137,7 @@ void explicit_hhw_boundary_scheme::rhs(hhw_implicit_coefficients_ptr const &cfg,
         }
     }
 
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(second_z_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_3d>(second_z_bnd))
     {
         z = grid_3d::value_3(grid_cfg, L);
         auto fun = [&](double x) { return two * h_3 * ptr->value(time, x, y); };
@@ -210,7 +212,7 @@ void explicit_hhw_boundary_scheme::rhs_source(hhw_implicit_coefficients_ptr cons
     double x{}, z{}, h_1{}, h_3{};
     h_1 = grid_3d::step_1(grid_cfg);
     h_3 = grid_3d::step_3(grid_cfg);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(first_x_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_3d>(first_x_bnd))
     {
         auto fun = [&](double z) { return ptr->value(time, y, z); };
         container_t lower(L, double{0.0});
@@ -221,7 +223,7 @@ void explicit_hhw_boundary_scheme::rhs_source(hhw_implicit_coefficients_ptr cons
         }
         solution(0, lower);
     }
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(second_x_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_3d>(second_x_bnd))
     {
         x = grid_3d::value_1(grid_cfg, N);
         auto fun = [&](double z) { return two * h_1 * ptr->value(time, y, z); };
@@ -238,7 +240,7 @@ void explicit_hhw_boundary_scheme::rhs_source(hhw_implicit_coefficients_ptr cons
                        (gamma_2 * H(time, x, y, z) * input(N, y_index + 2, k)) + rho * inhom_input(N, y_index, k);
         }
 
-        if (auto const &ptr_z = std::dynamic_pointer_cast<neumann_boundary_3d>(first_z_bnd))
+        if (auto const &ptr_z = boundary_cast<neumann_boundary_3d>(first_z_bnd))
         {
             z = grid_3d::value_3(grid_cfg, 0);
             auto const beta_z = two * h_3 * ptr_z->value(time, y, z);
@@ -252,7 +254,7 @@ void explicit_hhw_boundary_scheme::rhs_source(hhw_implicit_coefficients_ptr cons
                        (gamma_2 * H(time, x, y, z) * input(N, y_index + 2, 0)) + rho * inhom_input(N, y_index, 0);
         }
 
-        if (auto const &ptr_z = std::dynamic_pointer_cast<neumann_boundary_3d>(second_z_bnd))
+        if (auto const &ptr_z = boundary_cast<neumann_boundary_3d>(second_z_bnd))
         {
             z = grid_3d::value_3(grid_cfg, L);
             auto const beta_z = two * h_3 * ptr_z->value(time, y, z);
@@ -269,7 +271,7 @@ void explicit_hhw_boundary_scheme::rhs_source(hhw_implicit_coefficients_ptr cons
     }
 
     double val{};
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(first_z_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_3d>(first_z_bnd))
     {
         z = grid_3d::value_3(grid_cfg, 0);
         auto fun = [&](double x) { return two * h_3 * ptr->value(time, x, y); };
@@ -288,7 +290,7 @@ void explicit_hhw_boundary_scheme::rhs_source(hhw_implicit_coefficients_ptr cons
         }
     }
 
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(second_z_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_3d>(second_z_bnd))
     {
         z = grid_3d::value_3(grid_cfg, L);
         auto fun = [&](double x) { return two * h_3 * ptr->value(time, x, y); };
@@ -328,8 +330,9 @@ void explicit_hhw_boundary_scheme::rhs_source(hhw_implicit_coefficients_ptr cons
 }
 
 hhw_explicit_boundary_solver::hhw_explicit_boundary_solver(hhw_implicit_coefficients_ptr const &coefficients,
-                                                           grid_config_3d_ptr const &grid_config)
-    : coefficients_{coefficients}, grid_cfg_{grid_config}
+                                                           grid_config_3d_ptr const &grid_config,
+                                                           solver_stats_ptr const &stats)
+    : coefficients_{coefficients}, grid_cfg_{grid_config}, stats_{stats}
 {
 }
 
@@ -343,22 +346,29 @@ void hhw_explicit_boundary_solver::solve(container_3d<by_enum::RowPlane> const &
                                          boundary_3d_pair const &z_boundary_pair, double const &time,
                                          container_3d<by_enum::RowPlane> &solution)
 {
-    container_3d<by_enum::ColumnPlane> cpsolution(solution);
+    LSS_STATS_PHASE(stats_, solver_phase_enum::BoundarySolve);
     // 2D container for intermediate solution:
     container_2d<by_enum::Row> solution_v(coefficients_->space_size_x_, coefficients_->space_size_z_, double{});
+    LSS_STATS_ADD(stats_, add_bytes_allocated, solution_v.rows() * solution_v.columns() * sizeof(double));
     /// get the right-hand side of the scheme:
     auto const y = grid_3d::value_2(grid_cfg_, 0);
     explicit_hhw_boundary_scheme::rhs(coefficients_, grid_cfg_, 0, y, x_boundary_pair, z_boundary_pair, prev_solution,
                                       time, solution_v);
-    // boundary plane at Y = 0:
-    cpsolution(0, solution_v);
-    auto const &upper_bnd_ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(y_upper_boundary_ptr);
+    // boundary plane at Y = 0, row i of solution_v is the z-line (i,0):
+    for (std::size_t i = 0; i < solution_v.rows(); ++i)
+    {
+        solution.layer_line(i, 0).copy_from(solution_v.row(i));
+    }
+    auto const &upper_bnd_ptr = boundary_cast<dirichlet_boundary_3d>(y_upper_boundary_ptr);
     auto const &upper_bnd = [=](double t, double s, double r) { return upper_bnd_ptr->value(t, s, r); };
     d_2d::of_function(grid_cfg_->grid_13(), time, upper_bnd, solution_v);
 
     // boundary plane at Y = M-1:
-    cpsolution(coefficients_->space_size_y_ - 1, solution_v);
-    solution = cpsolution;
+    auto const lci = coefficients_->space_size_y_ - 1;
+    for (std::size_t i = 0; i < solution_v.rows(); ++i)
+    {
+        solution.layer_line(i, lci).copy_from(solution_v.row(i));
+    }
 }
 
 void hhw_explicit_boundary_solver::solve(container_3d<by_enum::RowPlane> const &prev_solution,
@@ -366,9 +376,13 @@ void hhw_explicit_boundary_solver::solve(container_3d<by_enum::RowPlane> const &
                                          boundary_3d_pair const &z_boundary_pair, double const &time,
                                          container_3d<by_enum::RowPlane> &solution)
 {
+    LSS_STATS_PHASE(stats_, solver_phase_enum::BoundarySolve);
     // 3D container for intermediate solution:
     container_2d<by_enum::Row> solution_yz(coefficients_->space_size_y_, coefficients_->space_size_z_, double{});
     container_2d<by_enum::Row> solution_xy(coefficients_->space_size_x_, coefficients_->space_size_y_, double{});
+    LSS_STATS_ADD(stats_, add_bytes_allocated,
+                  (solution_yz.rows() * solution_yz.columns() + solution_xy.rows() * solution_xy.columns()) *
+                      sizeof(double));
     // some constants:
     auto const &start_y = coefficients_->rangey_->lower();
     // prepare grid_xy:
@@ -376,19 +390,22 @@ void hhw_explicit_boundary_solver::solve(container_3d<by_enum::RowPlane> const &
     // prepare grid_zy:
     auto const &grid_23 = grid_cfg_->grid_23();
     /// populating lower X:
-    auto const &lower_x_ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(x_boundary_pair.first);
+    auto const &lower_x_ptr = boundary_cast<dirichlet_boundary_3d>(x_boundary_pair.first);
     auto const &lower_x_bnd = [=](double t, double v, double r) { return lower_x_ptr->value(t, v, r); };
     d_2d::of_function(grid_23, time, lower_x_bnd, solution_yz);
-    solution(0, solution_yz);
+    // column k of solution_yz is the y-line (0,k):
+    for (std::size_t k = 0; k < solution_yz.columns(); ++k)
+    {
+        solution.column_line(0, k).copy_from(solution_yz.column(k));
+    }
 
     // populating upper X:
     auto const lri = solution.rows() - 1;
-    auto const lci = solution.columns() - 1;
     auto const lli = solution.layers() - 1;
     auto const two = 2.0;
     auto const three = 3.0;
     auto const four = 4.0;
-    auto const &upper_x_ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(x_boundary_pair.second);
+    auto const &upper_x_ptr = boundary_cast<neumann_boundary_3d>(x_boundary_pair.second);
     auto const &upper_x_bnd = [=](double t, double v, double r) {
         const std::size_t j = grid_3d::index_of_2(grid_cfg_, v);
         const std::size_t k = grid_3d::index_of_3(grid_cfg_, r);
@@ -397,11 +414,13 @@ void hhw_explicit_boundary_solver::solve(container_3d<by_enum::RowPlane> const &
         return (((four * solution(lri - 1, j, k)) - solution(lri - 2, j, k) - (two * h_1 * bnd_val)) / three);
     };
     d_2d::of_function(grid_23, time, upper_x_bnd, solution_yz);
-    solution(lri, solution_yz);
+    for (std::size_t k = 0; k <= lli; ++k)
+    {
+        solution.column_line(lri, k).copy_from(solution_yz.column(k));
+    }
 
     // populating lower Z:
-    container_3d<by_enum::LayerPlane> layer_solution(solution);
-    auto const &lower_z_ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(z_boundary_pair.first);
+    auto const &lower_z_ptr = boundary_cast<neumann_boundary_3d>(z_boundary_pair.first);
     auto const &lower_z_bnd = [=](double t, double s, double v) {
         const std::size_t i = grid_3d::index_of_1(grid_cfg_, s);
         const std::size_t j = grid_3d::index_of_2(grid_cfg_, v);
@@ -410,10 +429,14 @@ void hhw_explicit_boundary_solver::solve(container_3d<by_enum::RowPlane> const &
         return (((four * solution(i, j, 1)) - solution(i, j, 2) + (two * h_3 * bnd_val)) / three);
     };
     d_2d::of_function(grid_12, time, lower_z_bnd, solution_xy);
-    layer_solution(0, solution_xy);
+    // row i of solution_xy is the y-line (i,0):
+    for (std::size_t i = 0; i <= lri; ++i)
+    {
+        solution.column_line(i, 0).copy_from(solution_xy.row(i));
+    }
 
     // populating upper Z:
-    auto const &upper_z_ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(z_boundary_pair.second);
+    auto const &upper_z_ptr = boundary_cast<neumann_boundary_3d>(z_boundary_pair.second);
     auto const &upper_z_bnd = [=](double t, double s, double v) {
         const std::size_t i = grid_3d::index_of_1(grid_cfg_, s);
         const std::size_t j = grid_3d::index_of_2(grid_cfg_, v);
@@ -422,8 +445,10 @@ void hhw_explicit_boundary_solver::solve(container_3d<by_enum::RowPlane> const &
         return (((four * solution(i, j, lli - 1)) - solution(i, j, lli - 2) - (two * h_3 * bnd_val)) / three);
     };
     d_2d::of_function(grid_12, time, upper_z_bnd, solution_xy);
-    layer_solution(lli, solution_xy);
-    solution = layer_solution;
+    for (std::size_t i = 0; i <= lri; ++i)
+    {
+        solution.column_line(i, lli).copy_from(solution_xy.row(i));
+    }
 }
 
 } // namespace three_dimensional
@@ -5,6 +5,7 @@
 
 #include "../../../../../boundaries/lss_boundary.hpp"
 #include "../../../../../common/lss_enumerations.hpp"
+#include "../../../../../common/lss_solver_stats.hpp"
 #include "../../../../../common/lss_utility.hpp"
 #include "../../../../../containers/lss_container_3d.hpp"
 #include "../../../../../discretization/lss_grid_config.hpp"
@@ -21,6 +22,7 @@ using lss_containers::container_3d;
 using lss_enumerations::by_enum;
 using lss_grids::grid_config_3d_ptr;
 using lss_utility::container_t;
+using lss_utility::solver_stats_ptr;
 
 /**
     explicit_hhw_boundary_scheme object
@@ -50,12 +52,20 @@ class hhw_explicit_boundary_solver
   private:
     hhw_implicit_coefficients_ptr coefficients_;
     grid_config_3d_ptr grid_cfg_;
+    solver_stats_ptr stats_;
 
     explicit hhw_explicit_boundary_solver() = delete;
 
   public:
+    /**
+        @brief  hhw_explicit_boundary_solver object constructor
+        @param  coefficients - scheme coefficients
+        @param  grid_config - grid
+        @param  stats - statistics the boundary solves are recorded into (null records nothing)
+    **/
     explicit hhw_explicit_boundary_solver(hhw_implicit_coefficients_ptr const &coefficients,
-                                          grid_config_3d_ptr const &grid_config);
+                                          grid_config_3d_ptr const &grid_config,
+                                          solver_stats_ptr const &stats = nullptr);
 
     ~hhw_explicit_boundary_solver();
 
@@ -12,6 +12,7 @@
 namespace lss_pde_solvers
 {
 
+using lss_boundary::boundary_cast;
 using lss_boundary::dirichlet_boundary_2d;
 using lss_boundary::dirichlet_boundary_3d;
 using lss_boundary::neumann_boundary_2d;
@@ -55,7 +56,7 @@ void implicit_hhw_boundary_scheme::rhs(hhw_implicit_coefficients_ptr const &cfg,
     double x{}, z{}, h_1{}, h_3{};
     h_1 = grid_3d::step_1(grid_cfg);
     h_3 = grid_3d::step_3(grid_cfg);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(first_x_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_3d>(first_x_bnd))
     {
         auto fun = [&](double z) { return ptr->value(time, y, z); };
         container_t lower(L + 1, double{0.0});
@@ -67,7 +68,7 @@ void implicit_hhw_boundary_scheme::rhs(hhw_implicit_coefficients_ptr const &cfg,
         solution(0, lower);
     }
 
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(second_x_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_3d>(second_x_bnd))
     {
         x = grid_3d::value_1(grid_cfg, N);
         auto fun = [&](double z) { return two * h_1 * ptr->value(time, y, z); };
@@ -84,7 +85,7 @@ void implicit_hhw_boundary_scheme::rhs(hhw_implicit_coefficients_ptr const &cfg,
                        (gamma_2 * H(time, x, y, z) * input(N, y_index + 2, k));
         }
 
-        if (auto const &ptr_z = std::dynamic_pointer_cast<neumann_boundary_3d>(first_z_bnd))
+        if (auto const &ptr_z = boundary_cast<neumann_boundary_3d>(first_z_bnd))
         {
             z = grid_3d::value_3(grid_cfg, 0);
             auto const beta_z = two * h_3 * ptr_z->value(time, y, z);
@@ -98,7 +99,7 @@ void implicit_hhw_boundary_scheme::rhs(hhw_implicit_coefficients_ptr const &cfg,
                        (gamma_2 * H(time, x, y, z) * input(N, y_index + 2, 0));
         }
 
-        if (auto const &ptr_z = std::dynamic_pointer_cast<neumann_boundary_3d>(second_z_bnd))
+        if (auto const &ptr_z = boundary_cast<neumann_boundary_3d>(second_z_bnd))
         {
             z = grid_3d::value_3(grid_cfg, L);
             auto const beta_z = two * h_3 * ptr_z->value(time, y, z);
@@ -115,7 +116,7 @@ void implicit_hhw_boundary_scheme::rhs(hhw_implicit_coefficients_ptr const &cfg,
     }
 
     double val{};
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(first_z_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_3d>(first_z_bnd))
     {
         z = grid_3d::value_3(grid_cfg, 0);
         auto fun = [&](double x) { return two * h_3 * ptr->value(time, x, y); };
@@ -134,7 +135,7 @@ void implicit_hhw_boundary_scheme::rhs(hhw_implicit_coefficients_ptr const &cfg,
         }
     }
 
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(second_z_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_3d>(second_z_bnd))
     {
         z = grid_3d::value_3(grid_cfg, L);
         auto fun = [&](double x) { return two * h_3 * ptr->value(time, x, y); };
@@ -208,7 +209,7 @@ void implicit_hhw_boundary_scheme::rhs_source(hhw_implicit_coefficients_ptr cons
     double x{}, z{}, h_1{}, h_3{};
     h_1 = grid_3d::step_1(grid_cfg);
     h_3 = grid_3d::step_3(grid_cfg);
-    if (auto const &ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(first_x_bnd))
+    if (auto const &ptr = boundary_cast<dirichlet_boundary_3d>(first_x_bnd))
     {
         auto fun = [&](double z) { return ptr->value(time, y, z); };
         container_t lower(L, double{0.0});
@@ -219,7 +220,7 @@ void implicit_hhw_boundary_scheme::rhs_source(hhw_implicit_coefficients_ptr cons
         }
         solution(0, lower);
     }
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(second_x_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_3d>(second_x_bnd))
     {
         x = grid_3d::value_1(grid_cfg, N);
         auto fun = [&](double z) { return two * h_1 * ptr->value(time, y, z); };
@@ -236,7 +237,7 @@ void implicit_hhw_boundary_scheme::rhs_source(hhw_implicit_coefficients_ptr cons
                        (gamma_2 * H(time, x, y, z) * input(N, y_index + 2, k)) + rho * inhom_input(N, y_index, k);
         }
 
-        if (auto const &ptr_z = std::dynamic_pointer_cast<neumann_boundary_3d>(first_z_bnd))
+        if (auto const &ptr_z = boundary_cast<neumann_boundary_3d>(first_z_bnd))
         {
             z = grid_3d::value_3(grid_cfg, 0);
             auto const beta_z = two * h_3 * ptr_z->value(time, y, z);
@@ -250,7 +251,7 @@ void implicit_hhw_boundary_scheme::rhs_source(hhw_implicit_coefficients_ptr cons
                        (gamma_2 * H(time, x, y, z) * input(N, y_index + 2, 0)) + rho * inhom_input(N, y_index, 0);
         }
 
-        if (auto const &ptr_z = std::dynamic_pointer_cast<neumann_boundary_3d>(second_z_bnd))
+        if (auto const &ptr_z = boundary_cast<neumann_boundary_3d>(second_z_bnd))
         {
             z = grid_3d::value_3(grid_cfg, L);
             auto const beta_z = two * h_3 * ptr_z->value(time, y, z);
@@ -267,7 +268,7 @@ void implicit_hhw_boundary_scheme::rhs_source(hhw_implicit_coefficients_ptr cons
     }
 
     double val{};
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(first_z_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_3d>(first_z_bnd))
     {
         z = grid_3d::value_3(grid_cfg, 0);
         auto fun = [&](double x) { return two * h_3 * ptr->value(time, x, y); };
@@ -286,7 +287,7 @@ void implicit_hhw_boundary_scheme::rhs_source(hhw_implicit_coefficients_ptr cons
         }
     }
 
-    if (auto const &ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(second_z_bnd))
+    if (auto const &ptr = boundary_cast<neumann_boundary_3d>(second_z_bnd))
     {
         z = grid_3d::value_3(grid_cfg, L);
         auto fun = [&](double x) { return two * h_3 * ptr->value(time, x, y); };
@@ -355,7 +356,6 @@ void hhw_implicit_boundary_solver::solve(container_3d<by_enum::RowPlane> const &
                                          boundary_3d_pair const &z_boundary_pair, double const &time,
                                          container_3d<by_enum::RowPlane> &solution)
 {
-    container_3d<by_enum::ColumnPlane> cpsolution(solution);
     // 2D container for intermediate solution:
     container_2d<by_enum::Row> solution_p(coefficients_->space_size_x_, coefficients_->space_size_z_, double{});
     /// get the right-hand side of the scheme:
@@ -368,15 +368,17 @@ void hhw_implicit_boundary_solver::solve(container_3d<by_enum::RowPlane> const &
     low_.resize(coefficients_->space_size_z_);
     diag_.resize(coefficients_->space_size_z_);
     high_.resize(coefficients_->space_size_z_);
+    rhs_.resize(coefficients_->space_size_z_);
     double x{};
     for (std::size_t i = 1; i < coefficients_->space_size_x_ - 1; ++i)
     {
         x = grid_3d::value_1(grid_cfg_, i);
         split(x, y, time, low_, diag_, high_);
         solveru_ptr_->set_diagonals(low_, diag_, high_);
-        solveru_ptr_->set_rhs(solution_p.at(i));
+        solution_p.row(i).copy_to(rhs_);
+        solveru_ptr_->set_rhs(rhs_);
         solveru_ptr_->solve(z_boundary_pair, solution_v, time, x, y);
-        solution_p(i, solution_v);
+        solution_p.row(i).copy_from(solution_v);
     }
     // std::cout << "solution_p Y = 0:\n";
     // for (std::size_t j = 0; j < solution_p.rows(); ++j)
@@ -388,15 +390,21 @@ void hhw_implicit_boundary_solver::solve(container_3d<by_enum::RowPlane> const &
     //     std::cout << "\n";
     // }
 
-    // boundary plane at Y = 0:
-    cpsolution(0, solution_p);
-    auto const &upper_bnd_ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(y_upper_boundary_ptr);
+    // boundary plane at Y = 0, row i of solution_p is the z-line (i,0):
+    for (std::size_t i = 0; i < solution_p.rows(); ++i)
+    {
+        solution.layer_line(i, 0).copy_from(solution_p.row(i));
+    }
+    auto const &upper_bnd_ptr = boundary_cast<dirichlet_boundary_3d>(y_upper_boundary_ptr);
     auto const &upper_bnd = [=](double t, double s, double r) { return upper_bnd_ptr->value(t, s, r); };
     d_2d::of_function(grid_cfg_->grid_13(), time, upper_bnd, solution_p);
 
     // boundary plane at Y = M-1:
-    cpsolution(coefficients_->space_size_y_ - 1, solution_p);
-    solution = cpsolution;
+    auto const lci = coefficients_->space_size_y_ - 1;
+    for (std::size_t i = 0; i < solution_p.rows(); ++i)
+    {
+        solution.layer_line(i, lci).copy_from(solution_p.row(i));
+    }
 }
 
 void hhw_implicit_boundary_solver::solve(container_3d<by_enum::RowPlane> const &prev_solution,
@@ -414,7 +422,7 @@ void hhw_implicit_boundary_solver::solve(container_3d<by_enum::RowPlane> const &
     // prepare grid_zy:
     auto const &grid_23 = grid_cfg_->grid_23();
     /// populating lower X:
-    auto const &lower_x_ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(x_boundary_pair.first);
+    auto const &lower_x_ptr = boundary_cast<dirichlet_boundary_3d>(x_boundary_pair.first);
     auto const &lower_x_bnd = [=](double t, double v, double r) { return lower_x_ptr->value(t, v, r); };
     d_2d::of_function(grid_23, time, lower_x_bnd, solution_yz);
 
@@ -428,15 +436,18 @@ void hhw_implicit_boundary_solver::solve(container_3d<by_enum::RowPlane> const &
     //     std::cout << "\n";
     // }
 
-    solution(0, solution_yz);
+    // column k of solution_yz is the y-line (0,k):
+    for (std::size_t k = 0; k < solution_yz.columns(); ++k)
+    {
+        solution.column_line(0, k).copy_from(solution_yz.column(k));
+    }
     // populating upper X:
     auto const lri = solution.rows() - 1;
-    auto const lci = solution.columns() - 1;
     auto const lli = solution.layers() - 1;
     auto const two = 2.0;
     auto const three = 3.0;
     auto const four = 4.0;
-    auto const &upper_x_ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(x_boundary_pair.second);
+    auto const &upper_x_ptr = boundary_cast<neumann_boundary_3d>(x_boundary_pair.second);
     auto const &upper_x_bnd = [=](double t, double v, double r) {
         const std::size_t j = grid_3d::index_of_2(grid_cfg_, v);
         const std::size_t k = grid_3d::index_of_3(grid_cfg_, r);
@@ -454,9 +465,12 @@ void hhw_implicit_boundary_solver::solve(container_3d<by_enum::RowPlane> const &
     //     }
     //     std::cout << "\n";
     // }
-    solution(lri, solution_yz);
+    for (std::size_t k = 0; k <= lli; ++k)
+    {
+        solution.column_line(lri, k).copy_from(solution_yz.column(k));
+    }
     // populating lower Z:
-    auto const &lower_z_ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(z_boundary_pair.first);
+    auto const &lower_z_ptr = boundary_cast<neumann_boundary_3d>(z_boundary_pair.first);
     auto const &lower_z_bnd = [=](double t, double s, double v) {
         const std::size_t i = grid_3d::index_of_1(grid_cfg_, s);
         const std::size_t j = grid_3d::index_of_2(grid_cfg_, v);
@@ -474,16 +488,14 @@ void hhw_implicit_boundary_solver::solve(container_3d<by_enum::RowPlane> const &
     //     }
     //     std::cout << "\n";
     // }
+    // row i of solution_xy is the y-line (i,0):
     for (std::size_t i = 0; i <= lri; ++i)
     {
-        for (std::size_t j = 0; j <= lci; ++j)
-        {
-            solution(i, j, 0, solution_xy(i, j));
-        }
+        solution.column_line(i, 0).copy_from(solution_xy.row(i));
     }
 
     // populating upper Z:
-    auto const &upper_z_ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(z_boundary_pair.second);
+    auto const &upper_z_ptr = boundary_cast<neumann_boundary_3d>(z_boundary_pair.second);
     auto const &upper_z_bnd = [=](double t, double s, double v) {
         const std::size_t i = grid_3d::index_of_1(grid_cfg_, s);
         const std::size_t j = grid_3d::index_of_2(grid_cfg_, v);
@@ -503,10 +515,7 @@ void hhw_implicit_boundary_solver::solve(container_3d<by_enum::RowPlane> const &
     // }
     for (std::size_t i = 0; i <= lri; ++i)
     {
-        for (std::size_t j = 0; j <= lci; ++j)
-        {
-            solution(i, j, lli, solution_xy(i, j));
-        }
+        solution.column_line(i, lli).copy_from(solution_xy.row(i));
     }
 }
 
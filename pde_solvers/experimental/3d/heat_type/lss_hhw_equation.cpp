@@ -13,8 +13,11 @@ namespace lss_pde_solvers
 
 using lss_boundary::dirichlet_boundary_3d;
 using lss_boundary::neumann_boundary_3d;
+using lss_enumerations::solver_phase_enum;
 using lss_grids::grid_config_3d;
 using lss_grids::grid_transform_config_3d;
+using lss_utility::make_thread_pool;
+using lss_utility::solver_stats;
 
 namespace three_dimensional
 {
@@ -79,19 +82,29 @@ hhw_equation::hhw_equation(heat_data_config_3d_ptr const &heat_data_config,
                            splitting_method_config_ptr const &splitting_method_config,
                            grid_config_hints_3d_ptr const &grid_config_hints,
                            heat_implicit_solver_config_ptr const &solver_config,
-                           std::map<std::string, double> const &solver_config_details)
+                           std::map<std::string, double> const &solver_config_details,
+                           execution_policy_ptr const &execution_policy)
     : discretization_cfg_{discretization_config}, splitting_method_cfg_{splitting_method_config},
       solver_cfg_{solver_config}, solver_config_details_{solver_config_details}
 {
     initialize(heat_data_config, grid_config_hints, x_boundary_pair, y_upper_boundary_ptr, z_boundary_pair);
+    // line sweeps of every solve run on the shared pool, or on a private one sized by the splitting config:
+    thread_pool_ = make_thread_pool(execution_policy, splitting_method_cfg_->number_of_threads());
+    stats_ = std::make_shared<solver_stats>();
 }
 
 hhw_equation ::~hhw_equation()
 {
 }
 
+solver_stats_ptr const &hhw_equation::stats() const
+{
+    return stats_;
+}
+
 void hhw_equation::solve(container_3d<by_enum::RowPlane> &solution)
 {
+    LSS_STATS_PHASE(stats_, solver_phase_enum::Total);
     LSS_ASSERT((solution.rows()) > 0 && (solution.columns() > 0) && (solution.layers() > 0),
                "The input solution container must be initialized");
 
@@ -136,7 +149,8 @@ void hhw_equation::solve(container_3d<by_enum::RowPlane> &solution)
                 dev_cu_solver;
 
             dev_cu_solver solver(x_boundary_pair_ptr, y_boundary_ptr, z_boundary_pair_ptr, heat_data_trans_cfg_,
-                                 discretization_cfg_, splitting_method_cfg_, solver_cfg_, grid_cfg);
+                                 discretization_cfg_, splitting_method_cfg_, solver_cfg_, grid_cfg, thread_pool_,
+                                 stats_);
             solver(prev_sol, next_sol, is_heat_source_set, heat_source);
             solution = prev_sol;
         }
@@ -148,7 +162,8 @@ void hhw_equation::solve(container_3d<by_enum::RowPlane> &solution)
             LSS_ASSERT(!solver_config_details_.empty(), "solver_config_details map must not be empty");
             double omega_value = solver_config_details_["sor_omega"];
             dev_sor_solver solver(x_boundary_pair_ptr, y_boundary_ptr, z_boundary_pair_ptr, heat_data_trans_cfg_,
-                                  discretization_cfg_, splitting_method_cfg_, solver_cfg_, grid_cfg);
+                                  discretization_cfg_, splitting_method_cfg_, solver_cfg_, grid_cfg, thread_pool_,
+                                  stats_);
             solver(prev_sol, next_sol, is_heat_source_set, heat_source, omega_value);
             solution = prev_sol;
         }
@@ -165,7 +180,8 @@ void hhw_equation::solve(container_3d<by_enum::RowPlane> &solution)
                 host_cu_solver;
 
             host_cu_solver solver(x_boundary_pair_ptr, y_boundary_ptr, z_boundary_pair_ptr, heat_data_trans_cfg_,
-                                  discretization_cfg_, splitting_method_cfg_, solver_cfg_, grid_cfg);
+                                  discretization_cfg_, splitting_method_cfg_, solver_cfg_, grid_cfg, thread_pool_,
+                                  stats_);
             solver(prev_sol, next_sol, is_heat_source_set, heat_source);
             solution = next_sol;
         }
@@ -177,7 +193,8 @@ void hhw_equation::solve(container_3d<by_enum::RowPlane> &solution)
             LSS_ASSERT(!solver_config_details_.empty(), "solver_config_details map must not be empty");
             double omega_value = solver_config_details_["sor_omega"];
             host_sor_solver solver(x_boundary_pair_ptr, y_boundary_ptr, z_boundary_pair_ptr, heat_data_trans_cfg_,
-                                   discretization_cfg_, splitting_method_cfg_, solver_cfg_, grid_cfg);
+                                   discretization_cfg_, splitting_method_cfg_, solver_cfg_, grid_cfg, thread_pool_,
+                                   stats_);
             solver(prev_sol, next_sol, is_heat_source_set, heat_source, omega_value);
             solution = next_sol;
         }
@@ -186,7 +203,8 @@ void hhw_equation::solve(container_3d<by_enum::RowPlane> &solution)
             typedef hhw_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::DoubleSweepSolver>
                 host_dss_solver;
             host_dss_solver solver(x_boundary_pair_ptr, y_boundary_ptr, z_boundary_pair_ptr, heat_data_trans_cfg_,
-                                   discretization_cfg_, splitting_method_cfg_, solver_cfg_, grid_cfg);
+                                   discretization_cfg_, splitting_method_cfg_, solver_cfg_, grid_cfg, thread_pool_,
+                                   stats_);
             solver(prev_sol, next_sol, is_heat_source_set, heat_source);
             solution = next_sol;
         }
@@ -195,7 +213,8 @@ void hhw_equation::solve(container_3d<by_enum::RowPlane> &solution)
             typedef hhw_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::ThomasLUSolver>
                 host_lus_solver;
             host_lus_solver solver(x_boundary_pair_ptr, y_boundary_ptr, z_boundary_pair_ptr, heat_data_trans_cfg_,
-                                   discretization_cfg_, splitting_method_cfg_, solver_cfg_, grid_cfg);
+                                   discretization_cfg_, splitting_method_cfg_, solver_cfg_, grid_cfg, thread_pool_,
+                                   stats_);
             solver(prev_sol, next_sol, is_heat_source_set, heat_source);
             solution = next_sol;
         }
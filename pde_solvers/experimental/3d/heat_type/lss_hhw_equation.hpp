@@ -6,7 +6,9 @@
 
 #include "../../../../boundaries/lss_boundary.hpp"
 #include "../../../../common/lss_enumerations.hpp"
+#include "../../../../common/lss_execution_policy.hpp"
 #include "../../../../common/lss_macros.hpp"
+#include "../../../../common/lss_solver_stats.hpp"
 #include "../../../../containers/lss_container_2d.hpp"
 #include "../../../../containers/lss_container_3d.hpp"
 #include "../../../../discretization/lss_discretization.hpp"
@@ -32,6 +34,9 @@ using lss_enumerations::by_enum;
 using lss_enumerations::grid_enum;
 using lss_grids::grid_config_hints_3d_ptr;
 using lss_grids::grid_transform_config_3d_ptr;
+using lss_utility::execution_policy_ptr;
+using lss_utility::solver_stats_ptr;
+using lss_utility::thread_pool_ptr;
 
 using d_3d = discretization_3d<std::vector, std::allocator<double>>;
 
@@ -87,6 +92,8 @@ class hhw_equation
     grid_transform_config_3d_ptr grid_trans_cfg_; // this may be removed as it is not used later
     heat_implicit_solver_config_ptr solver_cfg_;
     std::map<std::string, double> solver_config_details_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
     explicit hhw_equation() = delete;
 
@@ -103,7 +110,8 @@ class hhw_equation
                           grid_config_hints_3d_ptr const &grid_config_hints,
                           heat_implicit_solver_config_ptr const &solver_config =
                               default_heat_solver_configs::host_fwd_dssolver_euler_solver_config_ptr,
-                          std::map<std::string, double> const &solver_config_details = std::map<std::string, double>());
+                          std::map<std::string, double> const &solver_config_details = std::map<std::string, double>(),
+                          execution_policy_ptr const &execution_policy = nullptr);
 
     ~hhw_equation();
 
@@ -125,6 +133,12 @@ class hhw_equation
      * \param solutions - 3D container for all the solutions in time
      */
     // void solve(container_3d<by_enum::Row> &solutions);
+
+    /**
+     * Get statistics accumulated over all solves, they are recorded only when
+     * built with LSS_SOLVER_STATS and may be cleared with reset()
+     */
+    LSS_API solver_stats_ptr const &stats() const;
 };
 
 } // namespace implicit_solvers
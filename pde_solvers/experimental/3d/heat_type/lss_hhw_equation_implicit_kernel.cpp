@@ -7,10 +7,10 @@
 #include "../../../../sparse_solvers/tridiagonal/thomas_lu_solver/lss_thomas_lu_solver.hpp"
 #include "boundary_solver/lss_hhw_explicit_boundary_solver.hpp"
 #include "implicit_coefficients/lss_hhw_implicit_coefficients.hpp"
-//#include "splitting_method/lss_heat_craig_sneyd_method_3d.hpp"
+#include "splitting_method/lss_heat_craig_sneyd_method_3d.hpp"
 #include "splitting_method/lss_heat_douglas_rachford_method_3d.hpp"
-//#include "splitting_method/lss_heat_hundsdorfer_verwer_method_3d.hpp"
-//#include "splitting_method/lss_heat_modified_craig_sneyd_method_3d.hpp"
+#include "splitting_method/lss_heat_hundsdorfer_verwer_method_3d.hpp"
+#include "splitting_method/lss_heat_modified_craig_sneyd_method_3d.hpp"
 #include "splitting_method/lss_heat_splitting_method_3d.hpp"
 #include "time_loop/lss_hhw_implicit_time_loop.hpp"
 
@@ -35,10 +35,11 @@ hhw_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum:
                                  pde_discretization_config_3d_ptr const &discretization_config,
                                  splitting_method_config_ptr const &splitting_config,
                                  heat_implicit_solver_config_ptr const &solver_config,
-                                 grid_config_3d_ptr const &grid_config)
+                                 grid_config_3d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                 solver_stats_ptr const &stats)
     : boundary_pair_x_{x_boundary_pair}, boundary_y_{y_upper_boundary_ptr}, boundary_pair_z_{z_boundary_pair},
       heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config}, splitting_cfg_{splitting_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, thread_pool_{thread_pool}, stats_{stats}
 {
 }
 
@@ -64,40 +65,55 @@ void hhw_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_
     auto const heston_coeff_holder = std::make_shared<hhw_implicit_coefficients>(
         heat_data_cfg_, discretization_cfg_, splitting_cfg_, solver_cfg_->implicit_pde_scheme_value());
     heat_splitting_method_3d_ptr splitting_ptr;
-    auto solver_y1 = std::make_shared<cuda_solver<memory_space_enum::Device>>(space_size_x);
-    solver_y1->set_factorization(solver_cfg_->tridiagonal_factorization());
-    auto solver_y2 = std::make_shared<cuda_solver<memory_space_enum::Device>>(space_size_y);
-    solver_y2->set_factorization(solver_cfg_->tridiagonal_factorization());
-    auto solver_u = std::make_shared<cuda_solver<memory_space_enum::Device>>(space_size_z);
-    solver_u->set_factorization(solver_cfg_->tridiagonal_factorization());
+    // one triplet of solvers per worker sweeping the lines:
+    const std::size_t number_of_threads = thread_pool_->size();
+    tridiagonal_solver_ptrs solvers_y1;
+    tridiagonal_solver_ptrs solvers_y2;
+    tridiagonal_solver_ptrs solvers_u;
+    for (std::size_t t = 0; t < number_of_threads; ++t)
+    {
+        auto solver_y1 = std::make_shared<cuda_solver<memory_space_enum::Device>>(space_size_x);
+        solver_y1->set_factorization(solver_cfg_->tridiagonal_factorization());
+        solvers_y1.emplace_back(solver_y1);
+        auto solver_y2 = std::make_shared<cuda_solver<memory_space_enum::Device>>(space_size_y);
+        solver_y2->set_factorization(solver_cfg_->tridiagonal_factorization());
+        solvers_y2.emplace_back(solver_y2);
+        auto solver_u = std::make_shared<cuda_solver<memory_space_enum::Device>>(space_size_z);
+        solver_u->set_factorization(solver_cfg_->tridiagonal_factorization());
+        solvers_u.emplace_back(solver_u);
+    }
     // splitting method:
     if (splitting_cfg_->splitting_method() == splitting_method_enum::DouglasRachford)
     {
         // create and set up the main solvers:
         splitting_ptr = std::make_shared<heat_douglas_rachford_method_3d>(
-            solver_y1, solver_y2, solver_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set);
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::CraigSneyd)
     {
-        // splitting_ptr = std::make_shared<heat_craig_sneyd_method_3d>(solver_y1,solver_y2, solver_u,
-        // heston_coeff_holder, grid_cfg_,is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_craig_sneyd_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::ModifiedCraigSneyd)
     {
-        // splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method_3d>(solver_y1,solver_y2, solver_u,
-        // heston_coeff_holder,grid_cfg_, is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::HundsdorferVerwer)
     {
-        // splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method_3d>(solver_y1,solver_y2, solver_u,
-        // heston_coeff_holder,grid_cfg_, is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else
     {
         throw std::exception("Unreachable");
     }
     // create and set up lower volatility boundary solver:
-    auto boundary_solver = std::make_shared<hhw_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_);
+    auto boundary_solver = std::make_shared<hhw_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_, stats_);
     // auto boundary_solver = std::make_shared<hhw_implicit_boundary_solver>(solver_u, heston_coeff_holder, grid_cfg_);
 
     if (is_heat_sourse_set)
@@ -116,7 +132,8 @@ void hhw_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_
     else
     {
         hhw_implicit_time_loop::run(splitting_ptr, boundary_solver, boundary_pair_x_, boundary_y_, boundary_pair_z_,
-                                    grid_cfg_, time, last_time_idx, k, traverse_dir, prev_solution, next_solution);
+                                    grid_cfg_, time, last_time_idx, k, traverse_dir, prev_solution, next_solution,
+                                    stats_);
     }
 }
 
@@ -127,10 +144,11 @@ hhw_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_enum:
                                  pde_discretization_config_3d_ptr const &discretization_config,
                                  splitting_method_config_ptr const &splitting_config,
                                  heat_implicit_solver_config_ptr const &solver_config,
-                                 grid_config_3d_ptr const &grid_config)
+                                 grid_config_3d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                 solver_stats_ptr const &stats)
     : boundary_pair_x_{x_boundary_pair}, boundary_y_{y_upper_boundary_ptr}, boundary_pair_z_{z_boundary_pair},
       heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config}, splitting_cfg_{splitting_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, thread_pool_{thread_pool}, stats_{stats}
 {
 }
 
@@ -157,40 +175,55 @@ void hhw_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_
     auto const heston_coeff_holder = std::make_shared<hhw_implicit_coefficients>(
         heat_data_cfg_, discretization_cfg_, splitting_cfg_, solver_cfg_->implicit_pde_scheme_value());
     heat_splitting_method_3d_ptr splitting_ptr;
-    auto solver_y1 = std::make_shared<sor_solver_cuda>(space_size_x);
-    solver_y1->set_omega(omega_value);
-    auto solver_y2 = std::make_shared<sor_solver_cuda>(space_size_y);
-    solver_y2->set_omega(omega_value);
-    auto solver_u = std::make_shared<sor_solver_cuda>(space_size_z);
-    solver_u->set_omega(omega_value);
+    // one triplet of solvers per worker sweeping the lines:
+    const std::size_t number_of_threads = thread_pool_->size();
+    tridiagonal_solver_ptrs solvers_y1;
+    tridiagonal_solver_ptrs solvers_y2;
+    tridiagonal_solver_ptrs solvers_u;
+    for (std::size_t t = 0; t < number_of_threads; ++t)
+    {
+        auto solver_y1 = std::make_shared<sor_solver_cuda>(space_size_x);
+        solver_y1->set_omega(omega_value);
+        solvers_y1.emplace_back(solver_y1);
+        auto solver_y2 = std::make_shared<sor_solver_cuda>(space_size_y);
+        solver_y2->set_omega(omega_value);
+        solvers_y2.emplace_back(solver_y2);
+        auto solver_u = std::make_shared<sor_solver_cuda>(space_size_z);
+        solver_u->set_omega(omega_value);
+        solvers_u.emplace_back(solver_u);
+    }
     // splitting method:
     if (splitting_cfg_->splitting_method() == splitting_method_enum::DouglasRachford)
     {
         // create and set up the main solvers:
         splitting_ptr = std::make_shared<heat_douglas_rachford_method_3d>(
-            solver_y1, solver_y2, solver_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set);
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::CraigSneyd)
     {
-        // splitting_ptr = std::make_shared<heat_craig_sneyd_method_3d>(solver_y1,solver_y2, solver_u,
-        // heston_coeff_holder, grid_cfg_,is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_craig_sneyd_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::ModifiedCraigSneyd)
     {
-        // splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method_3d>(solver_y1,solver_y2, solver_u,
-        // heston_coeff_holder,grid_cfg_, is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::HundsdorferVerwer)
     {
-        // splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method_3d>(solver_y1,solver_y2, solver_u,
-        // heston_coeff_holder, grid_cfg_, is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else
     {
         throw std::exception("Unreachable");
     }
     // create and set up lower volatility boundary solver:
-    auto boundary_solver = std::make_shared<hhw_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_);
+    auto boundary_solver = std::make_shared<hhw_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_, stats_);
     // auto boundary_solver = std::make_shared<hhw_implicit_boundary_solver>(solver_u, heston_coeff_holder, grid_cfg_);
 
     if (is_heat_sourse_set)
@@ -209,7 +242,8 @@ void hhw_equation_implicit_kernel<memory_space_enum::Device, tridiagonal_method_
     else
     {
         hhw_implicit_time_loop::run(splitting_ptr, boundary_solver, boundary_pair_x_, boundary_y_, boundary_pair_z_,
-                                    grid_cfg_, time, last_time_idx, k, traverse_dir, prev_solution, next_solution);
+                                    grid_cfg_, time, last_time_idx, k, traverse_dir, prev_solution, next_solution,
+                                    stats_);
     }
 }
 
@@ -220,10 +254,11 @@ hhw_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::C
                                  pde_discretization_config_3d_ptr const &discretization_config,
                                  splitting_method_config_ptr const &splitting_config,
                                  heat_implicit_solver_config_ptr const &solver_config,
-                                 grid_config_3d_ptr const &grid_config)
+                                 grid_config_3d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                 solver_stats_ptr const &stats)
     : boundary_pair_x_{x_boundary_pair}, boundary_y_{y_upper_boundary_ptr}, boundary_pair_z_{z_boundary_pair},
       heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config}, splitting_cfg_{splitting_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, thread_pool_{thread_pool}, stats_{stats}
 {
 }
 
@@ -248,40 +283,55 @@ void hhw_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_en
     auto const heston_coeff_holder = std::make_shared<hhw_implicit_coefficients>(
         heat_data_cfg_, discretization_cfg_, splitting_cfg_, solver_cfg_->implicit_pde_scheme_value());
     heat_splitting_method_3d_ptr splitting_ptr;
-    auto solver_y1 = std::make_shared<cuda_solver<memory_space_enum::Host>>(space_size_x);
-    solver_y1->set_factorization(solver_cfg_->tridiagonal_factorization());
-    auto solver_y2 = std::make_shared<cuda_solver<memory_space_enum::Host>>(space_size_y);
-    solver_y2->set_factorization(solver_cfg_->tridiagonal_factorization());
-    auto solver_u = std::make_shared<cuda_solver<memory_space_enum::Host>>(space_size_z);
-    solver_u->set_factorization(solver_cfg_->tridiagonal_factorization());
+    // one triplet of solvers per worker sweeping the lines:
+    const std::size_t number_of_threads = thread_pool_->size();
+    tridiagonal_solver_ptrs solvers_y1;
+    tridiagonal_solver_ptrs solvers_y2;
+    tridiagonal_solver_ptrs solvers_u;
+    for (std::size_t t = 0; t < number_of_threads; ++t)
+    {
+        auto solver_y1 = std::make_shared<cuda_solver<memory_space_enum::Host>>(space_size_x);
+        solver_y1->set_factorization(solver_cfg_->tridiagonal_factorization());
+        solvers_y1.emplace_back(solver_y1);
+        auto solver_y2 = std::make_shared<cuda_solver<memory_space_enum::Host>>(space_size_y);
+        solver_y2->set_factorization(solver_cfg_->tridiagonal_factorization());
+        solvers_y2.emplace_back(solver_y2);
+        auto solver_u = std::make_shared<cuda_solver<memory_space_enum::Host>>(space_size_z);
+        solver_u->set_factorization(solver_cfg_->tridiagonal_factorization());
+        solvers_u.emplace_back(solver_u);
+    }
     // splitting method:
     if (splitting_cfg_->splitting_method() == splitting_method_enum::DouglasRachford)
     {
         // create and set up the main solvers:
         splitting_ptr = std::make_shared<heat_douglas_rachford_method_3d>(
-            solver_y1, solver_y2, solver_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set);
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::CraigSneyd)
     {
-        // splitting_ptr = std::make_shared<heat_craig_sneyd_method_3d>(solver_y1,solver_y2, solver_u,
-        // heston_coeff_holder, grid_cfg_, is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_craig_sneyd_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::ModifiedCraigSneyd)
     {
-        // splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method_3d>(solver_y1,solver_y2, solver_u,
-        // heston_coeff_holder,grid_cfg_, is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::HundsdorferVerwer)
     {
-        // splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method_3d>(solver_y1,solver_y2, solver_u,
-        // heston_coeff_holder,grid_cfg_, is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else
     {
         throw std::exception("Unreachable");
     }
     // create and set up lower volatility boundary solver:
-    auto boundary_solver = std::make_shared<hhw_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_);
+    auto boundary_solver = std::make_shared<hhw_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_, stats_);
     // auto boundary_solver = std::make_shared<hhw_implicit_boundary_solver>(solver_u, heston_coeff_holder, grid_cfg_);
 
     if (is_heat_sourse_set)
@@ -300,7 +350,8 @@ void hhw_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_en
     else
     {
         hhw_implicit_time_loop::run(splitting_ptr, boundary_solver, boundary_pair_x_, boundary_y_, boundary_pair_z_,
-                                    grid_cfg_, time, last_time_idx, k, traverse_dir, prev_solution, next_solution);
+                                    grid_cfg_, time, last_time_idx, k, traverse_dir, prev_solution, next_solution,
+                                    stats_);
     }
 }
 
@@ -308,10 +359,11 @@ hhw_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::S
     boundary_3d_pair const &x_boundary_pair, boundary_3d_ptr const &y_upper_boundary_ptr,
     boundary_3d_pair const &z_boundary_pair, heat_data_transform_3d_ptr const &heat_data_config,
     pde_discretization_config_3d_ptr const &discretization_config, splitting_method_config_ptr const &splitting_config,
-    heat_implicit_solver_config_ptr const &solver_config, grid_config_3d_ptr const &grid_config)
+    heat_implicit_solver_config_ptr const &solver_config, grid_config_3d_ptr const &grid_config,
+    thread_pool_ptr const &thread_pool, solver_stats_ptr const &stats)
     : boundary_pair_x_{x_boundary_pair}, boundary_y_{y_upper_boundary_ptr}, boundary_pair_z_{z_boundary_pair},
       heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config}, splitting_cfg_{splitting_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, thread_pool_{thread_pool}, stats_{stats}
 {
 }
 
@@ -338,40 +390,55 @@ void hhw_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_en
     auto const heston_coeff_holder = std::make_shared<hhw_implicit_coefficients>(
         heat_data_cfg_, discretization_cfg_, splitting_cfg_, solver_cfg_->implicit_pde_scheme_value());
     heat_splitting_method_3d_ptr splitting_ptr;
-    auto solver_y1 = std::make_shared<sor_solver>(space_size_x);
-    solver_y1->set_omega(omega_value);
-    auto solver_y2 = std::make_shared<sor_solver>(space_size_y);
-    solver_y2->set_omega(omega_value);
-    auto solver_u = std::make_shared<sor_solver>(space_size_z);
-    solver_u->set_omega(omega_value);
+    // one triplet of solvers per worker sweeping the lines:
+    const std::size_t number_of_threads = thread_pool_->size();
+    tridiagonal_solver_ptrs solvers_y1;
+    tridiagonal_solver_ptrs solvers_y2;
+    tridiagonal_solver_ptrs solvers_u;
+    for (std::size_t t = 0; t < number_of_threads; ++t)
+    {
+        auto solver_y1 = std::make_shared<sor_solver>(space_size_x);
+        solver_y1->set_omega(omega_value);
+        solvers_y1.emplace_back(solver_y1);
+        auto solver_y2 = std::make_shared<sor_solver>(space_size_y);
+        solver_y2->set_omega(omega_value);
+        solvers_y2.emplace_back(solver_y2);
+        auto solver_u = std::make_shared<sor_solver>(space_size_z);
+        solver_u->set_omega(omega_value);
+        solvers_u.emplace_back(solver_u);
+    }
     // splitting method:
     if (splitting_cfg_->splitting_method() == splitting_method_enum::DouglasRachford)
     {
         // create and set up the main solvers:
         splitting_ptr = std::make_shared<heat_douglas_rachford_method_3d>(
-            solver_y1, solver_y2, solver_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set);
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::CraigSneyd)
     {
-        // splitting_ptr = std::make_shared<heat_craig_sneyd_method_3d>(solver_y1,solver_y2, solver_u,
-        // heston_coeff_holder, grid_cfg_,is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_craig_sneyd_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::ModifiedCraigSneyd)
     {
-        // splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method_3d>(solver_y1,solver_y2, solver_u,
-        // heston_coeff_holder,grid_cfg_, is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::HundsdorferVerwer)
     {
-        // splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method_3d>(solver_y1,solver_y2, solver_u,
-        // heston_coeff_holder,grid_cfg_, is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else
     {
         throw std::exception("Unreachable");
     }
     // create and set up lower volatility boundary solver:
-    auto boundary_solver = std::make_shared<hhw_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_);
+    auto boundary_solver = std::make_shared<hhw_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_, stats_);
     // auto boundary_solver = std::make_shared<hhw_implicit_boundary_solver>(solver_u, heston_coeff_holder, grid_cfg_);
 
     if (is_heat_sourse_set)
@@ -390,7 +457,8 @@ void hhw_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_en
     else
     {
         hhw_implicit_time_loop::run(splitting_ptr, boundary_solver, boundary_pair_x_, boundary_y_, boundary_pair_z_,
-                                    grid_cfg_, time, last_time_idx, k, traverse_dir, prev_solution, next_solution);
+                                    grid_cfg_, time, last_time_idx, k, traverse_dir, prev_solution, next_solution,
+                                    stats_);
     }
 }
 
@@ -401,10 +469,11 @@ hhw_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::D
                                  pde_discretization_config_3d_ptr const &discretization_config,
                                  splitting_method_config_ptr const &splitting_config,
                                  heat_implicit_solver_config_ptr const &solver_config,
-                                 grid_config_3d_ptr const &grid_config)
+                                 grid_config_3d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                 solver_stats_ptr const &stats)
     : boundary_pair_x_{x_boundary_pair}, boundary_y_{y_upper_boundary_ptr}, boundary_pair_z_{z_boundary_pair},
       heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config}, splitting_cfg_{splitting_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, thread_pool_{thread_pool}, stats_{stats}
 {
 }
 
@@ -430,36 +499,51 @@ void hhw_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_en
         heat_data_cfg_, discretization_cfg_, splitting_cfg_, solver_cfg_->implicit_pde_scheme_value());
     heat_splitting_method_3d_ptr splitting_ptr;
     // create and set up the main solvers:
-    auto solver_y1 = std::make_shared<double_sweep_solver>(space_size_x);
-    auto solver_y2 = std::make_shared<double_sweep_solver>(space_size_y);
-    auto solver_u = std::make_shared<double_sweep_solver>(space_size_z);
+    // one triplet of solvers per worker sweeping the lines:
+    const std::size_t number_of_threads = thread_pool_->size();
+    tridiagonal_solver_ptrs solvers_y1;
+    tridiagonal_solver_ptrs solvers_y2;
+    tridiagonal_solver_ptrs solvers_u;
+    for (std::size_t t = 0; t < number_of_threads; ++t)
+    {
+        auto solver_y1 = std::make_shared<double_sweep_solver>(space_size_x);
+        solvers_y1.emplace_back(solver_y1);
+        auto solver_y2 = std::make_shared<double_sweep_solver>(space_size_y);
+        solvers_y2.emplace_back(solver_y2);
+        auto solver_u = std::make_shared<double_sweep_solver>(space_size_z);
+        solvers_u.emplace_back(solver_u);
+    }
     // splitting method:
     if (splitting_cfg_->splitting_method() == splitting_method_enum::DouglasRachford)
     {
         splitting_ptr = std::make_shared<heat_douglas_rachford_method_3d>(
-            solver_y1, solver_y2, solver_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set);
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::CraigSneyd)
     {
-        // splitting_ptr = std::make_shared<heat_craig_sneyd_method_3d>(
-        //     solver_y1, solver_y2, solver_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_craig_sneyd_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::ModifiedCraigSneyd)
     {
-        // splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method_3d>(
-        //     solver_y1, solver_y2, solver_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::HundsdorferVerwer)
     {
-        // splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method_3d>(
-        //     solver_y1, solver_y2, solver_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else
     {
         throw std::exception("Unreachable");
     }
     // create and set up lower volatility boundary solver:
-    auto boundary_solver = std::make_shared<hhw_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_);
+    auto boundary_solver = std::make_shared<hhw_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_, stats_);
     // auto boundary_solver = std::make_shared<hhw_implicit_boundary_solver>(solver_u, heston_coeff_holder, grid_cfg_);
 
     if (is_heat_sourse_set)
@@ -478,7 +562,8 @@ void hhw_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_en
     else
     {
         hhw_implicit_time_loop::run(splitting_ptr, boundary_solver, boundary_pair_x_, boundary_y_, boundary_pair_z_,
-                                    grid_cfg_, time, last_time_idx, k, traverse_dir, prev_solution, next_solution);
+                                    grid_cfg_, time, last_time_idx, k, traverse_dir, prev_solution, next_solution,
+                                    stats_);
     }
 }
 
@@ -489,10 +574,11 @@ hhw_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_enum::T
                                  pde_discretization_config_3d_ptr const &discretization_config,
                                  splitting_method_config_ptr const &splitting_config,
                                  heat_implicit_solver_config_ptr const &solver_config,
-                                 grid_config_3d_ptr const &grid_config)
+                                 grid_config_3d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                 solver_stats_ptr const &stats)
     : boundary_pair_x_{x_boundary_pair}, boundary_y_{y_upper_boundary_ptr}, boundary_pair_z_{z_boundary_pair},
       heat_data_cfg_{heat_data_config}, discretization_cfg_{discretization_config}, splitting_cfg_{splitting_config},
-      solver_cfg_{solver_config}, grid_cfg_{grid_config}
+      solver_cfg_{solver_config}, grid_cfg_{grid_config}, thread_pool_{thread_pool}, stats_{stats}
 {
 }
 
@@ -519,36 +605,51 @@ void hhw_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_en
         heat_data_cfg_, discretization_cfg_, splitting_cfg_, solver_cfg_->implicit_pde_scheme_value());
     heat_splitting_method_3d_ptr splitting_ptr;
     // create and set up the main solvers:
-    auto solver_y1 = std::make_shared<thomas_lu_solver>(space_size_x);
-    auto solver_y2 = std::make_shared<thomas_lu_solver>(space_size_y);
-    auto solver_u = std::make_shared<thomas_lu_solver>(space_size_z);
+    // one triplet of solvers per worker sweeping the lines:
+    const std::size_t number_of_threads = thread_pool_->size();
+    tridiagonal_solver_ptrs solvers_y1;
+    tridiagonal_solver_ptrs solvers_y2;
+    tridiagonal_solver_ptrs solvers_u;
+    for (std::size_t t = 0; t < number_of_threads; ++t)
+    {
+        auto solver_y1 = std::make_shared<thomas_lu_solver>(space_size_x);
+        solvers_y1.emplace_back(solver_y1);
+        auto solver_y2 = std::make_shared<thomas_lu_solver>(space_size_y);
+        solvers_y2.emplace_back(solver_y2);
+        auto solver_u = std::make_shared<thomas_lu_solver>(space_size_z);
+        solvers_u.emplace_back(solver_u);
+    }
     // splitting method:
     if (splitting_cfg_->splitting_method() == splitting_method_enum::DouglasRachford)
     {
         splitting_ptr = std::make_shared<heat_douglas_rachford_method_3d>(
-            solver_y1, solver_y2, solver_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set);
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::CraigSneyd)
     {
-        // splitting_ptr = std::make_shared<heat_craig_sneyd_method_3d>(
-        //     solver_y1, solver_y2, solver_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_craig_sneyd_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::ModifiedCraigSneyd)
     {
-        // splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method_3d>(
-        //     solver_y1, solver_y2, solver_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_modified_craig_sneyd_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else if (splitting_cfg_->splitting_method() == splitting_method_enum::HundsdorferVerwer)
     {
-        // splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method_3d>(
-        //     solver_y1, solver_y2, solver_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set);
+        splitting_ptr = std::make_shared<heat_hundsdorfer_verwer_method_3d>(
+            solvers_y1, solvers_y2, solvers_u, heston_coeff_holder, grid_cfg_, is_heat_sourse_set, thread_pool_,
+            stats_);
     }
     else
     {
         throw std::exception("Unreachable");
     }
     // create and set up lower volatility boundary solver:
-    auto boundary_solver = std::make_shared<hhw_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_);
+    auto boundary_solver = std::make_shared<hhw_explicit_boundary_solver>(heston_coeff_holder, grid_cfg_, stats_);
     // auto boundary_solver = std::make_shared<hhw_implicit_boundary_solver>(solver_u, heston_coeff_holder, grid_cfg_);
 
     if (is_heat_sourse_set)
@@ -567,7 +668,8 @@ void hhw_equation_implicit_kernel<memory_space_enum::Host, tridiagonal_method_en
     else
     {
         hhw_implicit_time_loop::run(splitting_ptr, boundary_solver, boundary_pair_x_, boundary_y_, boundary_pair_z_,
-                                    grid_cfg_, time, last_time_idx, k, traverse_dir, prev_solution, next_solution);
+                                    grid_cfg_, time, last_time_idx, k, traverse_dir, prev_solution, next_solution,
+                                    stats_);
     }
 }
 
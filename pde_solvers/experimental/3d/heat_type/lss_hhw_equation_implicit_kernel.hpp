@@ -5,6 +5,8 @@
 
 #include "../../../../boundaries/lss_boundary.hpp"
 #include "../../../../common/lss_enumerations.hpp"
+#include "../../../../common/lss_solver_stats.hpp"
+#include "../../../../common/lss_thread_pool.hpp"
 #include "../../../../common/lss_utility.hpp"
 #include "../../../../containers/lss_container_2d.hpp"
 #include "../../../../containers/lss_container_3d.hpp"
@@ -28,7 +30,9 @@ using lss_enumerations::by_enum;
 using lss_enumerations::memory_space_enum;
 using lss_enumerations::tridiagonal_method_enum;
 using lss_grids::grid_config_3d_ptr;
+using lss_utility::solver_stats_ptr;
 using lss_utility::sptr_t;
+using lss_utility::thread_pool_ptr;
 
 template <memory_space_enum memory_enum, tridiagonal_method_enum tridiagonal_method> class hhw_equation_implicit_kernel
 {
@@ -49,6 +53,8 @@ template <> class hhw_equation_implicit_kernel<memory_space_enum::Device, tridia
     splitting_method_config_ptr splitting_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_3d_ptr grid_cfg_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
   public:
     hhw_equation_implicit_kernel(boundary_3d_pair const &x_boundary_pair, boundary_3d_ptr const &y_upper_boundary_ptr,
@@ -57,7 +63,8 @@ template <> class hhw_equation_implicit_kernel<memory_space_enum::Device, tridia
                                  pde_discretization_config_3d_ptr const &discretization_config,
                                  splitting_method_config_ptr const &splitting_config,
                                  heat_implicit_solver_config_ptr const &solver_config,
-                                 grid_config_3d_ptr const &grid_config);
+                                 grid_config_3d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                 solver_stats_ptr const &stats);
 
     void operator()(container_3d<by_enum::RowPlane> &prev_solution, container_3d<by_enum::RowPlane> &next_solution,
                     bool is_heat_sourse_set, std::function<double(double, double, double, double)> const &heat_source);
@@ -81,6 +88,8 @@ template <> class hhw_equation_implicit_kernel<memory_space_enum::Device, tridia
     splitting_method_config_ptr splitting_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_3d_ptr grid_cfg_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
   public:
     hhw_equation_implicit_kernel(boundary_3d_pair const &x_boundary_pair, boundary_3d_ptr const &y_upper_boundary_ptr,
@@ -89,7 +98,8 @@ template <> class hhw_equation_implicit_kernel<memory_space_enum::Device, tridia
                                  pde_discretization_config_3d_ptr const &discretization_config,
                                  splitting_method_config_ptr const &splitting_config,
                                  heat_implicit_solver_config_ptr const &solver_config,
-                                 grid_config_3d_ptr const &grid_config);
+                                 grid_config_3d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                 solver_stats_ptr const &stats);
 
     void operator()(container_3d<by_enum::RowPlane> &prev_solution, container_3d<by_enum::RowPlane> &next_solution,
                     bool is_heat_sourse_set, std::function<double(double, double, double, double)> const &heat_source,
@@ -118,6 +128,8 @@ template <> class hhw_equation_implicit_kernel<memory_space_enum::Host, tridiago
     splitting_method_config_ptr splitting_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_3d_ptr grid_cfg_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
   public:
     hhw_equation_implicit_kernel(boundary_3d_pair const &x_boundary_pair, boundary_3d_ptr const &y_upper_boundary_ptr,
@@ -126,7 +138,8 @@ template <> class hhw_equation_implicit_kernel<memory_space_enum::Host, tridiago
                                  pde_discretization_config_3d_ptr const &discretization_config,
                                  splitting_method_config_ptr const &splitting_config,
                                  heat_implicit_solver_config_ptr const &solver_config,
-                                 grid_config_3d_ptr const &grid_config);
+                                 grid_config_3d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                 solver_stats_ptr const &stats);
 
     void operator()(container_3d<by_enum::RowPlane> &prev_solution, container_3d<by_enum::RowPlane> &next_solution,
                     bool is_heat_sourse_set, std::function<double(double, double, double, double)> const &heat_source);
@@ -149,6 +162,8 @@ template <> class hhw_equation_implicit_kernel<memory_space_enum::Host, tridiago
     splitting_method_config_ptr splitting_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_3d_ptr grid_cfg_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
   public:
     hhw_equation_implicit_kernel(boundary_3d_pair const &x_boundary_pair, boundary_3d_ptr const &y_upper_boundary_ptr,
@@ -157,7 +172,8 @@ template <> class hhw_equation_implicit_kernel<memory_space_enum::Host, tridiago
                                  pde_discretization_config_3d_ptr const &discretization_config,
                                  splitting_method_config_ptr const &splitting_config,
                                  heat_implicit_solver_config_ptr const &solver_config,
-                                 grid_config_3d_ptr const &grid_config);
+                                 grid_config_3d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                 solver_stats_ptr const &stats);
 
     void operator()(container_3d<by_enum::RowPlane> &prev_solution, container_3d<by_enum::RowPlane> &next_solution,
                     bool is_heat_sourse_set, std::function<double(double, double, double, double)> const &heat_source,
@@ -183,6 +199,8 @@ template <> class hhw_equation_implicit_kernel<memory_space_enum::Host, tridiago
     splitting_method_config_ptr splitting_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_3d_ptr grid_cfg_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
   public:
     hhw_equation_implicit_kernel(boundary_3d_pair const &x_boundary_pair, boundary_3d_ptr const &y_upper_boundary_ptr,
@@ -191,7 +209,8 @@ template <> class hhw_equation_implicit_kernel<memory_space_enum::Host, tridiago
                                  pde_discretization_config_3d_ptr const &discretization_config,
                                  splitting_method_config_ptr const &splitting_config,
                                  heat_implicit_solver_config_ptr const &solver_config,
-                                 grid_config_3d_ptr const &grid_config);
+                                 grid_config_3d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                 solver_stats_ptr const &stats);
 
     void operator()(container_3d<by_enum::RowPlane> &prev_solution, container_3d<by_enum::RowPlane> &next_solution,
                     bool is_heat_sourse_set, std::function<double(double, double, double, double)> const &heat_source);
@@ -215,6 +234,8 @@ template <> class hhw_equation_implicit_kernel<memory_space_enum::Host, tridiago
     splitting_method_config_ptr splitting_cfg_;
     heat_implicit_solver_config_ptr solver_cfg_;
     grid_config_3d_ptr grid_cfg_;
+    thread_pool_ptr thread_pool_;
+    solver_stats_ptr stats_;
 
   public:
     hhw_equation_implicit_kernel(boundary_3d_pair const &x_boundary_pair, boundary_3d_ptr const &y_upper_boundary_ptr,
@@ -223,7 +244,8 @@ template <> class hhw_equation_implicit_kernel<memory_space_enum::Host, tridiago
                                  pde_discretization_config_3d_ptr const &discretization_config,
                                  splitting_method_config_ptr const &splitting_config,
                                  heat_implicit_solver_config_ptr const &solver_config,
-                                 grid_config_3d_ptr const &grid_config);
+                                 grid_config_3d_ptr const &grid_config, thread_pool_ptr const &thread_pool,
+                                 solver_stats_ptr const &stats);
 
     void operator()(container_3d<by_enum::RowPlane> &prev_solution, container_3d<by_enum::RowPlane> &next_solution,
                     bool is_heat_sourse_set, std::function<double(double, double, double, double)> const &heat_source);
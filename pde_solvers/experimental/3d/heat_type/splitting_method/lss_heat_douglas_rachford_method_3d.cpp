@@ -1,5 +1,7 @@
 #include "lss_heat_douglas_rachford_method_3d.hpp"
 
+#include <utility>
+
 #include "../../../../../common/lss_macros.hpp"
 #include "../../../../../discretization/lss_grid.hpp"
 
@@ -14,7 +16,7 @@ namespace three_dimensional
 void implicit_hhw_scheme::rhs_intermed_1(hhw_implicit_coefficients_ptr const &cfs, grid_config_3d_ptr const &grid_cfg,
                                          std::size_t const &y_index, double const &y, std::size_t const &z_index,
                                          double const &z, container_3d<by_enum::RowPlane> const &input,
-                                         double const &time, container_t &solution)
+                                         double const &time, strided_span<double> const &solution)
 {
     auto const one = 1.0;
     auto const two = 2.0;
@@ -36,32 +38,34 @@ void implicit_hhw_scheme::rhs_intermed_1(hhw_implicit_coefficients_ptr const &cf
     auto const beta_3 = cfs->beta_3_;
     auto const theta = cfs->theta_;
 
+    // the nine x-lines of the stencil, named by their (y,z) offsets:
+    auto const in_mm = input.row_line(y_index - 1, z_index - 1);
+    auto const in_m0 = input.row_line(y_index - 1, z_index);
+    auto const in_mp = input.row_line(y_index - 1, z_index + 1);
+    auto const in_0m = input.row_line(y_index, z_index - 1);
+    auto const in_00 = input.row_line(y_index, z_index);
+    auto const in_0p = input.row_line(y_index, z_index + 1);
+    auto const in_pm = input.row_line(y_index + 1, z_index - 1);
+    auto const in_p0 = input.row_line(y_index + 1, z_index);
+    auto const in_pp = input.row_line(y_index + 1, z_index + 1);
+
     const std::size_t N = solution.size() - 1;
-    double x{};
+    double x{}, d{}, e{}, f{};
     for (std::size_t t = 1; t < N; ++t)
     {
         x = grid_3d::value_1(grid_cfg, t);
-        solution[t] =
-            (beta_1 * D(time, x, y, z) * input(t - 1, y_index - 1, z_index)) +
-            (beta_2 * E(time, x, y, z) * input(t - 1, y_index, z_index - 1)) +
-            (beta_3 * F(time, x, y, z) * input(t, y_index - 1, z_index - 1)) -
-            (beta_1 * D(time, x, y, z) * input(t + 1, y_index - 1, z_index)) -
-            (beta_2 * E(time, x, y, z) * input(t - 1, y_index, z_index + 1)) -
-            (beta_3 * F(time, x, y, z) * input(t, y_index - 1, z_index + 1)) -
-            (beta_1 * D(time, x, y, z) * input(t - 1, y_index + 1, z_index)) -
-            (beta_2 * E(time, x, y, z) * input(t + 1, y_index, z_index - 1)) -
-            (beta_3 * F(time, x, y, z) * input(t, y_index + 1, z_index - 1)) +
-            (beta_1 * D(time, x, y, z) * input(t + 1, y_index + 1, z_index)) +
-            (beta_2 * E(time, x, y, z) * input(t + 1, y_index, z_index + 1)) +
-            (beta_3 * F(time, x, y, z) * input(t, y_index + 1, z_index + 1)) +
-            (M_2(time, x, y, z) * input(t, y_index - 1, z_index)) +
-            (P_2(time, x, y, z) * input(t, y_index + 1, z_index)) +
-            (M_3(time, x, y, z) * input(t, y_index, z_index - 1)) +
-            (P_3(time, x, y, z) * input(t, y_index, z_index + 1)) +
-            ((one - theta) * M_1(time, x, y, z) * input(t - 1, y_index, z_index)) +
-            ((one - theta) * P_1(time, x, y, z) * input(t + 1, y_index, z_index)) +
-            ((one - two * S_2(time, x, y, z) - two * S_3(time, x, y, z) - two * (one - theta) * S_1(time, x, y, z)) *
-             input(t, y_index, z_index));
+        d = beta_1 * D(time, x, y, z);
+        e = beta_2 * E(time, x, y, z);
+        f = beta_3 * F(time, x, y, z);
+        solution[t] = (d * in_m0[t - 1]) + (e * in_0m[t - 1]) + (f * in_mm[t]) - (d * in_m0[t + 1]) -
+                      (e * in_0p[t - 1]) - (f * in_mp[t]) - (d * in_p0[t - 1]) - (e * in_0m[t + 1]) - (f * in_pm[t]) +
+                      (d * in_p0[t + 1]) + (e * in_0p[t + 1]) + (f * in_pp[t]) + (M_2(time, x, y, z) * in_m0[t]) +
+                      (P_2(time, x, y, z) * in_p0[t]) + (M_3(time, x, y, z) * in_0m[t]) +
+                      (P_3(time, x, y, z) * in_0p[t]) + ((one - theta) * M_1(time, x, y, z) * in_00[t - 1]) +
+                      ((one - theta) * P_1(time, x, y, z) * in_00[t + 1]) +
+                      ((one - two * S_2(time, x, y, z) - two * S_3(time, x, y, z) -
+                        two * (one - theta) * S_1(time, x, y, z)) *
+                       in_00[t]);
     }
 }
 
@@ -71,7 +75,7 @@ void implicit_hhw_scheme::rhs_intermed_1_source(hhw_implicit_coefficients_ptr co
                                                 container_3d<by_enum::RowPlane> const &input,
                                                 container_3d<by_enum::RowPlane> const &inhom_input,
                                                 container_3d<by_enum::RowPlane> const &inhom_input_next,
-                                                double const &time, container_t &solution)
+                                                double const &time, strided_span<double> const &solution)
 {
     auto const one = 1.0;
     auto const two = 2.0;
@@ -94,42 +98,45 @@ void implicit_hhw_scheme::rhs_intermed_1_source(hhw_implicit_coefficients_ptr co
     auto const rho = cfs->rho_;
     auto const theta = cfs->theta_;
 
+    auto const in_mm = input.row_line(y_index - 1, z_index - 1);
+    auto const in_m0 = input.row_line(y_index - 1, z_index);
+    auto const in_mp = input.row_line(y_index - 1, z_index + 1);
+    auto const in_0m = input.row_line(y_index, z_index - 1);
+    auto const in_00 = input.row_line(y_index, z_index);
+    auto const in_0p = input.row_line(y_index, z_index + 1);
+    auto const in_pm = input.row_line(y_index + 1, z_index - 1);
+    auto const in_p0 = input.row_line(y_index + 1, z_index);
+    auto const in_pp = input.row_line(y_index + 1, z_index + 1);
+    auto const source = inhom_input.row_line(y_index, z_index);
+    auto const source_next = inhom_input_next.row_line(y_index, z_index);
+
     const std::size_t N = solution.size() - 1;
-    double x{};
+    double x{}, d{}, e{}, f{};
     for (std::size_t t = 1; t < N; ++t)
     {
         x = grid_3d::value_1(grid_cfg, t);
-        solution[t] =
-            (beta_1 * D(time, x, y, z) * input(t - 1, y_index - 1, z_index)) +
-            (beta_2 * E(time, x, y, z) * input(t - 1, y_index, z_index - 1)) +
-            (beta_3 * F(time, x, y, z) * input(t, y_index - 1, z_index - 1)) +
-            ((one - theta) * M_1(time, x, y, z) * input(t - 1, y_index, z_index)) +
-            (M_2(time, x, y, z) * input(t, y_index - 1, z_index)) +
-            (M_3(time, x, y, z) * input(t, y_index, z_index - 1)) +
-            (((one - two * S_2(time, x, y, z) - two * S_3(time, x, y, z)) - two * (one - theta) * S_1(time, x, y, z)) *
-             input(t, y_index, z_index)) -
-            (beta_1 * D(time, x, y, z) * input(t - 1, y_index + 1, z_index)) -
-            (beta_2 * E(time, x, y, z) * input(t - 1, y_index, z_index + 1)) -
-            (beta_3 * F(time, x, y, z) * input(t, y_index - 1, z_index + 1)) -
-            (beta_1 * D(time, x, y, z) * input(t + 1, y_index - 1, z_index)) -
-            (beta_2 * E(time, x, y, z) * input(t + 1, y_index, z_index - 1)) -
-            (beta_3 * F(time, x, y, z) * input(t, y_index + 1, z_index - 1)) +
-            (P_2(time, x, y, z) * input(t, y_index + 1, z_index)) +
-            (P_3(time, x, y, z) * input(t, y_index, z_index + 1)) +
-            ((one - theta) * P_1(time, x, y, z) * input(t + 1, y_index, z_index)) +
-            (beta_1 * D(time, x, y, z) * input(t + 1, y_index + 1, z_index)) +
-            (beta_2 * E(time, x, y, z) * input(t + 1, y_index, z_index + 1)) +
-            (beta_3 * F(time, x, y, z) * input(t, y_index + 1, z_index + 1)) +
-            rho * (one - theta) * inhom_input(t, y_index, z_index) +
-            rho * theta * inhom_input_next(t, y_index, z_index);
+        d = beta_1 * D(time, x, y, z);
+        e = beta_2 * E(time, x, y, z);
+        f = beta_3 * F(time, x, y, z);
+        solution[t] = (d * in_m0[t - 1]) + (e * in_0m[t - 1]) + (f * in_mm[t]) +
+                      ((one - theta) * M_1(time, x, y, z) * in_00[t - 1]) + (M_2(time, x, y, z) * in_m0[t]) +
+                      (M_3(time, x, y, z) * in_0m[t]) +
+                      (((one - two * S_2(time, x, y, z) - two * S_3(time, x, y, z)) -
+                        two * (one - theta) * S_1(time, x, y, z)) *
+                       in_00[t]) -
+                      (d * in_p0[t - 1]) - (e * in_0p[t - 1]) - (f * in_mp[t]) - (d * in_m0[t + 1]) -
+                      (e * in_0m[t + 1]) - (f * in_pm[t]) + (P_2(time, x, y, z) * in_p0[t]) +
+                      (P_3(time, x, y, z) * in_0p[t]) + ((one - theta) * P_1(time, x, y, z) * in_00[t + 1]) +
+                      (d * in_p0[t + 1]) + (e * in_0p[t + 1]) + (f * in_pp[t]) +
+                      rho * (one - theta) * source[t] + rho * theta * source_next[t];
     }
 }
 
 void implicit_hhw_scheme::rhs_intermed_2(hhw_implicit_coefficients_ptr const &cfs, grid_config_3d_ptr const &grid_cfg,
                                          std::size_t const &x_index, double const &x, std::size_t const &z_index,
                                          double const &z, container_3d<by_enum::RowPlane> const &input,
-                                         container_3d<by_enum::RowPlane> const &inhom_input, double const &time,
-                                         container_t &solution)
+                                         container_3d<by_enum::ColumnPlane> const &inhom_input, double const &time,
+                                         strided_span<double> const &solution)
 {
     auto const two = 2.0;
     auto const &M_2 = cfs->M_2_;
@@ -137,14 +144,16 @@ void implicit_hhw_scheme::rhs_intermed_2(hhw_implicit_coefficients_ptr const &cf
     auto const &S_2 = cfs->S_2_;
     auto const theta = cfs->theta_;
 
+    auto const in = input.column_line(x_index, z_index);
+    auto const inhom = inhom_input.column_line(x_index, z_index);
+
     const std::size_t N = solution.size() - 1;
     double y{};
     for (std::size_t t = 1; t < N; ++t)
     {
         y = grid_3d::value_2(grid_cfg, t);
-        solution[t] = (-theta * M_2(time, x, y, z) * input(x_index, t - 1, z_index)) +
-                      (theta * two * S_2(time, x, y, z) * input(x_index, t, z_index)) -
-                      (theta * P_2(time, x, y, z) * input(x_index, t + 1, z_index)) + inhom_input(x_index, t, z_index);
+        solution[t] = (-theta * M_2(time, x, y, z) * in[t - 1]) + (theta * two * S_2(time, x, y, z) * in[t]) -
+                      (theta * P_2(time, x, y, z) * in[t + 1]) + inhom[t];
     }
 }
 
@@ -152,22 +161,109 @@ void implicit_hhw_scheme::rhs(hhw_implicit_coefficients_ptr const &cfs, grid_con
                               std::size_t const &x_index, double const &x, std::size_t const &y_index, double const &y,
                               container_3d<by_enum::RowPlane> const &input,
                               container_3d<by_enum::RowPlane> const &inhom_input, double const &time,
-                              container_t &solution)
+                              strided_span<double> const &solution)
 {
     auto const two = 2.0;
-    auto const &M_3 = cfs->M_2_;
-    auto const &P_3 = cfs->P_2_;
-    auto const &S_3 = cfs->S_2_;
+    auto const &M_3 = cfs->M_3_;
+    auto const &P_3 = cfs->P_3_;
+    auto const &S_3 = cfs->S_3_;
     auto const theta = cfs->theta_;
 
+    auto const in = input.layer_line(x_index, y_index);
+    auto const inhom = inhom_input.layer_line(x_index, y_index);
+
     const std::size_t N = solution.size() - 1;
     double z{};
     for (std::size_t t = 1; t < N; ++t)
     {
         z = grid_3d::value_3(grid_cfg, t);
-        solution[t] = (-theta * M_3(time, x, y, z) * input(x_index, y_index, t - 1)) +
-                      (theta * two * S_3(time, x, y, z) * input(x_index, y_index, t)) -
-                      (theta * P_3(time, x, y, z) * input(x_index, y_index, t + 1)) + inhom_input(x_index, y_index, t);
+        solution[t] = (-theta * M_3(time, x, y, z) * in[t - 1]) + (theta * two * S_3(time, x, y, z) * in[t]) -
+                      (theta * P_3(time, x, y, z) * in[t + 1]) + inhom[t];
+    }
+}
+
+void implicit_hhw_scheme::rhs_corrector_1(hhw_implicit_coefficients_ptr const &cfs, grid_config_3d_ptr const &grid_cfg,
+                                          std::size_t const &y_index, double const &y, std::size_t const &z_index,
+                                          double const &z, container_3d<by_enum::ColumnPlane> const &input,
+                                          container_3d<by_enum::RowPlane> const &inhom_input,
+                                          double const &mixed_weight, double const &x_weight,
+                                          double const &yz_weight, double const &time,
+                                          strided_span<double> const &solution)
+{
+    auto const two = 2.0;
+    auto const &M_1 = cfs->M_1_;
+    auto const &M_2 = cfs->M_2_;
+    auto const &M_3 = cfs->M_3_;
+    auto const &P_1 = cfs->P_1_;
+    auto const &P_2 = cfs->P_2_;
+    auto const &P_3 = cfs->P_3_;
+    auto const &S_1 = cfs->S_1_;
+    auto const &S_2 = cfs->S_2_;
+    auto const &S_3 = cfs->S_3_;
+    auto const &D = cfs->D_;
+    auto const &E = cfs->E_;
+    auto const &F = cfs->F_;
+
+    auto const beta_1 = cfs->beta_1_;
+    auto const beta_2 = cfs->beta_2_;
+    auto const beta_3 = cfs->beta_3_;
+    auto const theta = cfs->theta_;
+
+    auto const in = input.row_line(y_index, z_index);
+    // the nine x-lines of the difference, named by their (y,z) offsets:
+    auto const dif_mm = inhom_input.row_line(y_index - 1, z_index - 1);
+    auto const dif_m0 = inhom_input.row_line(y_index - 1, z_index);
+    auto const dif_mp = inhom_input.row_line(y_index - 1, z_index + 1);
+    auto const dif_0m = inhom_input.row_line(y_index, z_index - 1);
+    auto const dif_00 = inhom_input.row_line(y_index, z_index);
+    auto const dif_0p = inhom_input.row_line(y_index, z_index + 1);
+    auto const dif_pm = inhom_input.row_line(y_index + 1, z_index - 1);
+    auto const dif_p0 = inhom_input.row_line(y_index + 1, z_index);
+    auto const dif_pp = inhom_input.row_line(y_index + 1, z_index + 1);
+
+    const std::size_t N = solution.size() - 1;
+    double x{}, m_1{}, p_1{}, s_1{}, mixed{}, along_yz{};
+    for (std::size_t t = 1; t < N; ++t)
+    {
+        x = grid_3d::value_1(grid_cfg, t);
+        m_1 = M_1(time, x, y, z);
+        p_1 = P_1(time, x, y, z);
+        s_1 = S_1(time, x, y, z);
+        mixed = (beta_1 * D(time, x, y, z) * (dif_p0[t + 1] - dif_m0[t + 1] - dif_p0[t - 1] + dif_m0[t - 1])) +
+                (beta_2 * E(time, x, y, z) * (dif_0p[t + 1] - dif_0m[t + 1] - dif_0p[t - 1] + dif_0m[t - 1])) +
+                (beta_3 * F(time, x, y, z) * (dif_pp[t] - dif_pm[t] - dif_mp[t] + dif_mm[t]));
+        along_yz = 0.0;
+        if (yz_weight != 0.0)
+        {
+            along_yz = (M_2(time, x, y, z) * dif_m0[t]) + (P_2(time, x, y, z) * dif_p0[t]) +
+                       (M_3(time, x, y, z) * dif_0m[t]) + (P_3(time, x, y, z) * dif_0p[t]) -
+                       (two * (S_2(time, x, y, z) + S_3(time, x, y, z)) * dif_00[t]);
+        }
+        solution[t] = in[t] - (theta * ((m_1 * in[t - 1]) - (two * s_1 * in[t]) + (p_1 * in[t + 1]))) +
+                      (mixed_weight * mixed) +
+                      (x_weight * ((m_1 * dif_00[t - 1]) - (two * s_1 * dif_00[t]) + (p_1 * dif_00[t + 1]))) +
+                      (yz_weight * along_yz);
+    }
+}
+
+void implicit_hhw_scheme::difference(container_3d<by_enum::RowPlane> const &input,
+                                     container_3d<by_enum::RowPlane> const &inhom_input,
+                                     container_3d<by_enum::RowPlane> &solution)
+{
+    const std::size_t N = solution.rows() - 1;
+    const std::size_t L = solution.layers() - 1;
+    for (std::size_t i = 1; i < N; ++i)
+    {
+        for (std::size_t k = 1; k < L; ++k)
+        {
+            auto const next = input.column_line(i, k);
+            auto const prev = inhom_input.column_line(i, k);
+            auto const dif = solution.column_line(i, k);
+            for (std::size_t j = 0; j < dif.size(); ++j)
+            {
+                dif[j] = next[j] - prev[j];
+            }
+        }
     }
 }
 
@@ -175,9 +271,11 @@ void heat_douglas_rachford_method_3d::initialize(bool is_heat_source_set)
 {
 }
 
-void heat_douglas_rachford_method_3d::split_0(double const &y, double const &z, double const &time, container_t &low,
-                                              container_t &diag, container_t &high)
+void heat_douglas_rachford_method_3d::split_0(double const &y, double const &z, double const &time,
+                                              strided_span<double> const &low, strided_span<double> const &diag,
+                                              strided_span<double> const &high)
 {
+    LSS_STATS_PHASE(stats_, solver_phase_enum::Coefficients);
     double x{};
     for (std::size_t t = 0; t < low.size(); ++t)
     {
@@ -188,9 +286,11 @@ void heat_douglas_rachford_method_3d::split_0(double const &y, double const &z,
     }
 }
 
-void heat_douglas_rachford_method_3d::split_1(double const &x, double const &z, double const &time, container_t &low,
-                                              container_t &diag, container_t &high)
+void heat_douglas_rachford_method_3d::split_1(double const &x, double const &z, double const &time,
+                                              strided_span<double> const &low, strided_span<double> const &diag,
+                                              strided_span<double> const &high)
 {
+    LSS_STATS_PHASE(stats_, solver_phase_enum::Coefficients);
     double y{};
     for (std::size_t t = 0; t < low.size(); ++t)
     {
@@ -201,9 +301,11 @@ void heat_douglas_rachford_method_3d::split_1(double const &x, double const &z,
     }
 }
 
-void heat_douglas_rachford_method_3d::split_2(double const &x, double const &y, double const &time, container_t &low,
-                                              container_t &diag, container_t &high)
+void heat_douglas_rachford_method_3d::split_2(double const &x, double const &y, double const &time,
+                                              strided_span<double> const &low, strided_span<double> const &diag,
+                                              strided_span<double> const &high)
 {
+    LSS_STATS_PHASE(stats_, solver_phase_enum::Coefficients);
     double z{};
     for (std::size_t t = 0; t < low.size(); ++t)
     {
@@ -214,14 +316,29 @@ void heat_douglas_rachford_method_3d::split_2(double const &x, double const &y,
     }
 }
 
-heat_douglas_rachford_method_3d::heat_douglas_rachford_method_3d(
-    lss_tridiagonal_solver::tridiagonal_solver_ptr const &solvery1_ptr,
-    lss_tridiagonal_solver::tridiagonal_solver_ptr const &solvery2_ptr,
-    lss_tridiagonal_solver::tridiagonal_solver_ptr const &solveru_ptr,
-    hhw_implicit_coefficients_ptr const &coefficients, grid_config_3d_ptr const &grid_config, bool is_heat_source_set)
-    : solvery1_ptr_{solvery1_ptr}, solvery2_ptr_{solvery2_ptr}, solveru_ptr_{solveru_ptr},
-      coefficients_{coefficients}, grid_cfg_{grid_config}
+heat_douglas_rachford_method_3d::heat_douglas_rachford_method_3d(tridiagonal_solver_ptrs const &solvery1_ptrs,
+                                                                 tridiagonal_solver_ptrs const &solvery2_ptrs,
+                                                                 tridiagonal_solver_ptrs const &solveru_ptrs,
+                                                                 hhw_implicit_coefficients_ptr const &coefficients,
+                                                                 grid_config_3d_ptr const &grid_config,
+                                                                 bool is_heat_source_set,
+                                                                 thread_pool_ptr const &thread_pool,
+                                                                 solver_stats_ptr const &stats)
+    : heat_splitting_method_3d(stats), coefficients_{coefficients}, grid_cfg_{grid_config}, thread_pool_{thread_pool},
+      workspace_x_{heat_splitting_workspace_3d::create(solvery1_ptrs, coefficients->space_size_x_, stats)},
+      workspace_y_{heat_splitting_workspace_3d::create(solvery2_ptrs, coefficients->space_size_y_, stats)},
+      workspace_z_{heat_splitting_workspace_3d::create(solveru_ptrs, coefficients->space_size_z_, stats)},
+      inter_solution_1_(coefficients->space_size_x_, coefficients->space_size_y_, coefficients->space_size_z_,
+                        double{}),
+      inter_solution_2_(coefficients->space_size_x_, coefficients->space_size_y_, coefficients->space_size_z_,
+                        double{})
 {
+    LSS_ASSERT((solvery1_ptrs.size() == solvery2_ptrs.size()) && (solvery1_ptrs.size() == solveru_ptrs.size()),
+               "All sweeps must have the same number of solvers");
+    LSS_ASSERT(solvery1_ptrs.size() > 0, "At least one solver per sweep is required");
+    LSS_STATS_ADD(stats_, add_bytes_allocated,
+                  2 * coefficients->space_size_x_ * coefficients->space_size_y_ * coefficients->space_size_z_ *
+                      sizeof(double));
     initialize(is_heat_source_set);
 }
 
@@ -235,87 +352,60 @@ void heat_douglas_rachford_method_3d::solve(container_3d<by_enum::RowPlane> cons
                                             boundary_3d_pair const &z_boundary_pair, double const &time,
                                             container_3d<by_enum::RowPlane> &solution)
 {
-    // 3D container for intermediate solution:
-    container_3d<by_enum::ColumnPlane> inter_solution_1(coefficients_->space_size_x_, coefficients_->space_size_y_,
-                                                        coefficients_->space_size_z_, double{});
-    // 1D container for intermediate solution:
-    container_t solution_v(coefficients_->space_size_x_, double{});
-    rhs_.clear();
-    low_.resize(coefficients_->space_size_x_);
-    diag_.resize(coefficients_->space_size_x_);
-    high_.resize(coefficients_->space_size_x_);
-    rhs_.resize(coefficients_->space_size_x_);
-    double x{}, y{}, z{};
-    for (std::size_t j = 1; j < coefficients_->space_size_y_ - 1; ++j)
-    {
-        y = grid_3d::value_2(grid_cfg_, j);
-        auto col_plane = inter_solution_1.at(j);
-        for (std::size_t k = 1; k < coefficients_->space_size_z_ - 1; ++k)
-        {
-            z = grid_3d::value_3(grid_cfg_, k);
-            split_0(y, z, time, low_, diag_, high_);
-            implicit_hhw_scheme::rhs_intermed_1(coefficients_, grid_cfg_, j, y, k, z, prev_solution, time, rhs_);
-            solvery1_ptr_->set_diagonals(low_, diag_, high_);
-            solvery1_ptr_->set_rhs(rhs_);
-            solvery1_ptr_->solve(x_boundary_pair, solution_v, time, y, z);
-            col_plane(k, solution_v);
-        }
-        inter_solution_1(j, col_plane);
-    }
+    const std::size_t inner_x = coefficients_->space_size_x_ - 2;
+    const std::size_t inner_y = coefficients_->space_size_y_ - 2;
+    const std::size_t inner_z = coefficients_->space_size_z_ - 2;
+    // lines are independent, each worker solves its chunk of lines as one batch;
+    // line l of the x sweep is the line (j,k) = (1 + l / inner_z, 1 + l % inner_z):
+    sweep(thread_pool_, workspace_x_, inner_y * inner_z, x_boundary_pair, time,
+          [&](std::size_t l, heat_splitting_line_3d const &line) {
+              const std::size_t j = 1 + l / inner_z;
+              const std::size_t k = 1 + l % inner_z;
+              const double y = grid_3d::value_2(grid_cfg_, j);
+              const double z = grid_3d::value_3(grid_cfg_, k);
+              split_0(y, z, time, line.low_, line.diag_, line.high_);
+              LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+              implicit_hhw_scheme::rhs_intermed_1(coefficients_, grid_cfg_, j, y, k, z, prev_solution, time,
+                                                  line.rhs_);
+              return std::make_pair(y, z);
+          },
+          [&](std::size_t l, strided_span<const double> const &line_solution) {
+              inter_solution_1_.row_line(1 + l / inner_z, 1 + l % inner_z).copy_from(line_solution);
+          });
 
-    // 3D container for intermediate solution:
-    container_3d<by_enum::RowPlane> inter_solution_2(coefficients_->space_size_x_, coefficients_->space_size_y_,
-                                                     coefficients_->space_size_z_, double{});
-    // 1D container for intermediate solution:
-    solution_v.resize(coefficients_->space_size_y_);
-    // containers for second split solver:
-    rhs_.clear();
-    low_.resize(coefficients_->space_size_y_);
-    diag_.resize(coefficients_->space_size_y_);
-    high_.resize(coefficients_->space_size_y_);
-    rhs_.resize(coefficients_->space_size_y_);
-    for (std::size_t i = 1; i < coefficients_->space_size_x_ - 1; ++i)
-    {
-        x = grid_3d::value_1(grid_cfg_, i);
-        auto row_plane = inter_solution_2.at(i);
-        for (std::size_t k = 1; k < coefficients_->space_size_z_ - 1; ++k)
-        {
-            z = grid_3d::value_3(grid_cfg_, k);
-            split_1(x, z, time, low_, diag_, high_);
-            implicit_hhw_scheme::rhs_intermed_2(coefficients_, grid_cfg_, i, x, k, z, prev_solution, inter_solution_1,
-                                                time, rhs_);
-            solvery2_ptr_->set_diagonals(low_, diag_, high_);
-            solvery2_ptr_->set_rhs(rhs_);
-            solvery2_ptr_->solve(y_boundary_pair, solution_v, time, x, z);
-            row_plane(k, solution_v);
-        }
-        inter_solution_2(i, row_plane);
-    }
+    // line l of the y sweep is the line (i,k) = (1 + l / inner_z, 1 + l % inner_z):
+    sweep(thread_pool_, workspace_y_, inner_x * inner_z, y_boundary_pair, time,
+          [&](std::size_t l, heat_splitting_line_3d const &line) {
+              const std::size_t i = 1 + l / inner_z;
+              const std::size_t k = 1 + l % inner_z;
+              const double x = grid_3d::value_1(grid_cfg_, i);
+              const double z = grid_3d::value_3(grid_cfg_, k);
+              split_1(x, z, time, line.low_, line.diag_, line.high_);
+              LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+              implicit_hhw_scheme::rhs_intermed_2(coefficients_, grid_cfg_, i, x, k, z, prev_solution,
+                                                  inter_solution_1_, time, line.rhs_);
+              return std::make_pair(x, z);
+          },
+          [&](std::size_t l, strided_span<const double> const &line_solution) {
+              inter_solution_2_.column_line(1 + l / inner_z, 1 + l % inner_z).copy_from(line_solution);
+          });
 
-    // 1D container for final solution:
-    solution_v.resize(coefficients_->space_size_z_);
-    // containers for second split solver:
-    rhs_.clear();
-    low_.resize(coefficients_->space_size_z_);
-    diag_.resize(coefficients_->space_size_z_);
-    high_.resize(coefficients_->space_size_z_);
-    rhs_.resize(coefficients_->space_size_z_);
-    for (std::size_t i = 1; i < coefficients_->space_size_x_ - 1; ++i)
-    {
-        x = grid_3d::value_1(grid_cfg_, i);
-        auto row_plane_r = container_2d<by_enum::Row>(solution.at(i));
-        for (std::size_t j = 1; j < coefficients_->space_size_y_ - 1; ++j)
-        {
-            y = grid_3d::value_2(grid_cfg_, j);
-            split_2(x, y, time, low_, diag_, high_);
-            implicit_hhw_scheme::rhs(coefficients_, grid_cfg_, i, x, j, y, prev_solution, inter_solution_2, time, rhs_);
-            solveru_ptr_->set_diagonals(low_, diag_, high_);
-            solveru_ptr_->set_rhs(rhs_);
-            solveru_ptr_->solve(z_boundary_pair, solution_v, time, x, y);
-            row_plane_r(j, solution_v);
-        }
-        solution(i, row_plane_r);
-    }
+    // line l of the z sweep is the line (i,j) = (1 + l / inner_y, 1 + l % inner_y):
+    sweep(thread_pool_, workspace_z_, inner_x * inner_y, z_boundary_pair, time,
+          [&](std::size_t l, heat_splitting_line_3d const &line) {
+              const std::size_t i = 1 + l / inner_y;
+              const std::size_t j = 1 + l % inner_y;
+              const double x = grid_3d::value_1(grid_cfg_, i);
+              const double y = grid_3d::value_2(grid_cfg_, j);
+              split_2(x, y, time, line.low_, line.diag_, line.high_);
+              LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+              implicit_hhw_scheme::rhs(coefficients_, grid_cfg_, i, x, j, y, prev_solution, inter_solution_2_, time,
+                                       line.rhs_);
+              return std::make_pair(x, y);
+          },
+          [&](std::size_t l, strided_span<const double> const &line_solution) {
+              solution.layer_line(1 + l / inner_y, 1 + l % inner_y).copy_from(line_solution);
+          });
 }
 
 void heat_douglas_rachford_method_3d::solve(container_3d<by_enum::RowPlane> const &prev_solution,
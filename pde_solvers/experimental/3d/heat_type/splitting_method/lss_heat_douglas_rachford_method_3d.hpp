@@ -7,7 +7,9 @@
 #include "../../../../../boundaries/lss_boundary.hpp"
 #include "../../../../../common/lss_enumerations.hpp"
 #include "../../../../../containers/lss_container_2d.hpp"
+#include "../../../../../containers/lss_strided_span.hpp"
 #include "../../../../../discretization/lss_grid_config.hpp"
+#include "../../../../../sparse_solvers/tridiagonal/lss_tridiagonal_batch.hpp"
 #include "../../../../../sparse_solvers/tridiagonal/lss_tridiagonal_solver.hpp"
 #include "../implicit_coefficients/lss_hhw_implicit_coefficients.hpp"
 #include "lss_heat_splitting_method_3d.hpp"
@@ -20,6 +22,7 @@ namespace three_dimensional
 using lss_boundary::boundary_2d_pair;
 using lss_boundary::boundary_2d_ptr;
 using lss_containers::container_2d;
+using lss_containers::strided_span;
 using lss_enumerations::by_enum;
 using lss_grids::grid_config_2d_ptr;
 using lss_utility::container_t;
@@ -30,25 +33,49 @@ class implicit_hhw_scheme
   public:
     static void rhs_intermed_1(hhw_implicit_coefficients_ptr const &cfs, grid_config_3d_ptr const &grid_cfg,
                                std::size_t const &y_index, double const &y, std::size_t const &z_index, double const &z,
-                               container_3d<by_enum::RowPlane> const &input, double const &time, container_t &solution);
+                               container_3d<by_enum::RowPlane> const &input, double const &time,
+                               strided_span<double> const &solution);
 
     static void rhs_intermed_1_source(hhw_implicit_coefficients_ptr const &cfs, grid_config_3d_ptr const &grid_cfg,
                                       std::size_t const &y_index, double const &y, std::size_t const &z_index,
                                       double const &z, container_3d<by_enum::RowPlane> const &input,
                                       container_3d<by_enum::RowPlane> const &inhom_input,
                                       container_3d<by_enum::RowPlane> const &inhom_input_next, double const &time,
-                                      container_t &solution);
+                                      strided_span<double> const &solution);
 
     static void rhs_intermed_2(hhw_implicit_coefficients_ptr const &cfs, grid_config_3d_ptr const &grid_cfg,
                                std::size_t const &x_index, double const &x, std::size_t const &z_index, double const &z,
                                container_3d<by_enum::RowPlane> const &input,
-                               container_3d<by_enum::RowPlane> const &inhom_input, double const &time,
-                               container_t &solution);
+                               container_3d<by_enum::ColumnPlane> const &inhom_input, double const &time,
+                               strided_span<double> const &solution);
 
     static void rhs(hhw_implicit_coefficients_ptr const &cfs, grid_config_3d_ptr const &grid_cfg,
                     std::size_t const &x_index, double const &x, std::size_t const &y_index, double const &y,
                     container_3d<by_enum::RowPlane> const &input, container_3d<by_enum::RowPlane> const &inhom_input,
-                    double const &time, container_t &solution);
+                    double const &time, strided_span<double> const &solution);
+
+    /**
+        @brief  Right-hand side of the x-line corrector stage of CS, MCS and HV schemes
+        @param  input - Y_1 of the predictor stage
+        @param  inhom_input - Y_3 - U of the predictor stage
+        @param  mixed_weight - weight of the mixed derivative part of Y_3 - U
+        @param  x_weight - weight of the x part of Y_3 - U
+        @param  yz_weight - weight of the y and z parts of Y_3 - U
+    **/
+    static void rhs_corrector_1(hhw_implicit_coefficients_ptr const &cfs, grid_config_3d_ptr const &grid_cfg,
+                                std::size_t const &y_index, double const &y, std::size_t const &z_index,
+                                double const &z, container_3d<by_enum::ColumnPlane> const &input,
+                                container_3d<by_enum::RowPlane> const &inhom_input, double const &mixed_weight,
+                                double const &x_weight, double const &yz_weight, double const &time,
+                                strided_span<double> const &solution);
+
+    /**
+        @brief  Writes input - inhom_input into solution, the x and z boundary planes are left untouched
+                since the intermediate x and z boundaries hold U
+    **/
+    static void difference(container_3d<by_enum::RowPlane> const &input,
+                           container_3d<by_enum::RowPlane> const &inhom_input,
+                           container_3d<by_enum::RowPlane> &solution);
 };
 
 /**
@@ -61,35 +88,38 @@ class heat_douglas_rachford_method_3d : public heat_splitting_method_3d
     // constants:
     const double cone_ = 1.0;
     const double ctwo_ = 2.0;
-    // solvers:
-    lss_tridiagonal_solver::tridiagonal_solver_ptr solvery1_ptr_;
-    lss_tridiagonal_solver::tridiagonal_solver_ptr solvery2_ptr_;
-    lss_tridiagonal_solver::tridiagonal_solver_ptr solveru_ptr_;
     // scheme coefficients:
     hhw_implicit_coefficients_ptr coefficients_;
     grid_config_3d_ptr grid_cfg_;
-    // containers:
-    container_t low_, diag_, high_, rhs_;
+    // workers sweeping the lines, each owning one workspace per direction:
+    thread_pool_ptr thread_pool_;
+    heat_splitting_workspaces_3d workspace_x_;
+    heat_splitting_workspaces_3d workspace_y_;
+    heat_splitting_workspaces_3d workspace_z_;
+    // intermediate solutions:
+    container_3d<by_enum::ColumnPlane> inter_solution_1_;
+    container_3d<by_enum::RowPlane> inter_solution_2_;
 
     explicit heat_douglas_rachford_method_3d() = delete;
 
     void initialize(bool is_heat_source_set);
 
-    void split_0(double const &y, double const &z, double const &time, container_t &low, container_t &diag,
-                 container_t &high);
+    void split_0(double const &y, double const &z, double const &time, strided_span<double> const &low,
+                 strided_span<double> const &diag, strided_span<double> const &high);
 
-    void split_1(double const &x, double const &z, double const &time, container_t &low, container_t &diag,
-                 container_t &high);
+    void split_1(double const &x, double const &z, double const &time, strided_span<double> const &low,
+                 strided_span<double> const &diag, strided_span<double> const &high);
 
-    void split_2(double const &x, double const &y, double const &time, container_t &low, container_t &diag,
-                 container_t &high);
+    void split_2(double const &x, double const &y, double const &time, strided_span<double> const &low,
+                 strided_span<double> const &diag, strided_span<double> const &high);
 
   public:
-    explicit heat_douglas_rachford_method_3d(lss_tridiagonal_solver::tridiagonal_solver_ptr const &solvery1_ptr,
-                                             lss_tridiagonal_solver::tridiagonal_solver_ptr const &solvery2_ptr,
-                                             lss_tridiagonal_solver::tridiagonal_solver_ptr const &solveru_ptr,
+    explicit heat_douglas_rachford_method_3d(tridiagonal_solver_ptrs const &solvery1_ptrs,
+                                             tridiagonal_solver_ptrs const &solvery2_ptrs,
+                                             tridiagonal_solver_ptrs const &solveru_ptrs,
                                              hhw_implicit_coefficients_ptr const &coefficients,
-                                             grid_config_3d_ptr const &grid_config, bool is_heat_source_set);
+                                             grid_config_3d_ptr const &grid_config, bool is_heat_source_set,
+                                             thread_pool_ptr const &thread_pool, solver_stats_ptr const &stats);
 
     ~heat_douglas_rachford_method_3d();
 
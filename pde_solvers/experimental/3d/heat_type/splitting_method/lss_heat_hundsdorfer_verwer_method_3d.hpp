@@ -0,0 +1,91 @@
+#if !defined(_LSS_HEAT_HUNDSDORFER_VERWER_METHOD_3D_HPP_)
+#define _LSS_HEAT_HUNDSDORFER_VERWER_METHOD_3D_HPP_
+
+#include <functional>
+
+#include "../../../../../boundaries/lss_boundary.hpp"
+#include "../../../../../common/lss_enumerations.hpp"
+#include "../../../../../containers/lss_container_3d.hpp"
+#include "../../../../../containers/lss_strided_span.hpp"
+#include "../../../../../discretization/lss_grid_config.hpp"
+#include "../../../../../sparse_solvers/tridiagonal/lss_tridiagonal_solver.hpp"
+#include "../implicit_coefficients/lss_hhw_implicit_coefficients.hpp"
+#include "lss_heat_douglas_rachford_method_3d.hpp"
+#include "lss_heat_splitting_method_3d.hpp"
+
+namespace lss_pde_solvers
+{
+
+namespace three_dimensional
+{
+
+/**
+    heat_hundsdorfer_verwer_method_3d object
+
+    Hundsdorfer-Verwer scheme: Douglas predictor Y_3 followed by a corrector
+    which adds zeta of the whole operator, the unidirectional corrector steps
+    are stabilized with Y_3.
+ */
+class heat_hundsdorfer_verwer_method_3d : public heat_splitting_method_3d
+{
+
+  private:
+    // constants:
+    const double cone_ = 1.0;
+    const double ctwo_ = 2.0;
+    // scheme coefficients:
+    hhw_implicit_coefficients_ptr coefficients_;
+    grid_config_3d_ptr grid_cfg_;
+    // workers sweeping the lines, each owning one workspace per direction:
+    thread_pool_ptr thread_pool_;
+    heat_splitting_workspaces_3d workspace_x_;
+    heat_splitting_workspaces_3d workspace_y_;
+    heat_splitting_workspaces_3d workspace_z_;
+    // intermediate solutions reused across time steps:
+    container_3d<by_enum::ColumnPlane> inter_solution_1_;
+    container_3d<by_enum::RowPlane> inter_solution_2_;
+    container_3d<by_enum::RowPlane> difference_;
+
+    explicit heat_hundsdorfer_verwer_method_3d() = delete;
+
+    void initialize(bool is_heat_source_set);
+
+    void split_0(double const &y, double const &z, double const &time, strided_span<double> const &low,
+                 strided_span<double> const &diag, strided_span<double> const &high);
+
+    void split_1(double const &x, double const &z, double const &time, strided_span<double> const &low,
+                 strided_span<double> const &diag, strided_span<double> const &high);
+
+    void split_2(double const &x, double const &y, double const &time, strided_span<double> const &low,
+                 strided_span<double> const &diag, strided_span<double> const &high);
+
+  public:
+    explicit heat_hundsdorfer_verwer_method_3d(tridiagonal_solver_ptrs const &solvery1_ptrs,
+                                               tridiagonal_solver_ptrs const &solvery2_ptrs,
+                                               tridiagonal_solver_ptrs const &solveru_ptrs,
+                                               hhw_implicit_coefficients_ptr const &coefficients,
+                                               grid_config_3d_ptr const &grid_config, bool is_heat_source_set,
+                                               thread_pool_ptr const &thread_pool, solver_stats_ptr const &stats);
+
+    ~heat_hundsdorfer_verwer_method_3d();
+
+    heat_hundsdorfer_verwer_method_3d(heat_hundsdorfer_verwer_method_3d const &) = delete;
+    heat_hundsdorfer_verwer_method_3d(heat_hundsdorfer_verwer_method_3d &&) = delete;
+    heat_hundsdorfer_verwer_method_3d &operator=(heat_hundsdorfer_verwer_method_3d const &) = delete;
+    heat_hundsdorfer_verwer_method_3d &operator=(heat_hundsdorfer_verwer_method_3d &&) = delete;
+
+    void solve(container_3d<by_enum::RowPlane> const &prev_solution, boundary_3d_pair const &x_boundary_pair,
+               boundary_3d_pair const &y_boundary_pair, boundary_3d_pair const &z_boundary_pair, double const &time,
+               container_3d<by_enum::RowPlane> &solution) override;
+
+    void solve(container_3d<by_enum::RowPlane> const &prev_solution, boundary_3d_pair const &x_boundary_pair,
+               boundary_3d_pair const &y_boundary_pair, boundary_3d_pair const &z_boundary_pair, double const &time,
+               std::function<double(double, double, double)> const &heat_source,
+               container_3d<by_enum::RowPlane> &solution) override;
+};
+
+} // namespace three_dimensional
+
+} // namespace lss_pde_solvers
+
+#endif ///_LSS_HEAT_HUNDSDORFER_VERWER_METHOD_3D_HPP_
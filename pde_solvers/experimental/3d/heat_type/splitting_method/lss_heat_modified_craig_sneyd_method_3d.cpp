@@ -0,0 +1,216 @@
+#include "lss_heat_modified_craig_sneyd_method_3d.hpp"
+
+#include <utility>
+
+#include "../../../../../common/lss_macros.hpp"
+#include "../../../../../discretization/lss_grid.hpp"
+
+namespace lss_pde_solvers
+{
+
+using lss_grids::grid_3d;
+
+namespace three_dimensional
+{
+
+void heat_modified_craig_sneyd_method_3d::initialize(bool is_heat_source_set)
+{
+}
+
+void heat_modified_craig_sneyd_method_3d::split_0(double const &y, double const &z, double const &time,
+                                                  strided_span<double> const &low, strided_span<double> const &diag,
+                                                  strided_span<double> const &high)
+{
+    LSS_STATS_PHASE(stats_, solver_phase_enum::Coefficients);
+    double x{};
+    for (std::size_t t = 0; t < low.size(); ++t)
+    {
+        x = grid_3d::value_1(grid_cfg_, t);
+        low[t] = (-coefficients_->theta_ * coefficients_->M_1_(time, x, y, z));
+        diag[t] = (cone_ + ctwo_ * coefficients_->theta_ * coefficients_->S_1_(time, x, y, z));
+        high[t] = (-coefficients_->theta_ * coefficients_->P_1_(time, x, y, z));
+    }
+}
+
+void heat_modified_craig_sneyd_method_3d::split_1(double const &x, double const &z, double const &time,
+                                                  strided_span<double> const &low, strided_span<double> const &diag,
+                                                  strided_span<double> const &high)
+{
+    LSS_STATS_PHASE(stats_, solver_phase_enum::Coefficients);
+    double y{};
+    for (std::size_t t = 0; t < low.size(); ++t)
+    {
+        y = grid_3d::value_2(grid_cfg_, t);
+        low[t] = (-coefficients_->theta_ * coefficients_->M_2_(time, x, y, z));
+        diag[t] = (cone_ + ctwo_ * coefficients_->theta_ * coefficients_->S_2_(time, x, y, z));
+        high[t] = (-coefficients_->theta_ * coefficients_->P_2_(time, x, y, z));
+    }
+}
+
+void heat_modified_craig_sneyd_method_3d::split_2(double const &x, double const &y, double const &time,
+                                                  strided_span<double> const &low, strided_span<double> const &diag,
+                                                  strided_span<double> const &high)
+{
+    LSS_STATS_PHASE(stats_, solver_phase_enum::Coefficients);
+    double z{};
+    for (std::size_t t = 0; t < low.size(); ++t)
+    {
+        z = grid_3d::value_3(grid_cfg_, t);
+        low[t] = (-coefficients_->theta_ * coefficients_->M_3_(time, x, y, z));
+        diag[t] = (cone_ + ctwo_ * coefficients_->theta_ * coefficients_->S_3_(time, x, y, z));
+        high[t] = (-coefficients_->theta_ * coefficients_->P_3_(time, x, y, z));
+    }
+}
+
+heat_modified_craig_sneyd_method_3d::heat_modified_craig_sneyd_method_3d(
+    tridiagonal_solver_ptrs const &solvery1_ptrs, tridiagonal_solver_ptrs const &solvery2_ptrs,
+    tridiagonal_solver_ptrs const &solveru_ptrs, hhw_implicit_coefficients_ptr const &coefficients,
+    grid_config_3d_ptr const &grid_config, bool is_heat_source_set, thread_pool_ptr const &thread_pool,
+    solver_stats_ptr const &stats)
+    : heat_splitting_method_3d(stats), coefficients_{coefficients}, grid_cfg_{grid_config}, thread_pool_{thread_pool},
+      workspace_x_{heat_splitting_workspace_3d::create(solvery1_ptrs, coefficients->space_size_x_, stats)},
+      workspace_y_{heat_splitting_workspace_3d::create(solvery2_ptrs, coefficients->space_size_y_, stats)},
+      workspace_z_{heat_splitting_workspace_3d::create(solveru_ptrs, coefficients->space_size_z_, stats)},
+      inter_solution_1_(coefficients->space_size_x_, coefficients->space_size_y_, coefficients->space_size_z_,
+                        double{}),
+      inter_solution_2_(coefficients->space_size_x_, coefficients->space_size_y_, coefficients->space_size_z_,
+                        double{}),
+      difference_(coefficients->space_size_x_, coefficients->space_size_y_, coefficients->space_size_z_, double{})
+{
+    LSS_ASSERT((solvery1_ptrs.size() == solvery2_ptrs.size()) && (solvery1_ptrs.size() == solveru_ptrs.size()),
+               "All sweeps must have the same number of solvers");
+    LSS_ASSERT(solvery1_ptrs.size() > 0, "At least one solver per sweep is required");
+    LSS_STATS_ADD(stats_, add_bytes_allocated,
+                  3 * coefficients->space_size_x_ * coefficients->space_size_y_ * coefficients->space_size_z_ *
+                      sizeof(double));
+    initialize(is_heat_source_set);
+}
+
+heat_modified_craig_sneyd_method_3d::~heat_modified_craig_sneyd_method_3d()
+{
+}
+
+void heat_modified_craig_sneyd_method_3d::solve(container_3d<by_enum::RowPlane> const &prev_solution,
+                                                boundary_3d_pair const &x_boundary_pair,
+                                                boundary_3d_pair const &y_boundary_pair,
+                                                boundary_3d_pair const &z_boundary_pair, double const &time,
+                                                container_3d<by_enum::RowPlane> &solution)
+{
+    const std::size_t inner_x = coefficients_->space_size_x_ - 2;
+    const std::size_t inner_y = coefficients_->space_size_y_ - 2;
+    const std::size_t inner_z = coefficients_->space_size_z_ - 2;
+    auto const theta = coefficients_->theta_;
+    auto const zeta = coefficients_->zeta_;
+    // predictor: Y_1 and Y_2 are kept, Y_3 is written into solution:
+    sweep(thread_pool_, workspace_x_, inner_y * inner_z, x_boundary_pair, time,
+          [&](std::size_t l, heat_splitting_line_3d const &line) {
+              const std::size_t j = 1 + l / inner_z;
+              const std::size_t k = 1 + l % inner_z;
+              const double y = grid_3d::value_2(grid_cfg_, j);
+              const double z = grid_3d::value_3(grid_cfg_, k);
+              split_0(y, z, time, line.low_, line.diag_, line.high_);
+              LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+              implicit_hhw_scheme::rhs_intermed_1(coefficients_, grid_cfg_, j, y, k, z, prev_solution, time,
+                                                  line.rhs_);
+              return std::make_pair(y, z);
+          },
+          [&](std::size_t l, strided_span<const double> const &line_solution) {
+              inter_solution_1_.row_line(1 + l / inner_z, 1 + l % inner_z).copy_from(line_solution);
+          });
+
+    sweep(thread_pool_, workspace_y_, inner_x * inner_z, y_boundary_pair, time,
+          [&](std::size_t l, heat_splitting_line_3d const &line) {
+              const std::size_t i = 1 + l / inner_z;
+              const std::size_t k = 1 + l % inner_z;
+              const double x = grid_3d::value_1(grid_cfg_, i);
+              const double z = grid_3d::value_3(grid_cfg_, k);
+              split_1(x, z, time, line.low_, line.diag_, line.high_);
+              LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+              implicit_hhw_scheme::rhs_intermed_2(coefficients_, grid_cfg_, i, x, k, z, prev_solution,
+                                                  inter_solution_1_, time, line.rhs_);
+              return std::make_pair(x, z);
+          },
+          [&](std::size_t l, strided_span<const double> const &line_solution) {
+              inter_solution_2_.column_line(1 + l / inner_z, 1 + l % inner_z).copy_from(line_solution);
+          });
+
+    sweep(thread_pool_, workspace_z_, inner_x * inner_y, z_boundary_pair, time,
+          [&](std::size_t l, heat_splitting_line_3d const &line) {
+              const std::size_t i = 1 + l / inner_y;
+              const std::size_t j = 1 + l % inner_y;
+              const double x = grid_3d::value_1(grid_cfg_, i);
+              const double y = grid_3d::value_2(grid_cfg_, j);
+              split_2(x, y, time, line.low_, line.diag_, line.high_);
+              LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+              implicit_hhw_scheme::rhs(coefficients_, grid_cfg_, i, x, j, y, prev_solution, inter_solution_2_, time,
+                                       line.rhs_);
+              return std::make_pair(x, y);
+          },
+          [&](std::size_t l, strided_span<const double> const &line_solution) {
+              solution.layer_line(1 + l / inner_y, 1 + l % inner_y).copy_from(line_solution);
+          });
+
+    implicit_hhw_scheme::difference(solution, prev_solution, difference_);
+
+    // corrector: each x-line reads only its own line of Y_1, so it is overwritten in place:
+    sweep(thread_pool_, workspace_x_, inner_y * inner_z, x_boundary_pair, time,
+          [&](std::size_t l, heat_splitting_line_3d const &line) {
+              const std::size_t j = 1 + l / inner_z;
+              const std::size_t k = 1 + l % inner_z;
+              const double y = grid_3d::value_2(grid_cfg_, j);
+              const double z = grid_3d::value_3(grid_cfg_, k);
+              split_0(y, z, time, line.low_, line.diag_, line.high_);
+              LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+              implicit_hhw_scheme::rhs_corrector_1(coefficients_, grid_cfg_, j, y, k, z, inter_solution_1_,
+                                                   difference_, zeta, zeta - theta, zeta - theta, time, line.rhs_);
+              return std::make_pair(y, z);
+          },
+          [&](std::size_t l, strided_span<const double> const &line_solution) {
+              inter_solution_1_.row_line(1 + l / inner_z, 1 + l % inner_z).copy_from(line_solution);
+          });
+
+    sweep(thread_pool_, workspace_y_, inner_x * inner_z, y_boundary_pair, time,
+          [&](std::size_t l, heat_splitting_line_3d const &line) {
+              const std::size_t i = 1 + l / inner_z;
+              const std::size_t k = 1 + l % inner_z;
+              const double x = grid_3d::value_1(grid_cfg_, i);
+              const double z = grid_3d::value_3(grid_cfg_, k);
+              split_1(x, z, time, line.low_, line.diag_, line.high_);
+              LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+              implicit_hhw_scheme::rhs_intermed_2(coefficients_, grid_cfg_, i, x, k, z, prev_solution,
+                                                  inter_solution_1_, time, line.rhs_);
+              return std::make_pair(x, z);
+          },
+          [&](std::size_t l, strided_span<const double> const &line_solution) {
+              inter_solution_2_.column_line(1 + l / inner_z, 1 + l % inner_z).copy_from(line_solution);
+          });
+
+    sweep(thread_pool_, workspace_z_, inner_x * inner_y, z_boundary_pair, time,
+          [&](std::size_t l, heat_splitting_line_3d const &line) {
+              const std::size_t i = 1 + l / inner_y;
+              const std::size_t j = 1 + l % inner_y;
+              const double x = grid_3d::value_1(grid_cfg_, i);
+              const double y = grid_3d::value_2(grid_cfg_, j);
+              split_2(x, y, time, line.low_, line.diag_, line.high_);
+              LSS_STATS_PHASE(stats_, solver_phase_enum::RightHandSide);
+              implicit_hhw_scheme::rhs(coefficients_, grid_cfg_, i, x, j, y, prev_solution, inter_solution_2_, time,
+                                       line.rhs_);
+              return std::make_pair(x, y);
+          },
+          [&](std::size_t l, strided_span<const double> const &line_solution) {
+              solution.layer_line(1 + l / inner_y, 1 + l % inner_y).copy_from(line_solution);
+          });
+}
+
+void heat_modified_craig_sneyd_method_3d::solve(container_3d<by_enum::RowPlane> const &prev_solution,
+                                                boundary_3d_pair const &x_boundary_pair,
+                                                boundary_3d_pair const &y_boundary_pair,
+                                                boundary_3d_pair const &z_boundary_pair, double const &time,
+                                                std::function<double(double, double, double)> const &heat_source,
+                                                container_3d<by_enum::RowPlane> &solution)
+{
+}
+
+} // namespace three_dimensional
+
+} // namespace lss_pde_solvers
@@ -6,7 +6,27 @@ namespace lss_pde_solvers
 namespace three_dimensional
 {
 
-heat_splitting_method_3d::heat_splitting_method_3d()
+heat_splitting_workspace_3d::heat_splitting_workspace_3d(
+    lss_tridiagonal_solver::tridiagonal_solver_ptr const &solver_ptr, std::size_t size)
+    : solver_ptr_{solver_ptr}, batch_(size, 0)
+{
+}
+
+std::vector<heat_splitting_workspace_3d> heat_splitting_workspace_3d::create(tridiagonal_solver_ptrs const &solver_ptrs,
+                                                                             std::size_t size,
+                                                                             solver_stats_ptr const &stats)
+{
+    std::vector<heat_splitting_workspace_3d> workspaces;
+    workspaces.reserve(solver_ptrs.size());
+    for (auto const &solver_ptr : solver_ptrs)
+    {
+        solver_ptr->set_stats(stats);
+        workspaces.emplace_back(solver_ptr, size);
+    }
+    return workspaces;
+}
+
+heat_splitting_method_3d::heat_splitting_method_3d(solver_stats_ptr const &stats) : stats_{stats}
 {
 }
 
@@ -14,6 +34,43 @@ heat_splitting_method_3d::~heat_splitting_method_3d()
 {
 }
 
+void heat_splitting_method_3d::sweep(thread_pool_ptr const &pool, heat_splitting_workspaces_3d &workspaces,
+                                     std::size_t lines_count, boundary_3d_pair const &boundary, double time,
+                                     line_assembler_3d const &assemble, line_collector_3d const &collect) const
+{
+    const std::size_t workers = workspaces.size();
+    pool->parallel_for(0, workers, [&](std::size_t worker_idx, std::size_t w) {
+        auto &ws = workspaces[w];
+        // worker w takes the contiguous chunk [n*w/workers, n*(w+1)/workers):
+        const std::size_t begin = (lines_count * w) / workers;
+        const std::size_t end = (lines_count * (w + 1)) / workers;
+        const std::size_t count = end - begin;
+        // chunk sizes do not change between time steps so the batch is sized only once:
+        if (ws.batch_.systems_count() != count)
+        {
+            ws.batch_.resize(count);
+            ws.space_1_args_.resize(count);
+            ws.space_2_args_.resize(count);
+            // diagonals, right-hand sides and solutions of the batch:
+            LSS_STATS_ADD(stats_, add_bytes_allocated, 5 * count * ws.batch_.system_size() * sizeof(double));
+        }
+        for (std::size_t s = 0; s < count; ++s)
+        {
+            const heat_splitting_line_3d line{ws.batch_.low(s), ws.batch_.diag(s), ws.batch_.high(s),
+                                              ws.batch_.rhs(s)};
+            const auto args = assemble(begin + s, line);
+            ws.space_1_args_[s] = args.first;
+            ws.space_2_args_[s] = args.second;
+        }
+        ws.solver_ptr_->solve(boundary, ws.batch_, time, ws.space_1_args_, ws.space_2_args_);
+        LSS_STATS_PHASE(stats_, solver_phase_enum::Copy);
+        for (std::size_t s = 0; s < count; ++s)
+        {
+            collect(begin + s, ws.batch_.solution(s));
+        }
+    });
+}
+
 } // namespace three_dimensional
 
 } // namespace lss_pde_solvers
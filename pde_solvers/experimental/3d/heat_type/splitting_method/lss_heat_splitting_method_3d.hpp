@@ -2,12 +2,19 @@
 #define _LSS_HEAT_SPLITTING_METHOD_3D_HPP_
 
 #include <functional>
+#include <utility>
+#include <vector>
 
 #include "../../../../../boundaries/lss_boundary.hpp"
 #include "../../../../../common/lss_enumerations.hpp"
 #include "../../../../../common/lss_macros.hpp"
+#include "../../../../../common/lss_solver_stats.hpp"
+#include "../../../../../common/lss_thread_pool.hpp"
 #include "../../../../../common/lss_utility.hpp"
 #include "../../../../../containers/lss_container_3d.hpp"
+#include "../../../../../containers/lss_strided_span.hpp"
+#include "../../../../../sparse_solvers/tridiagonal/lss_tridiagonal_batch.hpp"
+#include "../../../../../sparse_solvers/tridiagonal/lss_tridiagonal_solver.hpp"
 
 namespace lss_pde_solvers
 {
@@ -17,16 +24,98 @@ namespace three_dimensional
 using lss_boundary::boundary_3d_pair;
 using lss_boundary::boundary_3d_ptr;
 using lss_containers::container_3d;
+using lss_containers::strided_span;
 using lss_enumerations::by_enum;
+using lss_enumerations::solver_phase_enum;
+using lss_utility::container_t;
+using lss_utility::solver_stats_ptr;
 using lss_utility::sptr_t;
+using lss_utility::thread_pool_ptr;
+
+using tridiagonal_solver_ptrs = std::vector<lss_tridiagonal_solver::tridiagonal_solver_ptr>;
+
+/**
+    heat_splitting_workspace_3d structure
+
+    Solver and batch of line systems owned by a single sweep worker.
+ */
+struct heat_splitting_workspace_3d
+{
+    lss_tridiagonal_solver::tridiagonal_solver_ptr solver_ptr_;
+    lss_tridiagonal_solver::tridiagonal_batch batch_;
+    container_t space_1_args_, space_2_args_;
+
+    explicit heat_splitting_workspace_3d(lss_tridiagonal_solver::tridiagonal_solver_ptr const &solver_ptr,
+                                         std::size_t size);
+
+    /**
+        @brief  Creates one workspace per solver
+        @param  solver_ptrs - one solver per worker
+        @param  size - size of the line systems
+        @param  stats - statistics the solvers record into
+        @retval vector of workspaces
+    **/
+    static std::vector<heat_splitting_workspace_3d> create(tridiagonal_solver_ptrs const &solver_ptrs,
+                                                           std::size_t size, solver_stats_ptr const &stats);
+};
+
+using heat_splitting_workspaces_3d = std::vector<heat_splitting_workspace_3d>;
+
+/**
+    heat_splitting_line_3d structure
+
+    Views of a single line system inside the worker's batch.
+ */
+struct heat_splitting_line_3d
+{
+    strided_span<double> low_, diag_, high_, rhs_;
+};
+
+// fills the line system with given index and returns its pair of space arguments:
+using line_assembler_3d = std::function<std::pair<double, double>(std::size_t, heat_splitting_line_3d const &)>;
+// receives solution of the line with given index:
+using line_collector_3d = std::function<void(std::size_t, strided_span<const double> const &)>;
 
 /**
     heat_splitting_method_3d object
  */
 class heat_splitting_method_3d
 {
+  protected:
+    solver_stats_ptr stats_;
+
+    /**
+        @brief  Solves lines [0, lines_count) of one sweep direction, each worker submits its chunk as one batch
+        @param  pool - workers sweeping the lines
+        @param  workspaces - one workspace per worker
+        @param  lines_count - number of lines in the sweep
+        @param  boundary - boundary pair shared by all lines
+        @param  time - time at which the boundary is evaluated
+        @param  assemble - fills the line system and returns its space arguments
+        @param  collect - receives solution of the line
+    **/
+    void sweep(thread_pool_ptr const &pool, heat_splitting_workspaces_3d &workspaces, std::size_t lines_count,
+               boundary_3d_pair const &boundary, double time, line_assembler_3d const &assemble,
+               line_collector_3d const &collect) const;
+
+    /**
+        @brief  Copies intermediate solution into the other storage order
+        @param  to - destination
+        @param  from - source
+    **/
+    template <typename to_container, typename from_container>
+    void copy_solution(to_container &to, from_container const &from) const
+    {
+        LSS_STATS_PHASE(stats_, solver_phase_enum::Copy);
+        to = from;
+    }
+
   public:
-    explicit heat_splitting_method_3d();
+    /**
+        @brief  heat_splitting_method_3d object constructor
+        @param  stats - statistics the splitting method records into (null records nothing)
+    **/
+    explicit heat_splitting_method_3d(solver_stats_ptr const &stats);
 
     ~heat_splitting_method_3d();
 
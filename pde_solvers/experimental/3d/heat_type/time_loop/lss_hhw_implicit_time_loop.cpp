@@ -6,6 +6,7 @@ namespace lss_pde_solvers
 {
 
 using lss_boundary::dirichlet_boundary_3d;
+using lss_enumerations::solver_phase_enum;
 
 namespace three_dimensional
 {
@@ -74,7 +75,7 @@ void hhw_implicit_time_loop::run(heat_splitting_method_3d_ptr const &solver_ptr,
                                  range_ptr const &time_range, std::size_t const &last_time_idx, double const time_step,
                                  traverse_direction_enum const &traverse_dir,
                                  container_3d<by_enum::RowPlane> &prev_solution,
-                                 container_3d<by_enum::RowPlane> &next_solution)
+                                 container_3d<by_enum::RowPlane> &next_solution, solver_stats_ptr const &stats)
 {
 
     const double start_time = time_range->lower();
@@ -102,7 +103,10 @@ void hhw_implicit_time_loop::run(heat_splitting_method_3d_ptr const &solver_ptr,
                               next_solution);
             boundary_solver_ptr->solve(prev_solution, x_boundary_pair, z_boundary_pair, time, next_solution);
 
-            prev_solution = next_solution;
+            {
+                LSS_STATS_PHASE(stats, solver_phase_enum::Copy);
+                prev_solution = next_solution;
+            }
             time += k;
             time_idx++;
         }
@@ -148,7 +152,10 @@ void hhw_implicit_time_loop::run(heat_splitting_method_3d_ptr const &solver_ptr,
             //     }
             // }
 
-            prev_solution = next_solution;
+            {
+                LSS_STATS_PHASE(stats, solver_phase_enum::Copy);
+                prev_solution = next_solution;
+            }
             time -= k;
         } while (time_idx > 0);
     }
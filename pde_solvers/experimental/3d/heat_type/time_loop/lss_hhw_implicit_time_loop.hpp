@@ -54,7 +54,7 @@ class hhw_implicit_time_loop
                     boundary_3d_pair const &z_boundary_pair, grid_config_3d_ptr const &grid_config,
                     range_ptr const &time_range, std::size_t const &last_time_idx, double const time_step,
                     traverse_direction_enum const &traverse_dir, container_3d<by_enum::RowPlane> &prev_solution,
-                    container_3d<by_enum::RowPlane> &next_solution);
+                    container_3d<by_enum::RowPlane> &next_solution, solver_stats_ptr const &stats = nullptr);
 };
 } // namespace three_dimensional
 } // namespace lss_pde_solvers
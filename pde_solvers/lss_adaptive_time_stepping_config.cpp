@@ -0,0 +1,40 @@
+#include "lss_adaptive_time_stepping_config.hpp"
+
+namespace lss_pde_solvers
+{
+
+adaptive_time_stepping_config::adaptive_time_stepping_config(double tolerance, double min_time_step,
+                                                             double max_time_step, double safety_factor)
+    : tolerance_{tolerance}, min_time_step_{min_time_step}, max_time_step_{max_time_step}, safety_factor_{safety_factor}
+{
+    LSS_VERIFY(tolerance_ > 0.0, "tolerance must be positive");
+    LSS_VERIFY(min_time_step_ > 0.0, "min_time_step must be positive");
+    LSS_VERIFY(max_time_step_ >= min_time_step_, "max_time_step must not be smaller than min_time_step");
+    LSS_VERIFY(((safety_factor_ > 0.0) && (safety_factor_ <= 1.0)), "safety_factor must lie in (0,1]");
+}
+
+adaptive_time_stepping_config::~adaptive_time_stepping_config()
+{
+}
+
+double adaptive_time_stepping_config::tolerance() const
+{
+    return tolerance_;
+}
+
+double adaptive_time_stepping_config::min_time_step() const
+{
+    return min_time_step_;
+}
+
+double adaptive_time_stepping_config::max_time_step() const
+{
+    return max_time_step_;
+}
+
+double adaptive_time_stepping_config::safety_factor() const
+{
+    return safety_factor_;
+}
+
+} // namespace lss_pde_solvers
@@ -0,0 +1,71 @@
+/**
+
+    @file      lss_adaptive_time_stepping_config.hpp
+    @brief     Adaptive time stepping configuration
+    @details   ~
+    @author    Michal Sara
+    @date      18.10.2026
+    @copyright  Michal Sara, 2021. All right reserved.
+
+**/
+#pragma once
+
+#if !defined(_LSS_ADAPTIVE_TIME_STEPPING_CONFIG_HPP_)
+#define _LSS_ADAPTIVE_TIME_STEPPING_CONFIG_HPP_
+
+#include <limits>
+
+#include "../common/lss_macros.hpp"
+#include "../common/lss_utility.hpp"
+
+namespace lss_pde_solvers
+{
+
+using lss_utility::sptr_t;
+
+/**
+    @struct adaptive_time_stepping_config
+    @brief  Local error control of the time loop
+    @details The number of time points of the discretization only sets the
+             initial time step. Each step is estimated by step doubling and the
+             step is grown or shrunk so that the estimated error stays within
+             the tolerance.
+**/
+struct adaptive_time_stepping_config
+{
+  private:
+    double tolerance_;
+    double min_time_step_;
+    double max_time_step_;
+    double safety_factor_;
+
+    explicit adaptive_time_stepping_config() = delete;
+
+  public:
+    /**
+        @brief adaptive_time_stepping_config object constructor
+        @param tolerance - maximal estimated error (max-norm) of single time step
+        @param min_time_step - steps are never shrunk below this value, they are accepted there whatever the error
+        @param max_time_step - steps are never grown above this value
+        @param safety_factor - factor in (0,1) damping the predicted step
+    **/
+    LSS_API explicit adaptive_time_stepping_config(double tolerance, double min_time_step = double(1.0e-8),
+                                                   double max_time_step = std::numeric_limits<double>::max(),
+                                                   double safety_factor = double(0.9));
+
+    LSS_API ~adaptive_time_stepping_config();
+
+    LSS_API double tolerance() const;
+
+    LSS_API double min_time_step() const;
+
+    LSS_API double max_time_step() const;
+
+    LSS_API double safety_factor() const;
+};
+
+using adaptive_time_stepping_config_ptr = sptr_t<adaptive_time_stepping_config>;
+
+} // namespace lss_pde_solvers
+
+#endif ///_LSS_ADAPTIVE_TIME_STEPPING_CONFIG_HPP_
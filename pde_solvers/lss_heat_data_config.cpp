@@ -1,5 +1,6 @@
 #include "lss_heat_data_config.hpp"
 
+#include <algorithm>
 #include <functional>
 
 #include "../common/lss_macros.hpp"
@@ -18,12 +19,36 @@ void heat_coefficient_data_config_1d::initialize()
 heat_coefficient_data_config_1d::heat_coefficient_data_config_1d(
     std::function<double(double, double)> const &a_coefficient,
     std::function<double(double, double)> const &b_coefficient,
-    std::function<double(double, double)> const &c_coefficient)
-    : a_coeff_{a_coefficient}, b_coeff_{b_coefficient}, c_coeff_{c_coefficient}
+    std::function<double(double, double)> const &c_coefficient, bool is_time_homogeneous)
+    : a_coeff_{a_coefficient}, b_coeff_{b_coefficient}, c_coeff_{c_coefficient},
+      is_time_homogeneous_{is_time_homogeneous}
 {
     initialize();
 }
 
+heat_coefficient_data_config_1d::heat_coefficient_data_config_1d(
+    std::vector<std::function<double(double)>> const &time_factors,
+    std::vector<std::function<double(double)>> const &space_factors)
+    : time_factors_{time_factors}, space_factors_{space_factors}
+{
+    LSS_VERIFY(time_factors_.size() == 3, "time_factors must hold factors of a, b and c coefficient");
+    LSS_VERIFY(space_factors_.size() == 3, "space_factors must hold factors of a, b and c coefficient");
+    auto const compose = [](std::function<double(double)> const &time_factor,
+                            std::function<double(double)> const &space_factor) {
+        LSS_VERIFY(space_factor, "space_factor must not be null");
+        if (!time_factor)
+            return std::function<double(double, double)>([=](double t, double x) { return space_factor(x); });
+        return std::function<double(double, double)>(
+            [=](double t, double x) { return time_factor(t) * space_factor(x); });
+    };
+    a_coeff_ = compose(time_factors_[0], space_factors_[0]);
+    b_coeff_ = compose(time_factors_[1], space_factors_[1]);
+    c_coeff_ = compose(time_factors_[2], space_factors_[2]);
+    is_time_homogeneous_ = std::none_of(time_factors_.begin(), time_factors_.end(),
+                                        [](std::function<double(double)> const &factor) { return bool(factor); });
+    initialize();
+}
+
 std::function<double(double, double)> const &heat_coefficient_data_config_1d::a_coefficient() const
 {
     return a_coeff_;
@@ -39,6 +64,26 @@ std::function<double(double, double)> const &heat_coefficient_data_config_1d::c_
     return c_coeff_;
 }
 
+bool heat_coefficient_data_config_1d::is_time_homogeneous() const
+{
+    return is_time_homogeneous_;
+}
+
+bool heat_coefficient_data_config_1d::is_separable() const
+{
+    return !space_factors_.empty();
+}
+
+std::vector<std::function<double(double)>> const &heat_coefficient_data_config_1d::time_factors() const
+{
+    return time_factors_;
+}
+
+std::vector<std::function<double(double)>> const &heat_coefficient_data_config_1d::space_factors() const
+{
+    return space_factors_;
+}
+
 void heat_coefficient_data_config_2d::initialize()
 {
     LSS_VERIFY(a_coeff_, "a_coefficient must not be null");
@@ -55,13 +100,40 @@ heat_coefficient_data_config_2d::heat_coefficient_data_config_2d(
     std::function<double(double, double, double)> const &c_coefficient,
     std::function<double(double, double, double)> const &d_coefficient,
     std::function<double(double, double, double)> const &e_coefficient,
-    std::function<double(double, double, double)> const &f_coefficient)
+    std::function<double(double, double, double)> const &f_coefficient, bool is_time_homogeneous)
     : a_coeff_{a_coefficient}, b_coeff_{b_coefficient}, c_coeff_{c_coefficient}, d_coeff_{d_coefficient},
-      e_coeff_{e_coefficient}, f_coeff_{f_coefficient}
+      e_coeff_{e_coefficient}, f_coeff_{f_coefficient}, is_time_homogeneous_{is_time_homogeneous}
 {
     initialize();
 }
 
+heat_coefficient_data_config_2d::heat_coefficient_data_config_2d(
+    std::vector<std::function<double(double)>> const &time_factors,
+    std::vector<std::function<double(double, double)>> const &space_factors)
+    : time_factors_{time_factors}, space_factors_{space_factors}
+{
+    LSS_VERIFY(time_factors_.size() == 6, "time_factors must hold factors of a, b, c, d, e and f coefficient");
+    LSS_VERIFY(space_factors_.size() == 6, "space_factors must hold factors of a, b, c, d, e and f coefficient");
+    auto const compose = [](std::function<double(double)> const &time_factor,
+                            std::function<double(double, double)> const &space_factor) {
+        LSS_VERIFY(space_factor, "space_factor must not be null");
+        if (!time_factor)
+            return std::function<double(double, double, double)>(
+                [=](double t, double x, double y) { return space_factor(x, y); });
+        return std::function<double(double, double, double)>(
+            [=](double t, double x, double y) { return time_factor(t) * space_factor(x, y); });
+    };
+    a_coeff_ = compose(time_factors_[0], space_factors_[0]);
+    b_coeff_ = compose(time_factors_[1], space_factors_[1]);
+    c_coeff_ = compose(time_factors_[2], space_factors_[2]);
+    d_coeff_ = compose(time_factors_[3], space_factors_[3]);
+    e_coeff_ = compose(time_factors_[4], space_factors_[4]);
+    f_coeff_ = compose(time_factors_[5], space_factors_[5]);
+    is_time_homogeneous_ = std::none_of(time_factors_.begin(), time_factors_.end(),
+                                        [](std::function<double(double)> const &factor) { return bool(factor); });
+    initialize();
+}
+
 std::function<double(double, double, double)> const &heat_coefficient_data_config_2d::a_coefficient() const
 {
     return a_coeff_;
@@ -92,6 +164,26 @@ std::function<double(double, double, double)> const &heat_coefficient_data_confi
     return f_coeff_;
 }
 
+bool heat_coefficient_data_config_2d::is_time_homogeneous() const
+{
+    return is_time_homogeneous_;
+}
+
+bool heat_coefficient_data_config_2d::is_separable() const
+{
+    return !space_factors_.empty();
+}
+
+std::vector<std::function<double(double)>> const &heat_coefficient_data_config_2d::time_factors() const
+{
+    return time_factors_;
+}
+
+std::vector<std::function<double(double, double)>> const &heat_coefficient_data_config_2d::space_factors() const
+{
+    return space_factors_;
+}
+
 void heat_coefficient_data_config_3d::initialize()
 {
     LSS_VERIFY(a_coeff_, "a_coefficient must not be null");
@@ -286,6 +378,26 @@ std::function<double(double, double)> const &heat_data_config_1d::c_coefficient(
     return coefficient_data_cfg_->c_coefficient();
 }
 
+bool heat_data_config_1d::is_time_homogeneous() const
+{
+    return coefficient_data_cfg_->is_time_homogeneous();
+}
+
+bool heat_data_config_1d::is_separable() const
+{
+    return coefficient_data_cfg_->is_separable();
+}
+
+std::vector<std::function<double(double)>> const &heat_data_config_1d::time_factors() const
+{
+    return coefficient_data_cfg_->time_factors();
+}
+
+std::vector<std::function<double(double)>> const &heat_data_config_1d::space_factors() const
+{
+    return coefficient_data_cfg_->space_factors();
+}
+
 void heat_data_config_2d::initialize()
 {
     LSS_VERIFY(coefficient_data_cfg_, "coefficient_data_config must not be null");
@@ -345,6 +457,26 @@ std::function<double(double, double, double)> const &heat_data_config_2d::f_coef
     return coefficient_data_cfg_->f_coefficient();
 }
 
+bool heat_data_config_2d::is_time_homogeneous() const
+{
+    return coefficient_data_cfg_->is_time_homogeneous();
+}
+
+bool heat_data_config_2d::is_separable() const
+{
+    return coefficient_data_cfg_->is_separable();
+}
+
+std::vector<std::function<double(double)>> const &heat_data_config_2d::time_factors() const
+{
+    return coefficient_data_cfg_->time_factors();
+}
+
+std::vector<std::function<double(double, double)>> const &heat_data_config_2d::space_factors() const
+{
+    return coefficient_data_cfg_->space_factors();
+}
+
 void heat_data_config_3d::initialize()
 {
     LSS_VERIFY(coefficient_data_cfg_, "coefficient_data_config must not be null");
@@ -2,6 +2,7 @@
 #define _LSS_HEAT_DATA_CONFIG_HPP_
 
 #include <functional>
+#include <vector>
 
 #include "../common/lss_macros.hpp"
 #include "../common/lss_utility.hpp"
@@ -20,6 +21,9 @@ struct heat_coefficient_data_config_1d
     std::function<double(double, double)> a_coeff_;
     std::function<double(double, double)> b_coeff_;
     std::function<double(double, double)> c_coeff_;
+    bool is_time_homogeneous_;
+    std::vector<std::function<double(double)>> time_factors_;
+    std::vector<std::function<double(double)>> space_factors_;
 
     explicit heat_coefficient_data_config_1d() = delete;
 
@@ -28,13 +32,33 @@ struct heat_coefficient_data_config_1d
   public:
     explicit heat_coefficient_data_config_1d(std::function<double(double, double)> const &a_coefficient,
                                              std::function<double(double, double)> const &b_coefficient,
-                                             std::function<double(double, double)> const &c_coefficient);
+                                             std::function<double(double, double)> const &c_coefficient,
+                                             bool is_time_homogeneous = false);
+
+    /**
+        @brief heat_coefficient_data_config_1d object constructor for separable coefficients,
+               coefficient(t,x) = time_factor(t) * space_factor(x)
+        @param time_factors - time factors of a, b and c coefficient (null factor means constant in time)
+        @param space_factors - space factors of a, b and c coefficient
+    **/
+    explicit heat_coefficient_data_config_1d(std::vector<std::function<double(double)>> const &time_factors,
+                                             std::vector<std::function<double(double)>> const &space_factors);
 
     LSS_API std::function<double(double, double)> const &a_coefficient() const;
 
     LSS_API std::function<double(double, double)> const &b_coefficient() const;
 
     LSS_API std::function<double(double, double)> const &c_coefficient() const;
+
+    // true when the coefficients do not depend on time and may be tabulated once on the grid
+    LSS_API bool is_time_homogeneous() const;
+
+    // true when every coefficient is product of time factor and space factor
+    LSS_API bool is_separable() const;
+
+    LSS_API std::vector<std::function<double(double)>> const &time_factors() const;
+
+    LSS_API std::vector<std::function<double(double)>> const &space_factors() const;
 };
 
 /**
@@ -49,6 +73,9 @@ struct heat_coefficient_data_config_2d
     std::function<double(double, double, double)> d_coeff_;
     std::function<double(double, double, double)> e_coeff_;
     std::function<double(double, double, double)> f_coeff_;
+    bool is_time_homogeneous_;
+    std::vector<std::function<double(double)>> time_factors_;
+    std::vector<std::function<double(double, double)>> space_factors_;
 
     explicit heat_coefficient_data_config_2d() = delete;
 
@@ -60,7 +87,17 @@ struct heat_coefficient_data_config_2d
                                              std::function<double(double, double, double)> const &c_coefficient,
                                              std::function<double(double, double, double)> const &d_coefficient,
                                              std::function<double(double, double, double)> const &e_coefficient,
-                                             std::function<double(double, double, double)> const &f_coefficient);
+                                             std::function<double(double, double, double)> const &f_coefficient,
+                                             bool is_time_homogeneous = false);
+
+    /**
+        @brief heat_coefficient_data_config_2d object constructor for separable coefficients,
+               coefficient(t,x,y) = time_factor(t) * space_factor(x,y)
+        @param time_factors - time factors of a, b, c, d, e and f coefficient (null factor means constant in time)
+        @param space_factors - space factors of a, b, c, d, e and f coefficient
+    **/
+    explicit heat_coefficient_data_config_2d(std::vector<std::function<double(double)>> const &time_factors,
+                                             std::vector<std::function<double(double, double)>> const &space_factors);
 
     LSS_API std::function<double(double, double, double)> const &a_coefficient() const;
 
@@ -73,6 +110,16 @@ struct heat_coefficient_data_config_2d
     LSS_API std::function<double(double, double, double)> const &e_coefficient() const;
 
     LSS_API std::function<double(double, double, double)> const &f_coefficient() const;
+
+    // true when the coefficients do not depend on time and may be tabulated once on the grid
+    LSS_API bool is_time_homogeneous() const;
+
+    // true when every coefficient is product of time factor and space factor
+    LSS_API bool is_separable() const;
+
+    LSS_API std::vector<std::function<double(double)>> const &time_factors() const;
+
+    LSS_API std::vector<std::function<double(double, double)>> const &space_factors() const;
 };
 
 /**
@@ -273,6 +320,14 @@ struct heat_data_config_1d
     LSS_API std::function<double(double, double)> const &b_coefficient() const;
 
     LSS_API std::function<double(double, double)> const &c_coefficient() const;
+
+    LSS_API bool is_time_homogeneous() const;
+
+    LSS_API bool is_separable() const;
+
+    LSS_API std::vector<std::function<double(double)>> const &time_factors() const;
+
+    LSS_API std::vector<std::function<double(double)>> const &space_factors() const;
 };
 
 /**
@@ -311,6 +366,14 @@ struct heat_data_config_2d
     LSS_API std::function<double(double, double, double)> const &e_coefficient() const;
 
     LSS_API std::function<double(double, double, double)> const &f_coefficient() const;
+
+    LSS_API bool is_time_homogeneous() const;
+
+    LSS_API bool is_separable() const;
+
+    LSS_API std::vector<std::function<double(double)>> const &time_factors() const;
+
+    LSS_API std::vector<std::function<double(double, double)>> const &space_factors() const;
 };
 
 struct heat_data_config_3d
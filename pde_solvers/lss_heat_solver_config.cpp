@@ -3,14 +3,17 @@
 namespace lss_pde_solvers
 {
 
-heat_implicit_solver_config::heat_implicit_solver_config(memory_space_enum const &memory_space,
-                                                         traverse_direction_enum const &traverse_direction,
-                                                         tridiagonal_method_enum const &tridiagonal_method,
-                                                         factorization_enum const &tridiagonal_factorization,
-                                                         implicit_pde_scheme_ptr const &pde_scheme_ptr)
-    : pde_implicit_solver_config{memory_space, traverse_direction, tridiagonal_method, tridiagonal_factorization}
+heat_implicit_solver_config::heat_implicit_solver_config(
+    memory_space_enum const &memory_space, traverse_direction_enum const &traverse_direction,
+    tridiagonal_method_enum const &tridiagonal_method, factorization_enum const &tridiagonal_factorization,
+    implicit_pde_scheme_ptr const &pde_scheme_ptr, std::size_t number_of_threads, std::size_t rannacher_steps,
+    adaptive_time_stepping_config_ptr const &adaptive_time_stepping)
+    : pde_implicit_solver_config{memory_space, traverse_direction, tridiagonal_method, tridiagonal_factorization},
+      number_of_threads_{number_of_threads}, rannacher_steps_{rannacher_steps},
+      adaptive_time_stepping_{adaptive_time_stepping}
 {
     LSS_ASSERT(pde_scheme_ptr != nullptr, "heat_implicit_solver_config: implicit_pde_scheme must not be empty");
+    LSS_VERIFY(number_of_threads_ > 0, "number_of_threads must be positive");
     implicit_pde_scheme_value_ = pde_scheme_ptr->value();
 }
 
@@ -23,11 +26,29 @@ double heat_implicit_solver_config::implicit_pde_scheme_value() const
     return implicit_pde_scheme_value_;
 }
 
+std::size_t heat_implicit_solver_config::number_of_threads() const
+{
+    return number_of_threads_;
+}
+
+std::size_t heat_implicit_solver_config::rannacher_steps() const
+{
+    return rannacher_steps_;
+}
+
+adaptive_time_stepping_config_ptr const &heat_implicit_solver_config::adaptive_time_stepping() const
+{
+    return adaptive_time_stepping_;
+}
+
 heat_explicit_solver_config::heat_explicit_solver_config(memory_space_enum const &memory_space,
                                                          traverse_direction_enum const &traverse_direction,
-                                                         explicit_pde_schemes_enum const &explicit_pde_scheme)
-    : pde_explicit_solver_config{memory_space, traverse_direction}, explicit_pde_scheme_{explicit_pde_scheme}
+                                                         explicit_pde_schemes_enum const &explicit_pde_scheme,
+                                                         std::size_t number_of_threads)
+    : pde_explicit_solver_config{memory_space, traverse_direction}, explicit_pde_scheme_{explicit_pde_scheme},
+      number_of_threads_{number_of_threads}
 {
+    LSS_VERIFY(number_of_threads_ > 0, "number_of_threads must be positive");
 }
 
 heat_explicit_solver_config::~heat_explicit_solver_config()
@@ -38,4 +59,9 @@ explicit_pde_schemes_enum heat_explicit_solver_config::explicit_pde_scheme() con
 {
     return explicit_pde_scheme_;
 }
+
+std::size_t heat_explicit_solver_config::number_of_threads() const
+{
+    return number_of_threads_;
+}
 } // namespace lss_pde_solvers
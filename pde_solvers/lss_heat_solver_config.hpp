@@ -4,6 +4,7 @@
 #include "../common/lss_enumerations.hpp"
 #include "../common/lss_macros.hpp"
 #include "../common/lss_utility.hpp"
+#include "lss_adaptive_time_stepping_config.hpp"
 #include "lss_implicit_pde_scheme.hpp"
 #include "lss_pde_solver_config.hpp"
 
@@ -25,18 +26,40 @@ struct heat_implicit_solver_config : public pde_implicit_solver_config
 {
   private:
     double implicit_pde_scheme_value_;
+    std::size_t number_of_threads_;
+    std::size_t rannacher_steps_;
+    adaptive_time_stepping_config_ptr adaptive_time_stepping_;
 
     explicit heat_implicit_solver_config() = delete;
 
   public:
-    LSS_API explicit heat_implicit_solver_config(memory_space_enum const &memory_space,
-                                                 traverse_direction_enum const &traverse_direction,
-                                                 tridiagonal_method_enum const &tridiagonal_method,
-                                                 factorization_enum const &tridiagonal_factorization,
-                                                 implicit_pde_scheme_ptr const &implicit_pde_scheme);
+    LSS_API explicit heat_implicit_solver_config(
+        memory_space_enum const &memory_space, traverse_direction_enum const &traverse_direction,
+        tridiagonal_method_enum const &tridiagonal_method, factorization_enum const &tridiagonal_factorization,
+        implicit_pde_scheme_ptr const &implicit_pde_scheme, std::size_t number_of_threads = std::size_t(1),
+        std::size_t rannacher_steps = std::size_t(0),
+        adaptive_time_stepping_config_ptr const &adaptive_time_stepping = nullptr);
     LSS_API ~heat_implicit_solver_config();
 
     LSS_API double implicit_pde_scheme_value() const;
+
+    /**
+        @brief  Number of workers sharing single tridiagonal system in SPIKE Solver on Host
+        @retval number of threads (1 means serial solve on the calling thread)
+    **/
+    LSS_API std::size_t number_of_threads() const;
+
+    /**
+        @brief  Number of leading time steps taken as two fully implicit half-steps before the scheme takes over
+        @retval number of Rannacher start-up steps (0 means no start-up smoothing)
+    **/
+    LSS_API std::size_t rannacher_steps() const;
+
+    /**
+        @brief  Local error control of the time steps of the final solution
+        @retval adaptive time stepping config or null for fixed time steps
+    **/
+    LSS_API adaptive_time_stepping_config_ptr const &adaptive_time_stepping() const;
 };
 
 /**
@@ -46,16 +69,24 @@ struct heat_explicit_solver_config : public pde_explicit_solver_config
 {
   private:
     explicit_pde_schemes_enum explicit_pde_scheme_;
+    std::size_t number_of_threads_;
 
     explicit heat_explicit_solver_config() = delete;
 
   public:
     LSS_API explicit heat_explicit_solver_config(memory_space_enum const &memory_space,
                                                  traverse_direction_enum const &traverse_direction,
-                                                 explicit_pde_schemes_enum const &explicit_pde_scheme);
+                                                 explicit_pde_schemes_enum const &explicit_pde_scheme,
+                                                 std::size_t number_of_threads = std::size_t(1));
     LSS_API ~heat_explicit_solver_config();
 
     LSS_API explicit_pde_schemes_enum explicit_pde_scheme() const;
+
+    /**
+        @brief  Number of workers sweeping the rows of the explicit stencil on Host
+        @retval number of threads (1 means serial sweeps on the calling thread)
+    **/
+    LSS_API std::size_t number_of_threads() const;
 };
 
 using heat_implicit_solver_config_ptr = sptr_t<heat_implicit_solver_config>;
@@ -11,6 +11,16 @@ pde_discretization_config_1d::pde_discretization_config_1d(range_ptr const &spac
       number_of_time_points_{number_of_time_points}
 {
 }
+
+pde_discretization_config_1d::pde_discretization_config_1d(range_ptr const &space_range,
+                                                           std::size_t const &number_of_space_points,
+                                                           time_grid_config_ptr const &time_grid)
+    : lss_discretization::discretization_config_1d(space_range, number_of_space_points),
+      time_range_{time_grid->time_range()}, number_of_time_points_{time_grid->number_of_time_points()},
+      time_grid_{time_grid}
+{
+}
+
 pde_discretization_config_1d::~pde_discretization_config_1d()
 {
 }
@@ -29,6 +39,11 @@ double pde_discretization_config_1d::time_step() const
     return ((time_range_->spread()) / static_cast<double>(number_of_time_points_ - 1));
 }
 
+time_grid_config_ptr const &pde_discretization_config_1d::time_grid() const
+{
+    return time_grid_;
+}
+
 pde_discretization_config_2d::pde_discretization_config_2d(
     range_ptr const &space_range_1, range_ptr const &space_range_2, std::size_t const &number_of_space_points_1,
     std::size_t const &number_of_space_points_2, range_ptr const &time_range, std::size_t const &number_of_time_points)
@@ -38,18 +53,33 @@ pde_discretization_config_2d::pde_discretization_config_2d(
 {
 }
 
+pde_discretization_config_2d::pde_discretization_config_2d(range_ptr const &space_range_1,
+                                                           range_ptr const &space_range_2,
+                                                           std::size_t const &number_of_space_points_1,
+                                                           std::size_t const &number_of_space_points_2,
+                                                           time_grid_config_ptr const &time_grid)
+    : space_range_1_{space_range_1}, space_range_2_{space_range_2}, time_range_{time_grid->time_range()},
+      number_of_space_points_1_{number_of_space_points_1}, number_of_space_points_2_{number_of_space_points_2},
+      number_of_time_points_{time_grid->number_of_time_points()}, time_grid_{time_grid}
+{
+}
+
 pde_discretization_config_2d::~pde_discretization_config_2d()
 {
 }
 
 sptr_t<pde_discretization_config_1d> const pde_discretization_config_2d::pde_discretization_1() const
 {
+    if (time_grid_ != nullptr)
+        return std::make_shared<pde_discretization_config_1d>(space_range_1_, number_of_space_points_1_, time_grid_);
     return std::make_shared<pde_discretization_config_1d>(space_range_1_, number_of_space_points_1_, time_range_,
                                                           number_of_time_points_);
 }
 
 sptr_t<pde_discretization_config_1d> const pde_discretization_config_2d::pde_discretization_2() const
 {
+    if (time_grid_ != nullptr)
+        return std::make_shared<pde_discretization_config_1d>(space_range_2_, number_of_space_points_2_, time_grid_);
     return std::make_shared<pde_discretization_config_1d>(space_range_2_, number_of_space_points_2_, time_range_,
                                                           number_of_time_points_);
 }
@@ -85,6 +115,11 @@ double pde_discretization_config_2d::time_step() const
     return ((time_range_->spread()) / static_cast<double>(number_of_time_points_ - 1));
 }
 
+time_grid_config_ptr const &pde_discretization_config_2d::time_grid() const
+{
+    return time_grid_;
+}
+
 pde_discretization_config_3d::pde_discretization_config_3d(
     range_ptr const &space_range_1, range_ptr const &space_range_2, range_ptr const &space_range_3,
     std::size_t const &number_of_space_points_1, std::size_t const &number_of_space_points_2,
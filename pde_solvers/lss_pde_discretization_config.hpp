@@ -18,6 +18,7 @@
 #include "../common/lss_range.hpp"
 #include "../common/lss_utility.hpp"
 #include "../discretization/lss_discretization_config.hpp"
+#include "lss_time_grid_config.hpp"
 
 namespace lss_pde_solvers
 {
@@ -34,19 +35,38 @@ struct pde_discretization_config_1d final : public lss_discretization::discretiz
   private:
     range_ptr time_range_;
     std::size_t number_of_time_points_;
+    time_grid_config_ptr time_grid_;
 
     explicit pde_discretization_config_1d() = delete;
 
   public:
     explicit pde_discretization_config_1d(range_ptr const &space_range, std::size_t const &number_of_space_points,
                                           range_ptr const &time_range, std::size_t const &number_of_time_points);
+
+    /**
+        @brief pde_discretization_config_1d object constructor for non-uniform time grid
+        @param space_range - space range
+        @param number_of_space_points - number of space points
+        @param time_grid - time points, time range and number of time points follow from them
+    **/
+    explicit pde_discretization_config_1d(range_ptr const &space_range, std::size_t const &number_of_space_points,
+                                          time_grid_config_ptr const &time_grid);
     ~pde_discretization_config_1d();
 
     LSS_API range_ptr const &time_range() const;
 
     LSS_API std::size_t number_of_time_points() const;
 
+    /**
+        @brief  Time step of uniform time grid (mean time step of non-uniform one)
+    **/
     LSS_API double time_step() const;
+
+    /**
+        @brief  Non-uniform time grid
+        @retval time grid or null for uniform time grid
+    **/
+    LSS_API time_grid_config_ptr const &time_grid() const;
 };
 
 /**
@@ -61,6 +81,7 @@ struct pde_discretization_config_2d
     std::size_t number_of_space_points_1_;
     std::size_t number_of_space_points_2_;
     std::size_t number_of_time_points_;
+    time_grid_config_ptr time_grid_;
 
     explicit pde_discretization_config_2d() = delete;
 
@@ -69,6 +90,19 @@ struct pde_discretization_config_2d
                                           std::size_t const &number_of_space_points_1,
                                           std::size_t const &number_of_space_points_2, range_ptr const &time_range,
                                           std::size_t const &number_of_time_points);
+
+    /**
+        @brief pde_discretization_config_2d object constructor for non-uniform time grid
+        @param space_range_1 - first space range
+        @param space_range_2 - second space range
+        @param number_of_space_points_1 - number of points in first space range
+        @param number_of_space_points_2 - number of points in second space range
+        @param time_grid - time points, time range and number of time points follow from them
+    **/
+    explicit pde_discretization_config_2d(range_ptr const &space_range_1, range_ptr const &space_range_2,
+                                          std::size_t const &number_of_space_points_1,
+                                          std::size_t const &number_of_space_points_2,
+                                          time_grid_config_ptr const &time_grid);
     ~pde_discretization_config_2d();
 
     LSS_API sptr_t<pde_discretization_config_1d> const pde_discretization_1() const;
@@ -85,7 +119,16 @@ struct pde_discretization_config_2d
 
     LSS_API std::pair<double, double> space_step() const;
 
+    /**
+        @brief  Time step of uniform time grid (mean time step of non-uniform one)
+    **/
     LSS_API double time_step() const;
+
+    /**
+        @brief  Non-uniform time grid
+        @retval time grid or null for uniform time grid
+    **/
+    LSS_API time_grid_config_ptr const &time_grid() const;
 };
 
 /**
@@ -0,0 +1,42 @@
+#include "lss_separable_coefficients.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace lss_pde_solvers
+{
+
+separable_coefficients::separable_coefficients() : factors_time_{std::numeric_limits<double>::quiet_NaN()}
+{
+}
+
+separable_coefficients::separable_coefficients(std::vector<std::function<double(double)>> const &time_factors,
+                                               std::size_t number_of_coefficients)
+    : time_factors_{time_factors}, parts_(number_of_coefficients), factors_(time_factors.size(), double{}),
+      factors_time_{std::numeric_limits<double>::quiet_NaN()}
+{
+}
+
+separable_coefficients::~separable_coefficients()
+{
+}
+
+void separable_coefficients::add_part(std::size_t coefficient_idx, std::size_t factor_idx, container_t const &part)
+{
+    LSS_ASSERT(coefficient_idx < parts_.size(), "coefficient_idx is out of range");
+    LSS_ASSERT(factor_idx < time_factors_.size(), "factor_idx is out of range");
+    if (std::all_of(part.begin(), part.end(), [](double value) { return (value == 0.0); }))
+        return;
+    parts_[coefficient_idx].emplace_back(factor_idx, part);
+}
+
+void separable_coefficients::prepare(double time)
+{
+    if (time == factors_time_)
+        return;
+    for (std::size_t f = 0; f < time_factors_.size(); ++f)
+        factors_[f] = time_factors_[f](time);
+    factors_time_ = time;
+}
+
+} // namespace lss_pde_solvers
@@ -0,0 +1,89 @@
+/**
+
+    @file      lss_separable_coefficients.hpp
+    @brief     Tabulated separable coefficients
+    @details   ~
+    @author    Michal Sara
+    @date      18.10.2026
+    @copyright  Michal Sara, 2021. All right reserved.
+
+**/
+#pragma once
+
+#if !defined(_LSS_SEPARABLE_COEFFICIENTS_HPP_)
+#define _LSS_SEPARABLE_COEFFICIENTS_HPP_
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "../common/lss_macros.hpp"
+#include "../common/lss_utility.hpp"
+
+namespace lss_pde_solvers
+{
+
+using lss_utility::container_t;
+
+/**
+    @struct separable_coefficients
+    @brief  Coefficients given as sums of time factors multiplied by spatial parts
+    @details Spatial parts are tabulated once on the grid and only the scalar time
+             factors are evaluated per time. prepare is called before the coefficients
+             are read for a new time, value may then be read concurrently.
+**/
+struct separable_coefficients
+{
+  private:
+    std::vector<std::function<double(double)>> time_factors_;
+    // index of time factor and spatial part tabulated on the grid, for each coefficient:
+    std::vector<std::vector<std::pair<std::size_t, container_t>>> parts_;
+    container_t factors_;
+    double factors_time_;
+
+  public:
+    explicit separable_coefficients();
+
+    /**
+        @brief separable_coefficients object constructor
+        @param time_factors - time factors shared by all coefficients
+        @param number_of_coefficients - number of coefficients
+    **/
+    explicit separable_coefficients(std::vector<std::function<double(double)>> const &time_factors,
+                                    std::size_t number_of_coefficients);
+
+    ~separable_coefficients();
+
+    /**
+        @brief  Adds spatial part of a coefficient, part vanishing on the whole grid is dropped
+        @param  coefficient_idx - index of the coefficient
+        @param  factor_idx - index of the time factor multiplying the part
+        @param  part - spatial part tabulated on the grid
+    **/
+    void add_part(std::size_t coefficient_idx, std::size_t factor_idx, container_t const &part);
+
+    /**
+        @brief  Evaluates the time factors for given time
+        @param  time - time
+    **/
+    void prepare(double time);
+
+    inline double value(std::size_t coefficient_idx, double time, std::size_t idx) const
+    {
+        double result{};
+        if (time == factors_time_)
+        {
+            for (auto const &part : parts_[coefficient_idx])
+                result += factors_[part.first] * part.second[idx];
+            return result;
+        }
+        // time was not prepared:
+        for (auto const &part : parts_[coefficient_idx])
+            result += time_factors_[part.first](time) * part.second[idx];
+        return result;
+    }
+};
+
+} // namespace lss_pde_solvers
+
+#endif ///_LSS_SEPARABLE_COEFFICIENTS_HPP_
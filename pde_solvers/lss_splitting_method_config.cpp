@@ -3,9 +3,12 @@
 namespace lss_pde_solvers
 {
 
-splitting_method_config::splitting_method_config(splitting_method_enum splittitng_method, double weighting_value)
-    : splitting_method_{splittitng_method}, weighting_value_{weighting_value}
+splitting_method_config::splitting_method_config(splitting_method_enum splittitng_method, double weighting_value,
+                                                 std::size_t number_of_threads, std::size_t rannacher_steps)
+    : splitting_method_{splittitng_method}, weighting_value_{weighting_value}, number_of_threads_{number_of_threads},
+      rannacher_steps_{rannacher_steps}
 {
+    LSS_VERIFY(number_of_threads_ > 0, "number_of_threads must be positive");
 }
 
 splitting_method_config::~splitting_method_config()
@@ -22,4 +25,14 @@ double splitting_method_config::weighting_value() const
     return weighting_value_;
 }
 
+std::size_t splitting_method_config::number_of_threads() const
+{
+    return number_of_threads_;
+}
+
+std::size_t splitting_method_config::rannacher_steps() const
+{
+    return rannacher_steps_;
+}
+
 } // namespace lss_pde_solvers
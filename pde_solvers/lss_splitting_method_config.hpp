@@ -21,16 +21,33 @@ struct splitting_method_config
   private:
     splitting_method_enum splitting_method_;
     double weighting_value_;
+    std::size_t number_of_threads_;
+    std::size_t rannacher_steps_;
 
     explicit splitting_method_config() = delete;
 
   public:
-    explicit splitting_method_config(splitting_method_enum splittitng_method, double weighting_value = double(0.5));
+    explicit splitting_method_config(splitting_method_enum splittitng_method, double weighting_value = double(0.5),
+                                     std::size_t number_of_threads = std::size_t(1),
+                                     std::size_t rannacher_steps = std::size_t(0));
     ~splitting_method_config();
 
     LSS_API splitting_method_enum splitting_method() const;
 
     LSS_API double weighting_value() const;
+
+    /**
+        @brief  Number of workers sweeping the independent lines of each splitting step
+        @retval number of threads (1 means serial sweeps on the calling thread)
+    **/
+    LSS_API std::size_t number_of_threads() const;
+
+    /**
+        @brief  Number of leading time steps taken as two fully implicit Douglas half-steps before the splitting
+                method takes over
+        @retval number of Rannacher start-up steps (0 means no start-up smoothing)
+    **/
+    LSS_API std::size_t rannacher_steps() const;
 };
 
 using splitting_method_config_ptr = sptr_t<splitting_method_config>;
@@ -0,0 +1,69 @@
+#include "lss_time_grid_config.hpp"
+
+#include <cmath>
+
+namespace lss_pde_solvers
+{
+
+using lss_utility::range;
+
+time_grid_config::time_grid_config(container_t const &time_points) : time_points_{time_points}
+{
+    initialize();
+}
+
+time_grid_config::time_grid_config(range_ptr const &time_range, std::size_t const &number_of_time_points,
+                                   double accumulation_point, double alpha_scale)
+{
+    LSS_VERIFY(number_of_time_points > 1, "number_of_time_points must be at least 2");
+    LSS_VERIFY(alpha_scale > 0.0, "alpha_scale must be positive");
+    const double one = 1.0;
+    const double low = time_range->lower();
+    const double high = time_range->upper();
+    // same stretching as the non-uniform space grid, scaled by the whole range so the point may sit at either end:
+    const double alpha = (high - low) / alpha_scale;
+    const double c_0 = std::asinh((high - accumulation_point) / alpha);
+    const double c_1 = std::asinh((low - accumulation_point) / alpha);
+    const std::size_t N = number_of_time_points - 1;
+    time_points_.resize(number_of_time_points);
+    double zeta{};
+    for (std::size_t t = 1; t < N; ++t)
+    {
+        zeta = static_cast<double>(t) / static_cast<double>(N);
+        time_points_[t] = accumulation_point + alpha * std::sinh(c_0 * zeta + c_1 * (one - zeta));
+    }
+    time_points_[0] = low;
+    time_points_[N] = high;
+    initialize();
+}
+
+time_grid_config::~time_grid_config()
+{
+}
+
+void time_grid_config::initialize()
+{
+    LSS_VERIFY(time_points_.size() > 1, "time_points must hold at least 2 points");
+    for (std::size_t t = 1; t < time_points_.size(); ++t)
+    {
+        LSS_ASSERT(time_points_[t] > time_points_[t - 1], "time_points must be strictly increasing");
+    }
+    time_range_ = std::make_shared<range>(time_points_.front(), time_points_.back());
+}
+
+container_t const &time_grid_config::time_points() const
+{
+    return time_points_;
+}
+
+range_ptr const &time_grid_config::time_range() const
+{
+    return time_range_;
+}
+
+std::size_t time_grid_config::number_of_time_points() const
+{
+    return time_points_.size();
+}
+
+} // namespace lss_pde_solvers
@@ -0,0 +1,74 @@
+/**
+
+    @file      lss_time_grid_config.hpp
+    @brief     Non-uniform time grid configuration
+    @details   ~
+    @author    Michal Sara
+    @date      18.10.2026
+    @copyright  Michal Sara, 2021. All right reserved.
+
+**/
+#pragma once
+
+#if !defined(_LSS_TIME_GRID_CONFIG_HPP_)
+#define _LSS_TIME_GRID_CONFIG_HPP_
+
+#include "../common/lss_macros.hpp"
+#include "../common/lss_range.hpp"
+#include "../common/lss_utility.hpp"
+
+namespace lss_pde_solvers
+{
+
+using lss_utility::container_t;
+using lss_utility::range_ptr;
+using lss_utility::sptr_t;
+
+/**
+    @struct time_grid_config
+    @brief  Time points of non-uniform time grid
+    @details The first and the last point bound the time range, the time loops
+             step from one point to the next one, so steps may be clustered
+             around the payoff date or around dividend dates.
+**/
+struct time_grid_config
+{
+  private:
+    container_t time_points_;
+    range_ptr time_range_;
+
+    explicit time_grid_config() = delete;
+
+    void initialize();
+
+  public:
+    /**
+        @brief time_grid_config object constructor
+        @param time_points - user-supplied strictly increasing time points (at least two)
+    **/
+    LSS_API explicit time_grid_config(container_t const &time_points);
+
+    /**
+        @brief time_grid_config object constructor
+        @param time_range - time range
+        @param number_of_time_points - number of time points including both ends of the range
+        @param accumulation_point - point around which the steps get finer
+        @param alpha_scale - the higher the value the finer the steps get
+    **/
+    LSS_API explicit time_grid_config(range_ptr const &time_range, std::size_t const &number_of_time_points,
+                                      double accumulation_point, double alpha_scale = double(3.0));
+
+    ~time_grid_config();
+
+    LSS_API container_t const &time_points() const;
+
+    LSS_API range_ptr const &time_range() const;
+
+    LSS_API std::size_t number_of_time_points() const;
+};
+
+using time_grid_config_ptr = sptr_t<time_grid_config>;
+
+} // namespace lss_pde_solvers
+
+#endif ///_LSS_TIME_GRID_CONFIG_HPP_
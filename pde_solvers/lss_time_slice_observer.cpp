@@ -0,0 +1,32 @@
+#include "lss_time_slice_observer.hpp"
+
+#include <algorithm>
+
+namespace lss_pde_solvers
+{
+
+time_slice_decimation::time_slice_decimation(std::size_t every) : every_{every}
+{
+    LSS_VERIFY(every_ > 0, "every must be positive");
+}
+
+time_slice_decimation::time_slice_decimation(std::vector<std::size_t> const &time_indices)
+    : every_{0}, time_indices_{time_indices}
+{
+    std::sort(time_indices_.begin(), time_indices_.end());
+}
+
+time_slice_decimation::~time_slice_decimation()
+{
+}
+
+bool time_slice_decimation::is_observed(std::size_t time_idx) const
+{
+    if (every_ > 0)
+    {
+        return ((time_idx % every_) == 0);
+    }
+    return std::binary_search(time_indices_.begin(), time_indices_.end(), time_idx);
+}
+
+} // namespace lss_pde_solvers
@@ -0,0 +1,99 @@
+#if !defined(_LSS_TIME_SLICE_OBSERVER_HPP_)
+#define _LSS_TIME_SLICE_OBSERVER_HPP_
+
+#include <functional>
+#include <vector>
+
+#include "../common/lss_enumerations.hpp"
+#include "../common/lss_macros.hpp"
+#include "../common/lss_utility.hpp"
+#include "../containers/lss_container_2d.hpp"
+
+namespace lss_pde_solvers
+{
+
+using lss_containers::container_2d;
+using lss_enumerations::by_enum;
+using lss_utility::container_t;
+using lss_utility::sptr_t;
+
+/**
+    time_slice_decimation structure
+
+    Selects time indices whose slices are handed to an observer: either every
+    k-th time index (counted from time index 0) or an explicit list of them.
+ */
+struct time_slice_decimation
+{
+  private:
+    std::size_t every_;
+    std::vector<std::size_t> time_indices_;
+
+  public:
+    /**
+        @brief  Observes every k-th time index
+        @param  every - decimation step, 1 observes all time slices
+    **/
+    explicit time_slice_decimation(std::size_t every = std::size_t(1));
+
+    /**
+        @brief  Observes only the listed time indices
+        @param  time_indices - time indices to observe
+    **/
+    explicit time_slice_decimation(std::vector<std::size_t> const &time_indices);
+
+    ~time_slice_decimation();
+
+    LSS_API bool is_observed(std::size_t time_idx) const;
+};
+
+/**
+    time_slice_observer object
+
+    Receives read-only time slices of the solution while the time loop runs so
+    that they can be streamed or reduced instead of being stored all at once.
+ */
+template <typename slice_t> class time_slice_observer
+{
+  public:
+    // receives time index, time and the solution at that time:
+    using callback_t = std::function<void(std::size_t, double, slice_t const &)>;
+
+  private:
+    callback_t callback_;
+    time_slice_decimation decimation_;
+
+    explicit time_slice_observer() = delete;
+
+  public:
+    explicit time_slice_observer(callback_t const &callback,
+                                 time_slice_decimation const &decimation = time_slice_decimation())
+        : callback_{callback}, decimation_{decimation}
+    {
+        LSS_VERIFY(callback_, "callback must not be null");
+    }
+
+    /**
+        @brief  Hands the slice to the callback when its time index passes the decimation
+        @param  time_idx - time index of the slice
+        @param  time - time of the slice
+        @param  slice - solution at the time, valid only during the call
+    **/
+    inline void operator()(std::size_t time_idx, double time, slice_t const &slice) const
+    {
+        if (decimation_.is_observed(time_idx))
+        {
+            callback_(time_idx, time, slice);
+        }
+    }
+};
+
+using time_slice_observer_1d = time_slice_observer<container_t>;
+using time_slice_observer_2d = time_slice_observer<container_2d<by_enum::Row>>;
+
+using time_slice_observer_1d_ptr = sptr_t<time_slice_observer_1d>;
+using time_slice_observer_2d_ptr = sptr_t<time_slice_observer_2d>;
+
+} // namespace lss_pde_solvers
+
+#endif ///_LSS_TIME_SLICE_OBSERVER_HPP_
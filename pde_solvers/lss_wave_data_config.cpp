@@ -1,6 +1,8 @@
 #include "lss_wave_data_config.hpp"
 #include "../common/lss_macros.hpp"
 
+#include <algorithm>
+
 namespace lss_pde_solvers
 {
 
@@ -16,12 +18,37 @@ wave_coefficient_data_config_1d ::wave_coefficient_data_config_1d(
     std::function<double(double, double)> const &a_coefficient,
     std::function<double(double, double)> const &b_coefficient,
     std::function<double(double, double)> const &c_coefficient,
-    std::function<double(double, double)> const &d_coefficient)
-    : a_coeff_{a_coefficient}, b_coeff_{b_coefficient}, c_coeff_{c_coefficient}, d_coeff_{d_coefficient}
+    std::function<double(double, double)> const &d_coefficient, bool is_time_homogeneous)
+    : a_coeff_{a_coefficient}, b_coeff_{b_coefficient}, c_coeff_{c_coefficient}, d_coeff_{d_coefficient},
+      is_time_homogeneous_{is_time_homogeneous}
 {
     initialize();
 }
 
+wave_coefficient_data_config_1d::wave_coefficient_data_config_1d(
+    std::vector<std::function<double(double)>> const &time_factors,
+    std::vector<std::function<double(double)>> const &space_factors)
+    : time_factors_{time_factors}, space_factors_{space_factors}
+{
+    LSS_VERIFY(time_factors_.size() == 4, "time_factors must hold factors of a, b, c and d coefficient");
+    LSS_VERIFY(space_factors_.size() == 4, "space_factors must hold factors of a, b, c and d coefficient");
+    auto const compose = [](std::function<double(double)> const &time_factor,
+                            std::function<double(double)> const &space_factor) {
+        LSS_VERIFY(space_factor, "space_factor must not be null");
+        if (!time_factor)
+            return std::function<double(double, double)>([=](double t, double x) { return space_factor(x); });
+        return std::function<double(double, double)>(
+            [=](double t, double x) { return time_factor(t) * space_factor(x); });
+    };
+    a_coeff_ = compose(time_factors_[0], space_factors_[0]);
+    b_coeff_ = compose(time_factors_[1], space_factors_[1]);
+    c_coeff_ = compose(time_factors_[2], space_factors_[2]);
+    d_coeff_ = compose(time_factors_[3], space_factors_[3]);
+    is_time_homogeneous_ = std::none_of(time_factors_.begin(), time_factors_.end(),
+                                        [](std::function<double(double)> const &factor) { return bool(factor); });
+    initialize();
+}
+
 std::function<double(double, double)> const &wave_coefficient_data_config_1d::a_coefficient() const
 {
     return a_coeff_;
@@ -42,6 +69,26 @@ std::function<double(double, double)> const &wave_coefficient_data_config_1d::d_
     return d_coeff_;
 }
 
+bool wave_coefficient_data_config_1d::is_time_homogeneous() const
+{
+    return is_time_homogeneous_;
+}
+
+bool wave_coefficient_data_config_1d::is_separable() const
+{
+    return !space_factors_.empty();
+}
+
+std::vector<std::function<double(double)>> const &wave_coefficient_data_config_1d::time_factors() const
+{
+    return time_factors_;
+}
+
+std::vector<std::function<double(double)>> const &wave_coefficient_data_config_1d::space_factors() const
+{
+    return space_factors_;
+}
+
 wave_initial_data_config_1d::wave_initial_data_config_1d(std::function<double(double)> const &first_initial_condition,
                                                          std::function<double(double)> const &second_initial_condition)
     : first_initial_condition_{first_initial_condition}, second_initial_condition_{second_initial_condition}
@@ -124,4 +171,24 @@ std::function<double(double, double)> const &wave_data_config_1d::d_coefficient(
 {
     return coefficient_data_cfg_->d_coefficient();
 }
+
+bool wave_data_config_1d::is_time_homogeneous() const
+{
+    return coefficient_data_cfg_->is_time_homogeneous();
+}
+
+bool wave_data_config_1d::is_separable() const
+{
+    return coefficient_data_cfg_->is_separable();
+}
+
+std::vector<std::function<double(double)>> const &wave_data_config_1d::time_factors() const
+{
+    return coefficient_data_cfg_->time_factors();
+}
+
+std::vector<std::function<double(double)>> const &wave_data_config_1d::space_factors() const
+{
+    return coefficient_data_cfg_->space_factors();
+}
 } // namespace lss_pde_solvers
@@ -2,6 +2,7 @@
 #define _LSS_WAVE_DATA_CONFIG_HPP_
 
 #include <functional>
+#include <vector>
 
 #include "../common/lss_macros.hpp"
 #include "../common/lss_utility.hpp"
@@ -21,6 +22,9 @@ struct wave_coefficient_data_config_1d
     std::function<double(double, double)> b_coeff_;
     std::function<double(double, double)> c_coeff_;
     std::function<double(double, double)> d_coeff_;
+    bool is_time_homogeneous_;
+    std::vector<std::function<double(double)>> time_factors_;
+    std::vector<std::function<double(double)>> space_factors_;
 
     explicit wave_coefficient_data_config_1d() = delete;
 
@@ -30,7 +34,17 @@ struct wave_coefficient_data_config_1d
     explicit wave_coefficient_data_config_1d(std::function<double(double, double)> const &a_coefficient,
                                              std::function<double(double, double)> const &b_coefficient,
                                              std::function<double(double, double)> const &c_coefficient,
-                                             std::function<double(double, double)> const &d_coefficient);
+                                             std::function<double(double, double)> const &d_coefficient,
+                                             bool is_time_homogeneous = false);
+
+    /**
+        @brief wave_coefficient_data_config_1d object constructor for separable coefficients,
+               coefficient(t,x) = time_factor(t) * space_factor(x)
+        @param time_factors - time factors of a, b, c and d coefficient (null factor means constant in time)
+        @param space_factors - space factors of a, b, c and d coefficient
+    **/
+    explicit wave_coefficient_data_config_1d(std::vector<std::function<double(double)>> const &time_factors,
+                                             std::vector<std::function<double(double)>> const &space_factors);
 
     LSS_API std::function<double(double, double)> const &a_coefficient() const;
 
@@ -39,6 +53,16 @@ struct wave_coefficient_data_config_1d
     LSS_API std::function<double(double, double)> const &c_coefficient() const;
 
     LSS_API std::function<double(double, double)> const &d_coefficient() const;
+
+    // true when the coefficients do not depend on time and may be tabulated once on the grid
+    LSS_API bool is_time_homogeneous() const;
+
+    // true when every coefficient is product of time factor and space factor
+    LSS_API bool is_separable() const;
+
+    LSS_API std::vector<std::function<double(double)>> const &time_factors() const;
+
+    LSS_API std::vector<std::function<double(double)>> const &space_factors() const;
 };
 
 /**
@@ -144,6 +168,14 @@ struct wave_data_config_1d
     LSS_API std::function<double(double, double)> const &c_coefficient() const;
 
     LSS_API std::function<double(double, double)> const &d_coefficient() const;
+
+    LSS_API bool is_time_homogeneous() const;
+
+    LSS_API bool is_separable() const;
+
+    LSS_API std::vector<std::function<double(double)>> const &time_factors() const;
+
+    LSS_API std::vector<std::function<double(double)>> const &space_factors() const;
 };
 
 /**
@@ -3,11 +3,12 @@
 namespace lss_pde_solvers
 {
 
-wave_implicit_solver_config::wave_implicit_solver_config(memory_space_enum const &memory_space,
-                                                         traverse_direction_enum const &traverse_direction,
-                                                         tridiagonal_method_enum const &tridiagonal_method,
-                                                         factorization_enum const &tridiagonal_factorization)
-    : pde_implicit_solver_config{memory_space, traverse_direction, tridiagonal_method, tridiagonal_factorization}
+wave_implicit_solver_config::wave_implicit_solver_config(
+    memory_space_enum const &memory_space, traverse_direction_enum const &traverse_direction,
+    tridiagonal_method_enum const &tridiagonal_method, factorization_enum const &tridiagonal_factorization,
+    adaptive_time_stepping_config_ptr const &adaptive_time_stepping)
+    : pde_implicit_solver_config{memory_space, traverse_direction, tridiagonal_method, tridiagonal_factorization},
+      adaptive_time_stepping_{adaptive_time_stepping}
 {
 }
 
@@ -15,6 +16,11 @@ wave_implicit_solver_config::~wave_implicit_solver_config()
 {
 }
 
+adaptive_time_stepping_config_ptr const &wave_implicit_solver_config::adaptive_time_stepping() const
+{
+    return adaptive_time_stepping_;
+}
+
 wave_explicit_solver_config::wave_explicit_solver_config(memory_space_enum const &memory_space,
                                                          traverse_direction_enum const &traverse_direction)
     : pde_explicit_solver_config{memory_space, traverse_direction}
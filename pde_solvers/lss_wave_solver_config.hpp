@@ -5,6 +5,7 @@
 
 #include "../common/lss_enumerations.hpp"
 #include "../common/lss_utility.hpp"
+#include "lss_adaptive_time_stepping_config.hpp"
 #include "lss_pde_solver_config.hpp"
 
 namespace lss_pde_solvers
@@ -23,14 +24,24 @@ using lss_utility::sptr_t;
  */
 struct wave_implicit_solver_config : public pde_implicit_solver_config
 {
+  private:
+    adaptive_time_stepping_config_ptr adaptive_time_stepping_;
+
     explicit wave_implicit_solver_config() = delete;
 
   public:
     explicit wave_implicit_solver_config(memory_space_enum const &memory_space,
                                          traverse_direction_enum const &traverse_direction,
                                          tridiagonal_method_enum const &tridiagonal_method,
-                                         factorization_enum const &tridiagonal_factorization);
+                                         factorization_enum const &tridiagonal_factorization,
+                                         adaptive_time_stepping_config_ptr const &adaptive_time_stepping = nullptr);
     ~wave_implicit_solver_config();
+
+    /**
+        @brief  Local error control of the time steps, the three-level history restarts on every step change
+        @retval adaptive time stepping config or null for fixed time step
+    **/
+    LSS_API adaptive_time_stepping_config_ptr const &adaptive_time_stepping() const;
 };
 
 /**
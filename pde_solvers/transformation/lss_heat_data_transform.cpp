@@ -6,6 +6,7 @@ namespace lss_pde_solvers
 void heat_data_transform_1d::initialize(heat_data_config_1d_ptr const &heat_data_config,
                                         grid_transform_config_1d_ptr const grid_transform_config)
 {
+    is_time_homogeneous_ = heat_data_config->is_time_homogeneous();
     auto const A = heat_data_config->a_coefficient();
     auto const B = heat_data_config->b_coefficient();
     auto const C = heat_data_config->c_coefficient();
@@ -45,6 +46,32 @@ void heat_data_transform_1d::initialize(heat_data_config_1d_ptr const &heat_data
         auto const x = grid_1d::transformed_value(grid_transform_config, zeta);
         return init(x);
     };
+
+    if (heat_data_config->is_separable())
+    {
+        initialize_separable_parts(heat_data_config, grid_transform_config);
+    }
+}
+
+void heat_data_transform_1d::initialize_separable_parts(heat_data_config_1d_ptr const &heat_data_config,
+                                                        grid_transform_config_1d_ptr const grid_transform_config)
+{
+    // transformation is linear in the coefficients, so each space factor is transformed on its own:
+    auto const &space_factors = heat_data_config->space_factors();
+    auto const zero = [](double t, double x) { return 0.0; };
+    auto const init_cfg = std::make_shared<heat_initial_data_config_1d>(heat_data_config->initial_condition());
+    for (std::size_t p = 0; p < space_factors.size(); ++p)
+    {
+        auto const &time_factor = heat_data_config->time_factors()[p];
+        time_factors_.emplace_back(time_factor ? time_factor : [](double t) { return 1.0; });
+        std::vector<std::function<double(double, double)>> coeffs(space_factors.size(), zero);
+        auto const g = space_factors[p];
+        coeffs[p] = [=](double t, double x) { return g(x); };
+        auto const coeff_cfg =
+            std::make_shared<heat_coefficient_data_config_1d>(coeffs[0], coeffs[1], coeffs[2], true);
+        auto const part_cfg = std::make_shared<heat_data_config_1d>(coeff_cfg, init_cfg);
+        separable_parts_.emplace_back(std::make_shared<heat_data_transform_1d>(part_cfg, grid_transform_config));
+    }
 }
 
 heat_data_transform_1d::heat_data_transform_1d(heat_data_config_1d_ptr const &heat_data_config,
@@ -62,6 +89,26 @@ bool const &heat_data_transform_1d::is_heat_source_set() const
     return is_heat_source_set_;
 }
 
+bool const &heat_data_transform_1d::is_time_homogeneous() const
+{
+    return is_time_homogeneous_;
+}
+
+bool heat_data_transform_1d::is_separable() const
+{
+    return !separable_parts_.empty();
+}
+
+std::vector<std::function<double(double)>> const &heat_data_transform_1d::time_factors() const
+{
+    return time_factors_;
+}
+
+std::vector<sptr_t<heat_data_transform_1d>> const &heat_data_transform_1d::separable_parts() const
+{
+    return separable_parts_;
+}
+
 std::function<double(double, double)> heat_data_transform_1d::heat_source() const
 {
     return (is_heat_source_set() == true) ? src_coeff_ : nullptr;
@@ -90,6 +137,7 @@ std::function<double(double, double)> const &heat_data_transform_1d::c_coefficie
 void heat_data_transform_2d::initialize(heat_data_config_2d_ptr const &heat_data_config,
                                         grid_transform_config_2d_ptr const &grid_transform_config)
 {
+    is_time_homogeneous_ = heat_data_config->is_time_homogeneous();
     auto const A = heat_data_config->a_coefficient();
     auto const B = heat_data_config->b_coefficient();
     auto const C = heat_data_config->c_coefficient();
@@ -160,6 +208,32 @@ void heat_data_transform_2d::initialize(heat_data_config_2d_ptr const &heat_data
         auto const y = grid_2d::transformed_value_2(grid_transform_config, eta);
         return init(x, y);
     };
+
+    if (heat_data_config->is_separable())
+    {
+        initialize_separable_parts(heat_data_config, grid_transform_config);
+    }
+}
+
+void heat_data_transform_2d::initialize_separable_parts(heat_data_config_2d_ptr const &heat_data_config,
+                                                        grid_transform_config_2d_ptr const &grid_transform_config)
+{
+    // transformation is linear in the coefficients, so each space factor is transformed on its own:
+    auto const &space_factors = heat_data_config->space_factors();
+    auto const zero = [](double t, double x, double y) { return 0.0; };
+    auto const init_cfg = std::make_shared<heat_initial_data_config_2d>(heat_data_config->initial_condition());
+    for (std::size_t p = 0; p < space_factors.size(); ++p)
+    {
+        auto const &time_factor = heat_data_config->time_factors()[p];
+        time_factors_.emplace_back(time_factor ? time_factor : [](double t) { return 1.0; });
+        std::vector<std::function<double(double, double, double)>> coeffs(space_factors.size(), zero);
+        auto const g = space_factors[p];
+        coeffs[p] = [=](double t, double x, double y) { return g(x, y); };
+        auto const coeff_cfg = std::make_shared<heat_coefficient_data_config_2d>(
+            coeffs[0], coeffs[1], coeffs[2], coeffs[3], coeffs[4], coeffs[5], true);
+        auto const part_cfg = std::make_shared<heat_data_config_2d>(coeff_cfg, init_cfg);
+        separable_parts_.emplace_back(std::make_shared<heat_data_transform_2d>(part_cfg, grid_transform_config));
+    }
 }
 
 heat_data_transform_2d::heat_data_transform_2d(heat_data_config_2d_ptr const &heat_data_config,
@@ -177,6 +251,26 @@ bool const &heat_data_transform_2d::is_heat_source_set() const
     return is_heat_source_set_;
 }
 
+bool const &heat_data_transform_2d::is_time_homogeneous() const
+{
+    return is_time_homogeneous_;
+}
+
+bool heat_data_transform_2d::is_separable() const
+{
+    return !separable_parts_.empty();
+}
+
+std::vector<std::function<double(double)>> const &heat_data_transform_2d::time_factors() const
+{
+    return time_factors_;
+}
+
+std::vector<sptr_t<heat_data_transform_2d>> const &heat_data_transform_2d::separable_parts() const
+{
+    return separable_parts_;
+}
+
 std::function<double(double, double, double)> heat_data_transform_2d::heat_source() const
 {
     return (is_heat_source_set() == true) ? src_coeff_ : nullptr;
@@ -2,6 +2,7 @@
 #define _LSS_HEAT_DATA_TRANSFORM_HPP_
 
 #include <functional>
+#include <vector>
 
 #include "../../common/lss_enumerations.hpp"
 #include "../../common/lss_macros.hpp"
@@ -30,15 +31,22 @@ struct heat_data_transform_1d
 {
   private:
     bool is_heat_source_set_{false};
+    bool is_time_homogeneous_{false};
     std::function<double(double, double)> a_coeff_{nullptr};
     std::function<double(double, double)> b_coeff_{nullptr};
     std::function<double(double, double)> c_coeff_{nullptr};
     std::function<double(double)> init_coeff_{nullptr};
     std::function<double(double, double)> src_coeff_{nullptr};
+    // time factors of separable data and transforms of the data keeping single space factor:
+    std::vector<std::function<double(double)>> time_factors_;
+    std::vector<sptr_t<heat_data_transform_1d>> separable_parts_;
 
     void initialize(heat_data_config_1d_ptr const &heat_data_config,
                     grid_transform_config_1d_ptr const grid_transform_config);
 
+    void initialize_separable_parts(heat_data_config_1d_ptr const &heat_data_config,
+                                    grid_transform_config_1d_ptr const grid_transform_config);
+
     explicit heat_data_transform_1d() = delete;
 
   public:
@@ -49,6 +57,20 @@ struct heat_data_transform_1d
 
     bool const &is_heat_source_set() const;
 
+    bool const &is_time_homogeneous() const;
+
+    bool is_separable() const;
+
+    /**
+        @brief  Time factors of separable data, constant in time factor is one
+    **/
+    std::vector<std::function<double(double)>> const &time_factors() const;
+
+    /**
+        @brief  Parts of the coefficients belonging to each time factor (time-homogeneous)
+    **/
+    std::vector<sptr_t<heat_data_transform_1d>> const &separable_parts() const;
+
     std::function<double(double, double)> heat_source() const;
 
     std::function<double(double)> const &initial_condition() const;
@@ -67,6 +89,7 @@ struct heat_data_transform_2d
 {
   private:
     bool is_heat_source_set_{false};
+    bool is_time_homogeneous_{false};
     std::function<double(double, double, double)> a_coeff_{nullptr};
     std::function<double(double, double, double)> b_coeff_{nullptr};
     std::function<double(double, double, double)> c_coeff_{nullptr};
@@ -75,10 +98,16 @@ struct heat_data_transform_2d
     std::function<double(double, double, double)> f_coeff_{nullptr};
     std::function<double(double, double)> init_coeff_{nullptr};
     std::function<double(double, double, double)> src_coeff_{nullptr};
+    // time factors of separable data and transforms of the data keeping single space factor:
+    std::vector<std::function<double(double)>> time_factors_;
+    std::vector<sptr_t<heat_data_transform_2d>> separable_parts_;
 
     void initialize(heat_data_config_2d_ptr const &heat_data_config,
                     grid_transform_config_2d_ptr const &grid_transform_config);
 
+    void initialize_separable_parts(heat_data_config_2d_ptr const &heat_data_config,
+                                    grid_transform_config_2d_ptr const &grid_transform_config);
+
     explicit heat_data_transform_2d() = delete;
 
   public:
@@ -89,6 +118,20 @@ struct heat_data_transform_2d
 
     bool const &is_heat_source_set() const;
 
+    bool const &is_time_homogeneous() const;
+
+    bool is_separable() const;
+
+    /**
+        @brief  Time factors of separable data, constant in time factor is one
+    **/
+    std::vector<std::function<double(double)>> const &time_factors() const;
+
+    /**
+        @brief  Parts of the coefficients belonging to each time factor (time-homogeneous)
+    **/
+    std::vector<sptr_t<heat_data_transform_2d>> const &separable_parts() const;
+
     std::function<double(double, double, double)> heat_source() const;
 
     std::function<double(double, double)> const &initial_condition() const;
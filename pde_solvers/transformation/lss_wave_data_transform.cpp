@@ -6,6 +6,7 @@ namespace lss_pde_solvers
 void wave_data_transform_1d::initialize(wave_data_config_1d_ptr const &wave_data_config,
                                         grid_transform_config_1d_ptr const grid_transform_config)
 {
+    is_time_homogeneous_ = wave_data_config->is_time_homogeneous();
     auto const A = wave_data_config->a_coefficient();
     auto const B = wave_data_config->b_coefficient();
     auto const C = wave_data_config->c_coefficient();
@@ -58,6 +59,33 @@ void wave_data_transform_1d::initialize(wave_data_config_1d_ptr const &wave_data
         auto const x = grid_1d::transformed_value(grid_transform_config, zeta);
         return init_second(x);
     };
+
+    if (wave_data_config->is_separable())
+    {
+        initialize_separable_parts(wave_data_config, grid_transform_config);
+    }
+}
+
+void wave_data_transform_1d::initialize_separable_parts(wave_data_config_1d_ptr const &wave_data_config,
+                                                        grid_transform_config_1d_ptr const grid_transform_config)
+{
+    // transformation is linear in the coefficients, so each space factor is transformed on its own:
+    auto const &space_factors = wave_data_config->space_factors();
+    auto const zero = [](double t, double x) { return 0.0; };
+    auto const init_cfg = std::make_shared<wave_initial_data_config_1d>(wave_data_config->first_initial_condition(),
+                                                                        wave_data_config->second_initial_condition());
+    for (std::size_t p = 0; p < space_factors.size(); ++p)
+    {
+        auto const &time_factor = wave_data_config->time_factors()[p];
+        time_factors_.emplace_back(time_factor ? time_factor : [](double t) { return 1.0; });
+        std::vector<std::function<double(double, double)>> coeffs(space_factors.size(), zero);
+        auto const g = space_factors[p];
+        coeffs[p] = [=](double t, double x) { return g(x); };
+        auto const coeff_cfg =
+            std::make_shared<wave_coefficient_data_config_1d>(coeffs[0], coeffs[1], coeffs[2], coeffs[3], true);
+        auto const part_cfg = std::make_shared<wave_data_config_1d>(coeff_cfg, init_cfg);
+        separable_parts_.emplace_back(std::make_shared<wave_data_transform_1d>(part_cfg, grid_transform_config));
+    }
 }
 
 wave_data_transform_1d::wave_data_transform_1d(wave_data_config_1d_ptr const &wave_data_config,
@@ -75,6 +103,26 @@ bool const &wave_data_transform_1d::is_wave_source_set() const
     return is_wave_source_set_;
 }
 
+bool const &wave_data_transform_1d::is_time_homogeneous() const
+{
+    return is_time_homogeneous_;
+}
+
+bool wave_data_transform_1d::is_separable() const
+{
+    return !separable_parts_.empty();
+}
+
+std::vector<std::function<double(double)>> const &wave_data_transform_1d::time_factors() const
+{
+    return time_factors_;
+}
+
+std::vector<sptr_t<wave_data_transform_1d>> const &wave_data_transform_1d::separable_parts() const
+{
+    return separable_parts_;
+}
+
 std::function<double(double, double)> wave_data_transform_1d::wave_source() const
 {
     return (is_wave_source_set() == true) ? src_coeff_ : nullptr;
@@ -2,6 +2,7 @@
 #define _LSS_WAVE_DATA_TRANSFORM_HPP_
 
 #include <functional>
+#include <vector>
 
 #include "../../common/lss_utility.hpp"
 #include "../../discretization/lss_grid.hpp"
@@ -22,6 +23,7 @@ struct wave_data_transform_1d
 {
   private:
     bool is_wave_source_set_{false};
+    bool is_time_homogeneous_{false};
     std::function<double(double, double)> a_coeff_{nullptr};
     std::function<double(double, double)> b_coeff_{nullptr};
     std::function<double(double, double)> c_coeff_{nullptr};
@@ -29,10 +31,16 @@ struct wave_data_transform_1d
     std::function<double(double)> init_first_coeff_{nullptr};
     std::function<double(double)> init_second_coeff_{nullptr};
     std::function<double(double, double)> src_coeff_{nullptr};
+    // time factors of separable data and transforms of the data keeping single space factor:
+    std::vector<std::function<double(double)>> time_factors_;
+    std::vector<sptr_t<wave_data_transform_1d>> separable_parts_;
 
     void initialize(wave_data_config_1d_ptr const &wave_data_config,
                     grid_transform_config_1d_ptr const grid_transform_config);
 
+    void initialize_separable_parts(wave_data_config_1d_ptr const &wave_data_config,
+                                    grid_transform_config_1d_ptr const grid_transform_config);
+
     explicit wave_data_transform_1d() = delete;
 
   public:
@@ -43,6 +51,20 @@ struct wave_data_transform_1d
 
     bool const &is_wave_source_set() const;
 
+    bool const &is_time_homogeneous() const;
+
+    bool is_separable() const;
+
+    /**
+        @brief  Time factors of separable data, constant in time factor is one
+    **/
+    std::vector<std::function<double(double)>> const &time_factors() const;
+
+    /**
+        @brief  Parts of the coefficients belonging to each time factor (time-homogeneous)
+    **/
+    std::vector<sptr_t<wave_data_transform_1d>> const &separable_parts() const;
+
     std::function<double(double, double)> wave_source() const;
 
     std::function<double(double)> const &first_initial_condition() const;
@@ -0,0 +1,202 @@
+#include "lss_core_banded_solver.hpp"
+
+#include <cmath>
+
+namespace lss_core_banded_solver
+{
+
+tridiagonal_banded_solver::tridiagonal_banded_solver(std::size_t system_size)
+    : system_size_{system_size}, factorization_{factorization_enum::None}
+{
+}
+
+tridiagonal_banded_solver::~tridiagonal_banded_solver()
+{
+}
+
+void tridiagonal_banded_solver::resize(std::size_t system_size)
+{
+    system_size_ = system_size;
+    factorization_ = factorization_enum::None;
+}
+
+void tridiagonal_banded_solver::factorize(container_t const &lower_diagonal, container_t const &diagonal,
+                                          container_t const &upper_diagonal, factorization_enum factorization)
+{
+    LSS_ASSERT(lower_diagonal.size() >= system_size_, "Inncorect size for lower_diagonal");
+    LSS_ASSERT(diagonal.size() >= system_size_, "Inncorect size for diagonal");
+    LSS_ASSERT(upper_diagonal.size() >= system_size_, "Inncorect size for upper_diagonal");
+    diag_.assign(system_size_, double{});
+    high_.assign(system_size_, double{});
+    high_2_.assign(system_size_, double{});
+    low_.assign(system_size_, double{});
+
+    if (factorization == factorization_enum::QRMethod)
+    {
+        factorize_qr(lower_diagonal, diagonal, upper_diagonal);
+    }
+    else if (factorization == factorization_enum::LUMethod)
+    {
+        factorize_lu(lower_diagonal, diagonal, upper_diagonal);
+    }
+    else if (factorization == factorization_enum::CholeskyMethod)
+    {
+        factorize_cholesky(lower_diagonal, diagonal);
+    }
+    else
+    {
+        throw std::exception("factorization not known");
+    }
+    factorization_ = factorization;
+}
+
+void tridiagonal_banded_solver::factorize_qr(container_t const &lower_diagonal, container_t const &diagonal,
+                                             container_t const &upper_diagonal)
+{
+    const std::size_t n = system_size_;
+    cos_.assign(n, double{});
+    // p and q hold the not yet rotated entries of i-th row at columns i and i+1:
+    double p = diagonal[0];
+    double q = (n > 1) ? upper_diagonal[0] : double{};
+    for (std::size_t i = 0; i + 1 < n; ++i)
+    {
+        // rotation annihilating the sub-diagonal entry of (i+1)-th row:
+        const double l = lower_diagonal[i + 1];
+        const double r = std::hypot(p, l);
+        LSS_ASSERT(r != 0.0, "Tridiagonal matrix is singular at row: " << i << "\n");
+        const double c = p / r;
+        const double s = l / r;
+        const double d = diagonal[i + 1];
+        const double u = (i + 2 < n) ? upper_diagonal[i + 1] : double{};
+        diag_[i] = r;
+        high_[i] = c * q + s * d;
+        high_2_[i] = s * u;
+        cos_[i] = c;
+        low_[i] = s;
+        p = c * d - s * q;
+        q = c * u;
+    }
+    LSS_ASSERT(p != 0.0, "Tridiagonal matrix is singular at row: " << (n - 1) << "\n");
+    diag_[n - 1] = p;
+}
+
+void tridiagonal_banded_solver::factorize_lu(container_t const &lower_diagonal, container_t const &diagonal,
+                                             container_t const &upper_diagonal)
+{
+    const std::size_t n = system_size_;
+    pivots_.assign(n, false);
+    std::copy(diagonal.begin(), diagonal.begin() + n, diag_.begin());
+    std::copy(upper_diagonal.begin(), upper_diagonal.begin() + n - 1, high_.begin());
+    for (std::size_t i = 0; i + 1 < n; ++i)
+    {
+        const double l = lower_diagonal[i + 1];
+        if (std::abs(diag_[i]) >= std::abs(l))
+        {
+            // no row interchange:
+            LSS_ASSERT(diag_[i] != 0.0, "Tridiagonal matrix is singular at row: " << i << "\n");
+            const double fact = l / diag_[i];
+            low_[i] = fact;
+            diag_[i + 1] = diag_[i + 1] - fact * high_[i];
+        }
+        else
+        {
+            // interchange i-th and (i+1)-th row:
+            const double fact = diag_[i] / l;
+            const double temp = high_[i];
+            diag_[i] = l;
+            low_[i] = fact;
+            high_[i] = diag_[i + 1];
+            diag_[i + 1] = temp - fact * diag_[i + 1];
+            if (i + 2 < n)
+            {
+                high_2_[i] = high_[i + 1];
+                high_[i + 1] = -fact * high_[i + 1];
+            }
+            pivots_[i] = true;
+        }
+    }
+    LSS_ASSERT(diag_[n - 1] != 0.0, "Tridiagonal matrix is singular at row: " << (n - 1) << "\n");
+}
+
+void tridiagonal_banded_solver::factorize_cholesky(container_t const &lower_diagonal, container_t const &diagonal)
+{
+    const std::size_t n = system_size_;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const double d = (i > 0) ? diagonal[i] - low_[i - 1] * low_[i - 1] : diagonal[i];
+        LSS_ASSERT(d > 0.0, "Tridiagonal matrix is not positive definite at row: " << i << "\n");
+        diag_[i] = std::sqrt(d);
+        if (i + 1 < n)
+            low_[i] = lower_diagonal[i + 1] / diag_[i];
+    }
+}
+
+void tridiagonal_banded_solver::back_substitute(container_t &solution) const
+{
+    const std::size_t n = system_size_;
+    solution[n - 1] = solution[n - 1] / diag_[n - 1];
+    if (n == 1)
+        return;
+    solution[n - 2] = (solution[n - 2] - high_[n - 2] * solution[n - 1]) / diag_[n - 2];
+    for (std::size_t i = n - 2; i-- > 0;)
+    {
+        solution[i] = (solution[i] - high_[i] * solution[i + 1] - high_2_[i] * solution[i + 2]) / diag_[i];
+    }
+}
+
+void tridiagonal_banded_solver::solve(container_t &rhs_solution) const
+{
+    LSS_ASSERT(rhs_solution.size() == system_size_, "Incorrect size of solution container");
+    const std::size_t n = system_size_;
+    container_t &x = rhs_solution;
+
+    if (factorization_ == factorization_enum::QRMethod)
+    {
+        // apply Q^T:
+        for (std::size_t i = 0; i + 1 < n; ++i)
+        {
+            const double x_0 = x[i];
+            const double x_1 = x[i + 1];
+            x[i] = cos_[i] * x_0 + low_[i] * x_1;
+            x[i + 1] = cos_[i] * x_1 - low_[i] * x_0;
+        }
+        back_substitute(x);
+    }
+    else if (factorization_ == factorization_enum::LUMethod)
+    {
+        // apply L^-1 together with row interchanges:
+        for (std::size_t i = 0; i + 1 < n; ++i)
+        {
+            if (pivots_[i])
+            {
+                const double temp = x[i] - low_[i] * x[i + 1];
+                x[i] = x[i + 1];
+                x[i + 1] = temp;
+            }
+            else
+            {
+                x[i + 1] = x[i + 1] - low_[i] * x[i];
+            }
+        }
+        back_substitute(x);
+    }
+    else if (factorization_ == factorization_enum::CholeskyMethod)
+    {
+        x[0] = x[0] / diag_[0];
+        for (std::size_t i = 1; i < n; ++i)
+        {
+            x[i] = (x[i] - low_[i - 1] * x[i - 1]) / diag_[i];
+        }
+        x[n - 1] = x[n - 1] / diag_[n - 1];
+        for (std::size_t i = n - 1; i-- > 0;)
+        {
+            x[i] = (x[i] - low_[i] * x[i + 1]) / diag_[i];
+        }
+    }
+    else
+    {
+        throw std::exception("factorization not known");
+    }
+}
+
+} // namespace lss_core_banded_solver
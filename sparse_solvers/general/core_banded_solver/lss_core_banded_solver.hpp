@@ -0,0 +1,97 @@
+/**
+
+    @file      lss_core_banded_solver.hpp
+    @brief     Native banded CORE solver
+    @details   ~
+    @author    Michal Sara
+    @date      18.10.2026
+    @copyright  Michal Sara, 2021. All right reserved.
+
+**/
+#pragma once
+
+#if !defined(_LSS_CORE_BANDED_SOLVER_HPP_)
+#define _LSS_CORE_BANDED_SOLVER_HPP_
+
+#include <vector>
+
+#include "../../../common/lss_enumerations.hpp"
+#include "../../../common/lss_macros.hpp"
+#include "../../../common/lss_utility.hpp"
+
+namespace lss_core_banded_solver
+{
+
+using lss_enumerations::factorization_enum;
+using lss_utility::container_t;
+using lss_utility::sptr_t;
+
+/**
+
+    @class   tridiagonal_banded_solver
+    @brief   Direct solver for tridiagonal systems on HOST
+    @details Factors are kept in band storage, so that one factorization serves
+             any number of right-hand sides:
+             QRMethod - Givens rotations, R has two super-diagonals
+             LUMethod - partial pivoting, U has two super-diagonals
+             CholeskyMethod - L L^T of symmetric positive definite matrix,
+             only the lower diagonal and the diagonal are referenced
+
+**/
+class tridiagonal_banded_solver
+{
+  private:
+    std::size_t system_size_;
+    factorization_enum factorization_;
+    // band of the triangular factor:
+    container_t diag_, high_, high_2_;
+    // LU multipliers or Givens sines or sub-diagonal of L, Givens cosines:
+    container_t low_, cos_;
+    // LU row interchanges:
+    std::vector<bool> pivots_;
+
+    void factorize_qr(container_t const &lower_diagonal, container_t const &diagonal,
+                      container_t const &upper_diagonal);
+
+    void factorize_lu(container_t const &lower_diagonal, container_t const &diagonal,
+                      container_t const &upper_diagonal);
+
+    void factorize_cholesky(container_t const &lower_diagonal, container_t const &diagonal);
+
+    void back_substitute(container_t &solution) const;
+
+    explicit tridiagonal_banded_solver() = delete;
+
+  public:
+    explicit tridiagonal_banded_solver(std::size_t system_size);
+
+    ~tridiagonal_banded_solver();
+
+    /**
+        @brief  Changes the size of the system, factorize must follow
+        @param  system_size - size of the system
+    **/
+    void resize(std::size_t system_size);
+
+    /**
+        @brief  Factorizes the matrix, entries follow tridiagonal_solver layout
+        @param  lower_diagonal - lower_diagonal[t] multiplies x[t-1] in t-th row
+        @param  diagonal - diagonal[t] multiplies x[t] in t-th row
+        @param  upper_diagonal - upper_diagonal[t] multiplies x[t+1] in t-th row
+        @param  factorization - QRMethod, LUMethod or CholeskyMethod
+    **/
+    void factorize(container_t const &lower_diagonal, container_t const &diagonal, container_t const &upper_diagonal,
+                   factorization_enum factorization);
+
+    /**
+        @brief  Solves the factorized system
+        @param  rhs_solution - right-hand side on input, solution on output
+    **/
+    void solve(container_t &rhs_solution) const;
+};
+
+using tridiagonal_banded_solver_ptr = sptr_t<tridiagonal_banded_solver>;
+
+} // namespace lss_core_banded_solver
+
+#endif ///_LSS_CORE_BANDED_SOLVER_HPP_
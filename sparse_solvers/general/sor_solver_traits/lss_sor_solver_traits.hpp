@@ -10,6 +10,8 @@
 namespace lss_sor_solver_traits
 {
 
+using lss_enumerations::sor_sweep_enum;
+
 template <typename fp_type> struct sor_solver_traits
 {
 };
@@ -24,6 +26,10 @@ template <> struct sor_solver_traits<double>
     {
         return 10'000;
     }
+    static sor_sweep_enum sweep()
+    {
+        return sor_sweep_enum::Natural;
+    }
 };
 
 template <> struct sor_solver_traits<float>
@@ -36,6 +42,10 @@ template <> struct sor_solver_traits<float>
     {
         return 10'000;
     }
+    static sor_sweep_enum sweep()
+    {
+        return sor_sweep_enum::Natural;
+    }
 };
 
 template <typename fp_type> struct sor_solver_cuda_traits
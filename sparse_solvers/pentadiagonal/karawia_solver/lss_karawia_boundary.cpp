@@ -7,6 +7,7 @@
 namespace lss_karawia_solver
 {
 
+using lss_boundary::boundary_cast;
 using lss_boundary::dirichlet_boundary_1d;
 using lss_boundary::dirichlet_boundary_2d;
 
@@ -47,6 +48,13 @@ const std::tuple<double, double> karawia_solver_boundary::init_coefficients(boun
     return std::make_tuple(r0_, r1_);
 }
 
+const std::tuple<double, double> karawia_solver_boundary::init_coefficients(boundary_1d_pair const &boundary,
+                                                                            double time)
+{
+    initialise(boundary, time);
+    return std::make_tuple(r0_, r1_);
+}
+
 const std::tuple<double, double> karawia_solver_boundary::init_coefficients(boundary_2d_pair const &lowest_boundary,
                                                                             boundary_2d_pair const &lower_boundary,
                                                                             double time, double space_args)
@@ -63,6 +71,13 @@ const std::tuple<double, double> karawia_solver_boundary::final_coefficients(bou
     return std::make_tuple(r_, rend_);
 }
 
+const std::tuple<double, double> karawia_solver_boundary::final_coefficients(boundary_1d_pair const &boundary,
+                                                                             double time)
+{
+    finalise(boundary, time);
+    return std::make_tuple(r_, rend_);
+}
+
 const std::tuple<double, double> karawia_solver_boundary::final_coefficients(boundary_2d_pair const &uppest_boundary,
                                                                              boundary_2d_pair const &upper_boundary,
                                                                              double time, double space_args)
@@ -89,11 +104,11 @@ void karawia_solver_boundary::initialise(boundary_1d_pair const &lowest_boundary
     const auto f_2 = std::get<5>(lowest_sexta_);
     const auto a_3 = std::get<0>(lower_sexta_);
     const auto f_3 = std::get<5>(lower_sexta_);
-    auto const lower_bnd = lower_boundary.first;
-    auto const lowest_bnd = lowest_boundary.first;
-    if (auto ptr_0 = std::dynamic_pointer_cast<dirichlet_boundary_1d>(lowest_bnd))
+    auto const &lower_bnd = lower_boundary.first;
+    auto const &lowest_bnd = lowest_boundary.first;
+    if (auto ptr_0 = boundary_cast<dirichlet_boundary_1d>(lowest_bnd))
     {
-        if (auto ptr_1 = std::dynamic_pointer_cast<dirichlet_boundary_1d>(lower_bnd))
+        if (auto ptr_1 = boundary_cast<dirichlet_boundary_1d>(lower_bnd))
         {
             const auto cst_val_0 = ptr_0->value(time);
             const auto cst_val_1 = ptr_1->value(time);
@@ -112,6 +127,25 @@ void karawia_solver_boundary::initialise(boundary_1d_pair const &lowest_boundary
     }
 }
 
+void karawia_solver_boundary::initialise(boundary_1d_pair const &boundary, double time)
+{
+    const auto b_1 = std::get<1>(lowest_sexta_);
+    const auto f_1 = std::get<5>(lowest_sexta_);
+    const auto a_2 = std::get<0>(lower_sexta_);
+    const auto f_2 = std::get<5>(lower_sexta_);
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(boundary.first))
+    {
+        const auto cst_val = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
+        start_index_ = 1;
+        r0_ = f_1 - b_1 * cst_val;
+        r1_ = f_2 - a_2 * cst_val;
+    }
+    else
+    {
+        throw std::exception("Any other boundary type is not supported");
+    }
+}
+
 void karawia_solver_boundary::initialise(boundary_2d_pair const &lowest_boundary,
                                          boundary_2d_pair const &lower_boundary, double time, double space_args)
 {
@@ -120,11 +154,11 @@ void karawia_solver_boundary::initialise(boundary_2d_pair const &lowest_boundary
     const auto f_2 = std::get<5>(lowest_sexta_);
     const auto a_3 = std::get<0>(lower_sexta_);
     const auto f_3 = std::get<5>(lower_sexta_);
-    auto const lower_bnd = lower_boundary.first;
-    auto const lowest_bnd = lowest_boundary.first;
-    if (auto ptr_0 = std::dynamic_pointer_cast<dirichlet_boundary_2d>(lowest_bnd))
+    auto const &lower_bnd = lower_boundary.first;
+    auto const &lowest_bnd = lowest_boundary.first;
+    if (auto ptr_0 = boundary_cast<dirichlet_boundary_2d>(lowest_bnd))
     {
-        if (auto ptr_1 = std::dynamic_pointer_cast<dirichlet_boundary_2d>(lower_bnd))
+        if (auto ptr_1 = boundary_cast<dirichlet_boundary_2d>(lower_bnd))
         {
             const auto cst_val_0 = ptr_0->value(time, space_args);
             const auto cst_val_1 = ptr_1->value(time, space_args);
@@ -151,11 +185,11 @@ void karawia_solver_boundary::finalise(boundary_1d_pair const &uppest_boundary,
     const auto d_end = std::get<3>(highest_sexta_);
     const auto e_end = std::get<4>(highest_sexta_);
     const auto f_end = std::get<5>(highest_sexta_);
-    auto const upper_bnd = upper_boundary.second;
-    auto const uppest_bnd = uppest_boundary.second;
-    if (auto ptr_end = std::dynamic_pointer_cast<dirichlet_boundary_1d>(uppest_bnd))
+    auto const &upper_bnd = upper_boundary.second;
+    auto const &uppest_bnd = uppest_boundary.second;
+    if (auto ptr_end = boundary_cast<dirichlet_boundary_1d>(uppest_bnd))
     {
-        if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(upper_bnd))
+        if (auto ptr = boundary_cast<dirichlet_boundary_1d>(upper_bnd))
         {
             const auto cst_val = ptr->value(time);
             const auto cst_val_end = ptr_end->value(time);
@@ -174,6 +208,25 @@ void karawia_solver_boundary::finalise(boundary_1d_pair const &uppest_boundary,
     }
 }
 
+void karawia_solver_boundary::finalise(boundary_1d_pair const &boundary, double time)
+{
+    const auto e = std::get<4>(higher_sexta_);
+    const auto f = std::get<5>(higher_sexta_);
+    const auto d_end = std::get<3>(highest_sexta_);
+    const auto f_end = std::get<5>(highest_sexta_);
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(boundary.second))
+    {
+        const auto cst_val = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
+        end_index_ = discretization_size_ - 2;
+        r_ = f - e * cst_val;
+        rend_ = f_end - d_end * cst_val;
+    }
+    else
+    {
+        throw std::exception("Any other boundary type is not supported");
+    }
+}
+
 void karawia_solver_boundary::finalise(boundary_2d_pair const &uppest_boundary, boundary_2d_pair const &upper_boundary,
                                        double time, double space_args)
 {
@@ -182,11 +235,11 @@ void karawia_solver_boundary::finalise(boundary_2d_pair const &uppest_boundary,
     const auto d_end = std::get<3>(highest_sexta_);
     const auto e_end = std::get<4>(highest_sexta_);
     const auto f_end = std::get<5>(highest_sexta_);
-    auto const upper_bnd = upper_boundary.second;
-    auto const uppest_bnd = uppest_boundary.second;
-    if (auto ptr_end = std::dynamic_pointer_cast<dirichlet_boundary_2d>(uppest_bnd))
+    auto const &upper_bnd = upper_boundary.second;
+    auto const &uppest_bnd = uppest_boundary.second;
+    if (auto ptr_end = boundary_cast<dirichlet_boundary_2d>(uppest_bnd))
     {
-        if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(upper_bnd))
+        if (auto ptr = boundary_cast<dirichlet_boundary_2d>(upper_bnd))
         {
             const auto cst_val = ptr->value(time, space_args);
             const auto cst_val_end = ptr_end->value(time, space_args);
@@ -208,10 +261,10 @@ void karawia_solver_boundary::finalise(boundary_2d_pair const &uppest_boundary,
 const double karawia_solver_boundary::upper_boundary(boundary_1d_pair const &boundary, double time)
 {
     double ret{};
-    auto const second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(second_bnd))
+    auto const &second_bnd = boundary.second;
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(second_bnd))
     {
-        ret = ptr->value(time);
+        ret = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
     }
 
     return ret;
@@ -220,8 +273,8 @@ const double karawia_solver_boundary::upper_boundary(boundary_1d_pair const &bou
 const double karawia_solver_boundary::upper_boundary(boundary_2d_pair const &boundary, double time, double space_args)
 {
     double ret{};
-    auto const second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(second_bnd))
+    auto const &second_bnd = boundary.second;
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(second_bnd))
     {
         ret = ptr->value(time, space_args);
     }
@@ -232,9 +285,9 @@ const double karawia_solver_boundary::upper_boundary(boundary_2d_pair const &bou
 const double karawia_solver_boundary::lower_boundary(boundary_1d_pair const &boundary, double time)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(boundary.first))
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(boundary.first))
     {
-        ret = ptr->value(time);
+        ret = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
     }
     return ret;
 }
@@ -242,7 +295,7 @@ const double karawia_solver_boundary::lower_boundary(boundary_1d_pair const &bou
 const double karawia_solver_boundary::lower_boundary(boundary_2d_pair const &boundary, double time, double space_args)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(boundary.first))
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(boundary.first))
     {
         ret = ptr->value(time, space_args);
     }
@@ -35,11 +35,15 @@ class karawia_solver_boundary
 
     void initialise(boundary_1d_pair const &lowest_boundary, boundary_1d_pair const &lower_boundary, double time);
 
+    void initialise(boundary_1d_pair const &boundary, double time);
+
     void initialise(boundary_2d_pair const &lowest_boundary, boundary_2d_pair const &lower_boundary, double time,
                     double space_args);
 
     void finalise(boundary_1d_pair const &uppest_boundary, boundary_1d_pair const &upper_boundary, double time);
 
+    void finalise(boundary_1d_pair const &boundary, double time);
+
     void finalise(boundary_2d_pair const &uppest_boundary, boundary_2d_pair const &upper_boundary, double time,
                   double space_args);
 
@@ -59,6 +63,14 @@ class karawia_solver_boundary
     const std::tuple<double, double> init_coefficients(boundary_1d_pair const &lowest_boundary,
                                                        boundary_1d_pair const &lower_boundary, double time);
 
+    /**
+        @brief  Right-hand sides of the first two unknown rows when only the end points are given,
+                lowest and lower sixtuples are then rows 1 and 2
+        @param  boundary - Dirichlet boundary pair
+        @param  time - time
+    **/
+    const std::tuple<double, double> init_coefficients(boundary_1d_pair const &boundary, double time);
+
     const std::tuple<double, double> init_coefficients(boundary_2d_pair const &lowest_boundary,
                                                        boundary_2d_pair const &lower_boundary, double time,
                                                        double space_args);
@@ -66,6 +78,14 @@ class karawia_solver_boundary
     const std::tuple<double, double> final_coefficients(boundary_1d_pair const &uppest_boundary,
                                                         boundary_1d_pair const &upper_boundary, double time);
 
+    /**
+        @brief  Right-hand sides of the last two unknown rows when only the end points are given,
+                higher and highest sixtuples are then rows N-2 and N-1
+        @param  boundary - Dirichlet boundary pair
+        @param  time - time
+    **/
+    const std::tuple<double, double> final_coefficients(boundary_1d_pair const &boundary, double time);
+
     const std::tuple<double, double> final_coefficients(boundary_2d_pair const &uppest_boundary,
                                                         boundary_2d_pair const &upper_boundary, double time,
                                                         double space_args);
@@ -13,7 +13,10 @@
 namespace lss_karawia_solver
 {
 
-karawia_solver::karawia_solver(std::size_t discretization_size) : discretization_size_{discretization_size}
+using lss_enumerations::solver_phase_enum;
+
+karawia_solver::karawia_solver(std::size_t discretization_size)
+    : discretization_size_{discretization_size}, is_factorized_{false}, factorized_start_{}, factorized_end_{}
 {
     initialize();
 }
@@ -29,10 +32,20 @@ karawia_solver ::~karawia_solver()
 {
 }
 
+void karawia_solver::solve(boundary_1d_pair const &boundary, container_t &solution, double at_time)
+{
+    LSS_ASSERT(solution.size() == discretization_size_, "Incorrect size of solution container");
+    LSS_STATS_PHASE(stats_, solver_phase_enum::LinearSolve);
+    LSS_STATS_ADD(stats_, add_solves, 1);
+    kernel(boundary, solution, at_time);
+}
+
 void karawia_solver::solve(boundary_1d_pair const &boundary, boundary_1d_pair const &other_boundary,
                            container_t &solution)
 {
     LSS_ASSERT(solution.size() == discretization_size_, "Incorrect size of solution container");
+    LSS_STATS_PHASE(stats_, solver_phase_enum::LinearSolve);
+    LSS_STATS_ADD(stats_, add_solves, 1);
     kernel(boundary, other_boundary, solution, double{});
 }
 
@@ -40,6 +53,8 @@ void karawia_solver::solve(boundary_1d_pair const &boundary, boundary_1d_pair co
                            container_t &solution, double at_time)
 {
     LSS_ASSERT(solution.size() == discretization_size_, "Incorrect size of solution container");
+    LSS_STATS_PHASE(stats_, solver_phase_enum::LinearSolve);
+    LSS_STATS_ADD(stats_, add_solves, 1);
     kernel(boundary, other_boundary, solution, at_time);
 }
 
@@ -47,6 +62,8 @@ void karawia_solver::solve(boundary_2d_pair const &boundary, boundary_2d_pair co
                            container_t &solution, double at_time, double space_arg)
 {
     LSS_ASSERT(solution.size() == discretization_size_, "Incorrect size of solution container");
+    LSS_STATS_PHASE(stats_, solver_phase_enum::LinearSolve);
+    LSS_STATS_ADD(stats_, add_solves, 1);
     kernel(boundary, other_boundary, solution, at_time, space_arg);
 }
 
@@ -63,6 +80,7 @@ void karawia_solver::set_diagonals(container_t lowest_diagonal, container_t lowe
     c_ = std::move(diagonal);
     d_ = std::move(upper_diagonal);
     e_ = std::move(uppest_diagonal);
+    is_factorized_ = false;
 }
 
 void karawia_solver::set_rhs(container_t const &rhs)
@@ -71,79 +89,116 @@ void karawia_solver::set_rhs(container_t const &rhs)
     f_ = rhs;
 }
 
-void lss_karawia_solver::karawia_solver::kernel(boundary_1d_pair const &boundary,
-                                                boundary_1d_pair const &other_boundary, container_t &solution,
-                                                double time)
+void karawia_solver::set_stats(solver_stats_ptr const &stats)
+{
+    stats_ = stats;
+}
+
+void karawia_solver::set_sixtuples(std::size_t start_idx, std::size_t end_idx)
 {
-    // check the diagonal dominance:
-    // LSS_ASSERT(is_diagonally_dominant() == true, "Tridiagonal matrix must be
-    // diagonally dominant.");
+    const auto sixta = [this](std::size_t t) { return std::make_tuple(a_[t], b_[t], c_[t], d_[t], e_[t], f_[t]); };
+    karawia_boundary_->set_lowest_sixtuple(sixta(start_idx));
+    karawia_boundary_->set_lower_sixtuple(sixta(start_idx + 1));
+    karawia_boundary_->set_higher_sixtuple(sixta(end_idx - 1));
+    karawia_boundary_->set_highest_sixtuple(sixta(end_idx));
+}
 
-    // clear the working containers:
-    alpha_.clear();
-    beta_.clear();
-    gamma_.clear();
-    mu_.clear();
+void karawia_solver::factorize(std::size_t start_idx, std::size_t end_idx)
+{
+    if (is_factorized_ && (factorized_start_ == start_idx) && (factorized_end_ == end_idx))
+        return;
+    LSS_ASSERT(end_idx >= start_idx + 3, "Pentadiagonal system must have at least 4 unknowns");
 
-    // resize the working containers:
     alpha_.resize(discretization_size_);
     beta_.resize(discretization_size_);
     gamma_.resize(discretization_size_);
     mu_.resize(discretization_size_);
 
-    // get proper boundaries:
-    const std::size_t N = discretization_size_ - 1;
-    const auto &lowest_sixta = std::make_tuple(a_[2], b_[2], c_[2], d_[2], e_[2], f_[2]);
-    const auto &lower_sixta = std::make_tuple(a_[3], b_[3], c_[3], d_[3], e_[3], f_[3]);
-    const auto &higher_sixta = std::make_tuple(a_[N - 3], b_[N - 3], c_[N - 3], d_[N - 3], e_[N - 3], f_[N - 3]);
-    const auto &highest_sixta = std::make_tuple(a_[N - 2], b_[N - 2], c_[N - 2], d_[N - 2], e_[N - 2], f_[N - 2]);
-
-    const auto &init_coeffs = karawia_boundary_->init_coefficients(boundary, other_boundary, time);
-    const std::size_t start_idx = karawia_boundary_->start_index();
-    const auto &fin_coeffs = karawia_boundary_->final_coefficients(boundary, other_boundary, time);
-    const std::size_t end_idx = karawia_boundary_->end_index();
+    // entries reaching the boundary nodes are already moved to the right-hand side:
+    const auto a = [&](std::size_t t) { return (t < start_idx + 2) ? 0.0 : a_[t]; };
+    const auto b = [&](std::size_t t) { return (t == start_idx) ? 0.0 : b_[t]; };
+    const auto d = [&](std::size_t t) { return (t == end_idx) ? 0.0 : d_[t]; };
+    const auto e = [&](std::size_t t) { return (t + 2 > end_idx) ? 0.0 : e_[t]; };
 
-    // init values for the working containers:
     mu_[start_idx] = c_[start_idx];
-    alpha_[start_idx] = d_[start_idx] / mu_[start_idx];
-    beta_[start_idx] = e_[start_idx] / mu_[start_idx];
-    f_[start_idx] = std::get<0>(init_coeffs) / mu_[start_idx];
+    alpha_[start_idx] = d(start_idx) / mu_[start_idx];
+    beta_[start_idx] = e(start_idx) / mu_[start_idx];
     //
     const std::size_t next_idx = start_idx + 1;
-    gamma_[next_idx] = b_[next_idx];
+    gamma_[next_idx] = b(next_idx);
     mu_[next_idx] = c_[next_idx] - alpha_[start_idx] * gamma_[next_idx];
-    alpha_[next_idx] = (d_[next_idx] - beta_[start_idx] * gamma_[next_idx]) / mu_[next_idx];
-    beta_[next_idx] = e_[next_idx] / mu_[next_idx];
-    f_[next_idx] = (std::get<1>(init_coeffs) - f_[start_idx] * gamma_[next_idx]) / mu_[next_idx];
+    alpha_[next_idx] = (d(next_idx) - beta_[start_idx] * gamma_[next_idx]) / mu_[next_idx];
+    beta_[next_idx] = e(next_idx) / mu_[next_idx];
 
-    for (std::size_t t = next_idx + 1; t <= end_idx - 2; ++t)
+    for (std::size_t t = next_idx + 1; t <= end_idx; ++t)
     {
-        gamma_[t] = b_[t] - alpha_[t - 2] * a_[t];
-        mu_[t] = c_[t] - beta_[t - 2] * a_[t] - alpha_[t - 1] * gamma_[t];
-        alpha_[t] = (d_[t] - beta_[t - 1] * gamma_[t]) / mu_[t];
-        beta_[t] = e_[t] / mu_[t];
-        f_[t] = (f_[t] - f_[t - 2] * a_[t] - f_[t - 1] * gamma_[t]) / mu_[t];
+        gamma_[t] = b(t) - alpha_[t - 2] * a(t);
+        mu_[t] = c_[t] - beta_[t - 2] * a(t) - alpha_[t - 1] * gamma_[t];
+        alpha_[t] = (d(t) - beta_[t - 1] * gamma_[t]) / mu_[t];
+        beta_[t] = e(t) / mu_[t];
     }
 
-    gamma_[end_idx - 1] = b_[end_idx - 1] - alpha_[end_idx - 3] * a_[end_idx - 1];
-    mu_[end_idx - 1] =
-        c_[end_idx - 1] - beta_[end_idx - 3] * a_[end_idx - 1] - alpha_[end_idx - 2] * gamma_[end_idx - 1];
-    alpha_[end_idx - 1] = (d_[end_idx - 1] - beta_[end_idx - 2] * gamma_[end_idx - 1]) / mu_[end_idx - 1];
-    //
-    gamma_[end_idx] = b_[end_idx - 1] - alpha_[end_idx - 2] * a_[end_idx];
-    mu_[end_idx] = c_[end_idx] - beta_[end_idx - 2] * a_[end_idx] - alpha_[end_idx - 1] * gamma_[end_idx];
-    f_[end_idx - 1] =
-        (std::get<0>(fin_coeffs) - f_[end_idx - 2] * a_[end_idx - 1] - f_[end_idx - 2] * gamma_[end_idx - 1]) /
-        mu_[end_idx - 1];
-    f_[end_idx] =
-        (std::get<1>(fin_coeffs) - f_[end_idx - 1] * a_[end_idx] - f_[end_idx - 1] * gamma_[end_idx]) / mu_[end_idx];
-
-    solution[end_idx] = f_[end_idx];
-    solution[end_idx - 1] = f_[end_idx - 1] - alpha_[end_idx - 1] * solution[end_idx];
-    for (std::size_t t = end_idx - 1; t-- > start_idx /*&& t >= 0*/; /*t--*/)
+    is_factorized_ = true;
+    factorized_start_ = start_idx;
+    factorized_end_ = end_idx;
+}
+
+void karawia_solver::substitute(std::tuple<double, double> const &init_coeffs,
+                                std::tuple<double, double> const &fin_coeffs, std::size_t start_idx,
+                                std::size_t end_idx, container_t &solution)
+{
+    y_ = f_;
+    y_[start_idx] = std::get<0>(init_coeffs);
+    y_[start_idx + 1] = std::get<1>(init_coeffs);
+    y_[end_idx - 1] = std::get<0>(fin_coeffs);
+    y_[end_idx] = std::get<1>(fin_coeffs);
+
+    // forward sweep:
+    y_[start_idx] = y_[start_idx] / mu_[start_idx];
+    y_[start_idx + 1] = (y_[start_idx + 1] - y_[start_idx] * gamma_[start_idx + 1]) / mu_[start_idx + 1];
+    for (std::size_t t = start_idx + 2; t <= end_idx; ++t)
+    {
+        y_[t] = (y_[t] - y_[t - 2] * a_[t] - y_[t - 1] * gamma_[t]) / mu_[t];
+    }
+
+    // backward sweep:
+    solution[end_idx] = y_[end_idx];
+    solution[end_idx - 1] = y_[end_idx - 1] - alpha_[end_idx - 1] * solution[end_idx];
+    for (std::size_t t = end_idx - 1; t-- > start_idx;)
     {
-        solution[t] = f_[t] - alpha_[t] * solution[t + 1] - beta_[t] * solution[t + 2];
+        solution[t] = y_[t] - alpha_[t] * solution[t + 1] - beta_[t] * solution[t + 2];
     }
+}
+
+void karawia_solver::kernel(boundary_1d_pair const &boundary, container_t &solution, double time)
+{
+    const std::size_t N = discretization_size_ - 1;
+    set_sixtuples(1, N - 1);
+    const auto &init_coeffs = karawia_boundary_->init_coefficients(boundary, time);
+    const std::size_t start_idx = karawia_boundary_->start_index();
+    const auto &fin_coeffs = karawia_boundary_->final_coefficients(boundary, time);
+    const std::size_t end_idx = karawia_boundary_->end_index();
+
+    factorize(start_idx, end_idx);
+    substitute(init_coeffs, fin_coeffs, start_idx, end_idx, solution);
+
+    // fill in the boundary values:
+    solution[0] = karawia_boundary_->lower_boundary(boundary, time);
+    solution[N] = karawia_boundary_->upper_boundary(boundary, time);
+}
+
+void karawia_solver::kernel(boundary_1d_pair const &boundary, boundary_1d_pair const &other_boundary,
+                            container_t &solution, double time)
+{
+    const std::size_t N = discretization_size_ - 1;
+    set_sixtuples(2, N - 2);
+    const auto &init_coeffs = karawia_boundary_->init_coefficients(boundary, other_boundary, time);
+    const std::size_t start_idx = karawia_boundary_->start_index();
+    const auto &fin_coeffs = karawia_boundary_->final_coefficients(boundary, other_boundary, time);
+    const std::size_t end_idx = karawia_boundary_->end_index();
+
+    factorize(start_idx, end_idx);
+    substitute(init_coeffs, fin_coeffs, start_idx, end_idx, solution);
 
     // fill in the boundary values:
     solution[0] = karawia_boundary_->lower_boundary(boundary, time);
@@ -155,75 +210,15 @@ void lss_karawia_solver::karawia_solver::kernel(boundary_1d_pair const &boundary
 void karawia_solver::kernel(boundary_2d_pair const &boundary, boundary_2d_pair const &other_boundary,
                             container_t &solution, double time, double space_args)
 {
-    // check the diagonal dominance:
-    // LSS_ASSERT(is_diagonally_dominant() == true, "Tridiagonal matrix must be
-    // diagonally dominant.");
-
-    // clear the working containers:
-    alpha_.clear();
-    beta_.clear();
-    gamma_.clear();
-    mu_.clear();
-
-    // resize the working containers:
-    alpha_.resize(discretization_size_);
-    beta_.resize(discretization_size_);
-    gamma_.resize(discretization_size_);
-    mu_.resize(discretization_size_);
-
-    // get proper boundaries:
     const std::size_t N = discretization_size_ - 1;
-    const auto &lowest_sixta = std::make_tuple(a_[2], b_[2], c_[2], d_[2], e_[2], f_[2]);
-    const auto &lower_sixta = std::make_tuple(a_[3], b_[3], c_[3], d_[3], e_[3], f_[3]);
-    const auto &higher_sixta = std::make_tuple(a_[N - 3], b_[N - 3], c_[N - 3], d_[N - 3], e_[N - 3], f_[N - 3]);
-    const auto &highest_sixta = std::make_tuple(a_[N - 2], b_[N - 2], c_[N - 2], d_[N - 2], e_[N - 2], f_[N - 2]);
-
+    set_sixtuples(2, N - 2);
     const auto &init_coeffs = karawia_boundary_->init_coefficients(boundary, other_boundary, time, space_args);
     const std::size_t start_idx = karawia_boundary_->start_index();
     const auto &fin_coeffs = karawia_boundary_->final_coefficients(boundary, other_boundary, time, space_args);
     const std::size_t end_idx = karawia_boundary_->end_index();
 
-    // init values for the working containers:
-    mu_[start_idx] = c_[start_idx];
-    alpha_[start_idx] = d_[start_idx] / mu_[start_idx];
-    beta_[start_idx] = e_[start_idx] / mu_[start_idx];
-    f_[start_idx] = std::get<0>(init_coeffs) / mu_[start_idx];
-    //
-    const std::size_t next_idx = start_idx + 1;
-    gamma_[next_idx] = b_[next_idx];
-    mu_[next_idx] = c_[next_idx] - alpha_[start_idx] * gamma_[next_idx];
-    alpha_[next_idx] = (d_[next_idx] - beta_[start_idx] * gamma_[next_idx]) / mu_[next_idx];
-    beta_[next_idx] = e_[next_idx] / mu_[next_idx];
-    f_[next_idx] = (std::get<1>(init_coeffs) - f_[start_idx] * gamma_[next_idx]) / mu_[next_idx];
-
-    for (std::size_t t = next_idx + 1; t <= end_idx - 2; ++t)
-    {
-        gamma_[t] = b_[t] - alpha_[t - 2] * a_[t];
-        mu_[t] = c_[t] - beta_[t - 2] * a_[t] - alpha_[t - 1] * gamma_[t];
-        alpha_[t] = (d_[t] - beta_[t - 1] * gamma_[t]) / mu_[t];
-        beta_[t] = e_[t] / mu_[t];
-        f_[t] = (f_[t] - f_[t - 2] * a_[t] - f_[t - 1] * gamma_[t]) / mu_[t];
-    }
-
-    gamma_[end_idx - 1] = b_[end_idx - 1] - alpha_[end_idx - 3] * a_[end_idx - 1];
-    mu_[end_idx - 1] =
-        c_[end_idx - 1] - beta_[end_idx - 3] * a_[end_idx - 1] - alpha_[end_idx - 2] * gamma_[end_idx - 1];
-    alpha_[end_idx - 1] = (d_[end_idx - 1] - beta_[end_idx - 2] * gamma_[end_idx - 1]) / mu_[end_idx - 1];
-    //
-    gamma_[end_idx] = b_[end_idx - 1] - alpha_[end_idx - 2] * a_[end_idx];
-    mu_[end_idx] = c_[end_idx] - beta_[end_idx - 2] * a_[end_idx] - alpha_[end_idx - 1] * gamma_[end_idx];
-    f_[end_idx - 1] =
-        (std::get<0>(fin_coeffs) - f_[end_idx - 2] * a_[end_idx - 1] - f_[end_idx - 2] * gamma_[end_idx - 1]) /
-        mu_[end_idx - 1];
-    f_[end_idx] =
-        (std::get<1>(fin_coeffs) - f_[end_idx - 1] * a_[end_idx] - f_[end_idx - 1] * gamma_[end_idx]) / mu_[end_idx];
-
-    solution[end_idx] = f_[end_idx];
-    solution[end_idx - 1] = f_[end_idx - 1] - alpha_[end_idx - 1] * solution[end_idx];
-    for (std::size_t t = end_idx - 1; t-- > start_idx;)
-    {
-        solution[t] = f_[t] - alpha_[t] * solution[t + 1] - beta_[t] * solution[t + 2];
-    }
+    factorize(start_idx, end_idx);
+    substitute(init_coeffs, fin_coeffs, start_idx, end_idx, solution);
 
     // fill in the boundary values:
     solution[0] = karawia_boundary_->lower_boundary(boundary, time, space_args);
@@ -11,6 +11,7 @@
 #include "../../../boundaries/lss_boundary.hpp"
 #include "../../../common/lss_enumerations.hpp"
 #include "../../../common/lss_macros.hpp"
+#include "../../../common/lss_solver_stats.hpp"
 #include "../../../common/lss_utility.hpp"
 #include "lss_karawia_boundary.hpp"
 
@@ -20,6 +21,7 @@ namespace lss_karawia_solver
 using lss_boundary::boundary_1d_pair;
 using lss_boundary::boundary_2d_pair;
 using lss_utility::container_t;
+using lss_utility::solver_stats_ptr;
 using lss_utility::sptr_t;
 
 class karawia_solver
@@ -28,8 +30,21 @@ class karawia_solver
   private:
     std::size_t discretization_size_;
     container_t a_, b_, c_, d_, e_;
-    container_t alpha_, beta_, gamma_, mu_, f_;
+    container_t alpha_, beta_, gamma_, mu_, f_, y_;
     karawia_solver_boundary_ptr karawia_boundary_;
+    // factors are kept until the diagonals change:
+    bool is_factorized_;
+    std::size_t factorized_start_, factorized_end_;
+    solver_stats_ptr stats_;
+
+    void set_sixtuples(std::size_t start_idx, std::size_t end_idx);
+
+    void factorize(std::size_t start_idx, std::size_t end_idx);
+
+    void substitute(std::tuple<double, double> const &init_coeffs, std::tuple<double, double> const &fin_coeffs,
+                    std::size_t start_idx, std::size_t end_idx, container_t &solution);
+
+    void kernel(boundary_1d_pair const &boundary, container_t &solution, double time);
 
     void kernel(boundary_1d_pair const &boundary, boundary_1d_pair const &other_boundary, container_t &solution,
                 double time);
@@ -52,6 +67,20 @@ class karawia_solver
 
     void set_rhs(container_t const &rhs);
 
+    /**
+        @brief  Records solve times and counts into the statistics
+        @param  stats - solver statistics, null stops the recording
+    **/
+    void set_stats(solver_stats_ptr const &stats);
+
+    /**
+        @brief  Solves the system with unknowns 1,...,N-1, rows 1 and N-1 carry no lowest and uppest entries
+        @param  boundary - Dirichlet boundary pair giving nodes 0 and N
+        @param  solution - solution container
+        @param  at_time - time at which the boundary is evaluated
+    **/
+    void solve(boundary_1d_pair const &boundary, container_t &solution, double at_time);
+
     void solve(boundary_1d_pair const &boundary, boundary_1d_pair const &other_boundary, container_t &solution);
 
     void solve(boundary_1d_pair const &boundary, boundary_1d_pair const &other_boundary, container_t &solution,
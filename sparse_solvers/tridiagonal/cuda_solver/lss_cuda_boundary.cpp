@@ -8,6 +8,7 @@
 namespace lss_cuda_solver
 {
 
+using lss_boundary::boundary_cast;
 using lss_boundary::dirichlet_boundary_1d;
 using lss_boundary::dirichlet_boundary_2d;
 using lss_boundary::dirichlet_boundary_3d;
@@ -106,7 +107,7 @@ void cuda_boundary::initialise(boundary_1d_pair const &boundary, double time)
     const auto f_1 = std::get<3>(lower_quad_);
     const double two = static_cast<double>(2.0);
     auto const &first_bnd = boundary.first;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(first_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(first_bnd))
     {
         const auto cst_val = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         start_index_ = 1;
@@ -114,7 +115,7 @@ void cuda_boundary::initialise(boundary_1d_pair const &boundary, double time)
         c_init_ = c_1;
         f_init_ = f_1 - a_1 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const auto cst_val = two * space_step_ * (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         start_index_ = 0;
@@ -122,7 +123,7 @@ void cuda_boundary::initialise(boundary_1d_pair const &boundary, double time)
         c_init_ = a_0 + c_0;
         f_init_ = f_0 - a_0 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const auto lin_val =
             two * space_step_ * (ptr->is_time_dependent() ? ptr->linear_value(time) : ptr->linear_value());
@@ -150,7 +151,7 @@ void cuda_boundary::initialise(boundary_2d_pair const &boundary, double time, do
     const auto f_1 = std::get<3>(lower_quad_);
     const double two = static_cast<double>(2.0);
     auto const &first_bnd = boundary.first;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(first_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(first_bnd))
     {
         const auto cst_val = ptr->value(time, space_arg);
         start_index_ = 1;
@@ -158,7 +159,7 @@ void cuda_boundary::initialise(boundary_2d_pair const &boundary, double time, do
         c_init_ = c_1;
         f_init_ = f_1 - a_1 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_2d>(first_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_2d>(first_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_arg);
         start_index_ = 0;
@@ -166,7 +167,7 @@ void cuda_boundary::initialise(boundary_2d_pair const &boundary, double time, do
         c_init_ = a_0 + c_0;
         f_init_ = f_0 - a_0 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_2d>(first_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_2d>(first_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_arg);
         const auto cst_val = two * space_step_ * ptr->value(time, space_arg);
@@ -193,7 +194,7 @@ void cuda_boundary::initialise(boundary_3d_pair const &boundary, double time, do
     const auto f_1 = std::get<3>(lower_quad_);
     const double two = static_cast<double>(2.0);
     auto const &first_bnd = boundary.first;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(first_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(first_bnd))
     {
         const auto cst_val = ptr->value(time, space_1_arg, space_2_arg);
         start_index_ = 1;
@@ -201,7 +202,7 @@ void cuda_boundary::initialise(boundary_3d_pair const &boundary, double time, do
         c_init_ = c_1;
         f_init_ = f_1 - a_1 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(first_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_3d>(first_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
         start_index_ = 0;
@@ -209,7 +210,7 @@ void cuda_boundary::initialise(boundary_3d_pair const &boundary, double time, do
         c_init_ = a_0 + c_0;
         f_init_ = f_0 - a_0 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_3d>(first_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_3d>(first_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_1_arg, space_2_arg);
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
@@ -236,7 +237,7 @@ void cuda_boundary::finalise(boundary_1d_pair const &boundary, double time)
     const auto f_end = std::get<3>(highest_quad_);
     const double two = static_cast<double>(2.0);
     auto const &second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(second_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(second_bnd))
     {
         const auto cst_val = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         end_index_ = discretization_size_ - 2;
@@ -244,7 +245,7 @@ void cuda_boundary::finalise(boundary_1d_pair const &boundary, double time)
         b_end_ = b;
         f_end_ = f - c * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const auto cst_val = two * space_step_ * (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         end_index_ = discretization_size_ - 1;
@@ -252,7 +253,7 @@ void cuda_boundary::finalise(boundary_1d_pair const &boundary, double time)
         b_end_ = b_end;
         f_end_ = f_end + c_end * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const auto lin_val =
             two * space_step_ * (ptr->is_time_dependent() ? ptr->linear_value(time) : ptr->linear_value());
@@ -281,7 +282,7 @@ void cuda_boundary::finalise(boundary_2d_pair const &boundary, double time, doub
     const auto f_end = std::get<3>(highest_quad_);
     const double two = static_cast<double>(2.0);
     auto const &second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(second_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(second_bnd))
     {
         const auto cst_val = ptr->value(time, space_args);
         end_index_ = discretization_size_ - 2;
@@ -289,7 +290,7 @@ void cuda_boundary::finalise(boundary_2d_pair const &boundary, double time, doub
         b_end_ = b;
         f_end_ = f - c * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_2d>(second_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_2d>(second_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_args);
         end_index_ = discretization_size_ - 1;
@@ -297,7 +298,7 @@ void cuda_boundary::finalise(boundary_2d_pair const &boundary, double time, doub
         b_end_ = b_end;
         f_end_ = f_end + c_end * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_2d>(second_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_2d>(second_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_args);
         const auto cst_val = two * space_step_ * ptr->value(time, space_args);
@@ -324,7 +325,7 @@ void cuda_boundary::finalise(boundary_3d_pair const &boundary, double time, doub
     const auto f_end = std::get<3>(highest_quad_);
     const double two = static_cast<double>(2.0);
     auto const &second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(second_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(second_bnd))
     {
         const auto cst_val = ptr->value(time, space_1_arg, space_2_arg);
         end_index_ = discretization_size_ - 2;
@@ -332,7 +333,7 @@ void cuda_boundary::finalise(boundary_3d_pair const &boundary, double time, doub
         b_end_ = b;
         f_end_ = f - c * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(second_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_3d>(second_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
         end_index_ = discretization_size_ - 1;
@@ -340,7 +341,7 @@ void cuda_boundary::finalise(boundary_3d_pair const &boundary, double time, doub
         b_end_ = b_end;
         f_end_ = f_end + c_end * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_3d>(second_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_3d>(second_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_1_arg, space_2_arg);
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
@@ -358,7 +359,7 @@ void cuda_boundary::finalise(boundary_3d_pair const &boundary, double time, doub
 const double cuda_boundary::upper_boundary(boundary_1d_pair const &boundary, double time)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(boundary.second))
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(boundary.second))
     {
         ret = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
     }
@@ -369,7 +370,7 @@ const double cuda_boundary::upper_boundary(boundary_1d_pair const &boundary, dou
 const double cuda_boundary::upper_boundary(boundary_2d_pair const &boundary, double time, double space_args)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(boundary.second))
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(boundary.second))
     {
         ret = ptr->value(time, space_args);
     }
@@ -381,7 +382,7 @@ const double cuda_boundary::upper_boundary(boundary_3d_pair const &boundary, dou
                                            double space_2_arg)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(boundary.second))
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(boundary.second))
     {
         ret = ptr->value(time, space_1_arg, space_2_arg);
     }
@@ -392,7 +393,7 @@ const double cuda_boundary::upper_boundary(boundary_3d_pair const &boundary, dou
 const double cuda_boundary::lower_boundary(boundary_1d_pair const &boundary, double time)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(boundary.first))
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(boundary.first))
     {
         ret = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
     }
@@ -402,7 +403,7 @@ const double cuda_boundary::lower_boundary(boundary_1d_pair const &boundary, dou
 const double cuda_boundary::lower_boundary(boundary_2d_pair const &boundary, double time, double space_arg)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(boundary.first))
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(boundary.first))
     {
         ret = ptr->value(time, space_arg);
     }
@@ -413,7 +414,7 @@ const double cuda_boundary::lower_boundary(boundary_3d_pair const &boundary, dou
                                            double space_2_arg)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(boundary.first))
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(boundary.first))
     {
         ret = ptr->value(time, space_1_arg, space_2_arg);
     }
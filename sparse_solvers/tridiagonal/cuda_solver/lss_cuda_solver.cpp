@@ -5,6 +5,7 @@
 namespace lss_cuda_solver
 {
 
+using lss_core_banded_solver::tridiagonal_banded_solver;
 using lss_core_cuda_solver::flat_matrix;
 
 template <> void cuda_solver<memory_space_enum::Host>::initialize()
@@ -12,10 +13,11 @@ template <> void cuda_solver<memory_space_enum::Host>::initialize()
     const double one = static_cast<double>(1.0);
     const double step = one / static_cast<double>(discretization_size_ - 1);
     cuda_boundary_ = std::make_shared<cuda_boundary>(discretization_size_, step);
+    banded_solver_ = std::make_shared<tridiagonal_banded_solver>(discretization_size_);
 }
 template <>
 cuda_solver<memory_space_enum::Host>::cuda_solver(std::size_t discretization_size)
-    : lss_tridiagonal_solver::tridiagonal_solver(discretization_size, factorization_enum::QRMethod)
+    : lss_tridiagonal_solver::tridiagonal_solver(discretization_size, factorization_enum::QRMethod), factors_key_{}
 {
     initialize();
 }
@@ -24,6 +26,47 @@ template <> cuda_solver<memory_space_enum::Host>::~cuda_solver()
 {
 }
 
+template <>
+void cuda_solver<memory_space_enum::Host>::banded_solve(triplet_t const &init_coeffs, triplet_t const &fin_coeffs,
+                                                        std::size_t start_idx, std::size_t end_idx,
+                                                        factorization_enum factorization, container_t &solution)
+{
+    const std::size_t system_size = end_idx - start_idx + 1;
+    // factors depend only on diagonals, linear part of boundary and factorization, reuse them while unchanged:
+    const factors_key_t key =
+        std::make_tuple(diagonals_version_, start_idx, end_idx, std::get<0>(init_coeffs), std::get<1>(init_coeffs),
+                        std::get<0>(fin_coeffs), std::get<1>(fin_coeffs), factorization);
+    if (key != factors_key_)
+    {
+        // entries outside the band are never read, so the containers are only resized:
+        low_.resize(system_size);
+        diag_.resize(system_size);
+        high_.resize(system_size);
+        diag_[0] = std::get<0>(init_coeffs);
+        high_[0] = std::get<1>(init_coeffs);
+        for (std::size_t t = 1; t < system_size - 1; ++t)
+        {
+            low_[t] = a_[t + start_idx];
+            diag_[t] = b_[t + start_idx];
+            high_[t] = c_[t + start_idx];
+        }
+        low_[system_size - 1] = std::get<0>(fin_coeffs);
+        diag_[system_size - 1] = std::get<1>(fin_coeffs);
+
+        banded_solver_->resize(system_size);
+        banded_solver_->factorize(low_, diag_, high_, factorization);
+        factors_key_ = key;
+    }
+
+    rhs_.resize(system_size);
+    rhs_[0] = std::get<2>(init_coeffs);
+    std::copy(std::next(f_.begin(), start_idx + 1), std::next(f_.begin(), end_idx), std::next(rhs_.begin()));
+    rhs_[system_size - 1] = std::get<2>(fin_coeffs);
+    banded_solver_->solve(rhs_);
+
+    std::copy(rhs_.begin(), rhs_.end(), std::next(solution.begin(), start_idx));
+}
+
 template <>
 void cuda_solver<memory_space_enum::Host>::kernel(boundary_1d_pair const &boundary, container_t &solution,
                                                   factorization_enum factorization, double time)
@@ -44,33 +87,7 @@ void cuda_solver<memory_space_enum::Host>::kernel(boundary_1d_pair const &bounda
     const auto &fin_coeffs = cuda_boundary_->final_coefficients(boundary, time);
     const std::size_t end_idx = cuda_boundary_->end_index();
 
-    const std::size_t system_size = end_idx - start_idx + 1;
-    flat_matrix mat(system_size, system_size);
-    container_t rhs(system_size, double{});
-
-    rhs[0] = std::get<2>(init_coeffs);
-    mat.emplace_back(0, 0, std::get<0>(init_coeffs));
-    mat.emplace_back(0, 1, std::get<1>(init_coeffs));
-    for (std::size_t t = 1; t < system_size - 1; ++t)
-    {
-        mat.emplace_back(t, t - 1, a_[t + start_idx]);
-        mat.emplace_back(t, t, b_[t + start_idx]);
-        mat.emplace_back(t, t + 1, c_[t + start_idx]);
-        rhs[t] = f_[t + start_idx];
-    }
-    mat.emplace_back(system_size - 1, system_size - 2, std::get<0>(fin_coeffs));
-    mat.emplace_back(system_size - 1, system_size - 1, std::get<1>(fin_coeffs));
-    rhs[system_size - 1] = std::get<2>(fin_coeffs);
-
-    // initialise the solver:
-    real_sparse_solver_cuda<memory_space_enum::Host> rss(system_size);
-    rss.initialize(system_size);
-    rss.set_flat_sparse_matrix(std::move(mat));
-    rss.set_rhs(rhs);
-    container_t sub_solution(system_size, double{});
-    rss.solve(sub_solution, factorization);
-
-    std::copy(sub_solution.begin(), sub_solution.end(), std::next(solution.begin(), start_idx));
+    banded_solve(init_coeffs, fin_coeffs, start_idx, end_idx, factorization, solution);
     // fill in the boundary values:
     if (start_idx == 1)
         solution[0] = cuda_boundary_->lower_boundary(boundary, time);
@@ -97,33 +114,7 @@ void cuda_solver<memory_space_enum::Host>::kernel(boundary_2d_pair const &bounda
     const auto &fin_coeffs = cuda_boundary_->final_coefficients(boundary, time, space_arg);
     const std::size_t end_idx = cuda_boundary_->end_index();
 
-    const std::size_t system_size = end_idx - start_idx + 1;
-    flat_matrix mat(system_size, system_size);
-    container_t rhs(system_size, double{});
-
-    rhs[0] = std::get<2>(init_coeffs);
-    mat.emplace_back(0, 0, std::get<0>(init_coeffs));
-    mat.emplace_back(0, 1, std::get<1>(init_coeffs));
-    for (std::size_t t = 1; t < system_size - 1; ++t)
-    {
-        mat.emplace_back(t, t - 1, a_[t + start_idx]);
-        mat.emplace_back(t, t, b_[t + start_idx]);
-        mat.emplace_back(t, t + 1, c_[t + start_idx]);
-        rhs[t] = f_[t + start_idx];
-    }
-    mat.emplace_back(system_size - 1, system_size - 2, std::get<0>(fin_coeffs));
-    mat.emplace_back(system_size - 1, system_size - 1, std::get<1>(fin_coeffs));
-    rhs[system_size - 1] = std::get<2>(fin_coeffs);
-
-    // initialise the solver:
-    real_sparse_solver_cuda<memory_space_enum::Host> rss(system_size);
-    rss.initialize(system_size);
-    rss.set_flat_sparse_matrix(std::move(mat));
-    rss.set_rhs(rhs);
-    container_t sub_solution(system_size, double{});
-    rss.solve(sub_solution, factorization);
-
-    std::copy(sub_solution.begin(), sub_solution.end(), std::next(solution.begin(), start_idx));
+    banded_solve(init_coeffs, fin_coeffs, start_idx, end_idx, factorization, solution);
     // fill in the boundary values:
     if (start_idx == 1)
         solution[0] = cuda_boundary_->lower_boundary(boundary, time, space_arg);
@@ -152,33 +143,7 @@ void cuda_solver<memory_space_enum::Host>::kernel(boundary_3d_pair const &bounda
     const auto &fin_coeffs = cuda_boundary_->final_coefficients(boundary, time, space_1_arg, space_2_arg);
     const std::size_t end_idx = cuda_boundary_->end_index();
 
-    const std::size_t system_size = end_idx - start_idx + 1;
-    flat_matrix mat(system_size, system_size);
-    container_t rhs(system_size, double{});
-
-    rhs[0] = std::get<2>(init_coeffs);
-    mat.emplace_back(0, 0, std::get<0>(init_coeffs));
-    mat.emplace_back(0, 1, std::get<1>(init_coeffs));
-    for (std::size_t t = 1; t < system_size - 1; ++t)
-    {
-        mat.emplace_back(t, t - 1, a_[t + start_idx]);
-        mat.emplace_back(t, t, b_[t + start_idx]);
-        mat.emplace_back(t, t + 1, c_[t + start_idx]);
-        rhs[t] = f_[t + start_idx];
-    }
-    mat.emplace_back(system_size - 1, system_size - 2, std::get<0>(fin_coeffs));
-    mat.emplace_back(system_size - 1, system_size - 1, std::get<1>(fin_coeffs));
-    rhs[system_size - 1] = std::get<2>(fin_coeffs);
-
-    // initialise the solver:
-    real_sparse_solver_cuda<memory_space_enum::Host> rss(system_size);
-    rss.initialize(system_size);
-    rss.set_flat_sparse_matrix(std::move(mat));
-    rss.set_rhs(rhs);
-    container_t sub_solution(system_size, double{});
-    rss.solve(sub_solution, factorization);
-
-    std::copy(sub_solution.begin(), sub_solution.end(), std::next(solution.begin(), start_idx));
+    banded_solve(init_coeffs, fin_coeffs, start_idx, end_idx, factorization, solution);
     // fill in the boundary values:
     if (start_idx == 1)
         solution[0] = cuda_boundary_->lower_boundary(boundary, time, space_1_arg, space_2_arg);
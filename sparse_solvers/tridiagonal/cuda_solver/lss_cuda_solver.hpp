@@ -2,9 +2,12 @@
 #if !defined(_LSS_CUDA_SOLVER_HPP_)
 #define _LSS_CUDA_SOLVER_HPP_
 
+#include <tuple>
+
 #include "../../../boundaries/lss_boundary.hpp"
 #include "../../../common/lss_enumerations.hpp"
 #include "../../../common/lss_utility.hpp"
+#include "../../general/core_banded_solver/lss_core_banded_solver.hpp"
 #include "../../general/core_cuda_solver/lss_core_cuda_solver.hpp"
 #include "../lss_tridiagonal_solver.hpp"
 #include "lss_cuda_boundary.hpp"
@@ -15,16 +18,28 @@ namespace lss_cuda_solver
 using lss_boundary::boundary_1d_pair;
 using lss_boundary::boundary_2d_pair;
 using lss_boundary::boundary_3d_pair;
+using lss_core_banded_solver::tridiagonal_banded_solver_ptr;
 using lss_core_cuda_solver::real_sparse_solver_cuda;
 using lss_enumerations::factorization_enum;
 using lss_enumerations::memory_space_enum;
 using lss_utility::container_t;
 using lss_utility::sptr_t;
 
+// diagonals version, start and end index, initial diagonals, final diagonals and factorization:
+using factors_key_t =
+    std::tuple<std::size_t, std::size_t, std::size_t, double, double, double, double, factorization_enum>;
+
 template <memory_space_enum memory_space> class cuda_solver : public lss_tridiagonal_solver::tridiagonal_solver
 {
   private:
     cuda_boundary_ptr cuda_boundary_;
+    // Host only: reduced system and its banded factorization (diagonals version 0 means none):
+    container_t low_, diag_, high_, rhs_;
+    factors_key_t factors_key_;
+    tridiagonal_banded_solver_ptr banded_solver_;
+
+    void banded_solve(triplet_t const &init_coeffs, triplet_t const &fin_coeffs, std::size_t start_idx,
+                      std::size_t end_idx, factorization_enum factorization, container_t &solution);
 
     void kernel(boundary_1d_pair const &boundary, container_t &solution, factorization_enum factorization,
                 double time) override;
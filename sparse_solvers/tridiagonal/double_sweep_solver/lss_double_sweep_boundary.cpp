@@ -8,6 +8,7 @@
 namespace lss_double_sweep_solver
 {
 
+using lss_boundary::boundary_cast;
 using lss_boundary::dirichlet_boundary_1d;
 using lss_boundary::dirichlet_boundary_2d;
 using lss_boundary::dirichlet_boundary_3d;
@@ -17,6 +18,7 @@ using lss_boundary::neumann_boundary_3d;
 using lss_boundary::robin_boundary_1d;
 using lss_boundary::robin_boundary_2d;
 using lss_boundary::robin_boundary_3d;
+using lss_enumerations::boundary_enum;
 
 double_sweep_boundary::double_sweep_boundary(const std::size_t &discretization_size, const double &space_step)
     : discretization_size_{discretization_size}, space_step_{space_step}
@@ -39,7 +41,7 @@ std::size_t double_sweep_boundary::start_index() const
 
 std::size_t double_sweep_boundary::end_index(boundary_1d_pair const &boundary) const
 {
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(boundary.second))
+    if (boundary.second->kind() == boundary_enum::Dirichlet)
     {
         return (discretization_size_ - 2);
     }
@@ -48,7 +50,7 @@ std::size_t double_sweep_boundary::end_index(boundary_1d_pair const &boundary) c
 
 std::size_t double_sweep_boundary::end_index(boundary_2d_pair const &boundary) const
 {
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(boundary.second))
+    if (boundary.second->kind() == boundary_enum::Dirichlet)
     {
         return (discretization_size_ - 2);
     }
@@ -57,7 +59,7 @@ std::size_t double_sweep_boundary::end_index(boundary_2d_pair const &boundary) c
 
 std::size_t double_sweep_boundary::end_index(boundary_3d_pair const &boundary) const
 {
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(boundary.second))
+    if (boundary.second->kind() == boundary_enum::Dirichlet)
     {
         return (discretization_size_ - 2);
     }
@@ -73,21 +75,21 @@ void double_sweep_boundary::initialise(boundary_1d_pair const &boundary, double
     const double two = static_cast<double>(2.0);
     const double mone = static_cast<double>(-1.0);
     auto const &first_bnd = boundary.first;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(first_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(first_bnd))
     {
         const auto cst_val = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         start_index_ = 1;
         k_ = cst_val;
         l_ = double{};
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const auto cst_val = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         start_index_ = 0;
         k_ = (f - a * space_step_ * two * cst_val) / b;
         l_ = mone * (a + c) / b;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const auto lin_val = (ptr->is_time_dependent() ? ptr->linear_value(time) : ptr->linear_value());
         const auto cst_val = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
@@ -111,21 +113,21 @@ void double_sweep_boundary::initialise(boundary_2d_pair const &boundary, double
     const double two = static_cast<double>(2.0);
     const double mone = static_cast<double>(-1.0);
     auto const &first_bnd = boundary.first;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(first_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(first_bnd))
     {
         const auto cst_val = ptr->value(time, space_arg);
         start_index_ = 1;
         k_ = cst_val;
         l_ = float{};
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_2d>(first_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_2d>(first_bnd))
     {
         const auto cst_val = ptr->value(time, space_arg);
         start_index_ = 0;
         k_ = (f - a * space_step_ * two * cst_val) / b;
         l_ = mone * (a + c) / b;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_2d>(first_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_2d>(first_bnd))
     {
         const auto lin_val = ptr->linear_value(time, space_arg);
         const auto cst_val = ptr->value(time, space_arg);
@@ -150,21 +152,21 @@ void double_sweep_boundary::initialise(boundary_3d_pair const &boundary, double
     const double two = static_cast<double>(2.0);
     const double mone = static_cast<double>(-1.0);
     auto const &first_bnd = boundary.first;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(first_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(first_bnd))
     {
         const auto cst_val = ptr->value(time, space_1_arg, space_2_arg);
         start_index_ = 1;
         k_ = cst_val;
         l_ = float{};
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(first_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_3d>(first_bnd))
     {
         const auto cst_val = ptr->value(time, space_1_arg, space_2_arg);
         start_index_ = 0;
         k_ = (f - a * space_step_ * two * cst_val) / b;
         l_ = mone * (a + c) / b;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_3d>(first_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_3d>(first_bnd))
     {
         const auto lin_val = ptr->linear_value(time, space_1_arg, space_2_arg);
         const auto cst_val = ptr->value(time, space_1_arg, space_2_arg);
@@ -185,16 +187,16 @@ void double_sweep_boundary::finalise(boundary_1d_pair const &boundary, const dou
     const double two = static_cast<double>(2.0);
     const double one = static_cast<double>(1.0);
     auto const &second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(second_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(second_bnd))
     {
         upper_ = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const auto cst_val = two * space_step_ * (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         upper_ = (l_n * (k_nm1 - cst_val) + k_n) / (one - l_n * l_nm1);
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const auto lin_val =
             two * space_step_ * (ptr->is_time_dependent() ? ptr->linear_value(time) : ptr->linear_value());
@@ -213,16 +215,16 @@ void double_sweep_boundary::finalise(boundary_2d_pair const &boundary, const dou
     const double two = static_cast<double>(2.0);
     const double one = static_cast<double>(1.0);
     auto const &second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(second_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(second_bnd))
     {
         upper_ = ptr->value(time, space_args);
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_2d>(second_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_2d>(second_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_args);
         upper_ = (l_n * (k_nm1 - cst_val) + k_n) / (one - l_n * l_nm1);
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_2d>(second_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_2d>(second_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_args);
         const auto cst_val = two * space_step_ * ptr->value(time, space_args);
@@ -241,16 +243,16 @@ void double_sweep_boundary::finalise(boundary_3d_pair const &boundary, const dou
     const double two = static_cast<double>(2.0);
     const double one = static_cast<double>(1.0);
     auto const &second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(second_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(second_bnd))
     {
         upper_ = ptr->value(time, space_1_arg, space_2_arg);
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(second_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_3d>(second_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
         upper_ = (l_n * (k_nm1 - cst_val) + k_n) / (one - l_n * l_nm1);
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_3d>(second_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_3d>(second_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_1_arg, space_2_arg);
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
@@ -309,7 +311,7 @@ const double double_sweep_boundary::upper_boundary(boundary_3d_pair const &bound
 const double double_sweep_boundary::lower_boundary(boundary_1d_pair const &boundary, double time)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(boundary.first))
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(boundary.first))
     {
         ret = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
     }
@@ -319,7 +321,7 @@ const double double_sweep_boundary::lower_boundary(boundary_1d_pair const &bound
 const double double_sweep_boundary::lower_boundary(boundary_2d_pair const &boundary, double time, double space_arg)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(boundary.first))
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(boundary.first))
     {
         ret = ptr->value(time, space_arg);
     }
@@ -330,7 +332,7 @@ const double double_sweep_boundary::lower_boundary(boundary_3d_pair const &bound
                                                    double space_2_arg)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(boundary.first))
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(boundary.first))
     {
         ret = ptr->value(time, space_1_arg, space_2_arg);
     }
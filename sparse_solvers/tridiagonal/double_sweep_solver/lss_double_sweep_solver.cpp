@@ -152,4 +152,96 @@ void double_sweep_solver::kernel(boundary_3d_pair const &boundary, container_t &
 
 // double precision specialization:
 
+template <typename boundary_pair, typename... space_args_t>
+void double_sweep_solver::solve_batch(boundary_pair const &boundary, tridiagonal_batch &batch, double time,
+                                      space_args_t const &...space_args)
+{
+    const std::size_t M = batch.systems_count();
+    if (M == 0)
+        return;
+    const std::size_t N = discretization_size_ - 1;
+    double const *a = batch.raw_low();
+    double const *b = batch.raw_diag();
+    double const *c = batch.raw_high();
+    double const *f = batch.raw_rhs();
+    double *x = batch.raw_solution();
+
+    // reset coefficients:
+    K_.assign(discretization_size_ * M, double{});
+    L_.assign(discretization_size_ * M, double{});
+
+    // boundary coefficients are computed system by system, boundary types are shared by all systems:
+    std::size_t start_index{};
+    const std::size_t end_index = dss_boundary_->end_index(system_boundary(boundary, 0));
+    for (std::size_t s = 0; s < M; ++s)
+    {
+        auto const &bnd = system_boundary(boundary, s);
+        const auto &low_quad = std::make_tuple(a[s], b[s], c[s], f[s]);
+        dss_boundary_->set_low_quad(low_quad);
+        const auto pair = dss_boundary_->coefficients(bnd, time, space_args[s]...);
+        LSS_ASSERT((s == 0) || ((start_index == dss_boundary_->start_index()) &&
+                                (end_index == dss_boundary_->end_index(bnd))),
+                   "All systems in batch must share boundary types");
+        start_index = dss_boundary_->start_index();
+        L_[s] = std::get<1>(pair);
+        K_[s] = std::get<0>(pair);
+        if (start_index == 1)
+            x[s] = dss_boundary_->lower_boundary(bnd, time, space_args[s]...);
+    }
+
+    // systems are the innermost index so the loops below run across SIMD lanes:
+    double tmp{};
+    double mone = static_cast<double>(-1.0);
+    for (std::size_t t = 1; t <= end_index; ++t)
+    {
+        const std::size_t row = t * M;
+        const std::size_t prev = row - M;
+        for (std::size_t s = 0; s < M; ++s)
+        {
+            tmp = b[row + s] + (a[row + s] * L_[prev + s]);
+            L_[row + s] = mone * c[row + s] / tmp;
+            K_[row + s] = (f[row + s] - (a[row + s] * K_[prev + s])) / tmp;
+        }
+    }
+
+    const std::size_t last_row = N * M;
+    for (std::size_t s = 0; s < M; ++s)
+    {
+        x[last_row + s] = dss_boundary_->upper_boundary(system_boundary(boundary, s), K_[last_row - M + s],
+                                                        K_[last_row + s], L_[last_row - M + s], L_[last_row + s],
+                                                        time, space_args[s]...);
+    }
+
+    for (std::size_t t = N; t-- > start_index;)
+    {
+        const std::size_t row = t * M;
+        for (std::size_t s = 0; s < M; ++s)
+        {
+            x[row + s] = (L_[row + s] * x[row + M + s]) + K_[row + s];
+        }
+    }
+}
+
+void double_sweep_solver::batch_kernel(boundary_1d_pair const &boundary, tridiagonal_batch &batch, double time)
+{
+    solve_batch(boundary, batch, time);
+}
+
+void double_sweep_solver::batch_kernel(boundary_1d_pairs const &boundaries, tridiagonal_batch &batch, double time)
+{
+    solve_batch(boundaries, batch, time);
+}
+
+void double_sweep_solver::batch_kernel(boundary_2d_pair const &boundary, tridiagonal_batch &batch, double time,
+                                       container_t const &space_args)
+{
+    solve_batch(boundary, batch, time, space_args);
+}
+
+void double_sweep_solver::batch_kernel(boundary_3d_pair const &boundary, tridiagonal_batch &batch, double time,
+                                       container_t const &space_1_args, container_t const &space_2_args)
+{
+    solve_batch(boundary, batch, time, space_1_args, space_2_args);
+}
+
 } // namespace lss_double_sweep_solver
@@ -19,9 +19,12 @@ namespace lss_double_sweep_solver
 {
 
 using lss_boundary::boundary_1d_pair;
+using lss_boundary::boundary_1d_pairs;
 using lss_boundary::boundary_2d_pair;
 using lss_boundary::boundary_3d_pair;
 using lss_enumerations::factorization_enum;
+using lss_tridiagonal_solver::system_boundary;
+using lss_tridiagonal_solver::tridiagonal_batch;
 using lss_utility::container_t;
 using lss_utility::sptr_t;
 
@@ -44,6 +47,20 @@ class double_sweep_solver : public lss_tridiagonal_solver::tridiagonal_solver
     void kernel(boundary_3d_pair const &boundary, container_t &solution, factorization_enum factorization, double time,
                 double space_1_arg, double space_2_arg) override;
 
+    void batch_kernel(boundary_1d_pair const &boundary, tridiagonal_batch &batch, double time) override;
+
+    void batch_kernel(boundary_1d_pairs const &boundaries, tridiagonal_batch &batch, double time) override;
+
+    void batch_kernel(boundary_2d_pair const &boundary, tridiagonal_batch &batch, double time,
+                      container_t const &space_args) override;
+
+    void batch_kernel(boundary_3d_pair const &boundary, tridiagonal_batch &batch, double time,
+                      container_t const &space_1_args, container_t const &space_2_args) override;
+
+    template <typename boundary_pair, typename... space_args_t>
+    void solve_batch(boundary_pair const &boundary, tridiagonal_batch &batch, double time,
+                     space_args_t const &...space_args);
+
     void initialize();
 
     explicit double_sweep_solver() = delete;
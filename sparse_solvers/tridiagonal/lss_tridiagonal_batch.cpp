@@ -0,0 +1,39 @@
+#include "lss_tridiagonal_batch.hpp"
+
+namespace lss_tridiagonal_solver
+{
+
+tridiagonal_batch::tridiagonal_batch(std::size_t system_size, std::size_t systems_count)
+    : system_size_{system_size}, systems_count_{systems_count}, low_(system_size * systems_count),
+      diag_(system_size * systems_count), high_(system_size * systems_count), rhs_(system_size * systems_count),
+      solution_(system_size * systems_count), are_diagonals_kept_{false}
+{
+}
+
+tridiagonal_batch::~tridiagonal_batch()
+{
+}
+
+std::size_t tridiagonal_batch::system_size() const
+{
+    return system_size_;
+}
+
+std::size_t tridiagonal_batch::systems_count() const
+{
+    return systems_count_;
+}
+
+void tridiagonal_batch::resize(std::size_t systems_count)
+{
+    const std::size_t total = system_size_ * systems_count;
+    systems_count_ = systems_count;
+    low_.assign(total, double{});
+    diag_.assign(total, double{});
+    high_.assign(total, double{});
+    rhs_.assign(total, double{});
+    solution_.assign(total, double{});
+    are_diagonals_kept_ = false;
+}
+
+} // namespace lss_tridiagonal_solver
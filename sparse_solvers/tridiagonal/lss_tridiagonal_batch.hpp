@@ -0,0 +1,164 @@
+#pragma once
+#if !defined(_LSS_TRIDIAGONAL_BATCH_HPP_)
+#define _LSS_TRIDIAGONAL_BATCH_HPP_
+
+#include "../../common/lss_macros.hpp"
+#include "../../common/lss_utility.hpp"
+#include "../../containers/lss_aligned_allocator.hpp"
+#include "../../containers/lss_strided_span.hpp"
+
+namespace lss_tridiagonal_solver
+{
+
+using lss_containers::aligned_container_t;
+using lss_containers::strided_span;
+using lss_utility::sptr_t;
+
+/**
+    tridiagonal_batch object
+
+    Holds systems_count independent tridiagonal systems of equal size in
+    structure-of-arrays layout: t-th entry of s-th system is stored at
+    t * systems_count + s, so that consecutive systems sit in consecutive
+    SIMD lanes. Entries of a single system are reachable through strided views.
+ */
+class tridiagonal_batch
+{
+  private:
+    std::size_t system_size_;
+    std::size_t systems_count_;
+    aligned_container_t low_, diag_, high_, rhs_, solution_;
+    // diagonals are those of the last solve, so solvers may reuse their factorization:
+    bool are_diagonals_kept_;
+
+    explicit tridiagonal_batch() = delete;
+
+  public:
+    explicit tridiagonal_batch(std::size_t system_size, std::size_t systems_count);
+
+    ~tridiagonal_batch();
+
+    LSS_API std::size_t system_size() const;
+
+    LSS_API std::size_t systems_count() const;
+
+    /**
+        @brief  Changes number of systems in batch and zeroes all entries
+        @param  systems_count - new number of systems
+    **/
+    LSS_API void resize(std::size_t systems_count);
+
+    /**
+        @brief  Declares the diagonals unchanged since the last solve of the batch,
+                every solve of the batch clears the declaration
+        @param  is_kept - true when the diagonals are those of the last solve
+    **/
+    inline void set_diagonals_kept(bool is_kept)
+    {
+        are_diagonals_kept_ = is_kept;
+    }
+
+    inline bool are_diagonals_kept() const
+    {
+        return are_diagonals_kept_;
+    }
+
+    inline std::size_t index(std::size_t t, std::size_t system_idx) const
+    {
+        return (t * systems_count_ + system_idx);
+    }
+
+    /**
+        @brief  Views of single system inside the batch
+        @param  system_idx - index of system
+        @retval non-owning strided view of system_size values
+    **/
+    inline strided_span<double> low(std::size_t system_idx)
+    {
+        return strided_span<double>(low_.data() + system_idx, system_size_, systems_count_);
+    }
+
+    inline strided_span<double> diag(std::size_t system_idx)
+    {
+        return strided_span<double>(diag_.data() + system_idx, system_size_, systems_count_);
+    }
+
+    inline strided_span<double> high(std::size_t system_idx)
+    {
+        return strided_span<double>(high_.data() + system_idx, system_size_, systems_count_);
+    }
+
+    inline strided_span<double> rhs(std::size_t system_idx)
+    {
+        return strided_span<double>(rhs_.data() + system_idx, system_size_, systems_count_);
+    }
+
+    inline strided_span<double> solution(std::size_t system_idx)
+    {
+        return strided_span<double>(solution_.data() + system_idx, system_size_, systems_count_);
+    }
+
+    inline strided_span<const double> solution(std::size_t system_idx) const
+    {
+        return strided_span<const double>(solution_.data() + system_idx, system_size_, systems_count_);
+    }
+
+    /**
+        @brief  Interleaved storage used by the batched kernels
+    **/
+    inline double const *raw_low() const
+    {
+        return low_.data();
+    }
+
+    inline double const *raw_diag() const
+    {
+        return diag_.data();
+    }
+
+    inline double const *raw_high() const
+    {
+        return high_.data();
+    }
+
+    inline double const *raw_rhs() const
+    {
+        return rhs_.data();
+    }
+
+    inline double *raw_solution()
+    {
+        return solution_.data();
+    }
+
+    inline double const *raw_solution() const
+    {
+        return solution_.data();
+    }
+
+    inline double *raw_low()
+    {
+        return low_.data();
+    }
+
+    inline double *raw_diag()
+    {
+        return diag_.data();
+    }
+
+    inline double *raw_high()
+    {
+        return high_.data();
+    }
+
+    inline double *raw_rhs()
+    {
+        return rhs_.data();
+    }
+};
+
+using tridiagonal_batch_ptr = sptr_t<tridiagonal_batch>;
+
+} // namespace lss_tridiagonal_solver
+
+#endif ///_LSS_TRIDIAGONAL_BATCH_HPP_
@@ -3,8 +3,10 @@
 namespace lss_tridiagonal_solver
 {
 
+using lss_enumerations::solver_phase_enum;
+
 tridiagonal_solver::tridiagonal_solver(std::size_t discretization_size, factorization_enum factorization)
-    : discretization_size_{discretization_size}, factorization_{factorization}
+    : discretization_size_{discretization_size}, factorization_{factorization}, diagonals_version_{}
 {
 }
 
@@ -13,9 +15,13 @@ void tridiagonal_solver::set_diagonals(container_t lower_diagonal, container_t d
     LSS_ASSERT(lower_diagonal.size() == discretization_size_, "Inncorect size for lower_diagonal");
     LSS_ASSERT(diagonal.size() == discretization_size_, "Inncorect size for diagonal");
     LSS_ASSERT(upper_diagonal.size() == discretization_size_, "Inncorect size for upper_diagonal");
+    // same diagonals keep the version, so the factorization survives reloading of unchanged matrix:
+    if ((lower_diagonal == a_) && (diagonal == b_) && (upper_diagonal == c_))
+        return;
     a_ = std::move(lower_diagonal);
     b_ = std::move(diagonal);
     c_ = std::move(upper_diagonal);
+    ++diagonals_version_;
 }
 
 void tridiagonal_solver::set_rhs(container_t const &rhs)
@@ -34,15 +40,24 @@ void tridiagonal_solver::set_omega(double value)
     omega_ = value;
 }
 
+void tridiagonal_solver::set_stats(solver_stats_ptr const &stats)
+{
+    stats_ = stats;
+}
+
 void tridiagonal_solver::solve(boundary_1d_pair const &boundary, container_t &solution)
 {
     LSS_ASSERT(solution.size() == discretization_size_, "Incorrect size of solution container");
+    LSS_STATS_PHASE(stats_, solver_phase_enum::LinearSolve);
+    LSS_STATS_ADD(stats_, add_solves, 1);
     kernel(boundary, solution, factorization_, double{});
 }
 
 void tridiagonal_solver::solve(boundary_1d_pair const &boundary, container_t &solution, double at_time)
 {
     LSS_ASSERT(solution.size() == discretization_size_, "Incorrect size of solution container");
+    LSS_STATS_PHASE(stats_, solver_phase_enum::LinearSolve);
+    LSS_STATS_ADD(stats_, add_solves, 1);
     kernel(boundary, solution, factorization_, at_time);
 }
 
@@ -50,6 +65,8 @@ void tridiagonal_solver::solve(boundary_2d_pair const &boundary, container_t &so
                                double space_arg)
 {
     LSS_ASSERT(solution.size() == discretization_size_, "Incorrect size of solution container");
+    LSS_STATS_PHASE(stats_, solver_phase_enum::LinearSolve);
+    LSS_STATS_ADD(stats_, add_solves, 1);
     kernel(boundary, solution, factorization_, at_time, space_arg);
 }
 
@@ -57,7 +74,125 @@ void tridiagonal_solver::solve(boundary_3d_pair const &boundary, container_t &so
                                double space_1_arg, double space_2_arg)
 {
     LSS_ASSERT(solution.size() == discretization_size_, "Incorrect size of solution container");
+    LSS_STATS_PHASE(stats_, solver_phase_enum::LinearSolve);
+    LSS_STATS_ADD(stats_, add_solves, 1);
     kernel(boundary, solution, factorization_, at_time, space_1_arg, space_2_arg);
 }
 
+void tridiagonal_solver::solve(boundary_1d_pair const &boundary, tridiagonal_batch &batch, double at_time)
+{
+    LSS_ASSERT(batch.system_size() == discretization_size_, "Incorrect size of systems in batch");
+    LSS_STATS_PHASE(stats_, solver_phase_enum::LinearSolve);
+    LSS_STATS_ADD(stats_, add_solves, batch.systems_count());
+    batch_kernel(boundary, batch, at_time);
+    batch.set_diagonals_kept(false);
+}
+
+void tridiagonal_solver::solve(boundary_1d_pairs const &boundaries, tridiagonal_batch &batch, double at_time)
+{
+    LSS_ASSERT(batch.system_size() == discretization_size_, "Incorrect size of systems in batch");
+    LSS_ASSERT(boundaries.size() >= batch.systems_count(), "Incorrect number of boundary pairs");
+    LSS_STATS_PHASE(stats_, solver_phase_enum::LinearSolve);
+    LSS_STATS_ADD(stats_, add_solves, batch.systems_count());
+    batch_kernel(boundaries, batch, at_time);
+    batch.set_diagonals_kept(false);
+}
+
+void tridiagonal_solver::solve(boundary_2d_pair const &boundary, tridiagonal_batch &batch, double at_time,
+                               container_t const &space_args)
+{
+    LSS_ASSERT(batch.system_size() == discretization_size_, "Incorrect size of systems in batch");
+    LSS_ASSERT(space_args.size() >= batch.systems_count(), "Incorrect size of space arguments");
+    LSS_STATS_PHASE(stats_, solver_phase_enum::LinearSolve);
+    LSS_STATS_ADD(stats_, add_solves, batch.systems_count());
+    batch_kernel(boundary, batch, at_time, space_args);
+    batch.set_diagonals_kept(false);
+}
+
+void tridiagonal_solver::solve(boundary_3d_pair const &boundary, tridiagonal_batch &batch, double at_time,
+                               container_t const &space_1_args, container_t const &space_2_args)
+{
+    LSS_ASSERT(batch.system_size() == discretization_size_, "Incorrect size of systems in batch");
+    LSS_ASSERT(space_1_args.size() >= batch.systems_count(), "Incorrect size of first space arguments");
+    LSS_ASSERT(space_2_args.size() >= batch.systems_count(), "Incorrect size of second space arguments");
+    LSS_STATS_PHASE(stats_, solver_phase_enum::LinearSolve);
+    LSS_STATS_ADD(stats_, add_solves, batch.systems_count());
+    batch_kernel(boundary, batch, at_time, space_1_args, space_2_args);
+    batch.set_diagonals_kept(false);
+}
+
+void tridiagonal_solver::load_system(tridiagonal_batch &batch, std::size_t system_idx)
+{
+    // copies the view and tells whether any value differed from the previous content:
+    const auto load = [this](strided_span<double> const &view, container_t &diagonal) {
+        bool is_changed = (diagonal.size() != discretization_size_);
+        diagonal.resize(discretization_size_);
+        for (std::size_t t = 0; t < discretization_size_; ++t)
+        {
+            is_changed = is_changed || (diagonal[t] != view[t]);
+            diagonal[t] = view[t];
+        }
+        return is_changed;
+    };
+    // systems sharing the operator keep the version, so the factorization is reused across them:
+    const bool is_low_changed = load(batch.low(system_idx), a_);
+    const bool is_diag_changed = load(batch.diag(system_idx), b_);
+    const bool is_high_changed = load(batch.high(system_idx), c_);
+    if (is_low_changed || is_diag_changed || is_high_changed)
+        ++diagonals_version_;
+    f_.resize(discretization_size_);
+    batch.rhs(system_idx).copy_to(f_);
+    load_guess(batch, system_idx);
+}
+
+void tridiagonal_solver::load_guess(tridiagonal_batch const &batch, std::size_t system_idx)
+{
+}
+
+void tridiagonal_solver::batch_kernel(boundary_1d_pair const &boundary, tridiagonal_batch &batch, double time)
+{
+    container_t solution(discretization_size_);
+    for (std::size_t s = 0; s < batch.systems_count(); ++s)
+    {
+        load_system(batch, s);
+        kernel(boundary, solution, factorization_, time);
+        batch.solution(s).copy_from(solution);
+    }
+}
+
+void tridiagonal_solver::batch_kernel(boundary_1d_pairs const &boundaries, tridiagonal_batch &batch, double time)
+{
+    container_t solution(discretization_size_);
+    for (std::size_t s = 0; s < batch.systems_count(); ++s)
+    {
+        load_system(batch, s);
+        kernel(boundaries[s], solution, factorization_, time);
+        batch.solution(s).copy_from(solution);
+    }
+}
+
+void tridiagonal_solver::batch_kernel(boundary_2d_pair const &boundary, tridiagonal_batch &batch, double time,
+                                      container_t const &space_args)
+{
+    container_t solution(discretization_size_);
+    for (std::size_t s = 0; s < batch.systems_count(); ++s)
+    {
+        load_system(batch, s);
+        kernel(boundary, solution, factorization_, time, space_args[s]);
+        batch.solution(s).copy_from(solution);
+    }
+}
+
+void tridiagonal_solver::batch_kernel(boundary_3d_pair const &boundary, tridiagonal_batch &batch, double time,
+                                      container_t const &space_1_args, container_t const &space_2_args)
+{
+    container_t solution(discretization_size_);
+    for (std::size_t s = 0; s < batch.systems_count(); ++s)
+    {
+        load_system(batch, s);
+        kernel(boundary, solution, factorization_, time, space_1_args[s], space_2_args[s]);
+        batch.solution(s).copy_from(solution);
+    }
+}
+
 } // namespace lss_tridiagonal_solver
@@ -2,20 +2,44 @@
 #if !defined(_LSS_TRIDIAGONAL_SOLVER_HPP_)
 #define _LSS_TRIDIAGONAL_SOLVER_HPP_
 
+#include <vector>
+
 #include "../../boundaries/lss_boundary.hpp"
 #include "../../common/lss_enumerations.hpp"
+#include "../../common/lss_solver_stats.hpp"
 #include "../../common/lss_utility.hpp"
+#include "lss_tridiagonal_batch.hpp"
 
 namespace lss_tridiagonal_solver
 {
 
 using lss_boundary::boundary_1d_pair;
+using lss_boundary::boundary_1d_pairs;
 using lss_boundary::boundary_2d_pair;
 using lss_boundary::boundary_3d_pair;
 using lss_enumerations::factorization_enum;
 using lss_utility::container_t;
+using lss_utility::solver_stats_ptr;
 using lss_utility::sptr_t;
 
+/**
+    @brief  Boundary pair of given system in batch, either shared by all systems or one per system
+    @param  boundary - boundary pair or vector of boundary pairs
+    @param  system_idx - index of system
+    @retval boundary pair of the system
+**/
+template <typename boundary_pair>
+inline boundary_pair const &system_boundary(boundary_pair const &boundary, std::size_t system_idx)
+{
+    return boundary;
+}
+
+template <typename boundary_pair>
+inline boundary_pair const &system_boundary(std::vector<boundary_pair> const &boundaries, std::size_t system_idx)
+{
+    return boundaries[system_idx];
+}
+
 class tridiagonal_solver
 {
   protected:
@@ -23,6 +47,9 @@ class tridiagonal_solver
     container_t a_, b_, c_, f_;
     std::size_t discretization_size_;
     factorization_enum factorization_;
+    // bumped whenever the diagonals change so that solvers may reuse their factorization:
+    std::size_t diagonals_version_;
+    solver_stats_ptr stats_;
 
     virtual void kernel(boundary_1d_pair const &boundary, container_t &solution, factorization_enum factorization,
                         double time) = 0;
@@ -33,6 +60,22 @@ class tridiagonal_solver
     virtual void kernel(boundary_3d_pair const &boundary, container_t &solution, factorization_enum factorization,
                         double time, double space_1_arg, double space_2_arg) = 0;
 
+    // batched kernels solve the systems one by one unless overridden:
+    virtual void batch_kernel(boundary_1d_pair const &boundary, tridiagonal_batch &batch, double time);
+
+    virtual void batch_kernel(boundary_1d_pairs const &boundaries, tridiagonal_batch &batch, double time);
+
+    virtual void batch_kernel(boundary_2d_pair const &boundary, tridiagonal_batch &batch, double time,
+                              container_t const &space_args);
+
+    virtual void batch_kernel(boundary_3d_pair const &boundary, tridiagonal_batch &batch, double time,
+                              container_t const &space_1_args, container_t const &space_2_args);
+
+    void load_system(tridiagonal_batch &batch, std::size_t system_idx);
+
+    // iterative solvers start from the previous solution of the batch system, direct solvers ignore it:
+    virtual void load_guess(tridiagonal_batch const &batch, std::size_t system_idx);
+
     tridiagonal_solver() = delete;
 
   public:
@@ -47,6 +90,12 @@ class tridiagonal_solver
 
     void set_omega(double value);
 
+    /**
+        @brief  Records solve times and counts into the statistics
+        @param  stats - solver statistics, null stops the recording
+    **/
+    void set_stats(solver_stats_ptr const &stats);
+
     void solve(boundary_1d_pair const &boundary, container_t &solution);
 
     void solve(boundary_1d_pair const &boundary, container_t &solution, double at_time);
@@ -55,6 +104,43 @@ class tridiagonal_solver
 
     void solve(boundary_3d_pair const &boundary, container_t &solution, double at_time, double space_1_arg,
                double space_2_arg);
+
+    /**
+        @brief  Solves all systems of the batch in one call
+        @param  boundary - boundary pair shared by all systems
+        @param  batch - systems of size discretization_size, solutions are written into the batch
+        @param  at_time - time at which the boundary is evaluated
+    **/
+    void solve(boundary_1d_pair const &boundary, tridiagonal_batch &batch, double at_time);
+
+    /**
+        @brief  Solves all systems of the batch in one call
+        @param  boundaries - boundary pair of each system, boundary types must be the same for all systems
+        @param  batch - systems of size discretization_size, solutions are written into the batch
+        @param  at_time - time at which the boundaries are evaluated
+    **/
+    void solve(boundary_1d_pairs const &boundaries, tridiagonal_batch &batch, double at_time);
+
+    /**
+        @brief  Solves all systems of the batch in one call
+        @param  boundary - boundary pair shared by all systems
+        @param  batch - systems of size discretization_size, solutions are written into the batch
+        @param  at_time - time at which the boundary is evaluated
+        @param  space_args - space argument of the boundary for each system
+    **/
+    void solve(boundary_2d_pair const &boundary, tridiagonal_batch &batch, double at_time,
+               container_t const &space_args);
+
+    /**
+        @brief  Solves all systems of the batch in one call
+        @param  boundary - boundary pair shared by all systems
+        @param  batch - systems of size discretization_size, solutions are written into the batch
+        @param  at_time - time at which the boundary is evaluated
+        @param  space_1_args - first space argument of the boundary for each system
+        @param  space_2_args - second space argument of the boundary for each system
+    **/
+    void solve(boundary_3d_pair const &boundary, tridiagonal_batch &batch, double at_time,
+               container_t const &space_1_args, container_t const &space_2_args);
 };
 
 using tridiagonal_solver_ptr = sptr_t<tridiagonal_solver>;
@@ -8,6 +8,7 @@
 namespace lss_sor_solver
 {
 
+using lss_boundary::boundary_cast;
 using lss_boundary::dirichlet_boundary_1d;
 using lss_boundary::dirichlet_boundary_2d;
 using lss_boundary::dirichlet_boundary_3d;
@@ -107,7 +108,7 @@ void sor_boundary::initialise(boundary_1d_pair const &boundary, double time)
     const auto f_1 = std::get<3>(lower_quad_);
     const double two = static_cast<double>(2.0);
     auto const &first_bnd = boundary.first;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(first_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(first_bnd))
     {
         const auto cst_val = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         start_index_ = 1;
@@ -115,7 +116,7 @@ void sor_boundary::initialise(boundary_1d_pair const &boundary, double time)
         c_init_ = c_1;
         f_init_ = f_1 - a_1 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const auto cst_val = two * space_step_ * (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         start_index_ = 0;
@@ -123,7 +124,7 @@ void sor_boundary::initialise(boundary_1d_pair const &boundary, double time)
         c_init_ = a_0 + c_0;
         f_init_ = f_0 - a_0 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const auto lin_val =
             two * space_step_ * (ptr->is_time_dependent() ? ptr->linear_value(time) : ptr->linear_value());
@@ -151,7 +152,7 @@ void sor_boundary::initialise(boundary_2d_pair const &boundary, double time, dou
     const auto f_1 = std::get<3>(lower_quad_);
     const double two = static_cast<double>(2.0);
     auto const &first_bnd = boundary.first;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(first_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(first_bnd))
     {
         const auto cst_val = ptr->value(time, space_arg);
         start_index_ = 1;
@@ -159,7 +160,7 @@ void sor_boundary::initialise(boundary_2d_pair const &boundary, double time, dou
         c_init_ = c_1;
         f_init_ = f_1 - a_1 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_2d>(first_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_2d>(first_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_arg);
         start_index_ = 0;
@@ -167,7 +168,7 @@ void sor_boundary::initialise(boundary_2d_pair const &boundary, double time, dou
         c_init_ = a_0 + c_0;
         f_init_ = f_0 - a_0 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_2d>(first_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_2d>(first_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_arg);
         const auto cst_val = two * space_step_ * ptr->value(time, space_arg);
@@ -194,7 +195,7 @@ void sor_boundary::initialise(boundary_3d_pair const &boundary, double time, dou
     const auto f_1 = std::get<3>(lower_quad_);
     const double two = static_cast<double>(2.0);
     auto const &first_bnd = boundary.first;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(first_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(first_bnd))
     {
         const auto cst_val = ptr->value(time, space_1_arg, space_2_arg);
         start_index_ = 1;
@@ -202,7 +203,7 @@ void sor_boundary::initialise(boundary_3d_pair const &boundary, double time, dou
         c_init_ = c_1;
         f_init_ = f_1 - a_1 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(first_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_3d>(first_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
         start_index_ = 0;
@@ -210,7 +211,7 @@ void sor_boundary::initialise(boundary_3d_pair const &boundary, double time, dou
         c_init_ = a_0 + c_0;
         f_init_ = f_0 - a_0 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_3d>(first_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_3d>(first_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_1_arg, space_2_arg);
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
@@ -237,7 +238,7 @@ void sor_boundary::finalise(boundary_1d_pair const &boundary, double time)
     const auto f_end = std::get<3>(highest_quad_);
     const double two = static_cast<double>(2.0);
     auto const &second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(second_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(second_bnd))
     {
         const auto cst_val = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         end_index_ = discretization_size_ - 2;
@@ -245,7 +246,7 @@ void sor_boundary::finalise(boundary_1d_pair const &boundary, double time)
         b_end_ = b;
         f_end_ = f - c * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const auto cst_val = two * space_step_ * (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         end_index_ = discretization_size_ - 1;
@@ -253,7 +254,7 @@ void sor_boundary::finalise(boundary_1d_pair const &boundary, double time)
         b_end_ = b_end;
         f_end_ = f_end + c_end * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const auto lin_val =
             two * space_step_ * (ptr->is_time_dependent() ? ptr->linear_value(time) : ptr->linear_value());
@@ -281,7 +282,7 @@ void sor_boundary::finalise(boundary_2d_pair const &boundary, double time, doubl
     const auto f_end = std::get<3>(highest_quad_);
     const double two = static_cast<double>(2.0);
     auto const &second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(second_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(second_bnd))
     {
         const auto cst_val = ptr->value(time, space_arg);
         end_index_ = discretization_size_ - 2;
@@ -289,7 +290,7 @@ void sor_boundary::finalise(boundary_2d_pair const &boundary, double time, doubl
         b_end_ = b;
         f_end_ = f - c * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_2d>(second_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_2d>(second_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_arg);
         end_index_ = discretization_size_ - 1;
@@ -297,7 +298,7 @@ void sor_boundary::finalise(boundary_2d_pair const &boundary, double time, doubl
         b_end_ = b_end;
         f_end_ = f_end + c_end * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_2d>(second_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_2d>(second_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_arg);
         const auto cst_val = two * space_step_ * ptr->value(time, space_arg);
@@ -324,7 +325,7 @@ void sor_boundary::finalise(boundary_3d_pair const &boundary, double time, doubl
     const auto f_end = std::get<3>(highest_quad_);
     const double two = static_cast<double>(2.0);
     auto const &second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(second_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(second_bnd))
     {
         const auto cst_val = ptr->value(time, space_1_arg, space_2_arg);
         end_index_ = discretization_size_ - 2;
@@ -332,7 +333,7 @@ void sor_boundary::finalise(boundary_3d_pair const &boundary, double time, doubl
         b_end_ = b;
         f_end_ = f - c * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(second_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_3d>(second_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
         end_index_ = discretization_size_ - 1;
@@ -340,7 +341,7 @@ void sor_boundary::finalise(boundary_3d_pair const &boundary, double time, doubl
         b_end_ = b_end;
         f_end_ = f_end + c_end * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_3d>(second_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_3d>(second_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_1_arg, space_2_arg);
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
@@ -358,7 +359,7 @@ void sor_boundary::finalise(boundary_3d_pair const &boundary, double time, doubl
 const double sor_boundary::upper_boundary(boundary_1d_pair const &boundary, double time)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(boundary.second))
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(boundary.second))
     {
         ret = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
     }
@@ -369,7 +370,7 @@ const double sor_boundary::upper_boundary(boundary_1d_pair const &boundary, doub
 const double sor_boundary::upper_boundary(boundary_2d_pair const &boundary, double time, double space_arg)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(boundary.second))
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(boundary.second))
     {
         ret = ptr->value(time, space_arg);
     }
@@ -381,7 +382,7 @@ const double sor_boundary::upper_boundary(boundary_3d_pair const &boundary, doub
                                           double space_2_arg)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(boundary.second))
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(boundary.second))
     {
         ret = ptr->value(time, space_1_arg, space_2_arg);
     }
@@ -392,7 +393,7 @@ const double sor_boundary::upper_boundary(boundary_3d_pair const &boundary, doub
 const double sor_boundary::lower_boundary(boundary_1d_pair const &boundary, double time)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(boundary.first))
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(boundary.first))
     {
         ret = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
     }
@@ -402,7 +403,7 @@ const double sor_boundary::lower_boundary(boundary_1d_pair const &boundary, doub
 const double sor_boundary::lower_boundary(boundary_2d_pair const &boundary, double time, double space_arg)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(boundary.first))
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(boundary.first))
     {
         ret = ptr->value(time, space_arg);
     }
@@ -413,7 +414,7 @@ const double sor_boundary::lower_boundary(boundary_3d_pair const &boundary, doub
                                           double space_2_arg)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(boundary.first))
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(boundary.first))
     {
         ret = ptr->value(time, space_1_arg, space_2_arg);
     }
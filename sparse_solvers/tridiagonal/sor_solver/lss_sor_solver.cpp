@@ -1,19 +1,20 @@
 #include "lss_sor_solver.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 #include "../../../common/lss_macros.hpp"
-#include "../../../containers/lss_flat_matrix.hpp"
-#include "../../../sparse_solvers/general/core_sor_solver/lss_core_sor_solver.hpp"
 #include "../../../sparse_solvers/general/sor_solver_traits/lss_sor_solver_traits.hpp"
 
 namespace lss_sor_solver
 {
 
-using lss_core_sor_solver::core_sor_solver;
-using lss_core_sor_solver::flat_matrix;
 using lss_sor_solver_traits::sor_solver_traits;
 
 sor_solver::sor_solver(std::size_t discretization_size)
-    : lss_tridiagonal_solver::tridiagonal_solver(discretization_size, factorization_enum::None)
+    : lss_tridiagonal_solver::tridiagonal_solver(discretization_size, factorization_enum::None),
+      sweep_{sor_solver_traits<double>::sweep()}, has_guess_{false}, rows_version_{}, rows_start_idx_{},
+      red_size_{}, iterations_{}, interior_radius_{}, jacobi_radius_{}
 {
     initialize();
 }
@@ -29,6 +30,182 @@ void sor_solver::initialize()
     sor_boundary_ = std::make_shared<sor_boundary>(discretization_size_, step);
 }
 
+void sor_solver::set_sweep(sor_sweep_enum sweep)
+{
+    sweep_ = sweep;
+    // rows and iterates are stored in sweep order, so they are rebuilt on the next solve:
+    rows_version_ = 0;
+    x_.clear();
+}
+
+std::size_t sor_solver::iterations() const
+{
+    return iterations_;
+}
+
+void sor_solver::load_guess(lss_tridiagonal_solver::tridiagonal_batch const &batch, std::size_t system_idx)
+{
+    guess_.resize(discretization_size_);
+    batch.solution(system_idx).copy_to(guess_);
+    has_guess_ = true;
+}
+
+void sor_solver::assemble(triplet_t const &init_coeffs, triplet_t const &fin_coeffs, std::size_t start_idx,
+                          std::size_t end_idx)
+{
+    const std::size_t system_size = end_idx - start_idx + 1;
+    const std::size_t last = system_size - 1;
+    red_size_ = (system_size + 1) / 2;
+    if ((rows_version_ != diagonals_version_) || (rows_start_idx_ != start_idx) || (diag_.size() != system_size))
+    {
+        low_.resize(system_size);
+        diag_.resize(system_size);
+        high_.resize(system_size);
+        rhs_.resize(system_size);
+        interior_radius_ = double{};
+        for (std::size_t t = 1; t < last; ++t)
+        {
+            const std::size_t idx = row_index(t);
+            low_[idx] = a_[t + start_idx];
+            diag_[idx] = b_[t + start_idx];
+            high_[idx] = c_[t + start_idx];
+            LSS_ASSERT(is_diagonally_dominant(idx) == true, "Tridiagonal matrix must be diagonally dominant.");
+            interior_radius_ = std::max(interior_radius_, row_radius(idx));
+        }
+        rows_version_ = diagonals_version_;
+        rows_start_idx_ = start_idx;
+    }
+    // first and last rows carry the boundary and are refreshed on every solve:
+    const std::size_t last_idx = row_index(last);
+    low_[0] = double{};
+    diag_[0] = std::get<0>(init_coeffs);
+    high_[0] = std::get<1>(init_coeffs);
+    rhs_[0] = std::get<2>(init_coeffs);
+    low_[last_idx] = std::get<0>(fin_coeffs);
+    diag_[last_idx] = std::get<1>(fin_coeffs);
+    high_[last_idx] = double{};
+    rhs_[last_idx] = std::get<2>(fin_coeffs);
+    LSS_ASSERT(is_diagonally_dominant(0) && is_diagonally_dominant(last_idx),
+               "Tridiagonal matrix must be diagonally dominant.");
+    jacobi_radius_ = std::max(interior_radius_, std::max(row_radius(0), row_radius(last_idx)));
+    for (std::size_t t = 1; t < last; ++t)
+    {
+        rhs_[row_index(t)] = f_[t + start_idx];
+    }
+    // previous solution is kept as the initial guess unless the system size changed,
+    // trailing zero entry lets the red-black sweep read past the last row:
+    if (x_.size() != system_size + 1)
+    {
+        x_.assign(system_size + 1, double{});
+        x_new_.assign(system_size + 1, double{});
+    }
+    if (has_guess_)
+    {
+        for (std::size_t t = 0; t <= last; ++t)
+        {
+            x_[row_index(t)] = guess_[t + start_idx];
+        }
+        x_[system_size] = double{};
+        has_guess_ = false;
+    }
+}
+
+bool sor_solver::is_diagonally_dominant(std::size_t row_idx) const
+{
+    return (std::abs(diag_[row_idx]) >= (std::abs(low_[row_idx]) + std::abs(high_[row_idx])));
+}
+
+double sor_solver::row_radius(std::size_t row_idx) const
+{
+    return ((std::abs(low_[row_idx]) + std::abs(high_[row_idx])) / std::abs(diag_[row_idx]));
+}
+
+void sor_solver::iterate()
+{
+    iterations_ = (sweep_ == sor_sweep_enum::Natural) ? sweep_natural() : sweep_red_black();
+    LSS_STATS_ADD(stats_, add_sor_iterations, iterations_);
+}
+
+std::size_t sor_solver::sweep_natural()
+{
+    LSS_ASSERT((omega_ > static_cast<double>(0.0)) && (omega_ < static_cast<double>(2.0)),
+               "relaxation parameter must be inside (0,2) range");
+    const std::size_t iter_limit = sor_solver_traits<double>::iteration_limit();
+    const double tol = sor_solver_traits<double>::tolerance();
+    const double one = static_cast<double>(1.0);
+    const std::size_t last = diag_.size() - 1;
+    double sigma_1{};
+    double sigma_2{};
+    double error{};
+    for (std::size_t step = 0; step < iter_limit; ++step)
+    {
+        error = static_cast<double>(0.0);
+        for (std::size_t r = 0; r <= last; ++r)
+        {
+            sigma_1 = (r > 0) ? low_[r] * x_new_[r - 1] : double{};
+            sigma_2 = (r < last) ? high_[r] * x_[r + 1] : double{};
+            x_new_[r] = (one - omega_) * x_[r] + ((omega_ / diag_[r]) * (rhs_[r] - sigma_1 - sigma_2));
+            error += (x_new_[r] - x_[r]) * (x_new_[r] - x_[r]);
+        }
+        std::swap(x_, x_new_);
+        if (error <= tol)
+            return (step + 1);
+    }
+    return iter_limit;
+}
+
+std::size_t sor_solver::sweep_red_black()
+{
+    const std::size_t iter_limit = sor_solver_traits<double>::iteration_limit();
+    const double tol = sor_solver_traits<double>::tolerance();
+    const double one = static_cast<double>(1.0);
+    const double quarter = static_cast<double>(0.25);
+    const double half = static_cast<double>(0.5);
+    // Chebyshev acceleration needs the Jacobi spectral radius strictly below one:
+    const bool is_chebyshev = (sweep_ == sor_sweep_enum::ChebyshevRedBlack) && (jacobi_radius_ < one);
+    const double rho_sqr = jacobi_radius_ * jacobi_radius_;
+    double omega = is_chebyshev ? one : omega_;
+    LSS_ASSERT((omega > static_cast<double>(0.0)) && (omega < static_cast<double>(2.0)),
+               "relaxation parameter must be inside (0,2) range");
+
+    // red rows (even) are stored first, black rows (odd) follow, so every colour only reads the other one.
+    // Neighbours missing at the ends are multiplied by zero band entries:
+    const std::size_t red_size = red_size_;
+    const std::size_t black_size = diag_.size() - red_size;
+    double *const x = x_.data();
+    double const *const low = low_.data();
+    double const *const diag = diag_.data();
+    double const *const high = high_.data();
+    double const *const rhs = rhs_.data();
+    double x_old{};
+    double error{};
+    for (std::size_t step = 0; step < iter_limit; ++step)
+    {
+        error = static_cast<double>(0.0);
+        for (std::size_t k = 0; k < red_size; ++k)
+        {
+            x_old = x[k];
+            x[k] = (one - omega) * x_old +
+                   ((omega / diag[k]) * (rhs[k] - low[k] * x[red_size + k - 1] - high[k] * x[red_size + k]));
+            error += (x[k] - x_old) * (x[k] - x_old);
+        }
+        if (is_chebyshev)
+            omega = (step == 0) ? (one / (one - half * rho_sqr)) : (one / (one - quarter * rho_sqr * omega));
+        for (std::size_t k = 0, idx = red_size; k < black_size; ++k, ++idx)
+        {
+            x_old = x[idx];
+            x[idx] =
+                (one - omega) * x_old + ((omega / diag[idx]) * (rhs[idx] - low[idx] * x[k] - high[idx] * x[k + 1]));
+            error += (x[idx] - x_old) * (x[idx] - x_old);
+        }
+        if (is_chebyshev)
+            omega = one / (one - quarter * rho_sqr * omega);
+        if (error <= tol)
+            return (step + 1);
+    }
+    return iter_limit;
+}
+
 void sor_solver::kernel(boundary_1d_pair const &boundary, container_t &solution, factorization_enum factorization,
                         double time)
 {
@@ -48,32 +225,13 @@ void sor_solver::kernel(boundary_1d_pair const &boundary, container_t &solution,
     const auto &fin_coeffs = sor_boundary_->final_coefficients(boundary, time);
     const std::size_t end_idx = sor_boundary_->end_index();
 
-    const std::size_t system_size = end_idx - start_idx + 1;
-    flat_matrix mat(system_size, system_size);
-    container_t rhs(system_size, double{});
-    rhs[0] = std::get<2>(init_coeffs);
-    mat.emplace_back(0, 0, std::get<0>(init_coeffs));
-    mat.emplace_back(0, 1, std::get<1>(init_coeffs));
-    for (std::size_t t = 1; t < system_size - 1; ++t)
+    assemble(init_coeffs, fin_coeffs, start_idx, end_idx);
+    iterate();
+
+    for (std::size_t t = start_idx; t <= end_idx; ++t)
     {
-        mat.emplace_back(t, t - 1, a_[t + start_idx]);
-        mat.emplace_back(t, t, b_[t + start_idx]);
-        mat.emplace_back(t, t + 1, c_[t + start_idx]);
-        rhs[t] = f_[t + start_idx];
+        solution[t] = x_[row_index(t - start_idx)];
     }
-    mat.emplace_back(system_size - 1, system_size - 2, std::get<0>(fin_coeffs));
-    mat.emplace_back(system_size - 1, system_size - 1, std::get<1>(fin_coeffs));
-    rhs[system_size - 1] = std::get<2>(fin_coeffs);
-
-    // initialise the solver:
-    core_sor_solver sor(system_size);
-    sor.set_flat_sparse_matrix(std::move(mat));
-    sor.set_rhs(rhs);
-    sor.set_omega(omega_);
-    container_t sub_solution(system_size, double{});
-    sor.solve(sub_solution);
-
-    std::copy(sub_solution.begin(), sub_solution.end(), std::next(solution.begin(), start_idx));
     // fill in the boundary values:
     if (start_idx == 1)
         solution[0] = sor_boundary_->lower_boundary(boundary, time);
@@ -100,32 +258,13 @@ void sor_solver::kernel(boundary_2d_pair const &boundary, container_t &solution,
     const auto &fin_coeffs = sor_boundary_->final_coefficients(boundary, time, space_arg);
     const std::size_t end_idx = sor_boundary_->end_index();
 
-    const std::size_t system_size = end_idx - start_idx + 1;
-    flat_matrix mat(system_size, system_size);
-    container_t rhs(system_size, double{});
-    rhs[0] = std::get<2>(init_coeffs);
-    mat.emplace_back(0, 0, std::get<0>(init_coeffs));
-    mat.emplace_back(0, 1, std::get<1>(init_coeffs));
-    for (std::size_t t = 1; t < system_size - 1; ++t)
+    assemble(init_coeffs, fin_coeffs, start_idx, end_idx);
+    iterate();
+
+    for (std::size_t t = start_idx; t <= end_idx; ++t)
     {
-        mat.emplace_back(t, t - 1, a_[t + start_idx]);
-        mat.emplace_back(t, t, b_[t + start_idx]);
-        mat.emplace_back(t, t + 1, c_[t + start_idx]);
-        rhs[t] = f_[t + start_idx];
+        solution[t] = x_[row_index(t - start_idx)];
     }
-    mat.emplace_back(system_size - 1, system_size - 2, std::get<0>(fin_coeffs));
-    mat.emplace_back(system_size - 1, system_size - 1, std::get<1>(fin_coeffs));
-    rhs[system_size - 1] = std::get<2>(fin_coeffs);
-
-    // initialise the solver:
-    core_sor_solver sor(system_size);
-    sor.set_flat_sparse_matrix(std::move(mat));
-    sor.set_rhs(rhs);
-    sor.set_omega(omega_);
-    container_t sub_solution(system_size, double{});
-    sor.solve(sub_solution);
-
-    std::copy(sub_solution.begin(), sub_solution.end(), std::next(solution.begin(), start_idx));
     // fill in the boundary values:
     if (start_idx == 1)
         solution[0] = sor_boundary_->lower_boundary(boundary, time, space_arg);
@@ -152,32 +291,13 @@ void sor_solver::kernel(boundary_3d_pair const &boundary, container_t &solution,
     const auto &fin_coeffs = sor_boundary_->final_coefficients(boundary, time, space_1_arg, space_2_arg);
     const std::size_t end_idx = sor_boundary_->end_index();
 
-    const std::size_t system_size = end_idx - start_idx + 1;
-    flat_matrix mat(system_size, system_size);
-    container_t rhs(system_size, double{});
-    rhs[0] = std::get<2>(init_coeffs);
-    mat.emplace_back(0, 0, std::get<0>(init_coeffs));
-    mat.emplace_back(0, 1, std::get<1>(init_coeffs));
-    for (std::size_t t = 1; t < system_size - 1; ++t)
+    assemble(init_coeffs, fin_coeffs, start_idx, end_idx);
+    iterate();
+
+    for (std::size_t t = start_idx; t <= end_idx; ++t)
     {
-        mat.emplace_back(t, t - 1, a_[t + start_idx]);
-        mat.emplace_back(t, t, b_[t + start_idx]);
-        mat.emplace_back(t, t + 1, c_[t + start_idx]);
-        rhs[t] = f_[t + start_idx];
+        solution[t] = x_[row_index(t - start_idx)];
     }
-    mat.emplace_back(system_size - 1, system_size - 2, std::get<0>(fin_coeffs));
-    mat.emplace_back(system_size - 1, system_size - 1, std::get<1>(fin_coeffs));
-    rhs[system_size - 1] = std::get<2>(fin_coeffs);
-
-    // initialise the solver:
-    core_sor_solver sor(system_size);
-    sor.set_flat_sparse_matrix(std::move(mat));
-    sor.set_rhs(rhs);
-    sor.set_omega(omega_);
-    container_t sub_solution(system_size, double{});
-    sor.solve(sub_solution);
-
-    std::copy(sub_solution.begin(), sub_solution.end(), std::next(solution.begin(), start_idx));
     // fill in the boundary values:
     if (start_idx == 1)
         solution[0] = sor_boundary_->lower_boundary(boundary, time, space_1_arg, space_2_arg);
@@ -14,12 +14,30 @@ using lss_boundary::boundary_1d_pair;
 using lss_boundary::boundary_2d_pair;
 using lss_boundary::boundary_3d_pair;
 using lss_enumerations::factorization_enum;
+using lss_enumerations::sor_sweep_enum;
 using lss_utility::container_t;
 using lss_utility::sptr_t;
 
 class sor_solver : public lss_tridiagonal_solver::tridiagonal_solver
 {
   private:
+    sor_sweep_enum sweep_;
+    // banded system kept between solves in sweep order, interior rows are refreshed only when the diagonals change:
+    container_t low_, diag_, high_, rhs_;
+    // current and next iterate in sweep order, the last solution warm-starts the next solve:
+    container_t x_, x_new_;
+    // previous solution of the batch system being solved, it warm-starts the solve instead of the last solution
+    // so that the result does not depend on which systems the solver solved before:
+    container_t guess_;
+    bool has_guess_;
+    // diagonals version and start index the interior rows were assembled from (version 0 means none):
+    std::size_t rows_version_, rows_start_idx_;
+    // number of red rows in red-black order:
+    std::size_t red_size_;
+    // number of iterations taken by the last solve:
+    std::size_t iterations_;
+    // Gershgorin bounds of the Jacobi spectral radius over interior rows and over the whole system:
+    double interior_radius_, jacobi_radius_;
     sor_boundary_ptr sor_boundary_;
 
     void kernel(boundary_1d_pair const &boundary, container_t &solution, factorization_enum factorization,
@@ -31,6 +49,29 @@ class sor_solver : public lss_tridiagonal_solver::tridiagonal_solver
     void kernel(boundary_3d_pair const &boundary, container_t &solution, factorization_enum factorization, double time,
                 double space_1_arg, double space_2_arg) override;
 
+    void load_guess(lss_tridiagonal_solver::tridiagonal_batch const &batch, std::size_t system_idx) override;
+
+    void assemble(triplet_t const &init_coeffs, triplet_t const &fin_coeffs, std::size_t start_idx,
+                  std::size_t end_idx);
+
+    inline std::size_t row_index(std::size_t t) const
+    {
+        if (sweep_ == sor_sweep_enum::Natural)
+            return t;
+        return ((t % 2 == 0) ? (t / 2) : (red_size_ + t / 2));
+    }
+
+    bool is_diagonally_dominant(std::size_t row_idx) const;
+
+    double row_radius(std::size_t row_idx) const;
+
+    void iterate();
+
+    // both sweeps return the number of iterations taken:
+    std::size_t sweep_natural();
+
+    std::size_t sweep_red_black();
+
     void initialize();
 
     explicit sor_solver() = delete;
@@ -40,6 +81,17 @@ class sor_solver : public lss_tridiagonal_solver::tridiagonal_solver
 
     ~sor_solver();
 
+    /**
+        @brief  Selects ordering of the SOR sweep
+        @param  sweep - natural, red-black or red-black with Chebyshev acceleration of omega
+    **/
+    void set_sweep(sor_sweep_enum sweep);
+
+    /**
+        @brief  Number of iterations taken by the last solve
+    **/
+    std::size_t iterations() const;
+
     sor_solver(sor_solver const &) = delete;
     sor_solver(sor_solver &&) = delete;
     sor_solver &operator=(sor_solver const &) = delete;
@@ -7,6 +7,7 @@
 namespace lss_sor_solver_cuda
 {
 
+using lss_boundary::boundary_cast;
 using lss_boundary::dirichlet_boundary_1d;
 using lss_boundary::dirichlet_boundary_2d;
 using lss_boundary::dirichlet_boundary_3d;
@@ -107,7 +108,7 @@ void sor_cuda_boundary::initialise(boundary_1d_pair const &boundary, double time
     const double two = static_cast<double>(2.0);
 
     auto const &first_bnd = boundary.first;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(first_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(first_bnd))
     {
         const auto cst_val = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         start_index_ = 1;
@@ -115,7 +116,7 @@ void sor_cuda_boundary::initialise(boundary_1d_pair const &boundary, double time
         c_init_ = c_1;
         f_init_ = f_1 - a_1 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const auto cst_val = two * space_step_ * (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         start_index_ = 0;
@@ -123,7 +124,7 @@ void sor_cuda_boundary::initialise(boundary_1d_pair const &boundary, double time
         c_init_ = a_0 + c_0;
         f_init_ = f_0 - a_0 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const auto lin_val =
             two * space_step_ * (ptr->is_time_dependent() ? ptr->linear_value(time) : ptr->linear_value());
@@ -152,7 +153,7 @@ void sor_cuda_boundary::initialise(boundary_2d_pair const &boundary, double time
     const double two = static_cast<double>(2.0);
 
     auto const &first_bnd = boundary.first;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(first_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(first_bnd))
     {
         const auto cst_val = ptr->value(time, space_arg);
         start_index_ = 1;
@@ -160,7 +161,7 @@ void sor_cuda_boundary::initialise(boundary_2d_pair const &boundary, double time
         c_init_ = c_1;
         f_init_ = f_1 - a_1 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_2d>(first_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_2d>(first_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_arg);
         start_index_ = 0;
@@ -168,7 +169,7 @@ void sor_cuda_boundary::initialise(boundary_2d_pair const &boundary, double time
         c_init_ = a_0 + c_0;
         f_init_ = f_0 - a_0 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_2d>(first_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_2d>(first_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_arg);
         const auto cst_val = two * space_step_ * ptr->value(time, space_arg);
@@ -197,7 +198,7 @@ void sor_cuda_boundary::initialise(boundary_3d_pair const &boundary, double time
     const double two = static_cast<double>(2.0);
 
     auto const &first_bnd = boundary.first;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(first_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(first_bnd))
     {
         const auto cst_val = ptr->value(time, space_1_arg, space_2_arg);
         start_index_ = 1;
@@ -205,7 +206,7 @@ void sor_cuda_boundary::initialise(boundary_3d_pair const &boundary, double time
         c_init_ = c_1;
         f_init_ = f_1 - a_1 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(first_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_3d>(first_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
         start_index_ = 0;
@@ -213,7 +214,7 @@ void sor_cuda_boundary::initialise(boundary_3d_pair const &boundary, double time
         c_init_ = a_0 + c_0;
         f_init_ = f_0 - a_0 * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_3d>(first_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_3d>(first_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_1_arg, space_2_arg);
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
@@ -241,7 +242,7 @@ void sor_cuda_boundary::finalise(boundary_1d_pair const &boundary, double time)
     const double two = static_cast<double>(2.0);
 
     auto const &second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(second_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(second_bnd))
     {
         const auto cst_val = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         end_index_ = discretization_size_ - 2;
@@ -249,7 +250,7 @@ void sor_cuda_boundary::finalise(boundary_1d_pair const &boundary, double time)
         b_end_ = b;
         f_end_ = f - c * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const auto cst_val = two * space_step_ * (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         end_index_ = discretization_size_ - 1;
@@ -257,7 +258,7 @@ void sor_cuda_boundary::finalise(boundary_1d_pair const &boundary, double time)
         b_end_ = b_end;
         f_end_ = f_end + c_end * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const auto lin_val =
             two * space_step_ * (ptr->is_time_dependent() ? ptr->linear_value(time) : ptr->linear_value());
@@ -286,7 +287,7 @@ void sor_cuda_boundary::finalise(boundary_2d_pair const &boundary, double time,
     const double two = static_cast<double>(2.0);
 
     auto const &second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(second_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(second_bnd))
     {
         const auto cst_val = ptr->value(time, space_arg);
         end_index_ = discretization_size_ - 2;
@@ -294,7 +295,7 @@ void sor_cuda_boundary::finalise(boundary_2d_pair const &boundary, double time,
         b_end_ = b;
         f_end_ = f - c * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_2d>(second_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_2d>(second_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_arg);
         end_index_ = discretization_size_ - 1;
@@ -302,7 +303,7 @@ void sor_cuda_boundary::finalise(boundary_2d_pair const &boundary, double time,
         b_end_ = b_end;
         f_end_ = f_end + c_end * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_2d>(second_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_2d>(second_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_arg);
         const auto cst_val = two * space_step_ * ptr->value(time, space_arg);
@@ -330,7 +331,7 @@ void sor_cuda_boundary::finalise(boundary_3d_pair const &boundary, double time,
     const double two = static_cast<double>(2.0);
 
     auto const &second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(second_bnd))
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(second_bnd))
     {
         const auto cst_val = ptr->value(time, space_1_arg, space_2_arg);
         end_index_ = discretization_size_ - 2;
@@ -338,7 +339,7 @@ void sor_cuda_boundary::finalise(boundary_3d_pair const &boundary, double time,
         b_end_ = b;
         f_end_ = f - c * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(second_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_3d>(second_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
         end_index_ = discretization_size_ - 1;
@@ -346,7 +347,7 @@ void sor_cuda_boundary::finalise(boundary_3d_pair const &boundary, double time,
         b_end_ = b_end;
         f_end_ = f_end + c_end * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_3d>(second_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_3d>(second_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_1_arg, space_2_arg);
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
@@ -364,7 +365,7 @@ void sor_cuda_boundary::finalise(boundary_3d_pair const &boundary, double time,
 const double sor_cuda_boundary::upper_boundary(boundary_1d_pair const &boundary, double time)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(boundary.second))
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(boundary.second))
     {
         ret = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
     }
@@ -374,7 +375,7 @@ const double sor_cuda_boundary::upper_boundary(boundary_1d_pair const &boundary,
 const double sor_cuda_boundary::upper_boundary(boundary_2d_pair const &boundary, double time, double space_arg)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(boundary.second))
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(boundary.second))
     {
         ret = ptr->value(time, space_arg);
     }
@@ -385,7 +386,7 @@ const double sor_cuda_boundary::upper_boundary(boundary_3d_pair const &boundary,
                                                double space_2_arg)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(boundary.second))
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(boundary.second))
     {
         ret = ptr->value(time, space_1_arg, space_2_arg);
     }
@@ -395,7 +396,7 @@ const double sor_cuda_boundary::upper_boundary(boundary_3d_pair const &boundary,
 const double sor_cuda_boundary::lower_boundary(boundary_1d_pair const &boundary, double time)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(boundary.first))
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(boundary.first))
     {
         ret = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
     }
@@ -405,7 +406,7 @@ const double sor_cuda_boundary::lower_boundary(boundary_1d_pair const &boundary,
 const double sor_cuda_boundary::lower_boundary(boundary_2d_pair const &boundary, double time, double space_arg)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(boundary.first))
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(boundary.first))
     {
         ret = ptr->value(time, space_arg);
     }
@@ -416,7 +417,7 @@ const double sor_cuda_boundary::lower_boundary(boundary_3d_pair const &boundary,
                                                double space_2_arg)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(boundary.first))
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(boundary.first))
     {
         ret = ptr->value(time, space_1_arg, space_2_arg);
     }
@@ -0,0 +1,280 @@
+#include "lss_spike_solver.hpp"
+
+#include "../../../common/lss_enumerations.hpp"
+#include "../../../common/lss_macros.hpp"
+
+namespace lss_spike_solver
+{
+
+using lss_thomas_lu_solver::thomas_lu_solver_boundary;
+
+spike_solver::spike_solver(std::size_t discretization_size, thread_pool_ptr const &thread_pool)
+    : lss_tridiagonal_solver::tridiagonal_solver(discretization_size, factorization_enum::None), factors_key_{},
+      thread_pool_{thread_pool}
+{
+    LSS_VERIFY(thread_pool, "thread_pool must not be null");
+    initialize();
+}
+
+spike_solver::spike_solver(std::size_t discretization_size)
+    : lss_tridiagonal_solver::tridiagonal_solver(discretization_size, factorization_enum::None), factors_key_{},
+      thread_pool_{}
+{
+    initialize();
+}
+
+spike_solver::~spike_solver()
+{
+}
+
+void spike_solver::initialize()
+{
+    const double one = static_cast<double>(1.0);
+    const double step = one / static_cast<double>(discretization_size_ - 1);
+    tlu_boundary_ = std::make_shared<thomas_lu_solver_boundary>(discretization_size_, step);
+}
+
+void spike_solver::set_boundary_quads()
+{
+    const std::size_t N = discretization_size_ - 1;
+    tlu_boundary_->set_lowest_quad(std::make_tuple(a_[0], b_[0], c_[0], f_[0]));
+    tlu_boundary_->set_lower_quad(std::make_tuple(a_[1], b_[1], c_[1], f_[1]));
+    tlu_boundary_->set_higher_quad(std::make_tuple(a_[N - 1], b_[N - 1], c_[N - 1], f_[N - 1]));
+    tlu_boundary_->set_highest_quad(std::make_tuple(a_[N], b_[N], c_[N], f_[N]));
+}
+
+void spike_solver::partition(std::size_t start_idx, std::size_t end_idx)
+{
+    // every block has at least min_block_size rows and consecutive blocks are separated by one row:
+    const std::size_t size = end_idx - start_idx + 1;
+    const std::size_t workers = thread_pool_ ? thread_pool_->size() : std::size_t(1);
+    const std::size_t blocks = std::max(std::size_t(1), std::min(workers, (size + 1) / (min_block_size + 1)));
+    const std::size_t rows = size - (blocks - 1);
+
+    first_.resize(blocks);
+    last_.resize(blocks);
+    std::size_t first = start_idx;
+    for (std::size_t k = 0; k < blocks; ++k)
+    {
+        const std::size_t block_size = (rows * (k + 1)) / blocks - (rows * k) / blocks;
+        first_[k] = first;
+        last_[k] = first + block_size - 1;
+        first = last_[k] + 2;
+    }
+}
+
+void spike_solver::factorize_block(std::size_t block_idx)
+{
+    const std::size_t first = first_[block_idx];
+    const std::size_t last = last_[block_idx];
+
+    beta_[first] = diag_[first];
+    gamma_[first] = high_[first] / beta_[first];
+    for (std::size_t t = first + 1; t <= last; ++t)
+    {
+        beta_[t] = diag_[t] - (low_[t] * gamma_[t - 1]);
+        gamma_[t] = high_[t] / beta_[t];
+    }
+
+    // left spike solves the block with low_[first] in its first row:
+    std::fill(left_spike_.begin() + first, left_spike_.begin() + last + 1, double{});
+    if (block_idx > 0)
+    {
+        left_spike_[first] = low_[first] / beta_[first];
+        for (std::size_t t = first + 1; t <= last; ++t)
+        {
+            left_spike_[t] = -(low_[t] * left_spike_[t - 1]) / beta_[t];
+        }
+        for (std::size_t t = last; t-- > first;)
+        {
+            left_spike_[t] = left_spike_[t] - (gamma_[t] * left_spike_[t + 1]);
+        }
+    }
+
+    // right spike solves the block with high_[last] in its last row:
+    std::fill(right_spike_.begin() + first, right_spike_.begin() + last + 1, double{});
+    if (block_idx + 1 < first_.size())
+    {
+        right_spike_[last] = high_[last] / beta_[last];
+        for (std::size_t t = last; t-- > first;)
+        {
+            right_spike_[t] = -(gamma_[t] * right_spike_[t + 1]);
+        }
+    }
+}
+
+void spike_solver::for_each_block(std::function<void(std::size_t)> const &block_fun)
+{
+    const std::size_t blocks = first_.size();
+    if (!thread_pool_)
+    {
+        for (std::size_t k = 0; k < blocks; ++k)
+        {
+            block_fun(k);
+        }
+        return;
+    }
+    thread_pool_->parallel_for(0, blocks, [&](std::size_t worker_idx, std::size_t k) { block_fun(k); });
+}
+
+void spike_solver::factorize(quad_t const &init_coeffs, triplet_t const &fin_coeffs, std::size_t start_idx,
+                             std::size_t end_idx)
+{
+    // factors depend only on diagonals and linear part of boundary, reuse them while these are unchanged:
+    const factors_key_t key =
+        std::make_tuple(diagonals_version_, start_idx, end_idx, std::get<0>(init_coeffs), std::get<1>(init_coeffs),
+                        std::get<0>(fin_coeffs), std::get<1>(fin_coeffs));
+    if (key == factors_key_)
+        return;
+
+    // diagonals with the first and last row reduced by the boundary:
+    low_ = a_;
+    diag_ = b_;
+    high_ = c_;
+    diag_[start_idx] = std::get<0>(init_coeffs);
+    if (start_idx == 0)
+        high_[start_idx] = a_[0] + c_[0];
+    low_[end_idx] = std::get<0>(fin_coeffs);
+    diag_[end_idx] = std::get<1>(fin_coeffs);
+
+    beta_.resize(discretization_size_);
+    gamma_.resize(discretization_size_);
+    left_spike_.resize(discretization_size_);
+    right_spike_.resize(discretization_size_);
+
+    partition(start_idx, end_idx);
+    const std::size_t blocks = first_.size();
+    for_each_block([this](std::size_t k) { factorize_block(k); });
+
+    // system for separator values, j-th separator sits between j-th and (j+1)-th block:
+    const std::size_t seps = blocks - 1;
+    sep_low_.resize(seps);
+    sep_beta_.resize(seps);
+    sep_gamma_.resize(seps);
+    sep_rhs_.resize(seps);
+    for (std::size_t j = 0; j < seps; ++j)
+    {
+        const std::size_t sep = last_[j] + 1;
+        const std::size_t l = last_[j];
+        const std::size_t r = first_[j + 1];
+        const double diag = diag_[sep] - (low_[sep] * right_spike_[l]) - (high_[sep] * left_spike_[r]);
+        const double high = -(high_[sep] * right_spike_[r]);
+        sep_low_[j] = -(low_[sep] * left_spike_[l]);
+        sep_beta_[j] = (j == 0) ? diag : diag - (sep_low_[j] * sep_gamma_[j - 1]);
+        sep_gamma_[j] = high / sep_beta_[j];
+    }
+    factors_key_ = key;
+}
+
+void spike_solver::substitute(quad_t const &init_coeffs, triplet_t const &fin_coeffs, std::size_t start_idx,
+                              std::size_t end_idx, container_t &solution)
+{
+    factorize(init_coeffs, fin_coeffs, start_idx, end_idx);
+    f_[start_idx] = std::get<2>(init_coeffs);
+    f_[end_idx] = std::get<2>(fin_coeffs);
+
+    const std::size_t blocks = first_.size();
+    double *x = solution.data();
+    // solve each block on its own:
+    for_each_block([&](std::size_t k) {
+        const std::size_t first = first_[k];
+        const std::size_t last = last_[k];
+        x[first] = f_[first] / beta_[first];
+        for (std::size_t t = first + 1; t <= last; ++t)
+        {
+            x[t] = (f_[t] - (low_[t] * x[t - 1])) / beta_[t];
+        }
+        for (std::size_t t = last; t-- > first;)
+        {
+            x[t] = x[t] - (gamma_[t] * x[t + 1]);
+        }
+    });
+    if (blocks == 1)
+        return;
+
+    // values at separators:
+    const std::size_t seps = blocks - 1;
+    for (std::size_t j = 0; j < seps; ++j)
+    {
+        const std::size_t sep = last_[j] + 1;
+        const double rhs = f_[sep] - (low_[sep] * x[last_[j]]) - (high_[sep] * x[first_[j + 1]]);
+        sep_rhs_[j] = (j == 0) ? rhs / sep_beta_[j] : (rhs - (sep_low_[j] * sep_rhs_[j - 1])) / sep_beta_[j];
+    }
+    for (std::size_t j = seps - 1; j-- > 0;)
+    {
+        sep_rhs_[j] = sep_rhs_[j] - (sep_gamma_[j] * sep_rhs_[j + 1]);
+    }
+    for (std::size_t j = 0; j < seps; ++j)
+    {
+        x[last_[j] + 1] = sep_rhs_[j];
+    }
+
+    // correct each block by its spikes:
+    for_each_block([&](std::size_t k) {
+        const double left = (k > 0) ? sep_rhs_[k - 1] : double{};
+        const double right = (k < seps) ? sep_rhs_[k] : double{};
+        for (std::size_t t = first_[k]; t <= last_[k]; ++t)
+        {
+            x[t] = x[t] - (left_spike_[t] * left) - (right_spike_[t] * right);
+        }
+    });
+}
+
+void spike_solver::kernel(boundary_1d_pair const &boundary, container_t &solution, factorization_enum factorization,
+                          double time)
+{
+    // get proper boundaries:
+    const std::size_t N = discretization_size_ - 1;
+    set_boundary_quads();
+    const auto &init_coeffs = tlu_boundary_->init_coefficients(boundary, time);
+    const std::size_t start_idx = tlu_boundary_->start_index();
+    const auto &fin_coeffs = tlu_boundary_->final_coefficients(boundary, time);
+    const std::size_t end_idx = tlu_boundary_->end_index();
+
+    substitute(init_coeffs, fin_coeffs, start_idx, end_idx, solution);
+    // fill in the boundary values:
+    if (start_idx == 1)
+        solution[0] = tlu_boundary_->lower_boundary(boundary, time);
+    if (end_idx == N - 1)
+        solution[N] = tlu_boundary_->upper_boundary(boundary, time);
+}
+
+void spike_solver::kernel(boundary_2d_pair const &boundary, container_t &solution, factorization_enum factorization,
+                          double time, double space_arg)
+{
+    // get proper boundaries:
+    const std::size_t N = discretization_size_ - 1;
+    set_boundary_quads();
+    const auto &init_coeffs = tlu_boundary_->init_coefficients(boundary, time, space_arg);
+    const std::size_t start_idx = tlu_boundary_->start_index();
+    const auto &fin_coeffs = tlu_boundary_->final_coefficients(boundary, time, space_arg);
+    const std::size_t end_idx = tlu_boundary_->end_index();
+
+    substitute(init_coeffs, fin_coeffs, start_idx, end_idx, solution);
+    // fill in the boundary values:
+    if (start_idx == 1)
+        solution[0] = tlu_boundary_->lower_boundary(boundary, time, space_arg);
+    if (end_idx == N - 1)
+        solution[N] = tlu_boundary_->upper_boundary(boundary, time, space_arg);
+}
+
+void spike_solver::kernel(boundary_3d_pair const &boundary, container_t &solution, factorization_enum factorization,
+                          double time, double space_1_arg, double space_2_arg)
+{
+    // get proper boundaries:
+    const std::size_t N = discretization_size_ - 1;
+    set_boundary_quads();
+    const auto &init_coeffs = tlu_boundary_->init_coefficients(boundary, time, space_1_arg, space_2_arg);
+    const std::size_t start_idx = tlu_boundary_->start_index();
+    const auto &fin_coeffs = tlu_boundary_->final_coefficients(boundary, time, space_1_arg, space_2_arg);
+    const std::size_t end_idx = tlu_boundary_->end_index();
+
+    substitute(init_coeffs, fin_coeffs, start_idx, end_idx, solution);
+    // fill in the boundary values:
+    if (start_idx == 1)
+        solution[0] = tlu_boundary_->lower_boundary(boundary, time, space_1_arg, space_2_arg);
+    if (end_idx == N - 1)
+        solution[N] = tlu_boundary_->upper_boundary(boundary, time, space_1_arg, space_2_arg);
+}
+
+} // namespace lss_spike_solver
@@ -0,0 +1,118 @@
+#pragma once
+#if !defined(_LSS_SPIKE_SOLVER_HPP_)
+#define _LSS_SPIKE_SOLVER_HPP_
+
+#pragma warning(disable : 4244)
+
+#include <algorithm>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "../../../boundaries/lss_boundary.hpp"
+#include "../../../common/lss_thread_pool.hpp"
+#include "../../../common/lss_utility.hpp"
+#include "../../tridiagonal/lss_tridiagonal_solver.hpp"
+#include "../thomas_lu_solver/lss_thomas_lu_boundary.hpp"
+
+namespace lss_spike_solver
+{
+
+using lss_boundary::boundary_1d_pair;
+using lss_boundary::boundary_2d_pair;
+using lss_boundary::boundary_3d_pair;
+using lss_enumerations::factorization_enum;
+using lss_thomas_lu_solver::quad_t;
+using lss_thomas_lu_solver::thomas_lu_solver_boundary_ptr;
+using lss_thomas_lu_solver::triplet_t;
+using lss_utility::container_t;
+using lss_utility::sptr_t;
+using lss_utility::thread_pool_ptr;
+
+// diagonals version, start and end index, initial beta and gamma, final alpha and beta:
+using factors_key_t = std::tuple<std::size_t, std::size_t, std::size_t, double, double, double, double>;
+
+/**
+    spike_solver object
+
+    Partitioned (SPIKE) solver for a single large tridiagonal system. Rows left
+    after the boundary reduction are split into one block per worker, blocks
+    being separated by single rows. Each block is solved independently by
+    Thomas LU together with its left and right spikes, values at the separating
+    rows then follow from a small tridiagonal system and the blocks are
+    corrected in parallel. Factors and spikes are reused while the diagonals
+    and the linear part of the boundary are unchanged.
+ */
+class spike_solver : public lss_tridiagonal_solver::tridiagonal_solver
+{
+
+  private:
+    // diagonals of the system after boundary reduction:
+    container_t low_, diag_, high_;
+    // block factors and spikes coupling each block to its left and right separator:
+    container_t beta_, gamma_, left_spike_, right_spike_;
+    // factors and right-hand side of the system for separator values:
+    container_t sep_low_, sep_beta_, sep_gamma_, sep_rhs_;
+    // first and last row of each block:
+    std::vector<std::size_t> first_, last_;
+    // identifies factorization held above (diagonals version 0 means none):
+    factors_key_t factors_key_;
+    thomas_lu_solver_boundary_ptr tlu_boundary_;
+    // pool solving the blocks concurrently (null means single block on the calling thread):
+    thread_pool_ptr thread_pool_;
+
+    void kernel(boundary_1d_pair const &boundary, container_t &solution, factorization_enum factorization,
+                double time) override;
+
+    void kernel(boundary_2d_pair const &boundary, container_t &solution, factorization_enum factorization, double time,
+                double space_arg) override;
+
+    void kernel(boundary_3d_pair const &boundary, container_t &solution, factorization_enum factorization, double time,
+                double space_1_arg, double space_2_arg) override;
+
+    void set_boundary_quads();
+
+    void partition(std::size_t start_idx, std::size_t end_idx);
+
+    void factorize(quad_t const &init_coeffs, triplet_t const &fin_coeffs, std::size_t start_idx,
+                   std::size_t end_idx);
+
+    void factorize_block(std::size_t block_idx);
+
+    void for_each_block(std::function<void(std::size_t)> const &block_fun);
+
+    void substitute(quad_t const &init_coeffs, triplet_t const &fin_coeffs, std::size_t start_idx,
+                    std::size_t end_idx, container_t &solution);
+
+    void initialize();
+
+    explicit spike_solver() = delete;
+
+  public:
+    /**
+        @brief spike_solver object constructor
+        @param discretization_size - size of the system
+        @param thread_pool - pool whose workers solve the blocks concurrently (single worker reduces to Thomas LU)
+    **/
+    explicit spike_solver(std::size_t discretization_size, thread_pool_ptr const &thread_pool);
+
+    /**
+        @brief spike_solver object constructor solving the system as single block on the calling thread
+        @param discretization_size - size of the system
+    **/
+    explicit spike_solver(std::size_t discretization_size);
+
+    ~spike_solver();
+
+    /**
+        @brief  Minimal number of rows of single block, smaller systems use fewer blocks
+    **/
+    static const std::size_t min_block_size = 1024;
+};
+
+using spike_solver_ptr = sptr_t<spike_solver>;
+
+} // namespace lss_spike_solver
+
+#endif ///_LSS_SPIKE_SOLVER_HPP_
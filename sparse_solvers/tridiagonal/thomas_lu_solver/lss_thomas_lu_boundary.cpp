@@ -8,6 +8,7 @@ namespace lss_thomas_lu_solver
 
 {
 
+using lss_boundary::boundary_cast;
 using lss_boundary::dirichlet_boundary_1d;
 using lss_boundary::dirichlet_boundary_2d;
 using lss_boundary::dirichlet_boundary_3d;
@@ -108,8 +109,8 @@ void thomas_lu_solver_boundary::initialise(boundary_1d_pair const &boundary, dou
     const auto c_1 = std::get<2>(lower_quad_);
     const auto f_1 = std::get<3>(lower_quad_);
     const double two = static_cast<double>(2.0);
-    auto const first_bnd = boundary.first;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(first_bnd))
+    auto const &first_bnd = boundary.first;
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(first_bnd))
     {
         const auto cst_val = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         start_index_ = 1;
@@ -118,7 +119,7 @@ void thomas_lu_solver_boundary::initialise(boundary_1d_pair const &boundary, dou
         r_ = f_1 - a_1 * cst_val;
         z_ = r_ / beta_;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(first_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_1d>(first_bnd))
     {
         const auto cst_val = two * space_step_ * (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         start_index_ = 0;
@@ -127,7 +128,7 @@ void thomas_lu_solver_boundary::initialise(boundary_1d_pair const &boundary, dou
         r_ = f_0 - a_0 * cst_val;
         z_ = r_ / beta_;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_1d>(first_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_1d>(first_bnd))
     {
         const auto lin_val =
             two * space_step_ * (ptr->is_time_dependent() ? ptr->linear_value(time) : ptr->linear_value());
@@ -155,8 +156,8 @@ void thomas_lu_solver_boundary::initialise(boundary_2d_pair const &boundary, dou
     const auto c_1 = std::get<2>(lower_quad_);
     const auto f_1 = std::get<3>(lower_quad_);
     const double two = static_cast<double>(2.0);
-    auto const first_bnd = boundary.first;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(first_bnd))
+    auto const &first_bnd = boundary.first;
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(first_bnd))
     {
         const auto cst_val = ptr->value(time, space_arg);
         start_index_ = 1;
@@ -165,7 +166,7 @@ void thomas_lu_solver_boundary::initialise(boundary_2d_pair const &boundary, dou
         r_ = f_1 - a_1 * cst_val;
         z_ = r_ / beta_;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_2d>(first_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_2d>(first_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_arg);
         start_index_ = 0;
@@ -174,7 +175,7 @@ void thomas_lu_solver_boundary::initialise(boundary_2d_pair const &boundary, dou
         r_ = f_0 - a_0 * cst_val;
         z_ = r_ / beta_;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_2d>(first_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_2d>(first_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_arg);
         const auto cst_val = two * space_step_ * ptr->value(time, space_arg);
@@ -202,8 +203,8 @@ void thomas_lu_solver_boundary::initialise(boundary_3d_pair const &boundary, dou
     const auto c_1 = std::get<2>(lower_quad_);
     const auto f_1 = std::get<3>(lower_quad_);
     const double two = static_cast<double>(2.0);
-    auto const first_bnd = boundary.first;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(first_bnd))
+    auto const &first_bnd = boundary.first;
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(first_bnd))
     {
         const auto cst_val = ptr->value(time, space_1_arg, space_2_arg);
         start_index_ = 1;
@@ -212,7 +213,7 @@ void thomas_lu_solver_boundary::initialise(boundary_3d_pair const &boundary, dou
         r_ = f_1 - a_1 * cst_val;
         z_ = r_ / beta_;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(first_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_3d>(first_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
         start_index_ = 0;
@@ -221,7 +222,7 @@ void thomas_lu_solver_boundary::initialise(boundary_3d_pair const &boundary, dou
         r_ = f_0 - a_0 * cst_val;
         z_ = r_ / beta_;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_3d>(first_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_3d>(first_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_1_arg, space_2_arg);
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
@@ -248,8 +249,8 @@ void thomas_lu_solver_boundary::finalise(boundary_1d_pair const &boundary, doubl
     const auto c_end = std::get<2>(highest_quad_);
     const auto f_end = std::get<3>(highest_quad_);
     const double two = static_cast<double>(2.0);
-    auto const second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(second_bnd))
+    auto const &second_bnd = boundary.second;
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(second_bnd))
     {
         const auto cst_val = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         end_index_ = discretization_size_ - 2;
@@ -257,7 +258,7 @@ void thomas_lu_solver_boundary::finalise(boundary_1d_pair const &boundary, doubl
         beta_n_ = b;
         r_n_ = f - c * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_1d>(second_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_1d>(second_bnd))
     {
         const auto cst_val = two * space_step_ * (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
         end_index_ = discretization_size_ - 1;
@@ -265,7 +266,7 @@ void thomas_lu_solver_boundary::finalise(boundary_1d_pair const &boundary, doubl
         beta_n_ = b_end;
         r_n_ = f_end + c_end * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_1d>(second_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_1d>(second_bnd))
     {
         const auto lin_val =
             two * space_step_ * (ptr->is_time_dependent() ? ptr->linear_value(time) : ptr->linear_value());
@@ -292,8 +293,8 @@ void thomas_lu_solver_boundary::finalise(boundary_2d_pair const &boundary, doubl
     const auto c_end = std::get<2>(highest_quad_);
     const auto f_end = std::get<3>(highest_quad_);
     const double two = static_cast<double>(2.0);
-    auto const second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(second_bnd))
+    auto const &second_bnd = boundary.second;
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(second_bnd))
     {
         const auto cst_val = ptr->value(time, space_arg);
         end_index_ = discretization_size_ - 2;
@@ -301,7 +302,7 @@ void thomas_lu_solver_boundary::finalise(boundary_2d_pair const &boundary, doubl
         beta_n_ = b;
         r_n_ = f - c * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_2d>(second_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_2d>(second_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_arg);
         end_index_ = discretization_size_ - 1;
@@ -309,7 +310,7 @@ void thomas_lu_solver_boundary::finalise(boundary_2d_pair const &boundary, doubl
         beta_n_ = b_end;
         r_n_ = f_end + c_end * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_2d>(second_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_2d>(second_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_arg);
         const auto cst_val = two * space_step_ * ptr->value(time, space_arg);
@@ -336,8 +337,8 @@ void thomas_lu_solver_boundary::finalise(boundary_3d_pair const &boundary, doubl
     const auto c_end = std::get<2>(highest_quad_);
     const auto f_end = std::get<3>(highest_quad_);
     const double two = static_cast<double>(2.0);
-    auto const second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(second_bnd))
+    auto const &second_bnd = boundary.second;
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(second_bnd))
     {
         const auto cst_val = ptr->value(time, space_1_arg, space_2_arg);
         end_index_ = discretization_size_ - 2;
@@ -345,7 +346,7 @@ void thomas_lu_solver_boundary::finalise(boundary_3d_pair const &boundary, doubl
         beta_n_ = b;
         r_n_ = f - c * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<neumann_boundary_3d>(second_bnd))
+    else if (auto ptr = boundary_cast<neumann_boundary_3d>(second_bnd))
     {
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
         end_index_ = discretization_size_ - 1;
@@ -353,7 +354,7 @@ void thomas_lu_solver_boundary::finalise(boundary_3d_pair const &boundary, doubl
         beta_n_ = b_end;
         r_n_ = f_end + c_end * cst_val;
     }
-    else if (auto ptr = std::dynamic_pointer_cast<robin_boundary_3d>(second_bnd))
+    else if (auto ptr = boundary_cast<robin_boundary_3d>(second_bnd))
     {
         const auto lin_val = two * space_step_ * ptr->linear_value(time, space_1_arg, space_2_arg);
         const auto cst_val = two * space_step_ * ptr->value(time, space_1_arg, space_2_arg);
@@ -371,8 +372,8 @@ void thomas_lu_solver_boundary::finalise(boundary_3d_pair const &boundary, doubl
 const double thomas_lu_solver_boundary::upper_boundary(boundary_1d_pair const &boundary, double time)
 {
     double ret{};
-    auto const second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(second_bnd))
+    auto const &second_bnd = boundary.second;
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(second_bnd))
     {
         ret = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
     }
@@ -383,8 +384,8 @@ const double thomas_lu_solver_boundary::upper_boundary(boundary_1d_pair const &b
 const double thomas_lu_solver_boundary::upper_boundary(boundary_2d_pair const &boundary, double time, double space_arg)
 {
     double ret{};
-    auto const second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(second_bnd))
+    auto const &second_bnd = boundary.second;
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(second_bnd))
     {
         ret = ptr->value(time, space_arg);
     }
@@ -396,8 +397,8 @@ const double thomas_lu_solver_boundary::upper_boundary(boundary_3d_pair const &b
                                                        double space_1_arg, double space_2_arg)
 {
     double ret{};
-    auto const second_bnd = boundary.second;
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(second_bnd))
+    auto const &second_bnd = boundary.second;
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(second_bnd))
     {
         ret = ptr->value(time, space_1_arg, space_2_arg);
     }
@@ -408,7 +409,7 @@ const double thomas_lu_solver_boundary::upper_boundary(boundary_3d_pair const &b
 const double thomas_lu_solver_boundary::lower_boundary(boundary_1d_pair const &boundary, double time)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_1d>(boundary.first))
+    if (auto ptr = boundary_cast<dirichlet_boundary_1d>(boundary.first))
     {
         ret = (ptr->is_time_dependent() ? ptr->value(time) : ptr->value());
     }
@@ -418,7 +419,7 @@ const double thomas_lu_solver_boundary::lower_boundary(boundary_1d_pair const &b
 const double thomas_lu_solver_boundary::lower_boundary(boundary_2d_pair const &boundary, double time, double space_arg)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_2d>(boundary.first))
+    if (auto ptr = boundary_cast<dirichlet_boundary_2d>(boundary.first))
     {
         ret = ptr->value(time, space_arg);
     }
@@ -429,7 +430,7 @@ const double thomas_lu_solver_boundary::lower_boundary(boundary_3d_pair const &b
                                                        double space_1_arg, double space_2_arg)
 {
     double ret{};
-    if (auto ptr = std::dynamic_pointer_cast<dirichlet_boundary_3d>(boundary.first))
+    if (auto ptr = boundary_cast<dirichlet_boundary_3d>(boundary.first))
     {
         ret = ptr->value(time, space_1_arg, space_2_arg);
     }
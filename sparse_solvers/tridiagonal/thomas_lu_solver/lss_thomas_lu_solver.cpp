@@ -7,7 +7,8 @@ namespace lss_thomas_lu_solver
 {
 
 thomas_lu_solver::thomas_lu_solver(std::size_t discretization_size)
-    : lss_tridiagonal_solver::tridiagonal_solver(discretization_size, factorization_enum::None)
+    : lss_tridiagonal_solver::tridiagonal_solver(discretization_size, factorization_enum::None), factors_key_{},
+      batch_factors_key_{}
 {
     initialize();
 }
@@ -36,49 +37,39 @@ bool lss_thomas_lu_solver::thomas_lu_solver::is_diagonally_dominant() const
     return true;
 }
 
-void lss_thomas_lu_solver::thomas_lu_solver::kernel(boundary_1d_pair const &boundary, container_t &solution,
-                                                    factorization_enum factorization, double time)
+void thomas_lu_solver::substitute(quad_t const &init_coeffs, triplet_t const &fin_coeffs, std::size_t start_idx,
+                                  std::size_t end_idx, container_t &solution)
 {
-    // check the diagonal dominance:
-    LSS_ASSERT(is_diagonally_dominant() == true, "Tridiagonal matrix must be diagonally dominant.");
-
-    // clear the working containers:
-    beta_.clear();
-    gamma_.clear();
-
-    // resize the working containers:
-    beta_.resize(discretization_size_);
-    gamma_.resize(discretization_size_);
-
-    // get proper boundaries:
-    const std::size_t N = discretization_size_ - 1;
-    const auto &lowest_quad = std::make_tuple(a_[0], b_[0], c_[0], f_[0]);
-    const auto &lower_quad = std::make_tuple(a_[1], b_[1], c_[1], f_[1]);
-    const auto &higher_quad = std::make_tuple(a_[N - 1], b_[N - 1], c_[N - 1], f_[N - 1]);
-    const auto &highest_quad = std::make_tuple(a_[N], b_[N], c_[N], f_[N]);
-    tlu_boundary_->set_lowest_quad(lowest_quad);
-    tlu_boundary_->set_lower_quad(lower_quad);
-    tlu_boundary_->set_higher_quad(higher_quad);
-    tlu_boundary_->set_highest_quad(highest_quad);
-
-    const auto &init_coeffs = tlu_boundary_->init_coefficients(boundary, time);
-    const std::size_t start_idx = tlu_boundary_->start_index();
-    const auto &fin_coeffs = tlu_boundary_->final_coefficients(boundary, time);
-    const std::size_t end_idx = tlu_boundary_->end_index();
     const double a = std::get<0>(fin_coeffs);
     const double b = std::get<1>(fin_coeffs);
     const double r = std::get<2>(fin_coeffs);
 
-    // init values for the working containers:
-    beta_[start_idx] = std::get<0>(init_coeffs);
-    gamma_[start_idx] = std::get<1>(init_coeffs);
-
-    for (std::size_t t = start_idx + 1; t < end_idx; ++t)
+    // factors depend only on diagonals and linear part of boundary, reuse them while these are unchanged:
+    const factors_key_t key = std::make_tuple(diagonals_version_, start_idx, end_idx, std::get<0>(init_coeffs),
+                                              std::get<1>(init_coeffs), a, b);
+    if (key != factors_key_)
     {
-        beta_[t] = b_[t] - (a_[t] * gamma_[t - 1]);
-        gamma_[t] = c_[t] / beta_[t];
+        // check the diagonal dominance:
+        LSS_ASSERT(is_diagonally_dominant() == true, "Tridiagonal matrix must be diagonally dominant.");
+        // resize the working containers:
+        beta_.resize(discretization_size_);
+        gamma_.resize(discretization_size_);
+
+        // init values for the working containers:
+        beta_[start_idx] = std::get<0>(init_coeffs);
+        gamma_[start_idx] = std::get<1>(init_coeffs);
+
+        for (std::size_t t = start_idx + 1; t < end_idx; ++t)
+        {
+            beta_[t] = b_[t] - (a_[t] * gamma_[t - 1]);
+            gamma_[t] = c_[t] / beta_[t];
+        }
+        beta_[end_idx] = b - (a * gamma_[end_idx - 1]);
+        factors_key_ = key;
+        LSS_STATS_ADD(stats_, add_factorizations, 1);
+        // working containers hold single system factors from now on:
+        std::get<0>(batch_factors_key_) = nullptr;
     }
-    beta_[end_idx] = b - (a * gamma_[end_idx - 1]);
 
     solution[start_idx] = std::get<3>(init_coeffs);
     for (std::size_t t = start_idx + 1; t < end_idx; ++t)
@@ -94,6 +85,28 @@ void lss_thomas_lu_solver::thomas_lu_solver::kernel(boundary_1d_pair const &boun
     }
     // first copy to solution container:
     std::copy(f_.begin(), f_.end(), solution.begin());
+}
+
+void lss_thomas_lu_solver::thomas_lu_solver::kernel(boundary_1d_pair const &boundary, container_t &solution,
+                                                    factorization_enum factorization, double time)
+{
+    // get proper boundaries:
+    const std::size_t N = discretization_size_ - 1;
+    const auto &lowest_quad = std::make_tuple(a_[0], b_[0], c_[0], f_[0]);
+    const auto &lower_quad = std::make_tuple(a_[1], b_[1], c_[1], f_[1]);
+    const auto &higher_quad = std::make_tuple(a_[N - 1], b_[N - 1], c_[N - 1], f_[N - 1]);
+    const auto &highest_quad = std::make_tuple(a_[N], b_[N], c_[N], f_[N]);
+    tlu_boundary_->set_lowest_quad(lowest_quad);
+    tlu_boundary_->set_lower_quad(lower_quad);
+    tlu_boundary_->set_higher_quad(higher_quad);
+    tlu_boundary_->set_highest_quad(highest_quad);
+
+    const auto &init_coeffs = tlu_boundary_->init_coefficients(boundary, time);
+    const std::size_t start_idx = tlu_boundary_->start_index();
+    const auto &fin_coeffs = tlu_boundary_->final_coefficients(boundary, time);
+    const std::size_t end_idx = tlu_boundary_->end_index();
+
+    substitute(init_coeffs, fin_coeffs, start_idx, end_idx, solution);
     // fill in the boundary values:
     if (start_idx == 1)
         solution[0] = tlu_boundary_->lower_boundary(boundary, time);
@@ -104,17 +117,6 @@ void lss_thomas_lu_solver::thomas_lu_solver::kernel(boundary_1d_pair const &boun
 void lss_thomas_lu_solver::thomas_lu_solver::kernel(boundary_2d_pair const &boundary, container_t &solution,
                                                     factorization_enum factorization, double time, double space_arg)
 {
-    // check the diagonal dominance:
-    LSS_ASSERT(is_diagonally_dominant() == true, "Tridiagonal matrix must be diagonally dominant.");
-
-    // clear the working containers:
-    beta_.clear();
-    gamma_.clear();
-
-    // resize the working containers:
-    beta_.resize(discretization_size_);
-    gamma_.resize(discretization_size_);
-
     // get proper boundaries:
     const std::size_t N = discretization_size_ - 1;
     const auto &lowest_quad = std::make_tuple(a_[0], b_[0], c_[0], f_[0]);
@@ -130,35 +132,8 @@ void lss_thomas_lu_solver::thomas_lu_solver::kernel(boundary_2d_pair const &boun
     const std::size_t start_idx = tlu_boundary_->start_index();
     const auto &fin_coeffs = tlu_boundary_->final_coefficients(boundary, time, space_arg);
     const std::size_t end_idx = tlu_boundary_->end_index();
-    const double a = std::get<0>(fin_coeffs);
-    const double b = std::get<1>(fin_coeffs);
-    const double r = std::get<2>(fin_coeffs);
-
-    // init values for the working containers:
-    beta_[start_idx] = std::get<0>(init_coeffs);
-    gamma_[start_idx] = std::get<1>(init_coeffs);
-
-    for (std::size_t t = start_idx + 1; t < end_idx; ++t)
-    {
-        beta_[t] = b_[t] - (a_[t] * gamma_[t - 1]);
-        gamma_[t] = c_[t] / beta_[t];
-    }
-    beta_[end_idx] = b - (a * gamma_[end_idx - 1]);
 
-    solution[start_idx] = std::get<3>(init_coeffs);
-    for (std::size_t t = start_idx + 1; t < end_idx; ++t)
-    {
-        solution[t] = (f_[t] - (a_[t] * solution[t - 1])) / beta_[t];
-    }
-    solution[end_idx] = (r - (a * solution[end_idx - 1])) / beta_[end_idx];
-
-    f_[end_idx] = solution[end_idx];
-    for (std::size_t t = end_idx; t-- > start_idx;)
-    {
-        f_[t] = solution[t] - (gamma_[t] * f_[t + 1]);
-    }
-    // first copy to solution container:
-    std::copy(f_.begin(), f_.end(), solution.begin());
+    substitute(init_coeffs, fin_coeffs, start_idx, end_idx, solution);
     // fill in the boundary values:
     if (start_idx == 1)
         solution[0] = tlu_boundary_->lower_boundary(boundary, time, space_arg);
@@ -170,17 +145,6 @@ void lss_thomas_lu_solver::thomas_lu_solver::kernel(boundary_3d_pair const &boun
                                                     factorization_enum factorization, double time, double space_1_arg,
                                                     double space_2_arg)
 {
-    // check the diagonal dominance:
-    LSS_ASSERT(is_diagonally_dominant() == true, "Tridiagonal matrix must be diagonally dominant.");
-
-    // clear the working containers:
-    beta_.clear();
-    gamma_.clear();
-
-    // resize the working containers:
-    beta_.resize(discretization_size_);
-    gamma_.resize(discretization_size_);
-
     // get proper boundaries:
     const std::size_t N = discretization_size_ - 1;
     const auto &lowest_quad = std::make_tuple(a_[0], b_[0], c_[0], f_[0]);
@@ -196,40 +160,160 @@ void lss_thomas_lu_solver::thomas_lu_solver::kernel(boundary_3d_pair const &boun
     const std::size_t start_idx = tlu_boundary_->start_index();
     const auto &fin_coeffs = tlu_boundary_->final_coefficients(boundary, time, space_1_arg, space_2_arg);
     const std::size_t end_idx = tlu_boundary_->end_index();
-    const double a = std::get<0>(fin_coeffs);
-    const double b = std::get<1>(fin_coeffs);
-    const double r = std::get<2>(fin_coeffs);
 
-    // init values for the working containers:
-    beta_[start_idx] = std::get<0>(init_coeffs);
-    gamma_[start_idx] = std::get<1>(init_coeffs);
+    substitute(init_coeffs, fin_coeffs, start_idx, end_idx, solution);
+    // fill in the boundary values:
+    if (start_idx == 1)
+        solution[0] = tlu_boundary_->lower_boundary(boundary, time, space_1_arg, space_2_arg);
+    if (end_idx == N - 1)
+        solution[N] = tlu_boundary_->upper_boundary(boundary, time, space_1_arg, space_2_arg);
+}
+
+template <typename boundary_pair, typename... space_args_t>
+void thomas_lu_solver::solve_batch(boundary_pair const &boundary, tridiagonal_batch &batch, double time,
+                                   space_args_t const &...space_args)
+{
+    const std::size_t M = batch.systems_count();
+    if (M == 0)
+        return;
+    const std::size_t N = discretization_size_ - 1;
+    double const *a = batch.raw_low();
+    double const *b = batch.raw_diag();
+    double const *c = batch.raw_high();
+    double const *f = batch.raw_rhs();
+    double *x = batch.raw_solution();
+
+    // factors of kept diagonals are reused while the linear parts of all boundaries are unchanged too:
+    bool is_factorized = batch.are_diagonals_kept() && (std::get<0>(batch_factors_key_) == b) &&
+                         (std::get<1>(batch_factors_key_) == M);
+    if (!is_factorized)
+    {
+        // working containers hold batch factors from now on:
+        std::get<0>(factors_key_) = 0;
+        beta_.resize(discretization_size_ * M);
+        gamma_.resize(discretization_size_ * M);
+        beta_0_.resize(M);
+        gamma_0_.resize(M);
+        alpha_n_.resize(M);
+        beta_n_.resize(M);
+        r_n_.resize(M);
+    }
 
-    for (std::size_t t = start_idx + 1; t < end_idx; ++t)
+    // boundary coefficients are computed system by system, boundary types are shared by all systems:
+    std::size_t start_idx{};
+    std::size_t end_idx{};
+    for (std::size_t s = 0; s < M; ++s)
     {
-        beta_[t] = b_[t] - (a_[t] * gamma_[t - 1]);
-        gamma_[t] = c_[t] / beta_[t];
+        const auto quad = [&](std::size_t t) {
+            const std::size_t i = batch.index(t, s);
+            return std::make_tuple(a[i], b[i], c[i], f[i]);
+        };
+        tlu_boundary_->set_lowest_quad(quad(0));
+        tlu_boundary_->set_lower_quad(quad(1));
+        tlu_boundary_->set_higher_quad(quad(N - 1));
+        tlu_boundary_->set_highest_quad(quad(N));
+
+        auto const &bnd = system_boundary(boundary, s);
+        const auto &init_coeffs = tlu_boundary_->init_coefficients(bnd, time, space_args[s]...);
+        const auto &fin_coeffs = tlu_boundary_->final_coefficients(bnd, time, space_args[s]...);
+        LSS_ASSERT((s == 0) ||
+                       ((start_idx == tlu_boundary_->start_index()) && (end_idx == tlu_boundary_->end_index())),
+                   "All systems in batch must share boundary types");
+        start_idx = tlu_boundary_->start_index();
+        end_idx = tlu_boundary_->end_index();
+        is_factorized = is_factorized && (beta_0_[s] == std::get<0>(init_coeffs)) &&
+                        (gamma_0_[s] == std::get<1>(init_coeffs)) && (alpha_n_[s] == std::get<0>(fin_coeffs)) &&
+                        (beta_n_[s] == std::get<1>(fin_coeffs));
+        beta_0_[s] = std::get<0>(init_coeffs);
+        gamma_0_[s] = std::get<1>(init_coeffs);
+        alpha_n_[s] = std::get<0>(fin_coeffs);
+        beta_n_[s] = std::get<1>(fin_coeffs);
+        r_n_[s] = std::get<2>(fin_coeffs);
+
+        x[batch.index(start_idx, s)] = std::get<3>(init_coeffs);
+        // fill in the boundary values:
+        if (start_idx == 1)
+            x[batch.index(0, s)] = tlu_boundary_->lower_boundary(bnd, time, space_args[s]...);
+        if (end_idx == N - 1)
+            x[batch.index(N, s)] = tlu_boundary_->upper_boundary(bnd, time, space_args[s]...);
+    }
+    is_factorized = is_factorized && (std::get<2>(batch_factors_key_) == start_idx) &&
+                    (std::get<3>(batch_factors_key_) == end_idx);
+
+    // systems are the innermost index so the loops below run across SIMD lanes:
+    const std::size_t start_row = start_idx * M;
+    const std::size_t end_row = end_idx * M;
+    if (!is_factorized)
+    {
+        // check the diagonal dominance:
+        LSS_ASSERT(is_diagonally_dominant() == true, "Tridiagonal matrix must be diagonally dominant.");
+        for (std::size_t s = 0; s < M; ++s)
+        {
+            beta_[start_row + s] = beta_0_[s];
+            gamma_[start_row + s] = gamma_0_[s];
+        }
+        for (std::size_t t = start_idx + 1; t < end_idx; ++t)
+        {
+            const std::size_t row = t * M;
+            const std::size_t prev = row - M;
+            for (std::size_t s = 0; s < M; ++s)
+            {
+                beta_[row + s] = b[row + s] - (a[row + s] * gamma_[prev + s]);
+                gamma_[row + s] = c[row + s] / beta_[row + s];
+            }
+        }
+        for (std::size_t s = 0; s < M; ++s)
+        {
+            beta_[end_row + s] = beta_n_[s] - (alpha_n_[s] * gamma_[end_row - M + s]);
+        }
+        batch_factors_key_ = std::make_tuple(b, M, start_idx, end_idx);
+        LSS_STATS_ADD(stats_, add_factorizations, M);
     }
-    beta_[end_idx] = b - (a * gamma_[end_idx - 1]);
 
-    solution[start_idx] = std::get<3>(init_coeffs);
     for (std::size_t t = start_idx + 1; t < end_idx; ++t)
     {
-        solution[t] = (f_[t] - (a_[t] * solution[t - 1])) / beta_[t];
+        const std::size_t row = t * M;
+        const std::size_t prev = row - M;
+        for (std::size_t s = 0; s < M; ++s)
+        {
+            x[row + s] = (f[row + s] - (a[row + s] * x[prev + s])) / beta_[row + s];
+        }
+    }
+    for (std::size_t s = 0; s < M; ++s)
+    {
+        x[end_row + s] = (r_n_[s] - (alpha_n_[s] * x[end_row - M + s])) / beta_[end_row + s];
     }
-    solution[end_idx] = (r - (a * solution[end_idx - 1])) / beta_[end_idx];
 
-    f_[end_idx] = solution[end_idx];
     for (std::size_t t = end_idx; t-- > start_idx;)
     {
-        f_[t] = solution[t] - (gamma_[t] * f_[t + 1]);
+        const std::size_t row = t * M;
+        for (std::size_t s = 0; s < M; ++s)
+        {
+            x[row + s] = x[row + s] - (gamma_[row + s] * x[row + M + s]);
+        }
     }
-    // first copy to solution container:
-    std::copy(f_.begin(), f_.end(), solution.begin());
-    // fill in the boundary values:
-    if (start_idx == 1)
-        solution[0] = tlu_boundary_->lower_boundary(boundary, time, space_1_arg, space_2_arg);
-    if (end_idx == N - 1)
-        solution[N] = tlu_boundary_->upper_boundary(boundary, time, space_1_arg, space_2_arg);
+}
+
+void thomas_lu_solver::batch_kernel(boundary_1d_pair const &boundary, tridiagonal_batch &batch, double time)
+{
+    solve_batch(boundary, batch, time);
+}
+
+void thomas_lu_solver::batch_kernel(boundary_1d_pairs const &boundaries, tridiagonal_batch &batch, double time)
+{
+    solve_batch(boundaries, batch, time);
+}
+
+void thomas_lu_solver::batch_kernel(boundary_2d_pair const &boundary, tridiagonal_batch &batch, double time,
+                                    container_t const &space_args)
+{
+    solve_batch(boundary, batch, time, space_args);
+}
+
+void thomas_lu_solver::batch_kernel(boundary_3d_pair const &boundary, tridiagonal_batch &batch, double time,
+                                    container_t const &space_1_args, container_t const &space_2_args)
+{
+    solve_batch(boundary, batch, time, space_1_args, space_2_args);
 }
 
 } // namespace lss_thomas_lu_solver
@@ -17,17 +17,31 @@ namespace lss_thomas_lu_solver
 {
 
 using lss_boundary::boundary_1d_pair;
+using lss_boundary::boundary_1d_pairs;
 using lss_boundary::boundary_2d_pair;
 using lss_boundary::boundary_3d_pair;
 using lss_enumerations::factorization_enum;
+using lss_tridiagonal_solver::system_boundary;
+using lss_tridiagonal_solver::tridiagonal_batch;
 using lss_utility::container_t;
 using lss_utility::sptr_t;
 
+// diagonals version, start and end index, initial beta and gamma, final alpha and beta:
+using factors_key_t = std::tuple<std::size_t, std::size_t, std::size_t, double, double, double, double>;
+// batch diagonals, number of systems, start and end index:
+using batch_factors_key_t = std::tuple<double const *, std::size_t, std::size_t, std::size_t>;
+
 class thomas_lu_solver : public lss_tridiagonal_solver::tridiagonal_solver
 {
 
   private:
     container_t beta_, gamma_;
+    // identifies factorization held in beta_ and gamma_ (diagonals version 0 means none):
+    factors_key_t factors_key_;
+    // identifies batch factorization held in beta_ and gamma_ (null diagonals mean none):
+    batch_factors_key_t batch_factors_key_;
+    // initial and final coefficients of each system in batch:
+    container_t beta_0_, gamma_0_, alpha_n_, beta_n_, r_n_;
     thomas_lu_solver_boundary_ptr tlu_boundary_;
 
     void kernel(boundary_1d_pair const &boundary, container_t &solution, factorization_enum factorization,
@@ -39,6 +53,23 @@ class thomas_lu_solver : public lss_tridiagonal_solver::tridiagonal_solver
     void kernel(boundary_3d_pair const &boundary, container_t &solution, factorization_enum factorization, double time,
                 double space_1_arg, double space_2_arg) override;
 
+    void substitute(quad_t const &init_coeffs, triplet_t const &fin_coeffs, std::size_t start_idx,
+                    std::size_t end_idx, container_t &solution);
+
+    void batch_kernel(boundary_1d_pair const &boundary, tridiagonal_batch &batch, double time) override;
+
+    void batch_kernel(boundary_1d_pairs const &boundaries, tridiagonal_batch &batch, double time) override;
+
+    void batch_kernel(boundary_2d_pair const &boundary, tridiagonal_batch &batch, double time,
+                      container_t const &space_args) override;
+
+    void batch_kernel(boundary_3d_pair const &boundary, tridiagonal_batch &batch, double time,
+                      container_t const &space_1_args, container_t const &space_2_args) override;
+
+    template <typename boundary_pair, typename... space_args_t>
+    void solve_batch(boundary_pair const &boundary, tridiagonal_batch &batch, double time,
+                     space_args_t const &...space_args);
+
     void initialize();
 
     explicit thomas_lu_solver() = delete;
@@ -6,6 +6,7 @@
 #include <random>
 #include <string>
 
+using lss_containers::container_2d;
 using lss_containers::container_3d;
 using lss_enumerations::by_enum;
 
@@ -390,4 +391,49 @@ void basic_lcontainer_3d_test()
     print_container(matl3d, "new matl3d");
 }
 
+void view_rcontainer_3d_test()
+{
+    auto const rows = 3;
+    auto const cols = 4;
+    auto const lays = 2;
+
+    container_3d<by_enum::RowPlane> matr3d(rows, cols, lays);
+    for (std::size_t r = 0; r < rows; ++r)
+    {
+        for (std::size_t c = 0; c < cols; ++c)
+        {
+            for (std::size_t l = 0; l < lays; ++l)
+            {
+                matr3d(r, c, l, static_cast<double>(100 * r + 10 * c + l));
+            }
+        }
+    }
+    print_container(matr3d, "matr3d");
+
+    // views share the storage with matr3d:
+    auto rline = matr3d.row_line(1, 0);
+    auto cline = matr3d.column_line(2, 1);
+    auto lline = matr3d.layer_line(0, 3);
+    std::cout << "row line at (1,0): ";
+    for (std::size_t t = 0; t < rline.size(); ++t)
+        std::cout << rline[t] << ",";
+    std::cout << "\ncolumn line at (2,1): ";
+    for (std::size_t t = 0; t < cline.size(); ++t)
+        std::cout << cline[t] << ",";
+    std::cout << "\nlayer line at (0,3): ";
+    for (std::size_t t = 0; t < lline.size(); ++t)
+        std::cout << lline[t] << ",";
+    std::cout << "\n";
+
+    std::vector<double> v(rows, -1.0);
+    rline.copy_from(v);
+    print_container(matr3d, "matr3d with row line (1,0) set to -1");
+
+    // 2D row-wise container with column view:
+    container_2d<by_enum::Row> matr2d(rows, cols, 0.0);
+    std::vector<double> col(rows, 7.0);
+    matr2d.column(2).copy_from(col);
+    print_container(matr2d, "matr2d with column 2 set to 7");
+}
+
 #endif ///_CONTAINER_3D_T_HPP_
@@ -454,4 +454,84 @@ void test_impl_simple_ode1_neumann_robin_bc_cuda_solver_device()
     std::cout << "==================================================\n";
 }
 
+void test_impl_simple_ode_dirichlet_bc_karawia_solver_host()
+{
+    using lss_boundary::dirichlet_boundary_1d;
+    using lss_enumerations::factorization_enum;
+    using lss_enumerations::memory_space_enum;
+    using lss_enumerations::tridiagonal_method_enum;
+    using lss_grids::grid_1d;
+    using lss_grids::grid_config_1d;
+    using lss_grids::grid_config_hints_1d;
+    using lss_grids::grid_transform_config_1d;
+    using lss_ode_solvers::ode_coefficient_data_config;
+    using lss_ode_solvers::ode_data_config;
+    using lss_ode_solvers::ode_discretization_config;
+    using lss_ode_solvers::ode_implicit_solver_config;
+    using lss_ode_solvers::ode_nonhom_data_config;
+    using lss_ode_solvers::implicit_solvers::ode_equation;
+    using lss_utility::range;
+
+    double const pi = 3.14159265358979323846;
+
+    std::cout << "=================================\n";
+    std::cout << "Solving Boundary-value problem: \n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " u''(t) + u'(t) - u(t) = -(pi*pi + 1)*sin(pi*t) + pi*cos(pi*t), \n\n";
+    std::cout << " where\n\n";
+    std::cout << " t in <0,1>,\n";
+    std::cout << " u(0) = u(1) = 0\n\n";
+    std::cout << "Exact solution is:\n\n";
+    std::cout << " u(t) = sin(pi*t)\n";
+    std::cout << "=================================\n";
+
+    // number of space subdivisions:
+    std::size_t Sd{41};
+    // space range:
+    auto const space_range = std::make_shared<range>(0.0, 1.0);
+    // discretization config:
+    auto const discretization_ptr = std::make_shared<ode_discretization_config>(space_range, Sd);
+    // coeffs:
+    auto a = [](double x) { return 1.0; };
+    auto b = [](double x) { return -1.0; };
+    auto const ode_coeffs_data_ptr = std::make_shared<ode_coefficient_data_config>(a, b);
+    // nonhom data:
+    auto nonhom = [=](double x) { return (-(pi * pi + 1.0) * std::sin(pi * x) + pi * std::cos(pi * x)); };
+    auto const ode_nonhom_data_ptr = std::make_shared<ode_nonhom_data_config>(nonhom);
+    // ode data config:
+    auto const ode_data_ptr = std::make_shared<ode_data_config>(ode_coeffs_data_ptr, ode_nonhom_data_ptr);
+    // boundary conditions:
+    auto const &dirichlet = 0.0;
+    auto const &boundary_ptr = std::make_shared<dirichlet_boundary_1d>(dirichlet);
+    auto const &boundary_pair = std::make_pair(boundary_ptr, boundary_ptr);
+    // grid config:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_1d>();
+    auto const grid_cfg = std::make_shared<grid_config_1d>(discretization_ptr);
+    auto const grid_trans_cfg = std::make_shared<grid_transform_config_1d>(discretization_ptr, grid_config_hints_ptr);
+
+    // the three-point scheme is the benchmark:
+    for (auto const method : {tridiagonal_method_enum::ThomasLUSolver, tridiagonal_method_enum::KarawiaSolver})
+    {
+        auto const &solver_config_ptr =
+            std::make_shared<ode_implicit_solver_config>(memory_space_enum::Host, method, factorization_enum::None);
+        // initialize ode solver
+        ode_equation odesolver(ode_data_ptr, discretization_ptr, boundary_pair, grid_config_hints_ptr,
+                               solver_config_ptr);
+        // prepare container for solution:
+        std::vector<double> solution(Sd, double{});
+        // get the solution:
+        odesolver.solve(solution);
+
+        double x{};
+        double max_diff{};
+        for (std::size_t j = 0; j < solution.size(); ++j)
+        {
+            x = grid_1d::transformed_value(grid_trans_cfg, grid_1d::value(grid_cfg, j));
+            max_diff = std::max(max_diff, std::abs(solution[j] - std::sin(pi * x)));
+        }
+        std::cout << (method == tridiagonal_method_enum::KarawiaSolver ? "five-point" : "three-point")
+                  << " max abs diff: " << max_diff << '\n';
+    }
+}
+
 #endif ///_LSS_ODE_2_DEGREE_T_HPP_
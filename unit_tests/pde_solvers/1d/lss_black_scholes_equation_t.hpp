@@ -11,7 +11,10 @@
 #include "../../../pde_solvers/lss_heat_solver_config.hpp"
 #include <map>
 
+using lss_boundary::boundary_1d_pairs;
 using lss_boundary::dirichlet_boundary_1d;
+using lss_containers::container_2d;
+using lss_enumerations::by_enum;
 using lss_enumerations::grid_enum;
 using lss_enumerations::implicit_pde_schemes_enum;
 using lss_grids::grid_1d;
@@ -21,9 +24,11 @@ using lss_grids::grid_transform_config_1d;
 using lss_pde_solvers::heat_coefficient_data_config_1d;
 using lss_pde_solvers::heat_data_config_1d;
 using lss_pde_solvers::heat_implicit_solver_config;
+using lss_pde_solvers::heat_implicit_solver_config_ptr;
 using lss_pde_solvers::heat_initial_data_config_1d;
 using lss_pde_solvers::pde_discretization_config_1d;
 using lss_pde_solvers::one_dimensional::implicit_solvers::heat_equation;
+using lss_pde_solvers::one_dimensional::implicit_solvers::heat_equation_batch;
 using lss_utility::black_scholes_exact;
 using lss_utility::range;
 
@@ -846,6 +851,335 @@ void impl_black_scholes_equation_dirichlet_bc_thomas_lu_solver_crank_nicolson()
     }
 }
 
+void impl_black_scholes_equation_dirichlet_bc_thomas_lu_solver_crank_nicolson_rannacher()
+{
+    using lss_enumerations::factorization_enum;
+    using lss_enumerations::memory_space_enum;
+    using lss_enumerations::traverse_direction_enum;
+    using lss_enumerations::tridiagonal_method_enum;
+    using lss_pde_solvers::implicit_pde_scheme;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Black-Scholes Call equation: \n\n";
+    std::cout << " Using Thomas LU on HOST with implicit CN method\n";
+    std::cout << " started by Rannacher fully implicit half-steps\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_t(x,t) = 0.5*sig*sig*x*x*U_xx(x,t) + r*x*U_x(x,t) - "
+                 "r*U(x,t), \n\n";
+    std::cout << " where\n\n";
+    std::cout << " 0 < x < 20 and 0 < t < 1,\n";
+    std::cout << " U(0,t) = 0 and  U(20,t) = 20-K*exp(-r*(1-t)),0 < t < 1 \n\n";
+    std::cout << " U(x,T) = max(0,x-K), x in <0,20> \n\n";
+    std::cout << "============================================================\n";
+
+    // set up call option parameters:
+    auto const &strike = 10;
+    auto const &maturity = 1.0;
+    auto const &rate = 0.2;
+    auto const &sig = 0.25;
+    // number of space subdivisions:
+    std::size_t const Sd = 100;
+    // number of time subdivisions (coarse, the start-up damps the payoff kink):
+    std::size_t const Td = 10;
+    // space range:
+    auto const &space_range = std::make_shared<range>(0.0, 20.0);
+    // time range
+    auto const &time_range = std::make_shared<range>(0.0, maturity);
+    // discretization config:
+    auto const discretization_ptr = std::make_shared<pde_discretization_config_1d>(space_range, Sd, time_range, Td);
+    // coeffs:
+    auto a = [=](double t, double x) { return 0.5 * sig * sig * x * x; };
+    auto b = [=](double t, double x) { return rate * x; };
+    auto c = [=](double t, double x) { return -rate; };
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_1d>(a, b, c);
+    // terminal condition:
+    auto terminal_condition = [=](double x) { return std::max<double>(0.0, x - strike); };
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_1d>(terminal_condition);
+    // heat data config:
+    auto const heat_data_ptr = std::make_shared<heat_data_config_1d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    // boundary conditions:
+    auto const &dirichlet_low = [=](double t) { return 0.0; };
+    auto const &dirichlet_high = [=](double t) { return (20.0 - strike * std::exp(-rate * (maturity - t))); };
+    auto const &boundary_low_ptr = std::make_shared<dirichlet_boundary_1d>(dirichlet_low);
+    auto const &boundary_high_ptr = std::make_shared<dirichlet_boundary_1d>(dirichlet_high);
+    auto const &boundary_pair = std::make_pair(boundary_low_ptr, boundary_high_ptr);
+    // grid config:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_1d>();
+    // solver config with two Rannacher start-up steps:
+    auto const &solver_config_ptr = std::make_shared<heat_implicit_solver_config>(
+        memory_space_enum::Host, traverse_direction_enum::Backward, tridiagonal_method_enum::ThomasLUSolver,
+        factorization_enum::None, std::make_shared<implicit_pde_scheme>(implicit_pde_schemes_enum::CrankNicolson),
+        std::size_t(1), std::size_t(2));
+    // initialize pde solver
+    heat_equation pdesolver(heat_data_ptr, discretization_ptr, boundary_pair, grid_config_hints_ptr,
+                            solver_config_ptr);
+    // prepare container for solution:
+    std::vector<double> solution(Sd, double{});
+    // get the solution:
+    pdesolver.solve(solution);
+    // get exact solution:
+    black_scholes_exact bs_exact(0.0, strike, rate, sig, maturity);
+
+    double x{};
+    auto const grid_cfg = std::make_shared<grid_config_1d>(discretization_ptr);
+    auto const grid_trans_cfg = std::make_shared<grid_transform_config_1d>(discretization_ptr, grid_config_hints_ptr);
+    std::cout << "tp : FDM | Exact | Abs Diff\n";
+    double benchmark{};
+    for (std::size_t j = 0; j < solution.size(); ++j)
+    {
+        x = grid_1d::transformed_value(grid_trans_cfg, grid_1d::value(grid_cfg, j));
+        benchmark = bs_exact.call(x);
+        std::cout << "t_" << j << ": " << solution[j] << " |  " << benchmark << " | " << (solution[j] - benchmark)
+                  << '\n';
+    }
+}
+
+void impl_black_scholes_equation_dirichlet_bc_thomas_lu_solver_crank_nicolson_time_grid()
+{
+    using lss_enumerations::factorization_enum;
+    using lss_enumerations::memory_space_enum;
+    using lss_enumerations::traverse_direction_enum;
+    using lss_enumerations::tridiagonal_method_enum;
+    using lss_pde_solvers::implicit_pde_scheme;
+    using lss_pde_solvers::time_grid_config;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Black-Scholes Call equation: \n\n";
+    std::cout << " Using Thomas LU on HOST with implicit CN method\n";
+    std::cout << " on time grid clustered around maturity\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_t(x,t) = 0.5*sig*sig*x*x*U_xx(x,t) + r*x*U_x(x,t) - "
+                 "r*U(x,t), \n\n";
+    std::cout << " where\n\n";
+    std::cout << " 0 < x < 20 and 0 < t < 1,\n";
+    std::cout << " U(0,t) = 0 and  U(20,t) = 20-K*exp(-r*(1-t)),0 < t < 1 \n\n";
+    std::cout << " U(x,T) = max(0,x-K), x in <0,20> \n\n";
+    std::cout << "============================================================\n";
+
+    // set up call option parameters:
+    auto const &strike = 10;
+    auto const &maturity = 1.0;
+    auto const &rate = 0.2;
+    auto const &sig = 0.25;
+    // number of space subdivisions:
+    std::size_t const Sd = 100;
+    // number of time points (steps get finer towards the payoff date):
+    std::size_t const Td = 20;
+    // space range:
+    auto const &space_range = std::make_shared<range>(0.0, 20.0);
+    // time range
+    auto const &time_range = std::make_shared<range>(0.0, maturity);
+    // time grid clustered around maturity:
+    auto const &time_grid_ptr = std::make_shared<time_grid_config>(time_range, Td, maturity);
+    // discretization config:
+    auto const discretization_ptr = std::make_shared<pde_discretization_config_1d>(space_range, Sd, time_grid_ptr);
+    // coeffs:
+    auto a = [=](double t, double x) { return 0.5 * sig * sig * x * x; };
+    auto b = [=](double t, double x) { return rate * x; };
+    auto c = [=](double t, double x) { return -rate; };
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_1d>(a, b, c);
+    // terminal condition:
+    auto terminal_condition = [=](double x) { return std::max<double>(0.0, x - strike); };
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_1d>(terminal_condition);
+    // heat data config:
+    auto const heat_data_ptr = std::make_shared<heat_data_config_1d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    // boundary conditions:
+    auto const &dirichlet_low = [=](double t) { return 0.0; };
+    auto const &dirichlet_high = [=](double t) { return (20.0 - strike * std::exp(-rate * (maturity - t))); };
+    auto const &boundary_low_ptr = std::make_shared<dirichlet_boundary_1d>(dirichlet_low);
+    auto const &boundary_high_ptr = std::make_shared<dirichlet_boundary_1d>(dirichlet_high);
+    auto const &boundary_pair = std::make_pair(boundary_low_ptr, boundary_high_ptr);
+    // grid config:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_1d>();
+    // solver config:
+    auto const &solver_config_ptr = std::make_shared<heat_implicit_solver_config>(
+        memory_space_enum::Host, traverse_direction_enum::Backward, tridiagonal_method_enum::ThomasLUSolver,
+        factorization_enum::None, std::make_shared<implicit_pde_scheme>(implicit_pde_schemes_enum::CrankNicolson));
+    // initialize pde solver
+    heat_equation pdesolver(heat_data_ptr, discretization_ptr, boundary_pair, grid_config_hints_ptr,
+                            solver_config_ptr);
+    // prepare container for solution:
+    std::vector<double> solution(Sd, double{});
+    // get the solution:
+    pdesolver.solve(solution);
+    // get exact solution:
+    black_scholes_exact bs_exact(0.0, strike, rate, sig, maturity);
+
+    double x{};
+    auto const grid_cfg = std::make_shared<grid_config_1d>(discretization_ptr);
+    auto const grid_trans_cfg = std::make_shared<grid_transform_config_1d>(discretization_ptr, grid_config_hints_ptr);
+    std::cout << "tp : FDM | Exact | Abs Diff\n";
+    double benchmark{};
+    for (std::size_t j = 0; j < solution.size(); ++j)
+    {
+        x = grid_1d::transformed_value(grid_trans_cfg, grid_1d::value(grid_cfg, j));
+        benchmark = bs_exact.call(x);
+        std::cout << "t_" << j << ": " << solution[j] << " |  " << benchmark << " | " << (solution[j] - benchmark)
+                  << '\n';
+    }
+}
+
+void impl_black_scholes_equation_dirichlet_bc_thomas_lu_solver_crank_nicolson_adaptive()
+{
+    using lss_enumerations::factorization_enum;
+    using lss_enumerations::memory_space_enum;
+    using lss_enumerations::traverse_direction_enum;
+    using lss_enumerations::tridiagonal_method_enum;
+    using lss_pde_solvers::implicit_pde_scheme;
+    using lss_pde_solvers::adaptive_time_stepping_config;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Black-Scholes Call equation: \n\n";
+    std::cout << " Using Thomas LU on HOST with implicit CN method\n";
+    std::cout << " with adaptive time stepping\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_t(x,t) = 0.5*sig*sig*x*x*U_xx(x,t) + r*x*U_x(x,t) - "
+                 "r*U(x,t), \n\n";
+    std::cout << " where\n\n";
+    std::cout << " 0 < x < 20 and 0 < t < 1,\n";
+    std::cout << " U(0,t) = 0 and  U(20,t) = 20-K*exp(-r*(1-t)),0 < t < 1 \n\n";
+    std::cout << " U(x,T) = max(0,x-K), x in <0,20> \n\n";
+    std::cout << "============================================================\n";
+
+    // set up call option parameters:
+    auto const &strike = 10;
+    auto const &maturity = 1.0;
+    auto const &rate = 0.2;
+    auto const &sig = 0.25;
+    // number of space subdivisions:
+    std::size_t const Sd = 100;
+    // number of time points (gives the initial time step only):
+    std::size_t const Td = 5;
+    // space range:
+    auto const &space_range = std::make_shared<range>(0.0, 20.0);
+    // time range
+    auto const &time_range = std::make_shared<range>(0.0, maturity);
+    // discretization config:
+    auto const discretization_ptr = std::make_shared<pde_discretization_config_1d>(space_range, Sd, time_range, Td);
+    // coeffs:
+    auto a = [=](double t, double x) { return 0.5 * sig * sig * x * x; };
+    auto b = [=](double t, double x) { return rate * x; };
+    auto c = [=](double t, double x) { return -rate; };
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_1d>(a, b, c);
+    // terminal condition:
+    auto terminal_condition = [=](double x) { return std::max<double>(0.0, x - strike); };
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_1d>(terminal_condition);
+    // heat data config:
+    auto const heat_data_ptr = std::make_shared<heat_data_config_1d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    // boundary conditions:
+    auto const &dirichlet_low = [=](double t) { return 0.0; };
+    auto const &dirichlet_high = [=](double t) { return (20.0 - strike * std::exp(-rate * (maturity - t))); };
+    auto const &boundary_low_ptr = std::make_shared<dirichlet_boundary_1d>(dirichlet_low);
+    auto const &boundary_high_ptr = std::make_shared<dirichlet_boundary_1d>(dirichlet_high);
+    auto const &boundary_pair = std::make_pair(boundary_low_ptr, boundary_high_ptr);
+    // grid config:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_1d>();
+    // local error tolerance, steps are refined around the kink of the payoff:
+    auto const &adaptive_ptr = std::make_shared<adaptive_time_stepping_config>(1.0e-4);
+    // solver config (two Rannacher start-up steps):
+    auto const &solver_config_ptr = std::make_shared<heat_implicit_solver_config>(
+        memory_space_enum::Host, traverse_direction_enum::Backward, tridiagonal_method_enum::ThomasLUSolver,
+        factorization_enum::None, std::make_shared<implicit_pde_scheme>(implicit_pde_schemes_enum::CrankNicolson),
+        std::size_t(1), std::size_t(2), adaptive_ptr);
+    // initialize pde solver
+    heat_equation pdesolver(heat_data_ptr, discretization_ptr, boundary_pair, grid_config_hints_ptr,
+                            solver_config_ptr);
+    // prepare container for solution:
+    std::vector<double> solution(Sd, double{});
+    // get the solution:
+    pdesolver.solve(solution);
+    // get exact solution:
+    black_scholes_exact bs_exact(0.0, strike, rate, sig, maturity);
+
+    double x{};
+    auto const grid_cfg = std::make_shared<grid_config_1d>(discretization_ptr);
+    auto const grid_trans_cfg = std::make_shared<grid_transform_config_1d>(discretization_ptr, grid_config_hints_ptr);
+    std::cout << "tp : FDM | Exact | Abs Diff\n";
+    double benchmark{};
+    for (std::size_t j = 0; j < solution.size(); ++j)
+    {
+        x = grid_1d::transformed_value(grid_trans_cfg, grid_1d::value(grid_cfg, j));
+        benchmark = bs_exact.call(x);
+        std::cout << "t_" << j << ": " << solution[j] << " |  " << benchmark << " | " << (solution[j] - benchmark)
+                  << '\n';
+    }
+}
+
+void impl_black_scholes_equation_dirichlet_bc_thomas_lu_solver_crank_nicolson_separable()
+{
+    using lss_pde_solvers::default_heat_solver_configs::host_bwd_tlusolver_cn_solver_config_ptr;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Black-Scholes Call equation: \n\n";
+    std::cout << " Using Thomas LU on HOST with implicit CN method\n";
+    std::cout << " with separable time-dependent volatility\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_t(x,t) = 0.5*sig(t)*sig(t)*x*x*U_xx(x,t) + r*x*U_x(x,t) - "
+                 "r*U(x,t), \n\n";
+    std::cout << " where\n\n";
+    std::cout << " 0 < x < 20 and 0 < t < 1, sig(t) = 0.2 + 0.1*t,\n";
+    std::cout << " U(0,t) = 0 and  U(20,t) = 20-K*exp(-r*(1-t)),0 < t < 1 \n\n";
+    std::cout << " U(x,T) = max(0,x-K), x in <0,20> \n\n";
+    std::cout << "============================================================\n";
+
+    // set up call option parameters:
+    auto const &strike = 10;
+    auto const &maturity = 1.0;
+    auto const &rate = 0.2;
+    // number of space subdivisions:
+    std::size_t const Sd = 100;
+    // number of time subdivisions:
+    std::size_t const Td = 100;
+    // space range:
+    auto const &space_range = std::make_shared<range>(0.0, 20.0);
+    // time range
+    auto const &time_range = std::make_shared<range>(0.0, maturity);
+    // discretization config:
+    auto const discretization_ptr = std::make_shared<pde_discretization_config_1d>(space_range, Sd, time_range, Td);
+    // coeffs are time factor times space factor, null time factor means constant in time:
+    auto sig_sqr = [=](double t) { return ((0.2 + 0.1 * t) * (0.2 + 0.1 * t)); };
+    std::vector<std::function<double(double)>> const time_factors = {sig_sqr, nullptr, nullptr};
+    std::vector<std::function<double(double)>> const space_factors = {
+        [=](double x) { return 0.5 * x * x; }, [=](double x) { return rate * x; }, [=](double x) { return -rate; }};
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_1d>(time_factors, space_factors);
+    // terminal condition:
+    auto terminal_condition = [=](double x) { return std::max<double>(0.0, x - strike); };
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_1d>(terminal_condition);
+    // heat data config:
+    auto const heat_data_ptr = std::make_shared<heat_data_config_1d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    // boundary conditions:
+    auto const &dirichlet_low = [=](double t) { return 0.0; };
+    auto const &dirichlet_high = [=](double t) { return (20.0 - strike * std::exp(-rate * (maturity - t))); };
+    auto const &boundary_low_ptr = std::make_shared<dirichlet_boundary_1d>(dirichlet_low);
+    auto const &boundary_high_ptr = std::make_shared<dirichlet_boundary_1d>(dirichlet_high);
+    auto const &boundary_pair = std::make_pair(boundary_low_ptr, boundary_high_ptr);
+    // grid config:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_1d>();
+    // initialize pde solver
+    heat_equation pdesolver(heat_data_ptr, discretization_ptr, boundary_pair, grid_config_hints_ptr,
+                            host_bwd_tlusolver_cn_solver_config_ptr);
+    // prepare container for solution:
+    std::vector<double> solution(Sd, double{});
+    // get the solution:
+    pdesolver.solve(solution);
+    // get exact solution with root-mean-square volatility over the life of the option:
+    double const sig_rms = std::sqrt(0.04 + 0.02 + 0.01 / 3.0);
+    black_scholes_exact bs_exact(0.0, strike, rate, sig_rms, maturity);
+
+    double x{};
+    auto const grid_cfg = std::make_shared<grid_config_1d>(discretization_ptr);
+    auto const grid_trans_cfg = std::make_shared<grid_transform_config_1d>(discretization_ptr, grid_config_hints_ptr);
+    std::cout << "tp : FDM | Exact | Abs Diff\n";
+    double benchmark{};
+    for (std::size_t j = 0; j < solution.size(); ++j)
+    {
+        x = grid_1d::transformed_value(grid_trans_cfg, grid_1d::value(grid_cfg, j));
+        benchmark = bs_exact.call(x);
+        std::cout << "t_" << j << ": " << solution[j] << " |  " << benchmark << " | " << (solution[j] - benchmark)
+                  << '\n';
+    }
+}
+
 void test_impl_black_scholes_equation_dirichlet_bc_thomas_lu_solver()
 {
     std::cout << "============================================================\n";
@@ -854,6 +1188,111 @@ void test_impl_black_scholes_equation_dirichlet_bc_thomas_lu_solver()
 
     impl_black_scholes_equation_dirichlet_bc_thomas_lu_solver_euler();
     impl_black_scholes_equation_dirichlet_bc_thomas_lu_solver_crank_nicolson();
+    impl_black_scholes_equation_dirichlet_bc_thomas_lu_solver_crank_nicolson_rannacher();
+    impl_black_scholes_equation_dirichlet_bc_thomas_lu_solver_crank_nicolson_time_grid();
+    impl_black_scholes_equation_dirichlet_bc_thomas_lu_solver_crank_nicolson_adaptive();
+    impl_black_scholes_equation_dirichlet_bc_thomas_lu_solver_crank_nicolson_separable();
+
+    std::cout << "============================================================\n";
+}
+
+// batch of calls sharing one grid:
+void impl_black_scholes_equation_dirichlet_bc_batch(heat_implicit_solver_config_ptr const &solver_config_ptr)
+{
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Black-Scholes Call equations: \n\n";
+    std::cout << " Batch of calls with different strikes against single solves\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_t(x,t) = 0.5*sig*sig*x*x*U_xx(x,t) + r*x*U_x(x,t) - "
+                 "r*U(x,t), \n\n";
+    std::cout << " where\n\n";
+    std::cout << " 0 < x < 20 and 0 < t < 1,\n";
+    std::cout << " U(0,t) = 0 and  U(20,t) = 20-K_i*exp(-r*(1-t)),0 < t < 1 \n\n";
+    std::cout << " U(x,T) = max(0,x-K_i), x in <0,20> \n\n";
+    std::cout << "============================================================\n";
+
+    // set up call option parameters:
+    std::vector<double> const strikes = {8.0, 10.0, 12.0, 14.0};
+    auto const &maturity = 1.0;
+    auto const &rate = 0.2;
+    auto const &sig = 0.25;
+    // number of space subdivisions:
+    std::size_t const Sd = 100;
+    // number of time subdivisions:
+    std::size_t const Td = 100;
+    // space range:
+    auto const &space_range = std::make_shared<range>(0.0, 20.0);
+    // time range
+    auto const &time_range = std::make_shared<range>(0.0, maturity);
+    // discretization config:
+    auto const discretization_ptr = std::make_shared<pde_discretization_config_1d>(space_range, Sd, time_range, Td);
+    // coeffs:
+    auto a = [=](double t, double x) { return 0.5 * sig * sig * x * x; };
+    auto b = [=](double t, double x) { return rate * x; };
+    auto c = [=](double t, double x) { return -rate; };
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_1d>(a, b, c);
+    // grid config:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_1d>();
+    // terminal conditions and boundaries of all calls:
+    std::vector<std::function<double(double)>> terminal_conditions;
+    boundary_1d_pairs boundary_pairs;
+    for (auto const strike : strikes)
+    {
+        terminal_conditions.emplace_back([=](double x) { return std::max<double>(0.0, x - strike); });
+        auto const &dirichlet_low = [=](double t) { return 0.0; };
+        auto const &dirichlet_high = [=](double t) { return (20.0 - strike * std::exp(-rate * (maturity - t))); };
+        boundary_pairs.emplace_back(std::make_shared<dirichlet_boundary_1d>(dirichlet_low),
+                                    std::make_shared<dirichlet_boundary_1d>(dirichlet_high));
+    }
+    // the terminal condition of the shared heat data is not used by the batch:
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_1d>(terminal_conditions.front());
+    auto const heat_data_ptr = std::make_shared<heat_data_config_1d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    // solve all calls at once:
+    heat_equation_batch batch_pdesolver(heat_data_ptr, discretization_ptr, terminal_conditions, boundary_pairs,
+                                        grid_config_hints_ptr, solver_config_ptr);
+    container_2d<by_enum::Row> solutions(strikes.size(), Sd, double{});
+    batch_pdesolver.solve(solutions);
+
+    std::cout << "strike : max Abs Diff (batch vs single)\n";
+    for (std::size_t i = 0; i < strikes.size(); ++i)
+    {
+        auto const heat_data_i_ptr = std::make_shared<heat_data_config_1d>(
+            heat_coeffs_data_ptr, std::make_shared<heat_initial_data_config_1d>(terminal_conditions[i]));
+        heat_equation pdesolver(heat_data_i_ptr, discretization_ptr, boundary_pairs[i], grid_config_hints_ptr,
+                                solver_config_ptr);
+        std::vector<double> solution(Sd, double{});
+        pdesolver.solve(solution);
+        double max_diff{};
+        for (std::size_t j = 0; j < solution.size(); ++j)
+        {
+            max_diff = std::max(max_diff, std::abs(solutions(i, j) - solution[j]));
+        }
+        std::cout << strikes[i] << " : " << max_diff << '\n';
+        // direct solvers take the same steps on every row of the batch:
+        LSS_ASSERT(max_diff == 0.0, "Batch solution must equal the single solution");
+    }
+}
+
+void test_impl_black_scholes_equation_dirichlet_bc_batch()
+{
+    using lss_enumerations::factorization_enum;
+    using lss_enumerations::memory_space_enum;
+    using lss_enumerations::traverse_direction_enum;
+    using lss_enumerations::tridiagonal_method_enum;
+    using lss_pde_solvers::implicit_pde_scheme;
+    using lss_pde_solvers::default_heat_solver_configs::host_bwd_dssolver_cn_solver_config_ptr;
+    using lss_pde_solvers::default_heat_solver_configs::host_bwd_tlusolver_cn_solver_config_ptr;
+
+    std::cout << "============================================================\n";
+    std::cout << "====== Implicit Black-Scholes Batch Equation (Dir BC) ======\n";
+    std::cout << "============================================================\n";
+
+    impl_black_scholes_equation_dirichlet_bc_batch(host_bwd_tlusolver_cn_solver_config_ptr);
+    impl_black_scholes_equation_dirichlet_bc_batch(host_bwd_dssolver_cn_solver_config_ptr);
+    // single solve on one thread runs SPIKE as one block, as every system of the batch does:
+    impl_black_scholes_equation_dirichlet_bc_batch(std::make_shared<heat_implicit_solver_config>(
+        memory_space_enum::Host, traverse_direction_enum::Backward, tridiagonal_method_enum::SpikeSolver,
+        factorization_enum::None, std::make_shared<implicit_pde_scheme>(implicit_pde_schemes_enum::CrankNicolson)));
 
     std::cout << "============================================================\n";
 }
@@ -1053,6 +1053,187 @@ void test_impl_pure_heat_equation_dirichlet_bc_thomas_lu_solver()
     std::cout << "============================================================\n";
 }
 
+void impl_pure_heat_equation_dirichlet_bc_spike_solver_crank_nicolson()
+{
+    using lss_enumerations::factorization_enum;
+    using lss_enumerations::memory_space_enum;
+    using lss_enumerations::traverse_direction_enum;
+    using lss_enumerations::tridiagonal_method_enum;
+    using lss_pde_solvers::implicit_pde_scheme;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Heat equation: \n\n";
+    std::cout << " Using SPIKE algorithm (4 threads) with implicit CN method\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_t(x,t) = U_xx(x,t), \n\n";
+    std::cout << " where\n\n";
+    std::cout << " x in <0,1> and t > 0,\n";
+    std::cout << " U(0,t) = U(1,t) = 0, t > 0 \n\n";
+    std::cout << " U(x,0) = x, x in <0,1> \n\n";
+    std::cout << "============================================================\n";
+
+    // number of space subdivisions (large enough to be split among threads):
+    std::size_t const Sd = 100000;
+    // number of time subdivisions:
+    std::size_t const Td = 100;
+    // space range:
+    auto const &space_range = std::make_shared<range>(0.0, 1.0);
+    // time range
+    auto const &time_range = std::make_shared<range>(0.0, 0.1);
+    // discretization config:
+    auto const discretization_ptr = std::make_shared<pde_discretization_config_1d>(space_range, Sd, time_range, Td);
+    // coeffs:
+    auto a = [](double t, double x) { return 1.0; };
+    auto other = [](double t, double x) { return 0.0; };
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_1d>(a, other, other);
+    // initial condition:
+    auto initial_condition = [](double x) { return x; };
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_1d>(initial_condition);
+    // heat data config:
+    auto const heat_data_ptr = std::make_shared<heat_data_config_1d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    // boundary conditions:
+    auto const &dirichlet = [](double t) { return 0.0; };
+    auto const &boundary_ptr = std::make_shared<dirichlet_boundary_1d>(dirichlet);
+    auto const &boundary_pair = std::make_pair(boundary_ptr, boundary_ptr);
+    // grid config:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_1d>();
+    // solver config:
+    auto const &solver_config_ptr = std::make_shared<heat_implicit_solver_config>(
+        memory_space_enum::Host, traverse_direction_enum::Forward, tridiagonal_method_enum::SpikeSolver,
+        factorization_enum::None, std::make_shared<implicit_pde_scheme>(implicit_pde_schemes_enum::CrankNicolson), 4);
+    // initialize pde solver
+    heat_equation pdesolver(heat_data_ptr, discretization_ptr, boundary_pair, grid_config_hints_ptr,
+                            solver_config_ptr);
+    // prepare container for solution:
+    std::vector<double> solution(Sd, double{});
+    // get the solution:
+    pdesolver.solve(solution);
+    // get exact solution:
+    auto exact = [](double x, double t, std::size_t n) {
+        double const first = static_cast<double>(2.0 / pi());
+        double sum{};
+        double var1{};
+        double var2{};
+        for (std::size_t i = 1; i <= n; ++i)
+        {
+            var1 = std::pow(-1.0, i + 1) * std::exp(-1.0 * (i * pi()) * (i * pi()) * t);
+            var2 = std::sin(i * pi() * x) / i;
+            sum += (var1 * var2);
+        }
+        return (first * sum);
+    };
+
+    double x{};
+    auto const grid_cfg = std::make_shared<grid_config_1d>(discretization_ptr);
+    auto const grid_trans_cfg = std::make_shared<grid_transform_config_1d>(discretization_ptr, grid_config_hints_ptr);
+    double max_diff{};
+    for (std::size_t j = 0; j < solution.size(); ++j)
+    {
+        x = grid_1d::transformed_value(grid_trans_cfg, grid_1d::value(grid_cfg, j));
+        max_diff = std::max(max_diff, std::abs(solution[j] - exact(x, time_range->upper(), 20)));
+    }
+    std::cout << "max abs diff: " << max_diff << '\n';
+}
+
+void test_impl_pure_heat_equation_dirichlet_bc_spike_solver()
+{
+
+    std::cout << "============================================================\n";
+    std::cout << "=== Implicit Pure Heat (SPIKE) Equation (Dirichlet BC) =====\n";
+    std::cout << "============================================================\n";
+
+    impl_pure_heat_equation_dirichlet_bc_spike_solver_crank_nicolson();
+
+    std::cout << "============================================================\n";
+}
+
+void impl_pure_heat_equation_dirichlet_bc_karawia_solver_crank_nicolson()
+{
+    using lss_enumerations::factorization_enum;
+    using lss_enumerations::memory_space_enum;
+    using lss_enumerations::traverse_direction_enum;
+    using lss_enumerations::tridiagonal_method_enum;
+    using lss_pde_solvers::implicit_pde_scheme;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Heat equation: \n\n";
+    std::cout << " Using fourth-order scheme (Karawia) with implicit CN method\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_t(x,t) = U_xx(x,t), \n\n";
+    std::cout << " where\n\n";
+    std::cout << " x in <0,1> and t > 0,\n";
+    std::cout << " U(0,t) = U(1,t) = 0, t > 0 \n\n";
+    std::cout << " U(x,0) = sin(pi*x), x in <0,1> \n\n";
+    std::cout << "============================================================\n";
+
+    // number of space subdivisions:
+    std::size_t const Sd = 41;
+    // number of time subdivisions:
+    std::size_t const Td = 2000;
+    // space range:
+    auto const &space_range = std::make_shared<range>(0.0, 1.0);
+    // time range
+    auto const &time_range = std::make_shared<range>(0.0, 0.1);
+    // discretization config:
+    auto const discretization_ptr = std::make_shared<pde_discretization_config_1d>(space_range, Sd, time_range, Td);
+    // coeffs:
+    auto a = [](double t, double x) { return 1.0; };
+    auto other = [](double t, double x) { return 0.0; };
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_1d>(a, other, other);
+    // initial condition:
+    auto initial_condition = [](double x) { return std::sin(pi() * x); };
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_1d>(initial_condition);
+    // heat data config:
+    auto const heat_data_ptr = std::make_shared<heat_data_config_1d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    // boundary conditions:
+    auto const &dirichlet = [](double t) { return 0.0; };
+    auto const &boundary_ptr = std::make_shared<dirichlet_boundary_1d>(dirichlet);
+    auto const &boundary_pair = std::make_pair(boundary_ptr, boundary_ptr);
+    // grid config:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_1d>();
+    // exact solution:
+    auto exact = [](double x, double t) { return std::exp(-pi() * pi() * t) * std::sin(pi() * x); };
+    auto const grid_cfg = std::make_shared<grid_config_1d>(discretization_ptr);
+    auto const grid_trans_cfg = std::make_shared<grid_transform_config_1d>(discretization_ptr, grid_config_hints_ptr);
+
+    // the three-point scheme is the benchmark:
+    for (auto const method : {tridiagonal_method_enum::ThomasLUSolver, tridiagonal_method_enum::KarawiaSolver})
+    {
+        auto const &solver_config_ptr = std::make_shared<heat_implicit_solver_config>(
+            memory_space_enum::Host, traverse_direction_enum::Forward, method, factorization_enum::None,
+            std::make_shared<implicit_pde_scheme>(implicit_pde_schemes_enum::CrankNicolson));
+        // initialize pde solver
+        heat_equation pdesolver(heat_data_ptr, discretization_ptr, boundary_pair, grid_config_hints_ptr,
+                                solver_config_ptr);
+        // prepare container for solution:
+        std::vector<double> solution(Sd, double{});
+        // get the solution:
+        pdesolver.solve(solution);
+
+        double x{};
+        double max_diff{};
+        for (std::size_t j = 0; j < solution.size(); ++j)
+        {
+            x = grid_1d::transformed_value(grid_trans_cfg, grid_1d::value(grid_cfg, j));
+            max_diff = std::max(max_diff, std::abs(solution[j] - exact(x, time_range->upper())));
+        }
+        std::cout << (method == tridiagonal_method_enum::KarawiaSolver ? "five-point" : "three-point")
+                  << " max abs diff: " << max_diff << '\n';
+    }
+}
+
+void test_impl_pure_heat_equation_dirichlet_bc_karawia_solver()
+{
+
+    std::cout << "============================================================\n";
+    std::cout << "=== Implicit Pure Heat (Karawia) Equation (Dirichlet BC) ===\n";
+    std::cout << "============================================================\n";
+
+    impl_pure_heat_equation_dirichlet_bc_karawia_solver_crank_nicolson();
+
+    std::cout << "============================================================\n";
+}
+
 // Neuman-Dirichlet Boundaries:
 
 void impl_pure_heat_equation_neumann_bc_cuda_solver_device_qr_euler()
@@ -450,6 +450,88 @@ void impl_pure_wave_equation_dirichlet_bc_solver_host_lu_detail()
     }
 }
 
+void impl_pure_wave_equation_dirichlet_bc_solver_host_lu_adaptive_detail()
+{
+    using lss_enumerations::factorization_enum;
+    using lss_enumerations::memory_space_enum;
+    using lss_enumerations::traverse_direction_enum;
+    using lss_enumerations::tridiagonal_method_enum;
+    using lss_pde_solvers::adaptive_time_stepping_config;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Wave equation: \n\n";
+    std::cout << " Using Thomas LU Solver method\n";
+    std::cout << " with adaptive time stepping\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_tt(x,t) = U_xx(x,t), \n\n";
+    std::cout << " where\n\n";
+    std::cout << " x in <0,1> and t > 0,\n";
+    std::cout << " U(0,t) = U(1,t) = 0, t > 0 \n\n";
+    std::cout << " U(x,0) = sin(pi*x), x in <0,1> \n\n";
+    std::cout << " U_x(x,0) = 0, x in <0,1> \n\n";
+    std::cout << "============================================================\n";
+
+    // number of space subdivisions:
+    std::size_t const Sd = 100;
+    // number of time points (gives the initial time step only):
+    std::size_t const Td = 5;
+    // space range:
+    auto const &space_range = std::make_shared<range>(static_cast<double>(0.0), static_cast<double>(1.0));
+    // time range
+    auto const &time_range = std::make_shared<range>(static_cast<double>(0.0), static_cast<double>(0.7));
+    // discretization config:
+    auto const discretization_ptr = std::make_shared<pde_discretization_config_1d>(space_range, Sd, time_range, Td);
+    // coeffs:
+    auto b = [](double t, double x) { return 1.0; };
+    auto other = [](double t, double x) { return 0.0; };
+    auto const wave_coeffs_data_ptr = std::make_shared<wave_coefficient_data_config_1d>(other, b, other, other);
+    // initial condition:
+    auto initial_condition = [](double x) { return std::sin(pi() * x); };
+    auto zero = [](double x) { return 0.0; };
+    auto const wave_init_data_ptr = std::make_shared<wave_initial_data_config_1d>(initial_condition, zero);
+    // wave data config:
+    auto const wave_data_ptr = std::make_shared<wave_data_config_1d>(wave_coeffs_data_ptr, wave_init_data_ptr);
+    // boundary conditions:
+    auto const &dirichlet = [](double t) { return 0.0; };
+    auto const &boundary_ptr = std::make_shared<dirichlet_boundary_1d>(dirichlet);
+    auto const &boundary_pair = std::make_pair(boundary_ptr, boundary_ptr);
+    // grid:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_1d>();
+    // local error tolerance:
+    auto const &adaptive_ptr = std::make_shared<adaptive_time_stepping_config>(1.0e-6);
+    // solver config:
+    auto const &solver_config_ptr =
+        std::make_shared<wave_implicit_solver_config>(memory_space_enum::Host, traverse_direction_enum::Forward,
+                                                      tridiagonal_method_enum::ThomasLUSolver, factorization_enum::None,
+                                                      adaptive_ptr);
+    // initialize pde solver
+    wave_equation pdesolver(wave_data_ptr, discretization_ptr, boundary_pair, grid_config_hints_ptr,
+                            solver_config_ptr);
+    // prepare container for solution:
+    std::vector<double> solution(Sd, double{});
+    // get the solution:
+    pdesolver.solve(solution);
+    // get exact solution:
+    auto exact = [](double x, double t, std::size_t n) {
+        const double var1 = std::sin(pi() * x);
+        const double var2 = std::cos(pi() * t);
+        return (var1 * var2);
+    };
+
+    double x{};
+    auto const grid_cfg = std::make_shared<grid_config_1d>(discretization_ptr);
+    auto const grid_trans_cfg = std::make_shared<grid_transform_config_1d>(discretization_ptr, grid_config_hints_ptr);
+    std::cout << "tp : FDM | Exact | Abs Diff\n";
+    double benchmark{};
+    for (std::size_t j = 0; j < solution.size(); ++j)
+    {
+        x = grid_1d::transformed_value(grid_trans_cfg, grid_1d::value(grid_cfg, j));
+        benchmark = exact(x, time_range->upper(), 20);
+        std::cout << "t_" << j << ": " << solution[j] << " |  " << benchmark << " | " << (solution[j] - benchmark)
+                  << '\n';
+    }
+}
+
 void test_impl_pure_wave_equation_dirichlet_bc_solver_host_lu()
 {
     std::cout << "============================================================\n";
@@ -457,6 +539,7 @@ void test_impl_pure_wave_equation_dirichlet_bc_solver_host_lu()
     std::cout << "============================================================\n";
 
     impl_pure_wave_equation_dirichlet_bc_solver_host_lu_detail();
+    impl_pure_wave_equation_dirichlet_bc_solver_host_lu_adaptive_detail();
 
     std::cout << "============================================================\n";
 }
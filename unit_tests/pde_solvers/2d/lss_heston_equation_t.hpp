@@ -6,13 +6,21 @@
 #include "../../../common/lss_enumerations.hpp"
 #include "../../../common/lss_print.hpp"
 #include "../../../containers/lss_container_2d.hpp"
+#include "../../../containers/lss_container_3d.hpp"
 #include "pde_solvers/2d/heat_type/lss_heston_equation.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <map>
+#include <tuple>
+#include <vector>
 
 using lss_boundary::dirichlet_boundary_2d;
 using lss_boundary::neumann_boundary_2d;
 using lss_containers::container_2d;
+using lss_containers::container_3d;
 using lss_enumerations::by_enum;
+using lss_enumerations::solver_phase_enum;
 using lss_enumerations::splitting_method_enum;
 using lss_grids::grid_config_hints_2d;
 using lss_pde_solvers::heat_coefficient_data_config_2d;
@@ -21,8 +29,12 @@ using lss_pde_solvers::heat_implicit_solver_config;
 using lss_pde_solvers::heat_initial_data_config_2d;
 using lss_pde_solvers::pde_discretization_config_2d;
 using lss_pde_solvers::splitting_method_config;
+using lss_pde_solvers::time_slice_decimation;
+using lss_pde_solvers::time_slice_observer_2d;
 using lss_pde_solvers::two_dimensional::implicit_solvers::heston_equation;
 using lss_print::print;
+using lss_utility::execution_policy;
+using lss_utility::solver_stats;
 
 // ///////////////////////////////////////////////////////////////////////////
 //							HESTON PROBLEMS
@@ -208,13 +220,965 @@ void impl_heston_equation_thomas_lu_solver_crank_nicolson()
     print(discretization_ptr, grid_config_hints_ptr, solution);
 }
 
+void impl_heston_equation_thomas_lu_solver_crank_nicolson_pinned()
+{
+    using lss_pde_solvers::default_heat_solver_configs::host_bwd_tlusolver_cn_solver_config_ptr;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Heston Call equation: \n\n";
+    std::cout << " Using Thomas LU algo with implicit Crank-Nicolson method\n\n";
+    std::cout << " Values on the lines next to the rounded grid indices are pinned\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_t(s,v,t) = 0.5*v*s*s*U_ss(s,v,t) + 0.5*sig*sig*v*U_vv(s,v,t)"
+                 " + rho*sig*v*s*U_sv(s,v,t) + r*s*U_s(s,v,t)"
+                 " + [k*(theta-v)-lambda*v]*U_v(s,v,t) - r*U(s,v,t)\n\n";
+    std::cout << " where\n\n";
+    std::cout << " 0 < s < 20, 0 < v < 1, and 0 < t < 1,\n";
+    std::cout << " U(0,v,t) = 0 and  U_s(20,v,t) - 1 = 0, 0 < t < 1\n";
+    std::cout << " r*s*U_s(s,0,t)+k*theta*U_v(s,0,t)-rU(s,0,t)-U_t(s,0,t) = 0,"
+                 "0 < t < 1\n";
+    std::cout << " U(s,1,t) = s, 0 < t < 1\n";
+    std::cout << " U(s,v,T) = max(0,s - K), s in <0,20> \n\n";
+    std::cout << "============================================================\n";
+
+    // set up call option parameters:
+    auto const &strike = 10.0;
+    auto const &maturity = 1.0;
+    auto const &rate = 0.03;
+    auto const &sig_sig = 0.3;
+    auto const &sig_kappa = 2.0;
+    auto const &sig_theta = 0.2;
+    auto const &rho = 0.2;
+    // number of space subdivisions for spot:
+    std::size_t const Sd = 50;
+    // number of space subdivision for volatility:
+    std::size_t const Vd = 50;
+    // number of time subdivisions:
+    std::size_t const Td = 100;
+    // space Spot range:
+    auto const &spacex_range = std::make_shared<range>(0.0, 20.0);
+    // space Vol range:
+    auto const &spacey_range = std::make_shared<range>(0.0, 1.0);
+    // time range
+    auto const &time_range = std::make_shared<range>(0.0, maturity);
+    // discretization config:
+    auto const discretization_ptr =
+        std::make_shared<pde_discretization_config_2d>(spacex_range, spacey_range, Sd, Vd, time_range, Td);
+    // coeffs:
+    auto a = [=](double t, double s, double v) { return (0.5 * v * s * s); };
+    auto b = [=](double t, double s, double v) { return (0.5 * sig_sig * sig_sig * v); };
+    auto c = [=](double t, double s, double v) { return (rho * sig_sig * v * s); };
+    auto d = [=](double t, double s, double v) { return (rate * s); };
+    auto e = [=](double t, double s, double v) { return (sig_kappa * (sig_theta - v)); };
+    auto f = [=](double t, double s, double v) { return (-rate); };
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_2d>(a, b, c, d, e, f);
+    // terminal condition:
+    auto terminal_condition = [=](double s, double v) { return std::max(0.0, s - strike); };
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_2d>(terminal_condition);
+    // heat data config:
+    auto const heat_data_ptr = std::make_shared<heat_data_config_2d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    // horizontal spot boundary conditions:
+    auto const &dirichlet_low = [=](double t, double v) { return 0.0; };
+    auto const &neumann_high = [=](double t, double s) { return -1.0; };
+    auto const &boundary_low_ptr = std::make_shared<dirichlet_boundary_2d>(dirichlet_low);
+    auto const &boundary_high_ptr = std::make_shared<neumann_boundary_2d>(neumann_high);
+    auto const &horizontal_boundary_pair = std::make_pair(boundary_low_ptr, boundary_high_ptr);
+    // vertical upper vol boundary:
+    auto const &dirichlet_high = [=](double t, double s) { return s; };
+    auto const &vertical_upper_boundary_ptr = std::make_shared<dirichlet_boundary_2d>(dirichlet_high);
+    // splitting method configuration:
+    auto const &splitting_config_ptr =
+        std::make_shared<splitting_method_config>(splitting_method_enum::DouglasRachford);
+
+    // grid config:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_2d>(strike);
+
+    // initialize pde solver
+    heston_equation pdesolver(heat_data_ptr, discretization_ptr, vertical_upper_boundary_ptr, horizontal_boundary_pair,
+                              splitting_config_ptr, grid_config_hints_ptr, host_bwd_tlusolver_cn_solver_config_ptr);
+    // prepare container for solution:
+    container_2d<by_enum::Row> solution(Sd, Vd, double{});
+    // get the solution:
+    pdesolver.solve(solution);
+
+    // boundaries of the lines are looked up by rounding the space argument to the grid index,
+    // truncating it read the neighbouring value on the lines 15 and 30 and shifted the whole grid:
+    std::vector<std::tuple<std::size_t, std::size_t, double>> const pinned = {
+        {15, 0, 0.13170923639592755}, {15, 25, 0.54499713785803527}, {15, 49, 6.2464603648274464},
+        {25, 25, 2.4548431031998499}, {30, 0, 2.9878215739341982},   {30, 25, 3.8351793331874471},
+        {30, 49, 12.16474754758203}};
+    std::cout << "(s_idx, v_idx) : FDM | Pinned | Rel Diff\n";
+    double max_rel_diff{};
+    for (auto const &point : pinned)
+    {
+        const double value = solution(std::get<0>(point), std::get<1>(point));
+        const double rel_diff = std::abs(value - std::get<2>(point)) / std::abs(std::get<2>(point));
+        std::cout << "(" << std::get<0>(point) << ", " << std::get<1>(point) << ") : " << value << " | "
+                  << std::get<2>(point) << " | " << rel_diff << '\n';
+        max_rel_diff = std::max(max_rel_diff, rel_diff);
+    }
+    LSS_ASSERT(max_rel_diff < 1.0e-10, "Solution must match the pinned values");
+}
+
+void impl_heston_equation_thomas_lu_solver_crank_nicolson_parallel()
+{
+    using lss_pde_solvers::default_heat_solver_configs::host_bwd_tlusolver_cn_solver_config_ptr;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Heston Call equation: \n\n";
+    std::cout << " Using Thomas LU algo with implicit Crank-Nicolson method\n\n";
+    std::cout << " Line sweeps spread over 4 threads\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_t(s,v,t) = 0.5*v*s*s*U_ss(s,v,t) + 0.5*sig*sig*v*U_vv(s,v,t)"
+                 " + rho*sig*v*s*U_sv(s,v,t) + r*s*U_s(s,v,t)"
+                 " + [k*(theta-v)-lambda*v]*U_v(s,v,t) - r*U(s,v,t)\n\n";
+    std::cout << " where\n\n";
+    std::cout << " 0 < s < 20, 0 < v < 1, and 0 < t < 1,\n";
+    std::cout << " U(0,v,t) = 0 and  U_s(20,v,t) - 1 = 0, 0 < t < 1\n";
+    std::cout << " r*s*U_s(s,0,t)+k*theta*U_v(s,0,t)-rU(s,0,t)-U_t(s,0,t) = 0,"
+                 "0 < t < 1\n";
+    std::cout << " U(s,1,t) = s, 0 < t < 1\n";
+    std::cout << " U(s,v,T) = max(0,s - K), s in <0,20> \n\n";
+    std::cout << "============================================================\n";
+
+    // set up call option parameters:
+    auto const &strike = 10.0;
+    auto const &maturity = 1.0;
+    auto const &rate = 0.03;
+    auto const &sig_sig = 0.3;
+    auto const &sig_kappa = 2.0;
+    auto const &sig_theta = 0.2;
+    auto const &rho = 0.2;
+    // number of space subdivisions for spot:
+    std::size_t const Sd = 50;
+    // number of space subdivision for volatility:
+    std::size_t const Vd = 50;
+    // number of time subdivisions:
+    std::size_t const Td = 100;
+    // space Spot range:
+    auto const &spacex_range = std::make_shared<range>(0.0, 20.0);
+    // space Vol range:
+    auto const &spacey_range = std::make_shared<range>(0.0, 1.0);
+    // time range
+    auto const &time_range = std::make_shared<range>(0.0, maturity);
+    // discretization config:
+    auto const discretization_ptr =
+        std::make_shared<pde_discretization_config_2d>(spacex_range, spacey_range, Sd, Vd, time_range, Td);
+    // coeffs:
+    auto a = [=](double t, double s, double v) { return (0.5 * v * s * s); };
+    auto b = [=](double t, double s, double v) { return (0.5 * sig_sig * sig_sig * v); };
+    auto c = [=](double t, double s, double v) { return (rho * sig_sig * v * s); };
+    auto d = [=](double t, double s, double v) { return (rate * s); };
+    auto e = [=](double t, double s, double v) { return (sig_kappa * (sig_theta - v)); };
+    auto f = [=](double t, double s, double v) { return (-rate); };
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_2d>(a, b, c, d, e, f);
+    // terminal condition:
+    auto terminal_condition = [=](double s, double v) { return std::max(0.0, s - strike); };
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_2d>(terminal_condition);
+    // heat data config:
+    auto const heat_data_ptr = std::make_shared<heat_data_config_2d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    // horizontal spot boundary conditions:
+    auto const &dirichlet_low = [=](double t, double v) { return 0.0; };
+    auto const &neumann_high = [=](double t, double s) { return -1.0; };
+    auto const &boundary_low_ptr = std::make_shared<dirichlet_boundary_2d>(dirichlet_low);
+    auto const &boundary_high_ptr = std::make_shared<neumann_boundary_2d>(neumann_high);
+    auto const &horizontal_boundary_pair = std::make_pair(boundary_low_ptr, boundary_high_ptr);
+    // vertical upper vol boundary:
+    auto const &dirichlet_high = [=](double t, double s) { return s; };
+    auto const &vertical_upper_boundary_ptr = std::make_shared<dirichlet_boundary_2d>(dirichlet_high);
+    // splitting method configuration (4 threads sweeping the lines):
+    auto const &splitting_config_ptr =
+        std::make_shared<splitting_method_config>(splitting_method_enum::DouglasRachford, 0.5, 4);
+
+    // grid config:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_2d>(strike);
+
+    // initialize pde solver
+    heston_equation pdesolver(heat_data_ptr, discretization_ptr, vertical_upper_boundary_ptr, horizontal_boundary_pair,
+                              splitting_config_ptr, grid_config_hints_ptr, host_bwd_tlusolver_cn_solver_config_ptr);
+    // prepare container for solution:
+    container_2d<by_enum::Row> solution(Sd, Vd, double{});
+    // get the solution:
+    pdesolver.solve(solution);
+
+    print(discretization_ptr, grid_config_hints_ptr, solution);
+}
+
+void impl_heston_equation_thomas_lu_solver_crank_nicolson_shared_policy()
+{
+    using lss_pde_solvers::default_heat_solver_configs::host_bwd_tlusolver_cn_solver_config_ptr;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Heston Call equation: \n\n";
+    std::cout << " Using Thomas LU algo with implicit Crank-Nicolson method\n\n";
+    std::cout << " Two splitting methods sharing one pool of 4 threads\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_t(s,v,t) = 0.5*v*s*s*U_ss(s,v,t) + 0.5*sig*sig*v*U_vv(s,v,t)"
+                 " + rho*sig*v*s*U_sv(s,v,t) + r*s*U_s(s,v,t)"
+                 " + [k*(theta-v)-lambda*v]*U_v(s,v,t) - r*U(s,v,t)\n\n";
+    std::cout << " where\n\n";
+    std::cout << " 0 < s < 20, 0 < v < 1, and 0 < t < 1,\n";
+    std::cout << " U(0,v,t) = 0 and  U_s(20,v,t) - 1 = 0, 0 < t < 1\n";
+    std::cout << " r*s*U_s(s,0,t)+k*theta*U_v(s,0,t)-rU(s,0,t)-U_t(s,0,t) = 0,"
+                 "0 < t < 1\n";
+    std::cout << " U(s,1,t) = s, 0 < t < 1\n";
+    std::cout << " U(s,v,T) = max(0,s - K), s in <0,20> \n\n";
+    std::cout << "============================================================\n";
+
+    // set up call option parameters:
+    auto const &strike = 10.0;
+    auto const &maturity = 1.0;
+    auto const &rate = 0.03;
+    auto const &sig_sig = 0.3;
+    auto const &sig_kappa = 2.0;
+    auto const &sig_theta = 0.2;
+    auto const &rho = 0.2;
+    // number of space subdivisions for spot:
+    std::size_t const Sd = 50;
+    // number of space subdivision for volatility:
+    std::size_t const Vd = 50;
+    // number of time subdivisions:
+    std::size_t const Td = 100;
+    // space Spot range:
+    auto const &spacex_range = std::make_shared<range>(0.0, 20.0);
+    // space Vol range:
+    auto const &spacey_range = std::make_shared<range>(0.0, 1.0);
+    // time range
+    auto const &time_range = std::make_shared<range>(0.0, maturity);
+    // discretization config:
+    auto const discretization_ptr =
+        std::make_shared<pde_discretization_config_2d>(spacex_range, spacey_range, Sd, Vd, time_range, Td);
+    // coeffs:
+    auto a = [=](double t, double s, double v) { return (0.5 * v * s * s); };
+    auto b = [=](double t, double s, double v) { return (0.5 * sig_sig * sig_sig * v); };
+    auto c = [=](double t, double s, double v) { return (rho * sig_sig * v * s); };
+    auto d = [=](double t, double s, double v) { return (rate * s); };
+    auto e = [=](double t, double s, double v) { return (sig_kappa * (sig_theta - v)); };
+    auto f = [=](double t, double s, double v) { return (-rate); };
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_2d>(a, b, c, d, e, f);
+    // terminal condition:
+    auto terminal_condition = [=](double s, double v) { return std::max(0.0, s - strike); };
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_2d>(terminal_condition);
+    // heat data config:
+    auto const heat_data_ptr = std::make_shared<heat_data_config_2d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    // horizontal spot boundary conditions:
+    auto const &dirichlet_low = [=](double t, double v) { return 0.0; };
+    auto const &neumann_high = [=](double t, double s) { return -1.0; };
+    auto const &boundary_low_ptr = std::make_shared<dirichlet_boundary_2d>(dirichlet_low);
+    auto const &boundary_high_ptr = std::make_shared<neumann_boundary_2d>(neumann_high);
+    auto const &horizontal_boundary_pair = std::make_pair(boundary_low_ptr, boundary_high_ptr);
+    // vertical upper vol boundary:
+    auto const &dirichlet_high = [=](double t, double s) { return s; };
+    auto const &vertical_upper_boundary_ptr = std::make_shared<dirichlet_boundary_2d>(dirichlet_high);
+    // both solvers sweep their lines on the same 4 threads:
+    auto const &policy_ptr = std::make_shared<execution_policy>(4);
+    auto const &dr_splitting_config_ptr =
+        std::make_shared<splitting_method_config>(splitting_method_enum::DouglasRachford, 0.5);
+    auto const &cs_splitting_config_ptr =
+        std::make_shared<splitting_method_config>(splitting_method_enum::CraigSneyd, 0.5);
+
+    // grid config:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_2d>(strike);
+
+    // initialize pde solvers
+    heston_equation dr_pdesolver(heat_data_ptr, discretization_ptr, vertical_upper_boundary_ptr,
+                                 horizontal_boundary_pair, dr_splitting_config_ptr, grid_config_hints_ptr,
+                                 host_bwd_tlusolver_cn_solver_config_ptr, std::map<std::string, double>(), policy_ptr);
+    heston_equation cs_pdesolver(heat_data_ptr, discretization_ptr, vertical_upper_boundary_ptr,
+                                 horizontal_boundary_pair, cs_splitting_config_ptr, grid_config_hints_ptr,
+                                 host_bwd_tlusolver_cn_solver_config_ptr, std::map<std::string, double>(), policy_ptr);
+    // prepare containers for solutions:
+    container_2d<by_enum::Row> dr_solution(Sd, Vd, double{});
+    container_2d<by_enum::Row> cs_solution(Sd, Vd, double{});
+    // get the solutions:
+    dr_pdesolver.solve(dr_solution);
+    cs_pdesolver.solve(cs_solution);
+
+    print(discretization_ptr, grid_config_hints_ptr, dr_solution);
+    print(discretization_ptr, grid_config_hints_ptr, cs_solution);
+}
+
+void impl_heston_equation_thomas_lu_solver_crank_nicolson_tabulated()
+{
+    using lss_pde_solvers::default_heat_solver_configs::host_bwd_tlusolver_cn_solver_config_ptr;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Heston Call equation: \n\n";
+    std::cout << " Using Thomas LU algo with implicit Crank-Nicolson method\n\n";
+    std::cout << " Coefficients tabulated once (time-homogeneous)\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_t(s,v,t) = 0.5*v*s*s*U_ss(s,v,t) + 0.5*sig*sig*v*U_vv(s,v,t)"
+                 " + rho*sig*v*s*U_sv(s,v,t) + r*s*U_s(s,v,t)"
+                 " + [k*(theta-v)-lambda*v]*U_v(s,v,t) - r*U(s,v,t)\n\n";
+    std::cout << " where\n\n";
+    std::cout << " 0 < s < 20, 0 < v < 1, and 0 < t < 1,\n";
+    std::cout << " U(0,v,t) = 0 and  U_s(20,v,t) - 1 = 0, 0 < t < 1\n";
+    std::cout << " r*s*U_s(s,0,t)+k*theta*U_v(s,0,t)-rU(s,0,t)-U_t(s,0,t) = 0,"
+                 "0 < t < 1\n";
+    std::cout << " U(s,1,t) = s, 0 < t < 1\n";
+    std::cout << " U(s,v,T) = max(0,s - K), s in <0,20> \n\n";
+    std::cout << "============================================================\n";
+
+    // set up call option parameters:
+    auto const &strike = 10.0;
+    auto const &maturity = 1.0;
+    auto const &rate = 0.03;
+    auto const &sig_sig = 0.3;
+    auto const &sig_kappa = 2.0;
+    auto const &sig_theta = 0.2;
+    auto const &rho = 0.2;
+    // number of space subdivisions for spot:
+    std::size_t const Sd = 50;
+    // number of space subdivision for volatility:
+    std::size_t const Vd = 50;
+    // number of time subdivisions:
+    std::size_t const Td = 100;
+    // space Spot range:
+    auto const &spacex_range = std::make_shared<range>(0.0, 20.0);
+    // space Vol range:
+    auto const &spacey_range = std::make_shared<range>(0.0, 1.0);
+    // time range
+    auto const &time_range = std::make_shared<range>(0.0, maturity);
+    // discretization config:
+    auto const discretization_ptr =
+        std::make_shared<pde_discretization_config_2d>(spacex_range, spacey_range, Sd, Vd, time_range, Td);
+    // coeffs:
+    auto a = [=](double t, double s, double v) { return (0.5 * v * s * s); };
+    auto b = [=](double t, double s, double v) { return (0.5 * sig_sig * sig_sig * v); };
+    auto c = [=](double t, double s, double v) { return (rho * sig_sig * v * s); };
+    auto d = [=](double t, double s, double v) { return (rate * s); };
+    auto e = [=](double t, double s, double v) { return (sig_kappa * (sig_theta - v)); };
+    auto f = [=](double t, double s, double v) { return (-rate); };
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_2d>(a, b, c, d, e, f, true);
+    // terminal condition:
+    auto terminal_condition = [=](double s, double v) { return std::max(0.0, s - strike); };
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_2d>(terminal_condition);
+    // heat data config:
+    auto const heat_data_ptr = std::make_shared<heat_data_config_2d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    // horizontal spot boundary conditions:
+    auto const &dirichlet_low = [=](double t, double v) { return 0.0; };
+    auto const &neumann_high = [=](double t, double s) { return -1.0; };
+    auto const &boundary_low_ptr = std::make_shared<dirichlet_boundary_2d>(dirichlet_low);
+    auto const &boundary_high_ptr = std::make_shared<neumann_boundary_2d>(neumann_high);
+    auto const &horizontal_boundary_pair = std::make_pair(boundary_low_ptr, boundary_high_ptr);
+    // vertical upper vol boundary:
+    auto const &dirichlet_high = [=](double t, double s) { return s; };
+    auto const &vertical_upper_boundary_ptr = std::make_shared<dirichlet_boundary_2d>(dirichlet_high);
+    // splitting method configuration:
+    auto const &splitting_config_ptr =
+        std::make_shared<splitting_method_config>(splitting_method_enum::DouglasRachford, 0.5);
+
+    // grid config:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_2d>(strike);
+
+    // initialize pde solver
+    heston_equation pdesolver(heat_data_ptr, discretization_ptr, vertical_upper_boundary_ptr, horizontal_boundary_pair,
+                              splitting_config_ptr, grid_config_hints_ptr, host_bwd_tlusolver_cn_solver_config_ptr);
+    // prepare container for solution:
+    container_2d<by_enum::Row> solution(Sd, Vd, double{});
+    // get the solution:
+    pdesolver.solve(solution);
+
+    print(discretization_ptr, grid_config_hints_ptr, solution);
+}
+
+void impl_heston_equation_thomas_lu_solver_crank_nicolson_stats()
+{
+    using lss_pde_solvers::default_heat_solver_configs::host_bwd_tlusolver_cn_solver_config_ptr;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Heston Call equation: \n\n";
+    std::cout << " Using Thomas LU algo with implicit Crank-Nicolson method\n\n";
+    std::cout << " Reporting time spent in each phase of the solve\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_t(s,v,t) = 0.5*v*s*s*U_ss(s,v,t) + 0.5*sig*sig*v*U_vv(s,v,t)"
+                 " + rho*sig*v*s*U_sv(s,v,t) + r*s*U_s(s,v,t)"
+                 " + [k*(theta-v)-lambda*v]*U_v(s,v,t) - r*U(s,v,t)\n\n";
+    std::cout << " where\n\n";
+    std::cout << " 0 < s < 20, 0 < v < 1, and 0 < t < 1,\n";
+    std::cout << " U(0,v,t) = 0 and  U_s(20,v,t) - 1 = 0, 0 < t < 1\n";
+    std::cout << " r*s*U_s(s,0,t)+k*theta*U_v(s,0,t)-rU(s,0,t)-U_t(s,0,t) = 0,"
+                 "0 < t < 1\n";
+    std::cout << " U(s,1,t) = s, 0 < t < 1\n";
+    std::cout << " U(s,v,T) = max(0,s - K), s in <0,20> \n\n";
+    std::cout << "============================================================\n";
+
+    // set up call option parameters:
+    auto const &strike = 10.0;
+    auto const &maturity = 1.0;
+    auto const &rate = 0.03;
+    auto const &sig_sig = 0.3;
+    auto const &sig_kappa = 2.0;
+    auto const &sig_theta = 0.2;
+    auto const &rho = 0.2;
+    // number of space subdivisions for spot:
+    std::size_t const Sd = 50;
+    // number of space subdivision for volatility:
+    std::size_t const Vd = 50;
+    // number of time subdivisions:
+    std::size_t const Td = 100;
+    // space Spot range:
+    auto const &spacex_range = std::make_shared<range>(0.0, 20.0);
+    // space Vol range:
+    auto const &spacey_range = std::make_shared<range>(0.0, 1.0);
+    // time range
+    auto const &time_range = std::make_shared<range>(0.0, maturity);
+    // discretization config:
+    auto const discretization_ptr =
+        std::make_shared<pde_discretization_config_2d>(spacex_range, spacey_range, Sd, Vd, time_range, Td);
+    // coeffs:
+    auto a = [=](double t, double s, double v) { return (0.5 * v * s * s); };
+    auto b = [=](double t, double s, double v) { return (0.5 * sig_sig * sig_sig * v); };
+    auto c = [=](double t, double s, double v) { return (rho * sig_sig * v * s); };
+    auto d = [=](double t, double s, double v) { return (rate * s); };
+    auto e = [=](double t, double s, double v) { return (sig_kappa * (sig_theta - v)); };
+    auto f = [=](double t, double s, double v) { return (-rate); };
+    // coefficients do not depend on time, so line matrices change only with the time step:
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_2d>(a, b, c, d, e, f, true);
+    // terminal condition:
+    auto terminal_condition = [=](double s, double v) { return std::max(0.0, s - strike); };
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_2d>(terminal_condition);
+    // heat data config:
+    auto const heat_data_ptr = std::make_shared<heat_data_config_2d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    // horizontal spot boundary conditions:
+    auto const &dirichlet_low = [=](double t, double v) { return 0.0; };
+    auto const &neumann_high = [=](double t, double s) { return -1.0; };
+    auto const &boundary_low_ptr = std::make_shared<dirichlet_boundary_2d>(dirichlet_low);
+    auto const &boundary_high_ptr = std::make_shared<neumann_boundary_2d>(neumann_high);
+    auto const &horizontal_boundary_pair = std::make_pair(boundary_low_ptr, boundary_high_ptr);
+    // vertical upper vol boundary:
+    auto const &dirichlet_high = [=](double t, double s) { return s; };
+    auto const &vertical_upper_boundary_ptr = std::make_shared<dirichlet_boundary_2d>(dirichlet_high);
+    // splitting method configuration:
+    auto const &splitting_config_ptr =
+        std::make_shared<splitting_method_config>(splitting_method_enum::DouglasRachford, 0.5);
+
+    // grid config:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_2d>(strike);
+
+    // initialize pde solver
+    heston_equation pdesolver(heat_data_ptr, discretization_ptr, vertical_upper_boundary_ptr, horizontal_boundary_pair,
+                              splitting_config_ptr, grid_config_hints_ptr, host_bwd_tlusolver_cn_solver_config_ptr);
+    // prepare container for solution:
+    container_2d<by_enum::Row> solution(Sd, Vd, double{});
+    // get the solution:
+    pdesolver.solve(solution);
+
+    // phases are recorded only when the library is built with LSS_SOLVER_STATS:
+    auto const &stats = pdesolver.stats();
+    std::cout << "statistics enabled: " << std::boolalpha << solver_stats::is_enabled() << "\n";
+    std::cout << "total:              " << stats->seconds(solver_phase_enum::Total) << " s\n";
+    std::cout << "coefficients:       " << stats->seconds(solver_phase_enum::Coefficients) << " s\n";
+    std::cout << "right-hand side:    " << stats->seconds(solver_phase_enum::RightHandSide) << " s\n";
+    std::cout << "linear solve:       " << stats->seconds(solver_phase_enum::LinearSolve) << " s\n";
+    std::cout << "boundary solve:     " << stats->seconds(solver_phase_enum::BoundarySolve) << " s\n";
+    std::cout << "copy:               " << stats->seconds(solver_phase_enum::Copy) << " s\n";
+    std::cout << "linear systems:     " << stats->number_of_solves() << "\n";
+    std::cout << "factorizations:     " << stats->factorizations() << "\n";
+    LSS_ASSERT(!solver_stats::is_enabled() || (stats->factorizations() < stats->number_of_solves()),
+               "Line matrices of time-homogeneous data must reuse their factorizations");
+    std::cout << "bytes allocated:    " << stats->bytes_allocated() << "\n";
+    // statistics accumulate over solves until reset:
+    stats->reset();
+    pdesolver.solve(solution);
+    std::cout << "linear systems after reset and one more solve: " << stats->number_of_solves() << "\n";
+}
+
 void test_impl_heston_equation_thomas_lu_solver()
 {
     std::cout << "============================================================\n";
-    std::cout << "============ Implicit Hetson Equation (Dir BC) =============\n";
+    std::cout << "============ Implicit Hetson Equation (Dir BC) =============\n";
+    std::cout << "============================================================\n";
+
+    impl_heston_equation_thomas_lu_solver_crank_nicolson();
+    impl_heston_equation_thomas_lu_solver_crank_nicolson_parallel();
+    impl_heston_equation_thomas_lu_solver_crank_nicolson_tabulated();
+    impl_heston_equation_thomas_lu_solver_crank_nicolson_shared_policy();
+    impl_heston_equation_thomas_lu_solver_crank_nicolson_stats();
+    impl_heston_equation_thomas_lu_solver_crank_nicolson_pinned();
+
+    std::cout << "============================================================\n";
+}
+
+void impl_heston_equation_thomas_lu_solver_crank_nicolson_time_slices()
+{
+    using lss_pde_solvers::default_heat_solver_configs::host_bwd_tlusolver_cn_solver_config_ptr;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Heston Call equation: \n\n";
+    std::cout << " Using Thomas LU algo with implicit Crank-Nicolson method\n\n";
+    std::cout << " Streaming time slices to observers and storing the history\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_t(s,v,t) = 0.5*v*s*s*U_ss(s,v,t) + 0.5*sig*sig*v*U_vv(s,v,t)"
+                 " + rho*sig*v*s*U_sv(s,v,t) + r*s*U_s(s,v,t)"
+                 " + [k*(theta-v)-lambda*v]*U_v(s,v,t) - r*U(s,v,t)\n\n";
+    std::cout << " where\n\n";
+    std::cout << " 0 < s < 20, 0 < v < 1, and 0 < t < 1,\n";
+    std::cout << " U(0,v,t) = 0 and  U_s(20,v,t) - 1 = 0, 0 < t < 1\n";
+    std::cout << " r*s*U_s(s,0,t)+k*theta*U_v(s,0,t)-rU(s,0,t)-U_t(s,0,t) = 0,"
+                 "0 < t < 1\n";
+    std::cout << " U(s,1,t) = s, 0 < t < 1\n";
+    std::cout << " U(s,v,T) = max(0,s - K), s in <0,20> \n\n";
+    std::cout << "============================================================\n";
+
+    // set up call option parameters:
+    auto const &strike = 10.0;
+    auto const &maturity = 1.0;
+    auto const &rate = 0.03;
+    auto const &sig_sig = 0.3;
+    auto const &sig_kappa = 2.0;
+    auto const &sig_theta = 0.2;
+    auto const &rho = 0.2;
+    // number of space subdivisions for spot (differs from volatility, so that swapped axes are caught):
+    std::size_t const Sd = 40;
+    // number of space subdivision for volatility:
+    std::size_t const Vd = 30;
+    // number of time subdivisions:
+    std::size_t const Td = 50;
+    // space Spot range:
+    auto const &spacex_range = std::make_shared<range>(0.0, 20.0);
+    // space Vol range:
+    auto const &spacey_range = std::make_shared<range>(0.0, 1.0);
+    // time range
+    auto const &time_range = std::make_shared<range>(0.0, maturity);
+    // discretization config:
+    auto const discretization_ptr =
+        std::make_shared<pde_discretization_config_2d>(spacex_range, spacey_range, Sd, Vd, time_range, Td);
+    // coeffs:
+    auto a = [=](double t, double s, double v) { return (0.5 * v * s * s); };
+    auto b = [=](double t, double s, double v) { return (0.5 * sig_sig * sig_sig * v); };
+    auto c = [=](double t, double s, double v) { return (rho * sig_sig * v * s); };
+    auto d = [=](double t, double s, double v) { return (rate * s); };
+    auto e = [=](double t, double s, double v) { return (sig_kappa * (sig_theta - v)); };
+    auto f = [=](double t, double s, double v) { return (-rate); };
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_2d>(a, b, c, d, e, f);
+    // terminal condition:
+    auto terminal_condition = [=](double s, double v) { return std::max(0.0, s - strike); };
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_2d>(terminal_condition);
+    // heat data config:
+    auto const heat_data_ptr = std::make_shared<heat_data_config_2d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    // horizontal spot boundary conditions:
+    auto const &dirichlet_low = [=](double t, double v) { return 0.0; };
+    auto const &neumann_high = [=](double t, double s) { return -1.0; };
+    auto const &boundary_low_ptr = std::make_shared<dirichlet_boundary_2d>(dirichlet_low);
+    auto const &boundary_high_ptr = std::make_shared<neumann_boundary_2d>(neumann_high);
+    auto const &horizontal_boundary_pair = std::make_pair(boundary_low_ptr, boundary_high_ptr);
+    // vertical upper vol boundary:
+    auto const &dirichlet_high = [=](double t, double s) { return s; };
+    auto const &vertical_upper_boundary_ptr = std::make_shared<dirichlet_boundary_2d>(dirichlet_high);
+    // splitting method configuration:
+    auto const &splitting_config_ptr =
+        std::make_shared<splitting_method_config>(splitting_method_enum::DouglasRachford, 0.5);
+
+    // grid config:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_2d>(strike);
+
+    // initialize pde solver
+    heston_equation pdesolver(heat_data_ptr, discretization_ptr, vertical_upper_boundary_ptr, horizontal_boundary_pair,
+                              splitting_config_ptr, grid_config_hints_ptr, host_bwd_tlusolver_cn_solver_config_ptr);
+    // plain solve:
+    container_2d<by_enum::Row> solution(Sd, Vd, double{});
+    pdesolver.solve(solution);
+
+    // every slice is observed once, the terminal one included:
+    std::vector<std::size_t> all_indices;
+    auto const all_observer = std::make_shared<time_slice_observer_2d>(
+        [&](std::size_t time_idx, double time, container_2d<by_enum::Row> const &slice) {
+            all_indices.push_back(time_idx);
+        });
+    container_2d<by_enum::Row> all_solution(Sd, Vd, double{});
+    pdesolver.solve(all_solution, all_observer);
+    std::cout << "observed slices: " << all_indices.size() << " of " << Td << "\n";
+    LSS_ASSERT(all_indices.size() == Td, "Every time slice must be observed");
+
+    // every 10th time index is observed:
+    std::size_t const every = 10;
+    std::vector<std::size_t> every_indices;
+    auto const every_observer = std::make_shared<time_slice_observer_2d>(
+        [&](std::size_t time_idx, double time, container_2d<by_enum::Row> const &slice) {
+            every_indices.push_back(time_idx);
+        },
+        time_slice_decimation(every));
+    pdesolver.solve(all_solution, every_observer);
+    std::sort(every_indices.begin(), every_indices.end());
+    std::vector<std::size_t> expected_every;
+    for (std::size_t t = 0; t < Td; t += every)
+    {
+        expected_every.push_back(t);
+    }
+    std::cout << "slices observed every " << every << " steps: " << every_indices.size() << "\n";
+    LSS_ASSERT(every_indices == expected_every, "Only every 10th time slice must be observed");
+
+    // only listed time indices are observed, their slices are kept for the history check below:
+    std::vector<std::size_t> const listed = {0, 7, 25, Td - 1};
+    std::map<std::size_t, container_2d<by_enum::Row>> listed_slices;
+    auto const listed_observer = std::make_shared<time_slice_observer_2d>(
+        [&](std::size_t time_idx, double time, container_2d<by_enum::Row> const &slice) {
+            listed_slices.emplace(time_idx, slice);
+        },
+        time_slice_decimation(listed));
+    pdesolver.solve(all_solution, listed_observer);
+    std::cout << "listed slices observed: " << listed_slices.size() << " of " << listed.size() << "\n";
+    LSS_ASSERT(listed_slices.size() == listed.size(), "Every listed time slice must be observed once");
+    for (auto const t : listed)
+    {
+        LSS_ASSERT(listed_slices.count(t) == 1, "Listed time slice was not observed");
+    }
+
+    // history holds one row plane per time index, time index 0 is the final solution:
+    container_3d<by_enum::RowPlane> solutions(Td, Sd, Vd, double{});
+    pdesolver.solve(solutions);
+    double max_final_diff{};
+    double max_listed_diff{};
+    for (std::size_t r = 0; r < Sd; ++r)
+    {
+        for (std::size_t c = 0; c < Vd; ++c)
+        {
+            max_final_diff = std::max(max_final_diff, std::abs(solutions(0, r, c) - solution(r, c)));
+            for (auto const &listed_slice : listed_slices)
+            {
+                max_listed_diff = std::max(max_listed_diff, std::abs(solutions(listed_slice.first, r, c) -
+                                                                     listed_slice.second(r, c)));
+            }
+        }
+    }
+    std::cout << "max Abs Diff (last history slice vs solve): " << max_final_diff << "\n";
+    std::cout << "max Abs Diff (history vs observed slices): " << max_listed_diff << "\n";
+    LSS_ASSERT(max_final_diff == 0.0, "Last slice of the history must equal the final solution");
+    LSS_ASSERT(max_listed_diff == 0.0, "History must equal the observed slices");
+}
+
+void test_impl_heston_equation_time_slices()
+{
+    std::cout << "============================================================\n";
+    std::cout << "========= Implicit Hetson Equation Time Slices =============\n";
     std::cout << "============================================================\n";
 
-    impl_heston_equation_thomas_lu_solver_crank_nicolson();
+    impl_heston_equation_thomas_lu_solver_crank_nicolson_time_slices();
+
+    std::cout << "============================================================\n";
+}
+
+// ===========================================================================
+// ========================== EXPLICIT SOLVERS ===============================
+// ===========================================================================
+
+void expl_heston_equation_host_euler_threads()
+{
+    using lss_enumerations::explicit_pde_schemes_enum;
+    using lss_enumerations::grid_enum;
+    using lss_enumerations::memory_space_enum;
+    using lss_enumerations::traverse_direction_enum;
+    using lss_pde_solvers::heat_explicit_solver_config;
+    using lss_pde_solvers::two_dimensional::explicit_solvers::heston_equation;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Heston Call equation: \n\n";
+    std::cout << " Using Euler Explicit algo on 1 and on 4 threads\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_t(s,v,t) = 0.5*v*s*s*U_ss(s,v,t) + 0.5*sig*sig*v*U_vv(s,v,t)"
+                 " + rho*sig*v*s*U_sv(s,v,t) + r*s*U_s(s,v,t)"
+                 " + [k*(theta-v)-lambda*v]*U_v(s,v,t) - r*U(s,v,t)\n\n";
+    std::cout << " where\n\n";
+    std::cout << " 50 < s < 200, 0 < v < 1, and 0 < t < 1,\n";
+    std::cout << " U(50,v,t) = 0 and  U_s(200,v,t) - 1 = 0, 0 < t < 1\n";
+    std::cout << " r*s*U_s(s,0,t)+k*theta*U_v(s,0,t)-rU(s,0,t)-U_t(s,0,t) = 0,"
+                 "0 < t < 1\n";
+    std::cout << " U(s,1,t) = s, 0 < t < 1\n";
+    std::cout << " U(s,v,T) = max(0,s - K), s in <50,200> \n\n";
+    std::cout << "============================================================\n";
+
+    // set up call option parameters:
+    auto const &strike = 100.0;
+    auto const &maturity = 1.0;
+    auto const &rate = 0.03;
+    auto const &sig_sig = 0.3;
+    auto const &sig_kappa = 2.0;
+    auto const &sig_theta = 0.2;
+    auto const &rho = 0.8;
+    // number of space subdivisions for spot:
+    std::size_t const Sd = 50;
+    // number of space subdivision for volatility:
+    std::size_t const Vd = 30;
+    // number of time subdivisions:
+    std::size_t const Td = 8000;
+    // space Spot range:
+    auto const &spacex_range = std::make_shared<range>(50.0, 200.0);
+    // space Vol range:
+    auto const &spacey_range = std::make_shared<range>(0.0, 1.0);
+    // time range
+    auto const &time_range = std::make_shared<range>(0.0, maturity);
+    // discretization config:
+    auto const discretization_ptr =
+        std::make_shared<pde_discretization_config_2d>(spacex_range, spacey_range, Sd, Vd, time_range, Td);
+    // coeffs:
+    auto a = [=](double t, double s, double v) { return (0.5 * v * s * s); };
+    auto b = [=](double t, double s, double v) { return (0.5 * sig_sig * sig_sig * v); };
+    auto c = [=](double t, double s, double v) { return (rho * sig_sig * v * s); };
+    auto d = [=](double t, double s, double v) { return (rate * s); };
+    auto e = [=](double t, double s, double v) { return (sig_kappa * (sig_theta - v)); };
+    auto f = [=](double t, double s, double v) { return (-rate); };
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_2d>(a, b, c, d, e, f);
+    // terminal condition:
+    auto terminal_condition = [=](double s, double v) { return std::max(0.0, s - strike); };
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_2d>(terminal_condition);
+    // heat data config:
+    auto const heat_data_ptr = std::make_shared<heat_data_config_2d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    // horizontal spot boundary conditions:
+    auto const &dirichlet_low = [=](double t, double v) { return 0.0; };
+    auto const &neumann_high = [=](double t, double s) { return -1.0; };
+    auto const &boundary_low_ptr = std::make_shared<dirichlet_boundary_2d>(dirichlet_low);
+    auto const &boundary_high_ptr = std::make_shared<neumann_boundary_2d>(neumann_high);
+    auto const &horizontal_boundary_pair = std::make_pair(boundary_low_ptr, boundary_high_ptr);
+    // vertical upper vol boundary:
+    auto const &dirichlet_high = [=](double t, double s) { return s; };
+    auto const &vertical_upper_boundary_ptr = std::make_shared<dirichlet_boundary_2d>(dirichlet_high);
+    // grid config:
+    auto const alpha_scale = 3.;
+    auto const beta_scale = 50.;
+    auto const &grid_config_hints_ptr =
+        std::make_shared<grid_config_hints_2d>(strike, alpha_scale, beta_scale, grid_enum::Nonuniform);
+
+    // serial and threaded solver configs differ only in number of threads sweeping the rows:
+    auto const &serial_config_ptr = std::make_shared<heat_explicit_solver_config>(
+        memory_space_enum::Host, traverse_direction_enum::Backward, explicit_pde_schemes_enum::Euler, 1);
+    auto const &threaded_config_ptr = std::make_shared<heat_explicit_solver_config>(
+        memory_space_enum::Host, traverse_direction_enum::Backward, explicit_pde_schemes_enum::Euler, 4);
+
+    heston_equation serial_pdesolver(heat_data_ptr, discretization_ptr, vertical_upper_boundary_ptr,
+                                     horizontal_boundary_pair, grid_config_hints_ptr, serial_config_ptr);
+    container_2d<by_enum::Row> serial_solution(Sd, Vd, double{});
+    serial_pdesolver.solve(serial_solution);
+
+    heston_equation threaded_pdesolver(heat_data_ptr, discretization_ptr, vertical_upper_boundary_ptr,
+                                       horizontal_boundary_pair, grid_config_hints_ptr, threaded_config_ptr);
+    container_2d<by_enum::Row> threaded_solution(Sd, Vd, double{});
+    threaded_pdesolver.solve(threaded_solution);
+
+    print(discretization_ptr, grid_config_hints_ptr, threaded_solution);
+
+    // rows are split among threads but every grid point is computed by the same arithmetic:
+    double max_diff{};
+    for (std::size_t r = 0; r < Sd; ++r)
+    {
+        for (std::size_t c = 0; c < Vd; ++c)
+        {
+            max_diff = std::max(max_diff, std::abs(threaded_solution(r, c) - serial_solution(r, c)));
+        }
+    }
+    std::cout << "max Abs Diff (4 threads vs 1 thread): " << max_diff << '\n';
+    LSS_ASSERT(max_diff == 0.0, "Threaded solution must equal the serial solution");
+}
+
+void test_expl_heston_equation_host_euler_threads()
+{
+    std::cout << "============================================================\n";
+    std::cout << "====== Explicit Heston Equation (Euler, 1 vs 4 threads) ====\n";
+    std::cout << "============================================================\n";
+
+    expl_heston_equation_host_euler_threads();
+
+    std::cout << "============================================================\n";
+}
+
+void impl_heston_equation_sor_solver_crank_nicolson_threads()
+{
+    using lss_pde_solvers::default_heat_solver_configs::host_bwd_sorsolver_cn_solver_config_ptr;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Heston Call equation: \n\n";
+    std::cout << " Using SOR algo with implicit Crank-Nicolson method\n\n";
+    std::cout << " Line sweeps on 1 and on 4 threads\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_t(s,v,t) = 0.5*v*s*s*U_ss(s,v,t) + 0.5*sig*sig*v*U_vv(s,v,t)"
+                 " + rho*sig*v*s*U_sv(s,v,t) + r*s*U_s(s,v,t)"
+                 " + [k*(theta-v)-lambda*v]*U_v(s,v,t) - r*U(s,v,t)\n\n";
+    std::cout << " where\n\n";
+    std::cout << " 0 < s < 20, 0 < v < 1, and 0 < t < 1,\n";
+    std::cout << " U(0,v,t) = 0 and  U_s(20,v,t) - 1 = 0, 0 < t < 1\n";
+    std::cout << " r*s*U_s(s,0,t)+k*theta*U_v(s,0,t)-rU(s,0,t)-U_t(s,0,t) = 0,"
+                 "0 < t < 1\n";
+    std::cout << " U(s,1,t) = s, 0 < t < 1\n";
+    std::cout << " U(s,v,T) = max(0,s - K), s in <0,20> \n\n";
+    std::cout << "============================================================\n";
+
+    // set up call option parameters:
+    auto const &strike = 10.0;
+    auto const &maturity = 1.0;
+    auto const &rate = 0.03;
+    auto const &sig_sig = 0.3;
+    auto const &sig_kappa = 2.0;
+    auto const &sig_theta = 0.2;
+    auto const &rho = 0.2;
+    // number of space subdivisions for spot:
+    std::size_t const Sd = 50;
+    // number of space subdivision for volatility:
+    std::size_t const Vd = 50;
+    // number of time subdivisions:
+    std::size_t const Td = 100;
+    // space Spot range:
+    auto const &spacex_range = std::make_shared<range>(0.0, 20.0);
+    // space Vol range:
+    auto const &spacey_range = std::make_shared<range>(0.0, 1.0);
+    // time range
+    auto const &time_range = std::make_shared<range>(0.0, maturity);
+    // discretization config:
+    auto const discretization_ptr =
+        std::make_shared<pde_discretization_config_2d>(spacex_range, spacey_range, Sd, Vd, time_range, Td);
+    // coeffs:
+    auto a = [=](double t, double s, double v) { return (0.5 * v * s * s); };
+    auto b = [=](double t, double s, double v) { return (0.5 * sig_sig * sig_sig * v); };
+    auto c = [=](double t, double s, double v) { return (rho * sig_sig * v * s); };
+    auto d = [=](double t, double s, double v) { return (rate * s); };
+    auto e = [=](double t, double s, double v) { return (sig_kappa * (sig_theta - v)); };
+    auto f = [=](double t, double s, double v) { return (-rate); };
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_2d>(a, b, c, d, e, f);
+    // terminal condition:
+    auto terminal_condition = [=](double s, double v) { return std::max(0.0, s - strike); };
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_2d>(terminal_condition);
+    // heat data config:
+    auto const heat_data_ptr = std::make_shared<heat_data_config_2d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    // horizontal spot boundary conditions:
+    auto const &dirichlet_low = [=](double t, double v) { return 0.0; };
+    auto const &neumann_high = [=](double t, double s) { return -1.0; };
+    auto const &boundary_low_ptr = std::make_shared<dirichlet_boundary_2d>(dirichlet_low);
+    auto const &boundary_high_ptr = std::make_shared<neumann_boundary_2d>(neumann_high);
+    auto const &horizontal_boundary_pair = std::make_pair(boundary_low_ptr, boundary_high_ptr);
+    // vertical upper vol boundary:
+    auto const &dirichlet_high = [=](double t, double s) { return s; };
+    auto const &vertical_upper_boundary_ptr = std::make_shared<dirichlet_boundary_2d>(dirichlet_high);
+    // details:
+    std::map<std::string, double> details;
+    details["sor_omega"] = 1.0;
+    // grid config:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_2d>(strike);
+
+    auto solve = [&](splitting_method_enum splitting_method, std::size_t number_of_threads) {
+        auto const &splitting_config_ptr =
+            std::make_shared<splitting_method_config>(splitting_method, 0.5, number_of_threads);
+        heston_equation pdesolver(heat_data_ptr, discretization_ptr, vertical_upper_boundary_ptr,
+                                  horizontal_boundary_pair, splitting_config_ptr, grid_config_hints_ptr,
+                                  host_bwd_sorsolver_cn_solver_config_ptr, details);
+        container_2d<by_enum::Row> solution(Sd, Vd, double{});
+        pdesolver.solve(solution);
+        return solution;
+    };
+
+    for (auto const &splitting_method : {splitting_method_enum::DouglasRachford, splitting_method_enum::CraigSneyd})
+    {
+        auto const serial_solution = solve(splitting_method, 1);
+        auto const threaded_solution = solve(splitting_method, 4);
+        // every line starts its SOR iteration from its own previous solution whichever worker sweeps it:
+        double max_diff{};
+        for (std::size_t r = 0; r < Sd; ++r)
+        {
+            for (std::size_t c = 0; c < Vd; ++c)
+            {
+                max_diff = std::max(max_diff, std::abs(threaded_solution(r, c) - serial_solution(r, c)));
+            }
+        }
+        std::cout << "max Abs Diff (4 threads vs 1 thread): " << max_diff << '\n';
+        LSS_ASSERT(max_diff == 0.0, "Threaded solution must equal the serial solution");
+    }
+}
+
+void test_impl_heston_equation_sor_solver_threads()
+{
+    std::cout << "============================================================\n";
+    std::cout << "======= Implicit Heston Equation (SOR, 1 vs 4 threads) =====\n";
+    std::cout << "============================================================\n";
+
+    impl_heston_equation_sor_solver_crank_nicolson_threads();
+
+    std::cout << "============================================================\n";
+}
+
+void bench_heston_equation_adi_sweeps_grid_size()
+{
+    using lss_pde_solvers::default_heat_solver_configs::host_bwd_tlusolver_cn_solver_config_ptr;
+
+    std::cout << "============================================================\n";
+    std::cout << "Timing Douglas-Rachford sweeps of Heston Call equation: \n\n";
+    std::cout << " Using Thomas LU algo with implicit Crank-Nicolson method\n\n";
+    std::cout << " Second sweep reads the intermediate solution after the\n";
+    std::cout << " tiled transpose from column-wise into row-wise layout\n\n";
+    std::cout << "============================================================\n";
+
+    auto const &strike = 10.0;
+    auto const &maturity = 1.0;
+    auto const &rate = 0.03;
+    auto const &sig_sig = 0.3;
+    auto const &sig_kappa = 2.0;
+    auto const &sig_theta = 0.2;
+    auto const &rho = 0.2;
+    // number of time subdivisions:
+    std::size_t const Td = 20;
+    // coeffs:
+    auto a = [=](double t, double s, double v) { return (0.5 * v * s * s); };
+    auto b = [=](double t, double s, double v) { return (0.5 * sig_sig * sig_sig * v); };
+    auto c = [=](double t, double s, double v) { return (rho * sig_sig * v * s); };
+    auto d = [=](double t, double s, double v) { return (rate * s); };
+    auto e = [=](double t, double s, double v) { return (sig_kappa * (sig_theta - v)); };
+    auto f = [=](double t, double s, double v) { return (-rate); };
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_2d>(a, b, c, d, e, f);
+    auto terminal_condition = [=](double s, double v) { return std::max(0.0, s - strike); };
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_2d>(terminal_condition);
+    auto const heat_data_ptr = std::make_shared<heat_data_config_2d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    auto const &boundary_low_ptr = std::make_shared<dirichlet_boundary_2d>([=](double t, double v) { return 0.0; });
+    auto const &boundary_high_ptr = std::make_shared<neumann_boundary_2d>([=](double t, double s) { return -1.0; });
+    auto const &horizontal_boundary_pair = std::make_pair(boundary_low_ptr, boundary_high_ptr);
+    auto const &vertical_upper_boundary_ptr =
+        std::make_shared<dirichlet_boundary_2d>([=](double t, double s) { return s; });
+    auto const &splitting_config_ptr =
+        std::make_shared<splitting_method_config>(splitting_method_enum::DouglasRachford, 0.5);
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_2d>(strike);
+    auto const &spacex_range = std::make_shared<range>(0.0, 20.0);
+    auto const &spacey_range = std::make_shared<range>(0.0, 1.0);
+    auto const &time_range = std::make_shared<range>(0.0, maturity);
+
+    std::cout << "grid size, solve per time step [ms], transpose element-wise [ms], transpose tiled [ms]\n";
+    for (std::size_t const size : {50, 100, 200, 400, 800, 1600})
+    {
+        auto const discretization_ptr =
+            std::make_shared<pde_discretization_config_2d>(spacex_range, spacey_range, size, size, time_range, Td);
+        heston_equation pdesolver(heat_data_ptr, discretization_ptr, vertical_upper_boundary_ptr,
+                                  horizontal_boundary_pair, splitting_config_ptr, grid_config_hints_ptr,
+                                  host_bwd_tlusolver_cn_solver_config_ptr);
+        container_2d<by_enum::Row> solution(size, size, double{});
+        auto start = std::chrono::steady_clock::now();
+        pdesolver.solve(solution);
+        auto end = std::chrono::steady_clock::now();
+        const double solve_ms = std::chrono::duration<double, std::milli>(end - start).count() / Td;
+
+        // conversion between the two sweeps in isolation:
+        container_2d<by_enum::Column> inter_solution(solution);
+        container_2d<by_enum::Row> inter_solution_r(size, size, double{});
+        start = std::chrono::steady_clock::now();
+        for (std::size_t r = 0; r < size; ++r)
+        {
+            for (std::size_t c = 0; c < size; ++c)
+            {
+                inter_solution_r(r, c, inter_solution(r, c));
+            }
+        }
+        end = std::chrono::steady_clock::now();
+        const double naive_ms = std::chrono::duration<double, std::milli>(end - start).count();
+        start = std::chrono::steady_clock::now();
+        inter_solution_r = inter_solution;
+        end = std::chrono::steady_clock::now();
+        const double tiled_ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+        std::cout << size << ", " << solve_ms << ", " << naive_ms << ", " << tiled_ms << "\n";
+    }
+}
+
+void test_bench_heston_equation_adi_sweeps()
+{
+    std::cout << "============================================================\n";
+    std::cout << "========= Heston ADI sweeps timing against grid size =======\n";
+    std::cout << "============================================================\n";
+
+    bench_heston_equation_adi_sweeps_grid_size();
 
     std::cout << "============================================================\n";
 }
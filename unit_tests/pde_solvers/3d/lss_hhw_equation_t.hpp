@@ -8,7 +8,10 @@
 #include "../../../common/lss_range.hpp"
 #include "../../../containers/lss_container_3d.hpp"
 #include "pde_solvers/experimental/3d/heat_type/lss_hhw_equation.hpp"
+#include <algorithm>
+#include <cmath>
 #include <map>
+#include <tuple>
 
 using lss_boundary::dirichlet_boundary_3d;
 using lss_boundary::neumann_boundary_3d;
@@ -269,6 +272,122 @@ void impl_hhw_equation_thomas_lu_solver_crank_nicolson()
     print(discretization_ptr, grid_config_hints_ptr, solution);
 }
 
+container_3d<by_enum::RowPlane> impl_hhw_equation_thomas_lu_solver_crank_nicolson_splitting(
+    splitting_method_enum splitting_method, std::string const &splitting_name, double weighting_value = 0.5,
+    std::size_t number_of_threads = 1)
+{
+    using lss_pde_solvers::default_heat_solver_configs::host_bwd_tlusolver_cn_solver_config_ptr;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Heston-Hull-White Call equation: \n\n";
+    std::cout << "Using Thomas LU algo with implicit Crank-Nicolson method\n";
+    std::cout << "Using " << splitting_name << " splitting method on " << number_of_threads << " thread(s)\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_t(t,s,v,r) = 0.5*s*s*v*U_ss(t,s,v,r) +"
+                 "0.5*vol_1*vol_1*v*U_vv(t,s,v,r) +"
+                 "0.5*vol_2*vol_2*U_rr(t,s,v,r) + "
+                 "rho_12*vol_1*s*v*U_sv(t,s,v,r) + "
+                 "rho_13*vol_2*s*sqrt(v)*U_sr(t,s,v,r) + "
+                 "rho_23*vol_1*vol_2*sqrt(v)*U_vr(t,s,v,r) + "
+                 "r*s*U_s(t,s,v,r) + [k*(theta-v)-lambda*v]*U_v(t,s,v,r) +"
+                 "a*(b-r)*U_r(t,s,v,r) - r*U(t,s,v,r)\n\n";
+    std::cout << " where\n\n";
+    std::cout << " 0 < s < 20, 0 < v < 1,-1 < r < 1, and 0 < t < 1,\n";
+    std::cout << " U(t,0,v,r) = 0 and  U_s(t,20,v,r) - 1 = 0, 0 < t < 1\n";
+    std::cout << " 0.5*vol_2*vol_2*U_rr(t,s,0,r) + r*s*U_s(t,s,0,r) + "
+                 "k*theta*U_v(t,s,0,r) + a*(b-r)*U_r(t,s,0,r) - "
+                 "rU(t,s,0,r) - U_t(t,s,0,r) = 0,"
+                 "0 < t < 1\n";
+    std::cout << " U(t,s,1,r) = s, 0 < t < 1\n";
+    std::cout << " U_r(t,s,v,-1) = 0 and  U_r(t,s,v,1) = 0, 0 < t < 1\n";
+    std::cout << " U(T,s,v,r) = max(0,s - K), s in <0,20> \n\n";
+    std::cout << "============================================================\n";
+
+    // set up call option parameters:
+    auto const &strike = 100.0;
+    auto const &maturity = 1.0;
+    auto const &v_sig = 0.8;
+    auto const &v_kappa = 3.0;
+    auto const &v_theta = 0.2;
+    auto const &rho_12 = 0.6;
+    auto const &rho_13 = 0.2;
+    auto const &rho_23 = 0.4;
+    auto const &c_1 = 0.3;
+    auto const &c_2 = 0.01;
+    auto const &c_3 = 0.02;
+    auto const &r_a = 0.2;
+    auto const &r_sig = 0.05;
+    // number of space subdivisions for spot:
+    std::size_t const Sd = 30;
+    // number of space subdivision for volatility:
+    std::size_t const Vd = 18;
+    // number of space subdivision for rate:
+    std::size_t const Rd = 18;
+    // number of time subdivisions (correctors allow coarser steps than Douglas-Rachford):
+    std::size_t const Td = 200;
+    // space Spot range:
+    auto const &spacex_range = std::make_shared<range>(50.0, 200.0);
+    // space Vol range:
+    auto const &spacey_range = std::make_shared<range>(0.0, 1.0);
+    // space Rate range:
+    auto const &spacez_range = std::make_shared<range>(0.12, 0.21);
+    // time range
+    auto const &time_range = std::make_shared<range>(0.0, maturity);
+    // discretization config:
+    auto const discretization_ptr = std::make_shared<pde_discretization_config_3d>(
+        spacex_range, spacey_range, spacez_range, Sd, Vd, Rd, time_range, Td);
+    // coeffs:
+    auto B = [=](double t) { return (c_1 - c_2 * std::exp(-c_3 * (maturity - t))); };
+    auto a = [=](double t, double s, double v, double r) { return (0.5 * v * s * s); };
+    auto b = [=](double t, double s, double v, double r) { return (0.5 * v_sig * v_sig * v); };
+    auto c = [=](double t, double s, double v, double r) { return (0.5 * r_sig * r_sig); };
+    auto d = [=](double t, double s, double v, double r) { return (rho_12 * v_sig * s * v); };
+    auto e = [=](double t, double s, double v, double r) { return (rho_13 * r_sig * s * sqrt(v)); };
+    auto f = [=](double t, double s, double v, double r) { return (rho_23 * v_sig * r_sig * sqrt(v)); };
+    auto g = [=](double t, double s, double v, double r) { return (r * s); };
+    auto h = [=](double t, double s, double v, double r) { return (v_kappa * (v_theta - v)); };
+    auto i = [=](double t, double s, double v, double r) { return (r_a * (B(t) - r)); };
+    auto j = [=](double t, double s, double v, double r) { return (-r); };
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_3d>(a, b, c, d, e, f, g, h, i, j);
+    // terminal condition:
+    auto terminal_condition = [=](double s, double v, double r) { return std::max(0.0, s - strike); };
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_3d>(terminal_condition);
+    // heat data config:
+    auto const heat_data_ptr = std::make_shared<heat_data_config_3d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    // spot boundary conditions:
+    auto const &dirichlet_s = [=](double t, double v, double r) { return 0.0; };
+    auto const &neumann_s = [=](double t, double v, double r) { return -1.0; };
+    auto const &boundary_low_s_ptr = std::make_shared<dirichlet_boundary_3d>(dirichlet_s);
+    auto const &boundary_high_s_ptr = std::make_shared<neumann_boundary_3d>(neumann_s);
+    auto const &x_boundary_pair = std::make_pair(boundary_low_s_ptr, boundary_high_s_ptr);
+    //  upper vol boundary:
+    auto const &dirichlet_v = [=](double t, double s, double r) { return s; };
+    auto const &y_upper_boundary_ptr = std::make_shared<dirichlet_boundary_3d>(dirichlet_v);
+    // rate boundary conditions:
+    auto const &neumann_low_r = [=](double t, double s, double v) { return 0.0; };
+    auto const &neumann_high_r = [=](double t, double s, double v) { return 0.0; };
+    auto const &boundary_low_r_ptr = std::make_shared<neumann_boundary_3d>(neumann_low_r);
+    auto const &boundary_high_r_ptr = std::make_shared<neumann_boundary_3d>(neumann_high_r);
+    auto const &z_boundary_pair = std::make_pair(boundary_low_r_ptr, boundary_high_r_ptr);
+    // splitting method configuration:
+    auto const &splitting_config_ptr =
+        std::make_shared<splitting_method_config>(splitting_method, weighting_value, number_of_threads);
+
+    // grid config:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_3d>(strike);
+
+    // initialize pde solver
+    hhw_equation pdesolver(heat_data_ptr, discretization_ptr, x_boundary_pair, y_upper_boundary_ptr, z_boundary_pair,
+                           splitting_config_ptr, grid_config_hints_ptr, host_bwd_tlusolver_cn_solver_config_ptr);
+    // prepare container for solution:
+    container_3d<by_enum::RowPlane> solution(Sd, Vd, Rd, double{});
+    // get the solution:
+    pdesolver.solve(solution);
+
+    print(discretization_ptr, grid_config_hints_ptr, solution);
+    return solution;
+}
+
 void impl_hhw_equation_dsssolver_solver_crank_nicolson()
 {
     using lss_pde_solvers::default_heat_solver_configs::host_bwd_dssolver_cn_solver_config_ptr;
@@ -393,4 +512,241 @@ void test_impl_hhw_equation_tlu_dss_solver()
     std::cout << "============================================================\n";
 }
 
+void test_impl_hhw_equation_tlu_splitting_methods()
+{
+    std::cout << "============================================================\n";
+    std::cout << "========== Implicit HHW Equation (Splitting methods) =======\n";
+    std::cout << "============================================================\n";
+
+    auto const dr_solution = impl_hhw_equation_thomas_lu_solver_crank_nicolson_splitting(
+        splitting_method_enum::DouglasRachford, "Douglas-Rachford");
+    // with the weighting equal to the Crank-Nicolson theta the modified Craig-Sneyd correction vanishes,
+    // so it is run with weighting 1/3 to actually exercise it:
+    std::vector<std::tuple<splitting_method_enum, std::string, double>> const splittings = {
+        {splitting_method_enum::CraigSneyd, "Craig-Sneyd", 0.5},
+        {splitting_method_enum::ModifiedCraigSneyd, "Modified Craig-Sneyd", 1.0 / 3.0},
+        {splitting_method_enum::HundsdorferVerwer, "Hundsdorfer-Verwer", 0.5}};
+    for (auto const &splitting : splittings)
+    {
+        auto const solution = impl_hhw_equation_thomas_lu_solver_crank_nicolson_splitting(
+            std::get<0>(splitting), std::get<1>(splitting), std::get<2>(splitting));
+        double max_diff{};
+        double max_value{};
+        for (std::size_t r = 0; r < solution.rows(); ++r)
+        {
+            for (std::size_t c = 0; c < solution.columns(); ++c)
+            {
+                for (std::size_t l = 0; l < solution.layers(); ++l)
+                {
+                    max_diff = std::max(max_diff, std::abs(solution(r, c, l) - dr_solution(r, c, l)));
+                    max_value = std::max(max_value, std::abs(dr_solution(r, c, l)));
+                }
+            }
+        }
+        std::cout << std::get<1>(splitting) << " vs Douglas-Rachford: max Abs Diff " << max_diff << " (max value "
+                  << max_value << ")\n";
+        LSS_ASSERT(max_diff < 2.5e-3 * max_value, "Splitting method must agree with Douglas-Rachford");
+    }
+
+    std::cout << "============================================================\n";
+}
+
+void test_impl_hhw_equation_tlu_douglas_rachford_pinned()
+{
+    std::cout << "============================================================\n";
+    std::cout << "====== Implicit HHW Equation (Douglas-Rachford pinned) =====\n";
+    std::cout << "============================================================\n";
+
+    auto const solution = impl_hhw_equation_thomas_lu_solver_crank_nicolson_splitting(
+        splitting_method_enum::DouglasRachford, "Douglas-Rachford");
+    // interior points and points on the boundary planes written through line views:
+    std::vector<std::tuple<std::size_t, std::size_t, std::size_t, double>> const pinned = {
+        {5, 5, 5, 10.906682006371147},   {13, 0, 8, 4.5600708416587832},   {13, 8, 0, 36.783510762700509},
+        {13, 8, 17, 37.776779786501947}, {13, 13, 17, 50.260575866241766}, {20, 0, 0, 6.0223673430606652},
+        {20, 10, 3, 68.449396328700587}, {25, 15, 8, 123.77699503513021}};
+    std::cout << "(s_idx, v_idx, r_idx) : FDM | Pinned | Rel Diff\n";
+    double max_rel_diff{};
+    for (auto const &point : pinned)
+    {
+        const double value = solution(std::get<0>(point), std::get<1>(point), std::get<2>(point));
+        const double rel_diff = std::abs(value - std::get<3>(point)) / std::abs(std::get<3>(point));
+        std::cout << "(" << std::get<0>(point) << ", " << std::get<1>(point) << ", " << std::get<2>(point)
+                  << ") : " << value << " | " << std::get<3>(point) << " | " << rel_diff << '\n';
+        max_rel_diff = std::max(max_rel_diff, rel_diff);
+    }
+    LSS_ASSERT(max_rel_diff < 1.0e-10, "Solution must match the pinned values");
+
+    std::cout << "============================================================\n";
+}
+
+void test_impl_hhw_equation_tlu_douglas_rachford_threads()
+{
+    std::cout << "============================================================\n";
+    std::cout << "===== Implicit HHW Equation (Douglas-Rachford threads) =====\n";
+    std::cout << "============================================================\n";
+
+    auto const serial_solution = impl_hhw_equation_thomas_lu_solver_crank_nicolson_splitting(
+        splitting_method_enum::DouglasRachford, "Douglas-Rachford", 0.5, 1);
+    auto const threaded_solution = impl_hhw_equation_thomas_lu_solver_crank_nicolson_splitting(
+        splitting_method_enum::DouglasRachford, "Douglas-Rachford", 0.5, 4);
+    // every line is solved by the same arithmetic whichever worker sweeps it:
+    double max_diff{};
+    for (std::size_t r = 0; r < serial_solution.rows(); ++r)
+    {
+        for (std::size_t c = 0; c < serial_solution.columns(); ++c)
+        {
+            for (std::size_t l = 0; l < serial_solution.layers(); ++l)
+            {
+                max_diff = std::max(max_diff, std::abs(threaded_solution(r, c, l) - serial_solution(r, c, l)));
+            }
+        }
+    }
+    std::cout << "max Abs Diff (4 threads vs 1 thread): " << max_diff << '\n';
+    LSS_ASSERT(max_diff == 0.0, "Threaded solution must equal the serial solution");
+
+    std::cout << "============================================================\n";
+}
+
+void impl_hhw_equation_sor_solver_crank_nicolson_threads()
+{
+    using lss_pde_solvers::default_heat_solver_configs::host_bwd_sorsolver_cn_solver_config_ptr;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving Boundary-value Heston-Hull-White Call equation: \n\n";
+    std::cout << "Using SOR algo with implicit Crank-Nicolson method\n";
+    std::cout << "Using Douglas-Rachford splitting method on 1 and on 4 threads\n\n";
+    std::cout << " Value type: " << typeid(double).name() << "\n\n";
+    std::cout << " U_t(t,s,v,r) = 0.5*s*s*v*U_ss(t,s,v,r) +"
+                 "0.5*vol_1*vol_1*v*U_vv(t,s,v,r) +"
+                 "0.5*vol_2*vol_2*U_rr(t,s,v,r) + "
+                 "rho_12*vol_1*s*v*U_sv(t,s,v,r) + "
+                 "rho_13*vol_2*s*sqrt(v)*U_sr(t,s,v,r) + "
+                 "rho_23*vol_1*vol_2*sqrt(v)*U_vr(t,s,v,r) + "
+                 "r*s*U_s(t,s,v,r) + [k*(theta-v)-lambda*v]*U_v(t,s,v,r) +"
+                 "a*(b-r)*U_r(t,s,v,r) - r*U(t,s,v,r)\n\n";
+    std::cout << " where\n\n";
+    std::cout << " 0 < s < 20, 0 < v < 1,-1 < r < 1, and 0 < t < 1,\n";
+    std::cout << " U(t,0,v,r) = 0 and  U_s(t,20,v,r) - 1 = 0, 0 < t < 1\n";
+    std::cout << " 0.5*vol_2*vol_2*U_rr(t,s,0,r) + r*s*U_s(t,s,0,r) + "
+                 "k*theta*U_v(t,s,0,r) + a*(b-r)*U_r(t,s,0,r) - "
+                 "rU(t,s,0,r) - U_t(t,s,0,r) = 0,"
+                 "0 < t < 1\n";
+    std::cout << " U(t,s,1,r) = s, 0 < t < 1\n";
+    std::cout << " U_r(t,s,v,-1) = 0 and  U_r(t,s,v,1) = 0, 0 < t < 1\n";
+    std::cout << " U(T,s,v,r) = max(0,s - K), s in <0,20> \n\n";
+    std::cout << "============================================================\n";
+
+    // set up call option parameters:
+    auto const &strike = 100.0;
+    auto const &maturity = 1.0;
+    auto const &v_sig = 0.8;
+    auto const &v_kappa = 3.0;
+    auto const &v_theta = 0.2;
+    auto const &rho_12 = 0.6;
+    auto const &rho_13 = 0.2;
+    auto const &rho_23 = 0.4;
+    auto const &c_1 = 0.3;
+    auto const &c_2 = 0.01;
+    auto const &c_3 = 0.02;
+    auto const &r_a = 0.2;
+    auto const &r_sig = 0.05;
+    // number of space subdivisions for spot:
+    std::size_t const Sd = 30;
+    // number of space subdivision for volatility:
+    std::size_t const Vd = 18;
+    // number of space subdivision for rate:
+    std::size_t const Rd = 18;
+    // number of time subdivisions:
+    std::size_t const Td = 100;
+    // space Spot range:
+    auto const &spacex_range = std::make_shared<range>(50.0, 200.0);
+    // space Vol range:
+    auto const &spacey_range = std::make_shared<range>(0.0, 1.0);
+    // space Rate range:
+    auto const &spacez_range = std::make_shared<range>(0.12, 0.21);
+    // time range
+    auto const &time_range = std::make_shared<range>(0.0, maturity);
+    // discretization config:
+    auto const discretization_ptr = std::make_shared<pde_discretization_config_3d>(
+        spacex_range, spacey_range, spacez_range, Sd, Vd, Rd, time_range, Td);
+    // coeffs:
+    auto B = [=](double t) { return (c_1 - c_2 * std::exp(-c_3 * (maturity - t))); };
+    auto a = [=](double t, double s, double v, double r) { return (0.5 * v * s * s); };
+    auto b = [=](double t, double s, double v, double r) { return (0.5 * v_sig * v_sig * v); };
+    auto c = [=](double t, double s, double v, double r) { return (0.5 * r_sig * r_sig); };
+    auto d = [=](double t, double s, double v, double r) { return (rho_12 * v_sig * s * v); };
+    auto e = [=](double t, double s, double v, double r) { return (rho_13 * r_sig * s * sqrt(v)); };
+    auto f = [=](double t, double s, double v, double r) { return (rho_23 * v_sig * r_sig * sqrt(v)); };
+    auto g = [=](double t, double s, double v, double r) { return (r * s); };
+    auto h = [=](double t, double s, double v, double r) { return (v_kappa * (v_theta - v)); };
+    auto i = [=](double t, double s, double v, double r) { return (r_a * (B(t) - r)); };
+    auto j = [=](double t, double s, double v, double r) { return (-r); };
+    auto const heat_coeffs_data_ptr = std::make_shared<heat_coefficient_data_config_3d>(a, b, c, d, e, f, g, h, i, j);
+    // terminal condition:
+    auto terminal_condition = [=](double s, double v, double r) { return std::max(0.0, s - strike); };
+    auto const heat_init_data_ptr = std::make_shared<heat_initial_data_config_3d>(terminal_condition);
+    // heat data config:
+    auto const heat_data_ptr = std::make_shared<heat_data_config_3d>(heat_coeffs_data_ptr, heat_init_data_ptr);
+    // spot boundary conditions:
+    auto const &dirichlet_s = [=](double t, double v, double r) { return 0.0; };
+    auto const &neumann_s = [=](double t, double v, double r) { return -1.0; };
+    auto const &boundary_low_s_ptr = std::make_shared<dirichlet_boundary_3d>(dirichlet_s);
+    auto const &boundary_high_s_ptr = std::make_shared<neumann_boundary_3d>(neumann_s);
+    auto const &x_boundary_pair = std::make_pair(boundary_low_s_ptr, boundary_high_s_ptr);
+    //  upper vol boundary:
+    auto const &dirichlet_v = [=](double t, double s, double r) { return s; };
+    auto const &y_upper_boundary_ptr = std::make_shared<dirichlet_boundary_3d>(dirichlet_v);
+    // rate boundary conditions:
+    auto const &neumann_low_r = [=](double t, double s, double v) { return 0.0; };
+    auto const &neumann_high_r = [=](double t, double s, double v) { return 0.0; };
+    auto const &boundary_low_r_ptr = std::make_shared<neumann_boundary_3d>(neumann_low_r);
+    auto const &boundary_high_r_ptr = std::make_shared<neumann_boundary_3d>(neumann_high_r);
+    auto const &z_boundary_pair = std::make_pair(boundary_low_r_ptr, boundary_high_r_ptr);
+    // details:
+    std::map<std::string, double> details;
+    details["sor_omega"] = 1.0;
+    // grid config:
+    auto const &grid_config_hints_ptr = std::make_shared<grid_config_hints_3d>(strike);
+
+    auto solve = [&](std::size_t number_of_threads) {
+        auto const &splitting_config_ptr = std::make_shared<splitting_method_config>(
+            splitting_method_enum::DouglasRachford, 0.5, number_of_threads);
+        hhw_equation pdesolver(heat_data_ptr, discretization_ptr, x_boundary_pair, y_upper_boundary_ptr,
+                               z_boundary_pair, splitting_config_ptr, grid_config_hints_ptr,
+                               host_bwd_sorsolver_cn_solver_config_ptr, details);
+        container_3d<by_enum::RowPlane> solution(Sd, Vd, Rd, double{});
+        pdesolver.solve(solution);
+        return solution;
+    };
+
+    auto const serial_solution = solve(1);
+    auto const threaded_solution = solve(4);
+    print(discretization_ptr, grid_config_hints_ptr, threaded_solution);
+    // every line starts its SOR iteration from its own previous solution whichever worker sweeps it:
+    double max_diff{};
+    for (std::size_t r = 0; r < Sd; ++r)
+    {
+        for (std::size_t c = 0; c < Vd; ++c)
+        {
+            for (std::size_t l = 0; l < Rd; ++l)
+            {
+                max_diff = std::max(max_diff, std::abs(threaded_solution(r, c, l) - serial_solution(r, c, l)));
+            }
+        }
+    }
+    std::cout << "max Abs Diff (4 threads vs 1 thread): " << max_diff << '\n';
+    LSS_ASSERT(max_diff == 0.0, "Threaded solution must equal the serial solution");
+}
+
+void test_impl_hhw_equation_sor_solver_threads()
+{
+    std::cout << "============================================================\n";
+    std::cout << "========= Implicit HHW Equation (SOR, 1 vs 4 threads) ======\n";
+    std::cout << "============================================================\n";
+
+    impl_hhw_equation_sor_solver_crank_nicolson_threads();
+
+    std::cout << "============================================================\n";
+}
+
 #endif //_LSS_HHW_EQUATION_T_HPP_
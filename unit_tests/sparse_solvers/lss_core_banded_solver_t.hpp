@@ -0,0 +1,212 @@
+#pragma once
+#if !defined(_LSS_CORE_BANDED_SOLVER_T_HPP_)
+#define _LSS_CORE_BANDED_SOLVER_T_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+#include "../../boundaries/lss_dirichlet_boundary.hpp"
+#include "../../common/lss_enumerations.hpp"
+#include "../../common/lss_macros.hpp"
+#include "../../common/lss_utility.hpp"
+#include "../../sparse_solvers/general/core_banded_solver/lss_core_banded_solver.hpp"
+#include "../../sparse_solvers/tridiagonal/thomas_lu_solver/lss_thomas_lu_solver.hpp"
+
+// right-hand side of tridiagonal system with given solution:
+lss_utility::container_t banded_rhs(lss_utility::container_t const &low, lss_utility::container_t const &diag,
+                                    lss_utility::container_t const &high, lss_utility::container_t const &x)
+{
+    const std::size_t n = x.size();
+    lss_utility::container_t rhs(n, double{});
+    for (std::size_t t = 0; t < n; ++t)
+    {
+        rhs[t] = diag[t] * x[t];
+        if (t > 0)
+            rhs[t] += low[t] * x[t - 1];
+        if (t + 1 < n)
+            rhs[t] += high[t] * x[t + 1];
+    }
+    return rhs;
+}
+
+double banded_max_diff(lss_utility::container_t const &first, lss_utility::container_t const &second)
+{
+    double max_diff{};
+    for (std::size_t t = 0; t < first.size(); ++t)
+    {
+        max_diff = std::max(max_diff, std::abs(first[t] - second[t]));
+    }
+    return max_diff;
+}
+
+double impl_core_banded_solve(lss_utility::container_t const &low, lss_utility::container_t const &diag,
+                              lss_utility::container_t const &high, lss_utility::container_t const &x,
+                              lss_enumerations::factorization_enum factorization, std::string const &name)
+{
+    using lss_core_banded_solver::tridiagonal_banded_solver;
+    using lss_utility::container_t;
+
+    tridiagonal_banded_solver solver(x.size());
+    solver.factorize(low, diag, high, factorization);
+    container_t solution = banded_rhs(low, diag, high, x);
+    solver.solve(solution);
+    // factors serve any number of right-hand sides:
+    container_t solution_again = banded_rhs(low, diag, high, x);
+    solver.solve(solution_again);
+
+    const double max_diff = banded_max_diff(solution, x);
+    std::cout << name << ": size " << x.size() << ", max Abs Diff " << max_diff << '\n';
+    LSS_ASSERT(banded_max_diff(solution, solution_again) == 0.0, "Factors must serve repeated solves");
+    return max_diff;
+}
+
+void impl_core_banded_solver_pivoting()
+{
+    using lss_enumerations::factorization_enum;
+    using lss_utility::container_t;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving tridiagonal system with zero diagonal: \n\n";
+    std::cout << " 2*u(i-1) + 0*u(i) + u(i+1) = f(i), i = 0,...,7,\n\n";
+    std::cout << " f chosen so that u(i) = 1 + i/2\n";
+    std::cout << " LU without row interchanges breaks down at the first row\n";
+    std::cout << "============================================================\n";
+
+    // even size keeps the matrix regular:
+    const std::size_t n = 8;
+    container_t low(n, 2.0), diag(n, double{}), high(n, 1.0), x(n);
+    for (std::size_t t = 0; t < n; ++t)
+    {
+        x[t] = 1.0 + 0.5 * static_cast<double>(t);
+    }
+
+    const double lu_diff = impl_core_banded_solve(low, diag, high, x, factorization_enum::LUMethod, "LU");
+    const double qr_diff = impl_core_banded_solve(low, diag, high, x, factorization_enum::QRMethod, "QR");
+    LSS_ASSERT(lu_diff < 1.0e-13, "Pivoted LU solution must match the exact solution");
+    LSS_ASSERT(qr_diff < 1.0e-13, "QR solution must match the exact solution");
+}
+
+void impl_core_banded_solver_qr_vs_thomas_lu()
+{
+    using lss_boundary::dirichlet_boundary_1d;
+    using lss_core_banded_solver::tridiagonal_banded_solver;
+    using lss_enumerations::factorization_enum;
+    using lss_thomas_lu_solver::thomas_lu_solver;
+    using lss_utility::container_t;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving tridiagonal system with QR and Thomas LU: \n\n";
+    std::cout << " -r*u(i-1) + (1+2r+i/N)*u(i) - r*u(i+1) = sin(0.1*i), \n\n";
+    std::cout << " where\n\n";
+    std::cout << " r = 3, i = 1,...,N-1,\n";
+    std::cout << " u(0) = 1 and u(N) = 2\n";
+    std::cout << "============================================================\n";
+
+    // number of space subdivisions:
+    const std::size_t N = 40;
+    const double r = 3.0;
+    container_t low(N + 1, -r), diag(N + 1), high(N + 1, -r), rhs(N + 1);
+    for (std::size_t t = 0; t <= N; ++t)
+    {
+        diag[t] = 1.0 + 2.0 * r + static_cast<double>(t) / static_cast<double>(N);
+        rhs[t] = std::sin(0.1 * static_cast<double>(t));
+    }
+    auto const &boundary_pair =
+        std::make_pair(std::make_shared<dirichlet_boundary_1d>(1.0), std::make_shared<dirichlet_boundary_1d>(2.0));
+    thomas_lu_solver tlu_solver(N + 1);
+    tlu_solver.set_diagonals(low, diag, high);
+    tlu_solver.set_rhs(rhs);
+    container_t tlu_solution(N + 1, double{});
+    tlu_solver.solve(boundary_pair, tlu_solution, 0.0);
+
+    // Dirichlet boundary rows of the banded system are identity rows:
+    container_t banded_low = low, banded_diag = diag, banded_high = high, banded_solution = rhs;
+    banded_diag[0] = banded_diag[N] = 1.0;
+    banded_high[0] = banded_low[N] = 0.0;
+    banded_solution[0] = 1.0;
+    banded_solution[N] = 2.0;
+    tridiagonal_banded_solver solver(N + 1);
+    solver.factorize(banded_low, banded_diag, banded_high, factorization_enum::QRMethod);
+    solver.solve(banded_solution);
+
+    const double max_diff = banded_max_diff(banded_solution, tlu_solution);
+    std::cout << "max Abs Diff (QR vs Thomas LU) " << max_diff << '\n';
+    LSS_ASSERT(max_diff < 1.0e-14, "QR solution must match the Thomas LU solution");
+}
+
+void impl_core_banded_solver_cholesky()
+{
+    using lss_enumerations::factorization_enum;
+    using lss_utility::container_t;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving symmetric positive definite tridiagonal system: \n\n";
+    std::cout << " -u(i-1) + (2+i/N)*u(i) - u(i+1) = f(i), i = 0,...,N,\n\n";
+    std::cout << " f chosen so that u(i) = cos(0.2*i)\n";
+    std::cout << "============================================================\n";
+
+    // number of space subdivisions:
+    const std::size_t N = 30;
+    container_t low(N + 1, -1.0), diag(N + 1), high(N + 1, -1.0), x(N + 1);
+    for (std::size_t t = 0; t <= N; ++t)
+    {
+        diag[t] = 2.0 + static_cast<double>(t) / static_cast<double>(N);
+        x[t] = std::cos(0.2 * static_cast<double>(t));
+    }
+
+    const double cholesky_diff =
+        impl_core_banded_solve(low, diag, high, x, factorization_enum::CholeskyMethod, "Cholesky");
+    const double lu_diff = impl_core_banded_solve(low, diag, high, x, factorization_enum::LUMethod, "LU");
+    LSS_ASSERT(cholesky_diff < 1.0e-12, "Cholesky solution must match the exact solution");
+    LSS_ASSERT(lu_diff < 1.0e-12, "LU solution must match the exact solution");
+}
+
+void impl_core_banded_solver_small_systems()
+{
+    using lss_enumerations::factorization_enum;
+    using lss_utility::container_t;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving systems with one and two unknowns: \n\n";
+    std::cout << " 4*u = 2 and [4 1; 1 3]*u = [6 7]^T (all methods),\n";
+    std::cout << " [1 3; 2 1]*u = [7 4]^T (QR and LU with row interchange)\n";
+    std::cout << "============================================================\n";
+
+    const container_t x_1 = {0.5};
+    const container_t x_2 = {1.0, 2.0};
+    for (auto const factorization :
+         {factorization_enum::QRMethod, factorization_enum::LUMethod, factorization_enum::CholeskyMethod})
+    {
+        const std::string name = (factorization == factorization_enum::QRMethod)   ? "QR"
+                                 : (factorization == factorization_enum::LUMethod) ? "LU"
+                                                                                   : "Cholesky";
+        const double diff_1 = impl_core_banded_solve({0.0}, {4.0}, {0.0}, x_1, factorization, name);
+        const double diff_2 = impl_core_banded_solve({0.0, 1.0}, {4.0, 3.0}, {1.0, 0.0}, x_2, factorization, name);
+        LSS_ASSERT(diff_1 < 1.0e-14, "Single unknown must be solved exactly");
+        LSS_ASSERT(diff_2 < 1.0e-14, "Two unknowns must match the exact solution");
+    }
+    for (auto const factorization : {factorization_enum::QRMethod, factorization_enum::LUMethod})
+    {
+        const std::string name = (factorization == factorization_enum::QRMethod) ? "QR" : "LU";
+        const double diff = impl_core_banded_solve({0.0, 2.0}, {1.0, 1.0}, {3.0, 0.0}, x_2, factorization, name);
+        LSS_ASSERT(diff < 1.0e-14, "Two unknowns must match the exact solution");
+    }
+}
+
+void test_impl_core_banded_solver()
+{
+    std::cout << "============================================================\n";
+    std::cout << "=============== Core Banded Solver (Host) ==================\n";
+    std::cout << "============================================================\n";
+
+    impl_core_banded_solver_pivoting();
+    impl_core_banded_solver_qr_vs_thomas_lu();
+    impl_core_banded_solver_cholesky();
+    impl_core_banded_solver_small_systems();
+
+    std::cout << "============================================================\n";
+}
+
+#endif ///_LSS_CORE_BANDED_SOLVER_T_HPP_
@@ -0,0 +1,97 @@
+#pragma once
+#if !defined(_LSS_SOR_SOLVER_T_HPP_)
+#define _LSS_SOR_SOLVER_T_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+#include "../../boundaries/lss_dirichlet_boundary.hpp"
+#include "../../common/lss_enumerations.hpp"
+#include "../../common/lss_macros.hpp"
+#include "../../common/lss_utility.hpp"
+#include "../../sparse_solvers/tridiagonal/sor_solver/lss_sor_solver.hpp"
+
+std::size_t impl_sor_solver_dirichlet_bc(lss_enumerations::sor_sweep_enum sweep, std::string const &sweep_name)
+{
+    using lss_boundary::dirichlet_boundary_1d;
+    using lss_sor_solver::sor_solver;
+    using lss_utility::container_t;
+    using lss_utility::pi;
+
+    std::cout << "=================================\n";
+    std::cout << "Solving tridiagonal system with SOR (" << sweep_name << " sweep): \n\n";
+    std::cout << " -r*u(i-1) + (1+2r)*u(i) - r*u(i+1) = f(i), \n\n";
+    std::cout << " where\n\n";
+    std::cout << " r = 5, i = 1,...,N-1,\n";
+    std::cout << " u(0) = 0, u(N) = 1 and f chosen so that\n\n";
+    std::cout << "Exact solution is:\n\n";
+    std::cout << " u(x) = sin(pi*x) + x, x = i/N\n";
+    std::cout << "=================================\n";
+
+    // number of space subdivisions:
+    const std::size_t N = 100;
+    const double r = 5.0;
+    auto exact = [](double x) { return std::sin(pi() * x) + x; };
+    container_t low(N + 1, -r);
+    container_t diag(N + 1, 1.0 + 2.0 * r);
+    container_t high(N + 1, -r);
+    container_t rhs(N + 1, double{});
+    container_t u(N + 1, double{});
+    for (std::size_t t = 0; t <= N; ++t)
+    {
+        u[t] = exact(static_cast<double>(t) / static_cast<double>(N));
+    }
+    for (std::size_t t = 1; t < N; ++t)
+    {
+        rhs[t] = low[t] * u[t - 1] + diag[t] * u[t] + high[t] * u[t + 1];
+    }
+    // boundary conditions:
+    auto const &lower_ptr = std::make_shared<dirichlet_boundary_1d>(u[0]);
+    auto const &upper_ptr = std::make_shared<dirichlet_boundary_1d>(u[N]);
+    auto const &boundary_pair = std::make_pair(lower_ptr, upper_ptr);
+
+    sor_solver solver(N + 1);
+    solver.set_sweep(sweep);
+    // Gauss-Seidel relaxation, the Chebyshev sweep schedules its own omega:
+    solver.set_omega(1.0);
+    solver.set_diagonals(low, diag, high);
+    solver.set_rhs(rhs);
+    container_t solution(N + 1, double{});
+    solver.solve(boundary_pair, solution);
+
+    std::cout << "tp : SOR | Exact | Abs Diff\n";
+    double max_diff{};
+    for (std::size_t t = 0; t <= N; ++t)
+    {
+        std::cout << "t_" << t << ": " << solution[t] << " |  " << u[t] << " | " << (solution[t] - u[t]) << '\n';
+        max_diff = std::max(max_diff, std::abs(solution[t] - u[t]));
+    }
+    std::cout << "iterations: " << solver.iterations() << ", max Abs Diff: " << max_diff << '\n';
+    LSS_ASSERT(max_diff < 1.0e-8, "SOR solution must match the exact solution");
+    return solver.iterations();
+}
+
+void test_impl_sor_solver_sweeps()
+{
+    using lss_enumerations::sor_sweep_enum;
+
+    std::cout << "============================================================\n";
+    std::cout << "=================== SOR Solver (Sweeps) ====================\n";
+    std::cout << "============================================================\n";
+
+    const std::size_t natural_its = impl_sor_solver_dirichlet_bc(sor_sweep_enum::Natural, "Natural");
+    const std::size_t red_black_its = impl_sor_solver_dirichlet_bc(sor_sweep_enum::RedBlack, "RedBlack");
+    const std::size_t chebyshev_its =
+        impl_sor_solver_dirichlet_bc(sor_sweep_enum::ChebyshevRedBlack, "ChebyshevRedBlack");
+
+    std::cout << "iterations (Natural | RedBlack | ChebyshevRedBlack): " << natural_its << " | " << red_black_its
+              << " | " << chebyshev_its << '\n';
+    LSS_ASSERT(chebyshev_its < red_black_its, "Chebyshev acceleration must need fewer iterations");
+    LSS_ASSERT(chebyshev_its < natural_its, "Chebyshev acceleration must need fewer iterations");
+
+    std::cout << "============================================================\n";
+}
+
+#endif ///_LSS_SOR_SOLVER_T_HPP_
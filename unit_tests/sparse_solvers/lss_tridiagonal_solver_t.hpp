@@ -0,0 +1,334 @@
+#pragma once
+#if !defined(_LSS_TRIDIAGONAL_SOLVER_T_HPP_)
+#define _LSS_TRIDIAGONAL_SOLVER_T_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "../../boundaries/lss_dirichlet_boundary.hpp"
+#include "../../boundaries/lss_neumann_boundary.hpp"
+#include "../../common/lss_macros.hpp"
+#include "../../common/lss_solver_stats.hpp"
+#include "../../common/lss_utility.hpp"
+#include "../../sparse_solvers/tridiagonal/double_sweep_solver/lss_double_sweep_solver.hpp"
+#include "../../sparse_solvers/tridiagonal/lss_tridiagonal_batch.hpp"
+#include "../../sparse_solvers/tridiagonal/lss_tridiagonal_solver.hpp"
+#include "../../sparse_solvers/tridiagonal/thomas_lu_solver/lss_thomas_lu_solver.hpp"
+
+void impl_tridiagonal_batch_dirichlet_neumann_bc(lss_tridiagonal_solver::tridiagonal_solver_ptr const &solver,
+                                                 std::string const &solver_name)
+{
+    using lss_boundary::boundary_1d_pair;
+    using lss_boundary::boundary_1d_pairs;
+    using lss_boundary::dirichlet_boundary_1d;
+    using lss_boundary::neumann_boundary_1d;
+    using lss_tridiagonal_solver::tridiagonal_batch;
+    using lss_utility::container_t;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving batch of tridiagonal systems with " << solver_name << ": \n\n";
+    std::cout << " -r_s*u(i-1) + (1+2r_s)*u(i) - r_s*u(i+1) = f_s(i), \n\n";
+    std::cout << " where\n\n";
+    std::cout << " r_s = 1 + s/2, f_s(i) = cos(0.1*i*(s+1)), s = 0,...,6, i = 1,...,N-1,\n";
+    std::cout << " u(0) = 1 (or u(0) = s for own boundaries) and u'(1) = 0.5\n\n";
+    std::cout << " Batch solution of every system against single solve\n";
+    std::cout << "============================================================\n";
+
+    // number of space subdivisions:
+    const std::size_t N = 40;
+    // odd number of systems so the batch does not fill whole SIMD lanes:
+    const std::size_t systems_count = 7;
+    std::vector<container_t> lows(systems_count), diags(systems_count), highs(systems_count), rhss(systems_count);
+    for (std::size_t s = 0; s < systems_count; ++s)
+    {
+        const double r = 1.0 + 0.5 * static_cast<double>(s);
+        lows[s].assign(N + 1, -r);
+        diags[s].assign(N + 1, 1.0 + 2.0 * r);
+        highs[s].assign(N + 1, -r);
+        rhss[s].resize(N + 1);
+        for (std::size_t t = 0; t <= N; ++t)
+        {
+            rhss[s][t] = std::cos(0.1 * static_cast<double>(t) * static_cast<double>(s + 1));
+        }
+    }
+    // boundary conditions shared by all systems:
+    auto const &dirichlet_ptr = std::make_shared<dirichlet_boundary_1d>(1.0);
+    auto const &neumann_ptr = std::make_shared<neumann_boundary_1d>(0.5);
+    const boundary_1d_pair boundary_pair = std::make_pair(dirichlet_ptr, neumann_ptr);
+    // own boundary conditions of each system:
+    boundary_1d_pairs boundary_pairs;
+    for (std::size_t s = 0; s < systems_count; ++s)
+    {
+        boundary_pairs.emplace_back(std::make_shared<dirichlet_boundary_1d>(static_cast<double>(s)), neumann_ptr);
+    }
+
+    tridiagonal_batch batch(N + 1, systems_count);
+    auto load_batch = [&]() {
+        for (std::size_t s = 0; s < systems_count; ++s)
+        {
+            batch.low(s).copy_from(lows[s]);
+            batch.diag(s).copy_from(diags[s]);
+            batch.high(s).copy_from(highs[s]);
+            batch.rhs(s).copy_from(rhss[s]);
+        }
+    };
+    auto max_diff_to_single = [&](auto const &boundary_of) {
+        double max_diff{};
+        container_t solution(N + 1, double{});
+        for (std::size_t s = 0; s < systems_count; ++s)
+        {
+            solver->set_diagonals(lows[s], diags[s], highs[s]);
+            solver->set_rhs(rhss[s]);
+            solver->solve(boundary_of(s), solution, 0.0);
+            auto const &batch_solution = batch.solution(s);
+            for (std::size_t t = 0; t <= N; ++t)
+            {
+                max_diff = std::max(max_diff, std::abs(batch_solution[t] - solution[t]));
+            }
+        }
+        return max_diff;
+    };
+
+    load_batch();
+    solver->solve(boundary_pair, batch, 0.0);
+    const double shared_diff = max_diff_to_single([&](std::size_t s) { return boundary_pair; });
+    std::cout << "shared boundary: max Abs Diff (batch vs single) " << shared_diff << '\n';
+    LSS_ASSERT(shared_diff == 0.0, "Batch solution must equal the single solution");
+
+    load_batch();
+    solver->solve(boundary_pairs, batch, 0.0);
+    const double own_diff = max_diff_to_single([&](std::size_t s) { return boundary_pairs[s]; });
+    std::cout << "own boundaries: max Abs Diff (batch vs single) " << own_diff << '\n';
+    LSS_ASSERT(own_diff == 0.0, "Batch solution must equal the single solution");
+}
+
+void test_impl_tridiagonal_batch()
+{
+    using lss_double_sweep_solver::double_sweep_solver;
+    using lss_thomas_lu_solver::thomas_lu_solver;
+
+    std::cout << "============================================================\n";
+    std::cout << "============ Tridiagonal Batch (Dir-Neu BC) ================\n";
+    std::cout << "============================================================\n";
+
+    impl_tridiagonal_batch_dirichlet_neumann_bc(std::make_shared<thomas_lu_solver>(41), "Thomas LU");
+    impl_tridiagonal_batch_dirichlet_neumann_bc(std::make_shared<double_sweep_solver>(41), "Double Sweep");
+
+    std::cout << "============================================================\n";
+}
+
+void impl_thomas_lu_solver_factorization_reuse()
+{
+    using lss_boundary::boundary_1d_pair;
+    using lss_boundary::dirichlet_boundary_1d;
+    using lss_boundary::neumann_boundary_1d;
+    using lss_thomas_lu_solver::thomas_lu_solver;
+    using lss_utility::container_t;
+    using lss_utility::solver_stats;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving tridiagonal systems with one Thomas LU solver: \n\n";
+    std::cout << " -r*u(i-1) + (1+2r)*u(i) - r*u(i+1) = f(i), \n\n";
+    std::cout << " where\n\n";
+    std::cout << " r = 2 (system A) or r = 5 (system B), f(i) = sin(0.1*i), i = 1,...,N-1,\n";
+    std::cout << " u(0) = 1 and u(1) = 0 (or u'(1) = 0.5)\n\n";
+    std::cout << " Solutions reusing the cached factorization against fresh solvers\n";
+    std::cout << "============================================================\n";
+
+    // number of space subdivisions:
+    const std::size_t N = 40;
+    auto system = [&](double r) {
+        return std::make_tuple(container_t(N + 1, -r), container_t(N + 1, 1.0 + 2.0 * r), container_t(N + 1, -r));
+    };
+    container_t rhs(N + 1);
+    for (std::size_t t = 0; t <= N; ++t)
+    {
+        rhs[t] = std::sin(0.1 * static_cast<double>(t));
+    }
+    auto const &dirichlet_low_ptr = std::make_shared<dirichlet_boundary_1d>(1.0);
+    auto const &dirichlet_high_ptr = std::make_shared<dirichlet_boundary_1d>(0.0);
+    auto const &neumann_high_ptr = std::make_shared<neumann_boundary_1d>(0.5);
+    const boundary_1d_pair dirichlet_pair = std::make_pair(dirichlet_low_ptr, dirichlet_high_ptr);
+    const boundary_1d_pair neumann_pair = std::make_pair(dirichlet_low_ptr, neumann_high_ptr);
+    // solution of a freshly constructed solver, which has nothing cached:
+    auto fresh_solve = [&](double r, boundary_1d_pair const &boundary) {
+        thomas_lu_solver solver(N + 1);
+        auto const &diagonals = system(r);
+        solver.set_diagonals(std::get<0>(diagonals), std::get<1>(diagonals), std::get<2>(diagonals));
+        solver.set_rhs(rhs);
+        container_t solution(N + 1, double{});
+        solver.solve(boundary, solution, 0.0);
+        return solution;
+    };
+    auto max_diff = [](container_t const &first, container_t const &second) {
+        double diff{};
+        for (std::size_t t = 0; t < first.size(); ++t)
+        {
+            diff = std::max(diff, std::abs(first[t] - second[t]));
+        }
+        return diff;
+    };
+
+    thomas_lu_solver solver(N + 1);
+    auto const &stats = std::make_shared<solver_stats>();
+    solver.set_stats(stats);
+    container_t solution(N + 1, double{});
+    auto const &diagonals_a = system(2.0);
+    auto const &diagonals_b = system(5.0);
+
+    // system A twice, second solve reuses the factorization:
+    solver.set_diagonals(std::get<0>(diagonals_a), std::get<1>(diagonals_a), std::get<2>(diagonals_a));
+    solver.set_rhs(rhs);
+    solver.solve(dirichlet_pair, solution, 0.0);
+    solver.set_rhs(rhs);
+    solver.solve(dirichlet_pair, solution, 0.0);
+    const container_t solution_a = solution;
+    const double reuse_diff = max_diff(solution_a, fresh_solve(2.0, dirichlet_pair));
+    std::cout << "A after reuse: max Abs Diff (cached vs fresh) " << reuse_diff << '\n';
+    LSS_ASSERT(reuse_diff == 0.0, "Reused factorization must give the fresh solution");
+
+    // reloading equal diagonals keeps the factorization:
+    const std::size_t factorizations = stats->factorizations();
+    auto const &diagonals_a_copy = system(2.0);
+    solver.set_diagonals(std::get<0>(diagonals_a_copy), std::get<1>(diagonals_a_copy), std::get<2>(diagonals_a_copy));
+    solver.set_rhs(rhs);
+    solver.solve(dirichlet_pair, solution, 0.0);
+    std::cout << "A reloaded: factorizations " << stats->factorizations() << '\n';
+    LSS_ASSERT(stats->factorizations() == factorizations, "Equal diagonals must not be factorized again");
+    LSS_ASSERT(!solver_stats::is_enabled() || (factorizations == 1), "System A must be factorized once");
+
+    // new diagonals after the cached solve must rebuild the factorization:
+    solver.set_diagonals(std::get<0>(diagonals_b), std::get<1>(diagonals_b), std::get<2>(diagonals_b));
+    solver.set_rhs(rhs);
+    solver.solve(dirichlet_pair, solution, 0.0);
+    const double rebuild_diff = max_diff(solution, fresh_solve(5.0, dirichlet_pair));
+    const double change = max_diff(solution, solution_a);
+    std::cout << "B after A: max Abs Diff (cached vs fresh) " << rebuild_diff << ", change from A " << change << '\n';
+    LSS_ASSERT(rebuild_diff == 0.0, "Factorization must be rebuilt after set_diagonals");
+    LSS_ASSERT(change > 1.0e-3, "Systems A and B must have different solutions");
+
+    // boundary with different linear part keeps the diagonals but must rebuild the factorization too:
+    solver.set_rhs(rhs);
+    solver.solve(neumann_pair, solution, 0.0);
+    const double boundary_diff = max_diff(solution, fresh_solve(5.0, neumann_pair));
+    std::cout << "B with Neumann BC: max Abs Diff (cached vs fresh) " << boundary_diff << '\n';
+    LSS_ASSERT(boundary_diff == 0.0, "Factorization must be rebuilt after boundary change");
+}
+
+void impl_thomas_lu_solver_batch_factorization_reuse()
+{
+    using lss_boundary::boundary_1d_pair;
+    using lss_boundary::dirichlet_boundary_1d;
+    using lss_boundary::neumann_boundary_1d;
+    using lss_thomas_lu_solver::thomas_lu_solver;
+    using lss_tridiagonal_solver::tridiagonal_batch;
+    using lss_utility::container_t;
+    using lss_utility::solver_stats;
+
+    std::cout << "============================================================\n";
+    std::cout << "Solving batch of tridiagonal systems with one Thomas LU solver: \n\n";
+    std::cout << " -r_s*u(i-1) + (1+2r_s)*u(i) - r_s*u(i+1) = f_s(i), \n\n";
+    std::cout << " where\n\n";
+    std::cout << " r_s = 1 + s/2, f_s(i) = sin(0.1*i*(s+1)) or cos(0.1*i*(s+1)), s = 0,...,6, i = 1,...,N-1,\n";
+    std::cout << " u(0) = 1 and u(1) = 0 (or u'(1) = 0.5)\n\n";
+    std::cout << " Batch solutions with kept diagonals against a fresh solver\n";
+    std::cout << "============================================================\n";
+
+    // number of space subdivisions:
+    const std::size_t N = 40;
+    const std::size_t systems_count = 7;
+    auto const &dirichlet_low_ptr = std::make_shared<dirichlet_boundary_1d>(1.0);
+    auto const &dirichlet_high_ptr = std::make_shared<dirichlet_boundary_1d>(0.0);
+    auto const &neumann_high_ptr = std::make_shared<neumann_boundary_1d>(0.5);
+    const boundary_1d_pair dirichlet_pair = std::make_pair(dirichlet_low_ptr, dirichlet_high_ptr);
+    const boundary_1d_pair neumann_pair = std::make_pair(dirichlet_low_ptr, neumann_high_ptr);
+    auto load_batch = [&](tridiagonal_batch &batch, double (*rhs_fun)(double)) {
+        for (std::size_t s = 0; s < systems_count; ++s)
+        {
+            const double r = 1.0 + 0.5 * static_cast<double>(s);
+            for (std::size_t t = 0; t <= N; ++t)
+            {
+                batch.low(s)[t] = -r;
+                batch.diag(s)[t] = 1.0 + 2.0 * r;
+                batch.high(s)[t] = -r;
+                batch.rhs(s)[t] = rhs_fun(0.1 * static_cast<double>(t) * static_cast<double>(s + 1));
+            }
+        }
+    };
+    // solution of a freshly constructed solver, which has nothing cached:
+    auto max_diff_to_fresh = [&](tridiagonal_batch const &batch, double (*rhs_fun)(double),
+                                 boundary_1d_pair const &boundary) {
+        thomas_lu_solver solver(N + 1);
+        tridiagonal_batch fresh_batch(N + 1, systems_count);
+        load_batch(fresh_batch, rhs_fun);
+        solver.solve(boundary, fresh_batch, 0.0);
+        double max_diff{};
+        for (std::size_t s = 0; s < systems_count; ++s)
+        {
+            for (std::size_t t = 0; t <= N; ++t)
+            {
+                max_diff = std::max(max_diff, std::abs(batch.solution(s)[t] - fresh_batch.solution(s)[t]));
+            }
+        }
+        return max_diff;
+    };
+    auto sine = [](double x) { return std::sin(x); };
+    auto cosine = [](double x) { return std::cos(x); };
+
+    thomas_lu_solver solver(N + 1);
+    auto const &stats = std::make_shared<solver_stats>();
+    solver.set_stats(stats);
+    tridiagonal_batch batch(N + 1, systems_count);
+
+    load_batch(batch, sine);
+    solver.solve(dirichlet_pair, batch, 0.0);
+    const std::size_t first_factorizations = stats->factorizations();
+
+    // kept diagonals with new right-hand sides reuse the factorization:
+    load_batch(batch, cosine);
+    batch.set_diagonals_kept(true);
+    solver.solve(dirichlet_pair, batch, 0.0);
+    const double reuse_diff = max_diff_to_fresh(batch, cosine, dirichlet_pair);
+    std::cout << "kept diagonals: max Abs Diff (cached vs fresh) " << reuse_diff << ", factorizations "
+              << stats->factorizations() << '\n';
+    LSS_ASSERT(reuse_diff == 0.0, "Reused batch factorization must give the fresh solution");
+    LSS_ASSERT(stats->factorizations() == first_factorizations, "Kept diagonals must not be factorized again");
+    LSS_ASSERT(!batch.are_diagonals_kept(), "Solve must clear the kept diagonals declaration");
+
+    // kept diagonals with a different linear part of boundary must rebuild the factorization:
+    load_batch(batch, cosine);
+    batch.set_diagonals_kept(true);
+    solver.solve(neumann_pair, batch, 0.0);
+    const double boundary_diff = max_diff_to_fresh(batch, cosine, neumann_pair);
+    std::cout << "Neumann BC: max Abs Diff (cached vs fresh) " << boundary_diff << '\n';
+    LSS_ASSERT(boundary_diff == 0.0, "Batch factorization must be rebuilt after boundary change");
+
+    // undeclared diagonals are always factorized again:
+    load_batch(batch, sine);
+    solver.solve(neumann_pair, batch, 0.0);
+    const double undeclared_diff = max_diff_to_fresh(batch, sine, neumann_pair);
+    std::cout << "undeclared diagonals: max Abs Diff (cached vs fresh) " << undeclared_diff << ", factorizations "
+              << stats->factorizations() << '\n';
+    LSS_ASSERT(undeclared_diff == 0.0, "Batch factorization must be rebuilt for undeclared diagonals");
+    LSS_ASSERT(stats->factorizations() == 3 * first_factorizations, "Every rebuild must factorize all systems");
+    LSS_ASSERT(!solver_stats::is_enabled() || (first_factorizations == systems_count),
+               "Each system of the batch counts one factorization");
+}
+
+void test_impl_thomas_lu_solver_factorization_reuse()
+{
+    std::cout << "============================================================\n";
+    std::cout << "========== Thomas LU Solver (Factorization Reuse) ==========\n";
+    std::cout << "============================================================\n";
+
+    impl_thomas_lu_solver_factorization_reuse();
+    impl_thomas_lu_solver_batch_factorization_reuse();
+
+    std::cout << "============================================================\n";
+}
+
+#endif ///_LSS_TRIDIAGONAL_SOLVER_T_HPP_